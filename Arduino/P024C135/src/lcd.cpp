@@ -3,7 +3,6 @@
 #include "../inc/lcdfont.h"
 #include <stdlib.h>
 
-#define MAX_BUFFER_SIZE 256		// 根据可用RAM调整
 #define MAX_ALLOWED_DISTANCE 50 // 像素
 
 /******************************************************************************
@@ -15,23 +14,10 @@
 ******************************************************************************/
 void LCD_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
 {
+	uint32_t pixelCount = (uint32_t)(xend - xsta + 1) * (yend - ysta + 1);
 
 	LCD_Address_Set(xsta, ysta, xend, yend); // 设置显示范围
-
-	// 准备颜色数据 (高位在前)
-	uint8_t colorHi = color >> 8;
-	uint8_t colorLo = color;
-
-	uint32_t pixelCount = (xend - xsta + 1) * (yend - ysta + 1);
-
-	LCD_DC_Set();
-	LCD_CS_Clr();
-	for (uint32_t i = 0; i < pixelCount * 2; i++)
-	{
-		SPI.transfer(colorHi);
-		SPI.transfer(colorLo);
-	}
-  LCD_CS_Set();	
+	LCD_WR_Color(color, pixelCount);		 // 整块连续发送,片选只拉低一次
 }
 
 /******************************************************************************
@@ -109,9 +95,17 @@ void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t c
 // color:颜色
 void gui_draw_hline(uint16_t x0, uint16_t y0, uint16_t len, uint16_t color)
 {
-	if (len == 0)
+	int32_t xs = (int16_t)x0, xe = xs + len - 1;
+
+	if (len == 0 || y0 >= LCD_H)
+		return;
+	if (xs < 0)
+		xs = 0; // 圆靠近屏幕边缘时起点可能为负,裁剪到屏幕范围内
+	if (xe >= LCD_W)
+		xe = LCD_W - 1;
+	if (xs > xe)
 		return;
-	LCD_DrawLine(x0, y0, x0 + len - 1, y0, color);
+	LCD_Fill(xs, y0, xe, y0, color); // 整行一次发送
 }
 
 void gui_fill_circle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color)
@@ -377,6 +371,42 @@ void Draw_Circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
 	}
 }
 
+static uint8_t lcd_glyph_buf[32 * 32 * LCD_PIXEL_BYTES]; // 非叠加模式下一个字的颜色数据
+
+/******************************************************************************
+	  函数说明：非叠加模式显示一个字
+	  入口数据：x,y显示坐标
+				msk 字模,每行(sizex+7)/8字节,低位在前
+				sizex,sizey 字的宽和高
+				fc 字的颜色
+				bc 字的背景色
+	  返回值：  无
+	  说    明：整个字转换为颜色数据后一次发送,片选只拉低一次
+******************************************************************************/
+static void LCD_Writ_Glyph(uint16_t x, uint16_t y, const uint8_t *msk, uint8_t sizex, uint8_t sizey, uint16_t fc, uint16_t bc)
+{
+	uint16_t i, TypefaceNum = (sizex / 8 + ((sizex % 8) ? 1 : 0)) * sizey;
+	uint8_t j, m = 0;
+	uint8_t *p = lcd_glyph_buf;
+
+	LCD_WR_Wait(); // 上一个字可能仍在发送
+	for (i = 0; i < TypefaceNum; i++)
+	{
+		for (j = 0; j < 8; j++)
+		{
+			LCD_Color_Bytes(p, (msk[i] & (0x01 << j)) ? fc : bc);
+			p += LCD_PIXEL_BYTES;
+			if (++m == sizex)
+			{
+				m = 0;
+				break;
+			}
+		}
+	}
+	LCD_Address_Set(x, y, x + sizex - 1, y + sizey - 1);
+	LCD_WR_Buffer(lcd_glyph_buf, p - lcd_glyph_buf);
+}
+
 /******************************************************************************
 	  函数说明：显示汉字串
 	  入口数据：x,y显示坐标
@@ -418,7 +448,7 @@ void LCD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t b
 ******************************************************************************/
 void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-	uint8_t i, j, m = 0;
+	uint8_t i, j;
 	uint16_t k;
 	uint16_t HZnum;		  // 汉字数目
 	uint16_t TypefaceNum; // 一个字符所占字节大小
@@ -430,35 +460,24 @@ void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 	{
 		if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s + 1)) && (tfont12[k].Index[2] == *(s + 2)))
 		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
+			if (!mode) // 非叠加方式
+			{
+				LCD_Writ_Glyph(x, y, tfont12[k].Msk, sizey, sizey, fc, bc);
+				continue;
+			}
+			for (i = 0; i < TypefaceNum; i++) // 叠加方式
 			{
 				for (j = 0; j < 8; j++)
 				{
-					if (!mode) // 非叠加方式
+					if (tfont12[k].Msk[i] & (0x01 << j))
+						LCD_DrawPoint(x, y, fc); // 画一个点
+					x++;
+					if ((x - x0) == sizey)
 					{
-						if (tfont12[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // 叠加方式
-					{
-						if (tfont12[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // 画一个点
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
+						x = x0;
+						y++;
+						break;
+
 					}
 				}
 			}
@@ -479,7 +498,7 @@ void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 ******************************************************************************/
 void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-	uint8_t i, j, m = 0;
+	uint8_t i, j;
 	uint16_t k;
 	uint16_t HZnum;		  // 汉字数目
 	uint16_t TypefaceNum; // 一个字符所占字节大小
@@ -490,35 +509,24 @@ void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 	{
 		if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s + 1)) && (tfont16[k].Index[2] == *(s + 2)))
 		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
+			if (!mode) // 非叠加方式
+			{
+				LCD_Writ_Glyph(x, y, tfont16[k].Msk, sizey, sizey, fc, bc);
+				continue;
+			}
+			for (i = 0; i < TypefaceNum; i++) // 叠加方式
 			{
 				for (j = 0; j < 8; j++)
 				{
-					if (!mode) // 非叠加方式
+					if (tfont16[k].Msk[i] & (0x01 << j))
+						LCD_DrawPoint(x, y, fc); // 画一个点
+					x++;
+					if ((x - x0) == sizey)
 					{
-						if (tfont16[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // 叠加方式
-					{
-						if (tfont16[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // 画一个点
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
+						x = x0;
+						y++;
+						break;
+
 					}
 				}
 			}
@@ -539,7 +547,7 @@ void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 ******************************************************************************/
 void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-	uint8_t i, j, m = 0;
+	uint8_t i, j;
 	uint16_t k;
 	uint16_t HZnum;		  // 汉字数目
 	uint16_t TypefaceNum; // 一个字符所占字节大小
@@ -550,35 +558,24 @@ void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 	{
 		if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s + 1)) && (tfont24[k].Index[2] == *(s + 2)))
 		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
+			if (!mode) // 非叠加方式
+			{
+				LCD_Writ_Glyph(x, y, tfont24[k].Msk, sizey, sizey, fc, bc);
+				continue;
+			}
+			for (i = 0; i < TypefaceNum; i++) // 叠加方式
 			{
 				for (j = 0; j < 8; j++)
 				{
-					if (!mode) // 非叠加方式
+					if (tfont24[k].Msk[i] & (0x01 << j))
+						LCD_DrawPoint(x, y, fc); // 画一个点
+					x++;
+					if ((x - x0) == sizey)
 					{
-						if (tfont24[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // 叠加方式
-					{
-						if (tfont24[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // 画一个点
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
+						x = x0;
+						y++;
+						break;
+
 					}
 				}
 			}
@@ -599,7 +596,7 @@ void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 ******************************************************************************/
 void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-	uint8_t i, j, m = 0;
+	uint8_t i, j;
 	uint16_t k;
 	uint16_t HZnum;		  // 汉字数目
 	uint16_t TypefaceNum; // 一个字符所占字节大小
@@ -610,35 +607,24 @@ void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 	{
 		if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s + 1)) && (tfont32[k].Index[2] == *(s + 2)))
 		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
+			if (!mode) // 非叠加方式
+			{
+				LCD_Writ_Glyph(x, y, tfont32[k].Msk, sizey, sizey, fc, bc);
+				continue;
+			}
+			for (i = 0; i < TypefaceNum; i++) // 叠加方式
 			{
 				for (j = 0; j < 8; j++)
 				{
-					if (!mode) // 非叠加方式
-					{
-						if (tfont32[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // 叠加方式
+					if (tfont32[k].Msk[i] & (0x01 << j))
+						LCD_DrawPoint(x, y, fc); // 画一个点
+					x++;
+					if ((x - x0) == sizey)
 					{
-						if (tfont32[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // 画一个点
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
+						x = x0;
+						y++;
+						break;
+
 					}
 				}
 			}
@@ -659,51 +645,41 @@ void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint1
 ******************************************************************************/
 void LCD_ShowChar(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-	uint8_t temp, sizex, t, m = 0;
+	uint8_t temp, sizex, t;
 	uint16_t i, TypefaceNum; // 一个字符所占字节大小
 	uint16_t x0 = x;
+	const uint8_t *msk;
 	sizex = sizey / 2;
 	TypefaceNum = (sizex / 8 + ((sizex % 8) ? 1 : 0)) * sizey;
 	num = num - ' ';									 // 得到偏移后的值
-	LCD_Address_Set(x, y, x + sizex - 1, y + sizey - 1); // 设置光标位置
-	for (i = 0; i < TypefaceNum; i++)
+	if (sizey == 12)
+		msk = ascii_1206[num]; // 调用6x12字体
+	else if (sizey == 16)
+		msk = ascii_1608[num]; // 调用8x16字体
+	else if (sizey == 24)
+		msk = ascii_2412[num]; // 调用12x24字体
+	else if (sizey == 32)
+		msk = ascii_3216[num]; // 调用16x32字体
+	else
+		return;
+	if (!mode) // 非叠加模式
 	{
-		if (sizey == 12)
-			temp = ascii_1206[num][i]; // 调用6x12字体
-		else if (sizey == 16)
-			temp = ascii_1608[num][i]; // 调用8x16字体
-		else if (sizey == 24)
-			temp = ascii_2412[num][i]; // 调用12x24字体
-		else if (sizey == 32)
-			temp = ascii_3216[num][i]; // 调用16x32字体
-		else
-			return;
+		LCD_Writ_Glyph(x, y, msk, sizex, sizey, fc, bc);
+		return;
+	}
+	for (i = 0; i < TypefaceNum; i++) // 叠加模式
+	{
+		temp = msk[i];
 		for (t = 0; t < 8; t++)
 		{
-			if (!mode) // 非叠加模式
+			if (temp & (0x01 << t))
+				LCD_DrawPoint(x, y, fc); // 画一个点
+			x++;
+			if ((x - x0) == sizex)
 			{
-				if (temp & (0x01 << t))
-					LCD_WR_DATA(fc);
-				else
-					LCD_WR_DATA(bc);
-				m++;
-				if (m % sizex == 0)
-				{
-					m = 0;
-					break;
-				}
-			}
-			else // 叠加模式
-			{
-				if (temp & (0x01 << t))
-					LCD_DrawPoint(x, y, fc); // 画一个点
-				x++;
-				if ((x - x0) == sizex)
-				{
-					x = x0;
-					y++;
-					break;
-				}
+				x = x0;
+				y++;
+				break;
 			}
 		}
 	}
@@ -813,40 +789,14 @@ void LCD_ShowFloatNum1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t
 ******************************************************************************/
 void LCD_ShowPicture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[])
 {
-	// 计算显示区域的结束坐标
-	uint16_t x_end = x + length;
-	uint16_t y_end = y + width;
+	if (length == 0 || width == 0)
+		return;
 
 	// 设置显示范围
-	LCD_Address_Set(x, y, x_end, y_end);
-
-	// 计算总像素数
-	uint32_t pixelCount = length * width;
-
-	// 计算图片数据总字节数 (假设每个像素2字节)
-	uint32_t dataSize = pixelCount * 2;
-
-	// 分块传输参数
-	uint32_t remaining = dataSize;
-	uint32_t offset = 0;
-
-	uint8_t* dynamic_buf = (uint8_t*)malloc(MAX_BUFFER_SIZE);
-	LCD_DC_Set();
-	LCD_CS_Clr();
-	// 分块传输图片数据
-	while (remaining > 0)
-	{
-		uint32_t chunkSize = (remaining > MAX_BUFFER_SIZE) ? MAX_BUFFER_SIZE : remaining;
-		memcpy(dynamic_buf, pic + offset, chunkSize);
-		// 发送当前数据块
-		SPI.transfer(dynamic_buf, chunkSize);
-
-		offset += chunkSize;
-		remaining -= chunkSize;
-	}
-  LCD_CS_Set();	
-	free(dynamic_buf);
+	LCD_Address_Set(x, y, x + length - 1, y + width - 1);
 
+	// 图片数据直接从flash整块发送,不再分块复制到RAM
+	LCD_WR_Buffer(pic, (uint32_t)length * width * LCD_PIXEL_BYTES);
 }
 
 /* 绘制颜色条 */
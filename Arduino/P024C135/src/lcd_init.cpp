@@ -24,6 +24,48 @@ static void LCD_GPIO_Init(void)
 }
 
 
+#define LCD_COLOR_BUF_PIXELS 256 // LCD_WR_Color每次发送的像素数
+
+static bool lcd_spi_async = false; // 异步传输进行中,片选保持为低直到LCD_WR_Wait
+static uint8_t lcd_color_buf[LCD_COLOR_BUF_PIXELS * LCD_PIXEL_BYTES]; // LCD_WR_Color重复发送的颜色数据
+
+/******************************************************************************
+      函数说明：等待异步传输结束并释放片选
+      入口数据：无
+      返回值：  无
+      说    明：改变DC、片选或发送中的缓冲区之前必须调用,本文件的写函数都已调用
+******************************************************************************/
+void LCD_WR_Wait(void) {
+	if (!lcd_spi_async)
+		return;
+#if LCD_SPI_ASYNC
+	while (!SPI.finishedAsync())
+		;
+#endif
+	lcd_spi_async = false;
+	LCD_CS_Set();
+}
+
+/******************************************************************************
+      函数说明：在已拉低的片选内发送一段数据
+      入口数据：buf 数据首地址
+                len 字节数
+      返回值：  无
+      说    明：异步发送时只等待上一段发完,返回时本段可能仍在发送
+******************************************************************************/
+static void LCD_Writ_Block(const uint8_t *buf, uint32_t len)
+{
+#if LCD_SPI_ASYNC
+	if (lcd_spi_async)
+		while (!SPI.finishedAsync())
+			;
+	lcd_spi_async = SPI.transferAsync(buf, NULL, len);
+	if (lcd_spi_async)
+		return;
+#endif
+	SPI.transfer(buf, NULL, len); // 只发送,不覆盖buf
+}
+
 /******************************************************************************
       函数说明：LCD串行数据写入函数
       入口数据：dat  要写入的串行数据
@@ -31,9 +73,10 @@ static void LCD_GPIO_Init(void)
 ******************************************************************************/
 static inline void LCD_Writ_Bus(uint8_t dat) 
 {	
+	LCD_WR_Wait();
 	LCD_CS_Clr();
 	SPI.transfer(dat);
-  LCD_CS_Set();	
+	LCD_CS_Set();
 }
 
 /******************************************************************************
@@ -51,8 +94,52 @@ void LCD_WR_DATA8(uint8_t dat) {
 	  返回值：  无
 ******************************************************************************/
 void LCD_WR_DATA(uint16_t dat) {
-	LCD_Writ_Bus(dat>>8);
-	LCD_Writ_Bus(dat);
+	LCD_WR_Wait();
+	LCD_CS_Clr();
+	SPI.transfer16(dat); // 两个字节在一次片选内发送
+	LCD_CS_Set();
+}
+
+/******************************************************************************
+	  函数说明：连续发送一段数据
+	  入口数据：buf 数据首地址,可以在flash中
+				len 字节数
+	  返回值：  无
+	  说    明：整段只拉低一次片选;LCD_SPI_ASYNC为1时由DMA发送,
+				函数返回时可能仍在发送,传输完成前buf必须保持有效
+******************************************************************************/
+void LCD_WR_Buffer(const uint8_t *buf, uint32_t len) {
+	LCD_WR_Wait();
+	LCD_DC_Set();
+	LCD_CS_Clr();
+	LCD_Writ_Block(buf, len);
+	if (!lcd_spi_async)
+		LCD_CS_Set();
+}
+
+/******************************************************************************
+	  函数说明：连续发送count个相同颜色的像素
+	  入口数据：color 颜色
+				count 像素数
+	  返回值：  无
+	  说    明：颜色数据在缓冲区中只生成一次,整段只拉低一次片选
+******************************************************************************/
+void LCD_WR_Color(uint16_t color, uint32_t count) {
+	uint32_t i, n = (count < LCD_COLOR_BUF_PIXELS) ? count : LCD_COLOR_BUF_PIXELS;
+
+	LCD_WR_Wait(); // 缓冲区可能仍在发送
+	for (i = 0; i < n; i++)
+		LCD_Color_Bytes(&lcd_color_buf[i * LCD_PIXEL_BYTES], color);
+	LCD_DC_Set();
+	LCD_CS_Clr();
+	while (count > 0)
+	{
+		n = (count < LCD_COLOR_BUF_PIXELS) ? count : LCD_COLOR_BUF_PIXELS;
+		LCD_Writ_Block(lcd_color_buf, n * LCD_PIXEL_BYTES);
+		count -= n;
+	}
+	if (!lcd_spi_async)
+		LCD_CS_Set();
 }
 
 /******************************************************************************
@@ -61,6 +148,7 @@ void LCD_WR_DATA(uint16_t dat) {
 	  返回值：  无
 ******************************************************************************/
 static inline void LCD_WR_REG(uint8_t dat) {
+	LCD_WR_Wait();
 	LCD_DC_Clr();  // 写命令
 	LCD_Writ_Bus(dat);
 	LCD_DC_Set();
@@ -71,15 +159,25 @@ static inline void LCD_WR_REG(uint8_t dat) {
 	  入口数据：x1,x2 设置列的起始和结束地址
 				y1,y2 设置行的起始和结束地址
 	  返回值：  无
+	  说    明：三条命令和参数在一次片选内发送,只切换DC
 ******************************************************************************/
 void LCD_Address_Set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-	LCD_WR_REG(0x2a); //列地址设置
-	LCD_WR_DATA(x1 );
-	LCD_WR_DATA(x2 );
-	LCD_WR_REG(0x2b); //行地址设置
-	LCD_WR_DATA(y1);
-	LCD_WR_DATA(y2);
-	LCD_WR_REG(0x2c); //储存器写
+	LCD_WR_Wait();
+	LCD_CS_Clr();
+	LCD_DC_Clr();
+	SPI.transfer(0x2a); //列地址设置
+	LCD_DC_Set();
+	SPI.transfer16(x1);
+	SPI.transfer16(x2);
+	LCD_DC_Clr();
+	SPI.transfer(0x2b); //行地址设置
+	LCD_DC_Set();
+	SPI.transfer16(y1);
+	SPI.transfer16(y2);
+	LCD_DC_Clr();
+	SPI.transfer(0x2c); //储存器写
+	LCD_DC_Set();
+	LCD_CS_Set();
 }
 
 void LCD_Init(void) {
@@ -25,6 +25,24 @@
 
 extern SPISettings lcdSPISettings;
 
+#define LCD_PIXEL_BYTES 2 // 每个像素发送的字节数,RGB565
+
+// arduino-pico 4.0起SPI支持DMA的transferAsync,整块数据改为异步发送,较早的版本为0
+#ifndef LCD_SPI_ASYNC
+#if defined(ARDUINO_ARCH_RP2040) && defined(ARDUINO_PICO_MAJOR) && ARDUINO_PICO_MAJOR >= 4
+#define LCD_SPI_ASYNC 1
+#else
+#define LCD_SPI_ASYNC 0
+#endif
+#endif
+
+// 把RGB565颜色转换为屏幕接收的字节,高位在前
+static inline void LCD_Color_Bytes(uint8_t *p, uint16_t color)
+{
+	p[0] = color >> 8;
+	p[1] = color;
+}
+
 //-----------------LCD端口定义---------------- 
 // 复位引脚操作
 #define LCD_RES_Clr()  digitalWrite(LCD_RES_PIN, LOW)  // 拉低RES引脚
@@ -46,6 +64,9 @@ extern SPISettings lcdSPISettings;
 // void LCD_Writ_Bus(uint8_t dat);//模拟SPI时序
 void LCD_WR_DATA8(uint8_t dat);//写入一个字节
 void LCD_WR_DATA(uint16_t dat);//写入两个字节
+void LCD_WR_Buffer(const uint8_t *buf, uint32_t len);//连续发送一段数据,可能异步
+void LCD_WR_Color(uint16_t color, uint32_t count);//连续发送count个相同颜色的像素
+void LCD_WR_Wait(void);//等待异步传输结束并释放片选
 // void LCD_WR_REG(uint8_t dat);//写入一个指令
 void LCD_Address_Set(uint16_t x1,uint16_t y1,uint16_t x2,uint16_t y2);//设置坐标函数
 void LCD_Init(void);//LCD初始化
@@ -46,404 +46,401 @@ LBBLUE = 0X2B12     # 浅棕蓝色(选择条目的反色)
 
 
 #占用内存较大，不适合使用太多字体，太多字体使用字库
+#字模用bytes保存，比列表省内存，viper函数可直接按字节读取
 ascii_1206 = {
-    " ":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # " ",0
-    "!":[0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00],  # "!",1
-    "\"":[0x14, 0x14, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "\"",2
-    "#":[0x00, 0x00, 0x0A, 0x0A, 0x1F, 0x0A, 0x0A, 0x1F, 0x0A, 0x0A, 0x00, 0x00],  # "#",3
-    "$":[0x00, 0x04, 0x0E, 0x15, 0x05, 0x06, 0x0C, 0x14, 0x15, 0x0E, 0x04, 0x00],  # "$",4
-    "%":[0x00, 0x00, 0x12, 0x15, 0x0D, 0x15, 0x2E, 0x2C, 0x2A, 0x12, 0x00, 0x00],  # "%",5
-    "&":[0x00, 0x00, 0x04, 0x0A, 0x0A, 0x36, 0x15, 0x15, 0x29, 0x16, 0x00, 0x00],  # "&",6
-    "'":[0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "'",7
-    "(":[0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x00],  # "(",8
-    ")":[0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x00],  # ")",9
-    "*":[0x00, 0x00, 0x00, 0x04, 0x15, 0x0E, 0x0E, 0x15, 0x04, 0x00, 0x00, 0x00],  # "*",10
-    "+":[0x00, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00],  # "+",11
-    ",":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00],  # ",",12
-    "-":[0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "-",13
-    ".":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00],  # ".",14
-    "/":[0x00, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x00],  # "/",15
-    "0":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00],  # "0",16
-    "1":[0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00],  # "1",17
-    "2":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x08, 0x04, 0x02, 0x01, 0x1F, 0x00, 0x00],  # "2",18
-    "3":[0x00, 0x00, 0x0E, 0x11, 0x10, 0x0C, 0x10, 0x10, 0x11, 0x0E, 0x00, 0x00],  # "3",19
-    "4":[0x00, 0x00, 0x08, 0x0C, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x1C, 0x00, 0x00],  # "4",20
-    "5":[0x00, 0x00, 0x1F, 0x01, 0x01, 0x0F, 0x11, 0x10, 0x11, 0x0E, 0x00, 0x00],  # "5",21
-    "6":[0x00, 0x00, 0x0C, 0x12, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0E, 0x00, 0x00],  # "6",22
-    "7":[0x00, 0x00, 0x1E, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00],  # "7",23
-    "8":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00],  # "8",24
-    "9":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x19, 0x16, 0x10, 0x09, 0x06, 0x00, 0x00],  # "9",25
-    ":":[0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00],  # ":",26
-    ";":[0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00],  # ";",27
-    "<":[0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00],  # "<",28
-    "=":[0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00],  # "=",29
-    ">":[0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00],  # ">",30
-    "?":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x08, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00],  # "?",31
-    "@":[0x00, 0x00, 0x1C, 0x22, 0x29, 0x2D, 0x2D, 0x1D, 0x22, 0x1C, 0x00, 0x00],  # "@",32
-    "A":[0x00, 0x00, 0x04, 0x04, 0x0C, 0x0A, 0x0A, 0x1E, 0x12, 0x33, 0x00, 0x00],  # "A",33
-    "B":[0x00, 0x00, 0x0F, 0x12, 0x12, 0x0E, 0x12, 0x12, 0x12, 0x0F, 0x00, 0x00],  # "B",34
-    "C":[0x00, 0x00, 0x1E, 0x11, 0x01, 0x01, 0x01, 0x01, 0x11, 0x0E, 0x00, 0x00],  # "C",35
-    "D":[0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0F, 0x00, 0x00],  # "D",36
-    "E":[0x00, 0x00, 0x1F, 0x12, 0x0A, 0x0E, 0x0A, 0x02, 0x12, 0x1F, 0x00, 0x00],  # "E",37
-    "F":[0x00, 0x00, 0x1F, 0x12, 0x0A, 0x0E, 0x0A, 0x02, 0x02, 0x07, 0x00, 0x00],  # "F",38
-    "G":[0x00, 0x00, 0x1C, 0x12, 0x01, 0x01, 0x39, 0x11, 0x12, 0x0C, 0x00, 0x00],  # "G",39
-    "H":[0x00, 0x00, 0x33, 0x12, 0x12, 0x1E, 0x12, 0x12, 0x12, 0x33, 0x00, 0x00],  # "H",40
-    "I":[0x00, 0x00, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00, 0x00],  # "I",41
-    "J":[0x00, 0x00, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x07],  # "J",42
-    "K":[0x00, 0x00, 0x37, 0x12, 0x0A, 0x06, 0x0A, 0x12, 0x12, 0x37, 0x00, 0x00],  # "K",43
-    "L":[0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x3F, 0x00, 0x00],  # "L",44
-    "M":[0x00, 0x00, 0x3B, 0x1B, 0x1B, 0x1B, 0x15, 0x15, 0x15, 0x35, 0x00, 0x00],  # "M",45
-    "N":[0x00, 0x00, 0x3B, 0x12, 0x16, 0x16, 0x1A, 0x1A, 0x12, 0x17, 0x00, 0x00],  # "N",46
-    "O":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00],  # "O",47
-    "P":[0x00, 0x00, 0x0F, 0x12, 0x12, 0x0E, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00],  # "P",48
-    "Q":[0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x17, 0x19, 0x0E, 0x18, 0x00],  # "Q",49
-    "R":[0x00, 0x00, 0x0F, 0x12, 0x12, 0x0E, 0x0A, 0x12, 0x12, 0x37, 0x00, 0x00],  # "R",50
-    "S":[0x00, 0x00, 0x1E, 0x11, 0x01, 0x06, 0x08, 0x10, 0x11, 0x0F, 0x00, 0x00],  # "S",51
-    "T":[0x00, 0x00, 0x1F, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00],  # "T",52
-    "U":[0x00, 0x00, 0x33, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0C, 0x00, 0x00],  # "U",53
-    "V":[0x00, 0x00, 0x33, 0x12, 0x12, 0x0A, 0x0A, 0x0C, 0x04, 0x04, 0x00, 0x00],  # "V",54
-    "W":[0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x0E, 0x0A, 0x0A, 0x0A, 0x00, 0x00],  # "W",55
-    "X":[0x00, 0x00, 0x1B, 0x0A, 0x0A, 0x04, 0x04, 0x0A, 0x0A, 0x1B, 0x00, 0x00],  # "X",56
-    "Y":[0x00, 0x00, 0x1B, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00],  # "Y",57
-    "Z":[0x00, 0x00, 0x1F, 0x09, 0x08, 0x04, 0x04, 0x02, 0x12, 0x1F, 0x00, 0x00],  # "Z",58
-    "[":[0x1C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1C, 0x00],  # "[",59
-    "\\":[0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x00],  # "\\",60
-    "]":[0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E, 0x00],  # "]",61
-    "^":[0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "^",62
-    "_":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F],  # "_",63
-    "`":[0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "`",64
-    "a":[0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x1C, 0x12, 0x3C, 0x00, 0x00],  # "a",65
-    "b":[0x00, 0x03, 0x02, 0x02, 0x02, 0x0E, 0x12, 0x12, 0x12, 0x0E, 0x00, 0x00],  # "b",66
-    "c":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x12, 0x02, 0x12, 0x0C, 0x00, 0x00],  # "c",67
-    "d":[0x00, 0x18, 0x10, 0x10, 0x10, 0x1C, 0x12, 0x12, 0x12, 0x3C, 0x00, 0x00],  # "d",68
-    "e":[0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x1E, 0x02, 0x1C, 0x00, 0x00],  # "e",69
-    "f":[0x00, 0x18, 0x24, 0x04, 0x04, 0x1E, 0x04, 0x04, 0x04, 0x1E, 0x00, 0x00],  # "f",70
-    "g":[0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x12, 0x0C, 0x02, 0x1C, 0x22, 0x1C],  # "g",71
-    "h":[0x00, 0x03, 0x02, 0x02, 0x02, 0x0E, 0x12, 0x12, 0x12, 0x37, 0x00, 0x00],  # "h",72
-    "i":[0x00, 0x04, 0x04, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00],  # "i",73
-    "j":[0x00, 0x08, 0x08, 0x00, 0x00, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07],  # "j",74
-    "k":[0x00, 0x03, 0x02, 0x02, 0x02, 0x1A, 0x0A, 0x06, 0x0A, 0x13, 0x00, 0x00],  # "k",75
-    "l":[0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00, 0x00],  # "l",76
-    "m":[0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00],  # "m",77
-    "n":[0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x37, 0x00, 0x00],  # "n",78
-    "o":[0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0x12, 0x0C, 0x00, 0x00],  # "o",79
-    "p":[0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x0E, 0x02, 0x07],  # "p",80
-    "q":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x12, 0x12, 0x12, 0x1C, 0x10, 0x38],  # "q",81
-    "r":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x06, 0x02, 0x02, 0x07, 0x00, 0x00],  # "r",82
-    "s":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x02, 0x0C, 0x10, 0x1E, 0x00, 0x00],  # "s",83
-    "t":[0x00, 0x00, 0x00, 0x04, 0x04, 0x1E, 0x04, 0x04, 0x04, 0x1C, 0x00, 0x00],  # "t",84
-    "u":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x12, 0x12, 0x12, 0x3C, 0x00, 0x00],  # "u",85
-    "v":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00],  # "v",86
-    "w":[0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x0E, 0x0A, 0x0A, 0x00, 0x00],  # "w",87
-    "x":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0A, 0x04, 0x0A, 0x1B, 0x00, 0x00],  # "x",88
-    "y":[0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x12, 0x12, 0x0C, 0x08, 0x04, 0x03],  # "y",89
-    "z":[0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x04, 0x04, 0x1E, 0x00, 0x00],  # "z",90
-    "{":[0x18, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x18, 0x00],  # "{",91
-    "|":[0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08],  # "|",92
-    "}":[0x06, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x04, 0x04, 0x04, 0x06, 0x00],  # "}",93
-    "~":[0x16, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "~",94
+    " ":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # " ",0
+    "!":b'\x00\x00\x04\x04\x04\x04\x04\x00\x00\x04\x00\x00',  # "!",1
+    "\"":b'\x14\x14\x0A\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "\"",2
+    "#":b'\x00\x00\x0A\x0A\x1F\x0A\x0A\x1F\x0A\x0A\x00\x00',  # "#",3
+    "$":b'\x00\x04\x0E\x15\x05\x06\x0C\x14\x15\x0E\x04\x00',  # "$",4
+    "%":b'\x00\x00\x12\x15\x0D\x15\x2E\x2C\x2A\x12\x00\x00',  # "%",5
+    "&":b'\x00\x00\x04\x0A\x0A\x36\x15\x15\x29\x16\x00\x00',  # "&",6
+    "'":b'\x02\x02\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "'",7
+    "(":b'\x10\x08\x08\x04\x04\x04\x04\x04\x08\x08\x10\x00',  # "(",8
+    ")":b'\x02\x04\x04\x08\x08\x08\x08\x08\x04\x04\x02\x00',  # ")",9
+    "*":b'\x00\x00\x00\x04\x15\x0E\x0E\x15\x04\x00\x00\x00',  # "*",10
+    "+":b'\x00\x00\x00\x08\x08\x3E\x08\x08\x00\x00\x00\x00',  # "+",11
+    ",":b'\x00\x00\x00\x00\x00\x00\x00\x00\x02\x02\x01\x00',  # ",",12
+    "-":b'\x00\x00\x00\x00\x00\x3F\x00\x00\x00\x00\x00\x00',  # "-",13
+    ".":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x02\x00\x00',  # ".",14
+    "/":b'\x00\x20\x10\x10\x08\x08\x04\x04\x02\x02\x01\x00',  # "/",15
+    "0":b'\x00\x00\x0E\x11\x11\x11\x11\x11\x11\x0E\x00\x00',  # "0",16
+    "1":b'\x00\x00\x04\x06\x04\x04\x04\x04\x04\x0E\x00\x00',  # "1",17
+    "2":b'\x00\x00\x0E\x11\x11\x08\x04\x02\x01\x1F\x00\x00',  # "2",18
+    "3":b'\x00\x00\x0E\x11\x10\x0C\x10\x10\x11\x0E\x00\x00',  # "3",19
+    "4":b'\x00\x00\x08\x0C\x0C\x0A\x09\x1F\x08\x1C\x00\x00',  # "4",20
+    "5":b'\x00\x00\x1F\x01\x01\x0F\x11\x10\x11\x0E\x00\x00',  # "5",21
+    "6":b'\x00\x00\x0C\x12\x01\x0D\x13\x11\x11\x0E\x00\x00',  # "6",22
+    "7":b'\x00\x00\x1E\x10\x08\x08\x04\x04\x04\x04\x00\x00',  # "7",23
+    "8":b'\x00\x00\x0E\x11\x11\x0E\x11\x11\x11\x0E\x00\x00',  # "8",24
+    "9":b'\x00\x00\x0E\x11\x11\x19\x16\x10\x09\x06\x00\x00',  # "9",25
+    ":":b'\x00\x00\x00\x00\x04\x00\x00\x00\x00\x04\x00\x00',  # ":",26
+    ";":b'\x00\x00\x00\x00\x00\x04\x00\x00\x00\x04\x04\x00',  # ";",27
+    "<":b'\x00\x00\x10\x08\x04\x02\x02\x04\x08\x10\x00\x00',  # "<",28
+    "=":b'\x00\x00\x00\x00\x3F\x00\x3F\x00\x00\x00\x00\x00',  # "=",29
+    ">":b'\x00\x00\x02\x04\x08\x10\x10\x08\x04\x02\x00\x00',  # ">",30
+    "?":b'\x00\x00\x0E\x11\x11\x08\x04\x04\x00\x04\x00\x00',  # "?",31
+    "@":b'\x00\x00\x1C\x22\x29\x2D\x2D\x1D\x22\x1C\x00\x00',  # "@",32
+    "A":b'\x00\x00\x04\x04\x0C\x0A\x0A\x1E\x12\x33\x00\x00',  # "A",33
+    "B":b'\x00\x00\x0F\x12\x12\x0E\x12\x12\x12\x0F\x00\x00',  # "B",34
+    "C":b'\x00\x00\x1E\x11\x01\x01\x01\x01\x11\x0E\x00\x00',  # "C",35
+    "D":b'\x00\x00\x0F\x12\x12\x12\x12\x12\x12\x0F\x00\x00',  # "D",36
+    "E":b'\x00\x00\x1F\x12\x0A\x0E\x0A\x02\x12\x1F\x00\x00',  # "E",37
+    "F":b'\x00\x00\x1F\x12\x0A\x0E\x0A\x02\x02\x07\x00\x00',  # "F",38
+    "G":b'\x00\x00\x1C\x12\x01\x01\x39\x11\x12\x0C\x00\x00',  # "G",39
+    "H":b'\x00\x00\x33\x12\x12\x1E\x12\x12\x12\x33\x00\x00',  # "H",40
+    "I":b'\x00\x00\x1F\x04\x04\x04\x04\x04\x04\x1F\x00\x00',  # "I",41
+    "J":b'\x00\x00\x3E\x08\x08\x08\x08\x08\x08\x08\x09\x07',  # "J",42
+    "K":b'\x00\x00\x37\x12\x0A\x06\x0A\x12\x12\x37\x00\x00',  # "K",43
+    "L":b'\x00\x00\x07\x02\x02\x02\x02\x02\x22\x3F\x00\x00',  # "L",44
+    "M":b'\x00\x00\x3B\x1B\x1B\x1B\x15\x15\x15\x35\x00\x00',  # "M",45
+    "N":b'\x00\x00\x3B\x12\x16\x16\x1A\x1A\x12\x17\x00\x00',  # "N",46
+    "O":b'\x00\x00\x0E\x11\x11\x11\x11\x11\x11\x0E\x00\x00',  # "O",47
+    "P":b'\x00\x00\x0F\x12\x12\x0E\x02\x02\x02\x07\x00\x00',  # "P",48
+    "Q":b'\x00\x00\x0E\x11\x11\x11\x11\x17\x19\x0E\x18\x00',  # "Q",49
+    "R":b'\x00\x00\x0F\x12\x12\x0E\x0A\x12\x12\x37\x00\x00',  # "R",50
+    "S":b'\x00\x00\x1E\x11\x01\x06\x08\x10\x11\x0F\x00\x00',  # "S",51
+    "T":b'\x00\x00\x1F\x15\x04\x04\x04\x04\x04\x0E\x00\x00',  # "T",52
+    "U":b'\x00\x00\x33\x12\x12\x12\x12\x12\x12\x0C\x00\x00',  # "U",53
+    "V":b'\x00\x00\x33\x12\x12\x0A\x0A\x0C\x04\x04\x00\x00',  # "V",54
+    "W":b'\x00\x00\x15\x15\x15\x15\x0E\x0A\x0A\x0A\x00\x00',  # "W",55
+    "X":b'\x00\x00\x1B\x0A\x0A\x04\x04\x0A\x0A\x1B\x00\x00',  # "X",56
+    "Y":b'\x00\x00\x1B\x0A\x0A\x0A\x04\x04\x04\x0E\x00\x00',  # "Y",57
+    "Z":b'\x00\x00\x1F\x09\x08\x04\x04\x02\x12\x1F\x00\x00',  # "Z",58
+    "[":b'\x1C\x04\x04\x04\x04\x04\x04\x04\x04\x04\x1C\x00',  # "[",59
+    "\\":b'\x00\x02\x02\x04\x04\x04\x08\x08\x08\x10\x10\x00',  # "\\",60
+    "]":b'\x0E\x08\x08\x08\x08\x08\x08\x08\x08\x08\x0E\x00',  # "]",61
+    "^":b'\x04\x0A\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "^",62
+    "_":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F',  # "_",63
+    "`":b'\x02\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "`",64
+    "a":b'\x00\x00\x00\x00\x00\x0C\x12\x1C\x12\x3C\x00\x00',  # "a",65
+    "b":b'\x00\x03\x02\x02\x02\x0E\x12\x12\x12\x0E\x00\x00',  # "b",66
+    "c":b'\x00\x00\x00\x00\x00\x1C\x12\x02\x12\x0C\x00\x00',  # "c",67
+    "d":b'\x00\x18\x10\x10\x10\x1C\x12\x12\x12\x3C\x00\x00',  # "d",68
+    "e":b'\x00\x00\x00\x00\x00\x0C\x12\x1E\x02\x1C\x00\x00',  # "e",69
+    "f":b'\x00\x18\x24\x04\x04\x1E\x04\x04\x04\x1E\x00\x00',  # "f",70
+    "g":b'\x00\x00\x00\x00\x00\x3C\x12\x0C\x02\x1C\x22\x1C',  # "g",71
+    "h":b'\x00\x03\x02\x02\x02\x0E\x12\x12\x12\x37\x00\x00',  # "h",72
+    "i":b'\x00\x04\x04\x00\x00\x06\x04\x04\x04\x0E\x00\x00',  # "i",73
+    "j":b'\x00\x08\x08\x00\x00\x0C\x08\x08\x08\x08\x08\x07',  # "j",74
+    "k":b'\x00\x03\x02\x02\x02\x1A\x0A\x06\x0A\x13\x00\x00',  # "k",75
+    "l":b'\x00\x07\x04\x04\x04\x04\x04\x04\x04\x1F\x00\x00',  # "l",76
+    "m":b'\x00\x00\x00\x00\x00\x0F\x15\x15\x15\x15\x00\x00',  # "m",77
+    "n":b'\x00\x00\x00\x00\x00\x0F\x12\x12\x12\x37\x00\x00',  # "n",78
+    "o":b'\x00\x00\x00\x00\x00\x0C\x12\x12\x12\x0C\x00\x00',  # "o",79
+    "p":b'\x00\x00\x00\x00\x00\x0F\x12\x12\x12\x0E\x02\x07',  # "p",80
+    "q":b'\x00\x00\x00\x00\x00\x1C\x12\x12\x12\x1C\x10\x38',  # "q",81
+    "r":b'\x00\x00\x00\x00\x00\x1B\x06\x02\x02\x07\x00\x00',  # "r",82
+    "s":b'\x00\x00\x00\x00\x00\x1E\x02\x0C\x10\x1E\x00\x00',  # "s",83
+    "t":b'\x00\x00\x00\x04\x04\x1E\x04\x04\x04\x1C\x00\x00',  # "t",84
+    "u":b'\x00\x00\x00\x00\x00\x1B\x12\x12\x12\x3C\x00\x00',  # "u",85
+    "v":b'\x00\x00\x00\x00\x00\x1B\x0A\x0A\x04\x04\x00\x00',  # "v",86
+    "w":b'\x00\x00\x00\x00\x00\x15\x15\x0E\x0A\x0A\x00\x00',  # "w",87
+    "x":b'\x00\x00\x00\x00\x00\x1B\x0A\x04\x0A\x1B\x00\x00',  # "x",88
+    "y":b'\x00\x00\x00\x00\x00\x33\x12\x12\x0C\x08\x04\x03',  # "y",89
+    "z":b'\x00\x00\x00\x00\x00\x1E\x08\x04\x04\x1E\x00\x00',  # "z",90
+    "{":b'\x18\x08\x08\x08\x08\x0C\x08\x08\x08\x08\x18\x00',  # "{",91
+    "|":b'\x08\x08\x08\x08\x08\x08\x08\x08\x08\x08\x08\x08',  # "|",92
+    "}":b'\x06\x04\x04\x04\x04\x08\x04\x04\x04\x04\x06\x00',  # "}",93
+    "~":b'\x16\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "~",94
 }
 
 ascii_1608 = {
-    " ":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # " ",0
-    "!":[0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00],  # "!",1
-    "\"":[0x00, 0x48, 0x6C, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "\"",2
-    "#":[0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x7F, 0x12, 0x12, 0x12, 0x7F, 0x12, 0x12, 0x12, 0x00, 0x00],  # "#",3
-    "$":[0x00, 0x00, 0x08, 0x1C, 0x2A, 0x2A, 0x0A, 0x0C, 0x18, 0x28, 0x28, 0x2A, 0x2A, 0x1C, 0x08, 0x08],  # "$",4
-    "%":[0x00, 0x00, 0x00, 0x22, 0x25, 0x15, 0x15, 0x15, 0x2A, 0x58, 0x54, 0x54, 0x54, 0x22, 0x00, 0x00],  # "%",5
-    "&":[0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0x12, 0x0A, 0x76, 0x25, 0x29, 0x11, 0x91, 0x6E, 0x00, 0x00],  # "&",6
-    "'":[0x00, 0x06, 0x06, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "'",7
-    "(":[0x00, 0x40, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x40, 0x00],  # "(",8
-    ")":[0x00, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x00],  # ")",9
-    "*":[0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x6B, 0x1C, 0x1C, 0x6B, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00],  # "*",10
-    "+":[0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00],  # "+",11
-    ",":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x04, 0x03],  # ",",12
-    "-":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "-",13
-    ".":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00],  # ".",14
-    "/":[0x00, 0x00, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00],  # "/",15
-    "0":[0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00],  # "0",16
-    "1":[0x00, 0x00, 0x00, 0x08, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x00],  # "1",17
-    "2":[0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x20, 0x20, 0x10, 0x08, 0x04, 0x42, 0x7E, 0x00, 0x00],  # "2",18
-    "3":[0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x20, 0x18, 0x20, 0x40, 0x40, 0x42, 0x22, 0x1C, 0x00, 0x00],  # "3",19
-    "4":[0x00, 0x00, 0x00, 0x20, 0x30, 0x28, 0x24, 0x24, 0x22, 0x22, 0x7E, 0x20, 0x20, 0x78, 0x00, 0x00],  # "4",20
-    "5":[0x00, 0x00, 0x00, 0x7E, 0x02, 0x02, 0x02, 0x1A, 0x26, 0x40, 0x40, 0x42, 0x22, 0x1C, 0x00, 0x00],  # "5",21
-    "6":[0x00, 0x00, 0x00, 0x38, 0x24, 0x02, 0x02, 0x1A, 0x26, 0x42, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00],  # "6",22
-    "7":[0x00, 0x00, 0x00, 0x7E, 0x22, 0x22, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00],  # "7",23
-    "8":[0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x24, 0x18, 0x24, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x00],  # "8",24
-    "9":[0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x42, 0x64, 0x58, 0x40, 0x40, 0x24, 0x1C, 0x00, 0x00],  # "9",25
-    ":":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00],  # ":",26
-    ";":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04],  # ";",27
-    "<":[0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00],  # "<",28
-    "=":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00],  # "=",29
-    ">":[0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00],  # ">",30
-    "?":[0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x46, 0x40, 0x20, 0x10, 0x10, 0x00, 0x18, 0x18, 0x00, 0x00],  # "?",31
-    "@":[0x00, 0x00, 0x00, 0x1C, 0x22, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x2D, 0x42, 0x22, 0x1C, 0x00, 0x00],  # "@",32
-    "A":[0x00, 0x00, 0x00, 0x08, 0x08, 0x18, 0x14, 0x14, 0x24, 0x3C, 0x22, 0x42, 0x42, 0xE7, 0x00, 0x00],  # "A",33
-    "B":[0x00, 0x00, 0x00, 0x1F, 0x22, 0x22, 0x22, 0x1E, 0x22, 0x42, 0x42, 0x42, 0x22, 0x1F, 0x00, 0x00],  # "B",34
-    "C":[0x00, 0x00, 0x00, 0x7C, 0x42, 0x42, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x22, 0x1C, 0x00, 0x00],  # "C",35
-    "D":[0x00, 0x00, 0x00, 0x1F, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x22, 0x1F, 0x00, 0x00],  # "D",36
-    "E":[0x00, 0x00, 0x00, 0x3F, 0x42, 0x12, 0x12, 0x1E, 0x12, 0x12, 0x02, 0x42, 0x42, 0x3F, 0x00, 0x00],  # "E",37
-    "F":[0x00, 0x00, 0x00, 0x3F, 0x42, 0x12, 0x12, 0x1E, 0x12, 0x12, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00],  # "F",38
-    "G":[0x00, 0x00, 0x00, 0x3C, 0x22, 0x22, 0x01, 0x01, 0x01, 0x71, 0x21, 0x22, 0x22, 0x1C, 0x00, 0x00],  # "G",39
-    "H":[0x00, 0x00, 0x00, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x00, 0x00],  # "H",40
-    "I":[0x00, 0x00, 0x00, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x00],  # "I",41
-    "J":[0x00, 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x11, 0x0F],  # "J",42
-    "K":[0x00, 0x00, 0x00, 0x77, 0x22, 0x12, 0x0A, 0x0E, 0x0A, 0x12, 0x12, 0x22, 0x22, 0x77, 0x00, 0x00],  # "K",43
-    "L":[0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x7F, 0x00, 0x00],  # "L",44
-    "M":[0x00, 0x00, 0x00, 0x77, 0x36, 0x36, 0x36, 0x36, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x6B, 0x00, 0x00],  # "M",45
-    "N":[0x00, 0x00, 0x00, 0xE3, 0x46, 0x46, 0x4A, 0x4A, 0x52, 0x52, 0x52, 0x62, 0x62, 0x47, 0x00, 0x00],  # "N",46
-    "O":[0x00, 0x00, 0x00, 0x1C, 0x22, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00],  # "O",47
-    "P":[0x00, 0x00, 0x00, 0x3F, 0x42, 0x42, 0x42, 0x42, 0x3E, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00],  # "P",48
-    "Q":[0x00, 0x00, 0x00, 0x1C, 0x22, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4D, 0x53, 0x32, 0x1C, 0x60, 0x00],  # "Q",49
-    "R":[0x00, 0x00, 0x00, 0x3F, 0x42, 0x42, 0x42, 0x3E, 0x12, 0x12, 0x22, 0x22, 0x42, 0xC7, 0x00, 0x00],  # "R",50
-    "S":[0x00, 0x00, 0x00, 0x7C, 0x42, 0x42, 0x02, 0x04, 0x18, 0x20, 0x40, 0x42, 0x42, 0x3E, 0x00, 0x00],  # "S",51
-    "T":[0x00, 0x00, 0x00, 0x7F, 0x49, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00],  # "T",52
-    "U":[0x00, 0x00, 0x00, 0xE7, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x00],  # "U",53
-    "V":[0x00, 0x00, 0x00, 0xE7, 0x42, 0x42, 0x22, 0x24, 0x24, 0x14, 0x14, 0x18, 0x08, 0x08, 0x00, 0x00],  # "V",54
-    "W":[0x00, 0x00, 0x00, 0x6B, 0x49, 0x49, 0x49, 0x49, 0x55, 0x55, 0x36, 0x22, 0x22, 0x22, 0x00, 0x00],  # "W",55
-    "X":[0x00, 0x00, 0x00, 0xE7, 0x42, 0x24, 0x24, 0x18, 0x18, 0x18, 0x24, 0x24, 0x42, 0xE7, 0x00, 0x00],  # "X",56
-    "Y":[0x00, 0x00, 0x00, 0x77, 0x22, 0x22, 0x14, 0x14, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00],  # "Y",57
-    "Z":[0x00, 0x00, 0x00, 0x7E, 0x21, 0x20, 0x10, 0x10, 0x08, 0x04, 0x04, 0x42, 0x42, 0x3F, 0x00, 0x00],  # "Z",58
-    "[":[0x00, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00],  # "[",59
-    "\\":[0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x40, 0x40],  # "\\",60
-    "]":[0x00, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x00],  # "]",61
-    "^":[0x00, 0x38, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "^",62
-    "_":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF],  # "_",63
-    "`":[0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "`",64
-    "a":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x78, 0x44, 0x42, 0x42, 0xFC, 0x00, 0x00],  # "a",65
-    "b":[0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x1A, 0x26, 0x42, 0x42, 0x42, 0x26, 0x1A, 0x00, 0x00],  # "b",66
-    "c":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x02, 0x02, 0x02, 0x44, 0x38, 0x00, 0x00],  # "c",67
-    "d":[0x00, 0x00, 0x00, 0x60, 0x40, 0x40, 0x40, 0x78, 0x44, 0x42, 0x42, 0x42, 0x64, 0xD8, 0x00, 0x00],  # "d",68
-    "e":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x7E, 0x02, 0x02, 0x42, 0x3C, 0x00, 0x00],  # "e",69
-    "f":[0x00, 0x00, 0x00, 0xF0, 0x88, 0x08, 0x08, 0x7E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x00],  # "f",70
-    "g":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x22, 0x22, 0x1C, 0x02, 0x3C, 0x42, 0x42, 0x3C],  # "g",71
-    "h":[0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x3A, 0x46, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x00, 0x00],  # "h",72
-    "i":[0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x00],  # "i",73
-    "j":[0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x1E],  # "j",74
-    "k":[0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x72, 0x12, 0x0A, 0x16, 0x12, 0x22, 0x77, 0x00, 0x00],  # "k",75
-    "l":[0x00, 0x00, 0x00, 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x00],  # "l",76
-    "m":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x92, 0x92, 0x92, 0x92, 0x92, 0xB7, 0x00, 0x00],  # "m",77
-    "n":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x46, 0x42, 0x42, 0x42, 0x42, 0xE7, 0x00, 0x00],  # "n",78
-    "o":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3C, 0x00, 0x00],  # "o",79
-    "p":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x26, 0x42, 0x42, 0x42, 0x22, 0x1E, 0x02, 0x07],  # "p",80
-    "q":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x44, 0x42, 0x42, 0x42, 0x44, 0x78, 0x40, 0xE0],  # "q",81
-    "r":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x4C, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00, 0x00],  # "r",82
-    "s":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x42, 0x02, 0x3C, 0x40, 0x42, 0x3E, 0x00, 0x00],  # "s",83
-    "t":[0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x30, 0x00, 0x00],  # "t",84
-    "u":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x42, 0x42, 0x42, 0x42, 0x62, 0xDC, 0x00, 0x00],  # "u",85
-    "v":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x42, 0x24, 0x24, 0x14, 0x08, 0x08, 0x00, 0x00],  # "v",86
-    "w":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x49, 0x49, 0x55, 0x55, 0x22, 0x22, 0x00, 0x00],  # "w",87
-    "x":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x24, 0x18, 0x18, 0x18, 0x24, 0x6E, 0x00, 0x00],  # "x",88
-    "y":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x42, 0x24, 0x24, 0x14, 0x18, 0x08, 0x08, 0x07],  # "y",89
-    "z":[0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x22, 0x10, 0x08, 0x08, 0x44, 0x7E, 0x00, 0x00],  # "z",90
-    "{":[0x00, 0xC0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xC0, 0x00],  # "{",91
-    "|":[0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10],  # "|",92
-    "}":[0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00],  # "}",93
-    "~":[0x0C, 0x32, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00],  # "~",94
+    " ":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # " ",0
+    "!":b'\x00\x00\x00\x08\x08\x08\x08\x08\x08\x08\x00\x00\x18\x18\x00\x00',  # "!",1
+    "\"":b'\x00\x48\x6C\x24\x12\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "\"",2
+    "#":b'\x00\x00\x00\x24\x24\x24\x7F\x12\x12\x12\x7F\x12\x12\x12\x00\x00',  # "#",3
+    "$":b'\x00\x00\x08\x1C\x2A\x2A\x0A\x0C\x18\x28\x28\x2A\x2A\x1C\x08\x08',  # "$",4
+    "%":b'\x00\x00\x00\x22\x25\x15\x15\x15\x2A\x58\x54\x54\x54\x22\x00\x00',  # "%",5
+    "&":b'\x00\x00\x00\x0C\x12\x12\x12\x0A\x76\x25\x29\x11\x91\x6E\x00\x00',  # "&",6
+    "'":b'\x00\x06\x06\x04\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "'",7
+    "(":b'\x00\x40\x20\x10\x10\x08\x08\x08\x08\x08\x08\x10\x10\x20\x40\x00',  # "(",8
+    ")":b'\x00\x02\x04\x08\x08\x10\x10\x10\x10\x10\x10\x08\x08\x04\x02\x00',  # ")",9
+    "*":b'\x00\x00\x00\x00\x08\x08\x6B\x1C\x1C\x6B\x08\x08\x00\x00\x00\x00',  # "*",10
+    "+":b'\x00\x00\x00\x00\x08\x08\x08\x08\x7F\x08\x08\x08\x08\x00\x00\x00',  # "+",11
+    ",":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x06\x06\x04\x03',  # ",",12
+    "-":b'\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x00\x00\x00\x00\x00\x00\x00',  # "-",13
+    ".":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x06\x06\x00\x00',  # ".",14
+    "/":b'\x00\x00\x80\x40\x40\x20\x20\x10\x10\x08\x08\x04\x04\x02\x02\x00',  # "/",15
+    "0":b'\x00\x00\x00\x18\x24\x42\x42\x42\x42\x42\x42\x42\x24\x18\x00\x00',  # "0",16
+    "1":b'\x00\x00\x00\x08\x0E\x08\x08\x08\x08\x08\x08\x08\x08\x3E\x00\x00',  # "1",17
+    "2":b'\x00\x00\x00\x3C\x42\x42\x42\x20\x20\x10\x08\x04\x42\x7E\x00\x00',  # "2",18
+    "3":b'\x00\x00\x00\x3C\x42\x42\x20\x18\x20\x40\x40\x42\x22\x1C\x00\x00',  # "3",19
+    "4":b'\x00\x00\x00\x20\x30\x28\x24\x24\x22\x22\x7E\x20\x20\x78\x00\x00',  # "4",20
+    "5":b'\x00\x00\x00\x7E\x02\x02\x02\x1A\x26\x40\x40\x42\x22\x1C\x00\x00',  # "5",21
+    "6":b'\x00\x00\x00\x38\x24\x02\x02\x1A\x26\x42\x42\x42\x24\x18\x00\x00',  # "6",22
+    "7":b'\x00\x00\x00\x7E\x22\x22\x10\x10\x08\x08\x08\x08\x08\x08\x00\x00',  # "7",23
+    "8":b'\x00\x00\x00\x3C\x42\x42\x42\x24\x18\x24\x42\x42\x42\x3C\x00\x00',  # "8",24
+    "9":b'\x00\x00\x00\x18\x24\x42\x42\x42\x64\x58\x40\x40\x24\x1C\x00\x00',  # "9",25
+    ":":b'\x00\x00\x00\x00\x00\x00\x18\x18\x00\x00\x00\x00\x18\x18\x00\x00',  # ":",26
+    ";":b'\x00\x00\x00\x00\x00\x00\x00\x08\x00\x00\x00\x00\x00\x08\x08\x04',  # ";",27
+    "<":b'\x00\x00\x00\x40\x20\x10\x08\x04\x02\x04\x08\x10\x20\x40\x00\x00',  # "<",28
+    "=":b'\x00\x00\x00\x00\x00\x00\x7F\x00\x00\x00\x7F\x00\x00\x00\x00\x00',  # "=",29
+    ">":b'\x00\x00\x00\x02\x04\x08\x10\x20\x40\x20\x10\x08\x04\x02\x00\x00',  # ">",30
+    "?":b'\x00\x00\x00\x3C\x42\x42\x46\x40\x20\x10\x10\x00\x18\x18\x00\x00',  # "?",31
+    "@":b'\x00\x00\x00\x1C\x22\x5A\x55\x55\x55\x55\x2D\x42\x22\x1C\x00\x00',  # "@",32
+    "A":b'\x00\x00\x00\x08\x08\x18\x14\x14\x24\x3C\x22\x42\x42\xE7\x00\x00',  # "A",33
+    "B":b'\x00\x00\x00\x1F\x22\x22\x22\x1E\x22\x42\x42\x42\x22\x1F\x00\x00',  # "B",34
+    "C":b'\x00\x00\x00\x7C\x42\x42\x01\x01\x01\x01\x01\x42\x22\x1C\x00\x00',  # "C",35
+    "D":b'\x00\x00\x00\x1F\x22\x42\x42\x42\x42\x42\x42\x42\x22\x1F\x00\x00',  # "D",36
+    "E":b'\x00\x00\x00\x3F\x42\x12\x12\x1E\x12\x12\x02\x42\x42\x3F\x00\x00',  # "E",37
+    "F":b'\x00\x00\x00\x3F\x42\x12\x12\x1E\x12\x12\x02\x02\x02\x07\x00\x00',  # "F",38
+    "G":b'\x00\x00\x00\x3C\x22\x22\x01\x01\x01\x71\x21\x22\x22\x1C\x00\x00',  # "G",39
+    "H":b'\x00\x00\x00\xE7\x42\x42\x42\x42\x7E\x42\x42\x42\x42\xE7\x00\x00',  # "H",40
+    "I":b'\x00\x00\x00\x3E\x08\x08\x08\x08\x08\x08\x08\x08\x08\x3E\x00\x00',  # "I",41
+    "J":b'\x00\x00\x00\x7C\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x11\x0F',  # "J",42
+    "K":b'\x00\x00\x00\x77\x22\x12\x0A\x0E\x0A\x12\x12\x22\x22\x77\x00\x00',  # "K",43
+    "L":b'\x00\x00\x00\x07\x02\x02\x02\x02\x02\x02\x02\x02\x42\x7F\x00\x00',  # "L",44
+    "M":b'\x00\x00\x00\x77\x36\x36\x36\x36\x2A\x2A\x2A\x2A\x2A\x6B\x00\x00',  # "M",45
+    "N":b'\x00\x00\x00\xE3\x46\x46\x4A\x4A\x52\x52\x52\x62\x62\x47\x00\x00',  # "N",46
+    "O":b'\x00\x00\x00\x1C\x22\x41\x41\x41\x41\x41\x41\x41\x22\x1C\x00\x00',  # "O",47
+    "P":b'\x00\x00\x00\x3F\x42\x42\x42\x42\x3E\x02\x02\x02\x02\x07\x00\x00',  # "P",48
+    "Q":b'\x00\x00\x00\x1C\x22\x41\x41\x41\x41\x41\x4D\x53\x32\x1C\x60\x00',  # "Q",49
+    "R":b'\x00\x00\x00\x3F\x42\x42\x42\x3E\x12\x12\x22\x22\x42\xC7\x00\x00',  # "R",50
+    "S":b'\x00\x00\x00\x7C\x42\x42\x02\x04\x18\x20\x40\x42\x42\x3E\x00\x00',  # "S",51
+    "T":b'\x00\x00\x00\x7F\x49\x08\x08\x08\x08\x08\x08\x08\x08\x1C\x00\x00',  # "T",52
+    "U":b'\x00\x00\x00\xE7\x42\x42\x42\x42\x42\x42\x42\x42\x42\x3C\x00\x00',  # "U",53
+    "V":b'\x00\x00\x00\xE7\x42\x42\x22\x24\x24\x14\x14\x18\x08\x08\x00\x00',  # "V",54
+    "W":b'\x00\x00\x00\x6B\x49\x49\x49\x49\x55\x55\x36\x22\x22\x22\x00\x00',  # "W",55
+    "X":b'\x00\x00\x00\xE7\x42\x24\x24\x18\x18\x18\x24\x24\x42\xE7\x00\x00',  # "X",56
+    "Y":b'\x00\x00\x00\x77\x22\x22\x14\x14\x08\x08\x08\x08\x08\x1C\x00\x00',  # "Y",57
+    "Z":b'\x00\x00\x00\x7E\x21\x20\x10\x10\x08\x04\x04\x42\x42\x3F\x00\x00',  # "Z",58
+    "[":b'\x00\x78\x08\x08\x08\x08\x08\x08\x08\x08\x08\x08\x08\x08\x78\x00',  # "[",59
+    "\\":b'\x00\x00\x02\x02\x04\x04\x08\x08\x08\x10\x10\x20\x20\x20\x40\x40',  # "\\",60
+    "]":b'\x00\x1E\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x1E\x00',  # "]",61
+    "^":b'\x00\x38\x44\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "^",62
+    "_":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF',  # "_",63
+    "`":b'\x00\x06\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "`",64
+    "a":b'\x00\x00\x00\x00\x00\x00\x00\x3C\x42\x78\x44\x42\x42\xFC\x00\x00',  # "a",65
+    "b":b'\x00\x00\x00\x03\x02\x02\x02\x1A\x26\x42\x42\x42\x26\x1A\x00\x00',  # "b",66
+    "c":b'\x00\x00\x00\x00\x00\x00\x00\x38\x44\x02\x02\x02\x44\x38\x00\x00',  # "c",67
+    "d":b'\x00\x00\x00\x60\x40\x40\x40\x78\x44\x42\x42\x42\x64\xD8\x00\x00',  # "d",68
+    "e":b'\x00\x00\x00\x00\x00\x00\x00\x3C\x42\x7E\x02\x02\x42\x3C\x00\x00',  # "e",69
+    "f":b'\x00\x00\x00\xF0\x88\x08\x08\x7E\x08\x08\x08\x08\x08\x3E\x00\x00',  # "f",70
+    "g":b'\x00\x00\x00\x00\x00\x00\x00\x7C\x22\x22\x1C\x02\x3C\x42\x42\x3C',  # "g",71
+    "h":b'\x00\x00\x00\x03\x02\x02\x02\x3A\x46\x42\x42\x42\x42\xE7\x00\x00',  # "h",72
+    "i":b'\x00\x00\x00\x0C\x0C\x00\x00\x0E\x08\x08\x08\x08\x08\x3E\x00\x00',  # "i",73
+    "j":b'\x00\x00\x00\x30\x30\x00\x00\x38\x20\x20\x20\x20\x20\x20\x22\x1E',  # "j",74
+    "k":b'\x00\x00\x00\x03\x02\x02\x02\x72\x12\x0A\x16\x12\x22\x77\x00\x00',  # "k",75
+    "l":b'\x00\x00\x00\x0E\x08\x08\x08\x08\x08\x08\x08\x08\x08\x3E\x00\x00',  # "l",76
+    "m":b'\x00\x00\x00\x00\x00\x00\x00\x7F\x92\x92\x92\x92\x92\xB7\x00\x00',  # "m",77
+    "n":b'\x00\x00\x00\x00\x00\x00\x00\x3B\x46\x42\x42\x42\x42\xE7\x00\x00',  # "n",78
+    "o":b'\x00\x00\x00\x00\x00\x00\x00\x3C\x42\x42\x42\x42\x42\x3C\x00\x00',  # "o",79
+    "p":b'\x00\x00\x00\x00\x00\x00\x00\x1B\x26\x42\x42\x42\x22\x1E\x02\x07',  # "p",80
+    "q":b'\x00\x00\x00\x00\x00\x00\x00\x78\x44\x42\x42\x42\x44\x78\x40\xE0',  # "q",81
+    "r":b'\x00\x00\x00\x00\x00\x00\x00\x77\x4C\x04\x04\x04\x04\x1F\x00\x00',  # "r",82
+    "s":b'\x00\x00\x00\x00\x00\x00\x00\x7C\x42\x02\x3C\x40\x42\x3E\x00\x00',  # "s",83
+    "t":b'\x00\x00\x00\x00\x00\x08\x08\x3E\x08\x08\x08\x08\x08\x30\x00\x00',  # "t",84
+    "u":b'\x00\x00\x00\x00\x00\x00\x00\x63\x42\x42\x42\x42\x62\xDC\x00\x00',  # "u",85
+    "v":b'\x00\x00\x00\x00\x00\x00\x00\xE7\x42\x24\x24\x14\x08\x08\x00\x00',  # "v",86
+    "w":b'\x00\x00\x00\x00\x00\x00\x00\xEB\x49\x49\x55\x55\x22\x22\x00\x00',  # "w",87
+    "x":b'\x00\x00\x00\x00\x00\x00\x00\x76\x24\x18\x18\x18\x24\x6E\x00\x00',  # "x",88
+    "y":b'\x00\x00\x00\x00\x00\x00\x00\xE7\x42\x24\x24\x14\x18\x08\x08\x07',  # "y",89
+    "z":b'\x00\x00\x00\x00\x00\x00\x00\x7E\x22\x10\x08\x08\x44\x7E\x00\x00',  # "z",90
+    "{":b'\x00\xC0\x20\x20\x20\x20\x20\x10\x20\x20\x20\x20\x20\x20\xC0\x00',  # "{",91
+    "|":b'\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10\x10',  # "|",92
+    "}":b'\x00\x06\x08\x08\x08\x08\x08\x10\x08\x08\x08\x08\x08\x08\x06\x00',  # "}",93
+    "~":b'\x0C\x32\xC2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00',  # "~",94
 }
 
 ascii_2412={
-    " ":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # " ",0 
-    "!":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "!",1 
-    "\"":[0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x06,0x30,0x03,0x98,0x01,0x88,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # """,2 
-    "#":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0xFE,0x07,0xFE,0x07,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0xFE,0x07,0xFE,0x07,0x04,0x01,0x04,0x01,0x04,0x01,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "#",3 
-    "$":[0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0xF0,0x01,0x58,0x03,0x4C,0x03,0xCC,0x03,0x4C,0x00,0x58,0x00,0x70,0x00,0xE0,0x00,0xC0,0x01,0xC0,0x01,0x40,0x03,0x4C,0x03,0x5C,0x03,0x4C,0x03,0x48,0x01,0xF0,0x00,0x40,0x00,0x40,0x00,0x00,0x00], # "$",4 
-    "%":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x01,0x0A,0x01,0x91,0x00,0x91,0x00,0x91,0x00,0x51,0x00,0x51,0x00,0x3A,0x00,0xAE,0x03,0xA0,0x02,0x50,0x04,0x50,0x04,0x48,0x04,0x48,0x04,0x48,0x04,0x84,0x02,0x84,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "%",5 
-    "&":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x6C,0x00,0x6C,0x00,0x6C,0x00,0x6C,0x00,0x6C,0x00,0x2C,0x00,0x98,0x07,0x1C,0x01,0x1A,0x01,0x33,0x01,0x33,0x01,0x63,0x01,0xE3,0x00,0xC3,0x08,0xC6,0x09,0x3C,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "&",6 
-    "'":[0x00,0x00,0x00,0x00,0x0C,0x00,0x1C,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "'",7 
-    "(":[0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x00,0x01,0x80,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x00], # "(",8 
-    ")":[0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x00,0x00], # ")",9 
-    "*":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC0,0x00,0x40,0x00,0x46,0x0C,0x4E,0x0F,0xD0,0x01,0xF0,0x01,0x5E,0x0F,0x46,0x0C,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "*",10 
-    "+":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xFE,0x0F,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "+",11 
-    ",":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x1C,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x04,0x00], # ",",12 
-    "-":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "-",13 
-    ".":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # ".",14 
-    "/":[0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x00,0x00], # "/",15 
-    "0":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x0C,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x0C,0x03,0x0C,0x03,0x98,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "0",16 
-    "1":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x7C,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "1",17 
-    "2":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x84,0x01,0x02,0x03,0x06,0x03,0x06,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0xC0,0x00,0x60,0x00,0x20,0x00,0x10,0x00,0x08,0x02,0x04,0x02,0x06,0x02,0xFE,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "2",18 
-    "3":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xC6,0x00,0x86,0x01,0x86,0x01,0x80,0x01,0x80,0x01,0xC0,0x00,0x70,0x00,0x80,0x01,0x00,0x01,0x00,0x03,0x00,0x03,0x06,0x03,0x06,0x03,0x86,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "3",19 
-    "4":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x80,0x01,0xC0,0x01,0xA0,0x01,0xA0,0x01,0x90,0x01,0x88,0x01,0x88,0x01,0x84,0x01,0x82,0x01,0xFE,0x0F,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "4",20 
-    "5":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0xF4,0x00,0x8C,0x01,0x04,0x03,0x00,0x03,0x00,0x03,0x06,0x03,0x06,0x03,0x82,0x01,0x84,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "5",21 
-    "6":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x01,0x18,0x03,0x0C,0x03,0x0C,0x00,0x04,0x00,0x06,0x00,0xE6,0x01,0x16,0x03,0x0E,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x04,0x06,0x0C,0x02,0x18,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "6",22 
-    "7":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x07,0x0C,0x06,0x04,0x02,0x04,0x01,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "7",23 
-    "8":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x0C,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x0C,0x02,0x1C,0x03,0xF0,0x00,0xC8,0x01,0x0C,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x0C,0x03,0xF0,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "8",24 
-    "9":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x0C,0x01,0x0C,0x03,0x06,0x02,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x07,0x8C,0x06,0x78,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x0C,0x01,0x8C,0x01,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "9",25 
-    ":":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # ":",26 
-    ";":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x20,0x00,0x20,0x00], # ";",27 
-    "<":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x00,0x01,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00], # "<",28 
-    "=":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "=",29 
-    ">":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x02,0x00,0x01,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # ">",30 
-    "?":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x18,0x06,0x04,0x0C,0x04,0x0C,0x0C,0x0C,0x0C,0x0C,0x00,0x07,0x80,0x01,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "?",31 
-    "@":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x18,0x03,0x0C,0x02,0xCC,0x05,0x64,0x05,0x66,0x05,0xA6,0x05,0xB6,0x04,0xB6,0x04,0xB6,0x04,0xB6,0x04,0xB6,0x02,0xE4,0x01,0x0C,0x04,0x0C,0x02,0x18,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "@",32 
-    "A":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x50,0x00,0xD0,0x00,0x90,0x00,0x90,0x00,0x88,0x00,0x88,0x01,0x08,0x01,0xF8,0x01,0x04,0x03,0x04,0x03,0x04,0x02,0x02,0x02,0x02,0x06,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00], # "A",33 
-    "B":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x8C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x8C,0x01,0xFC,0x00,0x0C,0x03,0x0C,0x02,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x03,0xFE,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "B",34 
-    "C":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x18,0x03,0x0C,0x06,0x0C,0x04,0x04,0x04,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x04,0x0C,0x04,0x0C,0x02,0x18,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "C",35 
-    "D":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0x8C,0x01,0x0C,0x03,0x0C,0x03,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x03,0x0C,0x03,0x8C,0x01,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "D",36 
-    "E":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x06,0x03,0x06,0x04,0x06,0x04,0x06,0x00,0x86,0x00,0x86,0x00,0xFE,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x06,0x00,0x06,0x04,0x06,0x04,0x06,0x02,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "E",37 
-    "F":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x03,0x06,0x03,0x06,0x04,0x06,0x04,0x06,0x00,0x86,0x00,0x86,0x00,0xFE,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "F",38 
-    "G":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x18,0x01,0x0C,0x02,0x0C,0x02,0x04,0x02,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0xC6,0x0F,0x06,0x03,0x06,0x03,0x0C,0x03,0x0C,0x03,0x18,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "G",39 
-    "H":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0xFE,0x07,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00], # "H",40 
-    "I":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "I",41 
-    "J":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x07,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC6,0x00,0x66,0x00,0x3C,0x00], # "J",42 
-    "K":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x03,0x86,0x01,0xC6,0x00,0x46,0x00,0x26,0x00,0x16,0x00,0x36,0x00,0x2E,0x00,0x6E,0x00,0x46,0x00,0xC6,0x00,0x86,0x00,0x86,0x01,0x06,0x01,0x06,0x03,0x8F,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "K",43 
-    "L":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x04,0x06,0x04,0x06,0x02,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "L",44 
-    "M":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x86,0x03,0x86,0x03,0x8E,0x03,0x8E,0x03,0x4E,0x03,0x4E,0x03,0x4A,0x03,0x5A,0x03,0x5A,0x03,0x3A,0x03,0x32,0x03,0x32,0x03,0x32,0x03,0x12,0x03,0x87,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "M",45 
-    "N":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x0F,0x0C,0x02,0x1C,0x02,0x1C,0x02,0x34,0x02,0x34,0x02,0x64,0x02,0x64,0x02,0x44,0x02,0xC4,0x02,0x84,0x02,0x84,0x03,0x84,0x03,0x04,0x03,0x04,0x03,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00], # "N",46 
-    "O":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x0C,0x02,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x0C,0x02,0x0C,0x03,0x98,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "O",47 
-    "P":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x06,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x86,0x03,0xFE,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "P",48 
-    "Q":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x0C,0x02,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x76,0x06,0x4C,0x02,0xCC,0x03,0x98,0x01,0xF0,0x00,0x80,0x07,0x00,0x03,0x00,0x00], # "Q",49 
-    "R":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0x06,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x03,0xFE,0x00,0x46,0x00,0xC6,0x00,0x86,0x00,0x86,0x01,0x06,0x03,0x06,0x03,0x06,0x06,0x0F,0x0E,0x00,0x00,0x00,0x00,0x00,0x00], # "R",50 
-    "S":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x02,0x0C,0x03,0x06,0x02,0x06,0x02,0x06,0x00,0x0E,0x00,0x3C,0x00,0xF8,0x00,0xE0,0x03,0x80,0x03,0x00,0x07,0x02,0x06,0x02,0x06,0x06,0x06,0x0C,0x03,0xF0,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "S",51 
-    "T":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x62,0x04,0x61,0x08,0x61,0x08,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "T",52 
-    "U":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x07,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x0C,0x02,0x18,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "U",53 
-    "V":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x07,0x06,0x02,0x04,0x01,0x04,0x01,0x0C,0x01,0x0C,0x01,0x88,0x00,0x88,0x00,0x98,0x00,0x98,0x00,0x50,0x00,0x50,0x00,0x70,0x00,0x30,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "V",54 
-    "W":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x0E,0x62,0x04,0x42,0x04,0x46,0x04,0x46,0x04,0x64,0x02,0x64,0x02,0xE4,0x02,0xE4,0x02,0x9C,0x02,0x9C,0x01,0x98,0x01,0x98,0x01,0x88,0x01,0x88,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "W",55 
-    "X":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x07,0x0C,0x01,0x08,0x01,0x18,0x01,0x90,0x00,0xB0,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0xD0,0x00,0x90,0x00,0x88,0x01,0x08,0x01,0x04,0x03,0x8E,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "X",56 
-    "Y":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x06,0x04,0x04,0x02,0x0C,0x02,0x08,0x01,0x18,0x01,0xB8,0x00,0xB0,0x00,0x70,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "Y",57 
-    "Z":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x07,0x0C,0x02,0x06,0x03,0x02,0x01,0x80,0x01,0x80,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x18,0x00,0x08,0x04,0x0C,0x04,0x04,0x02,0xFE,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "Z",58 
-    "[":[0x00,0x00,0x00,0x00,0xE0,0x03,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xE0,0x03,0x00,0x00], # "[",59 
-    "\\":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0xC0,0x00,0x80,0x00,0x80,0x00,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04], # "\",60 
-    "]":[0x00,0x00,0x00,0x00,0x7C,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x7C,0x00,0x00,0x00], # "]",61 
-    "^":[0x00,0x00,0x60,0x00,0x90,0x00,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "^",62 
-    "_":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x0F], # "_",63 
-    "`":[0x00,0x00,0x00,0x00,0x18,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "`",64 
-    "a":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x0C,0x03,0x0C,0x03,0x00,0x03,0xE0,0x03,0x1C,0x03,0x0E,0x03,0x06,0x03,0x06,0x03,0x8E,0x0B,0x7C,0x0E,0x00,0x00,0x00,0x00,0x00,0x00], # "a",65 
-    "b":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0E,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xCC,0x01,0x3C,0x03,0x1C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x02,0x1C,0x03,0xE4,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "b",66 
-    "c":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x8C,0x01,0x8C,0x01,0x86,0x01,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x02,0x0C,0x02,0x0C,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "c",67 
-    "d":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x78,0x03,0x8C,0x03,0x0C,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x04,0x03,0x8C,0x07,0x78,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "d",68 
-    "e":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x01,0x18,0x03,0x08,0x02,0x0C,0x06,0x0C,0x06,0xFC,0x07,0x0C,0x00,0x0C,0x00,0x18,0x04,0x18,0x02,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "e",69 
-    "f":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0x60,0x06,0x30,0x06,0x30,0x00,0x30,0x00,0xFE,0x01,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "f",70 
-    "g":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0xD8,0x06,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x98,0x01,0xF8,0x00,0x0C,0x00,0xFC,0x00,0xCC,0x03,0x06,0x03,0x06,0x03,0x8E,0x03,0xF8,0x00], # "g",71 
-    "h":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0E,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xEC,0x01,0x1C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x9E,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "h",72 
-    "i":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x7C,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "i",73 
-    "j":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xCC,0x00,0x7C,0x00], # "j",74 
-    "k":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0E,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x8C,0x03,0x8C,0x00,0x8C,0x00,0x4C,0x00,0x6C,0x00,0x5C,0x00,0x8C,0x00,0x8C,0x01,0x0C,0x01,0x0C,0x03,0x9E,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "k",75 
-    "l":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x7C,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00], # "l",76 
-    "m":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x07,0xEE,0x06,0x66,0x06,0x66,0x06,0x66,0x06,0x66,0x06,0x66,0x06,0x66,0x06,0x66,0x06,0x66,0x06,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00], # "m",77 
-    "n":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEE,0x01,0x1C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x9E,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "n",78 
-    "o":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x98,0x01,0x0C,0x03,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x0C,0x03,0x0C,0x03,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "o",79 
-    "p":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEE,0x01,0x1C,0x03,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x0C,0x03,0x1C,0x03,0xEC,0x01,0x0C,0x00,0x0C,0x00,0x3E,0x00], # "p",80 
-    "q":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x02,0x8C,0x03,0x0C,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x04,0x03,0x8C,0x03,0x78,0x03,0x00,0x03,0x00,0x03,0xC0,0x07], # "q",81 
-    "r":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x03,0x58,0x06,0x38,0x06,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "r",82 
-    "s":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x1C,0x03,0x0C,0x02,0x0C,0x02,0x38,0x00,0xF0,0x00,0xC0,0x03,0x04,0x03,0x04,0x03,0x8C,0x03,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "s",83 
-    "t":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0xFE,0x01,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x02,0x30,0x02,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "t",84 
-    "u":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x02,0x8E,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x9C,0x07,0x78,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "u",85 
-    "v":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x07,0x0C,0x02,0x08,0x01,0x08,0x01,0x18,0x01,0x90,0x00,0xB0,0x00,0xB0,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "v",86 
-    "w":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0x0E,0x62,0x04,0x46,0x04,0x64,0x02,0x64,0x02,0xEC,0x02,0x9C,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "w",87 
-    "x":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0x07,0x18,0x01,0x10,0x01,0xB0,0x00,0x60,0x00,0x60,0x00,0xE0,0x00,0x90,0x00,0x08,0x01,0x08,0x03,0x9E,0x07,0x00,0x00,0x00,0x00,0x00,0x00], # "x",88 
-    "y":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x07,0x08,0x01,0x08,0x01,0x08,0x01,0x90,0x00,0x90,0x00,0xB0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x24,0x00,0x1C,0x00], # "y",89 
-    "z":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x01,0x84,0x01,0xC4,0x00,0x44,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x18,0x02,0x08,0x02,0x0C,0x03,0xFC,0x01,0x00,0x00,0x00,0x00,0x00,0x00], # "z",90 
-    "{":[0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x03,0x00,0x00], # "{",91 
-    "|":[0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00], # "|",92 
-    "}":[0x00,0x00,0x00,0x00,0x0C,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x0C,0x00,0x00,0x00], # "}",93 
-    "~":[0x00,0x00,0x1C,0x00,0x22,0x04,0xC2,0x04,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "~",94 
+    " ":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # " ",0 
+    "!":b'\x00\x00\x00\x00\x00\x00\x00\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x40\x00\x20\x00\x20\x00\x20\x00\x00\x00\x00\x00\x00\x00\x60\x00\x60\x00\x60\x00\x00\x00\x00\x00\x00\x00', # "!",1 
+    "\"":b'\x00\x00\x00\x00\x60\x06\x60\x06\x30\x03\x98\x01\x88\x00\x44\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # """,2 
+    "#":b'\x00\x00\x00\x00\x00\x00\x00\x00\x10\x02\x10\x02\x10\x02\x10\x02\xFE\x07\xFE\x07\x08\x02\x08\x01\x08\x01\x08\x01\x08\x01\xFE\x07\xFE\x07\x04\x01\x04\x01\x04\x01\x04\x01\x00\x00\x00\x00\x00\x00', # "#",3 
+    "$":b'\x00\x00\x00\x00\x00\x00\x40\x00\x40\x00\xF0\x01\x58\x03\x4C\x03\xCC\x03\x4C\x00\x58\x00\x70\x00\xE0\x00\xC0\x01\xC0\x01\x40\x03\x4C\x03\x5C\x03\x4C\x03\x48\x01\xF0\x00\x40\x00\x40\x00\x00\x00', # "$",4 
+    "%":b'\x00\x00\x00\x00\x00\x00\x00\x00\x0E\x01\x0A\x01\x91\x00\x91\x00\x91\x00\x51\x00\x51\x00\x3A\x00\xAE\x03\xA0\x02\x50\x04\x50\x04\x48\x04\x48\x04\x48\x04\x84\x02\x84\x03\x00\x00\x00\x00\x00\x00', # "%",5 
+    "&":b'\x00\x00\x00\x00\x00\x00\x00\x00\x38\x00\x6C\x00\x6C\x00\x6C\x00\x6C\x00\x6C\x00\x2C\x00\x98\x07\x1C\x01\x1A\x01\x33\x01\x33\x01\x63\x01\xE3\x00\xC3\x08\xC6\x09\x3C\x07\x00\x00\x00\x00\x00\x00', # "&",6 
+    "'":b'\x00\x00\x00\x00\x0C\x00\x1C\x00\x10\x00\x10\x00\x08\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "'",7 
+    "(":b'\x00\x00\x00\x00\x00\x04\x00\x02\x00\x01\x80\x00\x80\x00\x40\x00\x40\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x40\x00\x40\x00\x80\x00\x80\x00\x00\x01\x00\x02\x00\x04\x00\x00', # "(",8 
+    ")":b'\x00\x00\x00\x00\x02\x00\x04\x00\x08\x00\x10\x00\x10\x00\x20\x00\x20\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x20\x00\x20\x00\x10\x00\x10\x00\x08\x00\x04\x00\x02\x00\x00\x00', # ")",9 
+    "*":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x40\x00\xC0\x00\x40\x00\x46\x0C\x4E\x0F\xD0\x01\xF0\x01\x5E\x0F\x46\x0C\x40\x00\x40\x00\x40\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "*",10 
+    "+":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\xFE\x0F\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "+",11 
+    ",":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0C\x00\x1C\x00\x10\x00\x10\x00\x08\x00\x04\x00', # ",",12 
+    "-":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "-",13 
+    ".":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1C\x00\x1C\x00\x1C\x00\x00\x00\x00\x00\x00\x00', # ".",14 
+    "/":b'\x00\x00\x00\x00\x00\x04\x00\x06\x00\x02\x00\x03\x00\x01\x00\x01\x80\x00\x80\x00\x40\x00\x40\x00\x60\x00\x20\x00\x20\x00\x10\x00\x10\x00\x08\x00\x08\x00\x0C\x00\x04\x00\x06\x00\x02\x00\x00\x00', # "/",15 
+    "0":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x98\x01\x0C\x03\x0C\x03\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x0C\x03\x0C\x03\x98\x01\xF0\x00\x00\x00\x00\x00\x00\x00', # "0",16 
+    "1":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x40\x00\x7C\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xFC\x03\x00\x00\x00\x00\x00\x00', # "1",17 
+    "2":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x00\x84\x01\x02\x03\x06\x03\x06\x03\x00\x03\x00\x01\x80\x01\xC0\x00\x60\x00\x20\x00\x10\x00\x08\x02\x04\x02\x06\x02\xFE\x03\x00\x00\x00\x00\x00\x00', # "2",18 
+    "3":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x78\x00\xC6\x00\x86\x01\x86\x01\x80\x01\x80\x01\xC0\x00\x70\x00\x80\x01\x00\x01\x00\x03\x00\x03\x06\x03\x06\x03\x86\x01\xF8\x00\x00\x00\x00\x00\x00\x00', # "3",19 
+    "4":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\x80\x01\xC0\x01\xA0\x01\xA0\x01\x90\x01\x88\x01\x88\x01\x84\x01\x82\x01\xFE\x0F\x80\x01\x80\x01\x80\x01\x80\x01\xE0\x07\x00\x00\x00\x00\x00\x00', # "4",20 
+    "5":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x03\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\xF4\x00\x8C\x01\x04\x03\x00\x03\x00\x03\x06\x03\x06\x03\x82\x01\x84\x01\xF8\x00\x00\x00\x00\x00\x00\x00', # "5",21 
+    "6":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x01\x18\x03\x0C\x03\x0C\x00\x04\x00\x06\x00\xE6\x01\x16\x03\x0E\x06\x06\x06\x06\x06\x06\x06\x04\x06\x0C\x02\x18\x03\xF0\x00\x00\x00\x00\x00\x00\x00', # "6",22 
+    "7":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x07\x0C\x06\x04\x02\x04\x01\x00\x01\x00\x01\x80\x00\x80\x00\x40\x00\x40\x00\x40\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x00\x00\x00\x00\x00\x00', # "7",23 
+    "8":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x01\x0C\x03\x06\x06\x06\x06\x06\x06\x0C\x02\x1C\x03\xF0\x00\xC8\x01\x0C\x03\x06\x06\x06\x06\x06\x06\x06\x06\x0C\x03\xF0\x01\x00\x00\x00\x00\x00\x00', # "8",24 
+    "9":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x0C\x01\x0C\x03\x06\x02\x06\x06\x06\x06\x06\x06\x06\x07\x8C\x06\x78\x06\x00\x06\x00\x03\x00\x03\x0C\x01\x8C\x01\x78\x00\x00\x00\x00\x00\x00\x00', # "9",25 
+    ":":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x00\xE0\x00\xE0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x00\xE0\x00\xE0\x00\x00\x00\x00\x00\x00\x00', # ":",26 
+    ";":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x60\x00\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x60\x00\x60\x00\x40\x00\x20\x00\x20\x00', # ";",27 
+    "<":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x04\x00\x02\x00\x01\x80\x00\x40\x00\x20\x00\x10\x00\x08\x00\x04\x00\x08\x00\x10\x00\x20\x00\x40\x00\x80\x00\x00\x01\x00\x02\x00\x04\x00\x00\x00\x00\x00\x00', # "<",28 
+    "=":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x07\x00\x00\x00\x00\x00\x00\xFE\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "=",29 
+    ">":b'\x00\x00\x00\x00\x00\x00\x00\x00\x04\x00\x08\x00\x10\x00\x20\x00\x40\x00\x80\x00\x00\x01\x00\x02\x00\x04\x00\x02\x00\x01\x80\x00\x40\x00\x20\x00\x10\x00\x08\x00\x04\x00\x00\x00\x00\x00\x00\x00', # ">",30 
+    "?":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x03\x18\x06\x04\x0C\x04\x0C\x0C\x0C\x0C\x0C\x00\x07\x80\x01\x40\x00\x40\x00\x40\x00\x00\x00\x00\x00\xE0\x00\xE0\x00\xE0\x00\x00\x00\x00\x00\x00\x00', # "?",31 
+    "@":b'\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x00\x18\x03\x0C\x02\xCC\x05\x64\x05\x66\x05\xA6\x05\xB6\x04\xB6\x04\xB6\x04\xB6\x04\xB6\x02\xE4\x01\x0C\x04\x0C\x02\x18\x03\xF0\x00\x00\x00\x00\x00\x00\x00', # "@",32 
+    "A":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x60\x00\x60\x00\x50\x00\xD0\x00\x90\x00\x90\x00\x88\x00\x88\x01\x08\x01\xF8\x01\x04\x03\x04\x03\x04\x02\x02\x02\x02\x06\x0F\x0F\x00\x00\x00\x00\x00\x00', # "A",33 
+    "B":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x00\x8C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x8C\x01\xFC\x00\x0C\x03\x0C\x02\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x03\xFE\x01\x00\x00\x00\x00\x00\x00', # "B",34 
+    "C":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x03\x18\x03\x0C\x06\x0C\x04\x04\x04\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x04\x0C\x04\x0C\x02\x18\x03\xF0\x00\x00\x00\x00\x00\x00\x00', # "C",35 
+    "D":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7F\x00\x8C\x01\x0C\x03\x0C\x03\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x03\x0C\x03\x8C\x01\x7F\x00\x00\x00\x00\x00\x00\x00', # "D",36 
+    "E":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF\x03\x06\x03\x06\x04\x06\x04\x06\x00\x86\x00\x86\x00\xFE\x00\x86\x00\x86\x00\x86\x00\x06\x00\x06\x04\x06\x04\x06\x02\xFF\x03\x00\x00\x00\x00\x00\x00', # "E",37 
+    "F":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF\x03\x06\x03\x06\x04\x06\x04\x06\x00\x86\x00\x86\x00\xFE\x00\x86\x00\x86\x00\x86\x00\x06\x00\x06\x00\x06\x00\x06\x00\x1F\x00\x00\x00\x00\x00\x00\x00', # "F",38 
+    "G":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x18\x01\x0C\x02\x0C\x02\x04\x02\x06\x00\x06\x00\x06\x00\x06\x00\xC6\x0F\x06\x03\x06\x03\x0C\x03\x0C\x03\x18\x03\xF0\x00\x00\x00\x00\x00\x00\x00', # "G",39 
+    "H":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0F\x0F\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\xFE\x07\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x0F\x0F\x00\x00\x00\x00\x00\x00', # "H",40 
+    "I":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x03\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xFC\x03\x00\x00\x00\x00\x00\x00', # "I",41 
+    "J":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x07\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC6\x00\x66\x00\x3C\x00', # "J",42 
+    "K":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xCF\x03\x86\x01\xC6\x00\x46\x00\x26\x00\x16\x00\x36\x00\x2E\x00\x6E\x00\x46\x00\xC6\x00\x86\x00\x86\x01\x06\x01\x06\x03\x8F\x07\x00\x00\x00\x00\x00\x00', # "K",43 
+    "L":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1F\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x04\x06\x04\x06\x02\xFF\x03\x00\x00\x00\x00\x00\x00', # "L",44 
+    "M":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x07\x07\x86\x03\x86\x03\x8E\x03\x8E\x03\x4E\x03\x4E\x03\x4A\x03\x5A\x03\x5A\x03\x3A\x03\x32\x03\x32\x03\x32\x03\x12\x03\x87\x07\x00\x00\x00\x00\x00\x00', # "M",45 
+    "N":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x8E\x0F\x0C\x02\x1C\x02\x1C\x02\x34\x02\x34\x02\x64\x02\x64\x02\x44\x02\xC4\x02\x84\x02\x84\x03\x84\x03\x04\x03\x04\x03\x1F\x02\x00\x00\x00\x00\x00\x00', # "N",46 
+    "O":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x98\x01\x0C\x03\x0C\x02\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x0C\x02\x0C\x03\x98\x01\xF0\x00\x00\x00\x00\x00\x00\x00', # "O",47 
+    "P":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF\x00\x06\x03\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x86\x03\xFE\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x1F\x00\x00\x00\x00\x00\x00\x00', # "P",48 
+    "Q":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x98\x01\x0C\x03\x0C\x02\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x76\x06\x4C\x02\xCC\x03\x98\x01\xF0\x00\x80\x07\x00\x03\x00\x00', # "Q",49 
+    "R":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF\x01\x06\x03\x06\x06\x06\x06\x06\x06\x06\x06\x06\x03\xFE\x00\x46\x00\xC6\x00\x86\x00\x86\x01\x06\x03\x06\x03\x06\x06\x0F\x0E\x00\x00\x00\x00\x00\x00', # "R",50 
+    "S":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x02\x0C\x03\x06\x02\x06\x02\x06\x00\x0E\x00\x3C\x00\xF8\x00\xE0\x03\x80\x03\x00\x07\x02\x06\x02\x06\x06\x06\x0C\x03\xF0\x01\x00\x00\x00\x00\x00\x00', # "S",51 
+    "T":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x07\x62\x04\x61\x08\x61\x08\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xF8\x01\x00\x00\x00\x00\x00\x00', # "T",52 
+    "U":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1E\x07\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x0C\x02\x18\x01\xF0\x00\x00\x00\x00\x00\x00\x00', # "U",53 
+    "V":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0F\x07\x06\x02\x04\x01\x04\x01\x0C\x01\x0C\x01\x88\x00\x88\x00\x98\x00\x98\x00\x50\x00\x50\x00\x70\x00\x30\x00\x20\x00\x20\x00\x00\x00\x00\x00\x00\x00', # "V",54 
+    "W":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF7\x0E\x62\x04\x42\x04\x46\x04\x46\x04\x64\x02\x64\x02\xE4\x02\xE4\x02\x9C\x02\x9C\x01\x98\x01\x98\x01\x88\x01\x88\x00\x88\x00\x00\x00\x00\x00\x00\x00', # "W",55 
+    "X":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9E\x07\x0C\x01\x08\x01\x18\x01\x90\x00\xB0\x00\x60\x00\x20\x00\x60\x00\x60\x00\xD0\x00\x90\x00\x88\x01\x08\x01\x04\x03\x8E\x07\x00\x00\x00\x00\x00\x00', # "X",56 
+    "Y":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0F\x0F\x06\x04\x04\x02\x0C\x02\x08\x01\x18\x01\xB8\x00\xB0\x00\x70\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xF8\x01\x00\x00\x00\x00\x00\x00', # "Y",57 
+    "Z":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x07\x0C\x02\x06\x03\x02\x01\x80\x01\x80\x00\x40\x00\x40\x00\x20\x00\x20\x00\x10\x00\x18\x00\x08\x04\x0C\x04\x04\x02\xFE\x03\x00\x00\x00\x00\x00\x00', # "Z",58 
+    "[":b'\x00\x00\x00\x00\xE0\x03\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\xE0\x03\x00\x00', # "[",59 
+    "\\":b'\x00\x00\x00\x00\x00\x00\x00\x00\x04\x00\x04\x00\x08\x00\x08\x00\x10\x00\x10\x00\x10\x00\x20\x00\x20\x00\x40\x00\x40\x00\xC0\x00\x80\x00\x80\x00\x00\x01\x00\x01\x00\x02\x00\x02\x00\x02\x00\x04', # "\",60 
+    "]":b'\x00\x00\x00\x00\x7C\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x7C\x00\x00\x00', # "]",61 
+    "^":b'\x00\x00\x60\x00\x90\x00\x08\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "^",62 
+    "_":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF\x0F', # "_",63 
+    "`":b'\x00\x00\x00\x00\x18\x00\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "`",64 
+    "a":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x01\x0C\x03\x0C\x03\x00\x03\xE0\x03\x1C\x03\x0E\x03\x06\x03\x06\x03\x8E\x0B\x7C\x0E\x00\x00\x00\x00\x00\x00', # "a",65 
+    "b":b'\x00\x00\x00\x00\x00\x00\x00\x00\x08\x00\x0E\x00\x0C\x00\x0C\x00\x0C\x00\x0C\x00\xCC\x01\x3C\x03\x1C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x02\x1C\x03\xE4\x01\x00\x00\x00\x00\x00\x00', # "b",66 
+    "c":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x8C\x01\x8C\x01\x86\x01\x06\x00\x06\x00\x06\x00\x06\x02\x0C\x02\x0C\x01\xF0\x00\x00\x00\x00\x00\x00\x00', # "c",67 
+    "d":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x02\xC0\x03\x00\x03\x00\x03\x00\x03\x00\x03\x78\x03\x8C\x03\x0C\x03\x06\x03\x06\x03\x06\x03\x06\x03\x06\x03\x04\x03\x8C\x07\x78\x01\x00\x00\x00\x00\x00\x00', # "d",68 
+    "e":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x01\x18\x03\x08\x02\x0C\x06\x0C\x06\xFC\x07\x0C\x00\x0C\x00\x18\x04\x18\x02\xE0\x01\x00\x00\x00\x00\x00\x00', # "e",69 
+    "f":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x03\x60\x06\x30\x06\x30\x00\x30\x00\xFE\x01\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\xFC\x01\x00\x00\x00\x00\x00\x00', # "f",70 
+    "g":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x07\xD8\x06\x8C\x01\x8C\x01\x8C\x01\x98\x01\xF8\x00\x0C\x00\xFC\x00\xCC\x03\x06\x03\x06\x03\x8E\x03\xF8\x00', # "g",71 
+    "h":b'\x00\x00\x00\x00\x00\x00\x00\x00\x08\x00\x0E\x00\x0C\x00\x0C\x00\x0C\x00\x0C\x00\xEC\x01\x1C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x9E\x07\x00\x00\x00\x00\x00\x00', # "h",72 
+    "i":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x60\x00\x60\x00\x00\x00\x00\x00\x40\x00\x7C\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xFC\x03\x00\x00\x00\x00\x00\x00', # "i",73 
+    "j":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x01\xC0\x01\x00\x00\x00\x00\x00\x01\xF0\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xCC\x00\x7C\x00', # "j",74 
+    "k":b'\x00\x00\x00\x00\x00\x00\x00\x00\x08\x00\x0E\x00\x0C\x00\x0C\x00\x0C\x00\x0C\x00\x8C\x03\x8C\x00\x8C\x00\x4C\x00\x6C\x00\x5C\x00\x8C\x00\x8C\x01\x0C\x01\x0C\x03\x9E\x07\x00\x00\x00\x00\x00\x00', # "k",75 
+    "l":b'\x00\x00\x00\x00\x00\x00\x00\x00\x40\x00\x7C\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xFC\x03\x00\x00\x00\x00\x00\x00', # "l",76 
+    "m":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x37\x07\xEE\x06\x66\x06\x66\x06\x66\x06\x66\x06\x66\x06\x66\x06\x66\x06\x66\x06\xFF\x0F\x00\x00\x00\x00\x00\x00', # "m",77 
+    "n":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xEE\x01\x1C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x9E\x07\x00\x00\x00\x00\x00\x00', # "n",78 
+    "o":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x98\x01\x0C\x03\x06\x06\x06\x06\x06\x06\x06\x06\x06\x06\x0C\x03\x0C\x03\xF0\x00\x00\x00\x00\x00\x00\x00', # "o",79 
+    "p":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xEE\x01\x1C\x03\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x06\x0C\x03\x1C\x03\xEC\x01\x0C\x00\x0C\x00\x3E\x00', # "p",80 
+    "q":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x78\x02\x8C\x03\x0C\x03\x06\x03\x06\x03\x06\x03\x06\x03\x06\x03\x04\x03\x8C\x03\x78\x03\x00\x03\x00\x03\xC0\x07', # "q",81 
+    "r":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9F\x03\x58\x06\x38\x06\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\xFF\x00\x00\x00\x00\x00\x00\x00', # "r",82 
+    "s":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x03\x1C\x03\x0C\x02\x0C\x02\x38\x00\xF0\x00\xC0\x03\x04\x03\x04\x03\x8C\x03\xFC\x01\x00\x00\x00\x00\x00\x00', # "s",83 
+    "t":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x20\x00\x20\x00\x30\x00\x30\x00\xFE\x01\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x00\x30\x02\x30\x02\xE0\x01\x00\x00\x00\x00\x00\x00', # "t",84 
+    "u":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x08\x02\x8E\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x0C\x03\x9C\x07\x78\x01\x00\x00\x00\x00\x00\x00', # "u",85 
+    "v":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1E\x07\x0C\x02\x08\x01\x08\x01\x18\x01\x90\x00\xB0\x00\xB0\x00\x60\x00\x60\x00\x20\x00\x00\x00\x00\x00\x00\x00', # "v",86 
+    "w":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF7\x0E\x62\x04\x46\x04\x64\x02\x64\x02\xEC\x02\x9C\x01\x98\x01\x98\x01\x98\x01\x08\x00\x00\x00\x00\x00\x00\x00', # "w",87 
+    "x":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xBC\x07\x18\x01\x10\x01\xB0\x00\x60\x00\x60\x00\xE0\x00\x90\x00\x08\x01\x08\x03\x9E\x07\x00\x00\x00\x00\x00\x00', # "x",88 
+    "y":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9E\x07\x08\x01\x08\x01\x08\x01\x90\x00\x90\x00\xB0\x00\x60\x00\x60\x00\x60\x00\x20\x00\x20\x00\x24\x00\x1C\x00', # "y",89 
+    "z":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x01\x84\x01\xC4\x00\x44\x00\x60\x00\x20\x00\x30\x00\x18\x02\x08\x02\x0C\x03\xFC\x01\x00\x00\x00\x00\x00\x00', # "z",90 
+    "{":b'\x00\x00\x00\x00\x00\x03\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x40\x00\x20\x00\x40\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x00\x03\x00\x00', # "{",91 
+    "|":b'\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00', # "|",92 
+    "}":b'\x00\x00\x00\x00\x0C\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x20\x00\x40\x00\x20\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x10\x00\x0C\x00\x00\x00', # "}",93 
+    "~":b'\x00\x00\x1C\x00\x22\x04\xC2\x04\x80\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "~",94 
 
 
 }
 
 ascii_3216={
-    " ":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # " ",0 
-    "!":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0xC0,0x03,0xC0,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "!",1 
-    "\"":[0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1C,0xE0,0x1C,0xF0,0x1E,0x70,0x0E,0x38,0x07,0x18,0x03,0x08,0x01,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # """,2 
-    "#":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xFE,0x7F,0xFE,0x7F,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0xFE,0x7F,0xFE,0x7F,0x08,0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "#",3 
-    "$":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0xC0,0x07,0x60,0x19,0x10,0x31,0x18,0x31,0x18,0x39,0x18,0x39,0x38,0x01,0x70,0x01,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x00,0x1D,0x00,0x39,0x00,0x31,0x1C,0x31,0x1C,0x31,0x0C,0x31,0x0C,0x11,0x18,0x0D,0xE0,0x07,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00], # "$",4 
-    "%":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x10,0x36,0x18,0x63,0x08,0x63,0x0C,0x63,0x04,0x63,0x04,0x63,0x02,0x63,0x02,0x63,0x01,0x36,0x1D,0x9C,0x37,0x80,0x22,0x80,0x63,0x40,0x63,0x40,0x63,0x20,0x63,0x20,0x63,0x30,0x63,0x10,0x22,0x18,0x36,0x08,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "%",5 
-    "&":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x98,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x01,0x8C,0x00,0xCC,0x00,0x78,0x00,0x18,0x3E,0x1C,0x08,0x36,0x08,0x32,0x08,0x63,0x04,0x63,0x04,0xC3,0x04,0xC3,0x03,0x83,0x43,0x06,0x43,0x8E,0x26,0x78,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "&",6 
-    "'":[0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x3C,0x00,0x3C,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x0C,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "'",7 
-    "(":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x00], # "(",8 
-    ")":[0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x00,0x00], # ")",9 
-    "*":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x03,0x80,0x03,0x00,0x01,0x1C,0x71,0x3C,0x79,0x78,0x3D,0xC0,0x07,0x00,0x01,0xC0,0x07,0x78,0x3D,0x3C,0x79,0x1C,0x71,0x00,0x01,0x80,0x03,0x80,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "*",10 
-    "+":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0xFC,0x7F,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "+",11 
-    ",":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x3C,0x00,0x3C,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x0C,0x00,0x06,0x00], # ",",12 
-    "-":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "-",13 
-    ".":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x3C,0x00,0x3C,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # ".",14 
-    "/":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x00,0x00,0x00,0x00], # "/",15 
-    "0":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x60,0x0C,0x30,0x18,0x18,0x30,0x18,0x30,0x18,0x20,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x18,0x20,0x18,0x30,0x18,0x30,0x30,0x18,0x60,0x0C,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "0",16 
-    "1":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xC0,0x03,0xF8,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "1",17 
-    "2":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x10,0x1C,0x08,0x18,0x04,0x30,0x04,0x30,0x0C,0x30,0x0C,0x30,0x00,0x30,0x00,0x18,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x80,0x00,0x40,0x00,0x20,0x20,0x10,0x20,0x08,0x20,0x04,0x30,0xFC,0x1F,0xFC,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "2",18 
-    "3":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x18,0x0E,0x0C,0x0C,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x00,0x18,0x00,0x0C,0x00,0x06,0xC0,0x03,0x00,0x0E,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x10,0x0C,0x18,0x18,0x0C,0xE0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "3",19 
-    "4":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0E,0x00,0x0E,0x00,0x0F,0x80,0x0E,0x80,0x0E,0x40,0x0E,0x60,0x0E,0x20,0x0E,0x10,0x0E,0x10,0x0E,0x08,0x0E,0x04,0x0E,0x04,0x0E,0xFE,0x7F,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0xC0,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "4",20 
-    "5":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x3F,0xF0,0x3F,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0xC8,0x07,0x28,0x0C,0x18,0x18,0x08,0x10,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x0C,0x30,0x0C,0x30,0x04,0x18,0x04,0x18,0x08,0x0C,0xF0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "5",21 
-    "6":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x0F,0xC0,0x10,0x20,0x30,0x10,0x30,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x8C,0x0F,0x6C,0x18,0x3C,0x30,0x1C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x18,0x60,0x18,0x20,0x30,0x30,0x60,0x18,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "6",22 
-    "7":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x3F,0xF8,0x3F,0x1C,0x10,0x0C,0x08,0x04,0x08,0x04,0x04,0x00,0x04,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "7",23 
-    "8":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x30,0x0C,0x18,0x18,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1C,0x30,0x38,0x18,0x70,0x08,0xE0,0x07,0xB0,0x07,0x18,0x0E,0x0C,0x1C,0x06,0x38,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x0C,0x18,0x18,0x0C,0xE0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "8",24 
-    "9":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x18,0x04,0x0C,0x08,0x0C,0x18,0x06,0x10,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x30,0x06,0x38,0x0C,0x3C,0x18,0x36,0xF0,0x31,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x0C,0x0C,0x0C,0x06,0x0C,0x03,0xF0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "9",25 
-    ":":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0xC0,0x03,0xC0,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0xC0,0x03,0xC0,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # ":",26 
-    ";":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0x80,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x00,0x00], # ";",27 
-    "<":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x06,0x00,0x03,0x80,0x01,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "<",28 
-    "=":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "=",29 
-    ">":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x80,0x01,0xC0,0x00,0x60,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # ">",30 
-    "?":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x30,0x18,0x08,0x30,0x08,0x60,0x0C,0x60,0x1C,0x60,0x1C,0x60,0x1C,0x60,0x00,0x30,0x00,0x1C,0x00,0x06,0x00,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0xC0,0x03,0xC0,0x03,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "?",31 
-    "@":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x60,0x18,0x10,0x30,0x18,0x20,0x0C,0x2F,0x8C,0x4D,0x86,0x4C,0xC6,0x4C,0xC6,0x4C,0x66,0x4C,0x66,0x44,0x66,0x44,0x66,0x26,0x66,0x26,0x66,0x15,0xCC,0x1C,0x0C,0x40,0x08,0x20,0x18,0x30,0x30,0x18,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "@",32 
-    "A":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0x40,0x01,0x60,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x30,0x06,0x10,0x06,0x10,0x06,0x10,0x06,0xF8,0x0F,0x08,0x0C,0x08,0x0C,0x08,0x0C,0x0C,0x0C,0x04,0x18,0x04,0x18,0x06,0x18,0x1F,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "A",33 
-    "B":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x18,0x1C,0x18,0x38,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x18,0x18,0x0C,0xF8,0x07,0x18,0x18,0x18,0x30,0x18,0x20,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x30,0x18,0x18,0xFE,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "B",34 
-    "C":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x27,0x60,0x38,0x10,0x30,0x18,0x20,0x0C,0x40,0x0C,0x40,0x04,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x0C,0x40,0x0C,0x40,0x0C,0x20,0x18,0x30,0x30,0x18,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "C",35 
-    "D":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x18,0x0E,0x18,0x18,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x30,0x18,0x30,0x18,0x10,0x18,0x18,0x18,0x0E,0xFE,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "D",36 
-    "E":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x3F,0x18,0x30,0x18,0x20,0x18,0x60,0x18,0x40,0x18,0x00,0x18,0x08,0x18,0x08,0x18,0x0C,0xF8,0x0F,0x18,0x0C,0x18,0x08,0x18,0x08,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x40,0x18,0x40,0x18,0x20,0x18,0x30,0xFE,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "E",37 
-    "F":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0x18,0x70,0x18,0x40,0x18,0xC0,0x18,0x80,0x18,0x00,0x18,0x10,0x18,0x10,0x18,0x18,0xF8,0x1F,0x18,0x18,0x18,0x10,0x18,0x10,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "F",38 
-    "G":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x13,0x70,0x1C,0x10,0x10,0x18,0x10,0x0C,0x20,0x0C,0x20,0x04,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0xFC,0x06,0x30,0x06,0x30,0x0C,0x30,0x0C,0x30,0x18,0x30,0x18,0x30,0x30,0x08,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "G",39 
-    "H":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7E,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0xFC,0x1F,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x3F,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "H",40 
-    "I":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xF8,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "I",41 
-    "J":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x7F,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x0E,0x06,0x0E,0x03,0x8E,0x01,0xFC,0x00], # "J",42 
-    "K":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x7C,0x18,0x18,0x18,0x08,0x18,0x04,0x18,0x06,0x18,0x02,0x18,0x01,0x98,0x01,0x98,0x01,0xD8,0x01,0xB8,0x03,0x38,0x03,0x18,0x07,0x18,0x06,0x18,0x0E,0x18,0x0C,0x18,0x1C,0x18,0x18,0x18,0x30,0x18,0x30,0x7E,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "K",43 
-    "L":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x40,0x18,0x40,0x18,0x20,0x18,0x30,0xFE,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "L",44 
-    "M":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xF8,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x3C,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x36,0x74,0x32,0x64,0x32,0x64,0x32,0x64,0x32,0x64,0x31,0xC4,0x31,0xC4,0x31,0xC4,0x31,0xC4,0x30,0xC4,0x30,0x84,0x30,0x9F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "M",45 
-    "N":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x7C,0x1C,0x10,0x3C,0x10,0x34,0x10,0x34,0x10,0x74,0x10,0x64,0x10,0xE4,0x10,0xC4,0x10,0xC4,0x11,0x84,0x11,0x84,0x13,0x04,0x13,0x04,0x17,0x04,0x16,0x04,0x1E,0x04,0x1C,0x04,0x1C,0x04,0x1C,0x04,0x18,0x1F,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "N",46 
-    "O":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0x30,0x0C,0x18,0x18,0x08,0x10,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x0C,0x20,0x0C,0x30,0x08,0x10,0x18,0x18,0x30,0x0C,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "O",47 
-    "P":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x0F,0x18,0x18,0x18,0x30,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x30,0x18,0x18,0xF8,0x0F,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "P",48 
-    "Q":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0x30,0x0C,0x18,0x18,0x0C,0x10,0x0C,0x30,0x0C,0x20,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0xE4,0x61,0x2C,0x33,0x1C,0x32,0x18,0x16,0x30,0x0E,0xC0,0x07,0x00,0x4C,0x00,0x7C,0x00,0x38,0x00,0x00,0x00,0x00], # "Q",49 
-    "R":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x07,0x18,0x1C,0x18,0x38,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x18,0x18,0x0C,0xF8,0x07,0x98,0x03,0x18,0x03,0x18,0x07,0x18,0x06,0x18,0x06,0x18,0x0E,0x18,0x0C,0x18,0x0C,0x18,0x1C,0x18,0x18,0x7E,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "R",50 
-    "S":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x27,0x30,0x38,0x18,0x30,0x0C,0x20,0x0C,0x20,0x0C,0x00,0x0C,0x00,0x18,0x00,0x78,0x00,0xE0,0x03,0x80,0x0F,0x00,0x1E,0x00,0x38,0x00,0x70,0x00,0x60,0x04,0x60,0x04,0x60,0x08,0x60,0x18,0x30,0x38,0x18,0xC8,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "S",51 
-    "T":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x3F,0x8C,0x21,0x84,0x61,0x82,0x41,0x82,0x41,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "T",52 
-    "U":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7C,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x0C,0x10,0x08,0x08,0x38,0x04,0xE0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "U",53 
-    "V":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0xF8,0x18,0x20,0x18,0x20,0x18,0x20,0x30,0x10,0x30,0x10,0x30,0x10,0x30,0x10,0x60,0x08,0x60,0x08,0x60,0x08,0xE0,0x0C,0xC0,0x04,0xC0,0x04,0xC0,0x04,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "V",54 
-    "W":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF3,0x86,0x61,0x86,0x21,0x86,0x21,0x8C,0x21,0x0C,0x21,0x8C,0x23,0x8C,0x13,0x8C,0x13,0x8C,0x13,0x4C,0x13,0x58,0x12,0x58,0x16,0x58,0x0E,0x38,0x0E,0x38,0x0E,0x38,0x0E,0x30,0x0C,0x10,0x04,0x10,0x04,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "W",55 
-    "X":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x3E,0x18,0x08,0x38,0x08,0x30,0x04,0x30,0x04,0x70,0x02,0x60,0x02,0xE0,0x01,0xC0,0x01,0xC0,0x01,0x80,0x01,0x80,0x03,0x40,0x03,0x40,0x07,0x20,0x06,0x20,0x06,0x10,0x0C,0x10,0x0C,0x08,0x18,0x08,0x18,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "X",56 
-    "Y":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x7C,0x1C,0x10,0x18,0x10,0x18,0x08,0x30,0x08,0x30,0x0C,0x70,0x04,0x60,0x04,0x60,0x02,0xC0,0x02,0xC0,0x02,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xE0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "Y",57 
-    "Z":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x3F,0x18,0x18,0x08,0x18,0x04,0x0C,0x04,0x0E,0x00,0x06,0x00,0x07,0x00,0x03,0x80,0x03,0x80,0x01,0xC0,0x01,0xC0,0x00,0xE0,0x00,0x60,0x00,0x70,0x00,0x30,0x00,0x38,0x20,0x18,0x20,0x1C,0x10,0x0C,0x18,0xFE,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "Z",58 
-    "[":[0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x3F,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0xC0,0x3F,0x00,0x00,0x00,0x00], # "[",59 
-    "\\":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x00,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x00], # "\",60 
-    "]":[0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0xFC,0x03,0x00,0x00,0x00,0x00], # "]",61 
-    "^":[0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0xC0,0x06,0x20,0x08,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "^",62 
-    "_":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF], # "_",63 
-    "`":[0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0xC0,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "`",64 
-    "a":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x03,0x18,0x06,0x0C,0x0C,0x0C,0x0C,0x00,0x0C,0x80,0x0F,0x70,0x0C,0x1C,0x0C,0x0C,0x0C,0x06,0x0C,0x06,0x0C,0x06,0x4C,0x0C,0x4F,0xF8,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "a",65 
-    "b":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x1E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x0F,0xD8,0x18,0x38,0x30,0x38,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x20,0x38,0x30,0x78,0x18,0xC8,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "b",66 
-    "c":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x70,0x0C,0x18,0x18,0x18,0x18,0x0C,0x18,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x20,0x18,0x20,0x18,0x10,0x30,0x08,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "c",67 
-    "d":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x1E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0xE0,0x1B,0x30,0x1C,0x18,0x18,0x18,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x08,0x18,0x18,0x1C,0x30,0x7A,0xE0,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "d",68 
-    "e":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x30,0x0C,0x18,0x18,0x08,0x10,0x0C,0x30,0x0C,0x30,0xFC,0x3F,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x18,0x20,0x18,0x10,0x70,0x18,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "e",69 
-    "f":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x80,0xC3,0x80,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFC,0x1F,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "f",70 
-    "g":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x77,0x30,0x6C,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x10,0x18,0x30,0x0C,0xF0,0x07,0x18,0x00,0x18,0x00,0xF0,0x0F,0xF0,0x3F,0x08,0x70,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x38,0x38,0xE0,0x0F], # "g",71 
-    "h":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x1E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x98,0x0F,0xD8,0x18,0x38,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x7E,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "h",72 
-    "i":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x80,0x03,0x80,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xF8,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "i",73 
-    "j":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x80,0x1F,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x18,0x0C,0x18,0x06,0xF0,0x03], # "j",74 
-    "k":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x1E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x3E,0x18,0x0C,0x18,0x06,0x18,0x03,0x18,0x01,0x98,0x01,0xD8,0x01,0x38,0x03,0x18,0x07,0x18,0x06,0x18,0x0C,0x18,0x1C,0x18,0x18,0x7E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "k",75 
-    "l":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xF8,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "l",76 
-    "m":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0xEE,0x1C,0x9C,0x33,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x31,0xDE,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "m",77 
-    "n":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x1E,0x0F,0xD8,0x18,0x38,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x7E,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "n",78 
-    "o":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x07,0x70,0x1C,0x10,0x30,0x18,0x30,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x0C,0x60,0x18,0x30,0x18,0x30,0x30,0x18,0xC0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "o",79 
-    "p":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x9E,0x0F,0x58,0x18,0x38,0x30,0x18,0x20,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x30,0x38,0x30,0x78,0x18,0x98,0x07,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00], # "p",80 
-    "q":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x23,0x30,0x3C,0x18,0x38,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x08,0x30,0x18,0x38,0x30,0x3C,0xE0,0x33,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC], # "q",81 
-    "r":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x7E,0x3C,0x60,0x66,0x60,0x61,0xE0,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xFE,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "r",82 
-    "s":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x27,0x30,0x38,0x18,0x30,0x18,0x20,0x18,0x00,0x70,0x00,0xE0,0x03,0x80,0x0F,0x00,0x1C,0x04,0x30,0x04,0x30,0x0C,0x30,0x1C,0x18,0xEC,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "s",83 
-    "t":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xC0,0x00,0xE0,0x00,0xFC,0x1F,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x20,0xC0,0x20,0x80,0x11,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "t",84 
-    "u":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x1E,0x3C,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x38,0x30,0xF4,0xE0,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "u",85 
-    "v":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x3C,0x18,0x18,0x18,0x08,0x38,0x08,0x30,0x04,0x30,0x04,0x70,0x02,0x60,0x02,0x60,0x02,0xE0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "v",86 
-    "w":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xF7,0x8E,0x63,0x0C,0x23,0x8C,0x23,0x8C,0x23,0x98,0x13,0x98,0x13,0x58,0x16,0x58,0x16,0x70,0x0E,0x70,0x0E,0x70,0x0E,0x20,0x04,0x20,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "w",87 
-    "x":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x3E,0x70,0x08,0x70,0x04,0xE0,0x04,0xC0,0x02,0xC0,0x01,0x80,0x03,0x80,0x03,0x40,0x07,0x60,0x06,0x20,0x0C,0x10,0x0C,0x18,0x18,0x3E,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "x",88 
-    "y":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x7C,0x18,0x18,0x18,0x08,0x30,0x08,0x30,0x08,0x30,0x04,0x60,0x04,0x60,0x04,0xC0,0x02,0xC0,0x02,0xC0,0x02,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0x4C,0x00,0x3C,0x00], # "y",89 
-    "z":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x1F,0x0C,0x0C,0x04,0x0E,0x04,0x06,0x00,0x03,0x80,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x70,0x20,0x30,0x20,0x38,0x30,0x1C,0x18,0xFC,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "z",90 
-    "{":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x08,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x02,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x30,0x00,0x00], # "{",91 
-    "|":[0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01], # "|",92 
-    "}":[0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x0C,0x00,0x00,0x00], # "}",93 
-    "~":[0x00,0x00,0x38,0x00,0xC4,0x00,0x86,0x40,0x02,0x61,0x00,0x22,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00], # "~",94 
-    "浦":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0xF8,0x01,0x30,0x00,0x08,0x07,0xE0,0x00,0x08,0x06,0xC0,0x00,0x08,0x1C,0xC0,0xFC,0xFF,0x3F,0x80,0x00,0x08,0x00,0x00,0x04,0x08,0x00,0x04,0x02,0x08,0x00,0x18,0x02,0x08,0x00,0x38,0xF2,0xFF,0x1F,0x30,0x31,0x08,0x0C,0x30,0x31,0x08,0x0C,0x20,0x31,0x08,0x0C,0x80,0xF0,0xFF,0x0F,0x80,0x30,0x08,0x0C,
-    0xC0,0x30,0x08,0x0C,0x40,0x30,0x08,0x0C,0x40,0x30,0x08,0x0C,0x60,0xF0,0xFF,0x0F,0x7C,0x30,0x08,0x0C,0x30,0x30,0x08,0x0C,0x30,0x30,0x08,0x0C,0x30,0x30,0x08,0x0C,0x30,0x30,0x08,0x0C,0x30,0x30,0x08,0x0C,0x30,0x30,0x88,0x0F,0x30,0x30,0x08,0x06,0x00,0x10,0x00,0x02,0x00,0x00,0x00,0x00], # "浦",95
-    "洋":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x80,0x00,0x10,0x40,0x80,0x03,0x60,0xC0,0x81,0x01,0xC0,0x80,0xC3,0x00,0xC0,0x01,0x43,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0x20,0x0C,0x00,0xFC,0xFF,0x1F,0x00,0x04,0x18,0x00,0x0C,0x04,0x18,0x00,0x18,0x02,0x18,0x00,0x38,0x02,0x18,0x00,0x30,0x02,0x18,0x06,0x30,0xF1,0xFF,0x0F,0x00,0x01,0x18,0x00,0x00,0x01,0x18,0x00,
-    0x80,0x01,0x18,0x00,0x80,0x00,0x18,0x00,0xC0,0x00,0x18,0x18,0xC0,0xFC,0xFF,0x3F,0x7C,0x00,0x18,0x00,0x70,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x70,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00], # "洋",96
-    "液":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0C,0x00,0x30,0x00,0x18,0x00,0x60,0x00,0x18,0x18,0xE0,0xFC,0xFF,0x1F,0xC0,0x80,0x00,0x00,0xC0,0x84,0x31,0x00,0x00,0xC4,0x30,0x00,0x00,0xC2,0x30,0x00,0x04,0x62,0x18,0x04,0x18,0x62,0xF8,0x0F,0x38,0x21,0x08,0x0C,0x30,0x31,0x0C,0x04,0x30,0x79,0x34,0x06,0x80,0x38,0x66,0x06,0x80,0x34,0x46,0x02,
-    0x80,0x34,0x4B,0x03,0xC0,0x32,0x09,0x03,0x40,0xB1,0x08,0x01,0x60,0x30,0x90,0x01,0x7C,0x30,0xB0,0x00,0x70,0x30,0xE0,0x00,0x30,0x30,0xE0,0x00,0x30,0x30,0xF0,0x01,0x30,0x30,0x98,0x03,0x30,0x30,0x0C,0x0F,0x30,0x30,0x06,0x7E,0x30,0x30,0x01,0x18,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00], # "液",97
-    "晶":[0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x80,0x00,0x00,0xFE,0xFF,0x01,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0xFE,0xFF,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0xC0,0x00,0x00,0xFE,0xFF,0x00,0x00,0x06,0xC0,0x00,0x00,0x06,0x40,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x04,0x08,0xF0,0x7F,0xFC,0x1F,
-    0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0xF0,0x3F,0xFC,0x0F,0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0x30,0x30,0x0C,0x08,0xF0,0x3F,0xFC,0x0F,0x30,0x30,0x0C,0x08,0x10,0x00,0x04,0x00,0x00,0x00,0x00,0x00], # "晶",98
+    " ":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # " ",0 
+    "!":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x01\xC0\x01\xC0\x01\xC0\x01\xC0\x01\xC0\x01\xC0\x01\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x80\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\xC0\x03\xC0\x03\x80\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "!",1 
+    "\"":b'\x00\x00\x00\x00\x00\x00\xE0\x1C\xE0\x1C\xF0\x1E\x70\x0E\x38\x07\x18\x03\x08\x01\x84\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # """,2 
+    "#":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x20\x10\x20\x10\x20\x10\x20\x10\x20\x10\xFE\x7F\xFE\x7F\x10\x08\x10\x08\x10\x08\x10\x08\x10\x08\x10\x08\x10\x08\xFE\x7F\xFE\x7F\x08\x04\x08\x04\x08\x04\x08\x04\x08\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "#",3 
+    "$":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\x00\x01\xC0\x07\x60\x19\x10\x31\x18\x31\x18\x39\x18\x39\x38\x01\x70\x01\xE0\x01\xC0\x03\x80\x07\x00\x0F\x00\x1D\x00\x39\x00\x31\x1C\x31\x1C\x31\x0C\x31\x0C\x11\x18\x0D\xE0\x07\x00\x01\x00\x01\x00\x01\x00\x00\x00\x00', # "$",4 
+    "%":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1C\x10\x36\x18\x63\x08\x63\x0C\x63\x04\x63\x04\x63\x02\x63\x02\x63\x01\x36\x1D\x9C\x37\x80\x22\x80\x63\x40\x63\x40\x63\x20\x63\x20\x63\x30\x63\x10\x22\x18\x36\x08\x1C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "%",5 
+    "&":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x00\x98\x01\x8C\x01\x8C\x01\x8C\x01\x8C\x01\x8C\x00\xCC\x00\x78\x00\x18\x3E\x1C\x08\x36\x08\x32\x08\x63\x04\x63\x04\xC3\x04\xC3\x03\x83\x43\x06\x43\x8E\x26\x78\x1C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "&",6 
+    "'":b'\x00\x00\x00\x00\x00\x00\x1C\x00\x3C\x00\x3C\x00\x30\x00\x30\x00\x10\x00\x0C\x00\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "'",7 
+    "(":b'\x00\x00\x00\x00\x00\x00\x00\x40\x00\x20\x00\x10\x00\x08\x00\x0C\x00\x04\x00\x06\x00\x03\x00\x03\x00\x03\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x00\x03\x00\x03\x00\x03\x00\x06\x00\x06\x00\x0C\x00\x08\x00\x10\x00\x20\x00\x40\x00\x00', # "(",8 
+    ")":b'\x00\x00\x00\x00\x00\x00\x02\x00\x04\x00\x08\x00\x10\x00\x30\x00\x20\x00\x60\x00\xC0\x00\xC0\x00\xC0\x00\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xC0\x00\xC0\x00\xC0\x00\x60\x00\x60\x00\x30\x00\x10\x00\x08\x00\x04\x00\x02\x00\x00\x00', # ")",9 
+    "*":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\x80\x03\x80\x03\x00\x01\x1C\x71\x3C\x79\x78\x3D\xC0\x07\x00\x01\xC0\x07\x78\x3D\x3C\x79\x1C\x71\x00\x01\x80\x03\x80\x03\x80\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "*",10 
+    "+":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\xFC\x7F\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "+",11 
+    ",":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1C\x00\x3C\x00\x3C\x00\x30\x00\x30\x00\x10\x00\x0C\x00\x06\x00', # ",",12 
+    "-":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x7F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "-",13 
+    ".":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x18\x00\x3C\x00\x3C\x00\x18\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # ".",14 
+    "/":b'\x00\x00\x00\x00\x00\x00\x00\x40\x00\x60\x00\x20\x00\x30\x00\x10\x00\x18\x00\x08\x00\x0C\x00\x04\x00\x06\x00\x02\x00\x03\x00\x01\x80\x01\x80\x00\xC0\x00\x40\x00\x60\x00\x20\x00\x30\x00\x10\x00\x18\x00\x08\x00\x0C\x00\x04\x00\x06\x00\x02\x00\x00\x00\x00\x00', # "/",15 
+    "0":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x07\x60\x0C\x30\x18\x18\x30\x18\x30\x18\x20\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x18\x20\x18\x30\x18\x30\x30\x18\x60\x0C\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "0",16 
+    "1":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\x80\x01\xF8\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xC0\x03\xF8\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "1",17 
+    "2":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x07\x10\x1C\x08\x18\x04\x30\x04\x30\x0C\x30\x0C\x30\x00\x30\x00\x18\x00\x08\x00\x04\x00\x02\x00\x01\x80\x00\x40\x00\x20\x20\x10\x20\x08\x20\x04\x30\xFC\x1F\xFC\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "2",18 
+    "3":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x03\x18\x0E\x0C\x0C\x0C\x18\x0C\x18\x0C\x18\x00\x18\x00\x0C\x00\x06\xC0\x03\x00\x0E\x00\x18\x00\x10\x00\x30\x00\x30\x0C\x30\x0C\x30\x0C\x10\x0C\x18\x18\x0C\xE0\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "3",19 
+    "4":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x0C\x00\x0E\x00\x0E\x00\x0F\x80\x0E\x80\x0E\x40\x0E\x60\x0E\x20\x0E\x10\x0E\x10\x0E\x08\x0E\x04\x0E\x04\x0E\xFE\x7F\x00\x0E\x00\x0E\x00\x0E\x00\x0E\x00\x0E\x00\x0E\xC0\x7F\x00\x00\x00\x00\x00\x00\x00\x00', # "4",20 
+    "5":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x3F\xF0\x3F\x10\x00\x10\x00\x10\x00\x08\x00\x08\x00\xC8\x07\x28\x0C\x18\x18\x08\x10\x00\x30\x00\x30\x00\x30\x00\x30\x0C\x30\x0C\x30\x04\x18\x04\x18\x08\x0C\xF0\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "5",21 
+    "6":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x0F\xC0\x10\x20\x30\x10\x30\x18\x00\x18\x00\x08\x00\x0C\x00\x8C\x0F\x6C\x18\x3C\x30\x1C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x18\x60\x18\x20\x30\x30\x60\x18\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "6",22 
+    "7":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x3F\xF8\x3F\x1C\x10\x0C\x08\x04\x08\x04\x04\x00\x04\x00\x02\x00\x02\x00\x01\x00\x01\x00\x01\x80\x00\x80\x00\x80\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "7",23 
+    "8":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x07\x30\x0C\x18\x18\x0C\x30\x0C\x30\x0C\x30\x1C\x30\x38\x18\x70\x08\xE0\x07\xB0\x07\x18\x0E\x0C\x1C\x06\x38\x06\x30\x06\x30\x06\x30\x06\x30\x0C\x18\x18\x0C\xE0\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "8",24 
+    "9":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x03\x18\x04\x0C\x08\x0C\x18\x06\x10\x06\x30\x06\x30\x06\x30\x06\x30\x06\x38\x0C\x3C\x18\x36\xF0\x31\x00\x30\x00\x18\x00\x18\x00\x18\x0C\x0C\x0C\x06\x0C\x03\xF0\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "9",25 
+    ":":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\xC0\x03\xC0\x03\x80\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x01\xC0\x03\xC0\x03\x80\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # ":",26 
+    ";":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x00\xC0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x00\xC0\x00\x80\x00\x80\x00\x40\x00\x40\x00\x00\x00', # ";",27 
+    "<":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x20\x00\x10\x00\x08\x00\x04\x00\x06\x00\x03\x80\x01\xC0\x00\x60\x00\x30\x00\x18\x00\x0C\x00\x18\x00\x30\x00\x60\x00\xC0\x00\x80\x01\x00\x03\x00\x06\x00\x04\x00\x08\x00\x10\x00\x20\x00\x00\x00\x00\x00\x00\x00\x00', # "<",28 
+    "=":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x7F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x7F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "=",29 
+    ">":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x04\x00\x08\x00\x10\x00\x20\x00\x60\x00\xC0\x00\x80\x01\x00\x03\x00\x06\x00\x0C\x00\x18\x00\x30\x00\x18\x00\x0C\x00\x06\x00\x03\x80\x01\xC0\x00\x60\x00\x20\x00\x10\x00\x08\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00', # ">",30 
+    "?":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x07\x30\x18\x08\x30\x08\x60\x0C\x60\x1C\x60\x1C\x60\x1C\x60\x00\x30\x00\x1C\x00\x06\x00\x01\x80\x00\x80\x00\x80\x00\x80\x00\x00\x00\x00\x00\x80\x01\xC0\x03\xC0\x03\x80\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "?",31 
+    "@":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x07\x60\x18\x10\x30\x18\x20\x0C\x2F\x8C\x4D\x86\x4C\xC6\x4C\xC6\x4C\x66\x4C\x66\x44\x66\x44\x66\x26\x66\x26\x66\x15\xCC\x1C\x0C\x40\x08\x20\x18\x30\x30\x18\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "@",32 
+    "A":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\xC0\x01\xC0\x01\xC0\x01\x40\x01\x60\x03\x20\x03\x20\x03\x20\x03\x30\x06\x10\x06\x10\x06\x10\x06\xF8\x0F\x08\x0C\x08\x0C\x08\x0C\x0C\x0C\x04\x18\x04\x18\x06\x18\x1F\x7C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "A",33 
+    "B":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x07\x18\x1C\x18\x38\x18\x30\x18\x30\x18\x30\x18\x30\x18\x18\x18\x0C\xF8\x07\x18\x18\x18\x30\x18\x20\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x30\x18\x18\xFE\x0F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "B",34 
+    "C":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x27\x60\x38\x10\x30\x18\x20\x0C\x40\x0C\x40\x04\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x0C\x40\x0C\x40\x0C\x20\x18\x30\x30\x18\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "C",35 
+    "D":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x03\x18\x0E\x18\x18\x18\x30\x18\x30\x18\x30\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x30\x18\x30\x18\x10\x18\x18\x18\x0E\xFE\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "D",36 
+    "E":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x3F\x18\x30\x18\x20\x18\x60\x18\x40\x18\x00\x18\x08\x18\x08\x18\x0C\xF8\x0F\x18\x0C\x18\x08\x18\x08\x18\x00\x18\x00\x18\x00\x18\x40\x18\x40\x18\x20\x18\x30\xFE\x3F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "E",37 
+    "F":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x7F\x18\x70\x18\x40\x18\xC0\x18\x80\x18\x00\x18\x10\x18\x10\x18\x18\xF8\x1F\x18\x18\x18\x10\x18\x10\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x7E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "F",38 
+    "G":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x13\x70\x1C\x10\x10\x18\x10\x0C\x20\x0C\x20\x04\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\xFC\x06\x30\x06\x30\x0C\x30\x0C\x30\x18\x30\x18\x30\x30\x08\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "G",39 
+    "H":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x7E\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\xFC\x1F\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x3F\x7E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "H",40 
+    "I":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x1F\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xF8\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "I",41 
+    "J":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x7F\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x00\x06\x0E\x06\x0E\x03\x8E\x01\xFC\x00', # "J",42 
+    "K":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7E\x7C\x18\x18\x18\x08\x18\x04\x18\x06\x18\x02\x18\x01\x98\x01\x98\x01\xD8\x01\xB8\x03\x38\x03\x18\x07\x18\x06\x18\x0E\x18\x0C\x18\x1C\x18\x18\x18\x30\x18\x30\x7E\xFC\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "K",43 
+    "L":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7E\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x40\x18\x40\x18\x20\x18\x30\xFE\x3F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "L",44 
+    "M":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1F\xF8\x1C\x38\x1C\x38\x1C\x38\x1C\x3C\x34\x34\x34\x34\x34\x34\x34\x36\x74\x32\x64\x32\x64\x32\x64\x32\x64\x31\xC4\x31\xC4\x31\xC4\x31\xC4\x30\xC4\x30\x84\x30\x9F\xFC\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "M",45 
+    "N":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x1F\x7C\x1C\x10\x3C\x10\x34\x10\x34\x10\x74\x10\x64\x10\xE4\x10\xC4\x10\xC4\x11\x84\x11\x84\x13\x04\x13\x04\x17\x04\x16\x04\x1E\x04\x1C\x04\x1C\x04\x1C\x04\x18\x1F\x18\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "N",46 
+    "O":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x03\x30\x0C\x18\x18\x08\x10\x0C\x30\x0C\x30\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x0C\x20\x0C\x30\x08\x10\x18\x18\x30\x0C\xC0\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "O",47 
+    "P":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x0F\x18\x18\x18\x30\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x30\x18\x18\xF8\x0F\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x7E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "P",48 
+    "Q":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x03\x30\x0C\x18\x18\x0C\x10\x0C\x30\x0C\x20\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\x06\x60\xE4\x61\x2C\x33\x1C\x32\x18\x16\x30\x0E\xC0\x07\x00\x4C\x00\x7C\x00\x38\x00\x00\x00\x00', # "Q",49 
+    "R":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFE\x07\x18\x1C\x18\x38\x18\x30\x18\x30\x18\x30\x18\x30\x18\x18\x18\x0C\xF8\x07\x98\x03\x18\x03\x18\x07\x18\x06\x18\x06\x18\x0E\x18\x0C\x18\x0C\x18\x1C\x18\x18\x7E\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "R",50 
+    "S":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x27\x30\x38\x18\x30\x0C\x20\x0C\x20\x0C\x00\x0C\x00\x18\x00\x78\x00\xE0\x03\x80\x0F\x00\x1E\x00\x38\x00\x70\x00\x60\x04\x60\x04\x60\x08\x60\x18\x30\x38\x18\xC8\x0F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "S",51 
+    "T":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x3F\x8C\x21\x84\x61\x82\x41\x82\x41\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xE0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "T",52 
+    "U":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3F\x7C\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x0C\x10\x08\x08\x38\x04\xE0\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "U",53 
+    "V":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3E\xF8\x18\x20\x18\x20\x18\x20\x30\x10\x30\x10\x30\x10\x30\x10\x60\x08\x60\x08\x60\x08\xE0\x0C\xC0\x04\xC0\x04\xC0\x04\x80\x03\x80\x03\x80\x03\x80\x03\x00\x01\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "V",54 
+    "W":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xDF\xF3\x86\x61\x86\x21\x86\x21\x8C\x21\x0C\x21\x8C\x23\x8C\x13\x8C\x13\x8C\x13\x4C\x13\x58\x12\x58\x16\x58\x0E\x38\x0E\x38\x0E\x38\x0E\x30\x0C\x10\x04\x10\x04\x10\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "W",55 
+    "X":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7E\x3E\x18\x08\x38\x08\x30\x04\x30\x04\x70\x02\x60\x02\xE0\x01\xC0\x01\xC0\x01\x80\x01\x80\x03\x40\x03\x40\x07\x20\x06\x20\x06\x10\x0C\x10\x0C\x08\x18\x08\x18\x3E\x7C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "X",56 
+    "Y":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7E\x7C\x1C\x10\x18\x10\x18\x08\x30\x08\x30\x0C\x70\x04\x60\x04\x60\x02\xC0\x02\xC0\x02\xC0\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xE0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "Y",57 
+    "Z":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF8\x3F\x18\x18\x08\x18\x04\x0C\x04\x0E\x00\x06\x00\x07\x00\x03\x80\x03\x80\x01\xC0\x01\xC0\x00\xE0\x00\x60\x00\x70\x00\x30\x00\x38\x20\x18\x20\x1C\x10\x0C\x18\xFE\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "Z",58 
+    "[":b'\x00\x00\x00\x00\x00\x00\xC0\x3F\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\x40\x00\xC0\x3F\x00\x00\x00\x00', # "[",59 
+    "\\":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x08\x00\x18\x00\x18\x00\x10\x00\x30\x00\x20\x00\x60\x00\x60\x00\x40\x00\xC0\x00\x80\x00\x80\x01\x80\x01\x00\x01\x00\x03\x00\x02\x00\x06\x00\x06\x00\x04\x00\x0C\x00\x08\x00\x18\x00\x18\x00\x10\x00\x30\x00\x20\x00\x00', # "\",60 
+    "]":b'\x00\x00\x00\x00\x00\x00\xFC\x03\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\x00\x02\xFC\x03\x00\x00\x00\x00', # "]",61 
+    "^":b'\x00\x00\x00\x00\x00\x00\x80\x07\xC0\x06\x20\x08\x10\x10\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "^",62 
+    "_":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFF\xFF', # "_",63 
+    "`":b'\x00\x00\x00\x00\x00\x00\x78\x00\xC0\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "`",64 
+    "a":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xF0\x03\x18\x06\x0C\x0C\x0C\x0C\x00\x0C\x80\x0F\x70\x0C\x1C\x0C\x0C\x0C\x06\x0C\x06\x0C\x06\x4C\x0C\x4F\xF8\x38\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "a",65 
+    "b":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x1E\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x0F\xD8\x18\x38\x30\x38\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x20\x38\x30\x78\x18\xC8\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "b",66 
+    "c":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x07\x70\x0C\x18\x18\x18\x18\x0C\x18\x0C\x00\x0C\x00\x0C\x00\x0C\x00\x0C\x20\x18\x20\x18\x10\x30\x08\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "c",67 
+    "d":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x1E\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\xE0\x1B\x30\x1C\x18\x18\x18\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x0C\x18\x08\x18\x18\x1C\x30\x7A\xE0\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "d",68 
+    "e":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x07\x30\x0C\x18\x18\x08\x10\x0C\x30\x0C\x30\xFC\x3F\x0C\x00\x0C\x00\x0C\x00\x18\x20\x18\x10\x70\x18\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "e",69 
+    "f":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x3E\x80\xC3\x80\xC0\xC0\xC0\xC0\x00\xC0\x00\xC0\x00\xFC\x1F\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xF8\x0F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "f",70 
+    "g":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x77\x30\x6C\x10\x18\x18\x18\x18\x18\x18\x18\x10\x18\x30\x0C\xF0\x07\x18\x00\x18\x00\xF0\x0F\xF0\x3F\x08\x70\x0C\x60\x0C\x60\x0C\x60\x38\x38\xE0\x0F', # "g",71 
+    "h":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x1E\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x98\x0F\xD8\x18\x38\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x7E\xFC\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "h",72 
+    "i":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x03\x80\x03\x80\x03\x00\x00\x00\x00\x00\x00\x00\x01\xF8\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xF8\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "i",73 
+    "j":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x38\x00\x38\x00\x38\x00\x00\x00\x00\x00\x00\x00\x10\x80\x1F\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x18\x0C\x18\x06\xF0\x03', # "j",74 
+    "k":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x1E\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x00\x18\x3E\x18\x0C\x18\x06\x18\x03\x18\x01\x98\x01\xD8\x01\x38\x03\x18\x07\x18\x06\x18\x0C\x18\x1C\x18\x18\x7E\x7C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "k",75 
+    "l":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\xF8\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\x80\x01\xF8\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "l",76 
+    "m":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x08\x00\xEE\x1C\x9C\x33\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\x8C\x31\xDE\x7B\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "m",77 
+    "n":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x1E\x0F\xD8\x18\x38\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x7E\xFC\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "n",78 
+    "o":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x07\x70\x1C\x10\x30\x18\x30\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x0C\x60\x18\x30\x18\x30\x30\x18\xC0\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "o",79 
+    "p":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x00\x9E\x0F\x58\x18\x38\x30\x18\x20\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x60\x18\x30\x38\x30\x78\x18\x98\x07\x18\x00\x18\x00\x18\x00\x18\x00\x7E\x00', # "p",80 
+    "q":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xC0\x23\x30\x3C\x18\x38\x18\x30\x0C\x30\x0C\x30\x0C\x30\x0C\x30\x0C\x30\x0C\x30\x08\x30\x18\x38\x30\x3C\xE0\x33\x00\x30\x00\x30\x00\x30\x00\x30\x00\xFC', # "q",81 
+    "r":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x60\x00\x7E\x3C\x60\x66\x60\x61\xE0\x00\xE0\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\x60\x00\xFE\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "r",82 
+    "s":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xE0\x27\x30\x38\x18\x30\x18\x20\x18\x00\x70\x00\xE0\x03\x80\x0F\x00\x1C\x04\x30\x04\x30\x0C\x30\x1C\x18\xEC\x0F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "s",83 
+    "t":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x00\x80\x00\x80\x00\xC0\x00\xE0\x00\xFC\x1F\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x00\xC0\x20\xC0\x20\x80\x11\x00\x0F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "t",84 
+    "u":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x10\x20\x1E\x3C\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\x38\x30\xF4\xE0\x13\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "u",85 
+    "v":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7E\x3C\x18\x18\x18\x08\x38\x08\x30\x04\x30\x04\x70\x02\x60\x02\x60\x02\xE0\x01\xC0\x01\xC0\x01\xC0\x00\x80\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "v",86 
+    "w":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xDF\xF7\x8E\x63\x0C\x23\x8C\x23\x8C\x23\x98\x13\x98\x13\x58\x16\x58\x16\x70\x0E\x70\x0E\x70\x0E\x20\x04\x20\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "w",87 
+    "x":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x3E\x70\x08\x70\x04\xE0\x04\xC0\x02\xC0\x01\x80\x03\x80\x03\x40\x07\x60\x06\x20\x0C\x10\x0C\x18\x18\x3E\x7E\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "x",88 
+    "y":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x7E\x7C\x18\x18\x18\x08\x30\x08\x30\x08\x30\x04\x60\x04\x60\x04\xC0\x02\xC0\x02\xC0\x02\x80\x01\x80\x01\x80\x01\x80\x00\x80\x00\x80\x00\x4C\x00\x3C\x00', # "y",89 
+    "z":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xFC\x1F\x0C\x0C\x04\x0E\x04\x06\x00\x03\x80\x03\x80\x01\xC0\x00\xE0\x00\x70\x20\x30\x20\x38\x30\x1C\x18\xFC\x1F\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "z",90 
+    "{":b'\x00\x00\x00\x00\x00\x00\x00\x30\x00\x08\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x02\x80\x01\x00\x02\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x04\x00\x08\x00\x30\x00\x00', # "{",91 
+    "|":b'\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01\x00\x01', # "|",92 
+    "}":b'\x00\x00\x00\x00\x00\x00\x0C\x00\x10\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x40\x00\x80\x01\x40\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x20\x00\x10\x00\x0C\x00\x00\x00', # "}",93 
+    "~":b'\x00\x00\x38\x00\xC4\x00\x86\x40\x02\x61\x00\x22\x00\x1C\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00', # "~",94 
+    "浦":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x08\x00\x00\x00\xF8\x01\x30\x00\x08\x07\xE0\x00\x08\x06\xC0\x00\x08\x1C\xC0\xFC\xFF\x3F\x80\x00\x08\x00\x00\x04\x08\x00\x04\x02\x08\x00\x18\x02\x08\x00\x38\xF2\xFF\x1F\x30\x31\x08\x0C\x30\x31\x08\x0C\x20\x31\x08\x0C\x80\xF0\xFF\x0F\x80\x30\x08\x0C\xC0\x30\x08\x0C\x40\x30\x08\x0C\x40\x30\x08\x0C\x60\xF0\xFF\x0F\x7C\x30\x08\x0C\x30\x30\x08\x0C\x30\x30\x08\x0C\x30\x30\x08\x0C\x30\x30\x08\x0C\x30\x30\x08\x0C\x30\x30\x88\x0F\x30\x30\x08\x06\x00\x10\x00\x02\x00\x00\x00\x00', # "浦",95
+    "洋":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x20\x80\x00\x10\x40\x80\x03\x60\xC0\x81\x01\xC0\x80\xC3\x00\xC0\x01\x43\x00\x80\x00\x43\x00\x80\x00\x20\x0C\x00\xFC\xFF\x1F\x00\x04\x18\x00\x0C\x04\x18\x00\x18\x02\x18\x00\x38\x02\x18\x00\x30\x02\x18\x06\x30\xF1\xFF\x0F\x00\x01\x18\x00\x00\x01\x18\x00\x80\x01\x18\x00\x80\x00\x18\x00\xC0\x00\x18\x18\xC0\xFC\xFF\x3F\x7C\x00\x18\x00\x70\x00\x18\x00\x60\x00\x18\x00\x60\x00\x18\x00\x60\x00\x18\x00\x60\x00\x18\x00\x70\x00\x18\x00\x60\x00\x18\x00\x00\x00\x08\x00\x00\x00\x00\x00', # "洋",96
+    "液":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x02\x00\x00\x00\x0C\x00\x30\x00\x18\x00\x60\x00\x18\x18\xE0\xFC\xFF\x1F\xC0\x80\x00\x00\xC0\x84\x31\x00\x00\xC4\x30\x00\x00\xC2\x30\x00\x04\x62\x18\x04\x18\x62\xF8\x0F\x38\x21\x08\x0C\x30\x31\x0C\x04\x30\x79\x34\x06\x80\x38\x66\x06\x80\x34\x46\x02\x80\x34\x4B\x03\xC0\x32\x09\x03\x40\xB1\x08\x01\x60\x30\x90\x01\x7C\x30\xB0\x00\x70\x30\xE0\x00\x30\x30\xE0\x00\x30\x30\xF0\x01\x30\x30\x98\x03\x30\x30\x0C\x0F\x30\x30\x06\x7E\x30\x30\x01\x18\x00\xF0\x00\x00\x00\x00\x00\x00', # "液",97
+    "晶":b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x02\x80\x00\x00\xFE\xFF\x01\x00\x06\xC0\x00\x00\x06\xC0\x00\x00\x06\xC0\x00\x00\xFE\xFF\x00\x00\x06\xC0\x00\x00\x06\xC0\x00\x00\x06\xC0\x00\x00\x06\xC0\x00\x00\xFE\xFF\x00\x00\x06\xC0\x00\x00\x06\x40\x00\x00\x00\x00\x00\x10\x20\x04\x08\xF0\x7F\xFC\x1F\x30\x30\x0C\x08\x30\x30\x0C\x08\x30\x30\x0C\x08\x30\x30\x0C\x08\xF0\x3F\xFC\x0F\x30\x30\x0C\x08\x30\x30\x0C\x08\x30\x30\x0C\x08\x30\x30\x0C\x08\x30\x30\x0C\x08\xF0\x3F\xFC\x0F\x30\x30\x0C\x08\x10\x00\x04\x00\x00\x00\x00\x00', # "晶",98
 }
@@ -3,6 +3,107 @@ import time
 from machine import Pin, SPI
 from lcd_def import *
 import struct
+import micropython
+
+try:
+    import _lcd  # 固件中编译了usermod/lcd时，绘图由PicoSDK工程的C库完成
+except ImportError:
+    _lcd = None
+
+# LCD类的方法 -> _lcd中参数相同的C函数
+_NATIVE = (
+    ('lcd_Fill', 'fill'),
+    ('LCD_DrawPoint', 'point'),
+    ('LCD_DrawLine', 'line'),
+    ('LCD_DrawRectangle', 'rect'),
+    ('Draw_Circle', 'circle'),
+    ('LCD_FillCircle', 'fill_circle'),
+    ('gui_draw_hline', 'gui_hline'),
+    ('gui_draw_hline_batch', 'gui_hline'),
+    ('gui_fill_circle', 'gui_fill_circle'),
+    ('LCD_DrawThickLine', 'thick_line'),
+    ('DrawThickLine', 'thick_line_square'),
+    ('blit_buffer', 'blit'),
+    ('map_bitarray_to_rgb565', 'map_bitarray'),
+    ('show_text', 'text'),
+)
+
+
+@micropython.viper
+def _bgr888_to_rgb666(src: ptr8, dst: ptr8, width: int, rows: int, row_size: int):
+    # rows行BGR888像素（每行row_size字节，含4字节对齐填充）转换为屏幕的R、G、B三字节
+    d = 0
+    for r in range(rows):
+        s = r * row_size
+        for i in range(width):
+            dst[d] = src[s + 2]
+            dst[d + 1] = src[s + 1]
+            dst[d + 2] = src[s]
+            s += 3
+            d += 3
+
+
+@micropython.viper
+def _rgb565_to_rgb666(src: ptr8, dst: ptr8, width: int, rows: int, row_size: int):
+    # rows行小端RGB565像素展开为屏幕的R、G、B三字节
+    d = 0
+    for r in range(rows):
+        s = r * row_size
+        for i in range(width):
+            c = src[s] | (src[s + 1] << 8)
+            dst[d] = (c >> 8) & 0xF8
+            dst[d + 1] = (c >> 3) & 0xFC
+            dst[d + 2] = (c << 3) & 0xFF
+            s += 2
+            d += 3
+
+
+@micropython.viper
+def _fill_rgb666(dst: ptr8, count: int, color: int):
+    # 在dst中写入count个像素，RGB565颜色展开为屏幕的R、G、B三字节
+    r = (color >> 8) & 0xF8
+    g = (color >> 3) & 0xFC
+    b = (color << 3) & 0xFF
+    d = 0
+    for i in range(count):
+        dst[d] = r
+        dst[d + 1] = g
+        dst[d + 2] = b
+        d += 3
+
+
+@micropython.viper
+def _map_bits_rgb666(src: ptr8, n: int, dst: ptr8, size: int, width: int, fc: int, bc: int) -> int:
+    # n字节位数据（低位在前，每行width像素，行末多余的位丢弃）转换为R、G、B三字节像素，
+    # 写入dst的前size字节，返回写入的字节数，dst不够时返回-1
+    fr = (fc >> 8) & 0xF8
+    fg = (fc >> 3) & 0xFC
+    fb = (fc << 3) & 0xFF
+    br = (bc >> 8) & 0xF8
+    bg = (bc >> 3) & 0xFC
+    bb = (bc << 3) & 0xFF
+    d = 0
+    col = 0
+    for i in range(n):
+        byte = src[i]
+        for bi in range(8):
+            if d + 3 > size:
+                return -1
+            if byte & (1 << bi):
+                dst[d] = fr
+                dst[d + 1] = fg
+                dst[d + 2] = fb
+            else:
+                dst[d] = br
+                dst[d + 1] = bg
+                dst[d + 2] = bb
+            d += 3
+            col += 1
+            if col >= width:
+                col = 0
+                break
+    return d
+
 
 class LCD:
     def __init__(self, spi, csp=5, dcp=1, rstp=0, backlightp=6, width=SCREEN_WIDTH, height=SCREEN_HEIGHT, rotation=0):
@@ -21,7 +122,32 @@ class LCD:
         self.width = width        # 保存显示屏宽度
         self.height = height      # 保存显示屏高度
         self.rotation = rotation  # 保存初始旋转方向
-        self.init()  # 调用初始化方法，执行硬件启动序列
+        # 发送命令、地址和颜色的缓冲区只分配一次，绘图时不再申请内存
+        self._cmd = bytearray(1)
+        self._addr = bytearray(4)
+        self._px = bytearray(3)
+        self._fill = bytearray(MAX_BUFFER_SIZE * 3)  # fill_color_buffer整块发送的颜色数据
+        self._fill_color = -1  # _fill中当前的颜色
+        # _fill的前MAX_BUFFER_SIZE/2、/4……1个像素，不足一块的部分按2的幂拆开发送
+        self._fill_views = []
+        n = MAX_BUFFER_SIZE // 2
+        while n:
+            self._fill_views.append(memoryview(self._fill)[:n * 3])
+            n //= 2
+        self._glyph = bytearray(0)  # show_text的字模颜色数据，按最大的字增大
+        self._glyph_views = {}  # 字节数 -> _glyph的前若干字节
+        # 固件带_lcd模块且屏幕、方向和引脚都与之相同时，由C库初始化并绘图，
+        # 其余方法的命令和数据经_lcd.write发送，与C库共用同一个DMA通道
+        self.native = (_lcd is not None and
+                       (width, height, rotation) == (_lcd.WIDTH, _lcd.HEIGHT, _lcd.ROTATION) and
+                       (csp, dcp, rstp, backlightp) == (_lcd.CS, _lcd.DC, _lcd.RES, _lcd.BLK))
+        if self.native:
+            _lcd.init()
+            self.spi = _lcd
+            for name, func in _NATIVE:
+                setattr(self, name, getattr(_lcd, func))
+        else:
+            self.init()  # 调用初始化方法，执行硬件启动序列
 
     def hard_reset(self):
         """
@@ -33,29 +159,43 @@ class LCD:
         time.sleep_ms(100)  # 延迟100毫秒，等待显示屏稳定
 
     def LCD_WR_REG(self,dat):
+        self._cmd[0] = dat
         self.dc(0)
         self.cs(0)
-        self.spi.write(bytearray([dat]))
+        self.spi.write(self._cmd)
         self.cs(1)
         self.dc(1)
     
     def LCD_WR_DATA8(self,dat):
+        self._cmd[0] = dat
         self.cs(0)
-        self.spi.write(bytearray([dat]))
+        self.spi.write(self._cmd)
         self.cs(1)
     
     def LCD_Address_Set(self,x1, y1, x2, y2):
-        self.LCD_WR_REG(0x2a) #列地址设置
-        self.LCD_WR_DATA8(x1>>8 )
-        self.LCD_WR_DATA8(x1& 0xFF )
-        self.LCD_WR_DATA8(x2>>8 )
-        self.LCD_WR_DATA8(x2& 0xFF )
-        self.LCD_WR_REG(0x2b) #行地址设置
-        self.LCD_WR_DATA8(y1>>8)
-        self.LCD_WR_DATA8(y1& 0xFF)
-        self.LCD_WR_DATA8(y2>>8)
-        self.LCD_WR_DATA8(y2& 0xFF)
-        self.LCD_WR_REG(0x2c) #储存器写
+        # 三条命令和参数在一次片选内发送，只切换DC
+        a = self._addr
+        self.cs(0)
+        self.dc(0)
+        self.spi.write(b'\x2a') #列地址设置
+        a[0] = x1 >> 8
+        a[1] = x1 & 0xFF
+        a[2] = x2 >> 8
+        a[3] = x2 & 0xFF
+        self.dc(1)
+        self.spi.write(a)
+        self.dc(0)
+        self.spi.write(b'\x2b') #行地址设置
+        a[0] = y1 >> 8
+        a[1] = y1 & 0xFF
+        a[2] = y2 >> 8
+        a[3] = y2 & 0xFF
+        self.dc(1)
+        self.spi.write(a)
+        self.dc(0)
+        self.spi.write(b'\x2c') #储存器写
+        self.dc(1)
+        self.cs(1)
     
     def init(self):
         self.hard_reset()
@@ -173,55 +313,46 @@ class LCD:
      
     def fill_color_buffer(self, color: int, length: int):
         """
-        向显示屏缓冲区缓冲区填充指定颜色的像素数据。）
+        发送length字节的color颜色像素数据，调用前需已拉低片选、拉高DC。
+        颜色数据保存在预分配的缓冲区中，颜色不变时不再重新生成。
         """
-        #buffer_pixel_size = 512  # 每个缓冲区包含256个像素
-        # 计算完整块（512字节）数量和剩余字节数
-        chunks, rest = divmod(length, MAX_BUFFER_SIZE * 3)
-        
-        # 将16位颜色值转换为大端序2字节数据
-        # pixel = struct.pack('>H', color)
-        # 生成256像素的缓冲区（256 * 2 = 512字节）
-        buffer = color * MAX_BUFFER_SIZE  # 结果为字节数组
+        buffer = self._fill
+        if color != self._fill_color:
+            _fill_rgb666(buffer, MAX_BUFFER_SIZE, color)
+            self._fill_color = color
         
         # 传输所有完整块
-        if chunks:
-            for count in range(chunks):
-                self.spi.write(buffer)
-        
-        # 传输剩余字节（不足512字节的部分）
-        if rest:
-            # 按剩余字节数生成数据（每个像素2字节，故需重复rest#2次）
-            self.spi.write(color * (rest // 3))
+        chunks, rest = divmod(length, len(buffer))
+        for count in range(chunks):
+            self.spi.write(buffer)
+        
+        # 剩余不足一块的部分按2的幂拆开，从缓冲区开头发送
+        for view in self._fill_views:
+            while rest >= len(view):
+                self.spi.write(view)
+                rest -= len(view)
      
     def lcd_Fill(self,xsta, ysta, xend, yend, color):
         self.LCD_Address_Set(xsta, ysta, xend, yend) # 设置显示范围
-        # 准备颜色数据 (高位在前)
         width = xend-xsta+1
         height = yend-ysta+1
         
-        r = (color >> 8) & 0xF8
-        g = (color >> 3) & 0xFC
-        b = (color << 3) & 0xFF 
-        color_buffer = bytes([r, g, b])  
-        
-        #color_buffer = bytes([(color >> 8) & 0xF8,(color >> 3) & 0xFC,(color << 3)])
         self.cs(0)
         self.dc(1)
-        self.fill_color_buffer(color_buffer,width*height*3)
+        self.fill_color_buffer(color,width*height*3)
         
         self.cs(1)
         
     def LCD_DrawPoint(self,x,y,color):
     
         self.LCD_Address_Set(x,y,x,y) #设置光标位置
-        r = (color >> 8) & 0xF8
-        g = (color >> 3) & 0xFC
-        b = (color << 3) & 0xFF 
-        color_buffer = bytes([r, g, b]) 
+        pixel = self._px
+        pixel[0] = (color >> 8) & 0xF8
+        pixel[1] = (color >> 3) & 0xFC
+        pixel[2] = (color << 3) & 0xFF
         self.cs(0)  # 拉低片选信号，选中显示屏
         self.dc(1)  # 拉高DC信号，标识传输数据
-        self.spi.write(color_buffer)  # 发送像素颜色数据
+        self.spi.write(pixel)  # 发送像素颜色数据
         self.cs(1)  # 拉高片选信号，结束传输
             
     def LCD_DrawLine(self,x1, y1, x2, y2, color):
@@ -297,24 +428,10 @@ class LCD:
         # 2. 设置显示窗口：仅需一次窗口配置（避免逐点重复设置）
         self.LCD_Address_Set(x_start, y0, x_end, y0)
         
-        # 3. 生成批量颜色数据（RGB565格式，每个像素2字节）
-        pixel_count = x_end - x_start + 1
-        # 预计算颜色的高低字节（避免循环内重复移位）
-        color_r = (color >> 8) & 0xF8
-        color_g = (color >> 3) & 0xFC
-        color_b = (color << 3)
-        
-        # 4. 批量生成数据：用bytearray预分配内存（比循环append快3倍）
-        batch_data = bytearray(pixel_count * 3)
-        for i in range(pixel_count):
-            batch_data[i*3] = color_r
-            batch_data[i*3 + 1] = color_g
-            batch_data[i*3 + 2] = color_b
-        
-        # 5. 单次SPI传输：减少cs切换和函数调用开销
+        # 3. 颜色数据来自fill_color_buffer的预分配缓冲区，不再逐像素生成
         self.cs(0)
         self.dc(1)
-        self.spi.write(batch_data)
+        self.fill_color_buffer(color, (x_end - x_start + 1) * 3)
         self.cs(1)
         
     def gui_fill_circle(self, x0, y0, r, color):
@@ -328,14 +445,15 @@ class LCD:
         y_min = max(y0 - r, 0)
         y_max = min(y0 + r, self.height - 1)
         
-        
+        x_half = 0
         for y in range(y_min, y_max + 1):
             dy = y-y0
-            dy_sq = dy * dy
-            if dy_sq > r_sq:
-                continue  # 超出圆范围，跳过当前y
-            # 整数平方根优化
-            x_half = int((r_sq - dy_sq) ** 0.5)  # 简化为整数
+            lim = r_sq - dy * dy
+            # 整数平方根：相邻两行的半宽相差不大，从上一行的值增减，不用浮点运算
+            while x_half * x_half > lim:
+                x_half -= 1
+            while (x_half + 1) * (x_half + 1) <= lim:
+                x_half += 1
             # 计算当前y的水平绘制范围
             x_start = x0 - x_half
             length = 2 * x_half + 1  # 水平像素个数
@@ -476,7 +594,7 @@ class LCD:
         将缓冲区数据块复制到显示屏的指定区域。
         
         参数:
-            buffer (bytearray): 待绘制的像素数据缓冲区（需为RGB565格式的字节序列）
+            buffer (bytearray): 待绘制的像素数据缓冲区（需为RGB666格式的字节序列）
             x (int): 目标区域左上角的X坐标
             y (int): 目标区域左上角的Y坐标
             width (int): 目标区域的宽度（像素）
@@ -495,70 +613,36 @@ class LCD:
         self.cs(0)  # 拉低片选信号，选中显示屏
         self.dc(1)  # 拉高DC信号，标识传输数据
         
-        buffer_size = 512  # 每次SPI传输的最大字节数（分块大小）
-        # 计算有效数据长度（不超过缓冲区大小，且不超过区域所需的总像素字节数）
+        # 有效数据长度（不超过缓冲区大小，且不超过区域所需的总像素字节数）
         limit = min(len(buffer), width * height * 3)
-        # 计算完整块数量和剩余字节数
-        chunks, rest = divmod(limit, buffer_size)
-        
-        # 传输所有完整的数据块
-        if chunks:
-            for i in range(chunks):
-                self.spi.write(buffer[i*buffer_size: (i+1)*buffer_size])
-        
-        # 传输剩余不足一块的数据
-        if rest:
-            self.spi.write(buffer[chunks*buffer_size: chunks*buffer_size + rest])
+        # 整块一次发送，缓冲区比区域大时只取前limit字节，不复制数据
+        if limit == len(buffer):
+            self.spi.write(buffer)
+        else:
+            self.spi.write(memoryview(buffer)[:limit])
         
         self.cs(1)  # 拉高片选信号，结束传输
     
     
     def map_bitarray_to_rgb565(self, bitarray, buffer, width, color, bg_color):
         """
-        将位数组（bitarray）转换为RGB565格式的颜色缓冲区，适用于后续的blit绘制操作。
+        将位数组（bitarray）转换为RGB666格式的颜色缓冲区，适用于后续的blit绘制操作。
 
         参数:
             bitarray: 输入的位数据数组，每个字节包含8个像素的位信息（1字节=8像素）
-            buffer: 输出的RGB565格式缓冲区（字节数组），用于存储转换后的像素数据
+            buffer: 输出的RGB666格式缓冲区（字节数组），用于存储转换后的像素数据
             width: 每行的像素宽度，超过该宽度时自动换行
             color (int): 位值为1时的像素颜色（RGB565格式）
             bg_color (int): 位值为0时的像素颜色（RGB565格式）
         """
-        row_pos = 0  # 跟踪当前行的像素位置，用于控制换行
-        length = len(bitarray)  # 位数组的总字节数
-        id = 0  # 输出缓冲区的索引，用于定位当前写入位置
-
-        # 遍历位数组中的每个字节
-        for i in range(length):
-            byte = bitarray[i]  # 获取当前字节（包含8个像素的位信息）
-            
-            # 按从高位到低位（bit7到bit0）的顺序处理每个位
-            for bi in range(0, 8, 1):
-                # 提取当前位的值（1或0）
-                b = byte & (1 << bi)
-                
-                # 根据位值选择对应的颜色
-                cur_color = color if b else bg_color
-                
-                # 将RGB565颜色拆分为高8位和低8位，存入缓冲区
-                buffer[id] = (cur_color >> 8) & 0xF8 
-                id += 1
-                buffer[id] = (cur_color >> 3) & 0xFC      
-                id += 1
-                buffer[id] = (cur_color << 3)      
-                id += 1                
-                # 更新当前行的像素位置
-                row_pos += 1
-                
-                # 若当前行像素数达到指定宽度，换行（重置行位置并跳出当前字节的循环）
-                if row_pos >= width:
-                    row_pos = 0
-                    break
+        # 逐位转换在viper函数中完成
+        if _map_bits_rgb666(bitarray, len(bitarray), buffer, len(buffer), width, color, bg_color) < 0:
+            raise ValueError("缓冲区太小")
     
     
     def show_text(self, x: int, y: int, num: str, fc:int,bc:int,sizey:int):
         """
-        在LCD上显示单个ASCII字符
+        在LCD上显示ASCII字符串
         
         参数:
             x (int): 显示起始X坐标
@@ -568,9 +652,17 @@ class LCD:
             bc (int): 背景颜色（RGB565格式）
             sizey (int): 字符高度（支持12、16、24、32）
         """
-
-
-        blitable = []
+        # 根据字号选择对应的字库
+        if sizey == 12:
+            font = ascii_1206  # 6x12字体库
+        elif sizey == 16:
+            font = ascii_1608  # 8x16字体库
+        elif sizey == 24:
+            font = ascii_2412  # 12x24字体库
+        elif sizey == 32:
+            font = ascii_3216  # 16x32字体库
+        else:
+            return  # 不支持的字号
 
         for sprite_bitmap in num:
             if ord(sprite_bitmap)<128:
@@ -579,92 +671,128 @@ class LCD:
             else:
                 sizex = sizey
 
-            # 计算单个字符所占字节数：(宽度/8向上取整) * 高度
-            typeface_num = (sizex // 8 + (1 if sizex % 8 else 0)) * sizey
-            # 根据字号选择对应的字库
-            if sizey == 12:
-                temp = ascii_1206[sprite_bitmap]  # 6x12字体库
-            elif sizey == 16:
-                temp = ascii_1608[sprite_bitmap]  # 8x16字体库
-            elif sizey == 24:
-                temp = ascii_2412[sprite_bitmap]  # 12x24字体库
-            elif sizey == 32:
-                temp = ascii_3216[sprite_bitmap]  # 16x32字体库
-            else:
-                return  # 不支持的字号
-
-            sprite = bytearray(typeface_num*8*3) #存储字符颜色
-
-            self.map_bitarray_to_rgb565(temp,sprite,sizex,fc,bc)
-            blitable.append(sprite)
-            
-        for i in range(0, len(blitable)):
-            self.blit_buffer(blitable[i], x+sizex*i, y, sizex, sizey)
+            # 每个字符转换到同一块缓冲区后立即显示，不为每个字符分配内存
+            size = sizex * sizey * 3
+            sprite = self._glyph_views.get(size)
+            if sprite is None:
+                if len(self._glyph) < size:
+                    self._glyph = bytearray(size)
+                    self._glyph_views = {}
+                sprite = memoryview(self._glyph)[:size]
+                self._glyph_views[size] = sprite
+
+            self.map_bitarray_to_rgb565(font[sprite_bitmap],sprite,sizex,fc,bc)
+            self.blit_buffer(sprite, x, y, sizex, sizey)
+            x += sizex
             
     
-    def LCD_ShowPicture(self, filename, x: int, y: int, chunk_size=MAX_BUFFER_SIZE):    
-        chunk_size = chunk_size  * 3
-        
+    def LCD_Set_Scan(self, bottom_up):
+        """
+        设置写显存时的行方向，竖屏时翻转0x36寄存器的MY位。
+        翻转后窗口的行地址y对应屏幕第height-1-y行，可按BMP文件顺序（最下一行在前）整窗发送。
+
+        参数:
+            bottom_up (bool): True为从下到上，False恢复init()的设置
+        返回:
+            bool: 横屏时不支持，返回False
+        """
+        if self.rotation == 0:
+            madctl = 0x48
+        elif self.rotation == 1:
+            madctl = 0x88
+        else:
+            return False  # 横屏时行地址对应显存的列，不做翻转
+        self.LCD_WR_REG(0x36)
+        self.LCD_WR_DATA8(madctl ^ 0x80 if bottom_up else madctl)  # 与init()中0x36的设置一致
+        return True
+
+    def LCD_ShowPicture(self, filename, x: int, y: int, chunk_size=MAX_BUFFER_SIZE):
+        """
+        显示BMP图片，支持24位（BGR888）和16位（RGB565，BI_BITFIELDS）未压缩格式。
+        文件头只解析一次，像素按整行读入同一块缓冲区，由viper函数转换后整块发送。
+        默认的倒序存放（最下一行在前）在竖屏时用LCD_Set_Scan翻转行方向，只设一次窗口；
+        横屏时逐行设置窗口。
+
+        参数:
+            filename (str): BMP文件路径
+            x (int): 显示起始X坐标
+            y (int): 显示起始Y坐标
+            chunk_size (int): 每次读取约chunk_size*3字节（至少一行）
+        """
+        if self.native:
+            # C库逐行读取转换，超出屏幕的部分裁掉
+            with open(filename, 'rb') as f:
+                _lcd.bmp(f, x, y)
+            return
+
         with open(filename, 'rb') as f:
             header = f.read(54)
-            
+
             if len(header) != 54 or header[0:2] != b'BM':
                 raise ValueError("不是有效的BMP文件")
-    
+
             data_offset = struct.unpack('<I', header[10:14])[0]  # 像素数据起始偏移量（跳过文件头）
-            width = struct.unpack('<I', header[18:22])[0]        # 图片宽度（像素）
-            height = struct.unpack('<I', header[22:26])[0]       # 图片高度（像素，负值表示"上下颠倒存储"）
-            bpp = struct.unpack('<H', header[28:30])[0]          # 色深（每像素位数）
-    
-            #判断图像位深是否为24位
-            if bpp != 24:
-                raise ValueError("仅支持24位色深的BMP文件")
-            
-    
-            # 计算每行像素占用的字节数(24位BMP)
-            row_size = (width * 3 + 3) & ~3  # 4字节对齐
+            width, height = struct.unpack('<ii', header[18:26])  # 图片宽高（像素，高度为负表示从最上一行开始存储）
+            bpp, compression = struct.unpack('<HI', header[28:34])  # 色深（每像素位数）和压缩方式
+
+            if bpp == 24 and compression == 0:
+                convert = _bgr888_to_rgb666
+            elif bpp == 16 and compression == 3 and struct.unpack('<III', f.read(12)) == (0xF800, 0x07E0, 0x001F):
+                convert = _rgb565_to_rgb666  # 掩码紧跟40字节信息头
+            else:
+                raise ValueError("仅支持24位或RGB565格式的16位BMP文件")
+
+            bottom_up = height > 0
+            height = abs(height)
+            # 计算每行像素占用的字节数（4字节对齐）
+            row_size = (width * bpp // 8 + 3) & ~3
             # 校验目标区域是否在显示屏有效范围内
             if (not 0 <= x < self.width or
                 not 0 <= y < self.height or
                 not 0 < x + width <= self.width or
                 not 0 < y + height <= self.height):
                     raise ValueError("目标区域超出显示屏范围")
-    
-    
-            self.LCD_Address_Set(x, y, x + width - 1, y + height - 1)
+
+            line = width * 3  # 转换后每行字节数
+            rows = max(1, chunk_size * 3 // row_size)  # 每次读取的行数
+            src = bytearray(rows * row_size)
+            dst = bytearray(rows * line)
+            src_mv = memoryview(src)
+            dst_mv = memoryview(dst)
+
+            flip = bottom_up and self.LCD_Set_Scan(True)
+            if flip:
+                self.LCD_Address_Set(x, self.height - y - height, x + width - 1, self.height - 1 - y)
+            elif not bottom_up:
+                self.LCD_Address_Set(x, y, x + width - 1, y + height - 1)
             # 移动到像素数据起始位置
             f.seek(data_offset)
-    
-                # 计算总像素数据大小
-            total_data_size = abs(height) * row_size
+
+            y_row = y + height - 1  # 横屏倒序时下一行在屏幕上的位置
+            done = 0
             self.cs(0)  # 拉低片选信号，选中显示屏
             self.dc(1)  # 拉高DC信号，标识传输数据
-            # 分块读取并转换
-            bytes_read = 0
-            
-            while bytes_read < total_data_size:
-                # 计算当前块的实际大小
-                current_read  = min(chunk_size, total_data_size - bytes_read)
-                # 读取一块数据
-                chunk = f.read(current_read )     
-                # 处理当前块中的像素
-                #rgb565_chunk = bytearray(len(chunk)//3*2)
-                rgb565_chunk = bytearray(len(chunk))
-                id=0
-                for i in range(0,len(chunk),3):
-                    rgb565_chunk[id]=chunk[i+2]
-                    id += 1
-                    rgb565_chunk[id]=chunk[i+1]
-                    id += 1
-                    rgb565_chunk[id]=chunk[i]
-                    id += 1
-                self.spi.write(rgb565_chunk)
-                bytes_read += current_read
-
-            self.cs(1)  # 拉高片选信号，结束传输   
-    
-    
-    
+            while done < height:
+                n = min(rows, height - done)
+                f.readinto(src_mv[:n * row_size])
+                convert(src, dst, width, n, row_size)
+                if bottom_up and not flip:
+                    # 横屏时逐行设置窗口
+                    for i in range(n):
+                        self.LCD_Address_Set(x, y_row, x + width - 1, y_row)
+                        self.cs(0)
+                        self.spi.write(dst_mv[i * line:(i + 1) * line])
+                        y_row -= 1
+                else:
+                    self.spi.write(dst_mv[:n * line])
+                done += n
+
+            self.cs(1)  # 拉高片选信号，结束传输
+            if flip:
+                self.LCD_Set_Scan(False)
+
+
+
     def DrawColorBars(self):
         colors = [RED, GREEN, BLUE, YELLOW, CYAN, MAGENTA, BLACK, WHITE]
         for i in range(len(colors)):
@@ -0,0 +1,38 @@
+# _lcd: the PicoSDK driver core (PicoSDK/lcd_core) as a MicroPython module,
+# built for one panel project.
+# The panel defaults to P024C135, pick another one with
+#   make BOARD=RPI_PICO USER_C_MODULES=... CMAKE_ARGS=-DLCD_PANEL=P169H002
+# Pins, SPI port and rotation come from that project's Inc/lcd_init.h, the
+# init sequence from its Src/lcd_panel.c.
+set(LCD_PANEL P024C135 CACHE STRING "PicoSDK panel project compiled into the _lcd module")
+set(LCD_PANEL_DIR ${CMAKE_CURRENT_LIST_DIR}/../../../PicoSDK/${LCD_PANEL})
+set(LCD_CORE_DIR ${CMAKE_CURRENT_LIST_DIR}/../../../PicoSDK/lcd_core)
+if(NOT EXISTS ${LCD_PANEL_DIR}/Src/lcd_panel.c)
+    message(FATAL_ERROR "LCD_PANEL=${LCD_PANEL}: no such project under PicoSDK")
+endif()
+
+set(LCD_PANEL_SOURCES
+    ${LCD_PANEL_DIR}/Src/lcd_panel.c
+    ${LCD_CORE_DIR}/Src/lcd.c
+    ${LCD_CORE_DIR}/Src/lcd_init.c
+    ${LCD_CORE_DIR}/Src/lcd_dma.c
+    ${LCD_CORE_DIR}/Src/lcd_bmp.c
+)
+
+add_library(usermod_lcd INTERFACE)
+
+target_sources(usermod_lcd INTERFACE
+    ${CMAKE_CURRENT_LIST_DIR}/modlcd.c
+    ${LCD_PANEL_SOURCES}
+)
+
+# Panel first, so that "Inc/lcd_init.h" in the core resolves to the panel's header
+target_include_directories(usermod_lcd INTERFACE
+    ${LCD_PANEL_DIR}
+    ${LCD_CORE_DIR}
+)
+
+# The core sources are shared with the PicoSDK projects, which are not built with -Werror
+set_source_files_properties(${LCD_PANEL_SOURCES} PROPERTIES COMPILE_OPTIONS "-Wno-error")
+
+target_link_libraries(usermod INTERFACE usermod_lcd)
@@ -0,0 +1,342 @@
+/*
+ * _lcd: PicoSDK工程中的C绘图库编译进MicroPython固件后的模块.
+ * lcd.py的LCD类在import到_lcd且屏幕参数一致时,把画点、线、圆、填充、
+ * 文字和整块像素的方法换成这里参数相同的函数,其余方法的命令和数据
+ * 经_lcd.write由同一个DMA通道发送.
+ *
+ * 像素缓冲区通过mp_get_buffer直接交给DMA,不复制;每个函数返回前都等
+ * LCD_DMA_Wait(),之后Python可以立即修改缓冲区或切换DC引脚.
+ */
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "Inc/lcd.h"
+#include "Inc/lcd_dma.h"
+#include "Inc/lcd_bmp.h"
+
+#define ARG_INT(i) mp_obj_get_int(args[i])
+
+/******************************************************************************
+	  函数说明：初始化屏幕并打开背光
+	  入口数据：无
+	  返回值：  无
+	  说    明：引脚和SPI口固定为lcd_init.h中的定义,与LCD类的默认参数相同
+******************************************************************************/
+static mp_obj_t mod_lcd_init(void)
+{
+	LCD_Init();
+	LCD_BLK_Set();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(mod_lcd_init_obj, mod_lcd_init);
+
+/******************************************************************************
+	  函数说明：发送一段命令参数或像素数据,代替LCD类的spi.write
+	  入口数据：buf 任意支持缓冲区协议的对象
+	  返回值：  无
+	  说    明：DC由调用者设置
+******************************************************************************/
+static mp_obj_t mod_lcd_write(mp_obj_t buf_in)
+{
+	mp_buffer_info_t buf;
+
+	mp_get_buffer_raise(buf_in, &buf, MP_BUFFER_READ);
+	LCD_DMA_Write(buf.buf, buf.len);
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(mod_lcd_write_obj, mod_lcd_write);
+
+/* fill(x1, y1, x2, y2, color) 对应LCD.lcd_Fill */
+static mp_obj_t mod_lcd_fill(size_t n_args, const mp_obj_t *args)
+{
+	LCD_Fill(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3), ARG_INT(4));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_fill_obj, 5, 5, mod_lcd_fill);
+
+/* point(x, y, color) 对应LCD.LCD_DrawPoint */
+static mp_obj_t mod_lcd_point(mp_obj_t x, mp_obj_t y, mp_obj_t color)
+{
+	LCD_DrawPoint(mp_obj_get_int(x), mp_obj_get_int(y), mp_obj_get_int(color));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(mod_lcd_point_obj, mod_lcd_point);
+
+/* line(x1, y1, x2, y2, color) 对应LCD.LCD_DrawLine */
+static mp_obj_t mod_lcd_line(size_t n_args, const mp_obj_t *args)
+{
+	LCD_DrawLine(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3), ARG_INT(4));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_line_obj, 5, 5, mod_lcd_line);
+
+/* rect(x1, y1, x2, y2, color) 对应LCD.LCD_DrawRectangle */
+static mp_obj_t mod_lcd_rect(size_t n_args, const mp_obj_t *args)
+{
+	LCD_DrawRectangle(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3), ARG_INT(4));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_rect_obj, 5, 5, mod_lcd_rect);
+
+/* circle(x0, y0, r, color) 对应LCD.Draw_Circle */
+static mp_obj_t mod_lcd_circle(size_t n_args, const mp_obj_t *args)
+{
+	Draw_Circle(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_circle_obj, 4, 4, mod_lcd_circle);
+
+/* fill_circle(x0, y0, r, color) 对应LCD.LCD_FillCircle */
+static mp_obj_t mod_lcd_fill_circle(size_t n_args, const mp_obj_t *args)
+{
+	LCD_FillCircle(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_fill_circle_obj, 4, 4, mod_lcd_fill_circle);
+
+/* gui_hline(x0, y0, length, color) 对应LCD.gui_draw_hline和gui_draw_hline_batch,超出屏幕的部分裁掉 */
+static mp_obj_t mod_lcd_gui_hline(size_t n_args, const mp_obj_t *args)
+{
+	gui_draw_hline(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_gui_hline_obj, 4, 4, mod_lcd_gui_hline);
+
+/* gui_fill_circle(x0, y0, r, color) 对应LCD.gui_fill_circle */
+static mp_obj_t mod_lcd_gui_fill_circle(size_t n_args, const mp_obj_t *args)
+{
+	gui_fill_circle(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_gui_fill_circle_obj, 4, 4, mod_lcd_gui_fill_circle);
+
+/* thick_line(x1, y1, x2, y2, color, size) 对应LCD.LCD_DrawThickLine */
+static mp_obj_t mod_lcd_thick_line(size_t n_args, const mp_obj_t *args)
+{
+	LCD_DrawThickLine(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3), ARG_INT(4), ARG_INT(5));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_thick_line_obj, 6, 6, mod_lcd_thick_line);
+
+/* thick_line_square(x0, y0, x1, y1, thickness, color) 对应LCD.DrawThickLine */
+static mp_obj_t mod_lcd_thick_line_square(size_t n_args, const mp_obj_t *args)
+{
+	DrawThickLine(ARG_INT(0), ARG_INT(1), ARG_INT(2), ARG_INT(3), ARG_INT(4), ARG_INT(5));
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_thick_line_square_obj, 6, 6, mod_lcd_thick_line_square);
+
+/******************************************************************************
+	  函数说明：把一块像素发送到屏幕,对应LCD.blit_buffer
+	  入口数据：buffer 像素数据,格式与LCD.blit_buffer相同(每像素LCD_PIXEL_BYTES字节,高字节在前)
+				x,y 左上角坐标
+				width,height 区域大小
+	  返回值：  无
+	  说    明：区域超出屏幕时抛出ValueError;buffer不足一整块时只发送已有的数据
+******************************************************************************/
+static mp_obj_t mod_lcd_blit(size_t n_args, const mp_obj_t *args)
+{
+	mp_buffer_info_t buf;
+	mp_int_t x = ARG_INT(1), y = ARG_INT(2), w = ARG_INT(3), h = ARG_INT(4);
+	size_t len;
+
+	mp_get_buffer_raise(args[0], &buf, MP_BUFFER_READ);
+	if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > LCD_W || y + h > LCD_H)
+		mp_raise_ValueError(MP_ERROR_TEXT("blit area outside the screen"));
+	len = (size_t)w * h * LCD_PIXEL_BYTES;
+	if (len > buf.len)
+		len = buf.len;
+	LCD_Address_Set(x, y, x + w - 1, y + h - 1);
+	LCD_DC_Set();
+	LCD_DMA_Write(buf.buf, len);
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_blit_obj, 5, 5, mod_lcd_blit);
+
+/******************************************************************************
+	  函数说明：单色位图展开为像素,对应LCD.map_bitarray_to_rgb565
+	  入口数据：bitarray 位图,每字节从低位起8个像素,一行的最后一个字节不足8个像素时剩余位不用
+				buffer 输出的像素,格式与blit相同
+				width 每行像素数
+				color,bg_color 位为1和0时的颜色(RGB565)
+	  返回值：  无
+	  说    明：buffer放不下时抛出ValueError
+******************************************************************************/
+static mp_obj_t mod_lcd_map_bitarray(size_t n_args, const mp_obj_t *args)
+{
+	mp_buffer_info_t src, dst;
+	mp_int_t width = ARG_INT(2);
+	uint16_t fc = ARG_INT(3), bc = ARG_INT(4);
+	uint8_t *d;
+	size_t i, need;
+	mp_int_t col = 0;
+
+	mp_get_buffer_raise(args[0], &src, MP_BUFFER_READ);
+	mp_get_buffer_raise(args[1], &dst, MP_BUFFER_WRITE);
+	if (width <= 0)
+		return mp_const_none;
+	need = 0; // 先算出展开后的长度,放不下时不写任何数据
+	for (i = 0; i < src.len; i++)
+	{
+		mp_int_t n = (width - col < 8) ? width - col : 8;
+
+		need += n * LCD_PIXEL_BYTES;
+		col = (col + n >= width) ? 0 : col + n;
+	}
+	if (need > dst.len)
+		mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+
+	d = dst.buf;
+	col = 0;
+	for (i = 0; i < src.len; i++)
+	{
+		uint8_t bits = ((const uint8_t *)src.buf)[i];
+		uint8_t b;
+
+		for (b = 0; b < 8; b++)
+		{
+			uint16_t c = (bits & (1 << b)) ? fc : bc;
+
+#if LCD_PIXEL_BYTES == 3
+			*d++ = (c >> 8) & 0xF8;
+			*d++ = (c >> 3) & 0xFC;
+			*d++ = (c << 3) & 0xFF;
+#else
+			*d++ = c >> 8;
+			*d++ = c & 0xFF;
+#endif
+			if (++col >= width)
+			{
+				col = 0;
+				break;
+			}
+		}
+	}
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_map_bitarray_obj, 5, 5, mod_lcd_map_bitarray);
+
+/******************************************************************************
+	  函数说明：显示中英文混合字符串,对应LCD.show_text
+	  入口数据：x,y 显示坐标
+				s 字符串
+				fc,bc 字的颜色和背景色
+				sizey 字号 12/16/24/32,其他字号不显示
+	  返回值：  无
+	  说    明：非叠加模式.MicroPython的字符串是UTF-8,由LCD_ShowUTF8转成
+				GB2312内码查汉字字库,ASCII字宽sizey/2,汉字字宽sizey,与
+				show_text相同;字库中没有的字留空
+******************************************************************************/
+static mp_obj_t mod_lcd_text(size_t n_args, const mp_obj_t *args)
+{
+	const char *s = mp_obj_str_get_str(args[2]);
+
+	LCD_ShowUTF8(ARG_INT(0), ARG_INT(1), (const uint8_t *)s, ARG_INT(3), ARG_INT(4), ARG_INT(5), 0);
+	LCD_DMA_Wait();
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_lcd_text_obj, 6, 6, mod_lcd_text);
+
+/* LCD_ShowBMP的读函数,从MicroPython的流对象读取 */
+typedef struct
+{
+	mp_obj_t stream;
+	int err; // 第一次读错误的errno
+} mod_lcd_bmp_file;
+
+static uint32_t mod_lcd_bmp_read(void *ctx, uint8_t *buf, uint32_t len)
+{
+	mod_lcd_bmp_file *f = ctx;
+	int err = 0;
+	mp_uint_t n;
+
+	if (f->err)
+		return 0;
+	n = mp_stream_rw(f->stream, buf, len, &err, MP_STREAM_RW_READ); // 读满len字节或到文件尾才返回
+	if (err)
+	{
+		f->err = err;
+		return 0;
+	}
+	return n;
+}
+
+/******************************************************************************
+	  函数说明：显示BMP文件,对应LCD.LCD_ShowPicture
+	  入口数据：file 以'rb'打开、读位置在开头的文件
+				x,y 左上角坐标
+	  返回值：  无
+	  说    明：格式与LCD_ShowBMP相同,超出屏幕的部分裁掉;不支持的格式抛出ValueError,
+				读文件出错抛出OSError.读出错时先恢复扫描方向再抛出
+******************************************************************************/
+static mp_obj_t mod_lcd_bmp(mp_obj_t file_in, mp_obj_t x, mp_obj_t y)
+{
+	mod_lcd_bmp_file f = {file_in, 0};
+	LCD_BMP bmp;
+	uint8_t ret;
+
+	mp_get_stream_raise(file_in, MP_STREAM_OP_READ);
+	if (LCD_BMP_Open(&bmp, mod_lcd_bmp_read, &f) != 0)
+	{
+		if (f.err)
+			mp_raise_OSError(f.err);
+		mp_raise_ValueError(MP_ERROR_TEXT("unsupported BMP file"));
+	}
+	ret = LCD_ShowBMP(mp_obj_get_int(x), mp_obj_get_int(y), &bmp, mod_lcd_bmp_read, &f);
+	LCD_DMA_Wait();
+	if (f.err)
+		mp_raise_OSError(f.err);
+	if (ret != 0)
+		mp_raise_ValueError(MP_ERROR_TEXT("truncated BMP file"));
+	return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(mod_lcd_bmp_obj, mod_lcd_bmp);
+
+static const mp_rom_map_elem_t mod_lcd_globals_table[] = {
+	{MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__lcd)},
+	{MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&mod_lcd_init_obj)},
+	{MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mod_lcd_write_obj)},
+	{MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&mod_lcd_fill_obj)},
+	{MP_ROM_QSTR(MP_QSTR_point), MP_ROM_PTR(&mod_lcd_point_obj)},
+	{MP_ROM_QSTR(MP_QSTR_line), MP_ROM_PTR(&mod_lcd_line_obj)},
+	{MP_ROM_QSTR(MP_QSTR_rect), MP_ROM_PTR(&mod_lcd_rect_obj)},
+	{MP_ROM_QSTR(MP_QSTR_circle), MP_ROM_PTR(&mod_lcd_circle_obj)},
+	{MP_ROM_QSTR(MP_QSTR_fill_circle), MP_ROM_PTR(&mod_lcd_fill_circle_obj)},
+	{MP_ROM_QSTR(MP_QSTR_gui_hline), MP_ROM_PTR(&mod_lcd_gui_hline_obj)},
+	{MP_ROM_QSTR(MP_QSTR_gui_fill_circle), MP_ROM_PTR(&mod_lcd_gui_fill_circle_obj)},
+	{MP_ROM_QSTR(MP_QSTR_thick_line), MP_ROM_PTR(&mod_lcd_thick_line_obj)},
+	{MP_ROM_QSTR(MP_QSTR_thick_line_square), MP_ROM_PTR(&mod_lcd_thick_line_square_obj)},
+	{MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&mod_lcd_blit_obj)},
+	{MP_ROM_QSTR(MP_QSTR_map_bitarray), MP_ROM_PTR(&mod_lcd_map_bitarray_obj)},
+	{MP_ROM_QSTR(MP_QSTR_text), MP_ROM_PTR(&mod_lcd_text_obj)},
+	{MP_ROM_QSTR(MP_QSTR_bmp), MP_ROM_PTR(&mod_lcd_bmp_obj)},
+
+	// LCD类据此判断编译进固件的是不是同一块屏、同一组引脚
+	{MP_ROM_QSTR(MP_QSTR_WIDTH), MP_ROM_INT(LCD_W)},
+	{MP_ROM_QSTR(MP_QSTR_HEIGHT), MP_ROM_INT(LCD_H)},
+	{MP_ROM_QSTR(MP_QSTR_ROTATION), MP_ROM_INT(USE_HORIZONTAL)},
+	{MP_ROM_QSTR(MP_QSTR_CS), MP_ROM_INT(LCD_CS_PIN)},
+	{MP_ROM_QSTR(MP_QSTR_DC), MP_ROM_INT(LCD_DC_PIN)},
+	{MP_ROM_QSTR(MP_QSTR_RES), MP_ROM_INT(LCD_RES_PIN)},
+	{MP_ROM_QSTR(MP_QSTR_BLK), MP_ROM_INT(LCD_BLK_PIN)},
+};
+static MP_DEFINE_CONST_DICT(mod_lcd_globals, mod_lcd_globals_table);
+
+const mp_obj_module_t mod_lcd_user_cmodule = {
+	.base = {&mp_type_module},
+	.globals = (mp_obj_dict_t *)&mod_lcd_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR__lcd, mod_lcd_user_cmodule);
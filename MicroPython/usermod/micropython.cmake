@@ -0,0 +1,4 @@
+# User C modules for the rp2 port, pass this file as USER_C_MODULES:
+#   cd micropython/ports/rp2
+#   make BOARD=RPI_PICO USER_C_MODULES=/path/to/MicroPython/usermod/micropython.cmake
+include(${CMAKE_CURRENT_LIST_DIR}/lcd/micropython.cmake)
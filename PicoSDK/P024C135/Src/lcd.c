@@ -1,949 +0,0 @@
-#include "Inc/lcd.h"
-#include "Inc/lcd_init.h"
-#include "Inc/lcdfont.h"
-#include <stdlib.h>
-#include "hardware/spi.h"
-
-#define MAX_BUFFER_SIZE 512		// ݿRAM
-#define MAX_ALLOWED_DISTANCE 50 // 
-
-/******************************************************************************
-	  ˵ָɫ
-	  ݣxsta,ysta   ʼ
-				xend,yend   ֹ
-								color       Ҫɫ
-	  ֵ  
-******************************************************************************/
-void LCD_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
-{
-	uint16_t color_buf[1] = {color};
-	uint32_t num = (xend - xsta) * (yend - ysta);
-	uint32_t chunk_size;
-	uint8_t first_chunk = 1;
-
-	LCD_Address_Set(xsta, ysta, xend, yend); // ʾΧ
-
-	// ׼ɫ (λǰ)
-	uint8_t colorHi = color >> 8;
-	uint8_t colorLo = color;
-
-	uint32_t pixelCount = (xend - xsta + 1) * (yend - ysta + 1);
-
-	LCD_DC_Set();
-	//	while(num > 0)
-	//    {
-	//        chunk_size = (num > 65534) ? 65534 : num;
-	//
-	//        // DMA
-	////        HAL_SPI_Transmit_DMA(&hspi1, (uint8_t*)color_buf, chunk_size);
-	////
-	////        // ȴDMA
-	////        while(HAL_SPI_GetState(&hspi1) != HAL_SPI_STATE_READY);
-
-	//		LCD_WR_DATA_Bulk((uint16_t*)color_buf,chunk_size);
-	//
-	//        num -= chunk_size;
-	//    }
-	for (uint32_t i = 0; i < pixelCount * 2; i++)
-	{
-		spi_write_blocking(LCD_SPI_PORT, &colorHi, 1);
-		spi_write_blocking(LCD_SPI_PORT, &colorLo, 1);
-	}
-}
-
-/******************************************************************************
-	  ˵ָλû
-	  ݣx,y 
-				color ɫ
-	  ֵ  
-******************************************************************************/
-void LCD_DrawPoint(uint16_t x, uint16_t y, uint16_t color)
-{
-	LCD_Address_Set(x, y, x, y); // ùλ
-	LCD_WR_DATA(color);
-}
-
-/******************************************************************************
-	  ˵
-	  ݣx1,y1   ʼ
-				x2,y2   ֹ
-				color   ߵɫ
-	  ֵ  
-******************************************************************************/
-void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
-{
-	uint16_t t;
-	int xerr = 0, yerr = 0, delta_x, delta_y, distance;
-	int incx, incy, uRow, uCol;
-	delta_x = x2 - x1; // 
-	delta_y = y2 - y1;
-	uRow = x1; // 
-	uCol = y1;
-	if (delta_x > 0)
-		incx = 1; // õ
-	else if (delta_x == 0)
-		incx = 0; // ֱ
-	else
-	{
-		incx = -1;
-		delta_x = -delta_x;
-	}
-	if (delta_y > 0)
-		incy = 1;
-	else if (delta_y == 0)
-		incy = 0; // ˮƽ
-	else
-	{
-		incy = -1;
-		delta_y = -delta_y;
-	}
-	if (delta_x > delta_y)
-		distance = delta_x; // ѡȡ
-	else
-		distance = delta_y;
-	for (t = 0; t < distance + 1; t++)
-	{
-		LCD_DrawPoint(uRow, uCol, color); // 
-		xerr += delta_x;
-		yerr += delta_y;
-		if (xerr > distance)
-		{
-			xerr -= distance;
-			uRow += incx;
-		}
-		if (yerr > distance)
-		{
-			yerr -= distance;
-			uCol += incy;
-		}
-	}
-}
-
-// ݴרв
-// ˮƽ
-// x0,y0:
-// len:߳
-// color:ɫ
-void gui_draw_hline(uint16_t x0, uint16_t y0, uint16_t len, uint16_t color)
-{
-	if (len == 0)
-		return;
-	LCD_DrawLine(x0, y0, x0 + len - 1, y0, color);
-}
-
-void gui_fill_circle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color)
-{
-	uint32_t i;
-	uint32_t imax = (r * 724) >> 10; // r * 707/1000  r * 724/1024
-	uint32_t sqmax = r * r + (r >> 1);
-	uint32_t x = r;
-	uint32_t i_squared = 1; // 1^2 = 1
-
-	gui_draw_hline(x0 - r, y0, 2 * r, color);
-
-	for (i = 1; i < imax + 1; i++)
-	{
-		if ((i_squared + x * x) > sqmax)
-		{
-			if (x > imax)
-			{
-				gui_draw_hline(x0 - i + 1, y0 + x, 2 * (i - 1), color);
-				gui_draw_hline(x0 - i + 1, y0 - x, 2 * (i - 1), color);
-			}
-			x--;
-		}
-		// ڲ
-		gui_draw_hline(x0 - x, y0 + i, 2 * x, color);
-		gui_draw_hline(x0 - x, y0 - i, 2 * x, color);
-
-		i_squared += (i << 1) + 1; // һiƽ
-	}
-}
-
-/******************************************************************************
-	  ˵
-	  ݣx1,y1   ʼ
-				x2,y2   ֹ
-				color   ߵɫ
-				size ߵĿ()
-	  ֵ  
-******************************************************************************/
-void LCD_DrawThickLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color, uint8_t size)
-{
-	if (size == 1)
-	{
-		LCD_DrawLine(x1, y1, x2, y2, color);
-		return;
-	}
-
-	// ٱ߽
-	if (x1 < size || x2 < size || y1 < size || y2 < size)
-		return;
-
-	int16_t dx = x2 - x1;
-	int16_t dy = y2 - y1;
-
-	// پ飨ƣ
-	uint16_t abs_dx = dx > 0 ? dx : -dx;
-	uint16_t abs_dy = dy > 0 ? dy : -dy;
-	if ((abs_dx > MAX_ALLOWED_DISTANCE) || (abs_dy > MAX_ALLOWED_DISTANCE))
-	{
-		return;
-	}
-	//
-	//     // ֱߵ
-	//    if(dx == 0) {
-	//        // ƴֱߵ
-	//        for(uint8_t i = 0; i < thickness; i++) {
-	//            LCD_DrawLine(x1 + i - thickness/2, y1, x2 + i - thickness/2, y2, color);
-	//        }
-	//        // ˵İԲ
-	//        LCD_DrawCircle(x1, y1, thickness/2, color, 1); // Բ
-	//        LCD_DrawCircle(x2, y2, thickness/2, color, 1); // յԲ
-	//        return;
-	//    }
-	//
-	//    // ˮƽߵ
-	//    if(dy == 0) {
-	//        // ˮƽߵ
-	//        for(uint8_t i = 0; i < thickness; i++) {
-	//            LCD_DrawLine(x1, y1 + i - thickness/2, x2, y2 + i - thickness/2, color);
-	//        }
-	//        // ˵İԲ
-	//        LCD_DrawCircle(x1, y1, thickness/2, color, 1); // Բ
-	//        LCD_DrawCircle(x2, y2, thickness/2, color, 1); // յԲ
-	//        return;
-	//    }
-	//
-	//    // ߵĴֱ
-	//    float nx = -dy;
-	//    float ny = dx;
-	//
-	//    // һ
-	//	int16_t gcd_val = gcd(abs(nx), abs(ny));
-	//    if(gcd_val != 0) {
-	//        nx /= gcd_val;
-	//        ny /= gcd_val;
-	//    }
-	//
-	//    // ƫ
-	//    float offset = (thickness - 1) / 2.0f;
-	//
-	//    // ƶƽγɿ
-	//    for(uint8_t i = 0; i < thickness; i++) {
-	//        float currOffset = i - offset;
-	//        int16_t x1_offset = x1 + (int16_t)(nx * currOffset);
-	//        int16_t y1_offset = y1 + (int16_t)(ny * currOffset);
-	//        int16_t x2_offset = x2 + (int16_t)(nx * currOffset);
-	//        int16_t y2_offset = y2 + (int16_t)(ny * currOffset);
-	//
-	//        LCD_DrawLine(x1_offset, y1_offset, x2_offset, y2_offset, color);
-	//    }
-	//
-	//    // ˵Բζ˵
-	//    LCD_DrawCircle(x1, y1, thickness/2, color, 1); // Բ
-	//    LCD_DrawCircle(x2, y2, thickness/2, color, 1); // յԲ
-
-	uint16_t t;
-	int xerr = 0, yerr = 0, delta_x, delta_y, distance;
-	int incx, incy, uRow, uCol;
-	if (x1 < size || x2 < size || y1 < size || y2 < size)
-		return;
-	delta_x = x2 - x1; // 
-	delta_y = y2 - y1;
-	uRow = x1;
-	uCol = y1;
-	if (delta_x > 0)
-		incx = 1; // õ
-	else if (delta_x == 0)
-		incx = 0; // ֱ
-	else
-	{
-		incx = -1;
-		delta_x = -delta_x;
-	}
-	if (delta_y > 0)
-		incy = 1;
-	else if (delta_y == 0)
-		incy = 0; // ˮƽ
-	else
-	{
-		incy = -1;
-		delta_y = -delta_y;
-	}
-	if (delta_x > delta_y)
-		distance = delta_x; // ѡȡ
-	else
-		distance = delta_y;
-	for (t = 0; t <= distance + 1; t++) // 
-	{
-		gui_fill_circle(uRow, uCol, size, color); // 
-		xerr += delta_x;
-		yerr += delta_y;
-		if (xerr > distance)
-		{
-			xerr -= distance;
-			uRow += incx;
-		}
-		if (yerr > distance)
-		{
-			yerr -= distance;
-			uCol += incy;
-		}
-	}
-}
-
-void DrawThickLine(int x0, int y0, int x1, int y1, int thickness, uint16_t color)
-{
-	// ߽
-	if (x0 < 0)
-		x0 = 0;
-	if (y0 < 0)
-		y0 = 0;
-	if (x1 < 0)
-		x1 = 0;
-	if (y1 < 0)
-		y1 = 0;
-	if (x0 >= SCREEN_WIDTH)
-		x0 = SCREEN_WIDTH - 1;
-	if (y0 >= SCREEN_HEIGHT)
-		y0 = SCREEN_HEIGHT - 1;
-	if (x1 >= SCREEN_WIDTH)
-		x1 = SCREEN_WIDTH - 1;
-	if (y1 >= SCREEN_HEIGHT)
-		y1 = SCREEN_HEIGHT - 1;
-
-	// 򻯰߻
-	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
-	int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
-	int err = dx + dy, e2;
-
-	for (;;)
-	{
-		// ֵ
-		for (int i = -thickness; i <= thickness; i++)
-		{
-			for (int j = -thickness; j <= thickness; j++)
-			{
-				if (x0 + i >= 0 && x0 + i < SCREEN_WIDTH &&
-					y0 + j >= 0 && y0 + j < SCREEN_HEIGHT)
-				{
-					LCD_DrawPoint(x0 + i, y0 + j, color);
-				}
-			}
-		}
-
-		if (x0 == x1 && y0 == y1)
-			break;
-		e2 = 2 * err;
-		if (e2 >= dy)
-		{
-			err += dy;
-			x0 += sx;
-		}
-		if (e2 <= dx)
-		{
-			err += dx;
-			y0 += sy;
-		}
-	}
-}
-
-/******************************************************************************
-	  ˵
-	  ݣx1,y1   ʼ
-				x2,y2   ֹ
-				color   εɫ
-	  ֵ  
-******************************************************************************/
-void LCD_DrawRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
-{
-	LCD_DrawLine(x1, y1, x2, y1, color);
-	LCD_DrawLine(x1, y1, x1, y2, color);
-	LCD_DrawLine(x1, y2, x2, y2, color);
-	LCD_DrawLine(x2, y1, x2, y2, color);
-}
-
-/******************************************************************************
-	  ˵Բ
-	  ݣx0,y0   Բ
-				r       뾶
-				color   Բɫ
-	  ֵ  
-******************************************************************************/
-void Draw_Circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
-{
-	int a, b;
-	a = 0;
-	b = r;
-	while (a <= b)
-	{
-		LCD_DrawPoint(x0 - b, y0 - a, color); // 3
-		LCD_DrawPoint(x0 + b, y0 - a, color); // 0
-		LCD_DrawPoint(x0 - a, y0 + b, color); // 1
-		LCD_DrawPoint(x0 - a, y0 - b, color); // 2
-		LCD_DrawPoint(x0 + b, y0 + a, color); // 4
-		LCD_DrawPoint(x0 + a, y0 - b, color); // 5
-		LCD_DrawPoint(x0 + a, y0 + b, color); // 6
-		LCD_DrawPoint(x0 - b, y0 + a, color); // 7
-		a++;
-		if ((a * a + b * b) > (r * r)) // жҪĵǷԶ
-		{
-			b--;
-		}
-	}
-}
-
-/******************************************************************************
-	  ˵ʾִ
-	  ݣx,yʾ
-				*s Ҫʾĺִ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ ѡ 16 24 32
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	while (*s != 0)
-	{
-		if (sizey == 12)
-			LCD_ShowChinese12x12(x, y, s, fc, bc, sizey, mode);
-		else if (sizey == 16)
-			LCD_ShowChinese16x16(x, y, s, fc, bc, sizey, mode);
-		else if (sizey == 24)
-			LCD_ShowChinese24x24(x, y, s, fc, bc, sizey, mode);
-		else if (sizey == 32)
-			LCD_ShowChinese32x32(x, y, s, fc, bc, sizey, mode);
-		else
-			return;
-		s += 2;
-		x += sizey;
-	}
-}
-
-/******************************************************************************
-	  ˵ʾ12x12
-	  ݣx,yʾ
-				*s Ҫʾĺ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	uint8_t i, j, m = 0;
-	uint16_t k;
-	uint16_t HZnum;		  // Ŀ
-	uint16_t TypefaceNum; // һַռֽڴС
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-
-	HZnum = sizeof(tfont12) / sizeof(typFNT_GB12); // ͳƺĿ
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s + 1)))
-		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (!mode) // ǵӷʽ
-					{
-						if (tfont12[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // ӷʽ
-					{
-						if (tfont12[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // һ
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
-					}
-				}
-			}
-		}
-		continue; // ҵӦֿ˳ֹظȡģӰ
-	}
-}
-
-/******************************************************************************
-	  ˵ʾ16x16
-	  ݣx,yʾ
-				*s Ҫʾĺ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	uint8_t i, j, m = 0;
-	uint16_t k;
-	uint16_t HZnum;		  // Ŀ
-	uint16_t TypefaceNum; // һַռֽڴС
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont16) / sizeof(typFNT_GB16); // ͳƺĿ
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s + 1)))
-		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (!mode) // ǵӷʽ
-					{
-						if (tfont16[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // ӷʽ
-					{
-						if (tfont16[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // һ
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
-					}
-				}
-			}
-		}
-		continue; // ҵӦֿ˳ֹظȡģӰ
-	}
-}
-
-/******************************************************************************
-	  ˵ʾ24x24
-	  ݣx,yʾ
-				*s Ҫʾĺ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	uint8_t i, j, m = 0;
-	uint16_t k;
-	uint16_t HZnum;		  // Ŀ
-	uint16_t TypefaceNum; // һַռֽڴС
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont24) / sizeof(typFNT_GB24); // ͳƺĿ
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s + 1)))
-		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (!mode) // ǵӷʽ
-					{
-						if (tfont24[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // ӷʽ
-					{
-						if (tfont24[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // һ
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
-					}
-				}
-			}
-		}
-		continue; // ҵӦֿ˳ֹظȡģӰ
-	}
-}
-
-/******************************************************************************
-	  ˵ʾ32x32
-	  ݣx,yʾ
-				*s Ҫʾĺ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	uint8_t i, j, m = 0;
-	uint16_t k;
-	uint16_t HZnum;		  // Ŀ
-	uint16_t TypefaceNum; // һַռֽڴС
-	uint16_t x0 = x;
-	TypefaceNum = (sizey / 8 + ((sizey % 8) ? 1 : 0)) * sizey;
-	HZnum = sizeof(tfont32) / sizeof(typFNT_GB32); // ͳƺĿ
-	for (k = 0; k < HZnum; k++)
-	{
-		if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s + 1)))
-		{
-			LCD_Address_Set(x, y, x + sizey - 1, y + sizey - 1);
-			for (i = 0; i < TypefaceNum; i++)
-			{
-				for (j = 0; j < 8; j++)
-				{
-					if (!mode) // ǵӷʽ
-					{
-						if (tfont32[k].Msk[i] & (0x01 << j))
-							LCD_WR_DATA(fc);
-						else
-							LCD_WR_DATA(bc);
-						m++;
-						if (m % sizey == 0)
-						{
-							m = 0;
-							break;
-						}
-					}
-					else // ӷʽ
-					{
-						if (tfont32[k].Msk[i] & (0x01 << j))
-							LCD_DrawPoint(x, y, fc); // һ
-						x++;
-						if ((x - x0) == sizey)
-						{
-							x = x0;
-							y++;
-							break;
-						}
-					}
-				}
-			}
-		}
-		continue; // ҵӦֿ˳ֹظȡģӰ
-	}
-}
-
-/******************************************************************************
-	  ˵ʾַ
-	  ݣx,yʾ
-				num Ҫʾַ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowChar(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	uint8_t temp, sizex, t, m = 0;
-	uint16_t i, TypefaceNum; // һַռֽڴС
-	uint16_t x0 = x;
-	sizex = sizey / 2;
-	TypefaceNum = (sizex / 8 + ((sizex % 8) ? 1 : 0)) * sizey;
-	num = num - ' ';									 // õƫƺֵ
-	LCD_Address_Set(x, y, x + sizex - 1, y + sizey - 1); // ùλ
-	for (i = 0; i < TypefaceNum; i++)
-	{
-		if (sizey == 12)
-			temp = ascii_1206[num][i]; // 6x12
-		else if (sizey == 16)
-			temp = ascii_1608[num][i]; // 8x16
-		else if (sizey == 24)
-			temp = ascii_2412[num][i]; // 12x24
-		else if (sizey == 32)
-			temp = ascii_3216[num][i]; // 16x32
-		else
-			return;
-		for (t = 0; t < 8; t++)
-		{
-			if (!mode) // ǵģʽ
-			{
-				if (temp & (0x01 << t))
-					LCD_WR_DATA(fc);
-				else
-					LCD_WR_DATA(bc);
-				m++;
-				if (m % sizex == 0)
-				{
-					m = 0;
-					break;
-				}
-			}
-			else // ģʽ
-			{
-				if (temp & (0x01 << t))
-					LCD_DrawPoint(x, y, fc); // һ
-				x++;
-				if ((x - x0) == sizex)
-				{
-					x = x0;
-					y++;
-					break;
-				}
-			}
-		}
-	}
-}
-
-/******************************************************************************
-	  ˵ʾַ
-	  ݣx,yʾ
-				*p Ҫʾַ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-				mode:  0ǵģʽ  1ģʽ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowString(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
-{
-	while (*p != '\0')
-	{
-		LCD_ShowChar(x, y, *p, fc, bc, sizey, mode);
-		x += sizey / 2;
-		p++;
-	}
-}
-
-/******************************************************************************
-	  ˵ʾ
-	  ݣmnָ
-	  ֵ  
-******************************************************************************/
-uint32_t mypow(uint8_t m, uint8_t n)
-{
-	uint32_t result = 1;
-	while (n--)
-		result *= m;
-	return result;
-}
-
-/******************************************************************************
-	  ˵ʾ
-	  ݣx,yʾ
-				num Ҫʾ
-				len Ҫʾλ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowIntNum(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
-{
-	uint8_t t, temp;
-	uint8_t enshow = 0;
-	uint8_t sizex = sizey / 2;
-	for (t = 0; t < len; t++)
-	{
-		temp = (num / mypow(10, len - t - 1)) % 10;
-		if (enshow == 0 && t < (len - 1))
-		{
-			if (temp == 0)
-			{
-				LCD_ShowChar(x + t * sizex, y, ' ', fc, bc, sizey, 0);
-				continue;
-			}
-			else
-				enshow = 1;
-		}
-		LCD_ShowChar(x + t * sizex, y, temp + 48, fc, bc, sizey, 0);
-	}
-}
-
-/******************************************************************************
-	  ˵ʾλС
-	  ݣx,yʾ
-				num ҪʾС
-				len Ҫʾλ
-				fc ֵɫ
-				bc ֵıɫ
-				sizey ֺ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowFloatNum1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
-{
-	uint8_t t, temp, sizex;
-	uint16_t num1;
-	sizex = sizey / 2;
-	num1 = num * 100;
-	for (t = 0; t < len; t++)
-	{
-		temp = (num1 / mypow(10, len - t - 1)) % 10;
-		if (t == (len - 2))
-		{
-			LCD_ShowChar(x + (len - 2) * sizex, y, '.', fc, bc, sizey, 0);
-			t++;
-			len += 1;
-		}
-		LCD_ShowChar(x + t * sizex, y, temp + 48, fc, bc, sizey, 0);
-	}
-}
-
-/******************************************************************************
-	  ˵ʾͼƬ
-	  ݣx,y
-				length ͼƬ
-				width  ͼƬ
-				pic[]  ͼƬ
-	  ֵ  
-******************************************************************************/
-void LCD_ShowPicture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[])
-{
-	// ʾĽ
-	uint16_t x_end = x + length;
-	uint16_t y_end = y + width;
-
-	// ʾΧ
-	LCD_Address_Set(x, y, x_end, y_end);
-
-	// 
-	uint32_t pixelCount = length * width;
-
-	// ͼƬֽ (ÿ2ֽ)
-	uint32_t dataSize = pixelCount * 2;
-
-	// ֿ鴫
-	uint32_t remaining = dataSize;
-	uint32_t offset = 0;
-
-	LCD_DC_Set();
-
-	// ֿ鴫ͼƬ
-	while (remaining > 0)
-	{
-		uint32_t chunkSize = (remaining > MAX_BUFFER_SIZE) ? MAX_BUFFER_SIZE : remaining;
-
-		// ͵ǰݿ
-		spi_write_blocking(LCD_SPI_PORT, (uint8_t *)(pic + offset), chunkSize);
-
-		offset += chunkSize;
-		remaining -= chunkSize;
-	}
-}
-
-/* ɫ */
-void DrawColorBars(void)
-{
-	uint16_t colors[] = {RED, GREEN, BLUE, YELLOW, CYAN, MAGENTA};
-	for (int i = 0; i < 6; i++)
-	{
-		LCD_Fill(i * 40, 0, ((i + 1) * 40) - 1, SCREEN_HEIGHT - 1, colors[i]);
-	}
-}
-
-/* ƻҶȽ */
-void DrawGrayscale(void)
-{
-#define GRAY_LEVELS 24
-	const uint16_t level_width = SCREEN_WIDTH / GRAY_LEVELS;
-	const uint16_t remainder = SCREEN_WIDTH % GRAY_LEVELS;
-
-	for (uint8_t n = 0; n < GRAY_LEVELS; n++)
-	{
-		// 㵱ǰҶȼΧ
-		uint16_t start_x = n * level_width;
-		uint16_t end_x = start_x + level_width - 1;
-
-		// أһ
-		if (n == GRAY_LEVELS - 1)
-		{
-			end_x += remainder;
-		}
-
-		// 24Ҷֵ (0~23  0~255)
-		uint8_t gray = (n * 255) / (GRAY_LEVELS - 1);
-
-		// RGB565ɫȷʵRGB꣩
-		uint16_t color = RGB(gray, gray, gray);
-
-		// Ҷȴ
-		LCD_Fill(start_x, 0, end_x, SCREEN_HEIGHT - 1, color);
-	}
-}
-
-/* ť */
-void DrawClearButton(void)
-{
-	LCD_Fill(SCREEN_WIDTH - BTN_WIDTH, SCREEN_HEIGHT - BTN_HEIGHT,
-							SCREEN_WIDTH, SCREEN_HEIGHT, GRAY);
-	LCD_ShowString(SCREEN_WIDTH - BTN_WIDTH + 5, SCREEN_HEIGHT - BTN_HEIGHT + 8,
-				   "Clear", BLACK, GRAY, 16, 0);
-}
-
-/**
- * @brief  ָλһԲ
- * @param  x0,y0: Բ
- * @param  r: Բİ뾶
- * @param  color: ɫ
- * @retval 
- */
-void LCD_FillCircle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
-{
-	if (r == 0)
-		return;
-
-	int16_t x = r;
-	int16_t y = 0;
-	int16_t err = 0;
-
-	while (x >= y)
-	{
-		// ˮƽ
-		LCD_Fill(x0 - x, y0 + y, x0 + x, y0 + y, color);
-		LCD_Fill(x0 - y, y0 + x, x0 + y, y0 + x, color);
-		LCD_Fill(x0 - x, y0 - y, x0 + x, y0 - y, color);
-		LCD_Fill(x0 - y, y0 - x, x0 + y, y0 - x, color);
-
-		if (err <= 0)
-		{
-			y += 1;
-			err += 2 * y + 1;
-		}
-		if (err > 0)
-		{
-			x -= 1;
-			err -= 2 * x + 1;
-		}
-	}
-}
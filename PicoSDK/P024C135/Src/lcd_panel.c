@@ -0,0 +1,33 @@
+#include "Inc/lcd_init.h"
+
+/* Ļʼ,ʽlcd_panel.h */
+static const uint8_t lcd_panel_init[] = {
+	0x11, 0 | LCD_INIT_DELAY, 120, // Sleep out, ʱ120ms
+	0xCF, 3, 0x00, 0xD9, 0x30,
+	0xED, 4, 0x64, 0x03, 0x12, 0x81,
+	0xE8, 3, 0x85, 0x10, 0x78,
+	0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+	0xF7, 1, 0x20,
+	0xEA, 2, 0x00, 0x00,
+	0xC0, 1, 0x21, // Power control, VRH[5:0]
+	0xC1, 1, 0x12, // Power control, SAP[2:0];BT[3:0]
+	0xC5, 2, 0x32, 0x3C, // VCM control
+	0xC7, 1, 0xC1, // VCM control2
+	0x36, 0, // Memory Access Control, ȡmadctl[USE_HORIZONTAL]
+	0x3A, 1, 0x55,
+	0xB1, 2, 0x00, 0x18,
+	0xB6, 2, 0x0A, 0xA2, // Display Function Control
+	0xF2, 1, 0x00, // 3Gamma Function Disable
+	0x26, 1, 0x01, // Gamma curve selected
+	0xE0, 15, 0x0F, 0x20, 0x1E, 0x09, 0x12, 0x0B, 0x50, 0xBA, 0x44, 0x09, 0x14, 0x05, 0x23, 0x21, 0x00, // Set Gamma
+	0xE1, 15, 0x00, 0x19, 0x19, 0x00, 0x12, 0x07, 0x2D, 0x28, 0x3F, 0x02, 0x0A, 0x08, 0x25, 0x2D, 0x0F, // Set Gamma
+	0x29, 0, // Display on
+};
+
+const LCD_Panel lcd_panel = {
+	lcd_panel_init,
+	sizeof(lcd_panel_init),
+	{0x08, 0xC8, 0x78, 0xA8}, // 0x36,USE_HORIZONTAL 0~3
+	{0, 0, 0, 0}, // ƫ
+	{0, 0, 0, 0}, // ƫ
+};
@@ -3,6 +3,7 @@
 #include "Inc/ft6236.h"
 #include "stdlib.h"
 #include "Inc/pic.h"
+#include "Inc/pic_rle.h"
 #include "pico/time.h"
 #include <stdio.h>
 
@@ -29,29 +30,64 @@ uint32_t g_state_timer = 0;
 uint8_t g_img_index = 0;
 uint8_t color_full_index = 0;
 uint8_t g_countdown = 3;
-extern const uint8_t gImage_logo[];
+extern const uint8_t gImage_logo_rle[];
 
 uint8_t IsTouchInButton(uint16_t x, uint16_t y);
 
+static uint16_t lastX = 0xFFFF, lastY = 0xFFFF; // һ,0xFFFFʾָδ
+
+/* д״̬´һ¼ */
+static void HandleTouchEvent(const FT6236_Event *ev)
+{
+    if (ev->Touch_Event == FT6236_TOUCH_EVENT_UP)
+    {
+        lastX = lastY = 0xFFFF; // ָ̧ʱ
+        return;
+    }
+    if (lastX != 0xFFFF && lastY != 0xFFFF)
+    {
+        // ʹBresenham㷨
+        LCD_DrawThickLine(lastX, lastY, ev->X_Pos, ev->Y_Pos, WHITE, 2);
+    }
+    lastX = ev->X_Pos;
+    lastY = ev->Y_Pos;
+    if (IsTouchInButton(lastX, lastY))
+    {
+        LCD_Fill(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK);
+        DrawClearButton();
+    }
+}
+
 void LCD_DEMO(void)
 {
+    LCD_Image logo;
+
     LCD_Init();
     FT6236_Init();
+    FT6236_IRQ_Init(); // INTжȡ,ѭȴI2C
     LCD_Fill(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK);
+#if USE_FRAMEBUFFER
+    LCD_Present();
+#endif
     sleep_ms(100);
     LCD_BLK_Set(); // 򿪱
 
-    static uint16_t lastX, lastY;
     while (1)
     {
         /* USER CODE END WHILE */
 
         /* USER CODE BEGIN 3 */
-        FT6236_Get_Touch_Data(); // ´
+        FT6236_Event touch;
+        while (FT6236_Get_Event(&touch)) // ȡжϲɼȫ¼,ʼ
+        {
+            if (g_state == STATE_HANDWRITING)
+                HandleTouchEvent(&touch);
+        }
         switch (g_state)
         {
         case STATE_LOGO:
-            LCD_ShowPicture(0, 29, 239, 219, gImage_logo);
+            if (LCD_Image_Open(&logo, gImage_logo_rle) == 0) // ѹͼƬ,ȡͷ
+                LCD_ShowImage(0, 29, &logo);
 
             if (get_tick() - g_state_timer > LOGO_DURATION)
             {
@@ -159,28 +195,12 @@ void LCD_DEMO(void)
             break;
 
         case STATE_HANDWRITING:
-            // ͼ
-            if (FT6236_Get_Touch_Count() > 0)
-            {
-                if (lastX != 0xFFFF && lastY != 0xFFFF)
-                {
-                    // ʹBresenham㷨
-                    LCD_DrawThickLine(lastX, lastY, FT6236_Instance.X_Pos, FT6236_Instance.Y_Pos, WHITE, 2);
-                }
-                lastX = FT6236_Instance.X_Pos;
-                lastY = FT6236_Instance.Y_Pos;
-                if (IsTouchInButton(lastX, lastY))
-                {
-                    LCD_Fill(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK);
-                    DrawClearButton();
-                }
-            }
-            else
-            {
-                lastX = lastY = 0xFFFF; // ָ̧ʱ
-            }
+            // ͼHandleTouchEvent()а¼
             break;
         }
+#if USE_FRAMEBUFFER
+        LCD_Present(); // ѱֻƵˢµĻ
+#endif
     }
 }
 
@@ -0,0 +1,28 @@
+#include "Inc/lcd_init.h"
+
+/* Ļʼ,ʽlcd_panel.h */
+static const uint8_t lcd_panel_init[] = {
+	0x11, 0 | LCD_INIT_DELAY, 120, // Sleep out, ʱ120ms
+	0x36, 0, // Memory Access Control,ȡmadctl[USE_HORIZONTAL]
+	0x3A, 1, 0x05,
+	0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+	0xB7, 1, 0x35,
+	0xBB, 1, 0x32, // Vcom=1.35V
+	0xC2, 1, 0x01,
+	0xC3, 1, 0x15, // GVDD=4.8V  ɫ
+	0xC4, 1, 0x20, // VDV, 0x20:0v
+	0xC6, 1, 0x0F, // 0x0F:60Hz
+	0xD0, 2, 0xA4, 0xA1,
+	0xE0, 14, 0xD0, 0x08, 0x0E, 0x09, 0x09, 0x05, 0x31, 0x33, 0x48, 0x17, 0x14, 0x15, 0x31, 0x34,
+	0xE1, 14, 0xD0, 0x08, 0x0E, 0x09, 0x09, 0x15, 0x31, 0x33, 0x48, 0x17, 0x14, 0x15, 0x31, 0x34,
+	0x20, 0,
+	0x29, 0,
+};
+
+const LCD_Panel lcd_panel = {
+	lcd_panel_init,
+	sizeof(lcd_panel_init),
+	{0x00, 0xC0, 0x70, 0xA0}, // 0x36,USE_HORIZONTAL 0~3
+	{0, 0, 0, 0}, // ƫ
+	{0, 0, 0, 0}, // ƫ
+};
@@ -1,72 +0,0 @@
-#ifndef __LCD_H
-#define __LCD_H
-
-#include "Inc/lcd_init.h"
-
-void LCD_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color);  // ָɫ
-void LCD_DrawPoint(uint16_t x, uint16_t y, uint16_t color);                                 // ָλûһ
-void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);      // ָλûһ
-void LCD_DrawRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color); // ָλûһ
-void Draw_Circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);                      // ָλûһԲ
-void LCD_FillCircle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
-
-void LCD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);      // ʾִ
-void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ12x12
-void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ16x16
-void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ24x24
-void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ32x32
-
-void LCD_ShowChar(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);        // ʾһַ
-void LCD_ShowString(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾַ
-uint32_t mypow(uint8_t m, uint8_t n);                                                                                 // 
-void LCD_ShowIntNum(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey);      // ʾ
-void LCD_ShowFloatNum1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey);      // ʾλС
-
-void LCD_ShowPicture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[]); // ʾͼƬ
-
-void DrawColorBars(void);
-void DrawGrayscale(void);
-void DrawClearButton(void);
-
-void DrawThickLine(int x0, int y0, int x1, int y1, int thickness, uint16_t color);
-void LCD_DrawThickLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color, uint8_t size);
-// ɫ
-#define WHITE 0xFFFF
-#define BLACK 0x0000
-#define BLUE 0x001F
-#define BRED 0XF81F
-#define GRED 0XFFE0
-#define GBLUE 0X07FF
-#define RED 0xF800
-#define MAGENTA 0xF81F
-#define GREEN 0x07E0
-#define CYAN 0x7FFF
-#define YELLOW 0xFFE0
-#define BROWN 0XBC40      // ɫ
-#define BRRED 0XFC07      // غɫ
-#define GRAY 0X8430       // ɫ
-#define DARKBLUE 0X01CF   // ɫ
-#define LIGHTBLUE 0X7D7C  // ǳɫ
-#define GRAYBLUE 0X5458   // ɫ
-#define LIGHTGREEN 0X841F // ǳɫ
-#define LGRAY 0XC618      // ǳɫ(PANNEL),屳ɫ
-#define LGRAYBLUE 0XA651  // ǳɫ(мɫ)
-#define LBBLUE 0X2B12     // ǳɫ(ѡĿķɫ)
-
-/* 궨 */
-#define LOGO_DURATION 3000
-#define TEXT_DURATION 2000
-#define IMAGE_INTERVAL 2000
-#define COLOR_FULL_INTERVAL 1000
-#define EFFECT_DURATION 3000
-#define BTN_WIDTH 60
-#define BTN_HEIGHT 30
-#define SCREEN_WIDTH LCD_W
-#define SCREEN_HEIGHT LCD_H
-
-#define RGB(r, g, b) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
-
-#define COLOR_BAR_NUM 6                          // 6ɫ
-#define BAR_WIDTH (SCREEN_WIDTH / COLOR_BAR_NUM) // Զ
-
-#endif
@@ -0,0 +1,1132 @@
+/*  PicoSDK/tools/gen_rle_image.py  pic.h ,޸ͼƬ,ֹ༭ */
+#ifndef __PIC_RLE_H
+#define __PIC_RLE_H
+
+const unsigned char gImage_logo_rle[17975] = { // 260x238 RGB666,ԭ185648ֽ
+0X52,0X4C,0X45,0X12,0X01,0X04,0X00,0XEE,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,
+0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,
+0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,
+0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,
+0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,
+0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,
+0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,
+0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,
+0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,
+0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X00,0X3C,0X10,0X04,
+0XF6,0X38,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,
+0XF5,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,
+0X00,0X3C,0X0C,0X00,0XF5,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,
+0XFE,0XFC,0XFC,0XFC,0X03,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X38,0X08,
+0X00,0XEF,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XFE,0XFC,0XFC,0XFC,0X03,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,
+0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X03,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,
+0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X03,0X3C,0X0C,0X00,0X38,
+0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,
+0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X03,0X3C,0X0C,0X00,
+0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X03,0X3C,0X0C,
+0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X03,0X3C,
+0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,0X03,
+0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,
+0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,0XFC,
+0X03,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0XEF,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XFE,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,
+0XFC,0X82,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X82,0XFC,0XFC,0XFC,0X20,0X3C,0X0C,0X04,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,
+0X0C,0X00,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,
+0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0X82,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X81,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X82,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,
+0XFC,0X82,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0XF6,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0XF6,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0XF6,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X00,0X30,0X0C,0X04,0XEE,0X2C,0X08,
+0X00,0X83,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X83,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XF4,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF4,0XFC,0XFC,0XFC,0X01,0XFC,0XFC,0XF8,0X34,0X08,0X00,
+0X8C,0X38,0X08,0X00,0X01,0X34,0X0C,0X00,0X64,0X48,0X40,0XC4,0XFC,0XFC,0XFC,0X00,
+0XE0,0XDC,0XD8,0X8E,0X38,0X08,0X00,0X8A,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,
+0XFC,0XFC,0XFC,0XF4,0XFC,0XFC,0XFC,0X00,0XFC,0XF4,0XF0,0X8D,0X38,0X0C,0X00,0X01,
+0X34,0X0C,0X00,0XFC,0XF4,0XF0,0XC4,0XFC,0XFC,0XFC,0X00,0X8C,0X68,0X60,0X8C,0X38,
+0X0C,0X00,0X01,0X3C,0X08,0X00,0X38,0X08,0X00,0X8A,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF4,0XFC,0XFC,0XFC,0X00,0X4C,0X28,0X20,0X8D,0X38,0X0C,
+0X00,0X01,0X38,0X08,0X00,0XF4,0XF8,0XF8,0XC4,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,
+0X00,0X2C,0X10,0X08,0X8A,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,
+0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,
+0XF4,0XFC,0XFC,0XFC,0X8F,0X38,0X0C,0X00,0XC5,0XFC,0XFC,0XFC,0X8D,0X38,0X0C,0X00,
+0X01,0X3C,0X0C,0X00,0XCC,0XC4,0XC0,0X8A,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,
+0XFC,0XFC,0XFC,0XF4,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X00,
+0X30,0X0C,0X00,0XC4,0XFC,0XFC,0XFC,0X00,0XE8,0XE4,0XE0,0X8D,0X38,0X0C,0X00,0X00,
+0X38,0X08,0X00,0X8B,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,
+0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF3,
+0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF4,0X8E,0X38,0X0C,0X00,0X00,0X8C,0X7C,0X78,0XC4,
+0XFC,0XFC,0XFC,0X00,0X70,0X4C,0X44,0X8D,0X38,0X0C,0X00,0X00,0X40,0X0C,0X00,0X8B,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF3,0XFC,0XFC,0XFC,0X01,
+0XB4,0X98,0X94,0X3C,0X0C,0X00,0X8C,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0XC5,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X00,0X70,0X50,0X40,0X8B,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF3,0XFC,0XFC,0XFC,0X8F,0X38,
+0X0C,0X00,0XC5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8C,0X38,0X0C,0X00,0X01,0X3C,
+0X0C,0X00,0XE0,0XD4,0XD0,0X8B,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XF3,0XFC,0XFC,0XFC,0X8F,0X38,0X0C,0X00,0XC4,0XFC,0XFC,0XFC,0X00,0XAC,0X9C,
+0X9C,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF3,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,
+0X00,0X00,0X30,0X10,0X04,0XC4,0XFC,0XFC,0XFC,0X00,0X2C,0X08,0X00,0X8E,0X38,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF2,0XFC,0XFC,
+0XFC,0X00,0XF4,0XEC,0XE8,0X8E,0X38,0X0C,0X00,0X00,0XB4,0XA8,0XA8,0XC4,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF2,0XFC,0XFC,0XFC,0X00,0X8C,0X70,
+0X68,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X08,0X00,0XC4,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,
+0XFC,0X8E,0X38,0X0C,0X00,0X00,0X80,0X64,0X5C,0X8C,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF2,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0XC4,0XFC,0XFC,0XFC,0X00,0XF4,0XF0,0XEC,0X8E,0X38,0X0C,0X00,0X00,0XE4,0XDC,
+0XDC,0X8C,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF2,0XFC,0XFC,
+0XFC,0X8E,0X38,0X0C,0X00,0X00,0X4C,0X28,0X1C,0XC4,0XFC,0XFC,0XFC,0X00,0X40,0X28,
+0X24,0X8E,0X38,0X0C,0X00,0X8D,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0XEC,0XE8,0XE8,0X8E,0X38,0X0C,0X00,0X00,0X98,0X84,
+0X7C,0XC4,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8D,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X5C,0X48,
+0X40,0X8E,0X38,0X0C,0X00,0X00,0XFC,0XF8,0XF8,0XC4,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X8D,0X38,0X0C,0X00,0X00,0X44,0X20,0X18,0X8D,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X44,0X18,0X0C,0X8E,0X38,0X0C,
+0X00,0XC4,0XFC,0XFC,0XFC,0X00,0XFC,0XFC,0XF8,0X8E,0X38,0X0C,0X00,0X00,0XDC,0XCC,
+0XC4,0X8D,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X8F,0X38,0X0C,0X00,0XC4,0XFC,0XFC,0XFC,0X00,0XB4,0XA4,0X9C,0X8E,0X38,0X0C,
+0X00,0X00,0XFC,0XF8,0XF8,0X8D,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XAD,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X84,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,
+0XFC,0X98,0XFC,0XFC,0XFC,0X81,0XF8,0XFC,0XFC,0X0D,0XFC,0XFC,0XFC,0XE4,0XD0,0XD0,
+0X94,0X7C,0X74,0X5C,0X3C,0X30,0X48,0X1C,0X14,0X38,0X0C,0X00,0X34,0X0C,0X00,0X34,
+0X0C,0X00,0X38,0X08,0X00,0X38,0X0C,0X00,0X34,0X0C,0X00,0X34,0X0C,0X00,0X68,0X48,
+0X40,0XF0,0XE0,0XDC,0X93,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X64,0X40,0X38,
+0X8F,0XFC,0XFC,0XFC,0X05,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XF4,0X74,0X58,
+0X50,0X34,0X0C,0X00,0X34,0X0C,0X00,0X82,0X38,0X0C,0X00,0X81,0X34,0X0C,0X00,0X07,
+0X38,0X0C,0X00,0X34,0X0C,0X00,0X34,0X0C,0X00,0X50,0X30,0X28,0XBC,0XA4,0XA0,0XFC,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0X91,0XFC,0XFC,0XFC,0X08,0XF8,0XFC,0XFC,
+0XF4,0XF8,0XF8,0XFC,0XF4,0XF0,0X64,0X48,0X40,0X30,0X08,0X00,0X34,0X0C,0X00,0X34,
+0X10,0X04,0X90,0X74,0X6C,0XFC,0XFC,0XF8,0X86,0XFC,0XFC,0XFC,0X00,0X34,0X0C,0X04,
+0X8E,0X38,0X0C,0X00,0X8E,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,
+0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,
+0X96,0XFC,0XFC,0XFC,0X8B,0X38,0X0C,0X00,0X00,0XD0,0XC0,0XBC,0X88,0XFC,0XFC,0XFC,
+0X01,0X34,0X0C,0X00,0X40,0X0C,0X00,0X84,0X38,0X0C,0X00,0X81,0X3C,0X0C,0X00,0X00,
+0X64,0X40,0X38,0X94,0XFC,0XFC,0XFC,0X02,0XA8,0X94,0X90,0X3C,0X10,0X00,0X3C,0X0C,
+0X00,0X8F,0X38,0X0C,0X00,0X01,0X3C,0X0C,0X00,0X30,0X0C,0X00,0X8F,0XFC,0XFC,0XFC,
+0X00,0XC0,0XB4,0XB0,0X8E,0X38,0X0C,0X00,0X00,0XD0,0XC0,0XBC,0X8D,0XFC,0XFC,0XFC,
+0X02,0XD0,0XC4,0XC0,0X34,0X0C,0X00,0X3C,0X0C,0X00,0X8F,0X38,0X0C,0X00,0X02,0X3C,
+0X0C,0X00,0X40,0X0C,0X00,0X9C,0X80,0X78,0X90,0XFC,0XFC,0XFC,0X88,0X38,0X0C,0X00,
+0X01,0X3C,0X0C,0X00,0X44,0X20,0X18,0X84,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,
+0X3C,0X10,0X04,0X8E,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,
+0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X96,
+0XFC,0XFC,0XFC,0X8B,0X38,0X0C,0X00,0X00,0X38,0X10,0X04,0X85,0XFC,0XFC,0XFC,0X01,
+0XF0,0XE0,0XE0,0X3C,0X0C,0X00,0X8A,0X38,0X0C,0X00,0X01,0X3C,0X10,0X00,0X7C,0X64,
+0X60,0X8F,0XFC,0XFC,0XFC,0X02,0XFC,0XFC,0XF8,0X34,0X10,0X04,0X38,0X08,0X00,0X95,
+0X38,0X0C,0X00,0X01,0X34,0X0C,0X04,0XF8,0XFC,0XFC,0X8C,0XFC,0XFC,0XFC,0X00,0X30,
+0X14,0X0C,0X8E,0X38,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X01,0X30,0X0C,0X04,0X3C,0X0C,
+0X00,0X95,0X38,0X0C,0X00,0X01,0X3C,0X10,0X00,0X4C,0X38,0X30,0X8C,0XFC,0XFC,0XFC,
+0X00,0X38,0X0C,0X04,0X8B,0X38,0X0C,0X00,0X01,0X3C,0X08,0X00,0XBC,0XA8,0XA8,0X82,
+0XFC,0XFC,0XFC,0X00,0X3C,0X08,0X00,0X8D,0X38,0X0C,0X00,0X00,0X70,0X50,0X48,0X8E,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X00,
+0XFC,0XEC,0XE8,0X8B,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,
+0X38,0X08,0X00,0X8E,0X38,0X0C,0X00,0X00,0X6C,0X58,0X54,0X8D,0XFC,0XFC,0XFC,0X00,
+0X38,0X0C,0X04,0X9A,0X38,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X00,0X34,0X08,0X00,0X8D,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X89,0XFC,0XFC,0XFC,0X01,0XF8,0XF8,0XFC,0X38,
+0X18,0X10,0X9A,0X38,0X0C,0X00,0X00,0X30,0X08,0X00,0X89,0XFC,0XFC,0XFC,0X00,0X64,
+0X50,0X4C,0X8F,0X38,0X0C,0X00,0X02,0X38,0X1C,0X10,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,
+0X8E,0X38,0X0C,0X00,0X00,0XFC,0XFC,0XF8,0X8E,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,
+0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,
+0X8C,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X00,0X50,0X2C,0X20,0X8B,0X38,0X0C,0X00,
+0X04,0X3C,0X0C,0X00,0X50,0X34,0X30,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X68,0X4C,0X48,
+0X91,0X38,0X0C,0X00,0X01,0XF8,0XF8,0XF4,0XF8,0XFC,0XFC,0X89,0XFC,0XFC,0XFC,0X01,
+0X70,0X58,0X54,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X10,0X00,0X8C,0X38,
+0X0C,0X00,0X01,0X40,0X0C,0X00,0XF8,0XF4,0XF4,0X8A,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X01,0XF8,0XF4,0XF4,0X34,0X0C,0X00,
+0X8E,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0X38,0X0C,0X00,0X00,0X84,0X74,0X70,
+0X87,0XFC,0XFC,0XFC,0X00,0X64,0X50,0X4C,0X91,0X38,0X0C,0X00,0X01,0XD8,0XD8,0XD4,
+0X90,0X78,0X74,0X8E,0X38,0X0C,0X00,0X8F,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,
+0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X00,0X34,0X08,0X00,0X8C,0X38,0X0C,0X00,0X02,
+0X40,0X10,0X00,0XFC,0XF4,0XF4,0X38,0X08,0X00,0X92,0X38,0X0C,0X00,0X00,0X34,0X0C,
+0X00,0X89,0XFC,0XFC,0XFC,0X00,0X38,0X10,0X04,0X8C,0X38,0X0C,0X00,0X01,0X3C,0X0C,
+0X00,0XF0,0XE4,0XE0,0X82,0XFC,0XFC,0XFC,0X00,0XF0,0XE4,0XDC,0X8C,0X38,0X0C,0X00,
+0X00,0XF8,0XFC,0XFC,0X89,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XD8,0XC8,0XC0,
+0X87,0XFC,0XFC,0XFC,0X00,0XA4,0X98,0X8C,0X8D,0X38,0X0C,0X00,0X00,0X9C,0X84,0X78,
+0X82,0XFC,0XFC,0XFC,0X01,0XF0,0XE4,0XE0,0X3C,0X0C,0X00,0X8A,0X38,0X0C,0X00,0X00,
+0XB4,0XA0,0X9C,0X86,0XFC,0XFC,0XFC,0X00,0X6C,0X54,0X50,0X92,0X38,0X0C,0X00,0X01,
+0X3C,0X10,0X00,0X3C,0X0C,0X04,0X8D,0X38,0X0C,0X00,0X00,0X40,0X0C,0X00,0X8F,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X8D,0X38,
+0X0C,0X00,0X01,0X34,0X0C,0X00,0X38,0X08,0X00,0X94,0X38,0X0C,0X00,0X00,0XFC,0XF8,
+0XFC,0X87,0XFC,0XFC,0XFC,0X01,0X38,0X10,0X0C,0X38,0X0C,0X04,0X8C,0X38,0X0C,0X00,
+0X01,0XD0,0XC0,0XB8,0XF8,0XFC,0XFC,0X82,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X8C,
+0X38,0X0C,0X00,0X00,0X54,0X3C,0X34,0X88,0XFC,0XFC,0XFC,0X00,0X94,0X84,0X80,0X8E,
+0X38,0X0C,0X00,0X00,0XFC,0XFC,0XF8,0X86,0XFC,0XFC,0XFC,0X00,0XA0,0X8C,0X88,0X8D,
+0X38,0X0C,0X00,0X00,0X9C,0X88,0X80,0X84,0XFC,0XFC,0XFC,0X00,0X3C,0X20,0X14,0X8A,
+0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0XA3,0X38,0X0C,0X00,0X00,0X30,0X10,0X00,0X8F,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X94,0XFC,0XFC,0XFC,0X00,
+0XFC,0XF8,0XF4,0X91,0X38,0X0C,0X00,0X02,0X3C,0X10,0X04,0X3C,0X1C,0X10,0X3C,0X18,
+0X0C,0X8F,0X38,0X0C,0X00,0X00,0XFC,0XF8,0XF8,0X86,0XFC,0XFC,0XFC,0X00,0X60,0X3C,
+0X34,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X18,0X14,0X85,0XFC,0XFC,0XFC,0X8D,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X00,0X34,0X0C,0X04,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X86,0XFC,0XFC,0XFC,0X00,0XE8,0XDC,0XD8,0X8D,0X38,0X0C,0X00,0X00,0X60,0X44,
+0X3C,0X85,0XFC,0XFC,0XFC,0X00,0XC8,0XC0,0XBC,0X8A,0X38,0X0C,0X00,0X86,0XFC,0XFC,
+0XFC,0X8F,0X38,0X0C,0X00,0X03,0X50,0X34,0X2C,0XF0,0XEC,0XEC,0XBC,0XB0,0XB0,0X3C,
+0X10,0X04,0X90,0X38,0X0C,0X00,0X00,0X90,0X7C,0X74,0X8F,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X94,0XFC,0XFC,0XFC,0X00,0XC8,0XB0,0XAC,0X8F,0X38,
+0X0C,0X00,0X01,0X30,0X08,0X00,0XF8,0XF8,0XF8,0X82,0XFC,0XFC,0XFC,0X00,0X78,0X58,
+0X54,0X8E,0X38,0X0C,0X00,0X00,0X68,0X4C,0X48,0X85,0XFC,0XFC,0XFC,0X00,0XFC,0XFC,
+0XF8,0X8E,0X38,0X0C,0X00,0X00,0XF8,0XFC,0XFC,0X85,0XFC,0XFC,0XFC,0X01,0X88,0X70,
+0X68,0X3C,0X0C,0X00,0X8B,0X38,0X0C,0X00,0X00,0X98,0X7C,0X7C,0X87,0XFC,0XFC,0XFC,
+0X00,0X3C,0X0C,0X04,0X8D,0X38,0X0C,0X00,0X00,0X34,0X0C,0X00,0X86,0XFC,0XFC,0XFC,
+0X8D,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,
+0X89,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X00,0X94,0X78,0X70,0X8D,0X38,0X0C,0X00,
+0X00,0X3C,0X10,0X04,0X84,0XFC,0XFC,0XFC,0X00,0X64,0X44,0X3C,0X8F,0X38,0X0C,0X00,
+0X90,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,
+0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X94,0XFC,0XFC,0XFC,
+0X8F,0X38,0X0C,0X00,0X00,0X4C,0X30,0X2C,0X85,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,
+0X00,0X34,0X08,0X04,0X85,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X5C,0X48,0X40,
+0X86,0XFC,0XFC,0XFC,0X01,0XB8,0XA0,0X9C,0X3C,0X08,0X00,0X8B,0X38,0X0C,0X00,0X00,
+0X38,0X08,0X00,0X87,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X44,0X20,0X18,0X85,
+0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XF0,0XE0,0XDC,0X87,0XFC,0XFC,0XFC,0X89,
+0X38,0X0C,0X00,0X00,0X34,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,
+0XF8,0XF0,0XF0,0X85,0XFC,0XFC,0XFC,0X00,0X3C,0X10,0X00,0X8E,0X38,0X0C,0X00,0X00,
+0XF8,0XFC,0XFC,0X8F,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,
+0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X94,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X04,0X86,
+0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X38,0X0C,0X04,0X84,0XFC,0XFC,0XFC,0X00,
+0XA8,0X8C,0X88,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X01,0XAC,0X98,0X90,0X3C,
+0X08,0X00,0X8C,0X38,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X01,0XFC,0XFC,0XF8,0X3C,0X0C,
+0X00,0X8D,0X38,0X0C,0X00,0X00,0XFC,0XEC,0XE8,0X84,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,
+0XF8,0X8D,0X38,0X0C,0X00,0X01,0X40,0X10,0X04,0XF8,0XFC,0XFC,0X87,0XFC,0XFC,0XFC,
+0X89,0X38,0X0C,0X00,0X00,0X74,0X58,0X50,0X84,0XFC,0XFC,0XFC,0X00,0X74,0X54,0X4C,
+0X8D,0X38,0X0C,0X00,0X00,0X34,0X10,0X08,0X86,0XFC,0XFC,0XFC,0X00,0X50,0X28,0X20,
+0X8E,0X38,0X0C,0X00,0X90,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,
+0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,
+0X93,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XFC,0X34,0X08,0X00,0X8D,0X38,0X0C,0X00,0X00,
+0XE0,0XDC,0XD4,0X86,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X34,0X0C,0X04,0X84,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X01,
+0X88,0X6C,0X64,0X3C,0X0C,0X00,0X8C,0X38,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X01,0X4C,
+0X30,0X2C,0X3C,0X0C,0X00,0X8C,0X38,0X0C,0X00,0X01,0X3C,0X10,0X00,0XFC,0XFC,0XF8,
+0X83,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XFC,0X38,0X08,0X00,0X8D,0X38,0X0C,0X00,0X00,
+0X88,0X70,0X68,0X87,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X89,0X38,0X0C,0X00,0X84,
+0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X00,
+0X44,0X18,0X14,0X8D,0X38,0X0C,0X00,0X00,0X34,0X14,0X0C,0X90,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,
+0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X93,0XFC,0XFC,0XFC,0X00,0XA0,0X94,0X90,0X8D,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,
+0X34,0X08,0X04,0X83,0XFC,0XFC,0XFC,0X00,0XEC,0XE4,0XE0,0X8E,0X38,0X0C,0X00,0X00,
+0X68,0X4C,0X48,0X87,0XFC,0XFC,0XFC,0X01,0X4C,0X24,0X18,0X3C,0X0C,0X00,0X8C,0X38,
+0X0C,0X00,0X00,0XE0,0XD0,0XCC,0X85,0XFC,0XFC,0XFC,0X00,0X34,0X08,0X00,0X8D,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF8,0X8D,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,0XDC,0XD8,0XD4,0X89,0X38,
+0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0XB0,0X9C,0X98,0X8E,0X38,0X0C,0X00,0X87,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XC8,0XBC,0XB8,0X90,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X93,0XFC,0XFC,0XFC,0X00,0X4C,0X28,0X20,0X8D,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X34,
+0X0C,0X04,0X83,0XFC,0XFC,0XFC,0X00,0X48,0X1C,0X18,0X8E,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X84,0X68,0X60,0X85,0XFC,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X00,0X38,0X0C,0X04,0X84,0XFC,0XFC,0XFC,0X00,0X84,0X64,0X5C,0X8D,0X38,
+0X0C,0X00,0X00,0X38,0X08,0X00,0X88,0XFC,0XFC,0XFC,0X01,0X8C,0X78,0X74,0X38,0X0C,
+0X00,0X87,0X3C,0X0C,0X00,0X00,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,
+0X00,0X00,0X80,0X64,0X60,0X87,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X91,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X93,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,
+0X00,0X00,0X68,0X48,0X40,0X87,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X30,0X0C,
+0X08,0X83,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X8E,0X38,0X0C,0X00,0X00,0X48,0X28,0X20,0X85,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,
+0X00,0X00,0X80,0X64,0X5C,0X84,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X34,0X0C,
+0X00,0X98,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X8D,0X38,0X0C,
+0X00,0X01,0X3C,0X0C,0X00,0XF8,0XFC,0XFC,0X90,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,
+0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,
+0X8C,0XFC,0XFC,0XFC,0X93,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,
+0X00,0XC4,0XB8,0XB4,0X86,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF8,0X8E,0X38,0X0C,0X00,
+0X00,0X78,0X5C,0X58,0X83,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X44,0X20,0X10,
+0X88,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X34,0X0C,0X04,0X84,0XFC,0XFC,0XFC,
+0X00,0XEC,0XD8,0XD4,0X8E,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,
+0X8E,0X38,0X0C,0X00,0X00,0XB0,0XA0,0X9C,0X97,0XFC,0XFC,0XFC,0X00,0XB4,0XA8,0XA4,
+0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X8D,0X38,0X0C,0X00,0X00,0X48,0X18,0X10,
+0X91,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,
+0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X92,0XFC,0XFC,0XFC,
+0X00,0XFC,0XF8,0XF4,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X00,0XCC,0XB8,0XB0,
+0X8E,0X38,0X0C,0X00,0X00,0XE4,0XE0,0XDC,0X82,0XFC,0XFC,0XFC,0X00,0XC4,0XB8,0XB4,
+0X8D,0X38,0X0C,0X00,0X01,0X3C,0X08,0X00,0X94,0X8C,0X88,0X88,0XFC,0XFC,0XFC,0X8E,
+0X38,0X0C,0X00,0X00,0X2C,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0X3C,0X10,0X04,0X8E,
+0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X98,
+0XFC,0XFC,0XFC,0X00,0X58,0X38,0X2C,0X8D,0X38,0X0C,0X00,0X00,0X88,0X64,0X5C,0X87,
+0XFC,0XFC,0XFC,0X00,0XEC,0XD4,0XD0,0X8D,0X38,0X0C,0X00,0X00,0X88,0X78,0X70,0X91,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X92,0XFC,0XFC,0XFC,0X00,
+0X84,0X74,0X6C,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X00,
+0X64,0X3C,0X34,0X8E,0X38,0X0C,0X00,0X00,0XF8,0XFC,0XFC,0X82,0XFC,0XFC,0XFC,0X00,
+0X78,0X64,0X60,0X8E,0X38,0X0C,0X00,0X00,0XF4,0XEC,0XEC,0X88,0XFC,0XFC,0XFC,0X8E,
+0X38,0X0C,0X00,0X00,0X70,0X50,0X4C,0X84,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,
+0X3C,0X0C,0X04,0X84,0XFC,0XFC,0XFC,0X00,0XFC,0XFC,0XF8,0X8E,0X38,0X0C,0X00,0X98,
+0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XF4,0XEC,0XE8,0X86,0XFC,0XFC,0XFC,0X01,
+0XF8,0XFC,0XFC,0X3C,0X14,0X0C,0X8D,0X38,0X0C,0X00,0X00,0XFC,0XF8,0XF8,0X91,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X92,0XFC,0XFC,0XFC,0X00,0X40,
+0X18,0X10,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X00,0X38,0X08,0X00,0X8E,0X38,
+0X0C,0X00,0X83,0XFC,0XFC,0XFC,0X00,0X58,0X3C,0X38,0X8D,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,0XC4,0XB0,0XAC,0X8E,0X38,0X0C,0X00,0X00,0XC8,
+0XB4,0XB0,0X83,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X30,
+0X08,0X00,0X84,0XFC,0XFC,0XFC,0X00,0XF0,0XE4,0XDC,0X8D,0X38,0X0C,0X00,0X00,0X38,
+0X10,0X00,0X98,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X92,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X92,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X4C,0X28,0X20,0X87,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X8E,0X38,0X0C,0X00,0X83,0XFC,0XFC,0XFC,0X00,0X60,0X48,0X40,0X8D,0X38,
+0X0C,0X00,0X00,0X34,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,0X34,0X10,0X08,0X8E,0X38,
+0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XB0,0XA0,0X9C,0X84,0XFC,
+0XFC,0XFC,0X00,0XD8,0XC4,0XC0,0X8D,0X38,0X0C,0X00,0X00,0X38,0X1C,0X14,0X98,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X8D,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X92,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X92,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XA4,0X90,0X8C,0X87,0XFC,0XFC,0XFC,0X8D,0X38,
+0X0C,0X00,0X01,0X3C,0X0C,0X00,0X30,0X0C,0X04,0X83,0XFC,0XFC,0XFC,0X00,0X84,0X70,
+0X68,0X8E,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,0X38,0X08,0X00,0X8E,0X38,0X0C,
+0X00,0X84,0XFC,0XFC,0XFC,0X00,0X9C,0X80,0X7C,0X8E,0X38,0X0C,0X00,0X85,0XFC,0XFC,
+0XFC,0X00,0XCC,0XB8,0XB0,0X8D,0X38,0X0C,0X00,0X00,0XAC,0XA4,0XA0,0X97,0XFC,0XFC,
+0XFC,0X00,0XE4,0XDC,0XD8,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X00,0X84,0X70,
+0X6C,0X8D,0X38,0X0C,0X00,0X00,0X50,0X2C,0X20,0X92,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0X91,0XFC,0XFC,0XFC,0X00,0XD8,0XCC,0XCC,0X8E,0X38,0X0C,
+0X00,0X00,0XF8,0XF8,0XF4,0X86,0XFC,0XFC,0XFC,0X00,0XE0,0XC8,0XC4,0X8E,0X38,0X0C,
+0X00,0X00,0XCC,0XC0,0XBC,0X83,0XFC,0XFC,0XFC,0X00,0XB8,0XA8,0XA8,0X8D,0X38,0X0C,
+0X00,0X00,0X60,0X3C,0X34,0X88,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X84,0XFC,0XFC,0XFC,0X00,0X38,0X08,0X00,0X8E,0X38,0X0C,0X00,0X85,0XFC,0XFC,
+0XFC,0X00,0XD8,0XC4,0XBC,0X8D,0X38,0X0C,0X00,0X89,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,
+0XFC,0X8D,0XFC,0XFC,0XFC,0X00,0X98,0X88,0X84,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,
+0XFC,0X00,0X44,0X20,0X14,0X8D,0X38,0X0C,0X00,0X00,0XA8,0X9C,0X98,0X92,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X91,0XFC,0XFC,0XFC,0X00,0X34,0X14,
+0X0C,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X08,0X00,0X87,0XFC,0XFC,0XFC,0X00,0X38,0X08,
+0X00,0X8D,0X38,0X0C,0X00,0X00,0X3C,0X10,0X04,0X84,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,
+0XF8,0X8D,0X38,0X0C,0X00,0X00,0X8C,0X70,0X68,0X87,0XFC,0XFC,0XFC,0X00,0XC8,0XB0,
+0XAC,0X8E,0X38,0X0C,0X00,0X00,0X68,0X4C,0X48,0X83,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,
+0XFC,0X8E,0X38,0X0C,0X00,0X00,0X30,0X08,0X00,0X85,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,
+0XF4,0X8D,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,0XFC,0XFC,0XF8,0X89,0X38,0X0C,
+0X00,0X00,0XA0,0X94,0X94,0X83,0XFC,0XFC,0XFC,0X00,0X60,0X48,0X44,0X8E,0X38,0X0C,
+0X00,0X87,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X93,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0X91,0XFC,0XFC,0XFC,0X8F,0X38,0X0C,0X00,0X86,0XFC,0XFC,
+0XFC,0X01,0XF8,0XF8,0XF4,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X00,0X44,0X1C,0X14,
+0X84,0XFC,0XFC,0XFC,0X01,0XF8,0XF8,0XF8,0X3C,0X08,0X00,0X8C,0X38,0X0C,0X00,0X00,
+0XA4,0X90,0X8C,0X87,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X04,0X8E,0X38,0X0C,0X00,0X84,
+0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X28,0X0C,0X04,0X85,
+0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF8,0X8D,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,
+0X4C,0X2C,0X28,0X89,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0X50,0X38,0X30,0X8E,
+0X38,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF8,0X8E,0X38,0X0C,0X00,0X93,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X91,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0X8E,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XFC,0X3C,
+0X14,0X08,0X8E,0X38,0X0C,0X00,0X00,0XE8,0XE4,0XE4,0X85,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X8C,0X38,0X0C,0X00,0X00,0XD0,0XBC,0XB8,0X87,0XFC,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X00,0X34,0X10,0X04,0X84,0XFC,0XFC,0XFC,0X00,0XF8,0XE8,0XE0,0X8E,0X38,
+0X0C,0X00,0X00,0XD4,0XCC,0XCC,0X85,0XFC,0XFC,0XFC,0X00,0XF4,0XF8,0XF8,0X8D,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X89,0X38,0X0C,0X00,0X00,0XF8,
+0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0X00,0X58,0X44,0X3C,0X8E,0X38,0X0C,0X00,0X86,0XFC,
+0XFC,0XFC,0X00,0X58,0X34,0X28,0X8D,0X38,0X0C,0X00,0X00,0X38,0X14,0X08,0X93,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X91,0XFC,0XFC,0XFC,0X8F,0X38,
+0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X00,0XB4,0XA4,0XA0,0X8E,0X38,0X0C,0X00,0X00,0X3C,
+0X10,0X04,0X86,0XFC,0XFC,0XFC,0X00,0XC4,0XAC,0XA8,0X8C,0X38,0X0C,0X00,0X00,0X94,
+0X80,0X78,0X86,0XFC,0XFC,0XFC,0X00,0X84,0X64,0X5C,0X8E,0X38,0X0C,0X00,0X85,0XFC,
+0XFC,0XFC,0X00,0X70,0X48,0X40,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X81,0X3C,
+0X0C,0X00,0X8B,0X38,0X0C,0X00,0X00,0XF8,0XFC,0XFC,0X86,0XFC,0XFC,0XFC,0X00,0XF8,
+0XEC,0XE8,0X8A,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0X8C,0X7C,0X74,0X8E,0X38,
+0X0C,0X00,0X00,0XF8,0XF8,0XF8,0X85,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0XE0,
+0XCC,0XC4,0X93,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X90,0XFC,
+0XFC,0XFC,0X01,0XA0,0X90,0X88,0X3C,0X0C,0X00,0X8E,0X38,0X0C,0X00,0X05,0X34,0X08,
+0X00,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XB8,0XA8,0XA4,
+0X8E,0X38,0X0C,0X00,0X01,0X3C,0X0C,0X00,0XE4,0XDC,0XDC,0X87,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0X8B,0X38,0X0C,0X00,0X00,0X64,0X40,0X38,0X86,0XFC,0XFC,0XFC,0X8E,
+0X38,0X0C,0X00,0X00,0X64,0X4C,0X40,0X85,0XFC,0XFC,0XFC,0X00,0X34,0X08,0X00,0X8E,
+0X38,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XFC,0X94,0X78,0X70,0X8C,0X38,
+0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XFC,0X8A,0X38,0X0C,0X00,0X00,0X90,
+0X74,0X6C,0X84,0XFC,0XFC,0XFC,0X00,0XF4,0XF0,0XEC,0X8E,0X38,0X0C,0X00,0X00,0XC0,
+0XA8,0XA0,0X83,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X8F,0X38,0X0C,0X00,0X94,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X90,0XFC,0XFC,0XFC,0X00,0X30,
+0X0C,0X00,0X91,0X38,0X0C,0X00,0X02,0X44,0X20,0X18,0X44,0X24,0X18,0X38,0X10,0X04,
+0X8F,0X38,0X0C,0X00,0X00,0X48,0X24,0X1C,0X88,0XFC,0XFC,0XFC,0X00,0X64,0X38,0X30,
+0X8C,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF8,0X8E,0X38,0X0C,0X00,
+0X00,0X5C,0X38,0X30,0X86,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X38,0X14,0X08,
+0X87,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XFC,0X34,0X0C,0X00,0X8B,0X38,0X0C,0X00,0X00,
+0XAC,0XA0,0X9C,0X85,0XFC,0XFC,0XFC,0X00,0X6C,0X50,0X44,0X8A,0X38,0X0C,0X00,0X00,
+0XF0,0XE4,0XE0,0X85,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8E,0X38,0X0C,0X00,0X03,
+0X64,0X4C,0X48,0XFC,0XFC,0XFC,0XF4,0XF0,0XF0,0X54,0X3C,0X34,0X90,0X38,0X0C,0X00,
+0X94,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,
+0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X90,0XFC,0XFC,0XFC,
+0X00,0X3C,0X0C,0X00,0X91,0X38,0X0C,0X00,0X82,0X3C,0X08,0X00,0X8E,0X38,0X0C,0X00,
+0X00,0X3C,0X0C,0X00,0X89,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X8C,0X38,0X0C,0X00,
+0X00,0XEC,0XE8,0XE8,0X83,0XFC,0XFC,0XFC,0X00,0X40,0X28,0X20,0X8D,0X38,0X0C,0X00,
+0X00,0X48,0X1C,0X10,0X86,0XFC,0XFC,0XFC,0X00,0XE8,0XE4,0XE4,0X8E,0X38,0X0C,0X00,
+0X00,0X60,0X50,0X48,0X87,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XFC,0XE8,0XDC,0XD8,0X8B,
+0X38,0X0C,0X00,0X01,0X30,0X08,0X00,0XF8,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0X01,0X50,
+0X34,0X30,0X3C,0X0C,0X00,0X8A,0X38,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X90,0X38,0X0C,
+0X00,0X82,0X3C,0X0C,0X00,0X90,0X38,0X0C,0X00,0X94,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0X90,0XFC,0XFC,0XFC,0X8F,0X38,0X0C,0X00,0X00,0XD8,0XCC,
+0XC8,0X93,0X38,0X0C,0X00,0X00,0XF4,0XE4,0XE4,0X8A,0XFC,0XFC,0XFC,0X00,0XD4,0XC4,
+0XC0,0X8B,0X38,0X0C,0X00,0X04,0X34,0X08,0X00,0XF4,0XF4,0XF0,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0X44,0X20,0X14,0X8D,0X38,0X0C,0X00,0X00,0X48,0X24,0X18,0X87,0XFC,0XFC,
+0XFC,0X00,0XBC,0XAC,0XA4,0X8E,0X38,0X0C,0X00,0X00,0XF8,0XF4,0XF4,0X89,0XFC,0XFC,
+0XFC,0X00,0X48,0X24,0X20,0X8B,0X38,0X0C,0X00,0X03,0X4C,0X28,0X20,0XFC,0XF8,0XF8,
+0XFC,0XF8,0XF8,0XE8,0XE0,0XDC,0X8D,0X38,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X00,0X7C,
+0X68,0X64,0X93,0X38,0X0C,0X00,0X01,0XE4,0XD8,0XD4,0X3C,0X0C,0X00,0X8C,0X38,0X0C,
+0X00,0X00,0X58,0X34,0X2C,0X94,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0X90,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X02,0X94,0X78,0X70,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0X91,0X38,0X0C,0X00,0X00,0X70,0X60,0X5C,0X8C,0XFC,0XFC,0XFC,0X00,
+0X5C,0X44,0X3C,0X8A,0X38,0X0C,0X00,0X01,0X3C,0X0C,0X00,0X34,0X0C,0X00,0X8F,0X38,
+0X0C,0X00,0X00,0X74,0X64,0X5C,0X88,0XFC,0XFC,0XFC,0X00,0X4C,0X20,0X18,0X8E,0X38,
+0X0C,0X00,0X8B,0XFC,0XFC,0XFC,0X00,0X5C,0X48,0X44,0X8B,0X38,0X0C,0X00,0X01,0X3C,
+0X0C,0X00,0X3C,0X08,0X00,0X8E,0X38,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X92,0X38,0X0C,
+0X00,0X02,0XD0,0XC0,0XC0,0XFC,0XFC,0XFC,0XB8,0XAC,0XA8,0X8C,0X38,0X0C,0X00,0X00,
+0XDC,0XD0,0XCC,0X94,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,
+0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8F,
+0XFC,0XFC,0XFC,0X00,0X88,0X6C,0X68,0X8E,0X38,0X0C,0X00,0X05,0XFC,0XF4,0XF4,0XFC,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0X30,0X0C,0X00,0X38,0X10,0X00,0X8D,0X38,
+0X0C,0X00,0X00,0X6C,0X58,0X50,0X8E,0XFC,0XFC,0XFC,0X01,0X88,0X74,0X6C,0X38,0X08,
+0X00,0X98,0X38,0X0C,0X00,0X01,0X30,0X08,0X00,0XF8,0XF8,0XF8,0X89,0XFC,0XFC,0XFC,
+0X00,0X38,0X08,0X00,0X8E,0X38,0X0C,0X00,0X8D,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X04,
+0X99,0X38,0X0C,0X00,0X00,0X74,0X50,0X44,0X87,0XFC,0XFC,0XFC,0X00,0XCC,0XC0,0XBC,
+0X8F,0X38,0X0C,0X00,0X01,0X40,0X0C,0X04,0XF4,0XF0,0XEC,0X82,0XFC,0XFC,0XFC,0X8C,
+0X38,0X0C,0X00,0X00,0XF8,0XFC,0XF8,0X94,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,
+0XFC,0XFC,0XFC,0X8F,0XFC,0XFC,0XFC,0X8F,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X01,
+0XF4,0XE8,0XE4,0X38,0X08,0X00,0X8B,0X38,0X0C,0X00,0X00,0XE8,0XE0,0XDC,0X91,0XFC,
+0XFC,0XFC,0X00,0X34,0X0C,0X00,0X94,0X38,0X0C,0X00,0X01,0X3C,0X0C,0X00,0X50,0X34,
+0X30,0X8C,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X84,0X64,0X5C,0X8E,0XFC,0XFC,
+0XFC,0X02,0XFC,0XF8,0XF4,0X30,0X08,0X00,0X3C,0X0C,0X00,0X94,0X38,0X0C,0X00,0X02,
+0X38,0X08,0X00,0X38,0X0C,0X04,0XFC,0XF8,0XF0,0X88,0XFC,0XFC,0XFC,0X01,0XF4,0XE4,
+0XE0,0X3C,0X0C,0X00,0X8B,0X38,0X0C,0X00,0X02,0X3C,0X10,0X00,0X30,0X10,0X08,0XF8,
+0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0X01,0X44,0X18,0X0C,0X34,0X0C,0X00,0X8A,0X38,0X0C,
+0X00,0X00,0XF8,0XFC,0XFC,0X94,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0X8E,0XFC,0XFC,0XFC,0X01,0XFC,0XF8,0XFC,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,
+0X00,0X3C,0X10,0X04,0X85,0XFC,0XFC,0XFC,0X01,0XF8,0XFC,0XF8,0XB0,0X98,0X94,0X87,
+0X38,0X0C,0X00,0X02,0X3C,0X0C,0X00,0X70,0X50,0X44,0XF8,0XFC,0XF8,0X94,0XFC,0XFC,
+0XFC,0X02,0X54,0X30,0X24,0X3C,0X0C,0X00,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0X01,
+0X3C,0X0C,0X00,0X64,0X40,0X34,0X8E,0XFC,0XFC,0XFC,0X00,0XAC,0XA0,0X9C,0X8D,0X38,
+0X0C,0X00,0X01,0X3C,0X0C,0X00,0XE0,0XD4,0XD0,0X90,0XFC,0XFC,0XFC,0X04,0XF8,0XFC,
+0XFC,0XD4,0XC4,0XC0,0X34,0X0C,0X00,0X3C,0X0C,0X00,0X3C,0X0C,0X00,0X8E,0X38,0X0C,
+0X00,0X01,0X50,0X2C,0X24,0XFC,0XFC,0XF8,0X8C,0XFC,0XFC,0XFC,0X00,0XFC,0XF8,0XF4,
+0X89,0X38,0X0C,0X00,0X01,0X3C,0X0C,0X00,0X58,0X34,0X28,0X86,0XFC,0XFC,0XFC,0X01,
+0XB4,0XA8,0XA4,0X34,0X0C,0X00,0X89,0X38,0X0C,0X00,0X00,0X34,0X0C,0X00,0X95,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8F,0XFC,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X00,0X38,0X14,0X0C,0X88,0XFC,0XFC,0XFC,0X06,0XFC,0XFC,0XF8,0XE0,0XCC,
+0XC4,0X44,0X20,0X14,0X38,0X0C,0X04,0X34,0X0C,0X00,0X78,0X5C,0X58,0XFC,0XF8,0XF8,
+0X98,0XFC,0XFC,0XFC,0X0D,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XF8,0XA0,0X88,
+0X80,0X50,0X30,0X24,0X34,0X0C,0X04,0X38,0X0C,0X00,0X34,0X0C,0X00,0X34,0X0C,0X04,
+0X40,0X1C,0X10,0X68,0X44,0X3C,0X9C,0X80,0X7C,0XE4,0XD4,0XCC,0XFC,0XFC,0XF8,0XA2,
+0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X95,0XFC,0XFC,0XFC,0X04,0XFC,0XFC,0XF8,0X88,
+0X6C,0X64,0X34,0X0C,0X00,0X34,0X0C,0X00,0X38,0X0C,0X04,0X82,0X34,0X0C,0X00,0X03,
+0X30,0X0C,0X04,0X70,0X50,0X48,0XC8,0XB4,0XAC,0XFC,0XFC,0XF8,0X94,0XFC,0XFC,0XFC,
+0X08,0XFC,0XF0,0XEC,0X80,0X64,0X5C,0X4C,0X28,0X20,0X34,0X0C,0X04,0X50,0X2C,0X20,
+0X90,0X74,0X70,0XFC,0XF4,0XF0,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XAA,0XFC,0XFC,0XFC,
+0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,
+0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8E,0XFC,0XFC,0XFC,0X01,0XF4,0XE8,0XE4,
+0X3C,0X08,0X00,0X8D,0X38,0X0C,0X00,0X00,0XFC,0XF0,0XEC,0XFF,0XFC,0XFC,0XFC,0XC5,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8E,0XFC,0XFC,0XFC,0X01,
+0X4C,0X28,0X1C,0X3C,0X0C,0X00,0X8D,0X38,0X0C,0X00,0XFF,0XFC,0XFC,0XFC,0XC6,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8E,0XFC,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0XFF,0XFC,0XFC,0XFC,0XC6,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0X00,0XF8,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X00,0X28,0X04,0X00,0XFF,0XFC,0XFC,0XFC,0XC6,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0X00,0XFC,0XF4,0XF4,0X8E,0X38,
+0X0C,0X00,0X00,0X84,0X70,0X6C,0XFF,0XFC,0XFC,0XFC,0XC6,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0X00,0XC8,0XB4,0XAC,0X8E,0X38,
+0X0C,0X00,0XFF,0XFC,0XFC,0XFC,0XC7,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0XFF,0XFC,
+0XFC,0XFC,0XC7,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8D,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X3C,0X14,0X0C,0XFF,0XFC,0XFC,0XFC,0XC7,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0X8E,0X38,
+0X0C,0X00,0X00,0X74,0X5C,0X58,0XFF,0XFC,0XFC,0XFC,0XC7,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8C,0XFC,0XFC,0XFC,0X00,0XE8,0XE0,0XDC,0X8E,0X38,
+0X0C,0X00,0XFF,0XFC,0XFC,0XFC,0XC8,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0X8C,0XFC,0XFC,0XFC,0X00,0X8C,0X6C,0X68,0X8E,0X38,0X0C,0X00,0XFF,0XFC,
+0XFC,0XFC,0XC8,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8C,0XFC,
+0XFC,0XFC,0X8E,0X38,0X0C,0X00,0X00,0X40,0X18,0X0C,0XFF,0XFC,0XFC,0XFC,0XC8,0XFC,
+0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0X8D,0XFC,
+0XFC,0XF8,0XFF,0XFC,0XFC,0XFC,0XC9,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X05,0X68,0X48,0X40,0X6C,0X48,0X40,0X6C,0X48,0X40,
+0X64,0X48,0X40,0X74,0X58,0X50,0XE0,0XCC,0XC8,0X84,0XFC,0XFC,0XFC,0X01,0X64,0X48,
+0X40,0X88,0X70,0X68,0X83,0XFC,0XFC,0XFC,0X04,0X84,0X64,0X5C,0X38,0X08,0X00,0X38,
+0X0C,0X00,0X44,0X20,0X18,0XFC,0XFC,0XF8,0X83,0XFC,0XFC,0XFC,0X01,0X64,0X48,0X40,
+0X6C,0X48,0X40,0X82,0X68,0X48,0X40,0X00,0X98,0X84,0X7C,0X83,0XFC,0XFC,0XFC,0X01,
+0X64,0X48,0X40,0X84,0X74,0X74,0X88,0XFC,0XFC,0XFC,0X02,0XFC,0XFC,0XF8,0X64,0X48,
+0X40,0XEC,0XE0,0XDC,0X83,0XFC,0XFC,0XFC,0X01,0X64,0X48,0X40,0X68,0X48,0X40,0X85,
+0XFC,0XFC,0XFC,0X01,0X64,0X48,0X44,0X68,0X48,0X3C,0X85,0XFC,0XFC,0XFC,0X00,0X68,
+0X48,0X3C,0X84,0X6C,0X48,0X40,0X81,0X68,0X48,0X40,0X03,0XFC,0XFC,0XFC,0XE0,0XE0,
+0XE0,0X68,0X48,0X40,0XB4,0XA4,0XA0,0X84,0XFC,0XFC,0XFC,0X04,0X70,0X54,0X4C,0X68,
+0X48,0X40,0XFC,0XFC,0XFC,0XF8,0XFC,0XF8,0X68,0X44,0X3C,0X82,0X6C,0X48,0X40,0X01,
+0X64,0X48,0X3C,0X98,0X84,0X7C,0X83,0XFC,0XFC,0XFC,0X81,0X68,0X48,0X40,0X84,0X6C,
+0X48,0X40,0X04,0X64,0X48,0X40,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XAC,0XA4,0X9C,0X68,
+0X44,0X3C,0X83,0X6C,0X48,0X40,0X01,0X94,0X78,0X6C,0XFC,0XFC,0XF8,0X82,0XFC,0XFC,
+0XFC,0X85,0X6C,0X48,0X40,0X81,0X68,0X48,0X40,0X00,0X6C,0X50,0X4C,0XAF,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X07,0X38,0X0C,
+0X00,0X30,0X0C,0X00,0X2C,0X08,0X00,0X2C,0X08,0X00,0X30,0X0C,0X04,0X3C,0X0C,0X00,
+0X3C,0X0C,0X00,0XB8,0XA4,0X9C,0X82,0XFC,0XFC,0XFC,0X01,0X3C,0X0C,0X00,0X60,0X3C,
+0X34,0X82,0XFC,0XFC,0XFC,0X06,0X38,0X0C,0X00,0X38,0X08,0X00,0X6C,0X58,0X54,0X98,
+0X84,0X80,0X2C,0X0C,0X00,0X38,0X0C,0X00,0X2C,0X0C,0X04,0X82,0XFC,0XFC,0XFC,0X0B,
+0X38,0X0C,0X00,0X2C,0X0C,0X00,0X2C,0X08,0X00,0X2C,0X08,0X00,0X2C,0X0C,0X00,0X38,
+0X0C,0X00,0X3C,0X0C,0X00,0XA4,0X88,0X80,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,0X0C,
+0X00,0X60,0X48,0X44,0X88,0XFC,0XFC,0XFC,0X03,0X34,0X10,0X08,0X40,0X14,0X0C,0X38,
+0X08,0X00,0XF8,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0X01,0X3C,0X08,0X00,0X74,0X5C,0X54,
+0X83,0XFC,0XFC,0XFC,0X02,0XFC,0XF8,0XF8,0X38,0X0C,0X00,0XCC,0XBC,0XB4,0X85,0XFC,
+0XFC,0XFC,0X02,0X38,0X0C,0X00,0X34,0X10,0X04,0X2C,0X0C,0X00,0X83,0X2C,0X08,0X00,
+0X05,0X30,0X08,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X6C,0X4C,0X44,0X38,0X0C,0X00,
+0XF8,0XF8,0XF4,0X82,0XFC,0XFC,0XFC,0X01,0XE8,0XD4,0XD0,0X3C,0X10,0X00,0X82,0XFC,
+0XFC,0XFC,0X0C,0X38,0X0C,0X00,0X2C,0X0C,0X00,0X2C,0X08,0X00,0X2C,0X08,0X00,0X2C,
+0X0C,0X00,0X34,0X0C,0X04,0X38,0X0C,0X00,0XA8,0X8C,0X88,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0X38,0X0C,0X00,0X30,0X08,0X00,0X2C,0X0C,0X00,0X83,0X2C,0X08,0X00,0X05,0X30,
+0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X98,0X84,0X80,0X3C,0X0C,0X00,0X30,0X0C,
+0X04,0X82,0X2C,0X08,0X00,0X04,0X34,0X0C,0X00,0X3C,0X0C,0X00,0X34,0X04,0X00,0XFC,
+0XFC,0XFC,0XFC,0XFC,0XFC,0X82,0X2C,0X08,0X00,0X05,0X34,0X08,0X00,0X38,0X0C,0X00,
+0X30,0X08,0X00,0X2C,0X08,0X00,0X2C,0X08,0X00,0X38,0X18,0X14,0XAF,0XFC,0XFC,0XFC,
+0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,
+0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,
+0X83,0XFC,0XFC,0XFC,0X02,0XF8,0XFC,0XFC,0X8C,0X6C,0X60,0X38,0X0C,0X00,0X82,0XFC,
+0XFC,0XFC,0X05,0X3C,0X0C,0X00,0X60,0X3C,0X34,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X2C,
+0X08,0X00,0X38,0X08,0X00,0X83,0XFC,0XFC,0XFC,0X01,0XFC,0XF4,0XEC,0X38,0X0C,0X00,
+0X82,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X05,0X78,0X58,0X50,
+0X38,0X0C,0X00,0XF4,0XFC,0XF8,0XFC,0XFC,0XFC,0X38,0X0C,0X00,0X60,0X48,0X44,0X88,
+0XFC,0XFC,0XFC,0X02,0X38,0X0C,0X00,0XE4,0XD8,0XD4,0X38,0X0C,0X00,0X84,0XFC,0XFC,
+0XFC,0X02,0X4C,0X2C,0X24,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0X82,0XFC,0XFC,0XFC,0X01,
+0X3C,0X10,0X04,0X34,0X0C,0X00,0X86,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0XE8,0XDC,
+0XD8,0X88,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0X38,0X0C,0X04,0X82,0XFC,0XFC,0XFC,
+0X01,0X38,0X0C,0X00,0X78,0X64,0X5C,0X82,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X84,
+0XFC,0XFC,0XFC,0X05,0X78,0X58,0X54,0X3C,0X0C,0X00,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,
+0X38,0X0C,0X00,0X38,0X1C,0X18,0X87,0XFC,0XFC,0XFC,0X01,0X94,0X84,0X80,0X38,0X0C,
+0X00,0X84,0XFC,0XFC,0XFC,0X01,0XFC,0XF8,0XF4,0X3C,0X0C,0X00,0X84,0XFC,0XFC,0XFC,
+0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X85,0XFC,
+0XFC,0XFC,0X09,0X3C,0X10,0X00,0X30,0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X3C,
+0X0C,0X00,0X60,0X3C,0X34,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,0X10,0X04,0X34,0X0C,
+0X04,0X84,0XFC,0XFC,0XFC,0X04,0X68,0X48,0X44,0XE8,0XE0,0XDC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X04,0X38,0X0C,0X00,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0X38,0X0C,0X00,0X60,0X48,0X44,0X87,0XFC,0XFC,0XFC,0X04,0XA8,0X9C,
+0X98,0X3C,0X0C,0X00,0XFC,0XFC,0XFC,0X38,0X08,0X00,0X2C,0X04,0X00,0X83,0XFC,0XFC,
+0XFC,0X06,0XF8,0XFC,0XFC,0X40,0X10,0X08,0X38,0X0C,0X04,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0X4C,0X38,0X30,0X3C,0X0C,0X00,0X87,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0XE8,
+0XDC,0XD8,0X89,0XFC,0XFC,0XFC,0X04,0X38,0X0C,0X00,0X50,0X34,0X2C,0XFC,0XFC,0XFC,
+0X38,0X0C,0X00,0X40,0X14,0X0C,0X83,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X85,0XFC,
+0XFC,0XFC,0X04,0X3C,0X0C,0X00,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0X38,0X0C,0X00,0X38,
+0X1C,0X18,0X87,0XFC,0XFC,0XFC,0X01,0X94,0X84,0X80,0X38,0X0C,0X00,0X84,0XFC,0XFC,
+0XFC,0X02,0XF8,0XFC,0XFC,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0X83,0XFC,0XFC,0XFC,0X02,
+0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X85,0XFC,0XFC,
+0XFC,0X0B,0X7C,0X5C,0X58,0X3C,0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X3C,0X0C,
+0X00,0X60,0X3C,0X34,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XDC,0XC8,0XC0,0X38,0X0C,0X00,
+0X50,0X30,0X28,0XF8,0XFC,0XFC,0X86,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X84,0XFC,
+0XFC,0XFC,0X05,0XD8,0XD0,0XC8,0X3C,0X10,0X04,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,
+0X0C,0X00,0X60,0X48,0X44,0X87,0XFC,0XFC,0XFC,0X04,0X30,0X08,0X00,0X68,0X44,0X3C,
+0XFC,0XFC,0XFC,0XD8,0XCC,0XC4,0X3C,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X05,0XF8,0XF8,
+0XF8,0X34,0X0C,0X00,0X64,0X54,0X50,0XF4,0XF8,0XF8,0X38,0X08,0X00,0XF4,0XE8,0XE4,
+0X87,0XFC,0XFC,0XFC,0X02,0X38,0X08,0X00,0XE4,0XDC,0XD8,0XF8,0XFC,0XFC,0X88,0XFC,
+0XFC,0XFC,0X03,0XB0,0XA0,0X9C,0X38,0X0C,0X00,0X34,0X10,0X08,0X3C,0X0C,0X00,0X84,
+0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X05,0XD4,0XCC,0XC8,0X3C,
+0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,0X0C,0X00,0X30,0X20,0X14,0X87,0XFC,
+0XFC,0XFC,0X01,0X98,0X84,0X80,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X01,0XC8,0XB8,
+0XB0,0X3C,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,
+0XFC,0XF8,0XB2,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,
+0XFC,0XFC,0X00,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X05,0XD4,0XC0,0XB8,0X3C,0X0C,
+0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X3C,0X0C,0X00,0X60,0X3C,0X34,0X82,0XFC,0XFC,
+0XFC,0X06,0XBC,0XA4,0X9C,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0X40,0X14,
+0X08,0X98,0X88,0X84,0XF8,0XFC,0XFC,0X82,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0XE0,0XD8,0XD4,0X07,0XE0,0XD8,0XD8,0X98,0X7C,0X78,0X3C,0X08,0X00,0X48,0X1C,0X14,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,0X0C,0X00,0X60,0X48,0X44,0X87,0XFC,0XFC,0XFC,
+0X05,0X38,0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XF8,0XF8,0X38,0X0C,0X00,
+0X80,0X70,0X68,0X84,0XFC,0XFC,0XFC,0X03,0XA4,0X8C,0X84,0X3C,0X0C,0X00,0X34,0X0C,
+0X00,0X40,0X18,0X10,0X88,0XFC,0XFC,0XFC,0X86,0X38,0X0C,0X00,0X00,0XA0,0X84,0X7C,
+0X84,0XFC,0XFC,0XFC,0X81,0X38,0X0C,0X00,0X00,0XFC,0XF8,0XF0,0X84,0XFC,0XFC,0XFC,
+0X09,0X34,0X0C,0X00,0XDC,0XD8,0XD0,0XE0,0XD8,0XD4,0XE0,0XD8,0XD4,0XE4,0XD8,0XD8,
+0X94,0X78,0X70,0X3C,0X0C,0X00,0X48,0X20,0X18,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X87,
+0X38,0X0C,0X00,0X81,0XFC,0XFC,0XFC,0X08,0X94,0X84,0X80,0X3C,0X08,0X00,0X40,0X18,
+0X0C,0X44,0X1C,0X0C,0X48,0X18,0X10,0X44,0X1C,0X0C,0X38,0X0C,0X00,0X40,0X0C,0X00,
+0XA8,0X8C,0X88,0X84,0XFC,0XFC,0XFC,0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,
+0XF8,0XB2,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,
+0XFC,0X00,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X05,0XD4,0XC0,0XB8,0X3C,0X0C,0X00,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X3C,0X0C,0X00,0X60,0X3C,0X34,0X83,0XFC,0XFC,0XFC,
+0X08,0XFC,0XF8,0XFC,0XD4,0XD4,0XD4,0X2C,0X0C,0X08,0X3C,0X10,0X00,0X38,0X0C,0X00,
+0X38,0X10,0X04,0XF8,0XF8,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X84,0X38,0X0C,0X00,
+0X01,0X3C,0X0C,0X00,0X28,0X10,0X04,0X82,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0X60,
+0X48,0X44,0X86,0XFC,0XFC,0XFC,0X01,0X94,0X74,0X70,0X3C,0X10,0X04,0X82,0XFC,0XFC,
+0XFC,0X01,0X54,0X30,0X28,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X03,0XF8,0XFC,0XFC,
+0X34,0X08,0X00,0X38,0X0C,0X00,0XF8,0XFC,0XFC,0X88,0XFC,0XFC,0XFC,0X01,0X38,0X0C,
+0X00,0X60,0X44,0X38,0X84,0X5C,0X48,0X44,0X00,0XA8,0X9C,0X9C,0X84,0XFC,0XFC,0XFC,
+0X81,0X38,0X0C,0X00,0X00,0X7C,0X54,0X4C,0X84,0XFC,0XFC,0XFC,0X83,0X38,0X0C,0X00,
+0X02,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X2C,0X0C,0X04,0X82,0XFC,0XFC,0XFC,0X01,0X38,
+0X0C,0X00,0X2C,0X10,0X08,0X84,0X5C,0X48,0X44,0X09,0X5C,0X4C,0X44,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0X94,0X84,0X80,0X38,0X0C,0X00,0X2C,0X0C,0X00,0X2C,0X0C,0X04,0X34,
+0X10,0X08,0X38,0X0C,0X00,0X78,0X58,0X50,0X86,0XFC,0XFC,0XFC,0X02,0XCC,0XC0,0XB8,
+0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,
+0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X05,0X64,
+0X40,0X3C,0X38,0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X3C,0X0C,0X00,0X60,0X3C,
+0X34,0X88,0XFC,0XFC,0XFC,0X05,0X3C,0X08,0X00,0X74,0X58,0X54,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0X38,0X0C,0X00,0XF8,0XFC,0XFC,0X87,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,
+0X60,0X48,0X44,0X85,0XFC,0XFC,0XFC,0X02,0XF8,0XFC,0XFC,0X3C,0X0C,0X00,0X3C,0X0C,
+0X00,0X84,0X38,0X0C,0X00,0X85,0XFC,0XFC,0XFC,0X01,0X34,0X0C,0X00,0X38,0X0C,0X00,
+0X89,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0XE4,0XDC,0XD8,0X88,0XFC,0XFC,0XFC,0X05,
+0XF8,0XFC,0XFC,0X3C,0X0C,0X04,0X38,0X0C,0X00,0XC0,0XB4,0XB0,0X3C,0X0C,0X00,0XB4,
+0XA0,0X9C,0X83,0XFC,0XFC,0XFC,0X00,0X34,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X01,0X38,
+0X0C,0X00,0X3C,0X1C,0X18,0X87,0XFC,0XFC,0XFC,0X01,0X98,0X84,0X80,0X38,0X0C,0X00,
+0X82,0XFC,0XFC,0XFC,0X02,0XFC,0XF8,0XF8,0X3C,0X0C,0X00,0X78,0X5C,0X54,0X85,0XFC,
+0XFC,0XFC,0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,0XFC,0XFC,0XFC,
+0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,
+0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,
+0X85,0XFC,0XFC,0XFC,0X08,0X3C,0X0C,0X00,0X34,0X18,0X10,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0X3C,0X0C,0X00,0X60,0X3C,0X34,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0X38,0X0C,0X00,
+0X85,0XFC,0XFC,0XFC,0X04,0X38,0X0C,0X00,0X30,0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0X60,0X48,0X44,0X85,
+0XFC,0XFC,0XFC,0X02,0XF8,0XF0,0XEC,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0X83,0XFC,0XFC,
+0XFC,0X01,0X38,0X0C,0X00,0X2C,0X08,0X00,0X84,0XFC,0XFC,0XFC,0X01,0X34,0X0C,0X00,
+0X38,0X0C,0X00,0X89,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0XE8,0XDC,0XD8,0X88,0XFC,
+0XFC,0XFC,0X05,0X7C,0X58,0X50,0X38,0X0C,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X30,
+0X0C,0X04,0X38,0X0C,0X00,0X83,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X01,0X38,0X0C,0X00,0X38,0X1C,0X18,0X87,0XFC,0XFC,0XFC,0X01,0X94,0X84,0X80,
+0X38,0X0C,0X00,0X83,0XFC,0XFC,0XFC,0X02,0XBC,0XAC,0XA8,0X3C,0X0C,0X00,0XFC,0XFC,
+0XF8,0X84,0XFC,0XFC,0XFC,0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X00,
+0X38,0X0C,0X00,0X83,0XFC,0XFC,0XFC,0X02,0XF8,0XFC,0XFC,0X6C,0X48,0X40,0X3C,0X0C,
+0X00,0X82,0XFC,0XFC,0XFC,0X05,0X3C,0X0C,0X00,0X60,0X3C,0X34,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0X30,0X08,0X00,0X38,0X10,0X04,0X83,0XFC,0XFC,0XFC,0X05,0XF8,0XFC,0XFC,
+0X38,0X0C,0X00,0XAC,0X98,0X94,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,0X0C,0X00,0X88,
+0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0X60,0X48,0X44,0X85,0XFC,0XFC,0XFC,0X81,0X34,
+0X0C,0X00,0X84,0XFC,0XFC,0XFC,0X01,0XB0,0X98,0X90,0X38,0X0C,0X00,0X84,0XFC,0XFC,
+0XFC,0X01,0X34,0X0C,0X00,0X38,0X0C,0X00,0X89,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,
+0XE8,0XDC,0XD8,0X87,0XFC,0XFC,0XFC,0X07,0XFC,0XF8,0XF4,0X38,0X08,0X00,0XB8,0XA4,
+0XA0,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0X38,0X0C,0X00,0X3C,0X10,0X04,
+0X82,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,
+0X38,0X1C,0X18,0X87,0XFC,0XFC,0XFC,0X01,0X94,0X84,0X80,0X38,0X0C,0X00,0X83,0XFC,
+0XFC,0XFC,0X02,0XF8,0XFC,0XFC,0X38,0X08,0X00,0X38,0X0C,0X00,0X84,0XFC,0XFC,0XFC,
+0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,
+0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X07,0X38,0X0C,0X00,0X30,0X0C,
+0X00,0X34,0X0C,0X00,0X30,0X0C,0X00,0X34,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X10,0X00,
+0XFC,0XF0,0XEC,0X82,0XFC,0XFC,0XFC,0X01,0X3C,0X0C,0X00,0X60,0X3C,0X34,0X82,0XFC,
+0XFC,0XFC,0X06,0X38,0X0C,0X00,0X3C,0X0C,0X00,0X2C,0X0C,0X04,0X60,0X48,0X40,0X30,
+0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X04,0X82,0XFC,0XFC,0XFC,0X00,0X38,0X0C,0X00,
+0X88,0XFC,0XFC,0XFC,0X81,0X38,0X0C,0X00,0X84,0X34,0X0C,0X00,0X02,0XFC,0XFC,0XFC,
+0X3C,0X0C,0X00,0XB0,0XA0,0X9C,0X85,0XFC,0XFC,0XFC,0X01,0X38,0X0C,0X00,0XB0,0XA0,
+0X98,0X83,0XFC,0XFC,0XFC,0X01,0X34,0X0C,0X00,0X3C,0X0C,0X04,0X89,0XFC,0XFC,0XFC,
+0X00,0X38,0X0C,0X00,0X85,0X34,0X0C,0X00,0X04,0X34,0X0C,0X04,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XFC,0X38,0X0C,0X00,0X34,0X0C,0X04,0X83,0XFC,0XFC,0XFC,0X06,0XFC,0XF8,0XF4,
+0X40,0X0C,0X04,0X44,0X2C,0X24,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X38,0X0C,0X00,0XF8,
+0XFC,0XFC,0X87,0XFC,0XFC,0XFC,0X02,0X38,0X0C,0X00,0X3C,0X08,0X00,0X30,0X0C,0X00,
+0X84,0X34,0X0C,0X00,0X03,0XC8,0XBC,0XBC,0XFC,0XFC,0XFC,0X94,0X84,0X80,0X38,0X0C,
+0X00,0X84,0XFC,0XFC,0XFC,0X02,0XF4,0XFC,0XF8,0X3C,0X0C,0X00,0X7C,0X64,0X60,0X83,
+0XFC,0XFC,0XFC,0X02,0XCC,0XC0,0XB8,0X38,0X0C,0X00,0XFC,0XFC,0XF8,0XB2,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,
+0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XB2,0XFC,0XFC,0XFC,0X06,0XA0,0X84,
+0X7C,0XA0,0X80,0X7C,0XA0,0X84,0X7C,0X9C,0X84,0X7C,0XB8,0XA0,0X9C,0XFC,0XF8,0XF8,
+0XF8,0XF8,0XF8,0X83,0XFC,0XFC,0XFC,0X01,0X9C,0X84,0X7C,0XB0,0X9C,0X98,0X83,0XFC,
+0XFC,0XFC,0X04,0XE4,0XD0,0XCC,0X34,0X0C,0X04,0X38,0X0C,0X00,0X44,0X20,0X14,0XF8,
+0XEC,0XE8,0X83,0XFC,0XFC,0XFC,0X00,0X9C,0X84,0X7C,0X88,0XFC,0XFC,0XFC,0X08,0X9C,
+0X84,0X7C,0XA0,0X80,0X7C,0XA0,0X84,0X7C,0XA0,0X84,0X7C,0XA0,0X80,0X7C,0XA0,0X80,
+0X7C,0XA0,0X84,0X7C,0XFC,0XF8,0XF8,0X9C,0X84,0X7C,0X86,0XFC,0XFC,0XFC,0X01,0X98,
+0X84,0X7C,0XA0,0X84,0X80,0X83,0XFC,0XFC,0XFC,0X01,0XA0,0X88,0X80,0X9C,0X84,0X7C,
+0X89,0XFC,0XFC,0XFC,0X04,0XA0,0X80,0X7C,0XA0,0X84,0X7C,0XA0,0X84,0X7C,0XA0,0X80,
+0X7C,0XA0,0X80,0X7C,0X82,0XA0,0X84,0X7C,0X02,0XFC,0XFC,0XFC,0X9C,0X84,0X7C,0X9C,
+0X84,0X7C,0X85,0XFC,0XFC,0XFC,0X04,0XD8,0XC4,0XC0,0XA0,0X84,0X7C,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0X9C,0X84,0X7C,0X88,0XFC,0XFC,0XFC,0X0B,0XA0,0X84,0X80,0XA0,0X80,
+0X7C,0XA0,0X84,0X7C,0XA0,0X84,0X7C,0XA0,0X80,0X7C,0XA0,0X80,0X7C,0XA0,0X84,0X7C,
+0XA0,0X84,0X7C,0XE8,0XE0,0XE0,0XFC,0XFC,0XFC,0XC8,0XC0,0XBC,0X9C,0X84,0X7C,0X85,
+0XFC,0XFC,0XFC,0X01,0XA4,0X90,0X8C,0X9C,0X80,0X7C,0X83,0XFC,0XFC,0XFC,0X01,0XE4,
+0XDC,0XDC,0X9C,0X84,0X7C,0XB3,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XFF,0XFC,0XFC,0XFC,0XE5,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,
+0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0XF4,0XF8,0XFC,0XF2,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X82,0X3C,0X0C,0X00,0X00,0X40,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,
+0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,
+0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X38,0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,
+0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,
+0X00,0X83,0X38,0X0C,0X00,0X07,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,
+0X0C,0X00,0X3C,0X0C,0X00,0X38,0X0C,0X00,0X38,0X0C,0X00,0X3C,0X0C,0X00,0X82,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8E,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8E,0X38,
+0X0C,0X00,0X00,0X3C,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X8E,0X38,
+0X0C,0X00,0X00,0X34,0X0C,0X00,0X8C,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,
+0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,0X38,
+0X0C,0X00,0X0B,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0XFC,0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,
+0XFC,0XF8,0XFC,0XFC,0XF8,0XFC,0XFC,0X8D,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,
+0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,0X38,0X0C,0X00,0X99,
+0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X04,0X82,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,
+0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,
+0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,0X38,0X0C,0X00,0X99,
+0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X04,0X82,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,
+0XFC,0XFC,0XFC,0X00,0X3C,0X0C,0X00,0X82,0X38,0X0C,0X00,0XEF,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X04,0X82,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0XF6,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0XF6,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,
+0X3C,0X0C,0X00,0XF6,0X38,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XF1,0XFC,0XFC,0XFC,0X00,
+0X44,0X20,0X14,0XF5,0X34,0X0C,0X00,0X00,0X30,0X0C,0X00,0X99,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0X96,0XFC,0XFC,0XFC,0X00,0XCC,0XCC,0XCC,0X8A,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X81,0XFC,0XFC,0XFC,0X01,0XDC,0XDC,0XDC,0X00,
+0X00,0X00,0X90,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X81,0X00,
+0X00,0X00,0X92,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0XB5,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X96,0XFC,0XFC,0XFC,0X03,0X54,0X54,0X54,0X00,0X00,0X00,0X00,0X00,0X00,
+0XF0,0XF0,0XF0,0X97,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X91,0XFC,0XFC,0XFC,0X00,
+0XB8,0XB8,0XB8,0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X95,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X81,
+0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,
+0X38,0X38,0X38,0X85,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X4C,0X4C,0X4C,0X84,
+0XFC,0XFC,0XFC,0X02,0XF8,0XF8,0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X86,0XFC,0XFC,
+0XFC,0X01,0X30,0X30,0X30,0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,
+0X00,0XF8,0XF8,0XF8,0X8D,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X97,0XFC,0XFC,0XFC,
+0X82,0X00,0X00,0X00,0X97,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,
+0X96,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X91,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X00,0XC8,0XC8,0XC8,0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,
+0X95,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0X0C,0X0C,0X0C,0X87,0XFC,0XFC,0XFC,
+0X81,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X00,0X2C,0X2C,0X2C,0X82,0X00,0X00,0X00,
+0X83,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X83,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,
+0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,
+0X86,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X00,0X98,0X98,0X98,0X8D,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X97,0XFC,0XFC,0XFC,
+0X82,0X00,0X00,0X00,0X88,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X83,0XFC,0XFC,0XFC,
+0X96,0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X90,0XFC,0XFC,0XFC,
+0X02,0X04,0X04,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X97,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X87,0XFC,
+0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0X82,0XFC,0XFC,0XFC,0X01,0XF8,
+0XF8,0XF8,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X84,0X00,0X00,0X00,0X83,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X88,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X00,0XFC,0XFC,0XFC,0X91,0X00,0X00,0X00,0X86,0XFC,0XFC,
+0XFC,0X81,0X00,0X00,0X00,0X00,0X50,0X50,0X50,0X88,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X97,0XFC,0XFC,0XFC,0X8B,0X00,0X00,0X00,0X00,0X70,0X70,0X70,0X83,0XFC,0XFC,
+0XFC,0X96,0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X4C,0X4C,
+0X4C,0X90,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X9E,0XFC,0XFC,0XFC,0X98,0XFC,0XFC,0XFC,0X02,0X84,0X84,0X84,0X00,0X00,0X00,
+0XD0,0XD0,0XD0,0X90,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,
+0X8C,0X8C,0X8C,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X00,0X04,0X04,0X04,0X93,0X00,0X00,0X00,0X86,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X54,0X54,0X54,0X88,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X97,0XFC,0XFC,0XFC,0X8B,0X00,0X00,0X00,0X00,0X60,0X60,0X60,0X82,
+0XFC,0XFC,0XFC,0X0A,0XF8,0XF8,0XF8,0XD4,0XD4,0XD4,0XE0,0XE0,0XE0,0XDC,0XDC,0XDC,
+0XE4,0XE4,0XE4,0XE4,0XE4,0XE4,0XF0,0XF0,0XF0,0XEC,0XEC,0XEC,0XEC,0XEC,0XEC,0XF8,
+0XF8,0XF8,0XF8,0XF8,0XF8,0X82,0XF4,0XF4,0XF4,0X81,0XF8,0XF8,0XF8,0X81,0XEC,0XEC,
+0XEC,0X05,0XF0,0XF0,0XF0,0XE4,0XE4,0XE4,0XE8,0XE8,0XE8,0XDC,0XDC,0XDC,0XE0,0XE0,
+0XE0,0XD4,0XD4,0XD4,0X8D,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X5C,0X5C,0X5C,
+0X90,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,
+0X9E,0XFC,0XFC,0XFC,0X9A,0XFC,0XFC,0XFC,0X00,0XD0,0XD0,0XD0,0X90,0X00,0X00,0X00,
+0X87,0XFC,0XFC,0XFC,0X02,0X00,0X00,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X8E,0X00,
+0X00,0X00,0X87,0XFC,0XFC,0XFC,0X01,0X04,0X04,0X04,0XF4,0XF4,0XF4,0X88,0XFC,0XFC,
+0XFC,0X00,0XD4,0XD4,0XD4,0X8E,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X04,0X04,
+0X04,0X8B,0X00,0X00,0X00,0X97,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0XB1,0XFC,0XFC,
+0XFC,0X00,0XD4,0XD4,0XD4,0X82,0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X93,0X00,0X00,
+0X00,0X95,0XFC,0XFC,0XFC,0XA2,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X92,0XFC,0XFC,
+0XFC,0X8E,0X00,0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,
+0XFC,0X81,0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X97,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X90,0XFC,0XFC,0XFC,0X90,0X00,0X00,0X00,0X8F,0XFC,0XFC,
+0XFC,0X83,0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X93,0X00,0X00,0X00,0X95,0XFC,0XFC,
+0XFC,0XA2,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X98,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X92,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X02,0XF8,0XF8,0XF8,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,
+0X50,0X50,0X50,0X88,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X97,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X90,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X88,0X14,0X14,0X14,0X83,
+0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X8E,0XFC,0XFC,0XFC,0X94,
+0X00,0X00,0X00,0X95,0XFC,0XFC,0XFC,0X94,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X00,
+0XF8,0XF8,0XF8,0X83,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,
+0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X89,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X84,0X00,0X00,0X00,0X88,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X50,0X50,0X50,0X88,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X92,0X00,0X00,0X00,0X88,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X83,
+0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X03,0X24,0X24,0X24,0X00,0X00,0X00,0X00,0X00,
+0X00,0X14,0X14,0X14,0X85,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,
+0X93,0XFC,0XFC,0XFC,0X00,0XF4,0XF4,0XF4,0X83,0X00,0X00,0X00,0X00,0X04,0X04,0X04,
+0X82,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X00,0X04,0X04,0X04,
+0X82,0X00,0X00,0X00,0X00,0XBC,0XBC,0XBC,0X88,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,
+0X88,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0X83,0XFC,0XFC,0XFC,
+0X81,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X89,0X00,0X00,0X00,0X87,0XFC,0XFC,0XFC,
+0X8E,0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X92,0X00,0X00,0X00,0X88,0XFC,0XFC,0XFC,
+0X90,0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0X34,0X34,0X34,
+0X8B,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X82,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,
+0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X00,0X9C,0X9C,0X9C,
+0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,
+0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,
+0X00,0X3C,0X3C,0X3C,0X83,0X00,0X00,0X00,0X87,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,
+0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X02,0X04,0X04,0X04,
+0X00,0X00,0X00,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X04,0XC4,
+0XC4,0XC4,0XE8,0XE8,0XE8,0XF0,0XF0,0XF0,0XF0,0XF0,0XF0,0XE8,0XE8,0XE8,0X82,0X00,
+0X00,0X00,0X87,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X88,0XFC,0XFC,0XFC,0X90,0X00,
+0X00,0X00,0X8F,0XFC,0XFC,0XFC,0X84,0X00,0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X81,0X00,
+0X00,0X00,0X87,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X97,0XFC,
+0XFC,0XFC,0X81,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,
+0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X86,0XFC,
+0XFC,0XFC,0X81,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X00,0XC0,0XC0,0XC0,0X8C,0X00,
+0X00,0X00,0X00,0X04,0X04,0X04,0X85,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X81,0XFC,
+0XFC,0XFC,0X00,0XC8,0XC8,0XC8,0X82,0X00,0X00,0X00,0X81,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X01,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0XA6,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X88,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X9E,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X02,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X00,
+0X04,0X04,0X04,0X87,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X9C,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X09,0X0C,0X0C,0X0C,0X24,0X24,0X24,0X20,0X20,
+0X20,0X08,0X08,0X08,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X20,0X20,0X20,
+0X20,0X20,0X20,0X0C,0X0C,0X0C,0X82,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X00,0XC0,
+0XC0,0XC0,0X8D,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X02,0XF0,0XF0,0XF0,0XFC,0XFC,
+0XFC,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X01,0XFC,0XFC,0XFC,0XF8,0XF8,0XF8,0X82,
+0X00,0X00,0X00,0X06,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0XFC,0XFC,0XFC,
+0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0XA7,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X8C,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0XA8,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X00,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X95,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X9E,0XFC,0XFC,0XFC,0X9C,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X91,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X8E,0XFC,0XFC,0XFC,0X84,0X00,0X00,0X00,0X00,0XFC,0XFC,
+0XFC,0X83,0X00,0X00,0X00,0X01,0XFC,0XFC,0XFC,0XF8,0XF8,0XF8,0X84,0X00,0X00,0X00,
+0X84,0XFC,0XFC,0XFC,0X00,0X5C,0X5C,0X5C,0X88,0X00,0X00,0X00,0X02,0X98,0X98,0X98,
+0XFC,0XFC,0XFC,0X6C,0X6C,0X6C,0X89,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X96,0X00,
+0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X04,0XA0,0XA0,0XA0,0X00,0X00,0X00,0X00,0X00,0X00,
+0XD8,0XD8,0XD8,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8D,0XFC,0XFC,0XFC,0X92,0X00,
+0X00,0X00,0X96,0XFC,0XFC,0XFC,0X98,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X82,0XFC,
+0XFC,0XFC,0X8E,0X00,0X00,0X00,0X87,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X88,0XFC,
+0XFC,0XFC,0X82,0X00,0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X04,0X04,0X04,0X04,0XFC,0XFC,
+0XFC,0X04,0X04,0X04,0X00,0X00,0X00,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0X04,
+0X04,0X04,0X82,0X00,0X00,0X00,0X05,0XFC,0XFC,0XFC,0X70,0X70,0X70,0XFC,0XFC,0XFC,
+0X00,0X00,0X00,0X00,0X00,0X00,0XC0,0XC0,0XC0,0X84,0XFC,0XFC,0XFC,0X00,0X5C,0X5C,
+0X5C,0X88,0X00,0X00,0X00,0X02,0X8C,0X8C,0X8C,0XFC,0XFC,0XFC,0X70,0X70,0X70,0X89,
+0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X03,0XE0,0XE0,0XE0,0XE8,
+0XE8,0XE8,0XF0,0XF0,0XF0,0XF0,0XF0,0XF0,0X85,0XEC,0XEC,0XEC,0X02,0XE4,0XE4,0XE4,
+0XE8,0XE8,0XE8,0XE0,0XE0,0XE0,0X82,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X81,0X00,
+0X00,0X00,0X00,0X04,0X04,0X04,0X93,0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X8C,0XFC,
+0XFC,0XFC,0X92,0X00,0X00,0X00,0X96,0XFC,0XFC,0XFC,0X98,0XFC,0XFC,0XFC,0X81,0X00,
+0X00,0X00,0X81,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,
+0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X02,0X68,
+0X68,0X68,0X00,0X00,0X00,0X00,0X00,0X00,0X87,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,
+0X8C,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X07,0XFC,0XFC,0XFC,0X00,0X00,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X00,0X00,0X00,
+0X00,0X00,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X85,0XFC,0XFC,
+0XFC,0X02,0X6C,0X6C,0X6C,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,
+0X00,0X00,0X00,0X04,0X8C,0X8C,0X8C,0XFC,0XFC,0XFC,0X70,0X70,0X70,0X00,0X00,0X00,
+0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X92,
+0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X91,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X00,0X50,0X50,0X50,0X82,0X00,0X00,0X00,0X82,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0X93,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X97,0XFC,0XFC,0XFC,0X06,0X04,0X04,0X04,0X00,
+0X00,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X00,
+0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X86,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X00,0XFC,0XFC,0XFC,0X90,0X00,0X00,
+0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X82,0XFC,0XFC,
+0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X03,0XFC,0XFC,
+0XFC,0X00,0X00,0X00,0X00,0X00,0X00,0XC4,0XC4,0XC4,0X85,0XFC,0XFC,0XFC,0X02,0X6C,
+0X6C,0X6C,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X04,0X8C,0X8C,0X8C,0XFC,0XFC,0XFC,0X70,0X70,0X70,0X00,0X00,0X00,0X00,0X00,0X00,
+0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X92,0X00,0X00,0X00,
+0X85,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X8A,0X00,0X00,0X00,
+0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X88,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,
+0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X82,0X00,0X00,0X00,
+0X93,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X97,0XFC,0XFC,0XFC,
+0X82,0X00,0X00,0X00,0X81,0XFC,0XFC,0XFC,0X8E,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,
+0X04,0XEC,0XEC,0XEC,0X00,0X00,0X00,0X00,0X00,0X00,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,
+0X90,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X3C,0X3C,0X3C,
+0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X84,0X00,0X00,0X00,
+0X86,0XFC,0XFC,0XFC,0X00,0X6C,0X6C,0X6C,0X88,0X00,0X00,0X00,0X02,0X8C,0X8C,0X8C,
+0XFC,0XFC,0XFC,0X70,0X70,0X70,0X89,0X00,0X00,0X00,0XAA,0XFC,0XFC,0XFC,0X8A,0X00,
+0X00,0X00,0X8E,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X00,0X58,0X58,0X58,0X84,0XFC,
+0XFC,0XFC,0X03,0X04,0X04,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X92,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X96,0XFC,0XFC,0XFC,0X02,
+0X04,0X04,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X8E,0X00,0X00,
+0X00,0X85,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X81,0XFC,0XFC,0XFC,0X90,0X00,0X00,
+0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,
+0X00,0X84,0XFC,0XFC,0XFC,0X00,0XE0,0XE0,0XE0,0X82,0X00,0X00,0X00,0X00,0XF8,0XF8,
+0XF8,0X86,0XFC,0XFC,0XFC,0X00,0X70,0X70,0X70,0X88,0X00,0X00,0X00,0X02,0X8C,0X8C,
+0X8C,0XFC,0XFC,0XFC,0X70,0X70,0X70,0X89,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X01,
+0XE0,0XE0,0XE0,0X0C,0X0C,0X0C,0X8E,0XFC,0XFC,0XFC,0X01,0X00,0X00,0X00,0X24,0X24,
+0X24,0X8B,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X8D,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X00,0XF4,0XF4,0XF4,0X91,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,
+0XFC,0X96,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,
+0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X84,0XFC,0XFC,0XFC,0X02,0X60,0X60,0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X89,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X83,
+0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0X86,0XFC,0XFC,0XFC,0X02,0X6C,0X6C,0X6C,0X00,
+0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X04,0X8C,0X8C,
+0X8C,0XFC,0XFC,0XFC,0X70,0X70,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X81,0XFC,0XFC,
+0XFC,0X81,0X00,0X00,0X00,0X00,0X10,0X10,0X10,0X82,0XFC,0XFC,0XFC,0X81,0X00,0X00,
+0X00,0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X85,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X00,0XD0,0XD0,
+0XD0,0X87,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0X87,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X00,0X8C,0X8C,0X8C,0X90,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X9E,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,
+0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0X04,0X04,
+0X04,0X89,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X02,0XF8,0XF8,
+0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,
+0XFC,0XFC,0XFC,0X85,0X00,0X00,0X00,0X00,0X88,0X88,0X88,0X85,0XFC,0XFC,0XFC,0X02,
+0X6C,0X6C,0X6C,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,
+0X00,0X04,0X8C,0X8C,0X8C,0XFC,0XFC,0XFC,0X70,0X70,0X70,0X00,0X00,0X00,0X00,0X00,
+0X00,0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X02,0X60,0X60,
+0X60,0X00,0X00,0X00,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X81,0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X82,
+0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X83,
+0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X00,0XA0,0XA0,0XA0,0X83,0X00,0X00,0X00,0X8F,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X9E,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X82,
+0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,
+0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X02,
+0X14,0X14,0X14,0X00,0X00,0X00,0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X89,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,
+0X00,0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X01,0X04,0X04,0X04,0XFC,0XFC,0XFC,
+0X83,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X02,0X6C,0X6C,0X6C,0X00,0X00,0X00,0X00,
+0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X04,0X8C,0X8C,0X8C,0XFC,0XFC,
+0XFC,0X70,0X70,0X70,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X8A,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X82,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X86,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X86,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X83,0X00,
+0X00,0X00,0X8C,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X97,0X00,
+0X00,0X00,0X00,0XF8,0XF8,0XF8,0X93,0XFC,0XFC,0XFC,0X94,0XFC,0XFC,0XFC,0X02,0X04,
+0X04,0X04,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X01,0XFC,0XFC,0XFC,0X64,0X64,0X64,0X84,
+0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X00,0XF4,0XF4,0XF4,0X82,0X00,0X00,0X00,0X8A,
+0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X84,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,
+0X74,0X74,0X74,0X82,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0X04,0X04,0X04,0X82,
+0XFC,0XFC,0XFC,0X00,0X6C,0X6C,0X6C,0X88,0X00,0X00,0X00,0X02,0X8C,0X8C,0X8C,0XFC,
+0XFC,0XFC,0X70,0X70,0X70,0X89,0X00,0X00,0X00,0X89,0XFC,0XFC,0XFC,0X82,0X00,0X00,
+0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X03,0XF8,0XF8,
+0XF8,0X00,0X00,0X00,0X00,0X00,0X00,0XEC,0XEC,0XEC,0X82,0XFC,0XFC,0XFC,0X82,0X00,
+0X00,0X00,0X83,0XFC,0XFC,0XFC,0X85,0X00,0X00,0X00,0X00,0XF8,0XF8,0XF8,0X86,0XFC,
+0XFC,0XFC,0X88,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X84,0X00,0X00,0X00,0X8E,0XFC,
+0XFC,0XFC,0X83,0X00,0X00,0X00,0X02,0X04,0X04,0X04,0XFC,0XFC,0XFC,0XFC,0XFC,0XFC,
+0X97,0X00,0X00,0X00,0X94,0XFC,0XFC,0XFC,0X95,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X84,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,
+0X81,0XFC,0XFC,0XFC,0X83,0X00,0X00,0X00,0X00,0X3C,0X3C,0X3C,0X84,0XFC,0XFC,0XFC,
+0X00,0X08,0X08,0X08,0X8B,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8A,0XFC,0XFC,0XFC,
+0X00,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X00,0XFC,0XFC,0XFC,
+0X82,0X00,0X00,0X00,0X85,0XFC,0XFC,0XFC,0X02,0X3C,0X3C,0X3C,0X00,0X00,0X00,0X00,
+0X00,0X00,0X83,0XFC,0XFC,0XFC,0X00,0X5C,0X5C,0X5C,0X88,0X00,0X00,0X00,0X02,0X98,
+0X98,0X98,0XFC,0XFC,0XFC,0X6C,0X6C,0X6C,0X89,0X00,0X00,0X00,0X88,0XFC,0XFC,0XFC,
+0X82,0X00,0X00,0X00,0X00,0X80,0X80,0X80,0X83,0XFC,0XFC,0XFC,0X02,0XB8,0XB8,0XB8,
+0X00,0X00,0X00,0X00,0X00,0X00,0X83,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X83,0XFC,
+0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,0XFC,0XFC,0X84,0X00,0X00,0X00,0X00,0XF8,
+0XF8,0XF8,0X88,0XFC,0XFC,0XFC,0X86,0X00,0X00,0X00,0X00,0X80,0X80,0X80,0X83,0XFC,
+0XFC,0XFC,0X82,0X00,0X00,0X00,0X90,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X82,0XFC,
+0XFC,0XFC,0X97,0X00,0X00,0X00,0X94,0XFC,0XFC,0XFC,0X9C,0XFC,0XFC,0XFC,0X81,0X00,
+0X00,0X00,0X83,0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X01,0XF4,0XF4,0XF4,0XFC,0XFC,
+0XFC,0X82,0X00,0X00,0X00,0X93,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X91,0XFC,0XFC,
+0XFC,0X81,0X00,0X00,0X00,0X82,0XF8,0XF8,0XF8,0X88,0XFC,0XFC,0XFC,0X00,0X08,0X08,
+0X08,0X83,0XFC,0XFC,0XFC,0X02,0X5C,0X5C,0X5C,0X00,0X00,0X00,0X04,0X04,0X04,0X84,
+0XFC,0XFC,0XFC,0X81,0X00,0X00,0X00,0X04,0XC4,0XC4,0XC4,0XFC,0XFC,0XFC,0X6C,0X6C,
+0X6C,0X00,0X00,0X00,0X00,0X00,0X00,0X84,0XFC,0XFC,0XFC,0X82,0X00,0X00,0X00,0X8A,
+0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X8B,0XFC,0XFC,0XFC,0X00,0XF4,0XF4,0XF4,0X85,
+0XFC,0XFC,0XFC,0X00,0XF8,0XF8,0XF8,0X85,0XFC,0XFC,0XFC,0X00,0X00,0X00,0X00,0X99,
+0XFC,0XFC,0XFC,0X00,0XF0,0XF0,0XF0,0XC4,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,0XFF,0XFC,0XFC,0XFC,0XFF,
+0XFC,0XFC,0XFC,0X83,0XFC,0XFC,0XFC,
+};
+
+#endif
@@ -0,0 +1,30 @@
+#include "Inc/lcd_init.h"
+
+/* Ļʼ,ʽlcd_panel.h */
+static const uint8_t lcd_panel_init[] = {
+	0xE0, 15, 0x00, 0x07, 0x0F, 0x0D, 0x1B, 0x0A, 0x3C, 0x78, 0x4A, 0x07, 0x0E, 0x09, 0x1B, 0x1E, 0x0F,
+	0xE1, 15, 0x00, 0x22, 0x24, 0x06, 0x12, 0x07, 0x36, 0x47, 0x47, 0x06, 0x0A, 0x07, 0x30, 0x37, 0x0F,
+	0xC0, 2, 0x10, 0x10,
+	0xC1, 1, 0x41,
+	0xC5, 3, 0x00, 0x22, 0x80,
+	0x36, 0, // Memory Access Control, ȡmadctl[USE_HORIZONTAL]
+	0x3A, 1, 0x66, // Interface Mode Control˴ILI9486Ϊ0X55
+	0xB0, 1, 0x00, // Interface Mode Control
+	0xB1, 2, 0xB0, 0x11, // Frame rate 70HZ
+	0xB4, 1, 0x02,
+	0xB6, 2, 0x02, 0x02, // RGB/MCU Interface Control
+	0xB7, 1, 0xC6,
+	0xE9, 1, 0x00,
+	0xF7, 4, 0xA9, 0x51, 0x2C, 0x82,
+	0x11, 0 | LCD_INIT_DELAY, 120, // ʱ120ms
+	0x21, 0,
+	0x29, 0,
+};
+
+const LCD_Panel lcd_panel = {
+	lcd_panel_init,
+	sizeof(lcd_panel_init),
+	{0x48, 0x88, 0x28, 0xE8}, // 0x36,USE_HORIZONTAL 0~3
+	{0, 0, 0, 0}, // ƫ
+	{0, 0, 0, 0}, // ƫ
+};
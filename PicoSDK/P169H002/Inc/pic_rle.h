@@ -0,0 +1,2414 @@
+/*  PicoSDK/tools/gen_rle_image.py  pic.h ,޸ͼƬ,ֹ༭ */
+#ifndef __PIC_RLE_H
+#define __PIC_RLE_H
+
+const unsigned char gImage_img1_rle[27224] = { // 240x276 RGB565,ԭ132488ֽ
+0X52,0X4C,0X45,0X10,0X00,0XF0,0X01,0X14,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,
+0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,
+0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,
+0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,
+0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,
+0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XDE,0X21,0X04,0X03,
+0X21,0X24,0X29,0X45,0X21,0X04,0X18,0XE3,0X93,0X21,0X04,0X00,0X29,0X45,0XA4,0X21,
+0X04,0X81,0X21,0X24,0X87,0X21,0X04,0X02,0X18,0XE3,0X21,0X24,0X21,0X24,0XC5,0X21,
+0X04,0XDE,0X21,0X04,0X03,0X18,0XE3,0X18,0XC3,0X21,0X04,0X21,0X24,0X93,0X21,0X04,
+0X00,0X21,0X24,0XA4,0X21,0X04,0X01,0X21,0X24,0X18,0XE3,0X88,0X21,0X04,0X81,0X18,
+0XE3,0XC5,0X21,0X04,0XAB,0X21,0X04,0X81,0X18,0XE3,0X89,0X21,0X04,0X00,0X18,0XE3,
+0X94,0X21,0X04,0X02,0XDE,0XFB,0XDE,0XDB,0X4A,0X49,0X8D,0X21,0X04,0X03,0XB5,0XB6,
+0XEF,0X7D,0XE7,0X3C,0X21,0X24,0X91,0X21,0X04,0X05,0X21,0X24,0X9C,0XD3,0XFF,0XFF,
+0X52,0XAA,0X21,0X04,0X21,0X24,0X89,0X21,0X04,0X81,0X29,0X45,0X8D,0X21,0X24,0X01,
+0X29,0X65,0X18,0XE3,0X85,0X21,0X04,0X03,0X21,0X24,0XEF,0X5D,0X4A,0X49,0X29,0X65,
+0X85,0X21,0X04,0X03,0X29,0X45,0XF7,0X9E,0XE7,0X1C,0X21,0X24,0X87,0X21,0X04,0X02,
+0X39,0XE7,0XB5,0XB6,0X94,0XB2,0X82,0X21,0X04,0X07,0X31,0X86,0X18,0XC3,0XD6,0X9A,
+0XD6,0XBA,0X10,0XA2,0X29,0X45,0XCE,0X59,0XE7,0X1C,0X85,0X21,0X04,0X00,0X18,0XE3,
+0X90,0X21,0X24,0X00,0X18,0XC3,0X95,0X21,0X04,0X99,0X21,0X04,0X81,0X18,0XE3,0X90,
+0X21,0X04,0X00,0X21,0X24,0X8A,0X21,0X04,0X81,0X21,0X24,0X91,0X21,0X04,0X03,0X18,
+0XE3,0XFF,0XDF,0XFF,0XFF,0X5A,0XCB,0X8D,0X21,0X04,0X02,0XB5,0XB6,0XFF,0XFF,0XFF,
+0XFF,0X92,0X21,0X04,0X04,0X21,0X24,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0X18,0XE3,0X8B,
+0X21,0X04,0X00,0XF7,0XBE,0X8D,0XFF,0XFF,0X01,0XF7,0XBE,0X18,0XE3,0X85,0X21,0X04,
+0X03,0X6B,0X6D,0XF7,0XBE,0XF7,0XBE,0X6B,0X4D,0X85,0X21,0X04,0X03,0X18,0XC3,0XFF,
+0XFF,0XFF,0XFF,0X21,0X24,0X87,0X21,0X04,0X0D,0X8C,0X71,0XFF,0XDF,0XFF,0XFF,0X18,
+0XC3,0X21,0X04,0X21,0X04,0X18,0XE3,0X21,0X04,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X18,
+0XE3,0XFF,0XFF,0XF7,0XBE,0X87,0X21,0X04,0X8F,0XFF,0XFF,0X00,0X29,0X45,0X95,0X21,
+0X04,0X97,0X21,0X04,0X05,0X29,0X45,0X21,0X24,0XCE,0X59,0XFF,0XFF,0X42,0X08,0X18,
+0XE3,0X89,0X21,0X04,0X08,0X18,0XE3,0X18,0XC3,0X21,0X24,0X52,0XAA,0XEF,0X7D,0XF7,
+0XBE,0XF7,0X9E,0X8C,0X71,0X18,0XC3,0X82,0X21,0X04,0X81,0X18,0XE3,0X07,0X21,0X04,
+0X5A,0XEB,0XE7,0X3C,0XF7,0XBE,0XEF,0X7D,0X7B,0XCF,0X21,0X24,0X21,0X24,0X8E,0X21,
+0X04,0X03,0X18,0XE3,0XFF,0XFF,0XFF,0XFF,0X4A,0X69,0X8D,0X21,0X04,0X03,0XBD,0XD7,
+0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X83,0X21,0X04,0X01,0X21,0X24,0X29,0X45,0X8B,0X21,
+0X04,0X05,0X18,0XE3,0X7B,0XEF,0XFF,0XFF,0XFF,0XFF,0X73,0XAE,0X21,0X24,0X83,0X21,
+0X04,0X01,0X18,0XC3,0X21,0X24,0X83,0X21,0X04,0X01,0X29,0X45,0XEF,0X7D,0X8E,0XFF,
+0XFF,0X84,0X21,0X04,0X08,0X29,0X45,0X18,0XE3,0XF7,0XBE,0XFF,0XFF,0XEF,0X7D,0X9C,
+0XF3,0X9C,0XD3,0X9C,0XF3,0X31,0XA6,0X82,0X18,0XE3,0X05,0X21,0X24,0XFF,0XFF,0XFF,
+0XFF,0X21,0X24,0X18,0XE3,0X18,0XE3,0X85,0X21,0X04,0X11,0X6B,0X6D,0XFF,0XFF,0XFF,
+0XFF,0X18,0XE3,0X29,0X65,0X9C,0XD3,0X6B,0X4D,0X6B,0X6D,0XFF,0XFF,0XFF,0XFF,0X6B,
+0X6D,0X63,0X2C,0XFF,0XFF,0XF7,0XBE,0X6B,0X6D,0X73,0XAE,0X9C,0XF3,0X39,0XE7,0X82,
+0X21,0X04,0X00,0X21,0X24,0X8F,0XFF,0XFF,0X96,0X21,0X04,0X97,0X21,0X04,0X05,0X29,
+0X45,0X6B,0X4D,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X18,0XE3,0X8A,0X21,0X04,0X01,0X18,
+0XC3,0XFF,0XDF,0X82,0XFF,0XFF,0X08,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0X18,0XE3,0X21,
+0X04,0X21,0X04,0X18,0XE3,0X18,0XC3,0XF7,0XBE,0X85,0XFF,0XFF,0X00,0X29,0X45,0X8F,
+0X21,0X04,0X81,0XFF,0XFF,0X00,0X4A,0X69,0X86,0X21,0X04,0X01,0X21,0X24,0X21,0X04,
+0X84,0X21,0X24,0X03,0XB5,0XB6,0XFF,0XFF,0XF7,0XBE,0X29,0X45,0X84,0X21,0X24,0X81,
+0X18,0XE3,0X00,0X21,0X24,0X83,0X21,0X04,0X00,0XEF,0X7D,0X89,0XFF,0XFF,0X00,0XFF,
+0XDF,0X83,0XFF,0XFF,0X01,0XFF,0XDF,0XF7,0X9E,0X83,0X21,0X04,0X03,0X18,0XC3,0XEF,
+0X7D,0XFF,0XFF,0XA5,0X34,0X89,0X21,0X24,0X02,0X21,0X04,0XFF,0XFF,0XFF,0XFF,0X84,
+0X21,0X04,0X01,0X18,0XE3,0XD6,0XBA,0X83,0XFF,0XFF,0X09,0XFF,0XDF,0XFF,0XFF,0X21,
+0X24,0X21,0X24,0X21,0X04,0X21,0X04,0X18,0XE3,0XFF,0XFF,0XF7,0XBE,0X18,0XE3,0X87,
+0X21,0X04,0X07,0X63,0X2C,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X73,0XAE,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XDF,0X88,0XFF,0XFF,0X00,0X9C,0XD3,0X82,0X21,0X04,0X02,0X21,0X24,0XFF,
+0XFF,0XF7,0XBE,0X8A,0X21,0X24,0X02,0X10,0XA2,0XF7,0XBE,0XFF,0XFF,0X96,0X21,0X04,
+0X94,0X21,0X04,0X03,0X18,0XE3,0X21,0X24,0X21,0X04,0X6B,0X6D,0X82,0XFF,0XFF,0X00,
+0X52,0XAA,0X8B,0X21,0X04,0X08,0XEF,0X5D,0XFF,0XDF,0XFF,0XFF,0XF7,0XBE,0XA5,0X34,
+0XE7,0X1C,0XFF,0XFF,0XFF,0XFF,0XEF,0X5D,0X82,0X21,0X04,0X05,0XE7,0X3C,0XFF,0XDF,
+0XFF,0XFF,0XFF,0XFF,0XAD,0X55,0XD6,0X9A,0X82,0XFF,0XFF,0X82,0X21,0X04,0X81,0X18,
+0XE3,0X00,0X21,0X04,0X84,0X21,0X24,0X83,0X21,0X04,0X0B,0X18,0XC3,0XFF,0XFF,0XFF,
+0XFF,0X4A,0X49,0X21,0X24,0X18,0XC3,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X21,
+0X04,0X39,0XC7,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X8A,0XFF,0XFF,0X02,0XF7,0XBE,0X21,
+0X04,0X18,0XE3,0X83,0X21,0X04,0X04,0XF7,0X9E,0XFF,0XFF,0XF7,0XBE,0XFF,0XFF,0XFF,
+0XFF,0X82,0XFF,0XDF,0X86,0XFF,0XFF,0X02,0XFF,0XDF,0XFF,0XFF,0XEF,0X5D,0X83,0X21,
+0X04,0X01,0X21,0X24,0XEF,0X7D,0X8B,0XFF,0XFF,0X02,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,
+0X82,0X21,0X04,0X81,0X29,0X45,0X09,0X94,0XB2,0XFF,0XFF,0XFF,0XFF,0X73,0XAE,0X6B,
+0X6D,0XFF,0XFF,0XFF,0XFF,0X7B,0XEF,0X18,0XC3,0X6B,0X4D,0X87,0XFF,0XFF,0X1B,0X9C,
+0XF3,0X21,0X04,0X21,0X24,0X18,0XE3,0X21,0X04,0X21,0X04,0X5A,0XCB,0XFF,0XFF,0XFF,
+0XFF,0X18,0XC3,0X52,0XAA,0XFF,0XFF,0XCE,0X59,0XD6,0XBA,0XFF,0XDF,0XFF,0XFF,0XCE,
+0X79,0XD6,0XBA,0XFF,0XFF,0XF7,0XBE,0XD6,0X9A,0XCE,0X79,0XFF,0XDF,0X7B,0XCF,0X21,
+0X04,0X21,0X04,0X21,0X24,0X18,0XE3,0X8C,0XFF,0XFF,0X02,0XF7,0XBE,0XFF,0XFF,0XFF,
+0XFF,0X96,0X21,0X04,0X95,0X21,0X04,0X06,0X18,0XC3,0XCE,0X79,0XFF,0XDF,0XFF,0XDF,
+0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X89,0X21,0X04,0X1A,0X21,0X24,0X52,0XAA,0XFF,0XFF,
+0XFF,0XDF,0X9C,0XF3,0X21,0X04,0X21,0X24,0X29,0X45,0XCE,0X59,0XFF,0XFF,0XFF,0XDF,
+0X31,0X86,0X21,0X24,0X29,0X45,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0X21,0X04,0X21,0X24,
+0X10,0XA2,0X4A,0X49,0XFF,0XFF,0XFF,0XDF,0XA5,0X14,0X21,0X04,0X21,0X24,0X6B,0X6D,
+0X8D,0XFF,0XFF,0X00,0XF7,0X9E,0X83,0XFF,0XFF,0X06,0X21,0X24,0X21,0X04,0X21,0X04,
+0X39,0XC7,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X82,0XFF,
+0XFF,0X81,0XF7,0XBE,0X82,0XFF,0XFF,0X02,0XF7,0X9E,0X21,0X04,0X18,0XE3,0X83,0X21,
+0X04,0X07,0XF7,0X9E,0XFF,0XFF,0X9C,0XF3,0X21,0X04,0X21,0X24,0X8C,0X71,0X52,0X8A,
+0X29,0X65,0X82,0X21,0X04,0X06,0XEF,0X7D,0X63,0X2C,0X21,0X24,0X21,0X24,0XB5,0X96,
+0XFF,0XFF,0XEF,0X5D,0X83,0X21,0X04,0X02,0X21,0X24,0XEF,0X7D,0XF7,0XBE,0X8C,0XFF,
+0XFF,0X1B,0XFF,0XDF,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X94,0XB2,0XFF,0XFF,
+0XFF,0XDF,0X84,0X10,0X29,0X45,0X9C,0XD3,0XFF,0XDF,0XFF,0XDF,0X21,0X24,0X31,0XA6,
+0X8C,0X51,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,
+0XFF,0XFF,0XBD,0XD7,0X21,0X24,0X21,0X04,0X52,0X8A,0X83,0XFF,0XFF,0X13,0XF7,0XBE,
+0XFF,0XFF,0XFF,0XFF,0X29,0X45,0X39,0XC7,0X31,0X86,0XFF,0XFF,0XF7,0XBE,0X4A,0X49,
+0X39,0XC7,0XFF,0XDF,0XFF,0XFF,0X31,0XA6,0X31,0XA6,0X31,0X86,0X21,0X24,0X21,0X04,
+0X21,0X04,0X21,0X24,0X21,0X04,0X8F,0XFF,0XFF,0X00,0X21,0X24,0X95,0X21,0X04,0X94,
+0X21,0X04,0X03,0X21,0X24,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X82,0XFF,0XFF,0X00,0X52,
+0XAA,0X8A,0X21,0X04,0X0E,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0X18,0XC3,0X21,0X24,0X18,
+0XE3,0X21,0X04,0X39,0XC7,0XF7,0X9E,0XF7,0X9E,0X31,0XA6,0X21,0X24,0XA5,0X34,0XFF,
+0XFF,0XFF,0XFF,0X83,0X21,0X04,0X08,0X18,0XE3,0XEF,0X7D,0XFF,0XFF,0XFF,0XFF,0X18,
+0XE3,0X21,0X04,0X7B,0XCF,0XFF,0XFF,0XF7,0XBE,0X90,0XFF,0XFF,0X0C,0X21,0X24,0X21,
+0X04,0X21,0X04,0X39,0XC7,0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X21,0X24,0X21,0X04,0X21,
+0X04,0XBD,0XD7,0XFF,0XFF,0XFF,0XFF,0X83,0X21,0X04,0X02,0XF7,0XBE,0XFF,0XFF,0XEF,
+0X7D,0X85,0X21,0X04,0X81,0XFF,0XDF,0X0F,0X94,0X92,0X21,0X24,0XC6,0X38,0XFF,0XFF,
+0XFF,0XFF,0X18,0XE3,0X31,0XA6,0X21,0X24,0XAD,0X55,0XFF,0XDF,0XFF,0XFF,0XF7,0XBE,
+0X39,0XE7,0XAD,0X75,0XFF,0XFF,0XEF,0X7D,0X83,0X21,0X04,0X11,0X21,0X24,0XEF,0X7D,
+0XFF,0XFF,0X94,0XB2,0X18,0XE3,0X18,0XE3,0X21,0X24,0XEF,0X5D,0X9C,0XF3,0X29,0X45,
+0X21,0X24,0X21,0X24,0X21,0X04,0XFF,0XDF,0XBD,0XD7,0X29,0X45,0X21,0X24,0X18,0XE3,
+0X82,0X21,0X04,0X03,0XDE,0XDB,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0X82,0XFF,0XFF,0X10,
+0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0X63,0X2C,0XFF,0XFF,0XDE,0XFB,0X21,0X04,0XFF,0XFF,
+0XFF,0XFF,0X29,0X45,0XBD,0XD7,0XFF,0XFF,0XBD,0XD7,0X21,0X04,0X21,0X24,0X52,0X8A,
+0XF7,0XBE,0X82,0XFF,0XFF,0X04,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0X84,0X30,0XF7,0XBE,
+0X88,0XFF,0XFF,0X0E,0XAD,0X55,0X21,0X24,0X21,0X04,0X21,0X04,0X18,0XE3,0X18,0XE3,
+0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X21,0X24,0X29,0X45,0X31,0X86,0XFF,0XFF,0X73,0XAE,
+0X18,0XC3,0X82,0X21,0X04,0X04,0XFF,0XDF,0XA5,0X34,0X21,0X24,0X21,0X04,0X18,0XE3,
+0X95,0X21,0X04,0X94,0X21,0X04,0X07,0X21,0X24,0XFF,0XFF,0XFF,0XFF,0XAD,0X75,0X39,
+0XC7,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X88,0X21,0X04,0X10,0X21,0X24,0X18,0XE3,0XFF,
+0XDF,0XFF,0XDF,0XB5,0XB6,0X21,0X24,0X21,0X04,0X42,0X08,0X39,0XE7,0X18,0XC3,0X29,
+0X65,0X21,0X24,0X18,0XE3,0X21,0X04,0XDE,0XDB,0XFF,0XFF,0XFF,0XFF,0X83,0X21,0X04,
+0X08,0X21,0X24,0XB5,0X96,0XFF,0XFF,0XFF,0XDF,0X21,0X04,0X18,0XE3,0X39,0XC7,0X84,
+0X30,0X7B,0XCF,0X88,0X63,0X0C,0X14,0X5A,0XEB,0XFF,0XFF,0XFF,0XFF,0X84,0X10,0X5A,
+0XEB,0X5A,0XEB,0X84,0X10,0X8C,0X71,0X29,0X45,0X21,0X04,0X21,0X04,0X39,0XC7,0XFF,
+0XFF,0XFF,0XFF,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X04,0XBD,0XD7,0XFF,0XFF,0XFF,
+0XFF,0X83,0X21,0X04,0X02,0XF7,0XBE,0XFF,0XFF,0XEF,0X7D,0X85,0X21,0X04,0X02,0X29,
+0X45,0X21,0X24,0X7B,0XEF,0X82,0XFF,0XFF,0X0A,0XC6,0X38,0X21,0X24,0XFF,0XFF,0XFF,
+0XFF,0X4A,0X49,0XB5,0X96,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XDE,0XFB,0X31,0X86,0X84,
+0X21,0X04,0X37,0X21,0X24,0XEF,0X7D,0XFF,0XFF,0X73,0X8E,0X21,0X04,0X21,0X04,0XAD,
+0X75,0XFF,0XFF,0XFF,0XFF,0X42,0X08,0X21,0X04,0X21,0X04,0X21,0X24,0XFF,0XFF,0XFF,
+0XDF,0X94,0X92,0X29,0X45,0X18,0XE3,0X21,0X04,0X21,0X04,0X29,0X65,0X10,0XA2,0XC6,
+0X18,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0XFF,0XFF,0XFF,
+0XDF,0X63,0X2C,0XFF,0XFF,0XD6,0XBA,0X29,0X45,0XFF,0XFF,0XF7,0XBE,0X29,0X45,0XB5,
+0X96,0XFF,0XDF,0XBD,0XD7,0X21,0X04,0X21,0X24,0X18,0XC3,0X21,0X24,0X21,0X04,0X63,
+0X2C,0XFF,0XFF,0XF7,0XBE,0X18,0XC3,0X29,0X45,0X84,0X30,0XFF,0XFF,0XFF,0XDF,0X94,
+0X92,0X94,0X92,0X83,0X8C,0X71,0X03,0XF7,0XBE,0XFF,0XFF,0X9C,0XF3,0X21,0X24,0X82,
+0X21,0X04,0X11,0X18,0XE3,0XFF,0XFF,0XFF,0XDF,0X21,0X04,0X21,0X04,0X18,0XC3,0XDE,
+0XFB,0XEF,0X7D,0XF7,0XBE,0X21,0X24,0X21,0X04,0X21,0X04,0X29,0X65,0XFF,0XFF,0XFF,
+0XFF,0X4A,0X49,0X18,0XE3,0X18,0XE3,0X95,0X21,0X04,0X94,0X21,0X04,0X07,0X18,0XE3,
+0XA5,0X14,0X21,0X24,0X21,0X04,0X42,0X28,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X89,0X21,
+0X04,0X17,0X29,0X65,0XFF,0XFF,0XFF,0XFF,0X7B,0XEF,0XE7,0X3C,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XDF,0XFF,0XFF,0X73,0X8E,0X21,0X24,0X21,0X04,0X21,0X24,0XCE,0X59,0XFF,0XFF,
+0XFF,0XFF,0X21,0X24,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0XD6,0XBA,0XFF,0XFF,
+0XFF,0XFF,0X82,0X21,0X04,0X04,0X21,0X24,0X21,0X04,0X29,0X45,0X29,0X65,0X18,0XC3,
+0X86,0X21,0X04,0X81,0XFF,0XFF,0X00,0X4A,0X69,0X86,0X21,0X04,0X02,0X39,0XC7,0XFF,
+0XFF,0XFF,0XFF,0X83,0XDE,0XFB,0X02,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0X83,0XDE,0XFB,
+0X81,0XFF,0XFF,0X00,0XEF,0X7D,0X85,0X21,0X04,0X0D,0X73,0XAE,0XFF,0XFF,0XF7,0XBE,
+0XFF,0XFF,0XFF,0XFF,0X5A,0XCB,0X21,0X04,0XD6,0X9A,0XFF,0XFF,0XFF,0XFF,0X31,0XA6,
+0X18,0XE3,0X18,0XC3,0XEF,0X5D,0X82,0XFF,0XFF,0X84,0X21,0X04,0X10,0X18,0XE3,0XEF,
+0X5D,0XFF,0XDF,0X73,0XAE,0X29,0X45,0X18,0XE3,0X18,0XE3,0XC6,0X18,0XF7,0XBE,0XFF,
+0XFF,0X21,0X04,0X21,0X04,0XAD,0X55,0XFF,0XFF,0XFF,0XDF,0X21,0X24,0X21,0X24,0X85,
+0X21,0X04,0X81,0XFF,0XFF,0X10,0X21,0X04,0XF7,0XBE,0XFF,0XFF,0X21,0X24,0XFF,0XFF,
+0XFF,0XDF,0X63,0X0C,0XFF,0XFF,0XDE,0XFB,0X21,0X04,0XFF,0XFF,0XFF,0XDF,0X21,0X24,
+0XAD,0X55,0XFF,0XFF,0XBD,0XD7,0X18,0XE3,0X83,0X21,0X04,0X07,0X63,0X2C,0XFF,0XFF,
+0XFF,0XFF,0X10,0XA2,0X39,0XC7,0X8C,0X71,0XFF,0XFF,0XFF,0XFF,0X83,0XE7,0X1C,0X04,
+0XDE,0XFB,0XE7,0X1C,0XFF,0XFF,0XFF,0XFF,0X9C,0XF3,0X83,0X21,0X04,0X03,0X21,0X24,
+0XFF,0XFF,0XFF,0XFF,0X29,0X45,0X82,0X18,0XC3,0X0B,0XE7,0X3C,0XFF,0XFF,0XDE,0XFB,
+0X18,0XE3,0X21,0X24,0XD6,0XBA,0XFF,0XFF,0XD6,0XBA,0X21,0X24,0X21,0X24,0X21,0X04,
+0X29,0X45,0X94,0X21,0X04,0X93,0X21,0X04,0X08,0X21,0X24,0X21,0X04,0X18,0XE3,0X21,
+0X24,0X21,0X04,0X42,0X28,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X89,0X21,0X04,0X14,0X31,
+0X86,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,
+0XFF,0XFF,0XFF,0X94,0XB2,0X18,0XE3,0X21,0X24,0X6B,0X4D,0XFF,0XFF,0XFF,0XFF,0X94,
+0X92,0X21,0X04,0X21,0X04,0X18,0XE3,0X10,0X82,0X82,0XFF,0XFF,0X82,0X21,0X04,0X08,
+0X21,0X24,0X21,0X04,0XB5,0XB6,0XF7,0XBE,0XD6,0XBA,0X18,0XE3,0X18,0XE3,0X21,0X04,
+0X21,0X24,0X82,0X21,0X04,0X81,0XFF,0XFF,0X00,0X4A,0X69,0X86,0X21,0X04,0X00,0X39,
+0XC7,0X8C,0XFF,0XFF,0X02,0XFF,0XDF,0XFF,0XFF,0XEF,0X7D,0X86,0X21,0X04,0X10,0XFF,
+0XDF,0XFF,0XFF,0X8C,0X51,0X29,0X45,0X10,0X82,0XCE,0X59,0XF7,0XBE,0XFF,0XFF,0XFF,
+0XFF,0XCE,0X79,0X21,0X04,0X29,0X45,0X21,0X04,0X6B,0X6D,0XFF,0XFF,0X84,0X10,0X21,
+0X24,0X83,0X21,0X04,0X09,0X29,0X45,0XF7,0XBE,0XFF,0XFF,0X63,0X2C,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0X87,0XFF,0XFF,0X01,0X21,0X04,0X29,
+0X45,0X82,0X21,0X04,0X11,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XDF,0XFF,0XFF,0XFF,0XDF,0X63,0X0C,0XFF,0XFF,0XDE,0XFB,0X21,0X04,0XFF,0XFF,0XFF,
+0XDF,0X21,0X24,0XAD,0X55,0XFF,0XFF,0XB5,0XB6,0X84,0X21,0X04,0X00,0X63,0X2C,0X82,
+0XFF,0XFF,0X01,0XEF,0X7D,0X84,0X10,0X89,0XFF,0XFF,0X00,0X9C,0XF3,0X82,0X21,0X04,
+0X0A,0X18,0XE3,0X21,0X24,0XFF,0XFF,0XFF,0XFF,0X39,0XE7,0XFF,0XDF,0XFF,0XFF,0XFF,
+0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X83,0XFF,0XFF,
+0X00,0X29,0X45,0X94,0X21,0X04,0X98,0X21,0X04,0X03,0X42,0X28,0XFF,0XFF,0XFF,0XFF,
+0X52,0XAA,0X88,0X21,0X04,0X01,0X18,0XE3,0X39,0XC7,0X82,0XFF,0XFF,0X03,0XE7,0X3C,
+0X31,0X86,0X21,0X04,0X63,0X2C,0X82,0XFF,0XFF,0X09,0X29,0X65,0X18,0XE3,0X21,0X24,
+0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0X94,0X92,0X42,0X08,0X4A,0X69,0XEF,0X5D,0X82,0XFF,
+0XFF,0X82,0X21,0X04,0X05,0X29,0X45,0X21,0X24,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0X73,
+0X8E,0X85,0X21,0X04,0X81,0XFF,0XFF,0X00,0X4A,0X69,0X86,0X21,0X04,0X12,0X39,0XC7,
+0XFF,0XFF,0XFF,0XFF,0X5A,0XCB,0X5A,0XCB,0X52,0XAA,0X52,0XAA,0XCE,0X59,0XFF,0XFF,
+0XFF,0XDF,0X52,0XAA,0X52,0X8A,0X52,0X8A,0X52,0XAA,0XF7,0X9E,0XFF,0XFF,0XEF,0X7D,
+0X21,0X04,0X18,0XE3,0X83,0X21,0X04,0X08,0X21,0X24,0X29,0X65,0X21,0X24,0X21,0X04,
+0X18,0XE3,0XDE,0XFB,0XFF,0XFF,0XFF,0XDF,0X9C,0XF3,0X82,0XFF,0XFF,0X04,0X4A,0X49,
+0X21,0X24,0X21,0X04,0X18,0XE3,0X18,0XE3,0X85,0X21,0X04,0X02,0XF7,0X9E,0XFF,0XFF,
+0X29,0X45,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X84,0XFF,0XFF,0X00,0XFF,0XDF,0X83,0XFF,
+0XFF,0X01,0X29,0X45,0X29,0X65,0X82,0X21,0X04,0X00,0XFF,0XDF,0X85,0XFF,0XFF,0X17,
+0XFF,0XDF,0X63,0X0C,0XFF,0XFF,0XE7,0X1C,0X84,0X10,0XFF,0XFF,0XFF,0XDF,0X73,0X8E,
+0XD6,0X9A,0XFF,0XFF,0XB5,0XB6,0X21,0X04,0X21,0X24,0X18,0XC3,0X18,0XC3,0X31,0X86,
+0XBD,0XD7,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0X84,0X10,0XFF,0XFF,0XEF,0X7D,
+0X83,0X39,0XE7,0X0E,0X42,0X08,0X42,0X28,0XF7,0XBE,0XFF,0XFF,0X9C,0XD3,0X21,0X24,
+0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0XFF,0XFF,0XFF,0XFF,0X39,0XE7,0XFF,0XDF,
+0XF7,0XBE,0X8B,0XFF,0XFF,0X81,0X21,0X24,0X93,0X21,0X04,0X98,0X21,0X04,0X03,0X42,
+0X28,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X88,0X21,0X04,0X01,0X18,0XE3,0X39,0XC7,0X82,
+0XFF,0XFF,0X10,0X29,0X45,0X21,0X24,0X21,0X04,0X21,0X04,0X5A,0XEB,0XFF,0XFF,0XFF,
+0XFF,0X6B,0X4D,0X21,0X24,0X21,0X04,0X63,0X0C,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,
+0XFF,0XFF,0XDF,0XFF,0XDF,0X82,0XFF,0XFF,0X83,0X21,0X04,0X05,0X21,0X24,0X63,0X0C,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X18,0XE3,0X84,0X21,0X04,0X81,0XFF,0XFF,0X00,0X4A,
+0X69,0X86,0X21,0X04,0X09,0X39,0XC7,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X18,0XE3,0X21,
+0X04,0X21,0X04,0XBD,0XD7,0XFF,0XFF,0XFF,0XFF,0X82,0X21,0X04,0X05,0X18,0XE3,0XF7,
+0XBE,0XFF,0XFF,0XEF,0X7D,0X21,0X04,0X18,0XE3,0X83,0X21,0X04,0X03,0X21,0X24,0X21,
+0X04,0X21,0X24,0X63,0X0C,0X82,0XFF,0XFF,0X0A,0X63,0X0C,0X29,0X45,0X42,0X08,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XDF,0XE7,0X3C,0X52,0X8A,0X29,0X45,0X21,0X04,0X21,0X24,0X84,
+0X21,0X04,0X01,0XFF,0XFF,0XFF,0XDF,0X82,0X21,0X04,0X0C,0X29,0X45,0X84,0X30,0XFF,
+0XFF,0XB5,0X96,0X21,0X04,0X21,0X04,0X5A,0XEB,0XFF,0XFF,0XFF,0XDF,0X21,0X04,0X18,
+0XE3,0X21,0X24,0X18,0XE3,0X82,0X21,0X04,0X09,0X31,0X86,0XF7,0XBE,0XFF,0XFF,0X18,
+0XE3,0XFF,0XDF,0XFF,0XFF,0X21,0X24,0XFF,0XFF,0XFF,0XDF,0X63,0X0C,0X83,0XFF,0XFF,
+0X00,0XFF,0XDF,0X82,0XFF,0XFF,0X0B,0XB5,0XB6,0X21,0X04,0X21,0X04,0X63,0X0C,0XF7,
+0XBE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0X52,0XAA,0X18,0XE3,0X84,0X30,0X89,
+0XFF,0XFF,0X01,0X9C,0XD3,0X29,0X45,0X83,0X21,0X04,0X81,0XFF,0XFF,0X81,0X21,0X24,
+0X09,0X21,0X04,0X21,0X24,0XCE,0X59,0XFF,0XDF,0X5A,0XCB,0X18,0XE3,0X18,0XE3,0XC6,
+0X38,0XFF,0XFF,0XFF,0XFF,0X82,0X18,0XE3,0X81,0X21,0X24,0X93,0X21,0X04,0X98,0X21,
+0X04,0X03,0X42,0X28,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X88,0X21,0X04,0X04,0X18,0XE3,
+0X39,0XC7,0XFF,0XFF,0XFF,0XFF,0XD6,0XBA,0X84,0X21,0X04,0X81,0XFF,0XFF,0X0C,0XBD,
+0XD7,0X21,0X04,0X29,0X45,0X18,0XE3,0X52,0X8A,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,
+0X9E,0XC6,0X38,0X73,0XAE,0XFF,0XFF,0XFF,0XFF,0X84,0X21,0X04,0X06,0X18,0XE3,0X8C,
+0X51,0XFF,0XFF,0XFF,0XFF,0XDE,0XDB,0X21,0X04,0X21,0X24,0X82,0X21,0X04,0X81,0XFF,
+0XFF,0X00,0X4A,0X69,0X86,0X21,0X04,0X02,0X31,0XA6,0XFF,0XFF,0XFF,0XFF,0X83,0X21,
+0X04,0X16,0XBD,0XF7,0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X21,0X04,0X21,0X04,0X18,0XE3,
+0XFF,0XDF,0XFF,0XFF,0XE7,0X1C,0X21,0X04,0X18,0XE3,0X21,0X04,0X21,0X04,0X18,0XC3,
+0X29,0X45,0X18,0XE3,0X63,0X2C,0XEF,0X7D,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0X31,0XA6,
+0X83,0X21,0X04,0X00,0XC6,0X38,0X82,0XFF,0XFF,0X04,0XFF,0XDF,0XBD,0XD7,0X5A,0XEB,
+0X21,0X04,0X21,0X24,0X82,0X21,0X04,0X11,0XFF,0XDF,0XFF,0XFF,0X31,0XA6,0X42,0X28,
+0X18,0XC3,0X21,0X04,0X84,0X30,0XFF,0XFF,0XAD,0X75,0X21,0X24,0X21,0X24,0X5A,0XCB,
+0XFF,0XFF,0XEF,0X7D,0X21,0X04,0X21,0X04,0X21,0X24,0X42,0X28,0X82,0X21,0X04,0X23,
+0X39,0XC7,0XFF,0XFF,0XFF,0XFF,0X84,0X10,0XFF,0XFF,0XFF,0XFF,0X7B,0XEF,0XFF,0XFF,
+0XFF,0XFF,0X84,0X10,0XFF,0XFF,0XF7,0X9E,0X8C,0X51,0XFF,0XFF,0XFF,0XFF,0X8C,0X51,
+0XD6,0X9A,0XF7,0X9E,0XC6,0X38,0X21,0X24,0X21,0X04,0X52,0X8A,0XFF,0XDF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0X21,0X24,0X29,0X45,0X63,0X2C,0XD6,0XBA,0XD6,0XBA,
+0XDE,0XFB,0XE7,0X3C,0XFF,0XFF,0XFF,0XFF,0X82,0XD6,0XBA,0X01,0XD6,0X9A,0X84,0X10,
+0X82,0X21,0X04,0X14,0X21,0X24,0X21,0X04,0XFF,0XFF,0XFF,0XFF,0X4A,0X49,0X21,0X24,
+0X18,0XE3,0X21,0X24,0XCE,0X59,0XFF,0XFF,0X5A,0XCB,0X21,0X04,0X21,0X04,0XCE,0X59,
+0XFF,0XFF,0XF7,0XBE,0X29,0X45,0X21,0X04,0X31,0X86,0X31,0XA6,0X29,0X45,0X93,0X21,
+0X04,0X98,0X21,0X04,0X03,0X42,0X28,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X89,0X21,0X04,
+0X03,0X18,0XE3,0XFF,0XFF,0XFF,0XFF,0XCE,0X79,0X83,0X21,0X04,0X0F,0X21,0X24,0XFF,
+0XFF,0XFF,0XFF,0XBD,0XD7,0X21,0X04,0X21,0X04,0X18,0XC3,0X18,0XE3,0X21,0X24,0X21,
+0X04,0X21,0X04,0X18,0XE3,0X29,0X45,0XDE,0XDB,0XF7,0XBE,0XFF,0XFF,0X85,0X21,0X04,
+0X05,0X29,0X45,0XF7,0X9E,0XFF,0XFF,0XFF,0XFF,0X4A,0X49,0X29,0X65,0X82,0X21,0X04,
+0X81,0XFF,0XFF,0X00,0X4A,0X69,0X86,0X21,0X04,0X00,0X31,0XA6,0X87,0XFF,0XFF,0X0D,
+0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,
+0X21,0X04,0X18,0XE3,0X21,0X04,0X21,0X04,0X29,0X65,0XDE,0XDB,0X86,0XFF,0XFF,0X82,
+0XFF,0XDF,0X88,0XFF,0XFF,0X06,0X21,0X24,0X21,0X04,0X21,0X04,0X42,0X28,0XFF,0XFF,
+0XFF,0XFF,0XF7,0XBE,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X86,0XFF,0XFF,0X00,0XFF,0XDF,
+0X82,0XFF,0XFF,0X82,0X21,0X04,0X00,0X42,0X08,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X83,
+0XFF,0XFF,0X1A,0X8C,0X71,0XFF,0XFF,0XDE,0XFB,0X21,0X24,0XFF,0XFF,0XFF,0XDF,0X18,
+0XC3,0X4A,0X69,0XD6,0XBA,0X31,0X86,0X21,0X04,0X18,0XC3,0X29,0X45,0XFF,0XDF,0X84,
+0X10,0X6B,0X4D,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0XD6,0X9A,0XB5,0XB6,0XC6,0X18,0XC6,
+0X18,0XC6,0X38,0XDE,0XFB,0XFF,0XFF,0XFF,0XFF,0X82,0XC6,0X18,0X08,0XC6,0X38,0XDE,
+0XDB,0XDE,0XDB,0X21,0X04,0X21,0X04,0X21,0X24,0X8C,0X71,0XFF,0XFF,0XFF,0XDF,0X82,
+0XFF,0XFF,0X03,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X86,0XFF,0XFF,0X02,0XFF,
+0XDF,0XF7,0X9E,0X29,0X45,0X93,0X21,0X04,0X98,0X21,0X04,0X03,0X42,0X28,0XFF,0XFF,
+0XFF,0XFF,0X52,0XAA,0X85,0X21,0X04,0X13,0X29,0X45,0X21,0X04,0X21,0X04,0X21,0X24,
+0X18,0XC3,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X29,0X65,0X21,0X04,0X21,0X04,0X18,0XE3,
+0X29,0X45,0XFF,0XFF,0XFF,0XDF,0X7B,0XEF,0X21,0X24,0X29,0X45,0XFF,0XDF,0XFF,0XDF,
+0X84,0X21,0X24,0X02,0XFF,0XDF,0XFF,0XFF,0XD6,0XBA,0X85,0X21,0X04,0X05,0X21,0X24,
+0X42,0X28,0XFF,0XFF,0XFF,0XFF,0X94,0X92,0X18,0XE3,0X82,0X21,0X04,0X81,0XFF,0XFF,
+0X00,0X4A,0X69,0X86,0X21,0X04,0X03,0X39,0XC7,0XFF,0XFF,0XFF,0XFF,0XF7,0XBE,0X8B,
+0XFF,0XFF,0X01,0XFF,0XDF,0X18,0XE3,0X82,0X21,0X04,0X00,0X29,0X45,0X82,0XFF,0XFF,
+0X03,0XC6,0X38,0XF7,0X9E,0XFF,0XFF,0XF7,0XBE,0X85,0XFF,0XFF,0X06,0XFF,0XDF,0XFF,
+0XFF,0XEF,0X7D,0XAD,0X55,0XFF,0XFF,0XFF,0XFF,0X31,0X86,0X82,0X21,0X04,0X03,0XC6,
+0X38,0XFF,0XFF,0XFF,0XFF,0XE7,0X3C,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X84,0XFF,0XFF,
+0X00,0XFF,0XDF,0X84,0XFF,0XFF,0X1E,0X18,0XC3,0X21,0X04,0X21,0X04,0X52,0X8A,0XFF,
+0XFF,0XFF,0XDF,0XB5,0X96,0XFF,0XFF,0XFF,0XDF,0XAD,0X75,0XFF,0XFF,0XFF,0XFF,0X42,
+0X28,0XAD,0X55,0X73,0X8E,0X21,0X04,0XFF,0XFF,0XFF,0XDF,0X21,0X24,0XF7,0XBE,0XFF,
+0XFF,0X8C,0X51,0X21,0X24,0X21,0X04,0X21,0X04,0X29,0X45,0X21,0X04,0X63,0X2C,0XFF,
+0XFF,0XFF,0XFF,0X21,0X04,0X84,0XFF,0XFF,0X00,0XFF,0XDF,0X85,0XFF,0XFF,0X01,0XF7,
+0XBE,0XFF,0XDF,0X82,0X21,0X04,0X02,0XFF,0XDF,0XFF,0XFF,0XF7,0X9E,0X85,0XFF,0XFF,
+0X00,0XF7,0XBE,0X87,0XFF,0XFF,0X01,0XDE,0XDB,0X18,0XE3,0X93,0X21,0X04,0X98,0X21,
+0X04,0X03,0X42,0X28,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X84,0X21,0X04,0X1C,0X63,0X2C,
+0X94,0X92,0X94,0X92,0X18,0XC3,0X29,0X45,0X21,0X04,0X8C,0X71,0XFF,0XFF,0XFF,0XFF,
+0X9C,0XD3,0X21,0X04,0X21,0X04,0X10,0XA2,0XE7,0X1C,0XFF,0XFF,0XFF,0XFF,0X29,0X65,
+0X18,0XE3,0X21,0X24,0XFF,0XFF,0XFF,0XFF,0XDE,0XDB,0X18,0XE3,0X21,0X04,0X18,0XE3,
+0XBD,0XD7,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X84,0X21,0X04,0X05,0X21,0X24,0X18,0XE3,
+0X21,0X04,0XB5,0XB6,0X39,0XE7,0X18,0XE3,0X83,0X21,0X04,0X81,0XFF,0XFF,0X00,0X4A,
+0X69,0X86,0X21,0X04,0X0A,0X39,0XC7,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X29,0X65,0X21,
+0X04,0X21,0X04,0XBD,0XD7,0XFF,0XDF,0XFF,0XFF,0X29,0X65,0X83,0X21,0X04,0X02,0X21,
+0X24,0X29,0X65,0X18,0XE3,0X82,0X21,0X04,0X09,0X21,0X24,0X52,0XAA,0X84,0X10,0X18,
+0XC3,0X21,0X04,0XF7,0XBE,0XFF,0XFF,0X39,0XE7,0X21,0X24,0X21,0X24,0X83,0X21,0X04,
+0X0C,0X63,0X2C,0XFF,0XFF,0XEF,0X5D,0X18,0XE3,0X21,0X04,0X29,0X65,0X29,0X65,0X18,
+0XE3,0X21,0X04,0X21,0X24,0XFF,0XFF,0XFF,0XDF,0XF7,0X9E,0X82,0X21,0X24,0X22,0X18,
+0XC3,0XE7,0X3C,0XFF,0XFF,0X8C,0X71,0X21,0X24,0X21,0X24,0X5A,0XEB,0XFF,0XDF,0XF7,
+0X9E,0X21,0X04,0X21,0X24,0X21,0X24,0X21,0X04,0X18,0XE3,0X21,0X04,0X21,0X04,0XA5,
+0X14,0XFF,0XDF,0XD6,0XBA,0X29,0X45,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0XFF,0XFF,0XFF,
+0XDF,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0XFF,0XFF,0XFF,0XFF,0X21,0X04,0X84,
+0X10,0XFF,0XFF,0XEF,0X7D,0X84,0X21,0X04,0X08,0X63,0X2C,0XFF,0XFF,0XFF,0XFF,0X21,
+0X24,0X6B,0X6D,0X63,0X0C,0X63,0X2C,0X63,0X0C,0X84,0X30,0X83,0XFF,0XFF,0X04,0X63,
+0X0C,0X5A,0XEB,0X5A,0XEB,0X63,0X0C,0X6B,0X4D,0X82,0X21,0X04,0X13,0XFF,0XDF,0XFF,
+0XFF,0XB5,0XB6,0X21,0X24,0X21,0X24,0X21,0X04,0X29,0X45,0XFF,0XFF,0XFF,0XFF,0X4A,
+0X69,0X21,0X24,0X21,0X24,0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0X18,0XC3,0X21,0X24,0X21,
+0X24,0X21,0X04,0X18,0XE3,0X93,0X21,0X04,0X98,0X21,0X04,0X03,0X42,0X28,0XFF,0XFF,
+0XFF,0XFF,0X52,0X8A,0X82,0X21,0X04,0X04,0X18,0XE3,0X21,0X04,0XF7,0X9E,0XFF,0XFF,
+0XFF,0XFF,0X82,0X21,0X04,0X15,0X21,0X24,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0XEF,0X5D,
+0XC6,0X18,0XF7,0XBE,0XFF,0XDF,0XFF,0XFF,0XCE,0X59,0X21,0X04,0X21,0X04,0X18,0XE3,
+0XE7,0X1C,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0XC6,0X38,0XEF,0X7D,0XFF,0XDF,0XFF,0XFF,
+0XE7,0X3C,0X8A,0X21,0X04,0X07,0X18,0XE3,0X29,0X45,0X21,0X04,0X21,0X04,0X21,0X24,
+0XFF,0XDF,0XFF,0XFF,0X4A,0X69,0X86,0X21,0X04,0X0A,0X29,0X65,0XDE,0XFB,0XDE,0XFB,
+0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0XBD,0XF7,0XFF,0XFF,0XFF,0XFF,0X21,0X24,
+0X83,0X18,0XE3,0X05,0X21,0X04,0X18,0XE3,0XD6,0X9A,0XF7,0XBE,0X94,0X92,0X21,0X24,
+0X83,0X21,0X04,0X03,0X21,0X24,0XF7,0XBE,0XFF,0XFF,0X39,0XC7,0X85,0X21,0X24,0X03,
+0X63,0X0C,0XFF,0XFF,0XEF,0X7D,0X21,0X24,0X83,0X21,0X04,0X10,0X21,0X24,0X5A,0XEB,
+0XFF,0XFF,0XFF,0XDF,0X52,0X8A,0X18,0XC3,0X21,0X24,0X18,0XC3,0X42,0X28,0XFF,0XFF,
+0XF7,0XBE,0X42,0X08,0X21,0X04,0X21,0X04,0X5A,0XEB,0XFF,0XDF,0XFF,0XFF,0X86,0X21,
+0X04,0X20,0XEF,0X5D,0XFF,0XFF,0XAD,0X75,0X18,0XC3,0XFF,0XFF,0XFF,0XFF,0X21,0X24,
+0XFF,0XFF,0XFF,0XFF,0X18,0XE3,0X29,0X45,0X21,0X04,0X29,0X45,0XFF,0XFF,0XFF,0XFF,
+0XA5,0X34,0XC6,0X18,0XFF,0XDF,0XFF,0XFF,0X29,0X65,0X21,0X24,0X18,0XE3,0X18,0XE3,
+0X21,0X04,0X6B,0X4D,0XFF,0XFF,0XFF,0XFF,0X18,0XE3,0X21,0X04,0X18,0XC3,0X21,0X04,
+0X21,0X24,0XFF,0XDF,0X83,0XFF,0XFF,0X16,0XFF,0XDF,0X29,0X65,0X21,0X24,0X21,0X04,
+0X18,0XE3,0X21,0X04,0X21,0X04,0X94,0XB2,0XFF,0XFF,0XFF,0XFF,0X29,0X45,0X21,0X24,
+0X21,0X24,0X29,0X45,0X73,0X8E,0XF7,0XBE,0XFF,0XFF,0X21,0X24,0X21,0X04,0X21,0X04,
+0XC6,0X38,0XFF,0XFF,0XFF,0XFF,0X98,0X21,0X04,0X97,0X21,0X04,0X04,0X18,0XE3,0X4A,
+0X49,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X82,0X21,0X04,0X04,0X18,0XE3,0X21,0X04,0XEF,
+0X5D,0XFF,0XFF,0XFF,0XFF,0X83,0X21,0X04,0X03,0X29,0X65,0XFF,0XDF,0XFF,0XFF,0XFF,
+0XDF,0X82,0XFF,0XFF,0X05,0XDE,0XFB,0X18,0XE3,0X21,0X04,0X21,0X04,0X18,0XE3,0X18,
+0XE3,0X85,0XFF,0XFF,0X00,0XE7,0X3C,0X8C,0X21,0X04,0X06,0X39,0XE7,0X8C,0X51,0X94,
+0X92,0XC6,0X38,0XFF,0XFF,0XFF,0XFF,0X52,0X8A,0X89,0X21,0X04,0X00,0X29,0X45,0X82,
+0X21,0X04,0X03,0XBD,0XF7,0XFF,0XFF,0XFF,0XFF,0X18,0XE3,0X83,0X21,0X04,0X01,0X21,
+0X24,0X21,0X04,0X82,0XFF,0XFF,0X00,0X18,0XE3,0X83,0X21,0X04,0X03,0X21,0X24,0XF7,
+0XBE,0XFF,0XFF,0XE7,0X3C,0X85,0XEF,0X7D,0X03,0XEF,0X5D,0XFF,0XFF,0XEF,0X7D,0X21,
+0X24,0X83,0X21,0X04,0X10,0X18,0XE3,0XF7,0XBE,0XFF,0XFF,0XFF,0XFF,0X18,0XE3,0X21,
+0X04,0X18,0XE3,0X29,0X45,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X18,0XE3,0X21,0X04,0X21,
+0X04,0X5A,0XEB,0XFF,0XDF,0XFF,0XFF,0X85,0X21,0X04,0X10,0X10,0XA2,0XFF,0XFF,0XFF,
+0XFF,0X63,0X0C,0X18,0XE3,0XFF,0XFF,0XFF,0XFF,0X21,0X24,0XFF,0XFF,0XF7,0XBE,0XF7,
+0XBE,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0X82,0XFF,0XFF,
+0X0B,0X73,0XAE,0X21,0X04,0X29,0X45,0X52,0XAA,0X5A,0XEB,0XD6,0X9A,0XFF,0XFF,0XFF,
+0XFF,0X18,0XE3,0X18,0XC3,0X18,0XE3,0XA5,0X34,0X82,0XFF,0XFF,0X19,0X39,0XC7,0X31,
+0XA6,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0XEF,0X5D,0X8C,0X71,0X52,0XAA,0X21,0X24,0X21,
+0X04,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X21,0X24,0X21,0X24,0X18,0XE3,0X9C,0XD3,0XFF,
+0XFF,0XF7,0X9E,0XCE,0X59,0X18,0XE3,0X21,0X04,0X21,0X04,0XC6,0X38,0XFF,0XFF,0XFF,
+0XFF,0X98,0X21,0X04,0X98,0X21,0X04,0X03,0X18,0XC3,0X4A,0X69,0X52,0X8A,0X21,0X24,
+0X84,0X21,0X04,0X03,0X29,0X65,0X4A,0X49,0X42,0X28,0X18,0XE3,0X83,0X21,0X04,0X05,
+0X18,0XC3,0X4A,0X49,0XC6,0X38,0XDE,0XFB,0XAD,0X75,0X39,0XC7,0X86,0X21,0X04,0X04,
+0X5A,0XEB,0XCE,0X79,0XE7,0X1C,0XAD,0X75,0X39,0XC7,0X8C,0X21,0X04,0X06,0X21,0X24,
+0X5A,0XEB,0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XFF,0XDF,0X8E,0X21,0X04,0X04,
+0X84,0X30,0XFF,0XFF,0XFF,0XDF,0XFF,0XDF,0XEF,0X5D,0X83,0XEF,0X7D,0X81,0XFF,0XDF,
+0X01,0XFF,0XFF,0XAD,0X55,0X84,0X21,0X04,0X03,0X29,0X45,0XF7,0XBE,0XFF,0XFF,0XFF,
+0XDF,0X85,0XFF,0XFF,0X03,0XFF,0XDF,0XFF,0XFF,0XF7,0X9E,0X21,0X24,0X84,0X21,0X04,
+0X05,0XE7,0X1C,0XFF,0XFF,0X94,0XB2,0X21,0X04,0X18,0XC3,0X84,0X30,0X82,0XFF,0XFF,
+0X00,0X31,0XA6,0X82,0X21,0X04,0X02,0X7B,0XCF,0XFF,0XFF,0XFF,0XDF,0X84,0X21,0X04,
+0X0A,0X18,0XE3,0X9C,0XF3,0XFF,0XFF,0XFF,0XFF,0X29,0X45,0X18,0XC3,0X42,0X08,0XB5,
+0X96,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0X82,0XFF,0XFF,0X81,0XFF,0XDF,0X27,0XBD,0XD7,
+0X52,0XAA,0X39,0XC7,0XB5,0X96,0XFF,0XDF,0XF7,0X9E,0X18,0XE3,0X21,0X24,0XDE,0XFB,
+0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0XF7,0XBE,0X7B,0XCF,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,
+0XFF,0XFF,0XFF,0XFF,0X31,0XA6,0X21,0X04,0X21,0X04,0X29,0X45,0XF7,0XBE,0XFF,0XFF,
+0XF7,0XBE,0XFF,0XFF,0XFF,0XDF,0X21,0X24,0X21,0X24,0XFF,0XDF,0XFF,0XFF,0X5A,0XCB,
+0X29,0X65,0X21,0X04,0XDE,0XDB,0XFF,0XDF,0XFF,0XFF,0XFF,0XDF,0X29,0X45,0X82,0X21,
+0X04,0X02,0XC6,0X38,0XFF,0XFF,0XFF,0XFF,0X98,0X21,0X04,0X97,0X21,0X04,0X05,0X21,
+0X24,0X21,0X04,0X18,0XE3,0X18,0XE3,0X21,0X04,0X21,0X24,0X83,0X21,0X04,0X03,0X18,
+0XC3,0X18,0XE3,0X29,0X45,0X21,0X24,0X86,0X21,0X04,0X81,0X21,0X24,0X86,0X21,0X04,
+0X04,0X29,0X45,0X21,0X04,0X18,0XE3,0X21,0X04,0X21,0X24,0X8D,0X21,0X04,0X07,0X18,
+0XE3,0X21,0X24,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0XF7,0X9E,0X52,0XAA,0X18,0XC3,0X8D,
+0X21,0X04,0X00,0X18,0XC3,0X8A,0XFF,0XFF,0X00,0X18,0XE3,0X85,0X21,0X04,0X02,0XFF,
+0XDF,0XFF,0XFF,0X4A,0X49,0X85,0X29,0X45,0X03,0X6B,0X4D,0XFF,0XFF,0XFF,0XFF,0X21,
+0X24,0X83,0X21,0X04,0X81,0X18,0XE3,0X0F,0X42,0X08,0X29,0X45,0X29,0X45,0X18,0XE3,
+0XE7,0X3C,0XFF,0XFF,0XFF,0XFF,0X52,0XAA,0X18,0XE3,0X29,0X45,0X21,0X04,0X21,0X04,
+0X7B,0XEF,0XFF,0XFF,0XFF,0XFF,0X21,0X24,0X83,0X21,0X04,0X18,0X29,0X45,0X9C,0XD3,
+0XFF,0XFF,0XAD,0X75,0X21,0X04,0X21,0X04,0X29,0X45,0X10,0XA2,0XFF,0XFF,0XFF,0XFF,
+0XC6,0X38,0XA5,0X34,0XA5,0X34,0X29,0X45,0X21,0X24,0X21,0X24,0X21,0X04,0X21,0X24,
+0X29,0X45,0X5A,0XEB,0XFF,0XFF,0XBD,0XF7,0X21,0X04,0X18,0XE3,0X52,0XAA,0X82,0XFF,
+0XFF,0X22,0X18,0XE3,0X29,0X45,0XF7,0XBE,0XFF,0XDF,0XFF,0XFF,0X9C,0XF3,0X18,0XC3,
+0X18,0XE3,0X21,0X04,0X21,0X04,0X18,0XE3,0X18,0XE3,0X63,0X2C,0XFF,0XFF,0XFF,0XFF,
+0XB5,0XB6,0X18,0XE3,0X21,0X24,0X18,0XE3,0X4A,0X69,0X21,0X04,0X21,0X04,0X39,0XC7,
+0XFF,0XFF,0XFF,0XDF,0XFF,0XFF,0X31,0X86,0X21,0X24,0X18,0XE3,0X21,0X04,0X21,0X04,
+0XCE,0X59,0XFF,0XFF,0XFF,0XFF,0X18,0XC3,0X97,0X21,0X04,0XCA,0X21,0X04,0X81,0X29,
+0X45,0X81,0X21,0X24,0X90,0X21,0X04,0X02,0X21,0X24,0X31,0X86,0X29,0X45,0X85,0X29,
+0X65,0X01,0X31,0X86,0X21,0X24,0X86,0X21,0X04,0X02,0XBD,0XF7,0XDE,0XFB,0X29,0X45,
+0X86,0X21,0X04,0X02,0X29,0X65,0X31,0XA6,0X21,0X24,0X89,0X21,0X04,0X03,0X18,0XE3,
+0X84,0X30,0X39,0XE7,0X21,0X24,0X83,0X21,0X04,0X03,0X29,0X45,0X21,0X24,0X31,0X86,
+0X29,0X45,0X85,0X21,0X04,0X00,0X21,0X24,0X84,0X21,0X04,0X01,0X29,0X65,0X18,0XE3,
+0X8D,0X21,0X04,0X07,0X10,0X82,0X31,0X86,0X39,0XE7,0X21,0X04,0X21,0X24,0X18,0XE3,
+0XA5,0X34,0X29,0X45,0X89,0X21,0X04,0X01,0X18,0XE3,0X29,0X45,0X87,0X21,0X04,0X02,
+0XB5,0XB6,0X21,0X04,0X10,0X82,0X83,0X21,0X04,0X03,0X31,0X86,0X29,0X65,0X31,0X86,
+0X29,0X65,0X97,0X21,0X04,0XCA,0X21,0X04,0X03,0X18,0XE3,0X21,0X24,0X21,0X24,0X18,
+0XE3,0X93,0X21,0X04,0X85,0X18,0XE3,0X01,0X21,0X24,0X18,0XE3,0X85,0X21,0X04,0X01,
+0X21,0X24,0X29,0X45,0X87,0X21,0X04,0X03,0X18,0XE3,0X29,0X45,0X29,0X45,0X18,0XE3,
+0X89,0X21,0X04,0X03,0X18,0XE3,0X21,0X04,0X21,0X04,0X21,0X24,0X83,0X21,0X04,0X02,
+0X18,0XC3,0X21,0X04,0X29,0X45,0X9D,0X21,0X04,0X06,0X18,0XC3,0X21,0X04,0X21,0X24,
+0X18,0XE3,0X21,0X04,0X18,0XC3,0X29,0X45,0X89,0X21,0X04,0X00,0X21,0X24,0X89,0X21,
+0X04,0X81,0X18,0XE3,0X83,0X21,0X04,0X02,0X21,0X24,0X21,0X04,0X21,0X24,0X98,0X21,
+0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XC1,0X21,0X04,
+0X01,0X21,0X24,0X29,0X45,0XB4,0X21,0X04,0X01,0X29,0X45,0X18,0XE3,0XB1,0X21,0X04,
+0X00,0X29,0X45,0XC1,0X21,0X04,0XC1,0X21,0X04,0X01,0X18,0XE3,0X29,0X45,0XB4,0X21,
+0X04,0X01,0X21,0X24,0X73,0X8E,0XB3,0X21,0X04,0X00,0X42,0X28,0XBF,0X21,0X04,0X99,
+0X21,0X04,0X00,0X18,0XE3,0X83,0X21,0X04,0X00,0X21,0X24,0X86,0X21,0X04,0X04,0X18,
+0XE3,0X21,0X04,0X18,0XE3,0X21,0X24,0X21,0X24,0X82,0X21,0X04,0X02,0X29,0X45,0X21,
+0X24,0X21,0X04,0X82,0X21,0X24,0X9D,0X21,0X04,0X00,0X18,0XE3,0X82,0X21,0X04,0X05,
+0X21,0X24,0X21,0X04,0X18,0XC3,0X18,0XC3,0X18,0XE3,0X21,0X24,0X83,0X21,0X04,0X03,
+0X29,0X65,0X18,0XC3,0X21,0X04,0X21,0X04,0X82,0X21,0X24,0X01,0X18,0XE3,0X21,0X04,
+0X82,0X21,0X24,0X8B,0X21,0X04,0X01,0X21,0X24,0X73,0X8E,0X89,0X21,0X04,0X00,0X29,
+0X45,0X82,0X21,0X24,0X01,0X18,0XE3,0X21,0X24,0X83,0X21,0X04,0X08,0X18,0XE3,0X21,
+0X24,0X21,0X04,0X18,0XE3,0X21,0X04,0X21,0X04,0X18,0XE3,0X18,0XE3,0X21,0X24,0X82,
+0X21,0X04,0X05,0X29,0X45,0X18,0XC3,0X21,0X04,0X18,0XC3,0X21,0X04,0X21,0X24,0X8B,
+0X21,0X04,0X02,0X18,0XE3,0X21,0X04,0X4A,0X69,0X8A,0X21,0X04,0X13,0X18,0XE3,0X18,
+0XC3,0X29,0X45,0X21,0X04,0X18,0XE3,0X29,0X45,0X18,0XE3,0X21,0X24,0X21,0X04,0X29,
+0X45,0X29,0X45,0X18,0XE3,0X29,0X45,0X21,0X04,0X21,0X24,0X18,0XE3,0X18,0XC3,0X29,
+0X65,0X21,0X04,0X21,0X24,0X83,0X21,0X04,0X04,0X18,0XC3,0X21,0X04,0X29,0X45,0X21,
+0X04,0X21,0X24,0X97,0X21,0X04,0X9A,0X21,0X04,0X84,0X21,0X24,0X82,0X21,0X04,0X00,
+0X21,0X24,0X82,0X21,0X04,0X0E,0X18,0XE3,0X29,0X45,0X29,0X65,0X29,0X45,0X42,0X08,
+0X21,0X04,0X21,0X04,0X21,0X24,0X18,0XC3,0X42,0X28,0X21,0X04,0X21,0X24,0X21,0X04,
+0X18,0XE3,0X21,0X24,0X9C,0X21,0X04,0X00,0X42,0X08,0X82,0X21,0X04,0X05,0X18,0XE3,
+0X5A,0XCB,0X21,0X24,0X18,0XC3,0X6B,0X6D,0X21,0X24,0X83,0X21,0X04,0X01,0X4A,0X69,
+0X29,0X65,0X83,0X21,0X04,0X05,0X73,0X8E,0X21,0X24,0X21,0X04,0X21,0X04,0X39,0XC7,
+0X18,0XE3,0X8B,0X21,0X04,0X01,0X21,0X24,0X73,0X8E,0X89,0X21,0X04,0X05,0X29,0X45,
+0X21,0X04,0X29,0X45,0X21,0X04,0X29,0X45,0X63,0X0C,0X84,0X21,0X04,0X07,0X52,0XAA,
+0X29,0X65,0X18,0XE3,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X04,0X31,0X86,0X82,0X21,
+0X04,0X05,0X18,0XE3,0X5A,0XCB,0X18,0XE3,0X21,0X24,0X42,0X08,0X21,0X24,0X8B,0X21,
+0X04,0X02,0X18,0XE3,0X21,0X04,0X4A,0X69,0X8A,0X21,0X04,0X1C,0X18,0XE3,0X18,0XC3,
+0XD6,0XBA,0X18,0XE3,0X21,0X04,0X6B,0X4D,0X29,0X45,0X18,0XE3,0XAD,0X75,0X21,0X24,
+0XDE,0XFB,0X52,0XAA,0X9C,0XD3,0X9C,0XF3,0X21,0X24,0X29,0X45,0X94,0X92,0X4A,0X49,
+0X21,0X24,0X8C,0X71,0X21,0X24,0X21,0X04,0X21,0X04,0X7B,0XEF,0X31,0XA6,0XCE,0X79,
+0X29,0X45,0X5A,0XEB,0X29,0X45,0X97,0X21,0X04,0X99,0X21,0X04,0X09,0X21,0X24,0X9C,
+0XF3,0X9C,0XD3,0XF7,0X9E,0X9C,0XD3,0X94,0XB2,0X21,0X24,0X21,0X24,0XEF,0X7D,0XA5,
+0X14,0X82,0X9C,0XD3,0X0E,0X94,0XB2,0X10,0XA2,0XA5,0X34,0XA5,0X14,0XE7,0X3C,0XAD,
+0X55,0XA5,0X14,0X6B,0X4D,0X10,0XA2,0XE7,0X3C,0X84,0X10,0XB5,0XB6,0X21,0X24,0X31,
+0XA6,0XBD,0XD7,0X99,0X21,0X04,0X1C,0X5A,0XCB,0X63,0X0C,0X6B,0X4D,0XC6,0X18,0X63,
+0X2C,0X73,0XAE,0X21,0X04,0X29,0X45,0XEF,0X7D,0X18,0XE3,0X84,0X10,0XDE,0XDB,0X94,
+0X92,0X21,0X04,0X4A,0X49,0XA5,0X14,0XB5,0X96,0XE7,0X1C,0XAD,0X55,0XA5,0X34,0X21,
+0X04,0XB5,0XB6,0X63,0X0C,0XE7,0X3C,0X6B,0X4D,0X42,0X28,0X29,0X45,0X8C,0X51,0X21,
+0X24,0X8B,0X21,0X04,0X01,0X21,0X24,0X73,0X8E,0X8A,0X21,0X04,0X1A,0X29,0X45,0X29,
+0X65,0X84,0X30,0X63,0X0C,0XCE,0X59,0X6B,0X6D,0X18,0XE3,0X21,0X04,0X18,0XE3,0X29,
+0X45,0X8C,0X71,0X21,0X04,0X94,0X92,0X21,0X04,0X84,0X10,0X63,0X2C,0X63,0X2C,0X8C,
+0X71,0X6B,0X4D,0X7B,0XCF,0X29,0X45,0X18,0XE3,0XAD,0X75,0X42,0X28,0X84,0X30,0XB5,
+0XB6,0X8C,0X51,0X8B,0X21,0X04,0X02,0X18,0XE3,0X21,0X04,0X4A,0X69,0X8A,0X21,0X04,
+0X1C,0X18,0XC3,0X21,0X04,0XEF,0X5D,0X29,0X65,0XD6,0XBA,0X29,0X45,0X18,0XC3,0X21,
+0X24,0XDE,0XFB,0X94,0XB2,0XFF,0XFF,0X84,0X10,0X21,0X24,0XFF,0XDF,0X18,0XE3,0X6B,
+0X4D,0X21,0X24,0X4A,0X69,0X21,0X24,0XD6,0XBA,0X21,0X24,0X21,0X24,0X63,0X2C,0XFF,
+0XFF,0X4A,0X49,0XEF,0X7D,0X9C,0XD3,0X29,0X45,0X18,0XE3,0X97,0X21,0X04,0X9B,0X21,
+0X04,0X19,0X21,0X24,0XE7,0X1C,0X21,0X04,0X21,0X04,0X18,0XE3,0X21,0X04,0XB5,0XB6,
+0X21,0X24,0X21,0X04,0X21,0X04,0X18,0XE3,0X21,0X24,0X21,0X04,0X42,0X08,0XDE,0XDB,
+0XF7,0XBE,0XDE,0XFB,0XDE,0XDB,0X18,0XC3,0X63,0X2C,0X52,0XAA,0X4A,0X49,0X42,0X28,
+0X6B,0X6D,0X84,0X10,0X4A,0X69,0X98,0X21,0X04,0X1D,0X21,0X24,0X18,0XE3,0X21,0X24,
+0X18,0XE3,0XA5,0X34,0X21,0X24,0X21,0X04,0X29,0X45,0X6B,0X4D,0XEF,0X7D,0X5A,0XCB,
+0X29,0X45,0XD6,0X9A,0X18,0XE3,0X21,0X24,0X52,0XAA,0X39,0XE7,0X4A,0X49,0X4A,0X49,
+0X4A,0X69,0X84,0X30,0X21,0X04,0X73,0XAE,0X18,0XE3,0XD6,0X9A,0X21,0X04,0X6B,0X4D,
+0X29,0X65,0X8C,0X51,0X21,0X24,0X8B,0X21,0X04,0X01,0X21,0X24,0X73,0X8E,0X8A,0X21,
+0X04,0X1C,0X5A,0XEB,0X63,0X0C,0X18,0XC3,0X21,0X24,0XAD,0X55,0X18,0XC3,0X21,0X04,
+0XBD,0XF7,0XC6,0X38,0XEF,0X7D,0XF7,0X9E,0XC6,0X38,0XD6,0X9A,0X39,0XC7,0X21,0X24,
+0X18,0XE3,0X18,0XE3,0X5A,0XCB,0X21,0X04,0X18,0XE3,0X21,0X04,0X73,0XAE,0XC6,0X38,
+0X31,0X86,0X10,0X82,0X6B,0X6D,0X18,0XC3,0X18,0XE3,0X21,0X24,0X89,0X21,0X04,0X02,
+0X18,0XE3,0X21,0X04,0X4A,0X69,0X8B,0X21,0X04,0X1B,0X18,0XC3,0XF7,0X9E,0X73,0X8E,
+0X18,0XE3,0X21,0X04,0X21,0X04,0X29,0X45,0XBD,0XD7,0X8C,0X71,0XFF,0XDF,0X7B,0XEF,
+0X8C,0X71,0XFF,0XFF,0X29,0X45,0XF7,0XBE,0X29,0X65,0X73,0X8E,0X4A,0X69,0XD6,0XBA,
+0X4A,0X69,0X10,0XA2,0X42,0X08,0XFF,0XFF,0X21,0X24,0XFF,0XFF,0X9C,0XD3,0XCE,0X79,
+0X10,0XA2,0X97,0X21,0X04,0X9B,0X21,0X04,0X06,0X21,0X24,0XE7,0X3C,0X21,0X04,0X21,
+0X04,0X21,0X24,0X18,0XE3,0XBD,0XD7,0X85,0X21,0X04,0X0C,0X42,0X08,0XCE,0X59,0XBD,
+0XD7,0XB5,0XB6,0XD6,0XBA,0X21,0X24,0X29,0X45,0X73,0XAE,0X29,0X45,0X7B,0XEF,0X10,
+0XA2,0X21,0X04,0XA5,0X34,0X9A,0X21,0X04,0X1B,0X84,0X10,0XA5,0X14,0X7B,0XEF,0XD6,
+0X9A,0X18,0XC3,0X21,0X24,0X18,0XE3,0XF7,0X9E,0X94,0XB2,0X52,0X8A,0X52,0XAA,0XA5,
+0X14,0X42,0X08,0X21,0X04,0X21,0X04,0X29,0X65,0XCE,0X59,0X31,0XA6,0X21,0X24,0X21,
+0X24,0X4A,0X49,0X42,0X28,0XCE,0X79,0X31,0XA6,0X6B,0X6D,0X21,0X04,0X8C,0X51,0X21,
+0X24,0X8B,0X21,0X04,0X01,0X21,0X24,0X73,0XAE,0X89,0X21,0X04,0X1D,0X18,0XC3,0X21,
+0X04,0XCE,0X79,0X6B,0X6D,0XCE,0X79,0X84,0X10,0XEF,0X5D,0X18,0XE3,0X29,0X45,0X18,
+0XE3,0XC6,0X18,0XA5,0X34,0X63,0X2C,0X10,0XA2,0X21,0X04,0X18,0XC3,0X84,0X30,0X8C,
+0X71,0X73,0XAE,0XEF,0X7D,0X18,0XE3,0X21,0X24,0X29,0X45,0XCE,0X79,0X5A,0XCB,0X4A,
+0X49,0X63,0X0C,0X63,0X2C,0X31,0X86,0X21,0X24,0X8B,0X21,0X04,0X00,0X4A,0X69,0X8A,
+0X21,0X04,0X1B,0X29,0X45,0X39,0XE7,0XE7,0X3C,0X39,0XE7,0X8C,0X71,0X39,0XC7,0X4A,
+0X49,0X29,0X45,0XC6,0X18,0X94,0XB2,0XFF,0XFF,0X8C,0X51,0X4A,0X49,0XFF,0XFF,0X29,
+0X45,0X73,0X8E,0X21,0X24,0X42,0X28,0X18,0XC3,0XCE,0X79,0X29,0X45,0X18,0XE3,0X21,
+0X04,0XCE,0X59,0XC6,0X18,0XCE,0X79,0XBD,0XF7,0X18,0XE3,0X98,0X21,0X04,0X9B,0X21,
+0X04,0X01,0X21,0X24,0XE7,0X3C,0X82,0X21,0X04,0X02,0X18,0XE3,0XEF,0X7D,0X21,0X24,
+0X83,0X21,0X04,0X0D,0X21,0X24,0X42,0X28,0XAD,0X75,0X9C,0XF3,0X94,0XB2,0XD6,0X9A,
+0X29,0X65,0X10,0XA2,0X94,0X92,0X39,0XC7,0X7B,0XEF,0X21,0X04,0X29,0X45,0X9C,0XF3,
+0X9A,0X21,0X04,0X1B,0X18,0XE3,0XE7,0X3C,0X21,0X04,0XA5,0X34,0X29,0X45,0X21,0X04,
+0XE7,0X1C,0XEF,0X5D,0X29,0X65,0XAD,0X55,0XBD,0XD7,0XCE,0X79,0X5A,0XCB,0X29,0X45,
+0XCE,0X59,0X21,0X04,0XE7,0X3C,0XDE,0XFB,0XBD,0XD7,0X21,0X24,0XD6,0XBA,0X4A,0X69,
+0XD6,0XBA,0XC6,0X38,0X5A,0XEB,0X18,0XE3,0X8C,0X51,0X21,0X24,0X8B,0X21,0X04,0X01,
+0X21,0X24,0X73,0XAE,0X89,0X21,0X04,0X1C,0X18,0XE3,0X63,0X2C,0X31,0X86,0X21,0X24,
+0XBD,0XD7,0X29,0X65,0X7B,0XCF,0X21,0X24,0X18,0XE3,0XCE,0X79,0X21,0X04,0X8C,0X71,
+0XC6,0X38,0X42,0X08,0X21,0X04,0X21,0X04,0X21,0X24,0XE7,0X3C,0X29,0X65,0X6B,0X4D,
+0X21,0X24,0X21,0X04,0XBD,0XF7,0XB5,0XB6,0X63,0X0C,0XA5,0X34,0XBD,0XD7,0XBD,0XD7,
+0X31,0XA6,0X8C,0X21,0X04,0X00,0X4A,0X69,0X8C,0X21,0X04,0X1A,0XE7,0X3C,0X18,0XE3,
+0XCE,0X59,0X29,0X45,0X29,0X45,0X29,0X65,0X6B,0X6D,0X7B,0XEF,0X73,0XAE,0XC6,0X18,
+0X21,0X04,0XFF,0XFF,0X18,0XE3,0X63,0X2C,0X21,0X24,0X42,0X28,0X4A,0X49,0X52,0XAA,
+0X4A,0X49,0X29,0X65,0X21,0X04,0XCE,0X59,0X29,0X65,0X42,0X08,0X94,0XB2,0X21,0X24,
+0X18,0XE3,0X97,0X21,0X04,0X99,0X21,0X04,0X08,0X21,0X24,0X18,0XE3,0X18,0XE3,0XE7,
+0X1C,0X21,0X04,0X21,0X04,0X18,0XE3,0X21,0X04,0XFF,0XFF,0X84,0X21,0X04,0X0D,0X18,
+0XC3,0X4A,0X49,0X94,0X92,0X73,0XAE,0X7B,0XEF,0XD6,0XBA,0X21,0X04,0X21,0X04,0X6B,
+0X6D,0XC6,0X38,0X7B,0XCF,0X31,0XA6,0X31,0XA6,0X94,0X92,0X8B,0X21,0X04,0X00,0X21,
+0X24,0X8C,0X21,0X04,0X1B,0X18,0XC3,0X21,0X24,0X42,0X28,0XFF,0XFF,0X21,0X04,0X21,
+0X04,0X18,0XE3,0X21,0X04,0XF7,0X9E,0X21,0X24,0XFF,0XFF,0X21,0X24,0X94,0X92,0X21,
+0X24,0X21,0X24,0XAD,0X75,0X73,0X8E,0XCE,0X79,0X21,0X04,0X21,0X24,0X21,0X04,0XDE,
+0XDB,0X21,0X04,0XDE,0XFB,0XEF,0X7D,0X29,0X45,0X21,0X04,0X8C,0X51,0X8C,0X21,0X04,
+0X01,0X21,0X24,0X73,0XAE,0X89,0X21,0X04,0X1B,0X29,0X45,0X21,0X04,0X31,0X86,0X18,
+0XE3,0X39,0XC7,0XEF,0X7D,0X18,0XE3,0X21,0X04,0XDE,0XFB,0X31,0XA6,0X21,0X24,0X8C,
+0X71,0X21,0X04,0XBD,0XF7,0X39,0XC7,0X18,0XE3,0X29,0X45,0X73,0XAE,0XFF,0XDF,0X21,
+0X04,0X21,0X24,0X21,0X04,0X29,0X45,0XBD,0XF7,0X21,0X24,0XB5,0X96,0X31,0XA6,0X39,
+0XC7,0X8B,0X21,0X04,0X02,0X18,0XE3,0X21,0X04,0X4A,0X69,0X8B,0X21,0X04,0X1B,0X29,
+0X45,0XF7,0XBE,0XBD,0XD7,0X18,0XE3,0XD6,0XBA,0X8C,0X51,0X21,0X24,0XB5,0XB6,0X21,
+0X04,0XEF,0X7D,0XE7,0X3C,0X21,0X04,0XFF,0XFF,0X21,0X04,0X63,0X0C,0X21,0X24,0XDE,
+0XFB,0X21,0X04,0X29,0X65,0XD6,0X9A,0X29,0X45,0X18,0XC3,0X21,0X24,0XF7,0X9E,0X73,
+0X8E,0XE7,0X3C,0X21,0X04,0X21,0X24,0X97,0X21,0X04,0X99,0X21,0X04,0X81,0X39,0XC7,
+0X00,0X39,0XE7,0X82,0X31,0XA6,0X03,0X31,0X86,0XB5,0X96,0X42,0X28,0X21,0X24,0X83,
+0X21,0X04,0X0D,0X29,0X65,0X73,0XAE,0X6B,0X6D,0X73,0X8E,0X6B,0X4D,0X63,0X2C,0X8C,
+0X71,0X21,0X04,0X5A,0XCB,0X21,0X04,0X63,0X0C,0X29,0X65,0X9C,0XF3,0X42,0X28,0X98,
+0X21,0X04,0X1D,0X18,0XC3,0X5A,0XCB,0X84,0X30,0X29,0X65,0X21,0X24,0X39,0XE7,0XAD,
+0X75,0X18,0XC3,0X39,0XC7,0XCE,0X59,0X21,0X24,0X21,0X04,0XD6,0XBA,0X7B,0XCF,0X21,
+0X24,0XBD,0XD7,0X18,0XE3,0X31,0X86,0X84,0X10,0XCE,0X59,0XCE,0X59,0X29,0X45,0X29,
+0X45,0X29,0X65,0XD6,0X9A,0X21,0X04,0X21,0X04,0XE7,0X1C,0X4A,0X49,0X18,0XE3,0X8B,
+0X21,0X04,0X01,0X21,0X24,0X73,0XAE,0X89,0X21,0X04,0X1B,0X18,0XE3,0XD6,0X9A,0X18,
+0XE3,0XE7,0X3C,0X52,0X8A,0X29,0X65,0XB5,0XB6,0X42,0X08,0X21,0X04,0X21,0X24,0X21,
+0X24,0X8C,0X71,0X21,0X04,0X18,0XE3,0X21,0X24,0X84,0X30,0X73,0XAE,0X18,0XE3,0X29,
+0X45,0X39,0XC7,0XBD,0XF7,0X18,0XE3,0XA5,0X34,0X6B,0X6D,0X18,0XE3,0X10,0XA2,0XEF,
+0X5D,0X31,0X86,0X8B,0X21,0X04,0X02,0X18,0XE3,0X21,0X04,0X4A,0X69,0X8A,0X21,0X04,
+0X1B,0X18,0XE3,0X21,0X24,0X31,0XA6,0X21,0X04,0X18,0XE3,0X21,0X04,0X18,0XE3,0X21,
+0X04,0X21,0X24,0X21,0X04,0X21,0X24,0X21,0X04,0X21,0X04,0X39,0XC7,0X18,0XE3,0X39,
+0XC7,0X31,0XA6,0X18,0XE3,0X21,0X04,0X21,0X04,0X39,0XC7,0X29,0X45,0X7B,0XEF,0X29,
+0X45,0X21,0X24,0X18,0XC3,0X18,0XE3,0X7B,0XCF,0X98,0X21,0X04,0XC1,0X21,0X04,0X81,
+0X21,0X24,0XB5,0X21,0X04,0X00,0X73,0X8E,0XB1,0X21,0X04,0X03,0X18,0XC3,0X29,0X45,
+0X52,0X8A,0X21,0X24,0XBE,0X21,0X04,0XC1,0X21,0X04,0X01,0X18,0XE3,0X21,0X24,0XB5,
+0X21,0X04,0X00,0X6B,0X4D,0XB2,0X21,0X04,0X02,0X21,0X24,0X42,0X08,0X18,0XE3,0XBE,
+0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,
+0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XD4,0X21,0X04,0X09,0X19,0X04,
+0X21,0X24,0X20,0XE4,0X21,0X04,0X21,0X05,0X21,0X05,0X21,0X04,0X21,0X04,0X21,0X24,
+0X21,0X24,0X89,0X19,0X24,0X81,0X21,0X25,0X91,0X19,0X24,0X83,0X19,0X04,0X97,0X19,
+0X24,0X02,0X19,0X23,0X21,0X03,0X20,0XE4,0XD3,0X21,0X04,0XD4,0X21,0X04,0X0D,0X21,
+0X03,0X19,0X25,0X1A,0X4F,0X1A,0XD2,0X1B,0X33,0X1B,0X33,0X13,0X33,0X13,0X33,0X1B,
+0X13,0X1B,0X13,0X1B,0X33,0X1B,0X33,0X1B,0X13,0X1B,0X13,0X8F,0X1B,0X33,0X81,0X1B,
+0X13,0X83,0X1B,0X33,0X83,0X1B,0X13,0X83,0X13,0X13,0X89,0X1B,0X13,0X85,0X1B,0X33,
+0X81,0X1B,0X13,0X85,0X1B,0X33,0X03,0X1A,0XD2,0X19,0XAB,0X18,0XE4,0X21,0X24,0XD2,
+0X21,0X04,0XD4,0X21,0X04,0X01,0X11,0X05,0X0A,0XF4,0X88,0X03,0X37,0X0A,0X03,0X57,
+0X03,0X36,0X03,0X36,0X03,0X37,0X03,0X37,0X03,0X16,0X0B,0X56,0X03,0X56,0X03,0X77,
+0X03,0X79,0X03,0X38,0X85,0X03,0X37,0X00,0X03,0X56,0X82,0X03,0X37,0X1D,0X03,0X16,
+0X03,0X56,0X03,0X57,0X03,0X36,0X03,0X36,0X03,0X37,0X03,0X56,0X03,0X37,0X02,0XD7,
+0X03,0X56,0X03,0X17,0X02,0XF6,0X03,0X37,0X03,0X37,0X02,0XF7,0X03,0X16,0X03,0X56,
+0X02,0XF6,0X03,0X57,0X03,0X36,0X0B,0X76,0X0B,0X77,0X03,0X17,0X03,0X36,0X03,0X56,
+0X03,0X78,0X03,0X37,0X03,0X37,0X03,0X36,0X03,0X57,0X87,0X03,0X37,0X01,0X0A,0X4E,
+0X29,0X03,0XD2,0X21,0X04,0XD4,0X21,0X04,0X01,0X0A,0X0D,0X03,0X36,0X87,0X03,0X37,
+0X0B,0X03,0X57,0X03,0X98,0X03,0X57,0X03,0X36,0X03,0X37,0X03,0X37,0X0B,0X56,0X03,
+0X57,0X03,0X56,0X03,0X56,0X03,0X77,0X03,0X57,0X83,0X03,0X37,0X10,0X03,0X78,0X03,
+0X57,0X03,0X78,0X03,0X37,0X03,0X77,0X03,0X57,0X03,0X57,0X03,0X37,0X03,0X78,0X03,
+0X77,0X03,0X78,0X03,0X36,0X03,0X56,0X0B,0X36,0X54,0XFA,0X0B,0X77,0X54,0XFB,0X82,
+0X03,0X37,0X0E,0X23,0X97,0X3C,0X37,0X03,0X16,0X4C,0XDA,0X13,0X98,0X8E,0X7F,0X0B,
+0X56,0X03,0X57,0X03,0X16,0X03,0X78,0X03,0X36,0X6D,0X9C,0X03,0X37,0X03,0X37,0X03,
+0X78,0X88,0X03,0X37,0X01,0X03,0X36,0X10,0XE5,0XD2,0X21,0X04,0XD4,0X21,0X04,0X01,
+0X12,0XF3,0X03,0X36,0X87,0X03,0X37,0X33,0X44,0X18,0XE7,0XBF,0XBE,0XBD,0X03,0X38,
+0X03,0X98,0X02,0XD5,0XD7,0X9F,0X13,0X56,0X03,0X36,0XD7,0X3F,0XAE,0X3B,0X03,0X15,
+0X03,0X37,0X03,0X78,0X03,0X36,0X03,0X17,0X44,0X15,0XDF,0X9F,0XB6,0X9D,0X0B,0X56,
+0X5C,0X75,0XE7,0X7F,0X8D,0X9A,0X03,0X38,0X43,0XD7,0XE7,0XBF,0X6D,0X18,0X03,0X56,
+0X03,0X77,0X23,0X95,0X96,0X3E,0X03,0X57,0XBF,0X5F,0X13,0X36,0X03,0X36,0X03,0X15,
+0X7D,0X99,0X95,0X7A,0X23,0X73,0X9E,0XFF,0XA6,0X3C,0XDF,0X7F,0XBE,0X3B,0X02,0XD4,
+0X8E,0X3C,0XBE,0XBD,0XA6,0X1A,0XBE,0X5C,0XB6,0X7C,0XBE,0X9E,0XAE,0X9F,0X03,0X36,
+0X87,0X03,0X37,0X01,0X03,0X16,0X09,0X27,0XD2,0X21,0X04,0XD4,0X21,0X04,0X01,0X12,
+0XF3,0X03,0X36,0X87,0X03,0X37,0X33,0XB6,0XFF,0X03,0X36,0X75,0X39,0X3B,0X95,0X03,
+0X77,0X85,0XFD,0XEF,0XBF,0X03,0X56,0XC6,0XFD,0X1B,0X76,0X54,0X97,0X44,0X57,0X03,
+0X57,0X03,0X37,0X03,0X78,0X03,0X77,0XC7,0X5F,0X0B,0XB8,0X85,0X99,0X2B,0X97,0XDF,
+0XFF,0X0B,0X99,0X9E,0X5C,0X13,0X35,0XDF,0XDF,0X0B,0X16,0XC7,0X7F,0X13,0X36,0X13,
+0X57,0XDF,0X9F,0X0B,0X35,0X03,0X77,0X1B,0X96,0XDF,0XDF,0X1B,0X34,0X0B,0X56,0X8D,
+0XFC,0X85,0XDB,0X85,0X38,0XCF,0X3F,0X43,0XB3,0X1A,0X6F,0XCF,0XDF,0X0B,0X57,0X4C,
+0XBA,0X6D,0X59,0XB6,0XBF,0X2A,0XB0,0X9E,0XBF,0X95,0XDB,0X4C,0XBA,0X03,0X16,0X87,
+0X03,0X37,0X01,0X03,0X16,0X09,0X27,0XD2,0X21,0X04,0XD4,0X21,0X04,0X00,0X12,0XF2,
+0X89,0X03,0X37,0X32,0X03,0X36,0XD7,0X9F,0X0A,0XF4,0X23,0XB6,0X7D,0X59,0XD7,0X9E,
+0X03,0X34,0XE7,0XFF,0X03,0X58,0X23,0XD8,0X8D,0XBD,0X86,0X1D,0X33,0XF5,0XBF,0X1C,
+0X0A,0XF5,0X03,0X35,0X03,0X35,0XDF,0X5F,0X03,0X15,0XAE,0X7C,0X9D,0XDB,0XC7,0X5D,
+0X0A,0XF4,0XCF,0X1E,0X03,0X55,0X6C,0XFA,0X12,0XF6,0XBF,0X5F,0XBE,0XDC,0XBF,0X1D,
+0XC6,0XBD,0XC6,0XFF,0XBE,0XBE,0XDF,0XFF,0X0A,0XD2,0XAE,0X7E,0XDF,0X9F,0XAD,0XBA,
+0XAE,0XFE,0X75,0X7A,0X9D,0X9A,0XBE,0X9F,0X03,0X16,0X03,0X16,0X33,0XD7,0X6C,0X97,
+0XBE,0XDF,0X54,0XBB,0X5D,0X1D,0X03,0X16,0X03,0X57,0X87,0X03,0X37,0X01,0X03,0X36,
+0X09,0X47,0XD2,0X21,0X04,0XD4,0X21,0X04,0X00,0X12,0XF2,0X88,0X03,0X37,0X33,0X03,
+0X77,0X5C,0XDA,0X64,0XB8,0X0B,0X36,0XD7,0X5E,0X1B,0X55,0XDF,0X5F,0X12,0XD2,0XEF,
+0XFF,0X03,0X97,0X13,0X56,0X7D,0XBB,0X03,0X37,0XD7,0X9F,0X5C,0X98,0X03,0X37,0X03,
+0X77,0X7D,0X5B,0X54,0X58,0X03,0X15,0XE7,0XFF,0X13,0X14,0XAE,0X9E,0X12,0XB2,0XC6,
+0XDD,0X0B,0X36,0X64,0X99,0X12,0XF5,0X02,0XF4,0X13,0X36,0X95,0X9A,0X02,0XD2,0X13,
+0X14,0XB6,0XDE,0X0B,0X76,0X02,0XD4,0X3B,0X32,0X64,0X14,0X9E,0X3F,0XCF,0XDF,0X13,
+0X33,0XDF,0XFF,0X33,0X94,0X03,0X16,0XB7,0X7F,0X23,0X53,0XD7,0XDF,0XE7,0XBF,0XC7,
+0X1F,0X33,0X34,0X86,0X1E,0X03,0X58,0X87,0X03,0X37,0X01,0X03,0X36,0X09,0X47,0XD2,
+0X21,0X04,0XD4,0X21,0X04,0X01,0X0A,0XD2,0X0B,0X57,0X87,0X03,0X37,0X33,0X44,0X17,
+0XA6,0X3B,0X0B,0X36,0X0A,0XF5,0X4C,0X98,0X54,0X76,0XEF,0XBF,0X3C,0X38,0X9E,0X7C,
+0X1B,0X15,0X64,0XF8,0X33,0XD5,0X1B,0X16,0XC6,0XFE,0XB6,0XDF,0X0B,0X37,0X54,0X97,
+0X8D,0XBC,0X03,0X55,0X0B,0X16,0XCF,0X5E,0X03,0X15,0X85,0X5A,0X1B,0XB4,0XD7,0XFF,
+0X0B,0X35,0XCF,0X5F,0X02,0XF5,0X03,0X56,0X02,0XF5,0XD7,0XBF,0X03,0X15,0X12,0XB5,
+0X85,0X98,0X0B,0X57,0X0B,0X57,0X8D,0X5A,0XAE,0X18,0X2B,0X77,0XDF,0XFF,0X7D,0X9C,
+0XF7,0XFF,0XBE,0X7E,0X12,0XB3,0X9E,0XBE,0XA6,0XDF,0XAF,0X3F,0XFF,0XFF,0XAE,0XDE,
+0XAE,0XDE,0XAE,0XFF,0X02,0XF4,0X87,0X03,0X37,0X01,0X02,0XF5,0X09,0X07,0XD2,0X21,
+0X04,0XD4,0X21,0X04,0X00,0X12,0X90,0X88,0X03,0X37,0X32,0XAE,0XBE,0XAE,0XFF,0XAE,
+0X7D,0X23,0XB7,0X03,0X16,0X03,0X36,0X8E,0X3F,0X0B,0X16,0X0B,0X56,0XA6,0X9E,0X85,
+0XBD,0X03,0X36,0X8E,0X5E,0X03,0X15,0X4C,0X98,0X23,0XD7,0XA6,0XDF,0XA6,0X9E,0XAE,
+0X7D,0X1B,0X77,0X54,0X97,0XBF,0X1F,0X6D,0X7B,0X03,0X35,0X1B,0X75,0XBF,0X3F,0X44,
+0X37,0X03,0X56,0X12,0XF3,0XC6,0XFE,0X44,0X37,0X23,0XB7,0X74,0XF6,0X64,0XD8,0X03,
+0X36,0X03,0X36,0X95,0XBA,0X23,0X76,0XAE,0X1C,0X33,0XF6,0X03,0X57,0XD7,0XFF,0X13,
+0X15,0X0B,0X57,0X0B,0X14,0X0B,0X14,0X0A,0XF4,0XDF,0XBF,0X0B,0X15,0X0B,0X15,0X02,
+0XD4,0X88,0X03,0X37,0X01,0X03,0X36,0X11,0X27,0XD2,0X21,0X04,0XD4,0X21,0X04,0X03,
+0X19,0X88,0X03,0X38,0X03,0X58,0X03,0X16,0XA1,0X03,0X37,0X15,0X33,0XD7,0X13,0X55,
+0X03,0X57,0X03,0X57,0X23,0X95,0X03,0X36,0X03,0X57,0X03,0X56,0X2B,0XF7,0X03,0X15,
+0X2C,0X18,0X03,0X36,0X0B,0X36,0X64,0XFC,0X13,0X97,0X03,0X77,0X03,0X58,0X03,0X58,
+0X0B,0X56,0X6D,0X5D,0X03,0X56,0X03,0X56,0X87,0X03,0X37,0X03,0X03,0X16,0X03,0X58,
+0X0B,0X14,0X18,0XC4,0XD2,0X21,0X04,0XD5,0X21,0X04,0X02,0X12,0X2C,0X03,0X77,0X03,
+0X37,0X85,0X03,0X57,0X99,0X03,0X37,0X82,0X03,0X57,0X04,0X03,0X37,0X03,0X36,0X03,
+0X36,0X03,0X57,0X03,0X36,0X83,0X03,0X37,0X0D,0X03,0X57,0X03,0X38,0X03,0X37,0X03,
+0X58,0X03,0X56,0X03,0X57,0X03,0X37,0X03,0X37,0X03,0X17,0X03,0X37,0X03,0X57,0X03,
+0X57,0X03,0X37,0X03,0X37,0X85,0X03,0X57,0X03,0X03,0X37,0X0B,0X15,0X11,0X68,0X29,
+0X03,0XD2,0X21,0X04,0XD6,0X21,0X04,0X01,0X19,0X25,0X09,0X48,0XA1,0X01,0X48,0X89,
+0X01,0X49,0X83,0X01,0X48,0X89,0X01,0X49,0X85,0X01,0X48,0X01,0X09,0X27,0X19,0X05,
+0XD4,0X21,0X04,0XD7,0X21,0X04,0X00,0X21,0X03,0XA1,0X21,0X04,0X81,0X21,0X03,0X93,
+0X21,0X04,0X81,0X21,0X03,0X85,0X21,0X04,0X00,0X29,0X03,0XD5,0X21,0X04,0XFF,0X21,
+0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,
+0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,
+0X21,0X04,0XF4,0X21,0X04,0X81,0X18,0XE3,0X83,0X21,0X04,0X07,0X21,0X24,0X21,0X04,
+0X18,0XE3,0X18,0XE3,0X21,0X04,0X21,0X04,0X21,0X24,0X21,0X24,0X83,0X21,0X04,0X00,
+0X21,0X24,0XE7,0X21,0X04,0XE0,0X21,0X04,0X81,0X21,0X24,0X84,0X21,0X04,0X00,0X18,
+0XE3,0XFF,0X21,0X04,0X86,0X21,0X04,0XDB,0X21,0X04,0X08,0X21,0X24,0X29,0X45,0X29,
+0X45,0X21,0X24,0X18,0XE3,0X21,0X04,0X21,0X04,0X18,0XE3,0X18,0XE3,0X83,0X10,0XA2,
+0X9B,0X10,0X82,0X87,0X08,0X61,0X81,0X10,0XA2,0X08,0X18,0XC3,0X21,0X04,0X21,0X04,
+0X29,0X45,0X29,0X65,0X31,0X86,0X21,0X04,0X21,0X04,0X21,0X24,0XD7,0X21,0X04,0XD7,
+0X21,0X04,0X06,0X21,0X24,0X18,0XE3,0X10,0XA2,0X10,0XA2,0X10,0X82,0X08,0X61,0X08,
+0X61,0XAE,0X10,0X82,0X81,0X10,0XA2,0X82,0X10,0X82,0X81,0X08,0X61,0X03,0X10,0XA2,
+0X18,0XE3,0X29,0X45,0X21,0X24,0XD6,0X21,0X04,0XD6,0X21,0X04,0X01,0X10,0X82,0X08,
+0X61,0X82,0X10,0X82,0X00,0X08,0X61,0X83,0X10,0X82,0X81,0X08,0X61,0X83,0X10,0X82,
+0X81,0X08,0X61,0X81,0X10,0X82,0X85,0X08,0X61,0X81,0X10,0X82,0X99,0X08,0X61,0X03,
+0X10,0X82,0X08,0X61,0X08,0X61,0X10,0X82,0X88,0X08,0X61,0X81,0X29,0X45,0XD3,0X21,
+0X04,0XD3,0X21,0X04,0X02,0X18,0XE3,0X10,0X82,0X08,0X41,0X83,0X10,0X82,0X93,0X08,
+0X61,0X9F,0X08,0X41,0X8B,0X08,0X61,0X03,0X00,0X20,0X29,0X65,0X29,0X65,0X21,0X24,
+0XD0,0X21,0X04,0XD2,0X21,0X04,0X05,0X08,0X61,0X10,0XA2,0X10,0X82,0X08,0X61,0X10,
+0X82,0X10,0X82,0X87,0X08,0X61,0XB3,0X08,0X41,0X84,0X08,0X61,0X04,0X08,0X41,0X08,
+0X61,0X08,0X61,0X00,0X20,0X42,0X28,0XD0,0X21,0X04,0XCF,0X21,0X04,0X05,0X21,0X24,
+0X18,0XE3,0X08,0X61,0X08,0X61,0X10,0XA2,0X08,0X61,0X82,0X10,0X82,0X84,0X10,0XA2,
+0X82,0X10,0X82,0X81,0X08,0X61,0X9D,0X08,0X41,0X8D,0X00,0X20,0X8E,0X08,0X41,0X02,
+0X00,0X20,0X31,0X86,0X18,0XE3,0XCE,0X21,0X04,0XD0,0X21,0X04,0X07,0X10,0XA2,0X18,
+0XC3,0X21,0X04,0X29,0X65,0X29,0X65,0X31,0X86,0X29,0X45,0X29,0X45,0X82,0X21,0X24,
+0X82,0X21,0X04,0X04,0X18,0XE3,0X18,0XC3,0X10,0XA2,0X10,0XA2,0X10,0X82,0X82,0X08,
+0X61,0X93,0X08,0X41,0X97,0X00,0X20,0X8A,0X08,0X41,0X03,0X08,0X61,0X18,0XE3,0X29,
+0X65,0X29,0X45,0XCD,0X21,0X04,0XD0,0X21,0X04,0X1F,0X29,0X45,0X31,0XA6,0X39,0XC7,
+0X39,0XC7,0X31,0XA6,0X31,0X86,0X29,0X65,0X29,0X65,0X29,0X45,0X29,0X45,0X29,0X25,
+0X29,0X24,0X21,0X24,0X19,0X04,0X21,0X04,0X21,0X04,0X19,0X03,0X18,0XE3,0X18,0XC3,
+0X18,0XC3,0X18,0XA3,0X10,0XA3,0X10,0XA3,0X10,0X82,0X10,0X62,0X08,0X62,0X08,0X41,
+0X08,0X41,0X08,0X21,0X08,0X20,0X08,0X21,0X08,0X21,0X8F,0X00,0X20,0X81,0X00,0X00,
+0X8F,0X00,0X20,0X00,0X08,0X41,0X84,0X00,0X20,0X81,0X08,0X41,0X06,0X10,0X82,0X18,
+0XC3,0X29,0X45,0X31,0X86,0X21,0X24,0X21,0X24,0X31,0X86,0XCD,0X21,0X04,0XCF,0X21,
+0X04,0X08,0X29,0X45,0X31,0X86,0X39,0XC7,0X42,0X08,0X39,0XE7,0X39,0XC7,0X31,0X86,
+0X31,0X86,0X29,0X65,0X82,0X29,0X45,0X08,0X31,0X66,0X39,0XC7,0X41,0XE8,0X4A,0X08,
+0X4A,0X08,0X41,0XE7,0X41,0XC7,0X41,0XC7,0X41,0XE7,0X82,0X41,0XC7,0X05,0X39,0XC7,
+0X39,0XA7,0X39,0XA7,0X39,0X86,0X39,0X86,0X31,0X66,0X82,0X31,0X45,0X83,0X29,0X45,
+0X81,0X29,0X25,0X8B,0X29,0X45,0X83,0X29,0X65,0X81,0X31,0X65,0X81,0X31,0X85,0X81,
+0X31,0X66,0X83,0X31,0XA6,0X03,0X39,0X86,0X29,0X04,0X18,0XC3,0X08,0X61,0X83,0X00,
+0X20,0X81,0X08,0X41,0X07,0X08,0X61,0X21,0X04,0X29,0X45,0X31,0X86,0X31,0X86,0X29,
+0X45,0X29,0X45,0X31,0XA6,0XCC,0X21,0X04,0XCC,0X21,0X04,0X10,0X21,0X24,0X18,0XE3,
+0X29,0X65,0X31,0X86,0X39,0XE7,0X4A,0X69,0X4A,0X49,0X42,0X08,0X39,0XA6,0X31,0X86,
+0X31,0X86,0X21,0X03,0X5A,0X69,0XDE,0X78,0XFF,0X7C,0XF7,0X1B,0XFF,0X1A,0X8C,0XFF,
+0X1B,0X83,0XFE,0XFB,0X8D,0XFF,0X1B,0X81,0XFE,0XFB,0X83,0XFF,0X1B,0X81,0XFE,0XFB,
+0X87,0XFF,0X1B,0X81,0XFF,0X1C,0X08,0XFF,0X1B,0XFE,0XFB,0XFE,0X9A,0XFE,0X9A,0XFE,
+0X79,0XFE,0XBA,0XF6,0X99,0X9C,0X30,0X10,0X41,0X83,0X00,0X20,0X07,0X18,0XC3,0X21,
+0X24,0X31,0X86,0X39,0XE7,0X31,0XA6,0X29,0X45,0X21,0X04,0X29,0X65,0XCB,0X21,0X04,
+0XCC,0X21,0X04,0X10,0X18,0XE3,0X29,0X45,0X31,0X86,0X39,0XC7,0X4A,0X69,0X52,0XAA,
+0X4A,0X49,0X39,0XE7,0X31,0X86,0X31,0X66,0X41,0XE7,0XFF,0X3C,0XF6,0XFB,0XFE,0XFA,
+0XFF,0X1B,0XFF,0X5C,0XFE,0XFB,0X82,0XFF,0X3C,0X86,0XFF,0X1C,0X02,0XFF,0X1B,0XFF,
+0X1C,0XFF,0X1C,0X83,0XFF,0X1B,0X83,0XFF,0X1C,0X91,0XFF,0X1B,0X85,0XFF,0X1C,0X81,
+0XFF,0X1B,0X81,0XFF,0X3C,0X02,0XFE,0XFB,0XFE,0XBA,0XFE,0XBA,0X83,0XFE,0X99,0X02,
+0XFE,0X79,0XFE,0X99,0X9C,0X31,0X82,0X00,0X20,0X07,0X08,0X61,0X21,0X04,0X31,0X86,
+0X39,0XE7,0X42,0X08,0X29,0X65,0X21,0X24,0X29,0X45,0XCB,0X21,0X04,0XCD,0X21,0X04,
+0X09,0X29,0X65,0X31,0XA6,0X4A,0X49,0X5A,0XCB,0X52,0X8A,0X42,0X08,0X31,0X86,0X39,
+0XA6,0X83,0XEF,0XF7,0X1B,0XB4,0XFF,0X1B,0X02,0XFF,0X3C,0XFE,0XFB,0XFE,0XB9,0X84,
+0XFE,0X99,0X81,0XFE,0X79,0X0D,0XFE,0X99,0XF6,0X58,0XFE,0XBA,0X08,0X20,0X08,0X41,
+0X00,0X00,0X10,0X82,0X29,0X24,0X39,0XE7,0X4A,0X49,0X39,0XC7,0X29,0X65,0X21,0X24,
+0X29,0X45,0XCA,0X21,0X04,0XCC,0X21,0X04,0X0B,0X29,0X65,0X39,0XC7,0X39,0XE7,0X5A,
+0XCB,0X5A,0XEB,0X4A,0X49,0X39,0XC7,0X31,0X86,0X94,0X71,0XFF,0X3B,0XFF,0X1B,0XFF,
+0X1A,0X87,0XFF,0X1B,0X83,0XFE,0XFB,0XA7,0XFF,0X1B,0X03,0XFE,0XFB,0XFE,0XBA,0XFE,
+0X99,0XFE,0X79,0X83,0XFE,0X99,0X81,0XFE,0X79,0X0D,0XFE,0X99,0XFE,0XBA,0XFE,0X99,
+0XFE,0XBB,0X18,0XA2,0X08,0X20,0X08,0X41,0X18,0XE3,0X31,0XA6,0X52,0X8A,0X4A,0X69,
+0X31,0XA6,0X31,0X86,0X21,0X24,0XCA,0X21,0X04,0XCA,0X21,0X04,0X0B,0X21,0X24,0X18,
+0XC3,0X31,0XA6,0X39,0XC7,0X4A,0X49,0X63,0X2C,0X52,0XAA,0X39,0XE7,0X29,0X65,0X62,
+0XAA,0XFF,0X3B,0XFE,0XFA,0X8F,0XFF,0X1B,0X8F,0XFE,0XFB,0X95,0XFF,0X1B,0X03,0XFE,
+0XB9,0XFE,0X79,0XFE,0X99,0XFE,0X99,0X87,0XFE,0X79,0X0C,0XFE,0X58,0XFE,0X99,0XF6,
+0X99,0X10,0X41,0X00,0X20,0X10,0X82,0X21,0X04,0X4A,0X49,0X5A,0XEB,0X39,0XE7,0X31,
+0X86,0X21,0X24,0X21,0X24,0XC9,0X21,0X04,0XCB,0X21,0X04,0X0A,0X29,0X45,0X31,0XA6,
+0X39,0XC7,0X5A,0XEB,0X63,0X0C,0X4A,0X69,0X31,0XA6,0X29,0X65,0XFF,0X1B,0XFE,0XFA,
+0XFE,0XFA,0X8F,0XFF,0X1B,0X8F,0XFE,0XFB,0X93,0XFF,0X1B,0X01,0XFF,0X3B,0XFE,0XDB,
+0X83,0XFE,0X99,0X87,0XFE,0X79,0X0B,0XFE,0X58,0XFE,0X79,0XFE,0XBA,0X8B,0XAE,0X00,
+0X20,0X00,0X20,0X10,0XA2,0X39,0XC7,0X5A,0XEB,0X4A,0X69,0X31,0X86,0X31,0X86,0XCA,
+0X21,0X04,0XCA,0X21,0X04,0X09,0X18,0XC3,0X31,0X86,0X31,0XA6,0X42,0X08,0X63,0X0C,
+0X5A,0XCB,0X42,0X08,0X31,0XA6,0XAC,0XF3,0XFF,0X1B,0X87,0XFF,0X1A,0X83,0XFF,0X1B,
+0X82,0XFE,0XFA,0X82,0XFF,0X1A,0X85,0XFE,0XFA,0X9C,0XFE,0XFB,0X02,0XFF,0X1B,0XFE,
+0XBA,0XFE,0X99,0X8B,0XFE,0X79,0X82,0XFE,0X58,0X09,0XFE,0XFB,0X10,0X41,0X00,0X20,
+0X08,0X61,0X21,0X04,0X52,0X8A,0X5A,0XEB,0X31,0XA6,0X31,0X86,0X21,0X24,0XC9,0X21,
+0X04,0XCA,0X21,0X04,0X0B,0X18,0XC3,0X31,0XA6,0X31,0XA6,0X42,0X28,0X63,0X0C,0X4A,
+0X49,0X39,0XC7,0X29,0X65,0XFF,0X5C,0XFE,0XFA,0XFF,0X1A,0XFF,0X1A,0X83,0XFE,0XFA,
+0X81,0XFF,0X1A,0X83,0XFF,0X1B,0X82,0XFE,0XFA,0X82,0XFF,0X1A,0X85,0XFE,0XFA,0X9C,
+0XFE,0XFB,0X00,0XFE,0XDB,0X8C,0XFE,0X79,0X82,0XFE,0X58,0X09,0XFE,0X98,0XFE,0X79,
+0X6A,0XCB,0X00,0X40,0X08,0X41,0X10,0X82,0X42,0X28,0X5A,0XEB,0X39,0XE7,0X31,0XA6,
+0XCA,0X21,0X04,0XCB,0X21,0X04,0X08,0X31,0XA6,0X39,0XC7,0X4A,0X69,0X5A,0XCB,0X42,
+0X08,0X31,0XA6,0X49,0XE8,0XFF,0X1B,0XFF,0X3A,0X9D,0XFE,0XFA,0X95,0XFE,0XFB,0X01,
+0XFE,0XDB,0XFE,0X99,0X87,0XFE,0X79,0X83,0XFE,0X78,0X85,0XFE,0X58,0X08,0XE5,0XF7,
+0X00,0X00,0X08,0X41,0X10,0X82,0X31,0XA6,0X52,0X8A,0X39,0XE7,0X31,0X86,0X21,0X24,
+0XC9,0X21,0X04,0XCA,0X21,0X04,0X09,0X29,0X45,0X31,0XA6,0X39,0XC7,0X52,0X8A,0X52,
+0X8A,0X39,0XE7,0X29,0X85,0X9C,0X72,0XFE,0XB9,0XFF,0X3A,0X9D,0XFE,0XFA,0X8D,0XFE,
+0XFB,0X83,0XFE,0XDB,0X81,0XFE,0XFB,0X81,0XFE,0XDB,0X01,0XFE,0X79,0XFE,0X78,0X87,
+0XFE,0X79,0X89,0XFE,0X58,0X08,0XFE,0XBA,0X08,0X20,0X08,0X41,0X08,0X61,0X29,0X65,
+0X42,0X28,0X39,0XE7,0X29,0X65,0X29,0X45,0XC9,0X21,0X04,0XCA,0X21,0X04,0X07,0X29,
+0X65,0X31,0X86,0X31,0XA6,0X4A,0X49,0X4A,0X69,0X39,0XE7,0X29,0X65,0XCD,0XF7,0X87,
+0XFE,0XFA,0X83,0XFE,0XDA,0X97,0XFE,0XFA,0X85,0XFE,0XDA,0X83,0XFE,0XFA,0X86,0XFE,
+0XDA,0X00,0XFE,0X99,0X85,0XFE,0X78,0X85,0XFE,0X58,0X87,0XFE,0X57,0X09,0XFE,0X58,
+0X18,0X82,0X08,0X41,0X08,0X61,0X21,0X24,0X42,0X08,0X39,0XE7,0X29,0X65,0X21,0X24,
+0X21,0X24,0XC8,0X21,0X04,0XCA,0X21,0X04,0X09,0X29,0X45,0X31,0X86,0X31,0XA6,0X4A,
+0X49,0X42,0X28,0X39,0XC7,0X29,0X65,0XDE,0X59,0XFE,0XFA,0XFE,0XFA,0X83,0XFE,0XDA,
+0X81,0XFE,0XFA,0XAB,0XFE,0XDA,0X01,0XFE,0XB9,0XFE,0X57,0X85,0XFE,0X78,0X83,0XFE,
+0X58,0X81,0XFE,0X77,0X85,0XFE,0X57,0X82,0XFE,0X37,0X08,0X18,0X41,0X08,0X41,0X08,
+0X41,0X21,0X24,0X42,0X08,0X39,0XE7,0X29,0X65,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,
+0XCA,0X21,0X04,0X09,0X29,0X65,0X31,0X86,0X31,0XA6,0X42,0X08,0X42,0X08,0X31,0XA6,
+0X29,0X44,0XDE,0X79,0XFE,0XDA,0XFE,0XF9,0X85,0XFE,0XDA,0X81,0XFE,0XFA,0XA8,0XFE,
+0XDA,0X02,0XFE,0XB9,0XFE,0X58,0XFE,0X58,0X87,0XFE,0X77,0X89,0XFE,0X57,0X82,0XFE,
+0X37,0X08,0X18,0X41,0X08,0X41,0X08,0X41,0X21,0X24,0X39,0XE7,0X39,0XC7,0X29,0X65,
+0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,0X21,0X04,0X09,0X29,0X65,0X31,0X86,0X31,
+0XA6,0X42,0X08,0X42,0X08,0X31,0XA6,0X29,0X44,0XDE,0X79,0XFE,0XDA,0XFE,0XF9,0X89,
+0XFE,0XDA,0X83,0XFE,0XD9,0X93,0XFE,0XDA,0X83,0XFE,0XD9,0X89,0XFE,0XDA,0X03,0XFE,
+0XD9,0XFE,0X78,0XFE,0X77,0XFE,0X57,0X87,0XFE,0X77,0X81,0XFE,0X37,0X83,0XFE,0X57,
+0X86,0XFE,0X37,0X08,0X18,0X41,0X08,0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,0XC7,
+0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,0X21,0X04,0X08,0X29,0X65,0X31,
+0X86,0X31,0X86,0X42,0X08,0X42,0X08,0X31,0XA6,0X29,0X45,0XE6,0X78,0XFE,0XDA,0X9B,
+0XFE,0XD9,0X00,0XFE,0XB9,0X87,0XFE,0XD9,0X87,0XFE,0XDA,0X00,0XFE,0XD9,0X82,0XFE,
+0XDA,0X00,0XFE,0X98,0X8C,0XFE,0X57,0X87,0XFE,0X37,0X82,0XFE,0X16,0X08,0X18,0X61,
+0X08,0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,
+0XC8,0X21,0X04,0XCA,0X21,0X04,0X07,0X29,0X65,0X31,0X86,0X31,0X86,0X42,0X08,0X42,
+0X08,0X31,0XA6,0X29,0X45,0XE6,0X78,0X88,0XFE,0XD9,0X00,0XFE,0XB8,0X89,0XFE,0XD9,
+0X85,0XFE,0XB9,0X82,0XFE,0XD9,0X82,0XFE,0XB9,0X83,0XFE,0XD9,0X81,0XFE,0XB9,0X87,
+0XFE,0XDA,0X04,0XFE,0XD9,0XFE,0XDA,0XFE,0XFA,0XFE,0XB9,0XFE,0X58,0X88,0XFE,0X57,
+0X89,0XFE,0X37,0X81,0XFE,0X36,0X82,0XFE,0X16,0X08,0X18,0X61,0X08,0X41,0X08,0X41,
+0X21,0X04,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,
+0X21,0X04,0X0F,0X29,0X65,0X31,0X86,0X31,0X86,0X42,0X08,0X42,0X08,0X31,0XA6,0X29,
+0X45,0XE6,0X78,0XFE,0XB9,0XFE,0XD8,0XFE,0XD9,0XFE,0XD9,0XFE,0XD8,0XFE,0XD8,0XFE,
+0XD9,0XFE,0XD9,0X85,0XFE,0XD8,0X83,0XFE,0XB8,0X81,0XFE,0XD9,0X87,0XFE,0XB8,0X83,
+0XFE,0XB9,0X81,0XFE,0XD9,0X83,0XFE,0XB9,0X89,0XFE,0XD9,0X01,0XFE,0XB9,0XFE,0X77,
+0X89,0XFE,0X57,0X85,0XFE,0X37,0X88,0XFE,0X16,0X08,0X18,0X41,0X08,0X21,0X08,0X41,
+0X21,0X04,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,
+0X21,0X04,0X08,0X29,0X65,0X31,0X86,0X31,0X86,0X42,0X08,0X42,0X08,0X31,0XA6,0X29,
+0X45,0XE6,0X78,0XFE,0XB9,0X82,0XFE,0XD8,0X81,0XFE,0XB8,0X81,0XFE,0XD8,0X89,0XFE,
+0XB8,0X81,0XFE,0XD9,0X87,0XFE,0XB8,0X81,0XFE,0XB9,0X83,0XFE,0XB8,0X89,0XFE,0XB9,
+0X83,0XFE,0XD9,0X00,0XFE,0X78,0X88,0XFE,0X57,0X84,0XFE,0X37,0X84,0XFE,0X16,0X81,
+0XFD,0XF6,0X84,0XFE,0X16,0X08,0X18,0X41,0X08,0X21,0X08,0X41,0X21,0X04,0X39,0XC7,
+0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,0X21,0X04,0X09,0X29,
+0X45,0X31,0X86,0X31,0X86,0X42,0X08,0X39,0XE7,0X31,0XA6,0X29,0X45,0XDE,0X57,0XFE,
+0XB8,0XFE,0XD8,0X97,0XFE,0XB8,0X85,0XFE,0XB9,0X83,0XFE,0X98,0X81,0XFE,0XB8,0X87,
+0XFE,0XB9,0X01,0XFE,0XB8,0XFE,0X98,0X82,0XFE,0X57,0X04,0XFE,0X37,0XFE,0X57,0XFE,
+0X57,0XFE,0X37,0XFE,0X37,0X85,0XFE,0X36,0X00,0XFE,0X17,0X82,0XFE,0X16,0X85,0XFD,
+0XF6,0X82,0XFE,0X16,0X08,0X18,0X41,0X08,0X21,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,
+0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,0X21,0X04,0X09,0X29,0X45,
+0X31,0X86,0X31,0X86,0X42,0X08,0X39,0XE7,0X31,0XA6,0X29,0X45,0XDE,0X57,0XFE,0XB8,
+0XFE,0XD8,0X8D,0XFE,0XB8,0X81,0XFE,0X98,0X83,0XFE,0XB8,0X81,0XFE,0X98,0X81,0XFE,
+0XB8,0X89,0XFE,0X98,0X81,0XFE,0XB8,0X81,0XFE,0X98,0X85,0XFE,0XB8,0X04,0XFE,0X98,
+0XFE,0X57,0XFE,0X57,0XFE,0X37,0XFE,0X57,0X84,0XFE,0X37,0X81,0XFE,0X36,0X87,0XFE,
+0X16,0X87,0XFD,0XF6,0X09,0XFE,0X16,0X18,0X41,0X08,0X21,0X08,0X41,0X21,0X04,0X39,
+0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XCA,0X21,0X04,0X08,
+0X29,0X45,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,0X45,0XDE,0X57,
+0XFE,0X98,0X82,0XFE,0XB8,0X93,0XFE,0X98,0X03,0XEE,0X36,0XFE,0XB8,0XFE,0X98,0XFE,
+0X98,0X83,0XFE,0XB8,0X83,0XFE,0X98,0X83,0XFE,0XB8,0X83,0XFE,0X98,0X02,0XFE,0XB8,
+0XFE,0X98,0XFE,0X57,0X84,0XFE,0X36,0X89,0XFE,0X16,0X8C,0XFD,0XF6,0X07,0X18,0X41,
+0X08,0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0XC9,0X21,
+0X04,0XCA,0X21,0X04,0X09,0X29,0X45,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,
+0X86,0X29,0X45,0XDE,0X57,0XFE,0X98,0XFE,0XB8,0X95,0XFE,0X98,0X03,0XED,0XF5,0XFE,
+0XB8,0XFE,0X98,0XFE,0X98,0X83,0XFE,0XB8,0X83,0XFE,0X98,0X83,0XFE,0XB8,0X83,0XFE,
+0X98,0X05,0XFE,0XB8,0XFE,0X98,0XFE,0X36,0XFE,0X16,0XFE,0X36,0XFE,0X36,0X87,0XFE,
+0X16,0X83,0XFE,0X15,0X8C,0XFD,0XF6,0X07,0X18,0X41,0X08,0X41,0X08,0X41,0X21,0X04,
+0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0XC9,0X21,0X04,0XCA,0X21,0X04,0X09,0X29,
+0X45,0X31,0X86,0X31,0X86,0X42,0X08,0X39,0XE7,0X31,0X86,0X21,0X25,0XDE,0X56,0XFE,
+0X97,0XFE,0X98,0X8B,0XFE,0X97,0X83,0XFE,0X77,0X85,0XFE,0X98,0X05,0XED,0XF5,0XFE,
+0X98,0XFE,0X78,0XFE,0X78,0XFE,0X77,0XFE,0X77,0X8E,0XFE,0X98,0X02,0XF6,0X36,0XFE,
+0X16,0XFE,0X16,0X85,0XFE,0X15,0X8F,0XFD,0XF5,0X81,0XFD,0XF6,0X81,0XFD,0XF5,0X08,
+0XFD,0XD5,0X18,0X40,0X08,0X41,0X08,0X41,0X18,0XE3,0X39,0XC7,0X39,0XC7,0X31,0X86,
+0X21,0X24,0XC9,0X21,0X04,0XCA,0X21,0X04,0X08,0X29,0X45,0X31,0X86,0X31,0X86,0X42,
+0X08,0X39,0XE7,0X31,0X86,0X21,0X25,0XDE,0X36,0XFE,0X77,0X83,0XFE,0X97,0X84,0XFE,
+0X77,0X83,0XFE,0X97,0X89,0XFE,0X77,0X00,0XE5,0XD5,0X88,0XFE,0X77,0X89,0XFE,0X78,
+0X01,0XFE,0X57,0XFE,0X16,0X87,0XFE,0X15,0X8F,0XFD,0XF5,0X81,0XFD,0XF6,0X81,0XFD,
+0XF5,0X08,0XFD,0XD5,0X18,0X40,0X08,0X41,0X08,0X41,0X18,0XE3,0X39,0XC7,0X39,0XC7,
+0X31,0X86,0X21,0X24,0XC9,0X21,0X04,0XC8,0X21,0X04,0X81,0X18,0XE3,0X08,0X21,0X24,
+0X31,0X86,0X31,0XA6,0X42,0X08,0X39,0XE7,0X31,0X86,0X21,0X25,0XDE,0X16,0XFE,0X76,
+0X96,0XFE,0X77,0X01,0XD5,0X12,0XFE,0X98,0X8F,0XFE,0X77,0X02,0XFE,0X78,0XFE,0X57,
+0XFE,0X16,0X98,0XFD,0XF5,0X81,0XFD,0XD5,0X0A,0XFD,0XF5,0XFD,0XD5,0XFD,0XF5,0X20,
+0X41,0X08,0X41,0X08,0X41,0X18,0XE3,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0XC9,
+0X21,0X04,0XC8,0X21,0X04,0X81,0X18,0XE3,0X08,0X21,0X24,0X31,0X86,0X31,0XA6,0X42,
+0X08,0X39,0XE7,0X31,0X86,0X21,0X25,0XDE,0X16,0XFE,0X76,0X82,0XFE,0X77,0X87,0XFE,
+0X76,0X8B,0XFE,0X77,0X01,0XC4,0XB0,0XFE,0X98,0X8F,0XFE,0X77,0X01,0XFE,0X78,0XFE,
+0X16,0X91,0XFD,0XF5,0X8B,0XFD,0XD5,0X08,0XFD,0XD4,0X18,0X41,0X08,0X41,0X08,0X41,
+0X18,0XE3,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0XC9,0X21,0X04,0XC3,0X21,0X04,
+0X86,0X18,0XE3,0X09,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,
+0X21,0X44,0XDE,0X16,0XFE,0X56,0XFE,0X97,0X89,0XFE,0X76,0X85,0XFE,0X56,0X81,0XFE,
+0X76,0X81,0XFE,0X77,0X81,0XFE,0X57,0X01,0XC4,0XB1,0XFE,0X97,0X85,0XFE,0X57,0X81,
+0XFE,0X77,0X81,0XFE,0X57,0X85,0XFE,0X77,0X00,0XFE,0X37,0X8C,0XFD,0XF5,0X8A,0XFD,
+0XD5,0X00,0XFD,0XB4,0X83,0XFD,0XB5,0X82,0XFD,0XB4,0X07,0X20,0X41,0X08,0X41,0X08,
+0X41,0X18,0XE3,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0XC9,0X21,0X04,0XC3,0X21,
+0X04,0X86,0X18,0XE3,0X0B,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,
+0X86,0X21,0X44,0XDE,0X16,0XD5,0X11,0XFE,0X76,0XFE,0X56,0XFE,0X56,0X87,0XFE,0X76,
+0X89,0XFE,0X56,0X09,0XFE,0X57,0XFE,0X36,0X9B,0X4B,0XF6,0X36,0XFE,0X56,0XFE,0X56,
+0XFE,0X57,0XFE,0X57,0XFE,0X76,0XFE,0X76,0X83,0XFE,0X57,0X85,0XFE,0X77,0X01,0XFE,
+0X16,0XFD,0XD4,0X83,0XFD,0XF5,0X8D,0XFD,0XD5,0X84,0XFD,0XB5,0X87,0XFD,0XB4,0X07,
+0X20,0X41,0X08,0X41,0X08,0X41,0X18,0XE3,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,
+0XC9,0X21,0X04,0XC3,0X21,0X04,0X86,0X18,0XE3,0X09,0X21,0X24,0X31,0X86,0X31,0X86,
+0X39,0XE7,0X39,0XE7,0X31,0X86,0X21,0X24,0XDD,0XF6,0XFE,0X56,0XFE,0X55,0X89,0XFE,
+0X56,0X89,0XFE,0X36,0X03,0XFE,0X56,0XFE,0X36,0X9B,0X4C,0XFE,0X77,0X83,0XFE,0X56,
+0X89,0XFE,0X57,0X03,0XFE,0X77,0XFE,0X16,0XFD,0XF5,0XFD,0XF5,0X87,0XFD,0XD5,0X81,
+0XFD,0XD4,0X85,0XFD,0XD5,0X8B,0XFD,0XB4,0X82,0XFD,0X94,0X08,0X18,0X41,0X08,0X41,
+0X08,0X41,0X18,0XE3,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,
+0X04,0XC3,0X21,0X04,0X86,0X18,0XE3,0X09,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,
+0X39,0XE7,0X31,0X86,0X21,0X24,0XDD,0XF6,0XF6,0X15,0XFE,0X55,0X87,0XFE,0X56,0X83,
+0XFE,0X35,0X85,0XFE,0X36,0X81,0XFE,0X35,0X05,0XFE,0X55,0XFE,0X36,0X82,0XA9,0XFE,
+0X77,0XFE,0X56,0XFE,0X56,0X83,0XFE,0X36,0X83,0XFE,0X37,0X83,0XFE,0X57,0X00,0XFE,
+0X36,0X82,0XFD,0XF5,0X00,0XFD,0XD5,0X8E,0XFD,0XD4,0X83,0XFD,0XB4,0X81,0XFD,0X94,
+0X85,0XFD,0XB4,0X82,0XFD,0X94,0X08,0X18,0X41,0X08,0X41,0X08,0X41,0X18,0XE3,0X39,
+0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XBF,0X21,0X04,0X8A,
+0X18,0XE3,0X09,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,
+0X45,0XDD,0XD5,0XFE,0X35,0XFE,0X34,0X93,0XFE,0X35,0X03,0XFE,0X15,0XFE,0X36,0X82,
+0X89,0XED,0XF5,0X89,0XFE,0X36,0X81,0XFE,0X56,0X02,0XFE,0X57,0XFE,0X36,0XFD,0XF4,
+0X84,0XFD,0XD4,0X85,0XFD,0XB3,0X8B,0XFD,0XB4,0X8A,0XFD,0X94,0X08,0X20,0X40,0X08,
+0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,
+0X21,0X04,0XBE,0X21,0X04,0X8B,0X18,0XE3,0X09,0X21,0X24,0X31,0X86,0X31,0X86,0X39,
+0XE7,0X39,0XE7,0X31,0X86,0X29,0X45,0XDD,0XD5,0XFE,0X14,0XFE,0X34,0X91,0XFE,0X35,
+0X06,0XFE,0X36,0XFE,0X35,0XFE,0X15,0XFE,0X35,0X8A,0XCA,0XE5,0X74,0XFE,0X15,0X89,
+0XFE,0X36,0X04,0XFE,0X56,0XFE,0X36,0XFE,0X15,0XFD,0XD4,0XFD,0XD3,0X83,0XFD,0XD4,
+0X85,0XFD,0XB3,0X85,0XFD,0XB4,0X83,0XFD,0X94,0X81,0XFD,0XB4,0X8A,0XFD,0X94,0X08,
+0X20,0X40,0X08,0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X24,
+0X21,0X24,0XC8,0X21,0X04,0XBD,0X21,0X04,0X8C,0X18,0XE3,0X09,0X21,0X24,0X31,0X86,
+0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,0X65,0XDD,0XD4,0XFE,0X35,0XFE,0X34,
+0X83,0XFE,0X14,0X81,0XFE,0X34,0X87,0XFE,0X35,0X87,0XFE,0X15,0X07,0X7A,0X89,0XDD,
+0X53,0XFE,0X16,0XFE,0X35,0XFE,0X15,0XFE,0X15,0XFE,0X35,0XFE,0X35,0X86,0XFE,0X36,
+0X02,0XFD,0XD4,0XFD,0XD3,0XFD,0XD3,0X91,0XFD,0XB3,0X83,0XFD,0X94,0X87,0XFD,0X93,
+0X82,0XFD,0X73,0X08,0X20,0X40,0X08,0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,0XC7,
+0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XBB,0X21,0X04,0X8E,0X18,0XE3,0X07,
+0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,0X65,0XDD,0XD4,
+0X8F,0XFE,0X14,0X86,0XFE,0X15,0X02,0XF5,0XF5,0X72,0X48,0XD5,0X32,0X89,0XFE,0X15,
+0X81,0XFE,0X36,0X00,0XFD,0XF4,0X8C,0XFD,0XB3,0X8F,0XFD,0X93,0X83,0XFD,0X73,0X81,
+0XFD,0X72,0X09,0XFD,0X53,0X20,0X40,0X08,0X41,0X08,0X41,0X21,0X04,0X39,0XC7,0X39,
+0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XBB,0X21,0X04,0X8E,0X18,0XE3,
+0X07,0X29,0X45,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,0X45,0XDD,
+0XB4,0X93,0XFE,0X14,0X81,0XFD,0XF4,0X07,0XFE,0X15,0XF5,0XF5,0X72,0X27,0XD5,0X12,
+0XFD,0XF5,0XFE,0X14,0XFD,0XF5,0XFD,0XF5,0X87,0XFE,0X15,0X00,0XFD,0XD3,0X89,0XFD,
+0XB3,0X8A,0XFD,0X93,0X87,0XFD,0X73,0X83,0XFD,0X72,0X82,0XFD,0X52,0X08,0X20,0X41,
+0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,
+0XC8,0X21,0X04,0XBA,0X21,0X04,0X8E,0X18,0XE3,0X08,0X21,0X04,0X21,0X24,0X31,0XA6,
+0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,0X45,0XDD,0XB4,0X87,0XFE,0X14,0X81,
+0XFD,0XF4,0X85,0XFE,0X14,0X85,0XFD,0XF4,0X05,0XFD,0XF5,0XF5,0XF5,0X72,0X48,0XD5,
+0X12,0XFD,0XF5,0XFE,0X14,0X83,0XFD,0XF5,0X83,0XFE,0X15,0X02,0XFD,0XF5,0XFD,0XD4,
+0XFD,0XB3,0X8D,0XFD,0X93,0X00,0XFD,0X72,0X83,0XFD,0X93,0X81,0XFD,0X73,0X8B,0XFD,
+0X72,0X82,0XFD,0X52,0X08,0X20,0X41,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,
+0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XB9,0X21,0X04,0X8F,0X18,0XE3,
+0X0A,0X21,0X04,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,
+0X45,0XDD,0XB3,0XFD,0XF3,0XFE,0X14,0X94,0XFD,0XF4,0X03,0XF5,0XF4,0X72,0X28,0X8A,
+0XEA,0XFD,0XF5,0X82,0XFD,0XF4,0X83,0XFD,0XF5,0X81,0XFE,0X15,0X00,0XFD,0XF4,0X82,
+0XFD,0X93,0X09,0XFD,0XB4,0XFD,0XD4,0XFD,0X93,0XFD,0X93,0XC4,0X0D,0XF5,0X73,0XFD,
+0X73,0XFD,0X93,0XD4,0X2D,0XF5,0X32,0X83,0XFD,0X73,0X8B,0XFD,0X72,0X85,0XFD,0X52,
+0X82,0XFD,0X32,0X08,0X20,0X40,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,
+0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XB8,0X21,0X04,0X90,0X18,0XE3,0X0C,
+0X21,0X04,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XE7,0X31,0X86,0X29,0X45,
+0XDD,0XB3,0XFD,0XF3,0XFD,0XF3,0XFD,0XF4,0XFD,0XF4,0X83,0XFD,0XF3,0X87,0XFD,0XF4,
+0X81,0XFD,0XD3,0X83,0XFD,0XF4,0X07,0XFD,0XD4,0XF5,0XD4,0X72,0X28,0X8A,0XCA,0XFD,
+0XD5,0XFD,0XF4,0XFD,0XD4,0XFD,0XD4,0X83,0XFD,0XF4,0X81,0XFD,0XF5,0X04,0XFD,0XB3,
+0XFD,0X92,0XFD,0X93,0XED,0X11,0XBB,0X8B,0X82,0XFD,0X93,0X00,0XF5,0X52,0X83,0XFD,
+0X72,0X00,0XF5,0X31,0X85,0XFD,0X72,0X8B,0XFD,0X52,0X81,0XFD,0X32,0X83,0XFD,0X12,
+0X09,0XFD,0X32,0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,
+0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XB7,0X21,0X04,0X92,0X18,0XE3,0X08,0X21,
+0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,0X86,0X29,0X45,0XD5,0X93,0XFD,
+0XD3,0X84,0XFD,0XF3,0X83,0XFD,0XD3,0X83,0XFD,0XD4,0X81,0XFD,0XD3,0X81,0XFD,0XB3,
+0X81,0XFD,0XD4,0X81,0XFD,0XB3,0X04,0XFD,0XD4,0XF5,0XB4,0X6A,0X28,0X82,0XA9,0XFD,
+0XD4,0X82,0XFD,0XD3,0X83,0XFD,0XD4,0X06,0XFD,0XF4,0XFD,0XD4,0XFD,0X92,0XFD,0X92,
+0XFD,0X72,0XFD,0X72,0XFD,0X93,0X8A,0XFD,0X72,0X89,0XFD,0X52,0X8A,0XFD,0X32,0X81,
+0XFD,0X11,0X08,0X20,0X40,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,
+0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XB5,0X21,0X04,0X94,0X18,0XE3,0X07,0X21,
+0X24,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,0X86,0X29,0X45,0XD5,0X93,0X89,
+0XFD,0XD3,0X83,0XFD,0XB3,0X81,0XFD,0XD3,0X81,0XFD,0XB3,0X81,0XFD,0XD3,0X82,0XFD,
+0XB3,0X06,0XE5,0X11,0X6A,0X48,0X7A,0X89,0XFD,0XD4,0XFD,0XD3,0XFD,0XB3,0XFD,0XB3,
+0X84,0XFD,0XD4,0X00,0XFD,0X93,0X83,0XFD,0X72,0X83,0XFD,0X52,0X82,0XFD,0X72,0X8A,
+0XFD,0X52,0X81,0XFD,0X32,0X85,0XFD,0X31,0X81,0XFD,0X32,0X81,0XFD,0X11,0X81,0XFD,
+0X32,0X81,0XFD,0X11,0X09,0XF4,0XF1,0X20,0X40,0X08,0X41,0X08,0X41,0X21,0X04,0X31,
+0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XB5,0X21,0X04,0X93,
+0X18,0XE3,0X09,0X20,0XE4,0X29,0X45,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,
+0X86,0X29,0X45,0XD5,0X93,0XFD,0XD2,0X82,0XFD,0XD3,0X91,0XFD,0XB3,0X04,0XFD,0X92,
+0XAB,0XAC,0X72,0X49,0X7A,0X89,0XFD,0XD4,0X86,0XFD,0XB3,0X00,0XFD,0X93,0X84,0XFD,
+0X72,0X8B,0XFD,0X52,0X01,0XFD,0X32,0XFD,0X52,0X83,0XFD,0X32,0X81,0XFD,0X31,0X81,
+0XFD,0X32,0X81,0XFD,0X31,0X8A,0XFD,0X11,0X08,0X20,0X40,0X08,0X41,0X08,0X41,0X21,
+0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X29,0X45,0X21,0X24,0XC8,0X21,0X04,0XB4,0X21,
+0X04,0X94,0X18,0XE3,0X0C,0X20,0XE4,0X21,0X24,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,
+0XC7,0X31,0X86,0X29,0X45,0XD5,0X93,0XFD,0XB2,0XFD,0XB3,0XFD,0XB2,0XFD,0XB2,0X8F,
+0XFD,0XB3,0X81,0XFD,0X93,0X05,0XFD,0X92,0XA3,0XAC,0X6A,0X49,0X7A,0X69,0XFD,0XB4,
+0XFD,0X93,0X85,0XFD,0XB3,0X00,0XFD,0X73,0X8C,0XFD,0X52,0X81,0XFD,0X31,0X02,0XFD,
+0X32,0XEC,0XF0,0XFD,0X32,0X86,0XFD,0X11,0X03,0XEC,0XB0,0XCB,0XAC,0XFD,0X11,0XFD,
+0X31,0X83,0XFD,0X11,0X85,0XFC,0XF1,0X09,0XF4,0XF1,0X20,0X20,0X08,0X41,0X08,0X41,
+0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X29,0X45,0X21,0X24,0XC8,0X21,0X04,0XB3,
+0X21,0X04,0X95,0X18,0XE3,0X08,0X21,0X04,0X21,0X24,0X31,0X86,0X31,0X86,0X39,0XE7,
+0X39,0XC7,0X31,0X86,0X21,0X65,0XDD,0X53,0X8D,0XFD,0XB2,0X82,0XFD,0X93,0X00,0XFD,
+0XD4,0X83,0XFD,0X93,0X06,0XFD,0X92,0XA3,0XAD,0X6A,0X49,0X7A,0X69,0XFD,0X94,0XFD,
+0X93,0XFD,0X93,0X83,0XFD,0XB3,0X02,0XFD,0X92,0XFD,0X52,0XFD,0X52,0X85,0XFD,0X51,
+0X87,0XFD,0X31,0X07,0XFD,0X11,0XC3,0X8A,0XF5,0X11,0XFD,0X11,0XFD,0X12,0XFD,0X32,
+0XE4,0X8F,0XFD,0X32,0X82,0XFD,0X11,0X06,0XFD,0X52,0XFD,0X31,0XFD,0X51,0XCB,0XAB,
+0XF4,0XF0,0XFD,0X11,0XFD,0X11,0X83,0XFC,0XF1,0X82,0XFC,0XD1,0X08,0X20,0X20,0X08,
+0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X29,0X45,0XC8,
+0X21,0X04,0XB2,0X21,0X04,0X96,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,0X06,0X39,
+0XE7,0X39,0XC7,0X31,0X86,0X21,0X65,0XDD,0X53,0XFD,0X91,0XFD,0XB2,0X8B,0XFD,0X92,
+0X81,0XFD,0X93,0X01,0XD4,0X4E,0XFD,0X72,0X83,0XFD,0X93,0X0A,0XFD,0X72,0XA3,0X8C,
+0X6A,0X49,0X7A,0X69,0XFD,0X93,0XFD,0X73,0XFD,0X93,0XFD,0X93,0XFD,0XB3,0XFD,0X93,
+0XFD,0X93,0X82,0XFD,0X51,0X8B,0XFD,0X31,0X81,0XFD,0X11,0X00,0XFD,0X32,0X83,0XFC,
+0XF1,0X03,0XFD,0X12,0XFD,0X11,0XFC,0XF1,0XFD,0X11,0X82,0XFC,0XF1,0X15,0XFD,0X11,
+0XF4,0XF1,0XF4,0XD0,0XFC,0XF1,0XF4,0XD0,0XF4,0XB0,0XFC,0XD1,0XFC,0XD1,0XFC,0XF1,
+0XFC,0XF1,0XFC,0XD1,0XFC,0XD1,0XF4,0XD1,0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X04,
+0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X29,0X45,0XC8,0X21,0X04,0XB1,0X21,0X04,
+0X97,0X18,0XE3,0X09,0X21,0X04,0X21,0X24,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,0XC7,
+0X31,0X86,0X29,0X46,0XDD,0X31,0XFD,0X91,0X88,0XFD,0X92,0X83,0XFD,0X72,0X81,0XFD,
+0X92,0X0C,0XFD,0XB3,0XFD,0X52,0XFD,0X92,0XFD,0X92,0XFD,0X73,0XFD,0X73,0XFD,0X72,
+0X9B,0X2B,0X6A,0X49,0X7A,0X49,0XFD,0X73,0XFD,0X73,0XFD,0X72,0X82,0XFD,0X93,0X00,
+0XFD,0X72,0X86,0XFD,0X31,0X8D,0XFD,0X11,0X81,0XFC,0XF1,0X81,0XFC,0XD1,0X81,0XFC,
+0XD0,0X85,0XFC,0XD1,0X01,0XEC,0XB0,0XFC,0XF1,0X85,0XFC,0XD0,0X09,0XFC,0XF1,0X20,
+0X20,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X29,0X45,0X21,
+0X24,0XC8,0X21,0X04,0XB1,0X21,0X04,0X97,0X18,0XE3,0X0A,0X21,0X04,0X21,0X24,0X29,
+0X65,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,0X86,0X29,0X46,0XDD,0X31,0XFD,0X71,0XFD,
+0X92,0X85,0XFD,0X71,0X87,0XFD,0X72,0X01,0XFD,0X93,0XF5,0X51,0X83,0XFD,0X72,0X05,
+0XFD,0X51,0X8A,0XA9,0X6A,0X29,0X7A,0X49,0XFD,0X73,0XFD,0X73,0X83,0XFD,0X72,0X81,
+0XFD,0X31,0X8B,0XFD,0X11,0X83,0XFC,0XF1,0X84,0XFC,0XF0,0X8A,0XFC,0XD0,0X00,0XFC,
+0XB0,0X86,0XFC,0XD0,0X09,0XFC,0XF1,0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X04,0X31,
+0XA6,0X39,0XC7,0X31,0X86,0X29,0X45,0X21,0X24,0XC8,0X21,0X04,0XAF,0X21,0X04,0X99,
+0X18,0XE3,0X81,0X21,0X04,0X07,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,0X86,
+0X29,0X46,0XDD,0X11,0XFD,0X71,0X82,0XFD,0X72,0X83,0XFD,0X71,0X8B,0XFD,0X72,0X82,
+0XFD,0X52,0X04,0X8A,0XAA,0X6A,0X09,0X7A,0X49,0XF5,0X33,0XFD,0X32,0X82,0XFD,0X52,
+0X00,0XFD,0X31,0X83,0XFD,0X10,0X87,0XFC,0XF1,0X81,0XFC,0XF0,0X8B,0XFC,0XD0,0X81,
+0XFC,0XB0,0X81,0XFC,0XD0,0X8B,0XFC,0XB0,0X09,0XFC,0XD1,0X20,0X20,0X08,0X41,0X08,
+0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,
+0XAD,0X21,0X04,0X9B,0X18,0XE3,0X81,0X21,0X04,0X07,0X29,0X65,0X31,0X86,0X39,0XE7,
+0X39,0XC7,0X31,0X86,0X29,0X46,0XDD,0X11,0XFD,0X51,0X82,0XFD,0X71,0X83,0XFD,0X51,
+0X89,0XFD,0X52,0X81,0XFD,0X51,0X81,0XFD,0X52,0X05,0XFD,0X32,0X8A,0X8A,0X6A,0X2A,
+0X72,0X08,0XCC,0X4F,0XF4,0XF1,0X82,0XFD,0X32,0X00,0XFD,0X10,0X89,0XFC,0XF0,0X8B,
+0XFC,0XD0,0X87,0XFC,0XB0,0X81,0XFC,0X90,0X81,0XFC,0X8F,0X81,0XFC,0X90,0X83,0XF4,
+0X8F,0X81,0XF4,0X90,0X09,0XF4,0XB0,0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X04,0X31,
+0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XAB,0X21,0X04,0X9C,
+0X18,0XE3,0X0A,0X21,0X04,0X21,0X24,0X21,0X04,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,
+0XC7,0X31,0X86,0X29,0X25,0XDD,0X12,0XFD,0X30,0X86,0XFD,0X51,0X83,0XFD,0X31,0X81,
+0XFD,0X52,0X81,0XFD,0X51,0X83,0XFD,0X31,0X81,0XFD,0X32,0X09,0XF5,0X11,0X82,0XAA,
+0X6A,0X29,0X6A,0X29,0XD4,0X50,0XFD,0X32,0XFD,0X31,0XFD,0X31,0XFD,0X11,0XFC,0XF1,
+0X8F,0XFC,0XD0,0X85,0XFC,0XB0,0X85,0XFC,0X90,0X85,0XFC,0X8F,0X85,0XFC,0X90,0X81,
+0XF4,0X90,0X09,0XF4,0XB0,0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,
+0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XAA,0X21,0X04,0X9D,0X18,0XE3,
+0X0D,0X21,0X04,0X21,0X24,0X21,0X04,0X31,0X86,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,
+0X86,0X29,0X25,0XDD,0X12,0XFD,0X30,0XFD,0X51,0XFD,0X51,0XFD,0X30,0X91,0XFD,0X31,
+0X07,0X92,0X89,0X62,0X07,0X62,0X09,0X6A,0X08,0XCC,0X2F,0XFD,0X32,0XFD,0X11,0XFC,
+0XF1,0X89,0XFC,0XD0,0X83,0XFC,0XB0,0X81,0XFC,0XAF,0X83,0XFC,0XB0,0X81,0XFC,0X90,
+0X87,0XFC,0X8F,0X83,0XF4,0X8F,0X81,0XFC,0X6F,0X87,0XF4,0X6F,0X09,0XF4,0XB0,0X20,
+0X20,0X08,0X41,0X08,0X41,0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,
+0X24,0XC8,0X21,0X04,0XA9,0X21,0X04,0X9F,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,
+0X08,0X39,0XE7,0X39,0XC7,0X31,0X86,0X21,0X25,0XDC,0XF1,0XFD,0X30,0XFD,0X31,0XFD,
+0X30,0XFD,0X10,0X83,0XFD,0X30,0X8D,0XFD,0X11,0X09,0X92,0X89,0X62,0X08,0X62,0X09,
+0X62,0X08,0XCC,0X2F,0XFD,0X11,0XFD,0X11,0XFC,0XD0,0XFC,0XAF,0XFC,0XAF,0X83,0XFC,
+0XB0,0X85,0XFC,0XAF,0X91,0XFC,0X8F,0X81,0XFC,0X6F,0X85,0XF4,0X6F,0X81,0XF4,0X4F,
+0X81,0XF4,0X6F,0X0B,0XF4,0X4F,0XEC,0X6F,0XF4,0X90,0X20,0X40,0X08,0X41,0X08,0X41,
+0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XA8,
+0X21,0X04,0XA0,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,0X04,0X39,0XE7,0X39,0XC7,
+0X31,0X86,0X21,0X25,0XDC,0XF1,0X8D,0XFD,0X10,0X83,0XFD,0X11,0X81,0XFC,0XF1,0X81,
+0XFC,0XD1,0X07,0X92,0X89,0X61,0XE8,0X62,0X09,0X62,0X08,0XCC,0X0F,0XFC,0XD1,0XFC,
+0XD0,0XFC,0XB0,0X83,0XFC,0X8F,0X81,0XFC,0XAF,0X89,0XFC,0X8F,0X89,0XFC,0X6F,0X83,
+0XF4,0X6F,0X8C,0XF4,0X4F,0X0A,0XEC,0X4F,0XEC,0X6F,0X20,0X40,0X08,0X41,0X08,0X41,
+0X21,0X04,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XA7,
+0X21,0X04,0XA1,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,0X06,0X39,0XE7,0X39,0XC7,
+0X31,0X86,0X21,0X25,0XDC,0XB1,0XFC,0XEF,0XFD,0X10,0X8B,0XFC,0XF0,0X83,0XFC,0XF1,
+0X81,0XFC,0XF0,0X81,0XFC,0XD0,0X07,0X92,0X89,0X62,0X08,0X62,0X09,0X62,0X08,0XCC,
+0X0F,0XFC,0XF1,0XFC,0X8F,0XFC,0X6F,0X89,0XFC,0X8F,0X8B,0XFC,0X6F,0X83,0XF4,0X6F,
+0X85,0XF4,0X4E,0X87,0XF4,0X4F,0X83,0XEC,0X2E,0X09,0XEC,0X4F,0X20,0X20,0X08,0X41,
+0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,0X29,0X65,0X29,0X45,0X21,0X24,0XC8,0X21,
+0X04,0XA7,0X21,0X04,0XA1,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,0X0A,0X39,0XE7,
+0X39,0XC7,0X31,0X86,0X21,0X25,0XDC,0XB1,0XFC,0XEF,0XFC,0XF0,0XFC,0XEF,0XFC,0XEF,
+0XFC,0XF0,0XFC,0XF0,0X87,0XFC,0XD0,0X83,0XFC,0XF0,0X83,0XFC,0XD0,0X06,0X92,0X89,
+0X62,0X08,0X62,0X09,0X62,0X08,0XCC,0X0F,0XFC,0XB0,0XFC,0X4E,0X90,0XFC,0X6F,0X83,
+0XFC,0X4F,0X83,0XF4,0X4F,0X85,0XF4,0X4E,0X81,0XF4,0X2E,0X8A,0XEC,0X2E,0X0A,0XEC,
+0X0E,0XEC,0X2E,0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,0X29,
+0X65,0X29,0X45,0X21,0X24,0XC8,0X21,0X04,0XA7,0X21,0X04,0XA0,0X18,0XE3,0X82,0X21,
+0X04,0X06,0X29,0X65,0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,0X86,0X21,0X25,0XDC,0X90,
+0X87,0XFC,0XCF,0X86,0XFC,0XD0,0X14,0XFC,0XF1,0XFC,0XD0,0XFC,0XD0,0XFC,0XB0,0XFC,
+0XD0,0XFC,0XD0,0XFC,0XB0,0X92,0X8A,0X61,0XE8,0X61,0XE8,0X62,0X08,0XCB,0XEE,0XFC,
+0X6F,0XFC,0X4E,0XFC,0X6F,0XFC,0X6E,0XFC,0X6E,0XFC,0X6F,0XFC,0X6F,0XE3,0XCC,0XFC,
+0X8F,0X83,0XFC,0X6E,0X83,0XF4,0X6E,0X81,0XF4,0X4E,0X81,0XF4,0X4F,0X81,0XF4,0X4E,
+0X81,0XF4,0X4F,0X87,0XF4,0X2E,0X81,0XEC,0X2E,0X8B,0XEC,0X0E,0X09,0XE4,0X2E,0X20,
+0X20,0X08,0X41,0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X29,
+0X45,0XC8,0X21,0X04,0XA7,0X21,0X04,0XA0,0X18,0XE3,0X82,0X21,0X04,0X06,0X29,0X65,
+0X31,0X86,0X39,0XE7,0X39,0XC7,0X31,0X86,0X21,0X25,0XDC,0X90,0X83,0XFC,0XCF,0X89,
+0XFC,0XAF,0X0F,0XDB,0XEC,0XFC,0XD0,0XE4,0X2D,0XFC,0XB0,0XF4,0X8F,0XD3,0XAB,0XF4,
+0X6F,0XFC,0XB0,0X8A,0X48,0X62,0X08,0X62,0X08,0X61,0XE7,0XC3,0XCE,0XF4,0X4E,0XE3,
+0XCC,0XF4,0X4E,0X83,0XFC,0X4E,0X00,0XFC,0X6F,0X84,0XF4,0X4E,0X81,0XF4,0X6E,0X83,
+0XF4,0X4E,0X83,0XF4,0X2E,0X81,0XF4,0X0E,0X81,0XEC,0X0E,0X85,0XEC,0X2E,0X81,0XEC,
+0X0D,0X87,0XEC,0X0E,0X81,0XE4,0X0D,0X0B,0XEC,0X0E,0XE3,0XED,0XE4,0X0D,0X20,0X20,
+0X08,0X41,0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X29,0X45,
+0XC8,0X21,0X04,0XA5,0X21,0X04,0XA2,0X18,0XE3,0X82,0X21,0X04,0X81,0X29,0X65,0X81,
+0X39,0XC7,0X0C,0X31,0X86,0X21,0X25,0XDC,0X6F,0XFC,0X8E,0XFC,0XAF,0XFC,0X8F,0XFC,
+0X8F,0XFC,0XAE,0XFC,0XAE,0XFC,0X8F,0XFC,0X8F,0XDB,0XAB,0XFC,0XAF,0X83,0XFC,0X8F,
+0X0F,0XDB,0XAB,0XE3,0XCC,0XFC,0X8F,0XFC,0X6F,0XF4,0X6F,0XFC,0X8F,0XFC,0X6F,0XF4,
+0X6F,0X92,0X69,0X62,0X08,0X5A,0X08,0X61,0XE8,0XC3,0X8D,0XF4,0X0D,0XFC,0X0D,0XFC,
+0X2E,0X85,0XFC,0X4E,0X81,0XFC,0X2E,0X81,0XF4,0X2E,0X81,0XF4,0X0E,0X83,0XF4,0X2E,
+0X81,0XEC,0X2E,0X81,0XF4,0X0E,0X81,0XEC,0X2D,0X81,0XEC,0X0D,0X85,0XEC,0X0E,0X81,
+0XEB,0XED,0X81,0XE3,0XED,0X83,0XE3,0XEE,0X85,0XE3,0XED,0X09,0XE4,0X0E,0X20,0X20,
+0X08,0X41,0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,
+0XC8,0X21,0X04,0XA4,0X21,0X04,0XA3,0X18,0XE3,0X82,0X21,0X04,0X81,0X29,0X65,0X81,
+0X39,0XC7,0X0B,0X31,0X86,0X21,0X25,0XD4,0X4E,0XFC,0X6E,0XFC,0X8E,0XFC,0X6E,0XFC,
+0X6E,0XFC,0X8E,0XFC,0X8E,0XFC,0X6E,0XFC,0X6E,0XFC,0X4E,0X84,0XFC,0X6F,0X03,0XFC,
+0X6E,0XFC,0X8F,0XFC,0X4E,0XFC,0X6E,0X82,0XFC,0X6F,0X05,0XF4,0X6F,0X8A,0X69,0X5A,
+0X08,0X5A,0X08,0X59,0XC7,0XBB,0X4C,0X82,0XF4,0X0D,0X85,0XF4,0X2E,0X85,0XF4,0X0E,
+0X09,0XEC,0X0D,0XEB,0XED,0XEC,0X0D,0XEB,0XED,0XEC,0X0D,0XEC,0X0D,0XEB,0XED,0XEB,
+0XED,0XEC,0X0D,0XEC,0X0D,0X83,0XEB,0XED,0X81,0XE3,0XCD,0X81,0XE3,0XED,0X89,0XE3,
+0XCD,0X81,0XDB,0XED,0X81,0XDB,0XCD,0X09,0XDB,0XED,0X18,0X20,0X08,0X41,0X08,0X41,
+0X21,0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X21,0X24,0XC8,0X21,0X04,0XA3,
+0X21,0X04,0XA4,0X18,0XE3,0X82,0X21,0X04,0X81,0X29,0X65,0X81,0X39,0XC7,0X04,0X31,
+0X86,0X29,0X25,0XDC,0X2F,0XFC,0X6E,0XFC,0X8E,0X8B,0XFC,0X6E,0X85,0XFC,0X4E,0X09,
+0XF4,0X4F,0XF4,0X6F,0X8A,0X69,0X59,0XE8,0X62,0X08,0X59,0X86,0XB3,0X2B,0XF3,0XED,
+0XF4,0X0D,0XF4,0X0D,0X83,0XF4,0X0E,0X81,0XEC,0X0D,0X81,0XF3,0XED,0X04,0XF4,0X0E,
+0XEB,0XED,0XEC,0X0D,0XEC,0X0D,0XEC,0X0E,0X86,0XEB,0XED,0X81,0XE3,0XED,0X8B,0XE3,
+0XCD,0X83,0XDB,0XAD,0X81,0XDB,0XCD,0X81,0XDB,0XCC,0X81,0XD3,0XAC,0X09,0XDB,0XCD,
+0X20,0X20,0X08,0X41,0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,
+0X29,0X45,0XC8,0X21,0X04,0XA2,0X21,0X04,0XA5,0X18,0XE3,0X82,0X21,0X04,0X81,0X29,
+0X65,0X81,0X39,0XC7,0X06,0X31,0X86,0X29,0X25,0XDC,0X2F,0XFC,0X4D,0XFC,0X4E,0XFC,
+0X4D,0XFC,0X4D,0X89,0XFC,0X4E,0X83,0XFC,0X2E,0X82,0XF4,0X2E,0X06,0XEC,0X4E,0X8A,
+0X49,0X59,0XE8,0X59,0XC8,0X51,0X65,0X8A,0X28,0XF4,0X0D,0X8A,0XEB,0XED,0X82,0XEB,
+0XCD,0X87,0XE3,0XCD,0X81,0XE3,0XCC,0X83,0XE3,0XCD,0X81,0XE3,0XAD,0X81,0XDB,0XAD,
+0X89,0XDB,0XAC,0X81,0XDB,0XAD,0X82,0XD3,0XAD,0X08,0X20,0X20,0X08,0X41,0X08,0X41,
+0X21,0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X24,0X29,0X45,0XC8,0X21,0X04,0XA0,
+0X21,0X04,0XA7,0X18,0XE3,0X82,0X21,0X04,0X08,0X31,0X86,0X29,0X65,0X39,0XC7,0X39,
+0XC7,0X31,0X86,0X21,0X05,0XD4,0X0E,0XFC,0X4D,0XFC,0X4D,0X85,0XFC,0X2D,0X89,0XFC,
+0X2E,0X81,0XF4,0X2E,0X0B,0XEB,0XED,0XEC,0X0D,0X8A,0X28,0X59,0XE8,0X51,0X66,0X51,
+0X66,0X61,0X65,0XEB,0XED,0XEB,0XCC,0XEB,0XCC,0XEB,0XED,0XEB,0XED,0X86,0XEB,0XCD,
+0X00,0XE3,0XCC,0X83,0XE3,0XCD,0X83,0XE3,0XAC,0X81,0XE3,0XAD,0X85,0XDB,0XAC,0X00,
+0XDB,0XAD,0X82,0XDB,0XAC,0X83,0XD3,0X8C,0X81,0XD3,0X8D,0X81,0XD3,0X8C,0X85,0XD3,
+0X8D,0X09,0XCB,0X6C,0X20,0X40,0X00,0X20,0X08,0X41,0X21,0X24,0X31,0XA6,0X39,0XC7,
+0X31,0X86,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0XA0,0X21,0X04,0XA7,0X18,0XE3,0X82,
+0X21,0X04,0X06,0X31,0X86,0X29,0X65,0X39,0XC7,0X39,0XC7,0X31,0X86,0X21,0X05,0XD4,
+0X0E,0X8B,0XFC,0X0D,0X87,0XF4,0X0D,0X12,0XF4,0X0E,0XEC,0X2E,0X82,0X28,0X59,0XC7,
+0X49,0X46,0X49,0X46,0X61,0X64,0XE3,0XCD,0XEB,0XCC,0XEB,0XCC,0XEB,0XCD,0XEB,0XCD,
+0XEB,0XAC,0XEB,0XAC,0XEB,0XCD,0XEB,0XCD,0XE3,0XCD,0XE3,0XCD,0XE3,0XCC,0X82,0XE3,
+0XAC,0X85,0XDB,0XAC,0X88,0XDB,0X8C,0X04,0XD3,0X6C,0XD3,0X8C,0XD3,0X8C,0XCB,0X6B,
+0XAA,0XC8,0X83,0XCB,0X8C,0X88,0XCB,0X6C,0X08,0X20,0X20,0X00,0X20,0X08,0X41,0X21,
+0X24,0X31,0XA6,0X39,0XC7,0X31,0X86,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0X9F,0X21,
+0X04,0XA8,0X18,0XE3,0X82,0X21,0X04,0X06,0X31,0X86,0X29,0X65,0X39,0XC7,0X39,0XC7,
+0X29,0X65,0X21,0X25,0XD3,0XEE,0X83,0XFC,0X0D,0X89,0XF4,0X0D,0X83,0XF3,0XED,0X83,
+0XEC,0X0D,0X09,0X8A,0X28,0X51,0XA7,0X51,0X46,0X49,0X46,0X61,0X45,0XE3,0XCD,0XE3,
+0XAC,0XE3,0XAC,0XE3,0XCD,0XE3,0XCD,0X85,0XE3,0XAC,0X02,0XDB,0XAC,0XDB,0X8C,0XDB,
+0XAC,0X82,0XDB,0X8C,0X8B,0XD3,0X8C,0X81,0XD3,0X6C,0X81,0XCB,0X6C,0X04,0XCB,0X6B,
+0XAA,0XA9,0XCB,0X6C,0XCB,0X6C,0XCB,0X8C,0X84,0XCB,0X6C,0X81,0XC3,0X6C,0X81,0XCB,
+0X4C,0X09,0XCB,0X8C,0X20,0X20,0X00,0X20,0X08,0X41,0X21,0X24,0X31,0XA6,0X31,0XA6,
+0X29,0X65,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0X9F,0X21,0X04,0XA8,0X18,0XE3,0X82,
+0X21,0X04,0X08,0X31,0X86,0X29,0X65,0X39,0XC7,0X39,0XC7,0X29,0X65,0X21,0X25,0XD3,
+0XEE,0XFB,0XEC,0XF3,0XED,0X85,0XF3,0XEC,0X85,0XF3,0XED,0X85,0XEB,0XED,0X06,0XE3,
+0XED,0XCB,0XCD,0X7A,0X28,0X49,0X66,0X51,0X46,0X49,0X46,0X61,0X45,0X84,0XE3,0XAC,
+0X83,0XDB,0XAC,0X07,0XD3,0X8C,0X91,0XE5,0XD3,0XAC,0XDB,0X6C,0XDB,0X8C,0XDB,0X8C,
+0XD3,0X6C,0XD3,0X6C,0X83,0XD3,0X6B,0X81,0XD3,0X6C,0X85,0XCB,0X6C,0X1B,0XD3,0X6C,
+0XCB,0X6C,0XCB,0X6D,0XCB,0X6D,0XCB,0X6C,0XA2,0X89,0XC3,0X6C,0XC3,0X4C,0XC3,0X6C,
+0XC3,0X4C,0XC3,0X4B,0XC3,0X4B,0XC3,0X4C,0XC3,0X4C,0XBB,0X6B,0XBB,0X6B,0XC3,0X4C,
+0XC3,0X4C,0XC3,0X6C,0X20,0X20,0X00,0X20,0X08,0X41,0X21,0X24,0X31,0XA6,0X31,0XA6,
+0X29,0X65,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0X9D,0X21,0X04,0XAA,0X18,0XE3,0X82,
+0X21,0X04,0X06,0X31,0X86,0X29,0X65,0X39,0XC7,0X39,0XC7,0X29,0X65,0X21,0X05,0XD3,
+0XCD,0X82,0XF3,0XCC,0X00,0XF3,0XAC,0X83,0XF3,0XCC,0X81,0XEB,0XCC,0X88,0XEB,0XCD,
+0X09,0XE3,0XCD,0XE3,0XCC,0X92,0X88,0X51,0X86,0X49,0X66,0X51,0X66,0X49,0X45,0X61,
+0X45,0XE3,0XAC,0XE3,0X8C,0X82,0XDB,0XAC,0X81,0XDB,0X8C,0X81,0XD3,0X8C,0X05,0XD3,
+0X6C,0XD3,0X8C,0XD3,0X6B,0XD3,0X6C,0XD3,0X8C,0XD3,0X8B,0X87,0XCB,0X6C,0X85,0XCB,
+0X4C,0X81,0XC3,0X4C,0X06,0XCB,0X4C,0XC3,0X4C,0XC3,0X4B,0X9A,0X68,0XBB,0X4C,0XBB,
+0X2B,0XC3,0X4C,0X82,0XC3,0X4B,0X81,0XC3,0X4C,0X82,0XC3,0X4B,0X0A,0XBB,0X4B,0XBB,
+0X2C,0X20,0X40,0X00,0X20,0X08,0X41,0X29,0X45,0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,
+0X04,0X29,0X45,0XC8,0X21,0X04,0X9D,0X21,0X04,0XAA,0X18,0XE3,0X82,0X21,0X04,0X0A,
+0X31,0X86,0X29,0X65,0X39,0XC7,0X39,0XC7,0X29,0X65,0X21,0X05,0XD3,0XAD,0XF3,0XCC,
+0XEB,0XCC,0XF3,0XAC,0XF3,0XAC,0X8B,0XEB,0XAC,0X82,0XE3,0XCD,0X09,0XDB,0XAC,0XDB,
+0XCC,0X8A,0X89,0X51,0X45,0X49,0X66,0X51,0X66,0X49,0X45,0X61,0X45,0XDB,0X8C,0XDB,
+0X6C,0X82,0XDB,0X8C,0X81,0XD3,0X8B,0X81,0XD3,0X8C,0X81,0XD3,0X6B,0X81,0XD3,0X6C,
+0X03,0XCB,0X6C,0XCB,0X4B,0XCB,0X6C,0XCB,0X6C,0X85,0XCB,0X4B,0X81,0XCB,0X2B,0X81,
+0XC3,0X4C,0X81,0XC3,0X4B,0X83,0XC3,0X4C,0X07,0X92,0X69,0X61,0XA6,0X71,0XC7,0XBB,
+0X6C,0XC3,0X4B,0XC3,0X4B,0XBB,0X2B,0XBB,0X2B,0X85,0XBB,0X2C,0X09,0XB3,0X0B,0X20,
+0X40,0X00,0X20,0X08,0X41,0X29,0X45,0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,0X04,0X29,
+0X45,0XC8,0X21,0X04,0X9C,0X21,0X04,0XAC,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,
+0X05,0X39,0XE7,0X39,0XC7,0X31,0X86,0X21,0X05,0XCB,0XAD,0XEB,0XAB,0X86,0XEB,0XAC,
+0X81,0XE3,0X8C,0X87,0XE3,0XAC,0X0C,0XE3,0XAD,0XDB,0X8C,0XE3,0XCD,0X82,0X48,0X51,
+0X45,0X51,0X45,0X49,0X45,0X49,0X45,0X61,0X65,0XDB,0XAC,0XDB,0X6B,0XD3,0X8B,0XD3,
+0X8B,0X82,0XD3,0X6B,0X05,0XD3,0X8C,0XCB,0X6B,0XCB,0X6C,0XCB,0X4B,0XCB,0X4C,0XCB,
+0X4C,0X85,0XCB,0X4B,0X81,0XCB,0X2B,0X85,0XC3,0X4C,0X81,0XC3,0X2B,0X82,0XC3,0X4C,
+0X04,0XBB,0X4B,0X69,0XA6,0X41,0X25,0X49,0X46,0XB3,0X6C,0X88,0XBB,0X2B,0X0A,0XBB,
+0X0C,0XB3,0X0B,0X20,0X41,0X08,0X20,0X08,0X21,0X29,0X45,0X31,0XA6,0X31,0XA6,0X29,
+0X65,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0X9C,0X21,0X04,0XAC,0X18,0XE3,0X81,0X21,
+0X04,0X81,0X31,0X86,0X04,0X39,0XE7,0X39,0XC7,0X31,0X86,0X21,0X05,0XCB,0XAD,0X83,
+0XEB,0X8C,0X85,0XE3,0X8C,0X84,0XDB,0XAC,0X0C,0XD3,0X6B,0XDB,0XAC,0XCB,0X4A,0XDB,
+0XAC,0XDB,0XAC,0XE3,0XCC,0X82,0X28,0X51,0X45,0X51,0X45,0X49,0X45,0X49,0X45,0X61,
+0X65,0XDB,0X8C,0X82,0XD3,0X6C,0X04,0XD3,0X4C,0XCB,0X6C,0XCB,0X6C,0XCB,0X4C,0XCB,
+0X4C,0X83,0XCB,0X4B,0X81,0XCB,0X2B,0X83,0XCB,0X2C,0X81,0XC3,0X2C,0X83,0XC3,0X2B,
+0X86,0XBB,0X2B,0X06,0XB3,0X2B,0X61,0X65,0X41,0X25,0X49,0X25,0XAB,0X2C,0XBB,0X2B,
+0XBB,0X2B,0X83,0XBB,0X0B,0X81,0XB3,0X0B,0X0B,0XB3,0X2B,0XB3,0X0B,0XB2,0XEB,0X20,
+0X41,0X08,0X20,0X08,0X21,0X29,0X45,0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,0X04,0X21,
+0X24,0XC8,0X21,0X04,0X9C,0X21,0X04,0XAC,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,
+0X81,0X39,0XC7,0X04,0X29,0X65,0X21,0X05,0XCB,0X8C,0XEB,0X8C,0XE3,0X8B,0X85,0XE3,
+0X8C,0X85,0XDB,0X8C,0X10,0XDB,0XAC,0XD3,0X8C,0XD3,0X8C,0XD3,0X6C,0XD3,0X8B,0XDB,
+0XCC,0XDB,0XAC,0X82,0X27,0X51,0X45,0X51,0X45,0X49,0X46,0X49,0X46,0X59,0X45,0XD3,
+0X6C,0XD3,0X6C,0XCB,0X6C,0XCB,0X6C,0X84,0XCB,0X4C,0X83,0XCB,0X2C,0X87,0XC3,0X2B,
+0X83,0XBB,0X2B,0X85,0XBB,0X2C,0X81,0XB3,0X2B,0X03,0X61,0X65,0X41,0X25,0X41,0X25,
+0XA3,0X0B,0X89,0XB3,0X0B,0X09,0XAB,0X0A,0X20,0X41,0X00,0X20,0X00,0X20,0X29,0X45,
+0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,0X04,0X29,0X45,0XC8,0X21,0X04,0X9C,0X21,0X04,
+0XAC,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,0X81,0X39,0XC7,0X0E,0X29,0X65,0X21,
+0X05,0XCB,0X8C,0XE3,0X8C,0XE3,0X8B,0XE3,0X8C,0XE3,0X8C,0XE3,0X6C,0XE3,0X6C,0XDB,
+0X6B,0XDB,0X6B,0XDB,0X8C,0XDB,0X8C,0XDB,0X6C,0XDB,0X6C,0X82,0XDB,0X8C,0X12,0XD3,
+0X8C,0XD3,0XAC,0XC3,0X4B,0XB2,0XAA,0XC3,0X6C,0XDB,0XAC,0X82,0X08,0X51,0X45,0X51,
+0X45,0X49,0X46,0X49,0X46,0X59,0X24,0XD3,0X4C,0XCB,0X6C,0XCB,0X6C,0XCB,0X4C,0XCB,
+0X4B,0XCB,0X2B,0XCB,0X2B,0X83,0XC3,0X2B,0X89,0XBB,0X2B,0X83,0XB3,0X0B,0X83,0XBB,
+0X0B,0X81,0XB3,0X2B,0X81,0XB3,0X0B,0X09,0X59,0X45,0X41,0X06,0X41,0X25,0XA3,0X0B,
+0XB3,0X0A,0XB3,0X0A,0XB3,0X0B,0XB3,0X0B,0XAA,0XEB,0XAA,0XEB,0X83,0XAA,0XEA,0X09,
+0XA2,0XEA,0X20,0X41,0X00,0X20,0X00,0X20,0X29,0X45,0X31,0XA6,0X31,0XA6,0X29,0X65,
+0X21,0X04,0X29,0X45,0XC8,0X21,0X04,0X9C,0X21,0X04,0XAC,0X18,0XE3,0X81,0X21,0X04,
+0X81,0X31,0X86,0X81,0X39,0XC7,0X05,0X29,0X65,0X21,0X25,0XC3,0X4B,0XE3,0X6C,0XDB,
+0X6C,0XDB,0X6C,0X84,0XDB,0X6B,0X81,0XD3,0X4B,0X81,0XD3,0X6B,0X81,0XD3,0X6C,0X0C,
+0XDB,0X6C,0XCB,0X8D,0XBB,0X4C,0X8A,0X8A,0X8A,0X28,0X8A,0X28,0XC3,0X6D,0X71,0XC7,
+0X49,0X25,0X49,0X45,0X49,0X25,0X49,0X45,0X51,0X04,0X83,0XCB,0X4C,0X00,0XCB,0X2C,
+0X82,0XC3,0X2B,0X82,0XBB,0X2B,0X89,0XBB,0X0B,0X81,0XB3,0X0A,0X01,0XB3,0X0B,0XB3,
+0X0A,0X86,0XB3,0X0B,0X08,0XAB,0X2C,0X61,0X86,0X41,0X46,0X49,0X05,0XA2,0XEB,0XAA,
+0XEB,0XAA,0XEB,0XAA,0XEA,0XAA,0XEA,0X83,0XAA,0XEB,0X81,0XAA,0XEA,0X09,0XA2,0XEA,
+0X18,0X41,0X00,0X20,0X08,0X41,0X29,0X45,0X31,0XA6,0X31,0XA6,0X31,0X86,0X21,0X04,
+0X21,0X24,0XC8,0X21,0X04,0X9C,0X21,0X04,0XAC,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,
+0X86,0X81,0X39,0XC7,0X06,0X29,0X65,0X21,0X25,0XC3,0X4B,0XDB,0X6C,0XDB,0X6B,0XDB,
+0X6B,0XD3,0X6B,0X87,0XD3,0X4B,0X82,0XD3,0X6C,0X0C,0XCB,0X8D,0X69,0X65,0X51,0X66,
+0X51,0X66,0X49,0X05,0X69,0X86,0X71,0XE8,0X49,0X25,0X49,0X45,0X49,0X25,0X49,0X25,
+0X59,0X25,0XBB,0X0B,0X82,0XC3,0X4B,0X00,0XC3,0X2B,0X82,0XBB,0X2B,0X88,0XBB,0X0B,
+0X81,0XB3,0X0B,0X89,0XB2,0XEB,0X07,0XAA,0XEA,0X7A,0X28,0X59,0X65,0X59,0X85,0X49,
+0X25,0X41,0X06,0X41,0X25,0X9A,0XEB,0X85,0XAA,0XEA,0X84,0XA2,0XCA,0X08,0X18,0X41,
+0X00,0X20,0X08,0X41,0X29,0X45,0X31,0XA6,0X31,0XA6,0X31,0X86,0X21,0X04,0X21,0X24,
+0XC8,0X21,0X04,0X9F,0X21,0X04,0XA9,0X18,0XE3,0X81,0X21,0X04,0X81,0X31,0X86,0X81,
+0X39,0XC7,0X04,0X31,0X86,0X21,0X24,0XBB,0X2C,0XDB,0X6C,0XDB,0X6C,0X83,0XD3,0X4C,
+0X01,0XD3,0X2C,0XCB,0X2C,0X86,0XCB,0X4C,0X07,0XB3,0XAD,0X59,0X67,0X51,0X86,0X49,
+0X46,0X49,0X05,0X51,0X05,0X71,0XE8,0X49,0X25,0X82,0X49,0X45,0X03,0X49,0X25,0XAA,
+0XEB,0XBB,0X2B,0XBB,0X2B,0X82,0XBB,0X0B,0X11,0XBB,0X2B,0XBB,0X0B,0XBA,0XEB,0XB2,
+0XEB,0XB2,0XEB,0XBA,0XEB,0XBA,0XEB,0XB2,0XEB,0XBB,0X0B,0XB3,0X0A,0XB3,0X0A,0XAA,
+0XEA,0XB2,0XCA,0XB2,0XEA,0XB2,0XEB,0XAA,0XEB,0XA2,0XAA,0XAB,0X0B,0X85,0XAA,0XEB,
+0X1A,0X59,0X66,0X38,0XC4,0X38,0XE4,0X38,0XE5,0X38,0XE5,0X39,0X05,0X92,0XEB,0XA2,
+0XEA,0X9A,0XC9,0XA2,0XCA,0XA2,0XA9,0XA2,0XEB,0XA2,0XAA,0XA2,0XCA,0X9A,0XCA,0X9A,
+0X89,0XA2,0XEB,0X9A,0XCA,0X20,0X41,0X08,0X41,0X08,0X61,0X21,0X24,0X31,0XA6,0X31,
+0XA6,0X29,0X65,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0X9F,0X21,0X04,0XA9,0X18,0XE3,
+0X81,0X21,0X04,0X81,0X31,0X86,0X81,0X39,0XC7,0X09,0X31,0X86,0X21,0X24,0XBB,0X2C,
+0XD3,0X4C,0XD3,0X4C,0XCB,0X4C,0XCB,0X4B,0XD3,0X4B,0XD3,0X4B,0XCB,0X2C,0X84,0XCB,
+0X2B,0X81,0XCB,0X4C,0X08,0XAA,0XCB,0X51,0X45,0X51,0X66,0X51,0X86,0X49,0X25,0X49,
+0X25,0X51,0X25,0X72,0X08,0X49,0X25,0X82,0X49,0X45,0X02,0X49,0X25,0XAB,0X0B,0XBB,
+0X2B,0X83,0XBB,0X0B,0X82,0XB2,0XEB,0X81,0XAA,0XEB,0X81,0XB2,0XEB,0X0A,0XAA,0XEA,
+0XAB,0X0C,0X92,0XAA,0X69,0XC6,0X69,0XA7,0X82,0X49,0XA2,0XCB,0XAA,0XCA,0XAA,0XEB,
+0X79,0XC8,0X92,0XCB,0X84,0XA2,0XCA,0X1B,0X9A,0XAA,0X48,0XE4,0X40,0XE5,0X39,0X05,
+0X38,0XE5,0X38,0XE5,0X39,0X05,0X8A,0X8A,0X9A,0XAA,0X9A,0X89,0X92,0XAA,0X61,0X45,
+0X72,0X28,0X92,0XAB,0X9A,0XCB,0XA2,0XEB,0X8A,0X69,0X9A,0XCB,0X9A,0XAA,0X18,0X41,
+0X08,0X41,0X08,0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,0X04,0X21,0X24,
+0XC8,0X21,0X04,0X9F,0X21,0X04,0XA9,0X18,0XE3,0X0E,0X21,0X04,0X18,0XE3,0X29,0X65,
+0X29,0X65,0X39,0XC7,0X39,0XC7,0X31,0X86,0X19,0X25,0XBB,0X0C,0XD3,0X4C,0XB2,0XA8,
+0XCB,0X6C,0XCB,0X4C,0XCB,0X4B,0XCB,0X4B,0X83,0XCB,0X2B,0X0D,0XCB,0X4C,0XBA,0XAA,
+0XC3,0X0B,0XCB,0X4C,0XA3,0X0B,0X51,0X66,0X51,0X46,0X51,0X46,0X49,0X05,0X49,0X05,
+0X51,0X25,0X72,0X28,0X49,0X25,0X49,0X25,0X82,0X41,0X25,0X01,0X8A,0X69,0XB3,0X0B,
+0X82,0XBB,0X0B,0X03,0XB3,0X0B,0XAA,0XAA,0XAA,0XCA,0XAA,0XCA,0X82,0XB2,0XEB,0X02,
+0XAA,0XCB,0XAB,0X0C,0X48,0XE4,0X83,0X41,0X05,0X06,0X8A,0X69,0XAA,0XCA,0XA2,0XEA,
+0X61,0X86,0X59,0X25,0X9A,0XCA,0XA2,0XCB,0X82,0XA2,0XCA,0X1B,0X92,0X8A,0X41,0X05,
+0X41,0X05,0X38,0XE5,0X38,0XE4,0X38,0XE5,0X38,0XE4,0X7A,0X08,0X9A,0XCA,0X9A,0XAB,
+0X92,0X8A,0X40,0XE4,0X41,0X05,0X48,0XE5,0X61,0XA7,0X59,0X65,0X61,0XA6,0X7A,0X07,
+0X92,0XA9,0X18,0X41,0X00,0X20,0X08,0X41,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,
+0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0X9F,0X21,0X04,0XA9,0X18,0XE3,0X0E,0X21,0X04,
+0X18,0XE3,0X29,0X65,0X29,0X65,0X39,0XC7,0X39,0XC7,0X31,0X86,0X18,0XC4,0X9A,0XEB,
+0XCB,0X2C,0XC3,0X0B,0XC3,0X0B,0XC3,0X4C,0XC3,0X2B,0XC3,0X2B,0X83,0XC3,0X0B,0X07,
+0XC3,0X4C,0XA2,0XA9,0XBB,0X2B,0XC3,0X2B,0XA3,0X0B,0X51,0X45,0X51,0X46,0X49,0X26,
+0X82,0X49,0X05,0X02,0X51,0X66,0X49,0X25,0X49,0X25,0X82,0X41,0X25,0X06,0X51,0X24,
+0XB3,0X0B,0XB3,0X0B,0XAA,0XEB,0XAA,0XEB,0XAA,0XCA,0XAA,0XEA,0X84,0XAA,0XCA,0X02,
+0XA2,0XCA,0XA2,0XCB,0X49,0X04,0X83,0X41,0X05,0X06,0X7A,0X29,0XA2,0XCA,0X9A,0XEB,
+0X51,0X46,0X49,0X46,0X7A,0X49,0X9A,0XCB,0X82,0X9A,0XCA,0X1B,0X92,0X8A,0X41,0X05,
+0X41,0X05,0X38,0XE5,0X38,0XE4,0X38,0XE5,0X30,0XE4,0X72,0X08,0X92,0XA9,0X92,0XAA,
+0X8A,0X8A,0X41,0X04,0X38,0XE4,0X38,0XE4,0X30,0XE5,0X30,0XE4,0X41,0X25,0X51,0X65,
+0X69,0XE7,0X18,0X61,0X00,0X20,0X08,0X41,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,
+0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0XA1,0X21,0X04,0XA7,0X18,0XE3,0X19,0X21,0X04,
+0X18,0XE3,0X29,0X65,0X29,0X65,0X39,0XC7,0X39,0XC7,0X29,0X65,0X19,0X03,0X49,0X45,
+0X7A,0X08,0XBB,0X0B,0XBA,0XEA,0XC3,0X2B,0XBB,0X0B,0XC3,0X2B,0XB2,0XAA,0XBA,0XEB,
+0XBB,0X0B,0XBB,0X0B,0X9A,0X69,0X61,0X65,0X79,0XA6,0XBB,0X0B,0X9A,0XCB,0X51,0X47,
+0X49,0X26,0X82,0X41,0X25,0X81,0X49,0X45,0X01,0X41,0X26,0X41,0X25,0X82,0X41,0X26,
+0X06,0X49,0X05,0XAA,0XEB,0XAA,0XCA,0X9A,0XCA,0X81,0XE7,0X9A,0XAA,0XA2,0XAA,0X85,
+0XA2,0XCA,0X12,0XA2,0XCB,0X49,0X04,0X41,0X25,0X41,0X25,0X41,0X05,0X41,0X05,0X72,
+0X08,0X9A,0XAA,0X92,0XAB,0X48,0XE5,0X41,0X06,0X71,0XC8,0X92,0XAB,0X9A,0X8A,0X9A,
+0XAA,0X9A,0XAA,0X8A,0X8A,0X41,0X25,0X41,0X05,0X83,0X38,0XE5,0X04,0X69,0XE8,0X92,
+0X8A,0X92,0X8A,0X8A,0X8A,0X41,0X05,0X82,0X30,0XE4,0X0C,0X31,0X04,0X31,0X05,0X39,
+0X05,0X41,0X05,0X10,0X00,0X08,0X41,0X08,0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X31,
+0X86,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,0XA1,0X21,0X04,0XA7,0X18,0XE3,0X19,0X21,
+0X04,0X18,0XE3,0X29,0X65,0X29,0X65,0X39,0XC7,0X39,0XC7,0X29,0X65,0X18,0XE3,0X49,
+0X45,0X51,0X67,0XAB,0X2D,0XBB,0X0C,0XAA,0XCA,0XB2,0XCA,0XBB,0X2B,0XAA,0XAA,0XBB,
+0X0B,0XB3,0X0B,0XAA,0XCA,0X8A,0X8A,0X59,0X86,0X61,0X87,0XAA,0XEB,0X9A,0XAA,0X51,
+0X46,0X49,0X25,0X82,0X41,0X25,0X02,0X41,0X26,0X49,0X26,0X41,0X26,0X82,0X41,0X25,
+0X19,0X41,0X26,0X49,0X05,0XA2,0XCB,0X82,0X08,0X49,0X04,0X49,0X05,0X51,0X25,0X59,
+0X45,0XA2,0XEC,0XA2,0XCB,0XA2,0XAA,0XA2,0XAA,0X9A,0X8A,0X9A,0X8A,0X9A,0XAA,0X49,
+0X04,0X41,0X25,0X41,0X25,0X41,0X05,0X41,0X05,0X69,0XE8,0X92,0X8A,0X8A,0X8A,0X49,
+0X05,0X49,0X26,0X59,0X86,0X83,0X92,0X8A,0X02,0X8A,0X8A,0X41,0X05,0X41,0X05,0X82,
+0X38,0XE5,0X05,0X39,0X05,0X61,0XC7,0X8A,0X69,0X8A,0X89,0X82,0X6A,0X41,0X04,0X82,
+0X30,0XE4,0X0C,0X31,0X04,0X30,0XE5,0X39,0X05,0X41,0X25,0X08,0X20,0X08,0X41,0X08,
+0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X31,0X86,0X21,0X04,0X21,0X24,0XC8,0X21,0X04,
+0XA2,0X21,0X04,0XA6,0X18,0XE3,0X81,0X21,0X04,0X81,0X29,0X65,0X19,0X39,0XE7,0X31,
+0XA6,0X29,0X45,0X18,0XE3,0X49,0X46,0X51,0X25,0XA3,0X2D,0XAB,0X0C,0XAB,0X0C,0X79,
+0X86,0XAB,0X4D,0XAA,0XAA,0XAA,0XEB,0XB2,0XCB,0XA2,0XCA,0X72,0X08,0X49,0X46,0X51,
+0X86,0X9A,0XCA,0X9A,0XAA,0X49,0X47,0X49,0X05,0X41,0X25,0X41,0X26,0X41,0X26,0X41,
+0X25,0X82,0X41,0X26,0X81,0X41,0X25,0X09,0X41,0X26,0X49,0X05,0X9A,0XAA,0X59,0X45,
+0X41,0X25,0X41,0X25,0X41,0X05,0X48,0XE5,0X92,0XAB,0X9A,0X6A,0X83,0X9A,0X8A,0X01,
+0X92,0XAA,0X49,0X05,0X82,0X41,0X05,0X0D,0X41,0X25,0X69,0XE8,0X82,0X69,0X61,0XC7,
+0X40,0XE5,0X39,0X05,0X49,0X05,0X92,0X8A,0X92,0X49,0X92,0X6A,0X8A,0X8A,0X82,0X89,
+0X41,0X05,0X39,0X05,0X83,0X38,0XE5,0X04,0X49,0X05,0X8A,0X69,0X8A,0X49,0X82,0X69,
+0X39,0X04,0X83,0X30,0XE5,0X0B,0X31,0X05,0X38,0XE5,0X39,0X05,0X08,0X21,0X00,0X20,
+0X08,0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,0X04,0X29,0X45,0XC8,0X21,
+0X04,0XA3,0X21,0X04,0XA5,0X18,0XE3,0X81,0X21,0X04,0X81,0X29,0X65,0X19,0X39,0XE7,
+0X31,0XA6,0X29,0X45,0X10,0XC3,0X41,0X25,0X49,0X25,0X49,0X04,0X49,0X05,0X41,0X04,
+0X51,0X46,0X51,0X66,0X9A,0X8B,0XAA,0XCA,0XAA,0XCB,0X9A,0XCA,0X59,0X45,0X51,0X46,
+0X49,0X45,0X82,0X4A,0X92,0XAA,0X49,0X26,0X49,0X05,0X41,0X25,0X41,0X05,0X41,0X05,
+0X41,0X25,0X82,0X41,0X26,0X82,0X41,0X25,0X0E,0X48,0XE4,0X8A,0X8A,0X59,0X87,0X41,
+0X05,0X41,0X05,0X39,0X05,0X40,0XE5,0X8A,0XAB,0X92,0X69,0X92,0X8A,0X82,0X49,0X59,
+0X65,0X51,0X45,0X59,0X66,0X41,0X04,0X82,0X41,0X05,0X0D,0X41,0X25,0X41,0X26,0X41,
+0X25,0X41,0X05,0X41,0X05,0X39,0X05,0X48,0XE4,0X8A,0X6A,0X8A,0X49,0X8A,0X49,0X8A,
+0X69,0X7A,0X69,0X41,0X05,0X39,0X05,0X82,0X38,0XE5,0X05,0X39,0X05,0X40,0XE4,0X82,
+0X69,0X82,0X49,0X7A,0X49,0X39,0X05,0X83,0X30,0XE5,0X0B,0X31,0X05,0X38,0XE5,0X39,
+0X05,0X08,0X21,0X00,0X20,0X08,0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,0X21,
+0X04,0X29,0X45,0XC8,0X21,0X04,0XA5,0X21,0X04,0XA5,0X18,0XE3,0X81,0X29,0X65,0X15,
+0X39,0XC7,0X31,0XA6,0X29,0X45,0X10,0XA3,0X31,0X05,0X41,0X25,0X41,0X25,0X41,0X05,
+0X41,0X05,0X41,0X25,0X41,0X25,0X51,0X46,0X9A,0X8A,0XAA,0XEB,0X92,0XCA,0X49,0X26,
+0X49,0X46,0X49,0X66,0X7A,0X2A,0X8A,0X8A,0X51,0X26,0X41,0X26,0X88,0X41,0X25,0X03,
+0X41,0X06,0X41,0X05,0X82,0X8A,0X51,0X66,0X83,0X41,0X05,0X06,0X8A,0XAA,0X8A,0X89,
+0X92,0X6A,0X7A,0X49,0X41,0X24,0X41,0X25,0X41,0X25,0X88,0X41,0X05,0X08,0X39,0X25,
+0X40,0XE4,0X8A,0X4A,0X82,0X69,0X8A,0X6A,0X82,0X69,0X7A,0X69,0X40,0XE4,0X39,0X05,
+0X82,0X38,0XE5,0X05,0X30,0XE5,0X38,0XE4,0X82,0X49,0X82,0X49,0X72,0X29,0X39,0X05,
+0X83,0X30,0XE5,0X0B,0X30,0XE4,0X38,0XE5,0X38,0XE5,0X08,0X21,0X00,0X20,0X08,0X61,
+0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,0X18,0XE3,0X21,0X24,0XC8,0X21,0X04,0XA5,
+0X21,0X04,0XA5,0X18,0XE3,0X81,0X29,0X65,0X04,0X39,0XC7,0X31,0XA6,0X29,0X45,0X10,
+0XA3,0X28,0XA3,0X83,0X41,0X05,0X81,0X41,0X25,0X0A,0X41,0X05,0X7A,0X2A,0X7A,0X08,
+0X61,0XA7,0X49,0X26,0X51,0X46,0X51,0X86,0X61,0X67,0X82,0X69,0X49,0X26,0X41,0X26,
+0X88,0X41,0X25,0X0E,0X41,0X06,0X41,0X05,0X82,0X6A,0X49,0X25,0X39,0X05,0X39,0X05,
+0X41,0X05,0X41,0X05,0X8A,0XAA,0X8A,0X89,0X92,0X6A,0X7A,0X29,0X41,0X25,0X41,0X05,
+0X41,0X26,0X82,0X41,0X05,0X81,0X38,0XE5,0X84,0X39,0X05,0X07,0X40,0XE4,0X82,0X6A,
+0X72,0X09,0X49,0X05,0X72,0X09,0X7A,0X49,0X38,0XE4,0X39,0X05,0X82,0X38,0XE5,0X05,
+0X30,0XE5,0X38,0XC4,0X7A,0X49,0X7A,0X49,0X72,0X28,0X39,0X05,0X83,0X30,0XE5,0X0B,
+0X30,0XE4,0X30,0XE5,0X39,0X05,0X08,0X21,0X00,0X20,0X08,0X61,0X21,0X24,0X31,0XA6,
+0X31,0XA6,0X29,0X65,0X18,0XE3,0X21,0X24,0XC8,0X21,0X04,0XA7,0X21,0X04,0XA2,0X18,
+0XE3,0X07,0X21,0X04,0X29,0X65,0X29,0X65,0X39,0XC7,0X31,0XA6,0X29,0X45,0X10,0XA2,
+0X10,0X82,0X86,0X41,0X05,0X01,0X59,0XC8,0X41,0X05,0X84,0X49,0X46,0X03,0X7A,0X49,
+0X49,0X46,0X41,0X25,0X41,0X05,0X85,0X41,0X25,0X83,0X41,0X05,0X0C,0X82,0X6A,0X40,
+0XE5,0X39,0X05,0X39,0X05,0X41,0X05,0X38,0XE5,0X7A,0X69,0X8A,0X69,0X8A,0X69,0X72,
+0X29,0X41,0X25,0X41,0X26,0X41,0X26,0X89,0X39,0X05,0X10,0X41,0X25,0X7A,0X29,0X49,
+0X05,0X38,0XE4,0X49,0X45,0X72,0X49,0X40,0XE4,0X39,0X05,0X38,0XE5,0X30,0XE5,0X30,
+0XE5,0X30,0XE4,0X38,0XE5,0X72,0X29,0X72,0X28,0X6A,0X09,0X39,0X05,0X83,0X30,0XE5,
+0X0A,0X30,0XC5,0X30,0XE5,0X38,0XE5,0X00,0X21,0X00,0X20,0X08,0X61,0X21,0X24,0X31,
+0XA6,0X31,0XA6,0X29,0X65,0X18,0XE3,0XC9,0X21,0X04,0XA7,0X21,0X04,0XA2,0X18,0XE3,
+0X09,0X21,0X04,0X29,0X65,0X29,0X65,0X39,0XC7,0X31,0XA6,0X29,0X45,0X10,0XA2,0X08,
+0X41,0X39,0X26,0X49,0X26,0X83,0X41,0X05,0X02,0X38,0XE5,0X41,0X25,0X41,0X05,0X82,
+0X41,0X26,0X05,0X49,0X46,0X49,0X26,0X7A,0X49,0X41,0X25,0X41,0X25,0X41,0X05,0X85,
+0X41,0X25,0X83,0X41,0X05,0X01,0X7A,0X4A,0X40,0XE5,0X83,0X38,0XE5,0X09,0X7A,0X49,
+0X82,0X49,0X82,0X49,0X6A,0X08,0X41,0X05,0X39,0X06,0X41,0X05,0X39,0X05,0X38,0XE5,
+0X38,0XE5,0X85,0X39,0X05,0X11,0X41,0X05,0X39,0X04,0X6A,0X09,0X38,0XE4,0X38,0XE5,
+0X38,0XC4,0X6A,0X29,0X39,0X05,0X39,0X05,0X38,0XE5,0X30,0XE5,0X30,0XE5,0X31,0X05,
+0X38,0XE4,0X72,0X09,0X72,0X08,0X6A,0X08,0X31,0X05,0X85,0X30,0XE5,0X08,0X18,0X62,
+0X00,0X21,0X00,0X20,0X08,0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,0X18,0XE3,
+0XC9,0X21,0X04,0XA9,0X21,0X04,0XA0,0X18,0XE3,0X09,0X21,0X04,0X29,0X45,0X29,0X65,
+0X39,0XC7,0X31,0XA6,0X29,0X45,0X10,0XA2,0X08,0X41,0X20,0XC3,0X48,0XE5,0X84,0X41,
+0X05,0X0A,0X41,0X25,0X38,0XE5,0X41,0X05,0X41,0X25,0X41,0X26,0X49,0X46,0X41,0X26,
+0X72,0X29,0X41,0X26,0X41,0X25,0X41,0X05,0X85,0X41,0X26,0X82,0X41,0X06,0X02,0X41,
+0X05,0X7A,0X4A,0X40,0XE4,0X82,0X38,0XE5,0X07,0X38,0XE4,0X72,0X28,0X82,0X29,0X82,
+0X28,0X6A,0X08,0X41,0X25,0X41,0X06,0X41,0X05,0X82,0X38,0XE5,0X8A,0X39,0X05,0X03,
+0X38,0XE5,0X62,0X09,0X39,0X05,0X39,0X05,0X82,0X30,0XE5,0X06,0X38,0XE5,0X30,0XE4,
+0X6A,0X08,0X72,0X08,0X6A,0X08,0X30,0XE5,0X30,0XC4,0X82,0X30,0XE5,0X01,0X30,0XC5,
+0X28,0XE5,0X82,0X00,0X20,0X05,0X08,0X61,0X21,0X24,0X31,0XA6,0X31,0XA6,0X29,0X65,
+0X18,0XE3,0XC9,0X21,0X04,0XA9,0X21,0X04,0XA1,0X18,0XE3,0X17,0X29,0X45,0X29,0X65,
+0X31,0XA6,0X31,0XA6,0X29,0X65,0X18,0XC3,0X08,0X61,0X08,0X41,0X30,0XE4,0X38,0XE5,
+0X38,0XE5,0X41,0X05,0X41,0X05,0X38,0XE5,0X41,0X05,0X38,0XE5,0X41,0X05,0X41,0X25,
+0X41,0X26,0X41,0X26,0X49,0X46,0X72,0X29,0X41,0X26,0X41,0X25,0X86,0X41,0X05,0X82,
+0X41,0X06,0X01,0X41,0X05,0X72,0X2A,0X83,0X38,0XE5,0X07,0X38,0XE4,0X6A,0X28,0X7A,
+0X28,0X7A,0X28,0X6A,0X08,0X41,0X25,0X41,0X06,0X41,0X05,0X84,0X38,0XE5,0X85,0X39,
+0X05,0X83,0X38,0XE5,0X02,0X41,0X46,0X38,0XE5,0X39,0X05,0X83,0X30,0XE5,0X05,0X30,
+0XC4,0X69,0XE8,0X6A,0X08,0X61,0XE8,0X30,0XE5,0X30,0XC4,0X83,0X30,0XE5,0X00,0X10,
+0X62,0X82,0X00,0X20,0X05,0X08,0X61,0X21,0X24,0X31,0X86,0X31,0X86,0X29,0X65,0X18,
+0XE3,0XC9,0X21,0X04,0XA9,0X21,0X04,0XA0,0X18,0XE3,0X0E,0X10,0X82,0X21,0X24,0X29,
+0X65,0X31,0XA6,0X31,0XA6,0X29,0X65,0X18,0XC3,0X08,0X41,0X08,0X41,0X08,0X61,0X39,
+0X25,0X40,0XE5,0X41,0X05,0X41,0X05,0X39,0X05,0X82,0X38,0XE5,0X81,0X41,0X26,0X04,
+0X49,0X27,0X49,0X26,0X6A,0X08,0X41,0X26,0X41,0X06,0X82,0X41,0X05,0X85,0X41,0X26,
+0X82,0X41,0X05,0X0B,0X38,0XE5,0X38,0XC5,0X38,0XC5,0X38,0XE5,0X38,0XE4,0X6A,0X28,
+0X72,0X08,0X7A,0X28,0X6A,0X08,0X41,0X25,0X39,0X26,0X39,0X05,0X8C,0X38,0XE5,0X81,
+0X30,0XE5,0X02,0X31,0X05,0X39,0X05,0X39,0X05,0X83,0X30,0XE5,0X05,0X30,0XE4,0X61,
+0XE8,0X6A,0X08,0X61,0XE9,0X30,0XE5,0X30,0XC4,0X82,0X30,0XE5,0X01,0X28,0XA3,0X00,
+0X00,0X82,0X00,0X20,0X04,0X08,0X41,0X18,0XC3,0X21,0X24,0X29,0X65,0X21,0X24,0XCA,
+0X21,0X04,0XA9,0X21,0X04,0XA0,0X18,0XE3,0X06,0X10,0X82,0X21,0X24,0X29,0X45,0X31,
+0X86,0X39,0XC7,0X29,0X65,0X18,0XC3,0X82,0X08,0X41,0X04,0X18,0X82,0X31,0X05,0X41,
+0X05,0X38,0XE5,0X39,0X05,0X82,0X38,0XE5,0X81,0X41,0X26,0X04,0X49,0X27,0X49,0X26,
+0X69,0XE8,0X41,0X26,0X41,0X26,0X82,0X41,0X06,0X83,0X41,0X26,0X81,0X39,0X26,0X81,
+0X41,0X05,0X01,0X39,0X05,0X38,0XE4,0X82,0X38,0XE5,0X07,0X38,0XE4,0X6A,0X28,0X72,
+0X08,0X72,0X29,0X62,0X08,0X41,0X25,0X39,0X26,0X39,0X05,0X8C,0X38,0XE5,0X81,0X30,
+0XE5,0X02,0X31,0X05,0X39,0X05,0X39,0X05,0X83,0X30,0XE5,0X0A,0X30,0XE4,0X61,0XE8,
+0X6A,0X08,0X61,0XE9,0X30,0XE5,0X30,0XC4,0X30,0XE5,0X30,0XE5,0X28,0XC4,0X08,0X21,
+0X00,0X00,0X82,0X00,0X20,0X81,0X08,0X41,0X81,0X08,0X61,0X01,0X10,0XA2,0X18,0XC3,
+0XC9,0X21,0X04,0XAA,0X21,0X04,0X9F,0X18,0XE3,0X06,0X10,0X82,0X21,0X04,0X21,0X24,
+0X29,0X65,0X39,0XC7,0X29,0X65,0X18,0XC3,0X82,0X08,0X41,0X03,0X08,0X21,0X18,0X62,
+0X39,0X25,0X38,0XE5,0X83,0X39,0X05,0X81,0X41,0X26,0X03,0X49,0X46,0X49,0X26,0X69,
+0XE8,0X39,0X26,0X83,0X41,0X26,0X81,0X39,0X05,0X81,0X39,0X26,0X00,0X39,0X25,0X83,
+0X39,0X05,0X84,0X38,0XE5,0X09,0X6A,0X09,0X72,0X08,0X69,0XC7,0X49,0X25,0X39,0X05,
+0X39,0X05,0X39,0X25,0X31,0X05,0X31,0X05,0X39,0X05,0X89,0X38,0XE5,0X82,0X30,0XE5,
+0X01,0X39,0X06,0X39,0X05,0X83,0X30,0XE5,0X09,0X38,0XE5,0X61,0XE8,0X69,0XE8,0X61,
+0XE8,0X38,0XE5,0X30,0XE4,0X30,0XE4,0X28,0XC4,0X08,0X21,0X00,0X00,0X82,0X00,0X20,
+0X83,0X08,0X41,0X02,0X08,0X61,0X10,0X82,0X18,0XE3,0XC9,0X21,0X04,0XAB,0X21,0X04,
+0X9E,0X18,0XE3,0X06,0X18,0XC3,0X21,0X04,0X21,0X04,0X29,0X45,0X29,0X65,0X29,0X45,
+0X18,0XC3,0X84,0X08,0X41,0X0B,0X08,0X20,0X31,0X04,0X39,0X05,0X40,0XE5,0X39,0X05,
+0X41,0X05,0X41,0X26,0X41,0X26,0X49,0X46,0X49,0X26,0X69,0XE8,0X39,0X26,0X85,0X41,
+0X26,0X82,0X39,0X26,0X04,0X39,0X25,0X41,0X26,0X41,0X26,0X39,0X05,0X39,0X05,0X82,
+0X38,0XE5,0X09,0X39,0X05,0X6A,0X09,0X72,0X08,0X61,0XC8,0X38,0XE5,0X39,0X05,0X39,
+0X05,0X39,0X25,0X39,0X05,0X31,0X05,0X8B,0X39,0X05,0X04,0X30,0XE5,0X39,0X05,0X39,
+0X26,0X39,0X06,0X39,0X05,0X82,0X30,0XE5,0X08,0X39,0X05,0X61,0XE8,0X69,0XE8,0X61,
+0XE8,0X38,0XE5,0X38,0XE5,0X18,0X42,0X00,0X00,0X00,0X21,0X83,0X00,0X20,0X07,0X08,
+0X41,0X08,0X61,0X08,0X41,0X08,0X61,0X10,0X82,0X08,0X61,0X29,0X45,0X21,0X24,0XC8,
+0X21,0X04,0XAB,0X21,0X04,0X9E,0X18,0XE3,0X07,0X21,0X04,0X10,0XA2,0X18,0XC3,0X18,
+0XC3,0X10,0XA3,0X10,0X82,0X18,0XC3,0X10,0X82,0X85,0X08,0X41,0X04,0X10,0X41,0X28,
+0XA3,0X39,0X25,0X41,0X46,0X41,0X26,0X82,0X49,0X46,0X01,0X69,0XE9,0X41,0X06,0X83,
+0X41,0X26,0X81,0X39,0X05,0X81,0X41,0X26,0X81,0X39,0X25,0X81,0X41,0X25,0X81,0X39,
+0X25,0X81,0X39,0X05,0X05,0X41,0X05,0X39,0X05,0X6A,0X08,0X72,0X09,0X61,0XC8,0X30,
+0XE5,0X83,0X39,0X26,0X81,0X30,0XE5,0X8B,0X39,0X06,0X03,0X39,0X05,0X39,0X26,0X39,
+0X06,0X39,0X05,0X82,0X30,0XE5,0X06,0X39,0X05,0X62,0X08,0X6A,0X29,0X51,0XA8,0X18,
+0X42,0X00,0X00,0X00,0X00,0X85,0X00,0X20,0X81,0X08,0X61,0X04,0X08,0X41,0X08,0X61,
+0X08,0X61,0X00,0X20,0X21,0X24,0XC9,0X21,0X04,0XAB,0X21,0X04,0X9F,0X18,0XE3,0X01,
+0X08,0X61,0X10,0X82,0X83,0X08,0X61,0X01,0X10,0X82,0X08,0X61,0X87,0X08,0X41,0X06,
+0X08,0X00,0X08,0X20,0X08,0X41,0X08,0X20,0X08,0X20,0X10,0X21,0X08,0X01,0X83,0X08,
+0X21,0X81,0X08,0X00,0X81,0X08,0X21,0X83,0X08,0X20,0X81,0X08,0X00,0X82,0X08,0X21,
+0X82,0X08,0X00,0X01,0X08,0X20,0X08,0X41,0X83,0X08,0X00,0X01,0X08,0X20,0X08,0X00,
+0X83,0X08,0X20,0X88,0X00,0X00,0X0C,0X08,0X00,0X00,0X00,0X08,0X00,0X00,0X00,0X00,
+0X00,0X00,0X01,0X00,0X00,0X08,0X20,0X00,0X00,0X00,0X00,0X00,0X20,0X00,0X00,0X00,
+0X00,0X84,0X00,0X20,0X00,0X08,0X41,0X82,0X08,0X61,0X82,0X10,0X82,0XCA,0X21,0X04,
+0XAF,0X21,0X04,0X9C,0X18,0XE3,0X82,0X10,0X82,0X03,0X08,0X41,0X08,0X61,0X10,0X82,
+0X08,0X61,0X8A,0X08,0X41,0XAB,0X00,0X20,0X8C,0X00,0X00,0X85,0X00,0X20,0X83,0X08,
+0X61,0X02,0X10,0X82,0X08,0X61,0X29,0X45,0XCA,0X21,0X04,0XAF,0X21,0X04,0X9C,0X18,
+0XE3,0X08,0X10,0X82,0X08,0X61,0X18,0XE3,0X00,0X20,0X08,0X41,0X10,0X82,0X10,0XA2,
+0X08,0X61,0X08,0X61,0X88,0X08,0X41,0XAB,0X00,0X20,0X8C,0X00,0X00,0X84,0X00,0X20,
+0X00,0X08,0X41,0X82,0X08,0X61,0X81,0X10,0X82,0X00,0X08,0X61,0XCB,0X21,0X04,0XAF,
+0X21,0X04,0X9D,0X18,0XE3,0X82,0X10,0X82,0X81,0X08,0X61,0X81,0X10,0X82,0X00,0X08,
+0X61,0X88,0X08,0X41,0XAB,0X00,0X20,0X89,0X00,0X00,0X86,0X00,0X20,0X02,0X08,0X41,
+0X08,0X61,0X08,0X61,0X82,0X10,0X82,0X02,0X00,0X20,0X21,0X04,0X21,0X24,0XCA,0X21,
+0X04,0XAF,0X21,0X04,0X9C,0X18,0XE3,0X05,0X21,0X04,0X10,0XA2,0X10,0XA2,0X08,0X61,
+0X08,0X61,0X08,0X41,0X83,0X08,0X61,0X87,0X08,0X41,0XBA,0X00,0X20,0X81,0X08,0X41,
+0X00,0X08,0X61,0X84,0X10,0X82,0X01,0X18,0XC3,0X18,0XE3,0XCB,0X21,0X04,0XAF,0X21,
+0X04,0X9E,0X18,0XE3,0X04,0X10,0X82,0X08,0X61,0X08,0X61,0X08,0X41,0X08,0X41,0X85,
+0X08,0X61,0X8A,0X08,0X41,0XB3,0X00,0X20,0X81,0X08,0X41,0X07,0X08,0X61,0X10,0X82,
+0X10,0XA2,0X10,0XA2,0X10,0X82,0X10,0X82,0X08,0X61,0X21,0X24,0XCC,0X21,0X04,0XB1,
+0X21,0X04,0X9C,0X18,0XE3,0X05,0X21,0X04,0X10,0X82,0X08,0X61,0X08,0X61,0X08,0X41,
+0X08,0X41,0X85,0X08,0X61,0X8D,0X08,0X41,0XA7,0X00,0X20,0X87,0X08,0X41,0X82,0X08,
+0X61,0X00,0X10,0X82,0X82,0X10,0XA2,0X01,0X08,0X61,0X21,0X24,0XCD,0X21,0X04,0XB3,
+0X21,0X04,0X9C,0X18,0XE3,0X07,0X10,0X82,0X08,0X61,0X08,0X61,0X08,0X41,0X08,0X41,
+0X08,0X61,0X08,0X61,0X10,0X82,0X8D,0X08,0X61,0XAD,0X08,0X41,0X85,0X08,0X61,0X81,
+0X10,0X82,0X81,0X10,0XA2,0X01,0X08,0X61,0X21,0X24,0XCE,0X21,0X04,0XB3,0X21,0X04,
+0X9C,0X18,0XE3,0X06,0X21,0X04,0X10,0X82,0X08,0X61,0X10,0X82,0X08,0X41,0X08,0X41,
+0X08,0X61,0X8E,0X10,0X82,0XAD,0X08,0X61,0X82,0X10,0X82,0X06,0X08,0X61,0X08,0X41,
+0X08,0X61,0X10,0X82,0X10,0X82,0X08,0X61,0X08,0X61,0XD0,0X21,0X04,0XB5,0X21,0X04,
+0X9C,0X18,0XE3,0X00,0X18,0XC3,0X82,0X08,0X61,0X95,0X10,0X82,0X87,0X08,0X61,0X85,
+0X10,0X82,0X9A,0X08,0X61,0X07,0X10,0X82,0X08,0X61,0X08,0X61,0X08,0X41,0X08,0X61,
+0X08,0X61,0X08,0X41,0X10,0XA2,0XD1,0X21,0X04,0XB5,0X21,0X04,0X9D,0X18,0XE3,0X04,
+0X21,0X04,0X10,0XA2,0X08,0X41,0X08,0X41,0X08,0X61,0X93,0X10,0X82,0X87,0X08,0X61,
+0X85,0X10,0X82,0X9D,0X08,0X61,0X81,0X08,0X41,0X01,0X10,0X82,0X21,0X24,0XD2,0X21,
+0X04,0XB7,0X21,0X04,0X9E,0X18,0XE3,0X03,0X18,0XC3,0X10,0X82,0X08,0X41,0X08,0X41,
+0X85,0X08,0X61,0X01,0X10,0X82,0X08,0X61,0X8D,0X10,0X82,0X81,0X08,0X61,0X81,0X08,
+0X62,0X9F,0X08,0X61,0X83,0X08,0X41,0X02,0X10,0XA2,0X21,0X04,0X21,0X24,0XD3,0X21,
+0X04,0XB7,0X21,0X04,0XA1,0X18,0XE3,0X04,0X21,0X04,0X18,0XE3,0X18,0XE3,0X10,0XA2,
+0X08,0X61,0X91,0X08,0X41,0X8D,0X08,0X61,0X81,0X08,0X41,0X81,0X08,0X61,0X85,0X08,
+0X41,0X83,0X00,0X20,0X00,0X00,0X00,0X82,0X00,0X20,0X81,0X08,0X41,0X06,0X10,0X82,
+0X10,0XA2,0X18,0XC3,0X18,0XE3,0X21,0X04,0X21,0X04,0X18,0XE3,0XD5,0X21,0X04,0XB7,
+0X21,0X04,0XA2,0X18,0XE3,0X07,0X21,0X03,0X20,0XE4,0X18,0XE3,0X18,0XE3,0X18,0XE4,
+0X20,0XE4,0X18,0XE4,0X18,0XE4,0X84,0X18,0XE3,0X82,0X18,0XC3,0X06,0X18,0XE4,0X18,
+0XA2,0X10,0XA1,0X10,0X81,0X10,0X81,0X08,0X62,0X08,0X62,0X89,0X08,0X61,0X02,0X08,
+0X41,0X10,0X61,0X10,0X41,0X82,0X10,0X40,0X02,0X08,0X41,0X08,0X61,0X08,0X81,0X84,
+0X10,0X82,0X01,0X08,0X82,0X10,0XC4,0X84,0X18,0XE3,0XDE,0X21,0X04,0XB7,0X21,0X04,
+0XA3,0X18,0XE3,0X03,0X39,0XC1,0X49,0XA1,0X41,0X81,0X31,0X21,0X82,0X39,0X62,0X0E,
+0X41,0X63,0X39,0X63,0X41,0X83,0X41,0X83,0X39,0X84,0X41,0XA4,0X39,0XA4,0X39,0X84,
+0X39,0X83,0X49,0XE3,0X5A,0X02,0X59,0XE2,0X49,0XA2,0X10,0X82,0X10,0X82,0X86,0X10,
+0XA2,0X81,0X18,0XC3,0X81,0X10,0XA3,0X07,0X29,0X02,0X39,0X01,0X49,0XA2,0X49,0XC2,
+0X51,0X81,0X49,0XE3,0X20,0XE2,0X20,0XE4,0X83,0X21,0X04,0X02,0X18,0XE4,0X52,0XEC,
+0X42,0X4A,0X84,0X18,0XE3,0XDE,0X21,0X04,0XB9,0X21,0X04,0X9F,0X18,0XE3,0X16,0X18,
+0XE4,0X94,0X67,0XCD,0X65,0XC4,0XA3,0XAB,0XA3,0XB4,0X23,0XB3,0XE4,0XAB,0XE4,0XAB,
+0XC3,0XAB,0XA4,0XA3,0X86,0X93,0X62,0X9B,0X63,0X9B,0X84,0X9B,0X63,0X8B,0X44,0X83,
+0X03,0X7A,0X82,0X7A,0XA3,0X7A,0X82,0X72,0X62,0X62,0X01,0X10,0XA2,0X85,0X10,0X82,
+0X82,0X10,0XA2,0X82,0X18,0XC3,0X11,0X30,0XE2,0X51,0XA3,0X51,0X81,0X51,0XC0,0X61,
+0XC2,0X72,0X83,0X49,0XA3,0X41,0XA3,0X41,0XA4,0X41,0XC5,0X49,0XE6,0X4A,0X07,0X10,
+0X62,0XCE,0X9B,0X9C,0XF3,0X08,0X81,0X21,0X03,0X20,0XE3,0X83,0X18,0XE3,0XDC,0X21,
+0X04,0XB9,0X21,0X04,0X9E,0X18,0XE3,0X17,0X21,0X04,0X31,0X63,0XDD,0XC6,0XDD,0X02,
+0XD4,0XA3,0XDC,0XE4,0XBB,0XE0,0XCC,0X42,0XB3,0XC0,0XB3,0XE0,0XBC,0X22,0XC4,0X24,
+0XB3,0XA0,0XAB,0X40,0XB3,0XC1,0XC4,0X03,0XCC,0X64,0XCC,0X64,0XC4,0X02,0XB3,0XA1,
+0XCC,0X44,0XDC,0XA6,0XBC,0X24,0X10,0X20,0X83,0X10,0X82,0X81,0X08,0X62,0X81,0X10,
+0X82,0X83,0X10,0XA2,0X15,0X41,0X62,0X9B,0X65,0XAB,0X84,0XB3,0XC2,0XBC,0X24,0XB4,
+0X04,0XBC,0X25,0XB3,0XC3,0XAB,0XA3,0X9B,0X22,0X9B,0X63,0X93,0X02,0X82,0XA2,0X61,
+0XC0,0X6A,0X41,0X59,0XC0,0X6A,0X41,0X72,0XC3,0X41,0XA2,0X19,0X03,0X18,0XE3,0X18,
+0XE3,0XDC,0X21,0X04,0XBB,0X21,0X04,0X9C,0X18,0XE3,0X17,0X19,0X03,0X39,0XC2,0XDD,
+0XA3,0XD4,0XA1,0XC4,0X62,0XD4,0XA4,0XBC,0X24,0XB3,0X81,0XAB,0X20,0XB3,0X80,0XC4,
+0X64,0XA3,0X40,0XAB,0X61,0XA3,0X20,0XAB,0X61,0XAB,0X81,0XCC,0X83,0XC4,0X23,0XC4,
+0X03,0XBB,0XC1,0XC4,0X03,0XCC,0X85,0XAB,0XC6,0X10,0X81,0X83,0X10,0X82,0X81,0X08,
+0X61,0X19,0X10,0X82,0X08,0X61,0X08,0X83,0X00,0X21,0X18,0XA3,0X18,0XA2,0X49,0X82,
+0X92,0XC2,0XB3,0XC4,0XB3,0XA1,0XBB,0XC1,0XC4,0X02,0XCC,0X42,0XCC,0X62,0XB3,0XA0,
+0XDC,0XC3,0XDC,0XC4,0XE4,0XE5,0XD4,0X85,0XD4,0X84,0XCC,0X63,0XD4,0X84,0XDC,0XA4,
+0XE5,0X25,0XAB,0XE3,0X39,0XA5,0XDE,0X21,0X04,0XBB,0X21,0X04,0X9C,0X18,0XE3,0X19,
+0X19,0X03,0X39,0XC2,0XDD,0X83,0XC4,0X63,0X7A,0XA4,0X59,0XE4,0X52,0X25,0X72,0XC6,
+0X41,0X00,0X41,0X20,0X51,0XA2,0X51,0XA2,0X59,0X80,0X59,0X80,0X51,0X81,0X49,0X60,
+0XA3,0XC7,0X9B,0X85,0XAB,0X84,0XAB,0X84,0XCC,0X46,0XB3,0X86,0X39,0X02,0X10,0XC3,
+0X10,0XA2,0X10,0XA2,0X85,0X10,0X82,0X1A,0XA5,0X36,0X3A,0X09,0X7B,0XF1,0X18,0XC2,
+0X39,0X01,0XA3,0X23,0XCC,0XA6,0XCC,0X63,0XC4,0X02,0XC4,0X42,0XCC,0X63,0XC4,0X41,
+0XB3,0XC0,0XC4,0X41,0XCC,0X62,0XD4,0X83,0XCC,0X43,0XDC,0XC5,0XCC,0X63,0XCC,0X64,
+0XDC,0XA4,0XD4,0X82,0XDC,0XA2,0X6A,0XC7,0X21,0X04,0X21,0X04,0X18,0XE3,0XDB,0X21,
+0X04,0XBD,0X21,0X04,0X9A,0X18,0XE3,0X38,0X19,0X03,0X39,0XC2,0XD5,0X23,0X59,0XA1,
+0X10,0X62,0X18,0XA1,0X29,0X25,0X94,0X6F,0X20,0XE3,0X10,0X61,0X29,0X04,0X18,0X83,
+0X18,0XA2,0X18,0X83,0X18,0XC4,0X18,0XA3,0X10,0X82,0X18,0XC2,0X28,0XE2,0X31,0X24,
+0X20,0XE1,0X18,0XC0,0X10,0XA2,0X10,0XC2,0X10,0XA3,0X10,0XA3,0X10,0XA2,0X10,0X82,
+0X10,0XA2,0X10,0X82,0X10,0XA2,0X10,0X82,0X4A,0X49,0X08,0X63,0XAD,0X54,0X10,0X61,
+0X30,0XC1,0X92,0XE2,0XBC,0X22,0XD4,0XA5,0XAB,0XA0,0XBB,0XC1,0XD4,0XA5,0XB3,0XC0,
+0XB3,0X80,0XB3,0X80,0XCC,0X63,0XDC,0XC5,0XDC,0X85,0XD4,0X64,0XCC,0X63,0XCC,0X64,
+0XD4,0XC4,0XDC,0XE4,0XDC,0XC2,0X6A,0XC5,0X21,0X04,0X82,0X18,0XE3,0XDA,0X21,0X04,
+0XBD,0X21,0X04,0X9A,0X18,0XE3,0X0D,0X19,0X03,0X39,0XC2,0X6A,0X81,0X10,0XC5,0X3A,
+0X0A,0X29,0X66,0X18,0XC4,0X18,0XC4,0X10,0XC4,0X10,0XC3,0X42,0X4A,0X21,0X25,0X18,
+0XE3,0X10,0X83,0X82,0X18,0XC4,0X04,0X10,0XA3,0X18,0XE3,0X10,0XE3,0X10,0XC2,0X10,
+0XC3,0X85,0X10,0XA3,0X1D,0X10,0XA2,0X10,0X82,0X10,0XA2,0X10,0X82,0XB5,0XFA,0X21,
+0X46,0X8C,0XD4,0X10,0XA2,0X38,0XC2,0X8A,0X00,0XD4,0X64,0XE4,0X84,0XD4,0X62,0XDC,
+0X83,0XD4,0X62,0XD4,0X42,0XAB,0X20,0XAB,0X20,0XCC,0X03,0XD4,0X64,0XC4,0X03,0XC3,
+0XE1,0XBB,0XA0,0XB3,0X80,0XCC,0X42,0XCC,0X00,0XDC,0X82,0X72,0XE5,0X21,0X04,0X18,
+0XE3,0XDC,0X21,0X04,0XBF,0X21,0X04,0X98,0X18,0XE3,0X39,0X19,0X04,0X31,0X44,0X18,
+0XC2,0X10,0XC3,0XBD,0XF9,0X08,0XA3,0X8C,0XB2,0X8C,0X95,0X7B,0XF1,0XB5,0XF8,0X7B,
+0XF4,0XC6,0X1B,0X94,0XD4,0X08,0X83,0XB6,0X38,0X29,0XC9,0X31,0XEB,0X84,0X74,0X9D,
+0X37,0X00,0X02,0X19,0X04,0X19,0X07,0X10,0XC5,0X08,0X63,0X10,0XA5,0X00,0X41,0X08,
+0X81,0X10,0XA3,0X08,0X82,0X10,0X83,0X18,0XC3,0X10,0XA3,0X18,0XE4,0X7B,0XEE,0X52,
+0X69,0X30,0XE2,0XAA,0XC3,0X69,0XA2,0X69,0X61,0X81,0XE1,0X81,0XA0,0X79,0X60,0XBB,
+0X63,0XCB,0X81,0XC3,0X61,0XBB,0X01,0XB2,0XE1,0XB2,0XC2,0XAA,0XC2,0XA2,0X80,0XBB,
+0X63,0XA2,0X80,0XAB,0X00,0XB3,0X00,0XBB,0XA1,0X83,0X65,0X21,0X04,0X18,0XE3,0XDC,
+0X21,0X04,0XBF,0X21,0X04,0X98,0X18,0XE3,0X38,0X19,0X04,0X31,0X44,0X18,0XC3,0X10,
+0XC3,0X94,0XD5,0X73,0XF1,0X10,0XC3,0X9D,0X15,0X31,0XC9,0XB5,0XB7,0X73,0XD2,0X19,
+0X25,0XBE,0X5A,0XD7,0X1E,0XD7,0X1C,0XBE,0X1B,0XD6,0XFC,0X8C,0XB3,0XBE,0X3A,0X3A,
+0X2A,0X4A,0X8A,0XE7,0X7F,0X9D,0X57,0X53,0X0B,0X84,0X54,0X08,0X83,0XC6,0X5B,0XA5,
+0X38,0XB5,0XFA,0X6B,0X6F,0X08,0X62,0X18,0XA3,0X6B,0XB0,0XBE,0X1B,0X31,0X68,0X39,
+0X21,0XA2,0X01,0XB3,0X84,0XBB,0XC5,0XB3,0X84,0XAB,0X43,0X9A,0XC1,0X92,0X60,0X9A,
+0X60,0X92,0X00,0X92,0X01,0X89,0XC1,0X89,0XA1,0X89,0XA1,0X89,0XE1,0X91,0XE1,0X89,
+0XC0,0X9A,0X20,0XAA,0X60,0XBB,0X20,0XD5,0XE6,0X31,0X86,0XDD,0X21,0X04,0XBF,0X21,
+0X04,0X98,0X18,0XE3,0X02,0X21,0X04,0X29,0X44,0X18,0XC4,0X82,0X18,0XC3,0X33,0X10,
+0XC3,0X19,0X04,0X10,0XC3,0X29,0X24,0X72,0XC8,0X7B,0X6C,0X4A,0X28,0XBD,0XB7,0XB5,
+0XD8,0XC6,0X59,0X63,0X2D,0X8C,0X92,0XDF,0X1B,0X29,0X66,0X73,0XAE,0XDF,0X1D,0X6B,
+0X8F,0XEF,0XDF,0X84,0X73,0X10,0XC5,0XEF,0XBF,0XE7,0X7E,0XDF,0X3D,0XF7,0XFF,0X10,
+0X82,0X10,0XA3,0X84,0X51,0X00,0X63,0XAD,0X96,0X49,0X82,0X92,0X81,0XB3,0X02,0XB2,
+0XA0,0XB2,0XE2,0XB2,0XA1,0XBB,0X43,0XCB,0XA4,0XDC,0X24,0XE4,0XE5,0XED,0X05,0XE5,
+0X06,0XE4,0XC6,0XDC,0XC7,0XCC,0X66,0XA2,0XE3,0XAB,0X46,0X9B,0X05,0X9A,0XC0,0XA2,
+0XC0,0X7B,0X25,0X21,0X04,0X18,0XE4,0XDC,0X21,0X04,0XBF,0X21,0X04,0X98,0X18,0XE3,
+0X38,0X21,0X04,0X29,0X44,0X41,0XC5,0X29,0X45,0X18,0XE2,0X18,0XC2,0X18,0XE4,0X21,
+0X04,0X19,0X03,0X51,0XE6,0XC4,0XCE,0X92,0XE4,0XB4,0X4D,0X6A,0X86,0X41,0X42,0X18,
+0XC3,0X63,0X0E,0X63,0X0D,0X10,0XA3,0X10,0X82,0X18,0XE3,0X10,0XC3,0X18,0XC3,0X18,
+0XA2,0X10,0XA2,0X21,0X04,0X08,0X41,0X5B,0X2C,0X4A,0X8A,0X63,0X2E,0X10,0XA2,0X10,
+0X82,0XDF,0X3E,0X21,0X26,0X5A,0XED,0X49,0XA3,0XAB,0X66,0XAB,0X21,0XAA,0X80,0XBB,
+0X43,0XAA,0X60,0XAA,0X81,0X9A,0X40,0XBB,0X87,0XB3,0X26,0XB3,0X27,0XAA,0XC6,0XA2,
+0XA4,0XBB,0XE4,0XED,0X64,0XFE,0XF0,0XE6,0X93,0XFF,0XBA,0XFE,0XF4,0XC3,0XE0,0X6A,
+0XC6,0X18,0XE4,0XDD,0X21,0X04,0XC1,0X21,0X04,0X96,0X18,0XE3,0X39,0X21,0X04,0X29,
+0X23,0X41,0X82,0X31,0X23,0X19,0X02,0X18,0XC2,0X21,0X03,0X10,0XC3,0X18,0X80,0X82,
+0X85,0X6A,0X24,0XB3,0XA2,0XBB,0XA2,0XC4,0X04,0XB3,0XE2,0XAB,0XE6,0X31,0X43,0X41,
+0XC6,0X39,0X65,0X18,0XC3,0X18,0XA3,0X10,0X63,0X08,0X81,0X10,0X62,0X10,0XA2,0X08,
+0X61,0X20,0XC4,0X18,0XC3,0X18,0XA2,0X18,0XC1,0X10,0XE3,0X10,0XA2,0X7B,0XEF,0X7C,
+0X2F,0X42,0XCB,0X49,0XA2,0XCC,0X63,0XB3,0X00,0XB3,0XC5,0XCC,0XA6,0XC3,0X43,0XB2,
+0XC2,0XB3,0X22,0XE5,0X8A,0XE6,0X0E,0XF6,0X91,0XEE,0XB2,0XF6,0XD2,0XF6,0XF5,0XF6,
+0XF4,0XF6,0XD3,0XF7,0X12,0XD5,0X27,0XFE,0X93,0XD4,0X01,0X6A,0X87,0X20,0XE4,0X21,
+0X03,0XDC,0X21,0X04,0XC1,0X21,0X04,0X96,0X18,0XE3,0X39,0X21,0X03,0X31,0X43,0XB3,
+0X64,0XB3,0X25,0X61,0X61,0X8A,0XC5,0X59,0X82,0X72,0X02,0X49,0X63,0X61,0XC4,0X6A,
+0X64,0XA2,0XC1,0XB3,0X03,0XC3,0X84,0X9B,0X01,0XB4,0X4A,0X8A,0XE4,0X82,0X00,0XCB,
+0XE5,0XC4,0X06,0XB3,0XE7,0X92,0XE2,0XE5,0XA4,0XDD,0X06,0XCC,0XA7,0XC4,0X86,0XC4,
+0X86,0XB4,0X27,0X9B,0XC6,0X62,0X02,0X72,0XA5,0X28,0XC0,0X28,0XE0,0X20,0XA1,0X18,
+0XC4,0X52,0X03,0XCC,0X45,0XCB,0XE0,0XB3,0XE1,0XE5,0XE8,0X92,0XC0,0XC3,0XC2,0XDC,
+0XC5,0XF5,0XE9,0XF6,0X6C,0XEE,0X4F,0XEE,0X70,0XEE,0X4F,0XEE,0X6F,0XE6,0X4D,0XE6,
+0X2C,0XFE,0XAF,0XA3,0XA6,0XD5,0X05,0XCC,0X01,0X6A,0XA7,0X21,0X04,0X21,0X03,0XDC,
+0X21,0X04,0XC3,0X21,0X04,0X94,0X18,0XE3,0X37,0X20,0XE3,0X41,0X62,0XBA,0X80,0XBA,
+0XE3,0X71,0X20,0XC3,0X44,0X69,0X41,0XCB,0X42,0X71,0X41,0XDB,0X85,0X61,0XC0,0XBA,
+0XC2,0X82,0X01,0XC3,0X01,0XA2,0X41,0X8A,0X42,0X82,0X41,0X8A,0X61,0XAB,0X83,0XAB,
+0X62,0XB3,0X81,0XAB,0X44,0X9A,0XA2,0XF5,0XE4,0XCC,0X43,0XDC,0XE5,0XC4,0X02,0XC4,
+0X22,0XE5,0X06,0XE5,0X04,0XCC,0XC3,0XC4,0X82,0XBB,0XE1,0XCC,0X83,0XC4,0X45,0X72,
+0X21,0XB3,0X42,0XCC,0X20,0XBC,0X42,0XD5,0X46,0X8A,0XC2,0XB4,0X46,0XE5,0X8C,0XE5,
+0XAB,0XEE,0X2B,0XEE,0X2C,0XE6,0X2D,0XE5,0XED,0XEE,0X4E,0XED,0XED,0XED,0XEE,0XE6,
+0X2C,0XCB,0XC2,0XCB,0XA2,0XBB,0XA0,0X72,0XC7,0XDE,0X21,0X04,0XC3,0X21,0X04,0X94,
+0X18,0XE3,0X2C,0X20,0XE3,0X41,0X62,0XB2,0XA2,0XBB,0XC5,0X61,0X40,0XA3,0X43,0X61,
+0X61,0XAB,0X42,0X69,0X81,0XC3,0XC5,0X69,0X81,0X9A,0X61,0X8A,0X21,0XC3,0X23,0X92,
+0X00,0XB2,0XE1,0XB3,0X21,0XBB,0X82,0XBB,0X62,0XAB,0X01,0XBB,0XE3,0XC4,0X43,0XBB,
+0XA6,0X92,0X80,0XED,0X85,0XC4,0X21,0XB3,0XA0,0XBC,0X00,0XCC,0X62,0XCC,0X83,0XC4,
+0X42,0XB3,0XC0,0XB3,0XA1,0XCC,0X63,0XC4,0X23,0XBB,0X82,0XD4,0X03,0XAB,0X40,0XAB,
+0X22,0XB3,0X64,0XAB,0XA5,0XDD,0X89,0XF6,0X2D,0XAC,0X88,0XEE,0XAF,0X82,0XDE,0X6D,
+0X07,0XEE,0XCE,0XFF,0X30,0XDD,0XAC,0XE5,0XEB,0XB2,0XA0,0XC3,0XA1,0XBB,0X80,0X72,
+0XE8,0XDE,0X21,0X04,0XC6,0X21,0X04,0X91,0X18,0XE3,0X37,0X20,0XE4,0X39,0X42,0X9A,
+0X01,0XA3,0X84,0X51,0X80,0XBD,0X29,0X49,0X60,0XC5,0X68,0X51,0XC2,0XC5,0X67,0X61,
+0XE2,0XD5,0X86,0X72,0X83,0XA3,0XC5,0X92,0XC1,0XB3,0X61,0XDC,0X83,0XDC,0X82,0XC3,
+0XE1,0XA2,0XC2,0XAB,0X20,0XB3,0X62,0XBB,0XA3,0XC3,0XE4,0XA2,0XE1,0XD4,0XA2,0XC4,
+0X03,0XBB,0XC2,0XCC,0X64,0XD4,0X84,0XBB,0XE2,0XB3,0XA1,0XBB,0XE2,0XC4,0X23,0XB3,
+0X81,0XB3,0X81,0XC3,0XA2,0XBB,0X42,0XC4,0X44,0XAB,0XC3,0XBC,0X48,0XBC,0X67,0X8B,
+0X48,0X18,0XC3,0X18,0XE2,0X18,0XE2,0X29,0X23,0X39,0XA4,0X52,0X25,0X73,0X28,0X83,
+0XE9,0XC4,0X49,0XAA,0X81,0XB2,0XE3,0XB3,0X42,0X6B,0X08,0XDE,0X21,0X04,0XC6,0X21,
+0X04,0X91,0X18,0XE3,0X2A,0X20,0XE4,0X39,0X42,0X91,0XE1,0X9B,0XA6,0X41,0X41,0XAC,
+0XA6,0X41,0X20,0XCD,0XC9,0X38,0XE0,0XCD,0XC8,0X30,0XC0,0XAC,0XC6,0X6A,0X62,0XA3,
+0XE2,0X8A,0X81,0XC3,0XE4,0XC3,0XA3,0XBB,0X82,0XBB,0XA0,0XAB,0X02,0XDC,0XA4,0XAB,
+0X23,0XBB,0X84,0XBB,0XA2,0XC3,0XC6,0XAB,0X01,0XCC,0X82,0XC4,0X42,0XDC,0XE5,0XE5,
+0X06,0XCC,0X63,0XC4,0X22,0XC4,0X22,0XD4,0XA4,0XC4,0X23,0XB3,0X81,0XBB,0X41,0XBB,
+0X22,0XAA,0XC2,0X92,0XA2,0X9A,0XA3,0XCC,0X4A,0X6A,0X23,0X82,0X18,0XC2,0X09,0X18,
+0XE3,0X29,0X64,0X18,0XE3,0X18,0XE3,0X20,0XE2,0X61,0XA1,0X92,0X41,0XAA,0X81,0XB3,
+0X62,0X73,0X06,0XDE,0X21,0X04,0XC8,0X21,0X04,0X8D,0X18,0XE3,0X82,0X21,0X04,0X36,
+0X31,0X62,0X79,0XC1,0X93,0X86,0X41,0X00,0XE6,0X8D,0X41,0X41,0XA4,0X65,0X38,0XE1,
+0XC5,0X67,0X49,0X40,0XB4,0XA7,0X51,0XA0,0XB4,0X64,0X71,0XE1,0XAB,0X02,0XBB,0X60,
+0XBB,0XA0,0XCB,0XE2,0XCC,0X23,0XD4,0X84,0X89,0XE0,0X79,0X60,0XB3,0X42,0XD4,0X45,
+0XCB,0XE6,0X9A,0XA2,0XE5,0X02,0XDC,0XA4,0XDC,0XC5,0XCC,0X62,0XDD,0X04,0XCC,0X83,
+0XD4,0XA4,0XCC,0X63,0XBB,0XC1,0XBB,0X61,0XB2,0XC2,0XAA,0X60,0XB2,0XC1,0XD4,0X25,
+0XAB,0X02,0X51,0X21,0X18,0XA1,0X18,0XC2,0X18,0XC1,0X18,0XC2,0X21,0X02,0X18,0XE2,
+0X18,0XC2,0X18,0XC1,0X6A,0X83,0X81,0XE1,0XA2,0X61,0XB3,0X41,0X6A,0XA2,0XDE,0X21,
+0X04,0XC8,0X21,0X04,0X8D,0X18,0XE3,0X82,0X21,0X04,0X36,0X31,0X62,0X8A,0X83,0XB4,
+0XE9,0X39,0X00,0XAC,0XE9,0X39,0X20,0XCD,0XC9,0X38,0XC0,0XAC,0XC5,0X41,0X21,0XB4,
+0XC4,0X49,0X80,0X93,0XA1,0X61,0XA0,0XA2,0XA1,0XCB,0XC2,0XCB,0XC0,0XC3,0XE1,0XD4,
+0X63,0XD4,0X63,0X92,0X00,0X79,0X60,0XB3,0X23,0XBB,0X85,0X81,0XC0,0X81,0XC0,0XED,
+0X43,0XC4,0X03,0XCC,0X22,0XC4,0X22,0XBB,0XE0,0XCC,0X43,0XC4,0X23,0XCC,0X44,0XB3,
+0X81,0XB3,0X20,0XAA,0XA1,0XB2,0XC1,0XC3,0XC4,0XCB,0XE3,0X9A,0X60,0X51,0X23,0X18,
+0XC2,0X20,0XC2,0X31,0X63,0X20,0XE2,0X21,0X02,0X18,0XE2,0X18,0XC2,0X29,0X23,0X72,
+0XA5,0X82,0X01,0XA2,0X82,0XB3,0X60,0X72,0XE4,0XDE,0X21,0X04,0XC8,0X21,0X04,0X8D,
+0X18,0XE3,0X81,0X21,0X04,0X37,0X20,0XC4,0X41,0X42,0X82,0X21,0X71,0XE1,0X48,0XC0,
+0X82,0XA4,0X30,0XA0,0XDD,0X8A,0X30,0XE0,0XDD,0X88,0X31,0X00,0XB4,0XA5,0X49,0X80,
+0X7B,0X22,0X59,0X60,0X9A,0X80,0XD3,0XC3,0XD3,0XC2,0XCB,0XE3,0XCC,0X23,0XCC,0X63,
+0X89,0XE0,0X79,0X40,0XB3,0X03,0XC3,0XA4,0X81,0XC0,0X81,0XA0,0XED,0X65,0XC4,0X02,
+0XDC,0XE5,0XDC,0XC4,0XE4,0XE4,0XDC,0XC4,0XE5,0X04,0XB3,0XE1,0XB3,0XA1,0XC3,0XA3,
+0XA2,0X60,0XBB,0X41,0X9A,0X60,0XB2,0XA0,0XBB,0X42,0X49,0XA3,0X18,0XA2,0X20,0XC3,
+0X29,0X01,0X18,0XE1,0X29,0X02,0X18,0XC2,0X18,0XC2,0X20,0XE1,0X93,0XEA,0X79,0XA0,
+0XA2,0X81,0XB3,0X60,0X62,0XA7,0XDE,0X21,0X04,0XC8,0X21,0X04,0X8D,0X18,0XE3,0X81,
+0X21,0X04,0X37,0X20,0XE3,0X41,0X82,0XAB,0X43,0XE5,0XC8,0X72,0X21,0XDD,0XE9,0X62,
+0X01,0XC5,0X26,0X62,0X02,0X7A,0XC3,0X62,0X04,0X6A,0X22,0X62,0X22,0X72,0X80,0XAB,
+0X84,0XDC,0X03,0XDC,0X03,0XC3,0X21,0XC3,0XC4,0XCC,0X04,0XCC,0X63,0X92,0X00,0X81,
+0X60,0XB3,0X03,0XC3,0XA5,0X89,0XC0,0X81,0XA0,0XED,0X65,0XB3,0X41,0XB3,0X22,0XC3,
+0XE2,0XBB,0X62,0XBB,0XA3,0XAB,0X21,0XC4,0X04,0XAB,0X22,0XCB,0XC1,0XBA,0XE1,0XC4,
+0X84,0X6A,0X40,0XA2,0XC2,0XBB,0X62,0X49,0X81,0X10,0XA2,0X18,0XC2,0X29,0X42,0X21,
+0X02,0X29,0X22,0X18,0XC2,0X18,0XC2,0X31,0X43,0XB5,0X0F,0X8A,0X22,0XAA,0XA0,0XAB,
+0X20,0X62,0XA7,0XDE,0X21,0X04,0XC8,0X21,0X04,0X8D,0X18,0XE3,0X81,0X21,0X04,0X37,
+0X20,0XE3,0X41,0X62,0XA2,0X83,0XDD,0XA9,0X61,0X80,0XCD,0X67,0X51,0X60,0XBD,0X64,
+0X51,0X60,0XA4,0X23,0X7A,0X61,0XAC,0X02,0X72,0X82,0X82,0XA1,0X7A,0X02,0XAA,0XC2,
+0XBA,0XE0,0XB2,0XC0,0XB3,0X41,0XC3,0XE3,0XCC,0X43,0X92,0X20,0X81,0XA0,0XAA,0XE2,
+0XC3,0XC4,0X89,0XE0,0X81,0XA0,0XF5,0X86,0XBB,0X63,0XAA,0XE0,0XAB,0X00,0XCC,0X42,
+0X9A,0X60,0XA2,0XC1,0XA2,0XC1,0X9A,0XA0,0XC3,0X81,0XBB,0X21,0X93,0X42,0X59,0X80,
+0XC3,0XE3,0XC3,0X41,0X30,0XE1,0X39,0XE3,0X21,0X22,0X29,0X23,0X20,0XE2,0X20,0XE2,
+0X18,0XC2,0X18,0XA2,0X31,0XA2,0XD5,0X91,0X92,0XE3,0XD4,0X43,0XA3,0X20,0X52,0X86,
+0XDE,0X21,0X04,0XC9,0X21,0X04,0X8C,0X18,0XE3,0X81,0X21,0X04,0X37,0X18,0XC3,0X41,
+0X62,0X92,0X21,0XCD,0X27,0X69,0XC0,0XCD,0X87,0X61,0XA0,0XBD,0X27,0X59,0XA0,0XBD,
+0X07,0X72,0X40,0XAC,0X02,0X7A,0XC2,0X93,0X41,0X71,0X80,0XB2,0XE2,0XC3,0X20,0XC3,
+0X20,0XC3,0XA2,0XCC,0X03,0XD4,0X63,0X92,0X20,0X89,0XA0,0XA2,0XC1,0XC3,0XC4,0X8A,
+0X00,0X81,0XC0,0XED,0X26,0XC3,0XC5,0XD4,0X02,0XD4,0X83,0XC4,0X01,0XE4,0XC5,0XA2,
+0XC0,0XD4,0X63,0XBB,0XA3,0XDC,0X42,0XB2,0XC1,0X9B,0X42,0X59,0XA0,0XD5,0X06,0XC3,
+0X60,0X40,0XC0,0X18,0X81,0X10,0XA2,0X08,0XA2,0X18,0XC3,0X18,0XC2,0X10,0XC2,0X18,
+0XC3,0X28,0XC1,0X69,0XA0,0XDC,0XE5,0XE4,0XE3,0XA3,0X20,0X4A,0X44,0XDE,0X21,0X04,
+0XCA,0X21,0X04,0X8B,0X18,0XE3,0X81,0X21,0X04,0X37,0X20,0XE3,0X41,0X82,0X9A,0X41,
+0XF7,0X0B,0X61,0X60,0XDD,0XC6,0X69,0XA2,0XBC,0XC5,0X69,0XE2,0XA4,0X02,0X72,0X61,
+0XA4,0X01,0X6A,0X60,0X82,0XC0,0X79,0XC1,0XBB,0X44,0XBB,0X02,0XC3,0X41,0XCC,0X04,
+0XCC,0X03,0XD4,0X84,0X9A,0X40,0X89,0XA0,0XA2,0XA1,0XCB,0XE4,0X92,0X20,0X81,0XC0,
+0XF5,0X26,0XCC,0X05,0X9A,0X21,0XB3,0X40,0XDC,0XA4,0XA2,0X80,0XCB,0XE3,0XA2,0XE1,
+0X92,0X60,0XDC,0X22,0XBA,0XA0,0X8A,0X60,0X7A,0X40,0XC3,0X42,0XD3,0XC1,0XD3,0XC0,
+0XB2,0XA2,0X9A,0XA1,0X92,0XE4,0X7A,0X84,0X6A,0X43,0X59,0XC2,0X49,0X60,0X7A,0X61,
+0X89,0XC0,0XE4,0X82,0XDC,0X82,0XA3,0X40,0X52,0X67,0XDE,0X21,0X04,0XCC,0X21,0X04,
+0X89,0X18,0XE3,0X81,0X21,0X04,0X37,0X20,0XE4,0X39,0X41,0XA2,0X20,0XA3,0X63,0X7A,
+0X02,0XAC,0X06,0X69,0XA0,0XA3,0XE4,0X59,0X60,0X93,0X63,0X82,0X62,0XAC,0X04,0X7A,
+0X80,0XA3,0X02,0X71,0X60,0XC3,0X63,0XBB,0X00,0XBB,0X00,0XCC,0X04,0XC3,0XC2,0XD4,
+0X84,0XA2,0X61,0X89,0XC0,0XAA,0XC2,0XCB,0XE4,0X92,0X20,0X81,0XC0,0XED,0X26,0XCC,
+0X06,0X89,0XC0,0X9A,0X40,0XE4,0XC5,0XBB,0X81,0X92,0X40,0X81,0XC0,0XB3,0X41,0XDC,
+0X23,0XCB,0X20,0XD3,0XA2,0XCB,0XC0,0XC3,0X40,0XB3,0X60,0X82,0X40,0X69,0XC0,0X8A,
+0XA0,0X92,0XA0,0XDC,0X83,0XBB,0X81,0XCC,0XA1,0XA2,0XE0,0XCB,0X60,0XDC,0X43,0XE4,
+0X62,0XDC,0X82,0X9B,0X00,0X4A,0X06,0XDE,0X21,0X04,0XCC,0X21,0X04,0X8B,0X18,0XE3,
+0X81,0X21,0X04,0X35,0XCB,0XC4,0XBA,0XC1,0XBB,0X22,0XC3,0X43,0XC3,0X43,0XBB,0X41,
+0XB3,0X03,0XB3,0X03,0XB2,0XE2,0XA2,0X80,0XAA,0X80,0XBB,0X01,0X89,0XE0,0XC3,0XA3,
+0XCB,0X20,0XBB,0X00,0XC3,0XA0,0XB3,0X62,0XDC,0X85,0XA2,0XA1,0X89,0XC0,0XA2,0X81,
+0XCC,0X06,0X92,0X40,0X81,0XE0,0XE4,0XE5,0XC3,0XA5,0X89,0XC0,0X89,0XC0,0XCB,0XC4,
+0XCC,0X22,0XAB,0X01,0X81,0XA0,0XC3,0XE2,0XD4,0X44,0XFD,0X66,0XD3,0XE1,0XDB,0XE2,
+0XAA,0X80,0XA2,0XE1,0XB3,0XC2,0XAB,0X80,0X8B,0X41,0X92,0X60,0XED,0XE5,0XD3,0XA0,
+0XD3,0XC0,0XF5,0X64,0XE4,0X00,0XDC,0X00,0XE4,0X42,0XDC,0X62,0X9B,0X01,0X39,0XC5,
+0XDE,0X21,0X04,0XD4,0X21,0X04,0X81,0X18,0XE3,0X83,0X21,0X04,0X35,0X51,0XE1,0XBC,
+0X23,0XCB,0XE3,0XD3,0XE3,0XCB,0XA2,0XC3,0XA2,0XCB,0X82,0XCB,0X63,0XCB,0X83,0XBB,
+0X20,0XD3,0X62,0XCB,0X42,0XC3,0X41,0XCB,0X20,0XC3,0X00,0XBB,0X00,0XCC,0X03,0XB3,
+0X61,0XD4,0X64,0XA2,0XC1,0X89,0XC0,0XA2,0X82,0XCC,0X05,0X92,0X40,0X8A,0X00,0XE4,
+0XC4,0XCC,0X06,0X92,0X00,0X89,0XE0,0XC3,0X85,0XBB,0X63,0X89,0XE0,0X81,0XE0,0XCC,
+0X23,0XD4,0X82,0X81,0XC0,0X8A,0X40,0XA2,0XE2,0XAB,0X23,0XC3,0XA4,0XAB,0X22,0XB3,
+0X63,0XB3,0X83,0XBB,0XA2,0XDD,0X64,0XE4,0XA2,0XFE,0X06,0XE4,0XE1,0XE4,0X61,0XD3,
+0XC1,0XDC,0X21,0XD4,0X61,0XB3,0XE3,0X31,0X45,0XDE,0X21,0X04,0XDC,0X21,0X04,0X81,
+0X29,0X21,0X81,0X29,0X23,0X81,0X29,0X02,0X81,0X28,0XE2,0X81,0X31,0X01,0X29,0X30,
+0XE1,0X49,0XA1,0XAB,0XE5,0XCC,0X22,0XCC,0X81,0XCC,0X21,0XE4,0XE3,0XD4,0X82,0XCC,
+0X41,0XD4,0X61,0XDC,0XC2,0XD4,0X81,0XC4,0X00,0XDC,0X82,0XDC,0XA2,0XD4,0X41,0XCC,
+0X00,0XD4,0X42,0XD4,0X42,0XCC,0X01,0XC3,0XE0,0XC4,0X00,0XC3,0XE0,0XBB,0XA1,0XAB,
+0X60,0XCC,0X23,0XA3,0X42,0X8A,0X80,0XBB,0XE2,0XB3,0XA1,0XBC,0X22,0XAB,0X82,0XA3,
+0X61,0XA3,0X61,0XA3,0X42,0XAB,0X83,0XBB,0XC2,0XBB,0XE2,0XCC,0X62,0XCC,0XA6,0X6B,
+0X06,0X21,0X05,0XDE,0X21,0X04,0XDE,0X21,0X04,0X81,0X19,0X04,0X81,0X21,0X04,0X81,
+0X19,0X04,0X81,0X18,0XE4,0X10,0X21,0X03,0X28,0XE4,0X20,0XE3,0XA3,0XA3,0XD4,0XA3,
+0XD4,0X82,0XE5,0X03,0XDC,0XE2,0XDC,0XE1,0XDC,0XE0,0XE4,0XE0,0XDC,0XE0,0XDC,0XA0,
+0XD4,0X80,0XDC,0XC1,0XDC,0XC0,0XD4,0X80,0X83,0XDC,0XA0,0X0A,0XDC,0XC0,0XD4,0X80,
+0XDC,0XC1,0XD4,0X60,0XD4,0X81,0XCC,0X21,0XCC,0X01,0XCC,0X41,0XCC,0X82,0X93,0X62,
+0X39,0X85,0X82,0X29,0X03,0X82,0X29,0X02,0X02,0X20,0XC2,0X29,0X24,0X29,0X04,0XDF,
+0X21,0X04,0XE7,0X21,0X04,0X1E,0X21,0X03,0X20,0XE3,0X6A,0XC4,0XD4,0XE2,0XD4,0X81,
+0XED,0X43,0XE5,0X23,0XDD,0X01,0XE5,0X01,0XDC,0XE0,0XE4,0XE1,0XD4,0X60,0XDC,0X81,
+0XE4,0XE2,0XE4,0XE1,0XE4,0XC1,0XDC,0XA0,0XE4,0XC1,0XE4,0XC1,0XE5,0X00,0XE4,0XE1,
+0XDC,0XA0,0XE5,0X00,0XD4,0X80,0XDC,0XA1,0XD4,0X81,0XD4,0X60,0XD4,0X60,0X9B,0XC4,
+0X28,0XE3,0X19,0X04,0XE8,0X21,0X04,0XE7,0X21,0X04,0X0C,0X21,0X03,0X20,0XE3,0X73,
+0X25,0XD5,0X23,0XD4,0XC1,0XED,0X83,0XE5,0X42,0XDD,0X21,0XE5,0X21,0XDD,0X00,0XE5,
+0X21,0XDC,0XE1,0XE4,0XE1,0X82,0XE5,0X01,0X0D,0XDC,0XE0,0XE5,0X01,0XE5,0X01,0XE5,
+0X20,0XE5,0X21,0XDC,0XE0,0XE5,0X40,0XDC,0XA0,0XDC,0XC1,0XD4,0XA0,0XDC,0XA1,0XD4,
+0XC1,0X52,0X04,0X21,0X03,0XE9,0X21,0X04,0XE8,0X21,0X04,0X15,0X20,0XE3,0X83,0X86,
+0XD5,0X63,0XD4,0XC1,0XED,0X82,0XE5,0X62,0XE5,0X41,0XE5,0X41,0XE5,0X20,0XE5,0X21,
+0XDD,0X00,0XDD,0X01,0XE5,0X21,0XE5,0X41,0XE5,0X20,0XDD,0X00,0XDD,0X00,0XE5,0X20,
+0XE5,0X80,0XE5,0X41,0XE5,0X41,0XE5,0X60,0X82,0XDC,0XE1,0X02,0XDC,0XC1,0XCC,0XE0,
+0X39,0XA3,0XEA,0X21,0X04,0XE8,0X21,0X04,0X05,0X21,0X03,0X8B,0XC7,0XE5,0XC4,0XD5,
+0X01,0XED,0X83,0XE5,0X62,0X83,0XE5,0X41,0X01,0XE5,0X20,0XE5,0X21,0X82,0XE5,0X41,
+0X81,0XE5,0X20,0X0A,0XE5,0X41,0XE5,0X81,0XED,0X61,0XE5,0X61,0XE5,0X60,0XE5,0X01,
+0XE5,0X01,0XDC,0XE0,0XE5,0X01,0XDD,0X40,0X39,0XC3,0XEA,0X21,0X04,0XE8,0X21,0X04,
+0X0D,0X29,0X03,0X94,0X28,0XE5,0XA2,0XDD,0X01,0XED,0XA2,0XE5,0X61,0XE5,0X61,0XE5,
+0X41,0XE5,0X41,0XE5,0X61,0XE5,0X41,0XDD,0X00,0XE5,0X41,0XED,0X61,0X82,0XE5,0X41,
+0X0A,0XE5,0X61,0XED,0XA0,0XE5,0X61,0XE5,0X40,0XE5,0X60,0XDD,0X21,0XDD,0X21,0XDD,
+0X00,0XE5,0X20,0XDD,0X40,0X39,0XC3,0XEA,0X21,0X04,0XE8,0X21,0X04,0X05,0X29,0X03,
+0X9C,0X68,0XE5,0XC3,0XDD,0X01,0XED,0XA3,0XE5,0X82,0X84,0XE5,0X61,0X10,0XDD,0X20,
+0XE5,0X62,0XE5,0X61,0XE5,0X61,0XE5,0X41,0XE5,0X61,0XE5,0X61,0XED,0XA0,0XE5,0X61,
+0XE5,0X40,0XE5,0X60,0XDD,0X21,0XDD,0X21,0XDD,0X00,0XE5,0X41,0XDD,0X60,0X39,0XC3,
+0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X21,0X03,0XA4,0XC9,0XED,0XE3,0XD5,0X00,0XED,
+0XA3,0XED,0XA2,0XE5,0X61,0XE5,0X61,0XE5,0X81,0XED,0X81,0XE5,0X41,0XE5,0X41,0XE5,
+0X82,0XE5,0X81,0XE5,0X61,0XE5,0X40,0XE5,0X61,0XE5,0X61,0XED,0XA0,0XED,0X61,0XE5,
+0X60,0XE5,0X80,0XE5,0X21,0XE5,0X41,0XE5,0X20,0XE5,0X41,0XE5,0XA1,0X41,0XC4,0XEA,
+0X21,0X04,0XE8,0X21,0X04,0X1B,0X21,0X03,0XA4,0XE9,0XED,0XE3,0XD5,0X00,0XED,0XC3,
+0XED,0XA2,0XE5,0X81,0XE5,0X61,0XE5,0X81,0XED,0X81,0XE5,0X41,0XE5,0X41,0XED,0X82,
+0XE5,0X81,0XE5,0X61,0XE5,0X40,0XE5,0X61,0XE5,0X61,0XE5,0X80,0XED,0X61,0XE5,0X60,
+0XE5,0X80,0XE5,0X21,0XE5,0X41,0XE5,0X20,0XE5,0X41,0XE5,0XC1,0X39,0XA4,0XEA,0X21,
+0X04,0XE8,0X21,0X04,0X1B,0X28,0XE5,0XAD,0X0B,0XEE,0X03,0XD5,0X00,0XED,0XA3,0XED,
+0XC3,0XE5,0X81,0XE5,0X61,0XED,0X81,0XED,0X81,0XE5,0X61,0XDD,0X41,0XED,0X81,0XE5,
+0X81,0XE5,0X40,0XE5,0X40,0XE5,0X61,0XE5,0X81,0XED,0XA1,0XED,0X61,0XE5,0X80,0XE5,
+0X60,0XE5,0X20,0XE5,0X41,0XDD,0X20,0XE5,0X41,0XE5,0XA2,0X39,0X86,0XEA,0X21,0X04,
+0XE8,0X21,0X04,0X1B,0X28,0XE5,0XB5,0X2C,0XEE,0X03,0XD5,0X00,0XED,0XA3,0XED,0XC3,
+0XED,0X82,0XE5,0X61,0XED,0XA2,0XED,0XA2,0XE5,0X61,0XDD,0X41,0XE5,0X81,0XED,0X81,
+0XE5,0X40,0XE5,0X40,0XE5,0X61,0XE5,0X81,0XED,0XA1,0XED,0X61,0XE5,0X80,0XE5,0X60,
+0XE5,0X20,0XE5,0X41,0XDD,0X20,0XE5,0X41,0XE5,0XA3,0X31,0X65,0XEA,0X21,0X04,0XE8,
+0X21,0X04,0X1B,0X20,0XC3,0XAD,0X2A,0XEE,0X24,0XDD,0X41,0XED,0XA2,0XF5,0XC3,0XE5,
+0X82,0XDD,0X40,0XE5,0X81,0XED,0XA2,0XE5,0X61,0XDD,0X20,0XE5,0X81,0XED,0X82,0XE5,
+0X40,0XE5,0X40,0XE5,0X81,0XED,0X81,0XED,0XA1,0XE5,0X81,0XE5,0X80,0XE5,0X60,0XE5,
+0X20,0XE5,0X41,0XE5,0X21,0XE5,0X61,0XE5,0XA3,0X31,0X85,0XEA,0X21,0X04,0XE8,0X21,
+0X04,0X1B,0X20,0XE3,0XB5,0X49,0XEE,0X24,0XDD,0X41,0XED,0X82,0XF5,0XC3,0XE5,0X82,
+0XDD,0X40,0XE5,0X81,0XED,0XA2,0XE5,0X61,0XDD,0X20,0XE5,0X81,0XED,0X82,0XE5,0X40,
+0XE5,0X40,0XE5,0X81,0XED,0X81,0XED,0XA1,0XE5,0X81,0XE5,0X80,0XE5,0X60,0XE5,0X21,
+0XE5,0X41,0XE5,0X21,0XE5,0X61,0XE5,0XC3,0X31,0X65,0XEA,0X21,0X04,0XE8,0X21,0X04,
+0X1B,0X20,0XE3,0XB5,0X69,0XF6,0X44,0XDD,0X42,0XED,0X41,0XF5,0XE3,0XE5,0X82,0XDD,
+0X40,0XE5,0X81,0XED,0XA2,0XE5,0X61,0XDD,0X20,0XE5,0X61,0XED,0X82,0XE5,0X61,0XE5,
+0X40,0XE5,0X61,0XE5,0X81,0XED,0XA1,0XED,0X81,0XE5,0X60,0XE5,0X60,0XDD,0X21,0XE5,
+0X41,0XE5,0X41,0XDD,0X62,0XE5,0XE2,0X31,0XA4,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,
+0X20,0XE2,0XB5,0X69,0XF6,0X44,0XDD,0X42,0XED,0X41,0XF5,0XE3,0XE5,0X82,0XDD,0X41,
+0XE5,0X81,0XED,0XA2,0XE5,0X41,0XDD,0X20,0XE5,0X61,0XED,0X82,0XE5,0X61,0XE5,0X40,
+0XE5,0X61,0XE5,0X81,0XED,0XA1,0XED,0XA2,0XE5,0X60,0XE5,0X60,0XDD,0X21,0XE5,0X41,
+0XE5,0X41,0XE5,0X82,0XE5,0XE3,0X31,0X85,0XEA,0X21,0X04,0XE7,0X21,0X04,0X1C,0X21,
+0X03,0X21,0X02,0XC5,0XA9,0XF6,0X44,0XDD,0X62,0XED,0X41,0XED,0XC3,0XED,0XC2,0XDD,
+0X41,0XE5,0X61,0XE5,0X81,0XE5,0X61,0XDD,0X00,0XE5,0X61,0XED,0X82,0XE5,0X41,0XE5,
+0X41,0XE5,0X61,0XE5,0X61,0XED,0XA1,0XED,0X81,0XE5,0X60,0XE5,0X61,0XDD,0X21,0XE5,
+0X42,0XE5,0X62,0XE5,0X82,0XE6,0X03,0X31,0X85,0XEA,0X21,0X04,0XE7,0X21,0X04,0X0E,
+0X21,0X03,0X20,0XE2,0XC5,0XAA,0XF6,0X64,0XDD,0X62,0XED,0X41,0XED,0XC3,0XED,0XC2,
+0XDD,0X41,0XE5,0X61,0XE5,0X81,0XE5,0X41,0XDD,0X00,0XE5,0X61,0XED,0X82,0X82,0XE5,
+0X41,0X0A,0XE5,0X61,0XED,0XA0,0XE5,0X81,0XE5,0X60,0XE5,0X60,0XDD,0X21,0XE5,0X41,
+0XE5,0X41,0XE5,0X82,0XE5,0XE3,0X29,0X44,0XEA,0X21,0X04,0XE7,0X21,0X04,0X1C,0X21,
+0X03,0X20,0XE2,0XC5,0XCA,0XF6,0X64,0XDD,0X62,0XED,0X21,0XED,0XC3,0XED,0XC2,0XDD,
+0X41,0XE5,0X61,0XE5,0X81,0XE5,0X41,0XDD,0X00,0XE5,0X41,0XE5,0X81,0XE5,0X41,0XE5,
+0X41,0XE5,0X40,0XE5,0X61,0XED,0XA0,0XE5,0X81,0XE5,0X60,0XE5,0X40,0XDD,0X21,0XDD,
+0X21,0XE5,0X41,0XE5,0X62,0XE6,0X03,0X21,0X23,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,
+0X20,0XE2,0XCD,0XEA,0XF6,0X23,0XD5,0X00,0XDC,0XC1,0XED,0X83,0XE5,0X63,0XD4,0XC0,
+0XDD,0X00,0XED,0X62,0XE5,0X42,0XCC,0XA0,0XDC,0XE0,0XED,0X63,0XDD,0X00,0XDC,0XE0,
+0XE5,0X21,0XE5,0X41,0XE5,0X41,0XED,0X82,0XE5,0X21,0XE5,0X21,0XD4,0XE1,0XDC,0XE1,
+0XDD,0X22,0XDD,0X61,0XE6,0X04,0X18,0XE2,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X20,
+0XE2,0XCD,0XEA,0XF6,0X24,0XD4,0XE1,0XDC,0XA1,0XF5,0XA4,0XED,0X63,0XD4,0XA0,0XDC,
+0XE1,0XED,0X63,0XE5,0X22,0XC4,0X60,0XD4,0XC1,0XF5,0X84,0XDC,0XC1,0XD4,0X80,0XDC,
+0XE2,0XE5,0X02,0XDC,0XC0,0XED,0X63,0XD4,0XA0,0XDD,0X01,0XCC,0X60,0XD4,0X81,0XDD,
+0X02,0XE5,0X62,0XD5,0X62,0X18,0XE3,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X21,0X03,
+0XD6,0X0A,0XEE,0X44,0XD4,0XA2,0XD4,0X61,0XE5,0X23,0XDD,0X23,0XCC,0X40,0XDC,0X60,
+0XED,0X43,0XE5,0X42,0XBC,0X00,0XD4,0X81,0XED,0X64,0XDC,0XC1,0XD4,0X81,0XDC,0XC1,
+0XDD,0X01,0XDC,0XC1,0XE5,0X83,0XE4,0XC1,0XE5,0X02,0XCC,0X80,0XCC,0X40,0XED,0X22,
+0XE5,0X42,0XD5,0X43,0X18,0XE2,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X21,0X23,0X8B,
+0XA7,0XFE,0XED,0XB4,0X02,0XA2,0XE0,0XD4,0XA6,0XF5,0XCB,0XAB,0X41,0XAA,0XC0,0XED,
+0X48,0XF5,0XEA,0X9A,0XE0,0XAB,0X40,0XFD,0XCA,0XE4,0XE7,0X9A,0XE0,0XC4,0X03,0XF5,
+0XC9,0XAB,0X40,0XF6,0X07,0XAB,0X40,0XED,0X68,0XD4,0X84,0XBB,0XA0,0XDD,0X05,0XED,
+0XA6,0XC4,0XC5,0X18,0XE3,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X21,0X03,0X31,0X64,
+0XDD,0XC7,0XA3,0X01,0X9A,0X62,0XC3,0X84,0XD4,0X45,0X8A,0X00,0X91,0XC0,0XCB,0XE5,
+0XCC,0X24,0X71,0X60,0X89,0XC0,0XE4,0XC8,0XAA,0XA1,0X81,0X60,0XA2,0XA0,0XDC,0X64,
+0XB3,0X62,0XB3,0X81,0XCC,0X02,0XD4,0X85,0XA3,0X01,0X8A,0X00,0XC3,0X85,0XE5,0X29,
+0X40,0XA0,0X18,0XE4,0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X18,0XE3,0X31,0X64,0XE5,
+0XE8,0XAA,0XE2,0X89,0XC0,0XC3,0X63,0XDC,0X86,0X92,0X20,0X89,0XA0,0XC3,0XA5,0XD4,
+0X46,0X79,0X40,0X89,0XA0,0XE4,0XA8,0XAA,0XC2,0X81,0X80,0X92,0X20,0XD4,0X44,0XB3,
+0X22,0X91,0XE0,0XB3,0X42,0XBB,0X81,0XA2,0XA0,0X81,0X80,0XAA,0XE3,0XCC,0X65,0X30,
+0XA1,0X18,0XE4,0XEA,0X21,0X04,0XE9,0X21,0X04,0X1A,0X29,0X43,0XEE,0X48,0XBB,0XA2,
+0XA2,0X81,0XCC,0X24,0XE5,0X25,0XAB,0X21,0X91,0XE0,0XCB,0XE4,0XDC,0XC6,0X8A,0X20,
+0X81,0XE0,0XE4,0XC7,0XC3,0XC5,0X81,0XA0,0X92,0X40,0XD4,0X64,0XBB,0X84,0X89,0XA0,
+0XAB,0X40,0XC4,0X02,0XAB,0X02,0X81,0X80,0XAA,0XE2,0XD4,0XA5,0X28,0XA1,0X18,0XE3,
+0XEA,0X21,0X04,0XE7,0X21,0X04,0X81,0X18,0XE3,0X1A,0X31,0XA3,0XFE,0XEC,0XBC,0X46,
+0XA3,0X03,0XE5,0X4A,0XE5,0XE8,0XAB,0XC4,0XA2,0XE2,0XFE,0X0C,0XF5,0XAA,0X9B,0X21,
+0XAB,0X42,0XFE,0X2C,0XE5,0X08,0X8A,0X20,0XCC,0X84,0XED,0XA7,0XC4,0X25,0X9A,0X80,
+0XC4,0X22,0XED,0XA5,0XBB,0XC2,0X9A,0XA1,0XE5,0X07,0XDD,0X03,0X30,0XE2,0X18,0XE3,
+0XEA,0X21,0X04,0XE8,0X21,0X04,0X1A,0X18,0XE4,0X29,0X43,0XC6,0X0F,0XBD,0X0C,0X9B,
+0XA5,0XAC,0X89,0XBD,0X8D,0XB4,0XCA,0X93,0X64,0XA4,0X69,0XD5,0X8E,0XA4,0X48,0X83,
+0X24,0XBC,0XEA,0XCD,0X6C,0X9B,0XA6,0X93,0X86,0XC5,0X0B,0XBC,0XCA,0X93,0X86,0X9C,
+0X08,0XBD,0X2B,0XC4,0XCB,0X8B,0X25,0XB4,0X68,0XC5,0X2C,0X31,0X24,0XEB,0X21,0X04,
+0XE9,0X21,0X04,0X1A,0X29,0X43,0XBD,0XED,0XB4,0XCA,0X93,0X66,0XAC,0X6A,0XC5,0XAD,
+0XB4,0XCA,0X93,0X85,0XA4,0X49,0XCD,0X8E,0X9C,0X27,0X8B,0X65,0XBC,0XEA,0XD5,0X6D,
+0X93,0X65,0X8B,0XA6,0XAC,0XCA,0XAC,0XAA,0X8B,0X86,0X9C,0X08,0XBD,0X2D,0XBD,0X0C,
+0X93,0X86,0X93,0XC6,0XA4,0X6A,0X39,0X86,0X18,0XE3,0XEA,0X21,0X04,0XE8,0X21,0X04,
+0X1B,0X18,0XE3,0X29,0X42,0XB5,0XAE,0XBD,0X0C,0X93,0X66,0X9C,0X08,0XC5,0XAE,0XAC,
+0X8A,0X83,0X45,0XA4,0X49,0XBD,0X8E,0XA4,0X89,0X83,0X24,0XB4,0XCB,0XC5,0X4D,0X93,
+0XA7,0X83,0X25,0XAC,0XAA,0XB4,0XCB,0X8B,0X87,0X93,0XC6,0XB5,0X2C,0XB4,0XAA,0X8B,
+0X65,0X93,0XC7,0XAC,0X8B,0X31,0X65,0X19,0X04,0XEA,0X21,0X04,0XE9,0X21,0X04,0X1A,
+0X29,0X42,0XB5,0X6D,0XC5,0X2C,0X93,0X87,0X9C,0X07,0XBD,0X4C,0XB4,0XEB,0X8B,0X45,
+0X9C,0X29,0XBD,0X4D,0X9C,0X28,0X83,0X24,0XBC,0XEB,0XBD,0X2C,0X9B,0XC7,0X83,0X45,
+0XA4,0X6A,0XB4,0XCB,0X8B,0X87,0X8B,0X85,0XBD,0X2C,0XAC,0X8A,0X8B,0X65,0X93,0XA6,
+0XA4,0X6A,0X31,0X65,0X19,0X04,0XEA,0X21,0X04,0XE9,0X21,0X04,0X1A,0X29,0X42,0XBD,
+0XEE,0XBD,0X0D,0X82,0XE4,0X9B,0XC7,0XCD,0XCF,0XB4,0XEB,0X8B,0X05,0X9C,0X08,0XC5,
+0XAF,0XAC,0X8B,0X7B,0X24,0XBD,0X0C,0XD5,0XAF,0X9C,0X08,0X83,0X25,0XCD,0X6E,0XC5,
+0X4D,0X93,0XA7,0X93,0XC7,0XBD,0X4D,0XBC,0XEC,0X93,0X86,0X9C,0X08,0XC5,0X6E,0X39,
+0XA6,0X18,0XE3,0XEA,0X21,0X04,0XE9,0X21,0X04,0X1A,0X29,0X43,0XB5,0X8D,0XBC,0XEC,
+0X8B,0X25,0X93,0XA7,0XBD,0X2D,0XA4,0X8A,0X83,0X04,0X93,0XC7,0XB5,0X2D,0XA4,0X6A,
+0X7B,0X04,0XAC,0X6A,0XBD,0X2D,0X9C,0X08,0X7A,0XE4,0XAC,0X6A,0XB4,0XEC,0X93,0X87,
+0X8B,0X66,0XB5,0X0C,0XB4,0XAB,0X93,0X65,0X8B,0X86,0XA4,0X8B,0X39,0XA6,0X18,0XE3,
+0XEA,0X21,0X04,0XE8,0X21,0X04,0X1B,0X18,0XE3,0X29,0X43,0XC5,0XCF,0XC5,0X0D,0X82,
+0XE4,0X8B,0X66,0XC5,0X4D,0XBC,0XCB,0X83,0X04,0X8B,0XA6,0XB4,0XEC,0XAC,0X4A,0X7A,
+0XC3,0XAC,0X4A,0XC5,0X2D,0X9B,0XE8,0X7A,0XE4,0XAC,0X8A,0XB4,0XAB,0X93,0XA7,0X8B,
+0X85,0XBD,0X0B,0XBC,0XEC,0X8B,0X65,0X93,0XE7,0XAC,0XAB,0X42,0X08,0X21,0X24,0XEA,
+0X21,0X04,0XE8,0X21,0X04,0X1B,0X18,0XE3,0X39,0XA6,0X29,0X24,0X29,0X45,0X39,0X65,
+0X29,0X44,0X29,0X65,0X39,0XA6,0X31,0X45,0X29,0X65,0X3A,0X07,0X49,0XE7,0X29,0X03,
+0X41,0XE6,0X5A,0XA8,0X41,0XC5,0X31,0X22,0X6A,0XC9,0X73,0X28,0X52,0X04,0X49,0XC2,
+0X83,0XA8,0X93,0XEA,0X62,0X63,0X6A,0X84,0X9C,0X4C,0X4A,0X29,0X21,0X24,0XEA,0X21,
+0X04,0XEA,0X21,0X04,0X00,0X21,0X24,0X82,0X21,0X04,0X81,0X21,0X24,0X84,0X21,0X04,
+0X02,0X20,0XE4,0X21,0X03,0X21,0X03,0X83,0X21,0X04,0X07,0X21,0X25,0X21,0X04,0X18,
+0XE4,0X21,0X05,0X29,0X46,0X21,0X05,0X18,0XE3,0X21,0X24,0XEA,0X21,0X04,0XF0,0X21,
+0X04,0X04,0X20,0XE3,0X21,0X04,0X20,0XE3,0X20,0XE3,0X20,0XE4,0X82,0X21,0X04,0X81,
+0X20,0XE3,0X81,0X21,0X03,0X81,0X20,0XE4,0X04,0X18,0XC3,0X20,0XE4,0X20,0XE4,0X18,
+0XC4,0X18,0XE3,0XEB,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XEA,0X21,0X04,0X99,
+0X18,0XE3,0XEA,0X21,0X04,0XE9,0X21,0X04,0X9F,0X18,0XE3,0XE5,0X21,0X04,0XE4,0X21,
+0X04,0X89,0X18,0XE3,0X85,0X18,0XC3,0X94,0X18,0XE3,0XE5,0X21,0X04,0XE3,0X21,0X04,
+0X86,0X18,0XE3,0X99,0X18,0XC3,0X86,0X18,0XE3,0XE3,0X21,0X04,0XE3,0X21,0X04,0X83,
+0X18,0XE3,0X84,0X18,0XC3,0X95,0X10,0XA2,0X83,0X18,0XC3,0X85,0X18,0XE3,0XE2,0X21,
+0X04,0XE2,0X21,0X04,0X83,0X18,0XE3,0X82,0X18,0XC3,0X8A,0X10,0XA2,0X85,0X10,0X82,
+0X88,0X10,0XA2,0X83,0X18,0XC3,0X85,0X18,0XE3,0XE1,0X21,0X04,0XE2,0X21,0X04,0X83,
+0X18,0XE3,0X82,0X18,0XC3,0X84,0X10,0XA2,0X93,0X10,0X82,0X81,0X10,0XA2,0X83,0X18,
+0XC3,0X85,0X18,0XE3,0XE0,0X21,0X04,0XE1,0X21,0X04,0X84,0X18,0XE3,0X82,0X18,0XC3,
+0X84,0X10,0XA2,0X91,0X10,0X82,0X83,0X10,0XA2,0X84,0X18,0XC3,0X83,0X18,0XE3,0XE1,
+0X21,0X04,0XE1,0X21,0X04,0X84,0X18,0XE3,0X82,0X18,0XC3,0X84,0X10,0XA2,0X91,0X10,
+0X82,0X83,0X10,0XA2,0X84,0X18,0XC3,0X83,0X18,0XE3,0XE1,0X21,0X04,0XE3,0X21,0X04,
+0X82,0X18,0XE3,0X85,0X18,0XC3,0X97,0X10,0XA2,0X82,0X18,0XC3,0X85,0X18,0XE3,0XE1,
+0X21,0X04,0XE4,0X21,0X04,0X83,0X18,0XE3,0X85,0X18,0XC3,0X81,0X10,0XA2,0X81,0X18,
+0XC3,0X89,0X10,0XA2,0X88,0X18,0XC3,0X01,0X18,0XE3,0X18,0XC3,0X85,0X18,0XE3,0XE1,
+0X21,0X04,0XE4,0X21,0X04,0X87,0X18,0XE3,0X95,0X18,0XC3,0X81,0X18,0XE3,0X00,0X18,
+0XC3,0X85,0X18,0XE3,0XE3,0X21,0X04,0XE4,0X21,0X04,0X97,0X18,0XE3,0X81,0X18,0XC3,
+0X8B,0X18,0XE3,0XE4,0X21,0X04,0XEA,0X21,0X04,0X93,0X18,0XE3,0X81,0X21,0X04,0X85,
+0X18,0XE3,0XE8,0X21,0X04,0XEB,0X21,0X04,0X00,0X18,0XE3,0X85,0X21,0X04,0X89,0X18,
+0XE3,0X81,0X21,0X04,0X81,0X18,0XE3,0X83,0X21,0X04,0X81,0X18,0XE3,0XE8,0X21,0X04,
+0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,0XFF,0X21,0X04,0XEF,
+0X21,0X04,0XFF,0X21,0X04,0XEF,0X21,0X04,
+};
+
+const unsigned char gImage_logo_rle[11201] = { // 240x220 RGB565,ԭ105608ֽ
+0X52,0X4C,0X45,0X10,0X00,0XF0,0X00,0XDC,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,
+0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,
+0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X08,0X85,
+0XED,0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,0X66,0XED,0X00,0X67,0X8B,
+0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,0X66,0XED,0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,
+0XFF,0X02,0X00,0X66,0X00,0X67,0X00,0X67,0XE6,0X00,0X47,0X01,0X00,0X67,0X00,0X88,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,0X66,0X82,0X00,0X67,0XE6,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,
+0X66,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,
+0XF4,0XFF,0XFF,0X00,0X00,0X66,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,0X66,0X82,0X00,0X67,0XE6,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,0X66,
+0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XF4,
+0XFF,0XFF,0X00,0X00,0X66,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X00,0X66,0X82,0X00,0X67,0XE6,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XF4,0XFF,0XFF,0X00,0X08,0X86,0X82,
+0X00,0X67,0XE6,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,
+0XFF,0X00,0X00,0X65,0XED,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0XED,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0XED,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X6B,0XB2,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,
+0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,
+0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,
+0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XEB,
+0XFF,0XFF,0X00,0XEF,0X7F,0X8D,0X00,0X67,0XC0,0XFF,0XFF,0X8D,0X00,0X67,0X89,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XEB,0XFF,0XFF,0X00,0X73,0XD2,0X8D,0X00,0X67,0XC0,0XFF,0XFF,0X00,
+0X00,0X47,0X8B,0X00,0X67,0X00,0X00,0X87,0X89,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XEB,0XFF,0XFF,
+0X00,0X00,0X46,0X8C,0X00,0X67,0X00,0X00,0X87,0XBF,0XFF,0XFF,0X00,0X08,0XA6,0X8C,
+0X00,0X67,0X00,0X19,0X49,0X89,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XEB,0XFF,0XFF,0X8D,0X00,0X67,
+0X00,0X3A,0X2C,0XBF,0XFF,0XFF,0X00,0X00,0X87,0X8C,0X00,0X67,0X00,0X9D,0X36,0X89,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0XEB,0XFF,0XFF,0X8D,0X00,0X67,0XC0,0XFF,0XFF,0X8D,0X00,0X67,
+0X8A,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0XEA,0XFF,0XFF,0X00,0XD6,0XDC,0X8C,0X00,0X67,0X00,0X00,
+0X47,0XBF,0XFF,0XFF,0X01,0XAD,0X77,0X00,0X47,0X8C,0X00,0X67,0X8A,0XFF,0XFF,0X00,
+0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0XEA,0XFF,0XFF,0X00,0X00,0X66,0X8D,0X00,0X67,0XBF,0XFF,0XFF,0X00,0X00,0X66,
+0X8D,0X00,0X67,0X8A,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XEA,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X00,
+0X87,0XBF,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X08,0X85,0X8A,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XEA,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0XCE,0XBD,0XBF,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XDE,
+0XFC,0X8A,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0XEA,0XFF,0XFF,0X8D,0X00,0X67,0XBF,0XFF,0XFF,0X00,
+0XC6,0X19,0X8D,0X00,0X67,0X8B,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE9,0XFF,0XFF,0X00,0X42,0X8D,
+0X8C,0X00,0X67,0X00,0X00,0X47,0XBF,0XFF,0XFF,0X00,0X32,0X0B,0X8D,0X00,0X67,0X8B,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0XE9,0XFF,0XFF,0X8E,0X00,0X67,0XBF,0XFF,0XFF,0X8D,0X00,0X67,
+0X00,0X00,0X66,0X8B,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE9,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X32,
+0X0C,0XBF,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X94,0XD5,0X8B,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE9,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0XA5,0X56,0XBF,0XFF,0XFF,0X8D,0X00,0X67,0X8C,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X9D,0X15,0X8D,0X00,0X67,0XBF,0XFF,0XFF,0X00,
+0XC6,0X7C,0X8D,0X00,0X67,0X8C,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X66,
+0X8D,0X00,0X67,0XBF,0XFF,0XFF,0X00,0X00,0X87,0X8C,0X00,0X67,0X00,0X00,0X66,0X8C,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0XCE,0XFF,0XFF,0X06,0XEF,0X9F,0XC6,0X7B,0XA5,0X57,0X9C,0XF6,
+0XA5,0X78,0XE7,0X3E,0XFF,0XDF,0X92,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X19,0X29,0X92,
+0XFF,0XFF,0X08,0X94,0XB5,0X52,0XAE,0X10,0XE7,0X00,0X66,0X10,0XE8,0X19,0X49,0X52,
+0XCF,0X84,0X54,0XD6,0XBC,0X98,0XFF,0XFF,0X81,0XD6,0XBC,0X88,0XFF,0XFF,0X8D,0X00,
+0X67,0X00,0X4A,0X8D,0X8C,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X94,0XFF,0XFF,0X01,0X00,0X66,0X00,
+0X46,0X83,0X00,0X47,0X82,0X00,0X46,0X81,0X00,0X47,0X00,0X29,0XAA,0X88,0XFF,0XFF,
+0X01,0X52,0XAE,0X00,0X66,0X83,0X00,0X67,0X01,0X00,0X46,0X4A,0X8D,0X94,0XFF,0XFF,
+0X01,0X9D,0X16,0X00,0X66,0X8E,0X00,0X67,0X00,0X19,0X28,0X8F,0XFF,0XFF,0X8D,0X00,
+0X67,0X00,0XA5,0X77,0X8D,0XFF,0XFF,0X01,0X7C,0X12,0X00,0X46,0X8E,0X00,0X67,0X01,
+0X00,0X66,0XF7,0XDF,0X8F,0XFF,0XFF,0X00,0X19,0X08,0X87,0X00,0X67,0X00,0XA5,0X16,
+0X84,0XFF,0XFF,0X8D,0X00,0X67,0X8D,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X94,0XFF,0XFF,0X8B,0X00,
+0X67,0X85,0XFF,0XFF,0X00,0XDE,0XFD,0X8A,0X00,0X67,0X00,0X00,0X66,0X8F,0XFF,0XFF,
+0X00,0XD6,0XFD,0X94,0X00,0X67,0X01,0X00,0X87,0XFF,0XDF,0X8B,0XFF,0XFF,0X00,0XFF,
+0XDF,0X8D,0X00,0X67,0X00,0XFF,0XDF,0X8A,0XFF,0XFF,0X00,0XE7,0X5F,0X95,0X00,0X67,
+0X00,0XEF,0X9F,0X8B,0XFF,0XFF,0X00,0X5B,0X10,0X8A,0X00,0X67,0X01,0X00,0X47,0XFF,
+0XDF,0X82,0XFF,0XFF,0X8D,0X00,0X67,0X8D,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,
+0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X94,0XFF,0XFF,0X8B,
+0X00,0X67,0X00,0X9D,0X15,0X83,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X00,0X46,0X8C,0XFF,
+0XFF,0X00,0X5A,0XEE,0X98,0X00,0X67,0X00,0XA5,0X56,0X8A,0XFF,0XFF,0X00,0X63,0X4F,
+0X8D,0X00,0X67,0X89,0XFF,0XFF,0X00,0XAD,0XB8,0X98,0X00,0X67,0X00,0X10,0XC7,0X88,
+0XFF,0XFF,0X01,0XF7,0XBF,0X00,0X87,0X8D,0X00,0X67,0X02,0XCE,0X9B,0XFF,0XFF,0X4A,
+0XAE,0X8D,0X00,0X67,0X8D,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X94,0XFF,0XFF,0X8B,0X00,0X67,0X03,
+0X00,0X66,0XFF,0XFF,0XFF,0XFF,0X4A,0X6D,0X8F,0X00,0X67,0X00,0X00,0X66,0X8A,0XFF,
+0XFF,0X00,0X00,0X87,0X8C,0X00,0X67,0X00,0X00,0X47,0X8C,0X00,0X67,0X00,0X94,0XD4,
+0X89,0XFF,0XFF,0X00,0X08,0XA8,0X8D,0X00,0X67,0X88,0XFF,0XFF,0X00,0X08,0XC8,0X9A,
+0X00,0X67,0X00,0X84,0X31,0X86,0XFF,0XFF,0X00,0XEF,0X5D,0X90,0X00,0X67,0X00,0XFF,
+0XFF,0X8D,0X00,0X67,0X00,0X00,0X87,0X8D,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,
+0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X93,0XFF,0XFF,0X00,
+0X29,0XCB,0X8C,0X00,0X67,0X00,0XF7,0XBE,0X92,0X00,0X67,0X89,0XFF,0XFF,0X8C,0X00,
+0X67,0X00,0X08,0XA7,0X83,0XFF,0XFF,0X00,0X00,0X66,0X8A,0X00,0X67,0X89,0XFF,0XFF,
+0X00,0X00,0X47,0X8C,0X00,0X67,0X00,0X00,0X66,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X82,
+0XFF,0XFF,0X00,0XF7,0XBF,0X8A,0X00,0X67,0X00,0XAD,0XB7,0X86,0XFF,0XFF,0X91,0X00,
+0X67,0X00,0X00,0X66,0X8D,0X00,0X67,0X00,0XE7,0X5F,0X8D,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X93,
+0XFF,0XFF,0XA1,0X00,0X67,0X00,0X21,0X29,0X87,0XFF,0XFF,0X8C,0X00,0X67,0X00,0X00,
+0X46,0X84,0XFF,0XFF,0X00,0X00,0X87,0X8A,0X00,0X67,0X00,0X00,0X66,0X88,0XFF,0XFF,
+0X8D,0X00,0X67,0X00,0XB5,0X97,0X86,0XFF,0XFF,0X8C,0X00,0X67,0X00,0X00,0X86,0X84,
+0XFF,0XFF,0X00,0X00,0X66,0X89,0X00,0X67,0X86,0XFF,0XFF,0XA1,0X00,0X67,0X8E,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0X93,0XFF,0XFF,0X8F,0X00,0X67,0X03,0X00,0X87,0X7C,0X12,0XEF,0X9E,
+0X31,0XEB,0X8D,0X00,0X67,0X00,0X00,0X47,0X86,0XFF,0XFF,0X00,0X00,0X66,0X8C,0X00,
+0X67,0X85,0XFF,0XFF,0X00,0X52,0XCD,0X8B,0X00,0X67,0X88,0XFF,0XFF,0X8C,0X00,0X67,
+0X00,0X00,0X47,0X86,0XFF,0XFF,0X8D,0X00,0X67,0X85,0XFF,0XFF,0X00,0XDF,0X3E,0X88,
+0X00,0X67,0X00,0X00,0X47,0X85,0XFF,0XFF,0X00,0X29,0XAB,0X8D,0X00,0X67,0X03,0XC6,
+0X3A,0XFF,0XFF,0XFF,0XFF,0X4A,0XCE,0X8F,0X00,0X67,0X8E,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X93,
+0XFF,0XFF,0X8E,0X00,0X67,0X00,0XAD,0X76,0X83,0XFF,0XFF,0X00,0X00,0X26,0X8C,0X00,
+0X67,0X00,0X00,0X47,0X85,0XFF,0XFF,0X00,0X19,0X09,0X8C,0X00,0X67,0X00,0X21,0X47,
+0X85,0XFF,0XFF,0X01,0XB5,0XB8,0X00,0X47,0X8A,0X00,0X67,0X00,0X21,0X69,0X86,0XFF,
+0XFF,0X00,0X84,0X55,0X8D,0X00,0X67,0X85,0XFF,0XFF,0X00,0X32,0X0C,0X8C,0X00,0X67,
+0X00,0XFF,0XDF,0X86,0XFF,0XFF,0X00,0X00,0X66,0X88,0X00,0X67,0X85,0XFF,0XFF,0X8D,
+0X00,0X67,0X84,0XFF,0XFF,0X00,0X42,0X8C,0X8E,0X00,0X67,0X8E,0XFF,0XFF,0X00,0X73,
+0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,
+0X92,0XFF,0XFF,0X00,0X7C,0X32,0X8D,0X00,0X67,0X85,0XFF,0XFF,0X00,0XA5,0X16,0X8D,
+0X00,0X67,0X84,0XFF,0XFF,0X00,0XFF,0XDF,0X8D,0X00,0X67,0X86,0XFF,0XFF,0X00,0XC6,
+0X39,0X8C,0X00,0X67,0X86,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X00,0X66,0X85,0XFF,0XFF,
+0X8D,0X00,0X67,0X87,0XFF,0XFF,0X88,0X00,0X67,0X00,0X00,0X86,0X84,0XFF,0XFF,0X00,
+0X00,0XA8,0X8C,0X00,0X67,0X00,0XF7,0XDF,0X85,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X8C,
+0XB5,0X8E,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0X92,0XFF,0XFF,0X00,0X00,0X46,0X8D,0X00,0X67,0X86,
+0XFF,0XFF,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X00,0X00,0X46,0X8C,0X00,0X67,0X00,0X00,
+0X66,0X86,0XFF,0XFF,0X00,0XB5,0XB8,0X8C,0X00,0X67,0X86,0XFF,0XFF,0X8D,0X00,0X67,
+0X00,0X6B,0X71,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XFF,0XBF,0X86,0XFF,0XFF,0X00,
+0XF7,0XDF,0X88,0X00,0X67,0X00,0XAD,0X97,0X83,0XFF,0XFF,0X00,0XFF,0XDF,0X8C,0X00,
+0X67,0X00,0X00,0X87,0X86,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XF7,0XDF,0X8E,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0X92,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X6B,0XB0,0X85,0XFF,0XFF,0X00,0XD6,
+0XDB,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XDF,0X1C,0X86,0XFF,0XFF,
+0X00,0X84,0X73,0X8C,0X00,0X67,0X85,0XFF,0XFF,0X00,0XFF,0XDF,0X8D,0X00,0X67,0X85,
+0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X00,0XEF,0X9F,0X88,0X00,0X67,0X84,0XFF,
+0XFF,0X00,0X08,0X87,0X8C,0X00,0X67,0X00,0X94,0XF6,0X86,0XFF,0XFF,0X8D,0X00,0X67,
+0X8F,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0X92,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XFF,0XDF,0X85,0XFF,
+0XFF,0X00,0X6B,0XB0,0X8D,0X00,0X67,0X83,0XFF,0XFF,0X00,0X6B,0XB3,0X8C,0X00,0X67,
+0X00,0X00,0X46,0X87,0XFF,0XFF,0X00,0X31,0XEA,0X8C,0X00,0X67,0X00,0X84,0X32,0X84,
+0XFF,0XFF,0X00,0XC6,0X7C,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X00,0X00,0X86,0X8C,0X00,
+0X67,0X00,0X42,0X6D,0X87,0XFF,0XFF,0X01,0X84,0X74,0X00,0X67,0X82,0X00,0X66,0X82,
+0X00,0X67,0X01,0X00,0X66,0X00,0X67,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,
+0X8C,0X00,0X67,0X00,0X00,0X47,0X8F,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X91,0XFF,0XFF,0X00,0XE7,
+0X3D,0X8D,0X00,0X67,0X86,0XFF,0XFF,0X00,0X08,0X86,0X8D,0X00,0X67,0X83,0XFF,0XFF,
+0X8E,0X00,0X67,0X87,0XFF,0XFF,0X00,0X10,0XE8,0X8C,0X00,0X67,0X00,0X31,0XCA,0X84,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0X00,0X47,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XF7,
+0XDF,0X95,0XFF,0XFF,0X00,0XC6,0X3A,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X8C,0X00,0X67,
+0X00,0X10,0XE8,0X8F,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X91,0XFF,0XFF,0X00,0X08,0X85,0X8C,0X00,
+0X67,0X00,0X19,0X09,0X86,0XFF,0XFF,0X00,0X00,0X46,0X8D,0X00,0X67,0X83,0XFF,0XFF,
+0X8D,0X00,0X67,0X00,0X19,0X49,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X08,0X85,0X84,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0X21,0X49,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X96,0XFF,
+0XFF,0X00,0X00,0X66,0X8C,0X00,0X67,0X00,0X5B,0X0E,0X86,0XFF,0XFF,0X00,0XC6,0X3A,
+0X8C,0X00,0X67,0X00,0XA5,0X36,0X8F,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X91,0XFF,0XFF,0X00,0X00,
+0X66,0X8C,0X00,0X67,0X00,0X6B,0XD1,0X86,0XFF,0XFF,0X00,0X00,0X47,0X8D,0X00,0X67,
+0X83,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XF7,0XDF,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X00,
+0X08,0X85,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XF7,0XBF,0X83,0XFF,0XFF,0X00,0X9C,
+0XF5,0X8D,0X00,0X67,0X96,0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X24,
+0X8C,0X00,0X67,0X90,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X91,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XF7,
+0XDF,0X86,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X10,0XC7,0X83,0XFF,0XFF,0X8D,0X00,0X67,
+0X88,0XFF,0XFF,0X00,0X00,0X66,0X8C,0X00,0X67,0X00,0X42,0X4C,0X83,0XFF,0XFF,0X00,
+0XFF,0XDF,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X00,0X00,0X65,0X8C,0X00,0X67,0X00,0X19,
+0X29,0X96,0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X90,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0X91,0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X6B,
+0X90,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X00,0XFF,0XDF,
+0X8D,0X00,0X67,0X00,0XB5,0XD8,0X83,0XFF,0XFF,0X00,0X3A,0X4C,0X8D,0X00,0X67,0X84,
+0XFF,0XFF,0X00,0X00,0X46,0X8C,0X00,0X67,0X00,0X84,0X53,0X95,0XFF,0XFF,0X00,0XF7,
+0XBF,0X8C,0X00,0X67,0X00,0X00,0X47,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X90,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0X90,0XFF,0XFF,0X00,0XE7,0X3D,0X8D,0X00,0X67,0X86,0XFF,0XFF,0X01,0XC6,
+0X3A,0X00,0X66,0X8C,0X00,0X67,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0XBE,0X19,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X00,0X47,0X84,0XFF,
+0XFF,0X00,0X00,0X65,0X8C,0X00,0X67,0X00,0XF7,0XBE,0X95,0XFF,0XFF,0X00,0XA5,0X36,
+0X8C,0X00,0X67,0X00,0X00,0X65,0X87,0XFF,0XFF,0X8C,0X00,0X67,0X00,0X00,0X65,0X90,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0X90,0XFF,0XFF,0X00,0X52,0XAE,0X8D,0X00,0X67,0X86,0XFF,0XFF,
+0X00,0X10,0XE8,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X8C,0X00,0X67,0X00,0X08,0XA7,0X87,
+0XFF,0XFF,0X00,0X00,0X87,0X8D,0X00,0X67,0X84,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X84,
+0X95,0X84,0XFF,0XFF,0X00,0X00,0X65,0X8C,0X00,0X67,0X96,0XFF,0XFF,0X00,0X42,0X2C,
+0X8C,0X00,0X67,0X00,0X52,0XCD,0X86,0XFF,0XFF,0X00,0X63,0X2F,0X8C,0X00,0X67,0X00,
+0XC6,0X5A,0X90,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X90,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X4A,0XCE,
+0X86,0XFF,0XFF,0X8E,0X00,0X67,0X84,0XFF,0XFF,0X8C,0X00,0X67,0X00,0X84,0X54,0X87,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0X00,0X46,0X83,0XFF,0XFF,0X00,0XFF,0XDF,0X8D,0X00,
+0X67,0X00,0XF7,0X9F,0X84,0XFF,0XFF,0X00,0X00,0X65,0X8C,0X00,0X67,0X88,0XFF,0XFF,
+0X88,0X08,0X65,0X00,0X18,0XE6,0X83,0XFF,0XFF,0X00,0X21,0X4A,0X8C,0X00,0X67,0X00,
+0XA5,0X36,0X86,0XFF,0XFF,0X8D,0X00,0X67,0X91,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X90,0XFF,0XFF,
+0X8D,0X00,0X67,0X86,0XFF,0XFF,0X00,0XF7,0XBF,0X8D,0X00,0X67,0X00,0X73,0XF1,0X84,
+0XFF,0XFF,0X8C,0X00,0X67,0X00,0XCE,0X9C,0X87,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XE7,
+0X3E,0X83,0XFF,0XFF,0X00,0X8C,0X74,0X8D,0X00,0X67,0X85,0XFF,0XFF,0X00,0X29,0X88,
+0X8C,0X00,0X67,0X87,0XFF,0XFF,0X00,0XBE,0X19,0X88,0X00,0X67,0X00,0X9D,0X16,0X83,
+0XFF,0XFF,0X00,0X10,0XC8,0X8C,0X00,0X67,0X00,0XAD,0X76,0X86,0XFF,0XFF,0X8D,0X00,
+0X67,0X91,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8F,0XFF,0XFF,0X00,0XEF,0X5D,0X8D,0X00,0X67,0X86,
+0XFF,0XFF,0X00,0X19,0X29,0X8D,0X00,0X67,0X85,0XFF,0XFF,0X00,0X00,0X47,0X8B,0X00,
+0X67,0X00,0XF7,0XDF,0X86,0XFF,0XFF,0X00,0X19,0X08,0X8D,0X00,0X67,0X84,0XFF,0XFF,
+0X00,0X00,0X66,0X8D,0X00,0X67,0X85,0XFF,0XFF,0X00,0XA5,0X56,0X8C,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X66,0X88,0X00,0X67,0X00,0XE7,0X1D,0X83,0XFF,0XFF,0X00,0X08,
+0XC8,0X8C,0X00,0X67,0X00,0X73,0XD1,0X85,0XFF,0XFF,0X00,0XA5,0X56,0X8D,0X00,0X67,
+0X91,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0X8F,0XFF,0XFF,0X00,0X7C,0X12,0X8D,0X00,0X67,0X00,0XE7,
+0X3D,0X85,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X08,0X87,0X85,0XFF,0XFF,0X00,0X42,0X2D,
+0X8B,0X00,0X67,0X00,0XEF,0X9F,0X86,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XA5,0X57,0X84,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0X10,0XC8,0X86,0XFF,0XFF,0X8C,0X00,0X67,0X87,0XFF,
+0XFF,0X89,0X00,0X67,0X84,0XFF,0XFF,0X00,0X19,0X29,0X8C,0X00,0X67,0X00,0X08,0X86,
+0X85,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X6B,0X91,0X91,0XFF,0XFF,0X00,0X73,0XB1,0X82,
+0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8F,0XFF,
+0XFF,0X8F,0X00,0X67,0X84,0XFF,0XFF,0X8E,0X00,0X67,0X86,0XFF,0XFF,0X00,0XF7,0XBF,
+0X8B,0X00,0X67,0X00,0X8C,0XB6,0X85,0XFF,0XFF,0X00,0X3A,0X2C,0X8D,0X00,0X67,0X85,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0X94,0XB5,0X86,0XFF,0XFF,0X8C,0X00,0X67,0X86,0XFF,
+0XFF,0X00,0X10,0XE8,0X89,0X00,0X67,0X84,0XFF,0XFF,0X00,0X3A,0X2C,0X8C,0X00,0X67,
+0X00,0X00,0X66,0X84,0XFF,0XFF,0X00,0X63,0X50,0X8D,0X00,0X67,0X92,0XFF,0XFF,0X00,
+0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0X8F,0XFF,0XFF,0X8F,0X00,0X67,0X03,0X00,0X66,0X84,0X52,0XF7,0XBE,0X3A,0X2B,
+0X8E,0X00,0X67,0X00,0X6B,0X92,0X87,0XFF,0XFF,0X8C,0X00,0X67,0X85,0XFF,0XFF,0X8D,
+0X00,0X67,0X00,0XF7,0XBF,0X84,0XFF,0XFF,0X00,0XD6,0XDB,0X8D,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0XC6,0X5B,0X8B,0X00,0X67,0X85,0XFF,0XFF,0X00,0XFF,0XDF,0X89,0X00,0X67,
+0X00,0X19,0X2A,0X84,0XFF,0XFF,0X00,0XAD,0X98,0X8C,0X00,0X67,0X01,0X00,0X47,0X10,
+0XE7,0X82,0XFF,0XFF,0X00,0X21,0X8A,0X8E,0X00,0X67,0X92,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8F,
+0XFF,0XFF,0XA1,0X00,0X67,0X00,0X00,0X88,0X89,0XFF,0XFF,0X8B,0X00,0X67,0X84,0XFF,
+0XFF,0X8D,0X00,0X67,0X00,0XF7,0X9F,0X85,0XFF,0XFF,0X00,0X08,0X86,0X8D,0X00,0X67,
+0X88,0XFF,0XFF,0X00,0X00,0X87,0X8A,0X00,0X67,0X00,0X94,0XB4,0X84,0XFF,0XFF,0X8A,
+0X00,0X67,0X00,0X94,0XF6,0X84,0XFF,0XFF,0X00,0XFF,0XFE,0XA1,0X00,0X67,0X92,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0X8F,0XFF,0XFF,0X8D,0X00,0X67,0X00,0XFF,0XFF,0X92,0X00,0X67,0X00,
+0XF7,0X9E,0X89,0XFF,0XFF,0X00,0X19,0X28,0X8A,0X00,0X67,0X04,0X00,0X66,0XFF,0XFF,
+0XFF,0XFF,0XF7,0XDF,0X00,0X66,0X8C,0X00,0X67,0X00,0XE7,0X5E,0X86,0XFF,0XFF,0X00,
+0X00,0X87,0X8D,0X00,0X67,0X89,0XFF,0XFF,0X8B,0X00,0X67,0X82,0XFF,0XFF,0X00,0X63,
+0X71,0X8B,0X00,0X67,0X00,0XF7,0XBF,0X85,0XFF,0XFF,0X92,0X00,0X67,0X00,0X29,0X69,
+0X8C,0X00,0X67,0X00,0X29,0X8B,0X92,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8E,0XFF,0XFF,0X00,0X3A,
+0X4D,0X8D,0X00,0X67,0X81,0XFF,0XFF,0X00,0X08,0XC7,0X8F,0X00,0X67,0X00,0XCE,0X7A,
+0X8B,0XFF,0XFF,0X00,0X08,0XA7,0X99,0X00,0X67,0X00,0X00,0X87,0X88,0XFF,0XFF,0X8D,
+0X00,0X67,0X00,0X00,0X45,0X8A,0XFF,0XFF,0X00,0X00,0X86,0X8A,0X00,0X67,0X81,0X00,
+0X47,0X8C,0X00,0X67,0X86,0XFF,0XFF,0X00,0XCE,0X7A,0X90,0X00,0X67,0X02,0X19,0X28,
+0XFF,0XFF,0XAD,0X77,0X8B,0X00,0X67,0X00,0XF7,0XDF,0X92,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8E,
+0XFF,0XFF,0X8E,0X00,0X67,0X82,0XFF,0XFF,0X00,0X84,0X74,0X8D,0X00,0X67,0X00,0X7C,
+0X11,0X8D,0XFF,0XFF,0X00,0X10,0XE7,0X97,0X00,0X67,0X00,0X9C,0XF6,0X89,0XFF,0XFF,
+0X00,0X00,0X66,0X8C,0X00,0X67,0X00,0XBE,0X19,0X8B,0XFF,0XFF,0X00,0X31,0XCA,0X98,
+0X00,0X67,0X87,0XFF,0XFF,0X00,0X08,0XA6,0X8E,0X00,0X67,0X00,0X6B,0X70,0X82,0XFF,
+0XFF,0X8B,0X00,0X67,0X93,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8E,0XFF,0XFF,0X8D,0X00,0X67,0X00,
+0X5B,0X51,0X83,0XFF,0XFF,0X01,0XF7,0XDF,0X00,0X87,0X89,0X00,0X67,0X01,0X00,0X87,
+0XF7,0XDF,0X90,0XFF,0XFF,0X00,0X00,0X46,0X93,0X00,0X67,0X00,0XE7,0X5E,0X8A,0XFF,
+0XFF,0X00,0XC6,0X3A,0X8D,0X00,0X67,0X8E,0XFF,0XFF,0X00,0XBD,0XFB,0X94,0X00,0X67,
+0X01,0X00,0X66,0XEF,0X7E,0X88,0XFF,0XFF,0X00,0X3A,0X0C,0X8B,0X00,0X67,0X00,0X08,
+0X87,0X84,0XFF,0XFF,0X00,0X21,0X6A,0X8A,0X00,0X67,0X93,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8E,
+0XFF,0XFF,0X8D,0X00,0X67,0X87,0XFF,0XFF,0X00,0X08,0X67,0X85,0X00,0X67,0X01,0X00,
+0X47,0XDE,0XFD,0X94,0XFF,0XFF,0X01,0X42,0X2C,0X00,0X66,0X8C,0X00,0X67,0X00,0X3A,
+0X0D,0X8E,0XFF,0XFF,0X00,0X29,0X8B,0X8D,0X00,0X67,0X91,0XFF,0XFF,0X01,0XAD,0X98,
+0X00,0X66,0X8C,0X00,0X67,0X01,0X00,0X46,0X6B,0X91,0X8D,0XFF,0XFF,0X01,0XF7,0XDF,
+0X00,0X46,0X87,0X00,0X67,0X00,0X21,0X49,0X86,0XFF,0XFF,0X00,0XDE,0XFC,0X8A,0X00,
+0X67,0X93,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8D,0XFF,0XFF,0X00,0X94,0XF5,0X8D,0X00,0X67,0X00,
+0XFF,0XDF,0X89,0XFF,0XFF,0X01,0XEF,0X5E,0XC6,0X5B,0X9C,0XFF,0XFF,0X04,0XFF,0XDF,
+0XE7,0X7E,0XCE,0XBC,0XD6,0XFD,0XF7,0XDF,0XBB,0XFF,0XFF,0X05,0XD6,0XDC,0XAD,0X98,
+0X94,0XF6,0XA5,0X78,0XBD,0XFA,0XEF,0X9F,0XC5,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8D,0XFF,0XFF,
+0X00,0X00,0X66,0X8D,0X00,0X67,0XFF,0XFF,0XFF,0XB6,0XFF,0XFF,0X00,0X73,0XB1,0X82,
+0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8D,0XFF,
+0XFF,0X8D,0X00,0X67,0X00,0X19,0X29,0XFF,0XFF,0XFF,0XB6,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8D,
+0XFF,0XFF,0X8D,0X00,0X67,0X00,0XD6,0XFD,0XFF,0XFF,0XFF,0XB6,0XFF,0XFF,0X00,0X73,
+0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,
+0X8C,0XFF,0XFF,0X00,0XE7,0X1D,0X8D,0X00,0X67,0XFF,0XFF,0XFF,0XB7,0XFF,0XFF,0X00,
+0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0X8C,0XFF,0XFF,0X00,0X08,0XA5,0X8D,0X00,0X67,0XFF,0XFF,0XFF,0XB7,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0X8C,0XFF,0XFF,0X00,0X08,0X87,0X8C,0X00,0X67,0X00,0X00,0X87,0XFF,0XFF,
+0XFF,0XB7,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8C,0XFF,0XFF,0X8D,0X00,0X67,0X00,0X29,0XA9,0XFF,
+0XFF,0XFF,0XB7,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8C,0XFF,0XFF,0X8D,0X00,0X67,0XFF,0XFF,0XFF,
+0XB8,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,
+0X00,0X67,0X8B,0XFF,0XFF,0X8B,0XFF,0XFF,0X00,0X7B,0XF2,0X8D,0X00,0X67,0XFF,0XFF,
+0XFF,0XB8,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8B,0XFF,0XFF,0X00,0X10,0XE8,0X8C,0X00,0X67,0X00,
+0X00,0X66,0XFF,0XFF,0XFF,0XB8,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0X8B,0XFF,0XFF,0X8D,0X00,0X67,
+0X00,0X5B,0X0E,0XFF,0XFF,0XFF,0XB8,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,
+0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,
+0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,0X04,0X63,0X2F,0X63,0X2E,0X63,0X2E,0X63,0X4F,0X94,
+0XD4,0X84,0XFF,0XFF,0X01,0X63,0X2D,0X63,0X4F,0X83,0XFF,0XFF,0X03,0X42,0X6C,0X08,
+0XA7,0X08,0XC7,0XB5,0XD8,0X83,0XFF,0XFF,0X00,0X63,0X4F,0X82,0X63,0X2E,0X01,0X63,
+0X4F,0XEF,0X7D,0X82,0XFF,0XFF,0X01,0X5B,0X0D,0X6B,0X4F,0X88,0XFF,0XFF,0X01,0X63,
+0X4F,0X6B,0X90,0X83,0XFF,0XFF,0X01,0X63,0X4F,0X7C,0X11,0X84,0XFF,0XFF,0X01,0XF7,
+0X9E,0X63,0X2F,0X84,0XFF,0XFF,0X00,0XDE,0XFC,0X86,0X63,0X2E,0X02,0XFF,0XFF,0XDE,
+0XFC,0X63,0X2E,0X84,0XFF,0XFF,0X03,0XF7,0XBF,0X63,0X2E,0XFF,0XFF,0XFF,0XFE,0X83,
+0X63,0X2E,0X01,0X63,0X4F,0XEF,0X7E,0X82,0XFF,0XFF,0X00,0X84,0X52,0X86,0X63,0X2E,
+0X81,0XFF,0XFF,0X00,0X63,0X4E,0X83,0X63,0X2E,0X00,0X8C,0X73,0X82,0XFF,0XFF,0X00,
+0XB5,0X97,0X86,0X63,0X2E,0X00,0X63,0X2F,0XAB,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,
+0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,
+0X06,0X00,0X67,0X00,0X66,0X00,0X66,0X00,0X67,0X00,0X46,0X00,0X67,0X00,0X66,0X82,
+0XFF,0XFF,0X0A,0X08,0X66,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0XE7,0X3D,0X00,0X87,0X00,
+0X87,0X84,0X54,0X42,0X6D,0X00,0X67,0X00,0X46,0X82,0XFF,0XFF,0X00,0X00,0X67,0X83,
+0X00,0X66,0X05,0X00,0X67,0X00,0X87,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0X08,0XC8,0X88,
+0XFF,0XFF,0X81,0X00,0X67,0X84,0XFF,0XFF,0X00,0X00,0X67,0X84,0XFF,0XFF,0X01,0X00,
+0X67,0X10,0XE8,0X84,0XFF,0XFF,0X01,0XC6,0X19,0X00,0X67,0X83,0X00,0X66,0X81,0X00,
+0X67,0X81,0XFF,0XFF,0X01,0X08,0X87,0X00,0X87,0X83,0XFF,0XFF,0X04,0X00,0X67,0X5A,
+0XEF,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0X82,0X00,0X66,0X07,0X00,0X67,0X00,0X87,0X00,
+0X46,0XFF,0XFF,0XFF,0XFF,0X42,0X2D,0X00,0X67,0X00,0X66,0X83,0X00,0X67,0X02,0X00,
+0X66,0XFF,0XFF,0XFF,0XFF,0X82,0X00,0X67,0X81,0X00,0X66,0X81,0X00,0X67,0X02,0X08,
+0XC6,0XFF,0XFF,0X84,0X33,0X82,0X00,0X66,0X04,0X00,0X67,0X00,0X66,0X00,0X67,0X00,
+0X67,0X00,0X66,0XAB,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X67,0X84,0XFF,
+0XFF,0X09,0X00,0X46,0X10,0XE8,0XFF,0XFF,0XFF,0XFF,0X08,0X66,0X00,0X67,0XFF,0XFF,
+0XFF,0XFF,0X00,0X67,0X21,0X69,0X83,0XFF,0XFF,0X04,0X00,0X67,0X73,0XB1,0XFF,0XFF,
+0XFF,0XFF,0X00,0X67,0X84,0XFF,0XFF,0X04,0X00,0X67,0X63,0X4F,0XFF,0XFF,0X00,0X67,
+0X08,0XC8,0X87,0XFF,0XFF,0X03,0X21,0X48,0X00,0X66,0X00,0X67,0X63,0X6F,0X83,0XFF,
+0XFF,0X01,0X08,0XA8,0X00,0X46,0X82,0XFF,0XFF,0X01,0XBE,0X1A,0X00,0X67,0X85,0XFF,
+0XFF,0X01,0XC6,0X1A,0X00,0X67,0X88,0XFF,0XFF,0X05,0X00,0X67,0X08,0XC6,0XFF,0XFF,
+0XFF,0XFF,0X00,0X66,0X00,0X87,0X82,0XFF,0XFF,0X00,0X00,0X67,0X84,0XFF,0XFF,0X04,
+0X00,0X67,0X63,0X30,0XFF,0XFF,0X42,0X2D,0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,
+0XCE,0X7A,0X83,0XFF,0XFF,0X01,0XF7,0XBF,0X00,0X67,0X84,0XFF,0XFF,0X01,0X00,0X67,
+0XF7,0X9F,0XAE,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X67,0X85,0XFF,0XFF,
+0X08,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X08,0X66,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X00,
+0X67,0X94,0XD6,0X83,0XFF,0XFF,0X04,0X42,0X6B,0X84,0X33,0XFF,0XFF,0XFF,0XFF,0X00,
+0X67,0X84,0XFF,0XFF,0X04,0X29,0XCB,0X00,0X47,0XFF,0XFF,0X00,0X67,0X08,0XC8,0X87,
+0XFF,0XFF,0X03,0X00,0X67,0XD6,0XBB,0X84,0X54,0X00,0X87,0X84,0XFF,0XFF,0X05,0X00,
+0X67,0XDF,0X1E,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0XE7,0X1D,0X85,0XFF,0XFF,0X01,0XC6,
+0X1A,0X00,0X67,0X88,0XFF,0XFF,0X05,0XDE,0XFD,0X00,0X67,0XEF,0X7F,0XAD,0X97,0X00,
+0X47,0XFF,0XDF,0X82,0XFF,0XFF,0X00,0X00,0X67,0X84,0XFF,0XFF,0X04,0X08,0X87,0X00,
+0X66,0XFF,0XFF,0X42,0X2D,0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,0XCE,0X7A,0X84,
+0XFF,0XFF,0X00,0X00,0X67,0X84,0XFF,0XFF,0X01,0X00,0X67,0XF7,0X9F,0XAE,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X67,0X85,0XFF,0XFF,0X0A,0X00,0X67,0XFF,0XFF,
+0XFF,0XFF,0X08,0X66,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X42,0X2B,0X00,0X67,0X42,0X6E,
+0XEF,0X7E,0X85,0XFF,0XFF,0X00,0X00,0X47,0X84,0XFF,0XFF,0X04,0X00,0X67,0X4A,0X8E,
+0XFF,0XFF,0X00,0X67,0X08,0XC8,0X86,0XFF,0XFF,0X04,0XF7,0X9F,0X00,0X67,0XFF,0XFF,
+0XFF,0XFF,0X00,0X67,0X84,0XFF,0XFF,0X04,0X7B,0XF1,0X00,0X67,0XFF,0XDF,0X00,0X67,
+0X00,0X66,0X86,0XFF,0XFF,0X01,0XC6,0X1A,0X00,0X67,0X89,0XFF,0XFF,0X03,0X18,0XE7,
+0X00,0X67,0X00,0X67,0XDF,0X1D,0X83,0XFF,0XFF,0X00,0X00,0X66,0X84,0XFF,0XFF,0X04,
+0X00,0X88,0X4A,0XAE,0XFF,0XFF,0X42,0X2D,0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,
+0XCE,0X5A,0X83,0XFF,0XFF,0X01,0X7C,0X14,0X00,0X47,0X84,0XFF,0XFF,0X01,0X00,0X67,
+0XF7,0X9F,0XAE,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X67,0X85,0XFF,0XFF,
+0X04,0X00,0X67,0XF7,0X9F,0XFF,0XFF,0X08,0X66,0X00,0X67,0X82,0XFF,0XFF,0X01,0XF7,
+0XBF,0X00,0X47,0X82,0X00,0X67,0X00,0X9C,0XF6,0X82,0XFF,0XFF,0X0A,0X00,0X67,0X11,
+0X08,0X10,0XE7,0X10,0XE7,0X10,0XC7,0X00,0X66,0X00,0X68,0XFF,0XFF,0XFF,0XFF,0X00,
+0X67,0X08,0XC8,0X86,0XFF,0XFF,0X05,0X00,0X67,0X31,0XAA,0XFF,0XFF,0XFF,0XFF,0X3A,
+0X2D,0X08,0XA7,0X84,0XFF,0XFF,0X02,0X00,0X87,0X00,0X67,0X00,0X87,0X87,0XFF,0XFF,
+0X02,0XC6,0X1A,0X00,0X67,0X00,0X66,0X83,0X00,0X67,0X00,0X00,0X66,0X84,0XFF,0XFF,
+0X01,0X00,0X67,0X00,0X46,0X84,0XFF,0XFF,0X00,0X00,0X67,0X82,0X10,0XE7,0X07,0X10,
+0XC7,0X00,0X67,0X00,0X66,0XFF,0XDF,0XFF,0XFF,0X42,0X2D,0X00,0X67,0X00,0X66,0X83,
+0X00,0X67,0X05,0X84,0X12,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0X00,0X67,0X00,0X47,0X82,
+0X00,0X67,0X01,0X00,0X46,0XF7,0XBF,0X84,0XFF,0XFF,0X01,0X00,0X67,0XF7,0X9F,0XAE,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X67,0X85,0XFF,0XFF,0X04,0X00,0X67,
+0XF7,0XDF,0XFF,0XFF,0X08,0X66,0X00,0X67,0X85,0XFF,0XFF,0X06,0XFF,0XDF,0X19,0X29,
+0X00,0X67,0X63,0X4F,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0X82,0X3A,0X0C,0X01,0X42,0X4D,
+0XEF,0X7F,0X82,0XFF,0XFF,0X01,0X00,0X67,0X08,0XC8,0X86,0XFF,0XFF,0X05,0X00,0X67,
+0XCE,0X7B,0XCE,0X7A,0XCE,0X7B,0XC6,0X3A,0X00,0X67,0X85,0XFF,0XFF,0X01,0X00,0X67,
+0XF7,0XBF,0X87,0XFF,0XFF,0X01,0XC6,0X1A,0X00,0X67,0X89,0XFF,0XFF,0X03,0X10,0XC7,
+0X00,0X46,0X00,0X67,0XE7,0X3E,0X83,0XFF,0XFF,0X00,0X00,0X67,0X82,0X3A,0X0C,0X01,
+0X42,0X6D,0XEF,0X9F,0X82,0XFF,0XFF,0X01,0X42,0X2D,0X00,0X67,0X87,0XFF,0XFF,0X05,
+0X00,0X67,0XC6,0X5A,0XFF,0XFF,0XFF,0XDF,0X00,0X86,0X00,0X66,0X86,0XFF,0XFF,0X01,
+0X00,0X67,0XF7,0X9F,0XAE,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X67,0X85,
+0XFF,0XFF,0X07,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X08,0X66,0X00,0X67,0XFF,0XFF,0XFF,
+0XFF,0X4A,0XAD,0X84,0XFF,0XFF,0X04,0X21,0X47,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X00,
+0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,0X08,0XC8,0X85,0XFF,0XFF,0X01,0X5B,0X0E,0X00,
+0X87,0X83,0X00,0X67,0X01,0X00,0X68,0X9D,0X15,0X84,0XFF,0XFF,0X00,0X00,0X67,0X88,
+0XFF,0XFF,0X01,0XC6,0X1A,0X00,0X67,0X88,0XFF,0XFF,0X04,0XD6,0XBC,0X00,0X67,0XFF,
+0XFF,0X63,0X50,0X00,0X67,0X83,0XFF,0XFF,0X00,0X00,0X67,0X87,0XFF,0XFF,0X01,0X42,
+0X2D,0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,0XCE,0X7A,0X82,0XFF,0XFF,0X01,0X00,
+0X67,0X00,0X66,0X85,0XFF,0XFF,0X01,0X00,0X67,0XF7,0X9F,0XAE,0XFF,0XFF,0X00,0X73,
+0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,
+0XAE,0XFF,0XFF,0X00,0X00,0X67,0X84,0XFF,0XFF,0X09,0X10,0XC7,0X00,0X66,0XFF,0XFF,
+0XFF,0XFF,0X08,0X66,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X00,0X66,0XF7,0XDF,0X83,0XFF,
+0XFF,0X04,0X4A,0XAD,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0X87,0XFF,0XFF,0X01,
+0X00,0X67,0X08,0XC8,0X85,0XFF,0XFF,0X01,0X00,0X67,0X8C,0X94,0X83,0XFF,0XFF,0X01,
+0X00,0X65,0X00,0X67,0X84,0XFF,0XFF,0X00,0X00,0X67,0X88,0XFF,0XFF,0X01,0XC6,0X1A,
+0X00,0X67,0X87,0XFF,0XFF,0X06,0XFF,0XDF,0X00,0X67,0X31,0XEA,0XFF,0XFF,0XFF,0XFF,
+0X00,0X66,0X00,0X66,0X82,0XFF,0XFF,0X00,0X00,0X67,0X87,0XFF,0XFF,0X01,0X42,0X2D,
+0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,0XCE,0X7A,0X83,0XFF,0XFF,0X01,0X00,0X67,
+0X3A,0X2B,0X84,0XFF,0XFF,0X01,0X00,0X67,0XF7,0X9F,0XAE,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XAE,
+0XFF,0XFF,0X01,0X00,0X67,0XFF,0XDF,0X82,0XFF,0XFF,0X01,0X00,0X46,0X00,0X67,0X82,
+0XFF,0XFF,0X0E,0X08,0X66,0X00,0X67,0XFF,0XFF,0XFF,0XFF,0X10,0XE7,0X00,0X67,0XEF,
+0X9F,0XFF,0XFF,0XFF,0XFF,0XDE,0XFD,0X00,0X67,0X7C,0X32,0XFF,0XFF,0XFF,0XFF,0X00,
+0X67,0X87,0XFF,0XFF,0X01,0X00,0X66,0X08,0XA7,0X85,0XFF,0XFF,0X00,0X00,0X67,0X85,
+0XFF,0XFF,0X01,0X00,0X67,0XFF,0XDF,0X83,0XFF,0XFF,0X00,0X00,0X67,0X88,0XFF,0XFF,
+0X01,0XC6,0X19,0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,0X00,0X87,0X83,0XFF,0XFF,
+0X04,0X00,0X66,0X7C,0X12,0XFF,0XFF,0XFF,0XFF,0X00,0X67,0X87,0XFF,0XFF,0X01,0X42,
+0X2D,0X00,0X67,0X87,0XFF,0XFF,0X01,0X00,0X67,0XCE,0X5A,0X83,0XFF,0XFF,0X02,0X8C,
+0X94,0X00,0X67,0XFF,0XDF,0X83,0XFF,0XFF,0X01,0X00,0X67,0XF7,0X9F,0XAE,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0XAE,0XFF,0XFF,0X00,0X00,0X68,0X83,0X00,0X67,0X00,0X42,0X6D,0X83,0XFF,
+0XFF,0X01,0X00,0X85,0X00,0X67,0X82,0XFF,0XFF,0X01,0X73,0XF2,0X00,0X87,0X82,0X00,
+0X67,0X00,0XBD,0XFA,0X82,0XFF,0XFF,0X00,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X66,
+0X85,0X00,0X67,0X01,0X6B,0X92,0X00,0X67,0X85,0XFF,0XFF,0X01,0X00,0X87,0X00,0X45,
+0X83,0XFF,0XFF,0X00,0X00,0X68,0X88,0XFF,0XFF,0X00,0XC6,0X3A,0X86,0X00,0X67,0X02,
+0XFF,0XFF,0X63,0X50,0X00,0X67,0X84,0XFF,0XFF,0X04,0XA5,0X56,0X00,0X67,0XF7,0X9E,
+0XFF,0XFF,0X00,0X67,0X87,0XFF,0XFF,0X00,0X3A,0X4C,0X86,0X00,0X67,0X81,0XFF,0XFF,
+0X01,0X00,0X67,0XCE,0X7A,0X84,0XFF,0XFF,0X01,0X00,0X67,0X10,0XE8,0X83,0XFF,0XFF,
+0X01,0X00,0X67,0XF7,0XBF,0XAE,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0XFF,0XFF,0XFF,0XD3,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,
+0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,
+0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,
+0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,
+0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,
+0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,
+0X87,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,
+0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X87,0XFF,0XFF,0X00,0X00,0X65,
+0X82,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,
+0XFF,0XFF,0X00,0X73,0XB1,0X8A,0X00,0X67,0X00,0X00,0X88,0X82,0X00,0X67,0X8B,0XFF,
+0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,
+0X8E,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,
+0XFF,0XFF,0X00,0X73,0XB1,0X8E,0X00,0X67,0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,
+0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X8D,0X00,0X67,0X00,0X00,0X68,
+0X8B,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,
+0X73,0XD2,0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,
+0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,
+0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X97,
+0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,
+0XB1,0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,
+0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,
+0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X97,0XFF,
+0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,0XFF,0XFF,0X00,0X73,0XB1,
+0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0X82,0X00,0X67,0XE6,
+0XFF,0XFF,0X00,0X73,0XB1,0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,
+0X65,0X84,0X00,0X67,0X81,0X00,0X47,0X83,0X00,0X67,0X82,0X00,0X47,0X82,0X00,0X67,
+0X83,0X00,0X47,0X82,0X00,0X67,0X82,0X00,0X47,0X83,0X00,0X67,0X82,0X00,0X47,0X82,
+0X00,0X67,0X83,0X00,0X47,0X82,0X00,0X67,0X82,0X00,0X47,0X83,0X00,0X67,0X82,0X00,
+0X47,0X82,0X00,0X67,0X83,0X00,0X47,0X82,0X00,0X67,0X82,0X00,0X47,0X83,0X00,0X67,
+0X82,0X00,0X47,0X82,0X00,0X67,0X83,0X00,0X47,0X82,0X00,0X67,0X82,0X00,0X47,0X83,
+0X00,0X67,0X82,0X00,0X47,0X82,0X00,0X67,0X83,0X00,0X47,0X82,0X00,0X67,0X82,0X00,
+0X47,0X82,0X00,0X67,0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0XED,0X00,0X67,
+0X97,0XFF,0XFF,0XE8,0XFF,0XFF,0X00,0X00,0X65,0XED,0X00,0X67,0X97,0XFF,0XFF,0XE8,
+0XFF,0XFF,0X00,0X73,0XB0,0XED,0X00,0X64,0X97,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XEF,0XFF,0XFF,0X9F,0XFF,0XFF,0X05,0X00,0X20,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,
+0XFF,0X00,0X00,0X8E,0XFF,0XFF,0X01,0XF7,0XBE,0X00,0X20,0X86,0XFF,0XFF,0X01,0X00,
+0X00,0XEF,0X7D,0X90,0XFF,0XFF,0X02,0XFF,0XDF,0X00,0X00,0X00,0X00,0XB1,0XFF,0XFF,
+0X81,0X00,0X00,0X95,0XFF,0XFF,0X82,0X00,0X00,0X95,0XFF,0XFF,0X02,0X94,0X92,0X00,
+0X00,0X00,0X00,0X96,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X93,0XFF,0XFF,0X82,
+0X00,0X00,0X88,0XFF,0XFF,0X82,0X00,0X00,0X00,0XFF,0XFF,0X82,0X00,0X00,0X00,0XEF,
+0X5D,0X84,0XFF,0XFF,0X02,0X21,0X04,0X00,0X00,0X73,0XAE,0X84,0XFF,0XFF,0X82,0X00,
+0X00,0X84,0XFF,0XFF,0X02,0XF7,0XBE,0X00,0X00,0X00,0X00,0X85,0XFF,0XFF,0X01,0XFF,
+0XDF,0X00,0X00,0X89,0XFF,0XFF,0X81,0X00,0X00,0X00,0XFF,0XDF,0X8C,0XFF,0XFF,0X8D,
+0X00,0X00,0X95,0XFF,0XFF,0X81,0X00,0X00,0X96,0XFF,0XFF,0X81,0X00,0X00,0X95,0XFF,
+0XFF,0X02,0X39,0XC7,0X00,0X00,0X00,0X00,0X90,0XFF,0XFF,0X81,0X00,0X00,0X83,0XFF,
+0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X93,0XFF,0XFF,0X00,0XFF,0XDF,0X82,0X00,0X00,
+0X00,0X08,0X61,0X86,0XFF,0XFF,0X82,0X00,0X00,0X81,0XFF,0XFF,0X82,0X00,0X00,0X84,
+0XFF,0XFF,0X82,0X00,0X00,0X00,0X00,0X20,0X84,0XFF,0XFF,0X81,0X00,0X00,0X00,0XFF,
+0XDF,0X83,0XFF,0XFF,0X82,0X00,0X00,0X85,0XFF,0XFF,0X82,0X00,0X00,0X88,0XFF,0XFF,
+0X81,0X00,0X00,0X00,0X9C,0XD3,0X8C,0XFF,0XFF,0X8D,0X00,0X00,0X95,0XFF,0XFF,0X81,
+0X00,0X00,0X00,0XFF,0XDF,0X8B,0XFF,0XFF,0X95,0X00,0X00,0X8B,0XFF,0XFF,0X82,0X00,
+0X00,0X8F,0XFF,0XFF,0X82,0X00,0X00,0X83,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,
+0X95,0XFF,0XFF,0X82,0X00,0X00,0X00,0X21,0X24,0X87,0X00,0X00,0X00,0X00,0X20,0X85,
+0X00,0X00,0X00,0X5A,0XCB,0X84,0XFF,0XFF,0X82,0X00,0X00,0X00,0X08,0X41,0X82,0XFF,
+0XFF,0X02,0X00,0X20,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X02,0XFF,0XDF,0X00,0X00,
+0X00,0X00,0X87,0XFF,0XFF,0X82,0X00,0X00,0X00,0XFF,0XFF,0X8F,0X00,0X00,0X86,0XFF,
+0XFF,0X81,0X00,0X00,0X88,0XFF,0XFF,0X82,0X00,0X00,0X95,0XFF,0XFF,0X8A,0X00,0X00,
+0X83,0XFF,0XFF,0X95,0X00,0X00,0X8B,0XFF,0XFF,0X82,0X00,0X00,0X8F,0XFF,0XFF,0X82,
+0X00,0X00,0X83,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X97,0XFF,0XFF,0X00,0X4A,
+0X49,0X8F,0X00,0X00,0X00,0X08,0X61,0X85,0XFF,0XFF,0X81,0X00,0X20,0X84,0XFF,0XFF,
+0X01,0X00,0X00,0X21,0X24,0X82,0XFF,0XFF,0X81,0X00,0X00,0X00,0XFF,0XDF,0X88,0XFF,
+0XFF,0X81,0X00,0X00,0X00,0X00,0X20,0X8F,0X00,0X00,0X86,0XFF,0XFF,0X81,0X00,0X00,
+0X88,0XFF,0XFF,0X82,0X00,0X00,0X95,0XFF,0XFF,0X8A,0X00,0X00,0XA5,0XFF,0XFF,0X82,
+0X00,0X00,0X8E,0XFF,0XFF,0X02,0XFF,0XDF,0X00,0X00,0X00,0X00,0X84,0XFF,0XFF,0X81,
+0X00,0X00,0X9C,0XFF,0XFF,0X98,0XFF,0XFF,0X00,0X00,0X20,0X87,0X00,0X00,0X00,0X00,
+0X20,0X85,0X00,0X00,0X00,0X08,0X41,0X88,0XFF,0XFF,0X8E,0X00,0X00,0X86,0XFF,0XFF,
+0X00,0X63,0X2C,0X83,0XFF,0XFF,0X01,0X00,0X00,0XDE,0XDB,0X82,0XFF,0XFF,0X02,0X00,
+0X00,0XA5,0X14,0XFF,0XDF,0X8B,0XFF,0XFF,0X8D,0X00,0X00,0X95,0XFF,0XFF,0X81,0X00,
+0X00,0X90,0XFF,0XFF,0X02,0XB5,0X96,0XB5,0XB6,0XB5,0XB6,0X87,0XC6,0X18,0X03,0XBD,
+0XD7,0XB5,0XB6,0XB5,0X96,0XAD,0X55,0X8E,0XFF,0XFF,0X82,0X00,0X00,0X8E,0XFF,0XFF,
+0X92,0X00,0X00,0X93,0XFF,0XFF,0X9F,0XFF,0XFF,0X82,0X00,0X00,0X8F,0XFF,0XFF,0X8E,
+0X00,0X00,0X8B,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X8C,0XFF,
+0XFF,0X8A,0X00,0X00,0X02,0X08,0X41,0X00,0X00,0X00,0X00,0X95,0XFF,0XFF,0X81,0X00,
+0X00,0X90,0XFF,0XFF,0X8E,0X00,0X00,0X8E,0XFF,0XFF,0X82,0X00,0X00,0X8D,0XFF,0XFF,
+0X00,0XFF,0XDF,0X92,0X00,0X00,0X93,0XFF,0XFF,0X92,0XFF,0XFF,0X01,0XF7,0XBE,0X00,
+0X00,0X84,0XFF,0XFF,0X01,0XFF,0XDF,0X73,0X8E,0X83,0X6B,0X6D,0X82,0X00,0X00,0X00,
+0X73,0X8E,0X82,0X6B,0X6D,0X00,0X73,0X8E,0X84,0XFF,0XFF,0X01,0X00,0X00,0XFF,0XDF,
+0X89,0XFF,0XFF,0X82,0X00,0X00,0X90,0XFF,0XFF,0X81,0X00,0X00,0X05,0XB5,0X96,0XFF,
+0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X00,0X20,0X8C,0XFF,0XFF,0X81,0X00,0X00,0X88,
+0XFF,0XFF,0X82,0X00,0X00,0X95,0XFF,0XFF,0X81,0X00,0X00,0X00,0XF7,0XBE,0X8F,0XFF,
+0XFF,0X81,0X00,0X00,0X89,0XFF,0XFF,0X82,0X00,0X00,0X8E,0XFF,0XFF,0X82,0X00,0X00,
+0X00,0X29,0X65,0X8C,0XFF,0XFF,0X82,0X00,0X00,0X85,0XFF,0XFF,0X81,0X00,0X00,0X9C,
+0XFF,0XFF,0X92,0XFF,0XFF,0X82,0X00,0X00,0X01,0X00,0X20,0XFF,0XDF,0X82,0XFF,0XFF,
+0X8C,0X00,0X00,0X82,0XFF,0XFF,0X00,0XFF,0XDF,0X83,0X00,0X00,0X88,0XFF,0XFF,0X82,
+0X00,0X00,0X88,0XFF,0XFF,0X81,0X00,0X00,0X00,0XFF,0XDF,0X84,0XFF,0XFF,0X81,0X00,
+0X00,0X82,0XFF,0XFF,0X88,0X00,0X00,0X86,0XFF,0XFF,0X81,0X00,0X00,0X88,0XFF,0XFF,
+0X02,0X00,0X20,0X00,0X00,0X00,0X00,0X8E,0XFF,0XFF,0X90,0X00,0X00,0X88,0XFF,0XFF,
+0X81,0X00,0X00,0X89,0XFF,0XFF,0X82,0X00,0X00,0X8E,0XFF,0XFF,0X83,0X00,0X00,0X8B,
+0XFF,0XFF,0X03,0X21,0X24,0X00,0X00,0X00,0X00,0XF7,0XBE,0X85,0XFF,0XFF,0X81,0X00,
+0X00,0X9C,0XFF,0XFF,0X93,0XFF,0XFF,0X83,0X00,0X00,0X02,0X39,0XE7,0XFF,0XFF,0XFF,
+0XFF,0X86,0X00,0X00,0X00,0X00,0X20,0X84,0X00,0X00,0X84,0XFF,0XFF,0X00,0X00,0X20,
+0X82,0X00,0X00,0X00,0XF7,0XBE,0X86,0XFF,0XFF,0X82,0X00,0X00,0X88,0XFF,0XFF,0X82,
+0X00,0X00,0X00,0X00,0X20,0X82,0XFF,0XFF,0X82,0X00,0X00,0X81,0XFF,0XFF,0X88,0X00,
+0X00,0X87,0XFF,0XFF,0X8D,0X00,0X00,0X8E,0XFF,0XFF,0X90,0X00,0X00,0X88,0XFF,0XFF,
+0X8E,0X00,0X00,0X8D,0XFF,0XFF,0X00,0X39,0XC7,0X83,0X00,0X00,0X00,0XFF,0XDF,0X8A,
+0XFF,0XFF,0X82,0X00,0X00,0X86,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X95,0XFF,
+0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,
+0X82,0XFF,0XFF,0X81,0X00,0X00,0X86,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X8C,
+0X00,0X00,0X84,0XFF,0XFF,0X00,0XFF,0XDF,0X82,0X00,0X00,0X01,0XFF,0XFF,0X18,0XC3,
+0X82,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,0X01,0XFF,0XFF,0X8C,0X51,0X82,0XFF,
+0XFF,0X81,0X00,0X00,0X87,0XFF,0XFF,0X8D,0X00,0X00,0X8E,0XFF,0XFF,0X81,0X00,0X00,
+0X8B,0XFF,0XFF,0X82,0X00,0X00,0X88,0XFF,0XFF,0X82,0X6B,0X6D,0X87,0X84,0X10,0X03,
+0X73,0XAE,0X6B,0X6D,0X6B,0X6D,0X73,0XAE,0X8D,0XFF,0XFF,0X84,0X00,0X00,0X8C,0XFF,
+0XFF,0X00,0X00,0X20,0X87,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X9A,0XFF,0XFF,
+0X81,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X87,
+0XFF,0XFF,0X00,0XB5,0XB6,0X82,0XFF,0XFF,0X8C,0X00,0X00,0X86,0XFF,0XFF,0X02,0X00,
+0X20,0XFF,0XFF,0XFF,0XFF,0X83,0X00,0X00,0X00,0XFF,0XFF,0X82,0X00,0X00,0X06,0XFF,
+0XDF,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0XA4,0XFF,0XFF,
+0X81,0X00,0X00,0X8B,0XFF,0XFF,0X82,0X00,0X00,0XA5,0XFF,0XFF,0X85,0X00,0X00,0X94,
+0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X9A,0XFF,0XFF,0X8C,0X00,0X00,0X90,0XFF,
+0XFF,0X82,0X00,0X00,0X8D,0XFF,0XFF,0X88,0X00,0X00,0X06,0XFF,0XFF,0XEF,0X5D,0X00,
+0X00,0X00,0X20,0X00,0X20,0X00,0X00,0XE7,0X1C,0X84,0XFF,0XFF,0X88,0X00,0X00,0X81,
+0XFF,0XFF,0X88,0X00,0X00,0X8B,0XFF,0XFF,0X81,0X00,0X00,0X8B,0XFF,0XFF,0X82,0X00,
+0X00,0X84,0XFF,0XFF,0X00,0X31,0X86,0X94,0X00,0X00,0X89,0XFF,0XFF,0X06,0X31,0XA6,
+0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,0X00,0X8D,0XFF,0XFF,0X90,
+0X00,0X00,0X94,0XFF,0XFF,0X96,0XFF,0XFF,0X03,0X7B,0XEF,0XFF,0XDF,0XFF,0XFF,0XFF,
+0XFF,0X8C,0X00,0X00,0X87,0XFF,0XFF,0X00,0X00,0X00,0X87,0XFF,0XFF,0X82,0X00,0X00,
+0X8B,0XFF,0XFF,0X04,0X00,0X00,0XFF,0XFF,0X00,0X00,0X00,0X00,0XF7,0X9E,0X83,0X00,
+0X00,0X07,0X8C,0X71,0X00,0X00,0X00,0X00,0XFF,0XFF,0X00,0X20,0XFF,0XFF,0X00,0X00,
+0X00,0X00,0X85,0XFF,0XFF,0X88,0X00,0X00,0X81,0XFF,0XFF,0X88,0X00,0X00,0X8B,0XFF,
+0XFF,0X81,0X00,0X00,0X8B,0XFF,0XFF,0X02,0X00,0X20,0X00,0X00,0X00,0X00,0X84,0XFF,
+0XFF,0X00,0X39,0XC7,0X94,0X00,0X00,0X89,0XFF,0XFF,0X82,0X00,0X00,0X81,0XFF,0XFF,
+0X82,0X00,0X00,0X00,0XFF,0XDF,0X8B,0XFF,0XFF,0X90,0X00,0X00,0X94,0XFF,0XFF,0X96,
+0XFF,0XFF,0X81,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,
+0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X86,0XFF,0XFF,0X02,0XFF,0XDF,0X00,0X00,0X00,
+0X20,0X86,0XFF,0XFF,0X82,0X00,0X00,0X8B,0XFF,0XFF,0X81,0X00,0X00,0X81,0XFF,0XFF,
+0X09,0XF7,0X9E,0X00,0X00,0X00,0X00,0XCE,0X79,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,
+0X00,0XFF,0XFF,0XFF,0XFF,0X82,0X00,0X00,0X85,0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,
+0XFF,0X81,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,
+0X8B,0XFF,0XFF,0X90,0X00,0X00,0X84,0XFF,0XFF,0X02,0X39,0XC7,0X00,0X00,0X00,0X00,
+0X8F,0XFF,0XFF,0X82,0X00,0X00,0X88,0XFF,0XFF,0X02,0X52,0X8A,0X00,0X00,0X00,0X00,
+0X83,0XFF,0XFF,0X81,0X00,0X00,0X93,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X95,
+0XFF,0XFF,0X06,0XAD,0X55,0X00,0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0X00,0X00,0X00,
+0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X86,0XFF,0XFF,
+0X82,0X00,0X00,0X00,0XFF,0XFF,0X8E,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X05,
+0X00,0X20,0XFF,0XFF,0XFF,0XFF,0XEF,0X7D,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X06,
+0X42,0X28,0X00,0X00,0X00,0X00,0XFF,0XFF,0X00,0X00,0X00,0X00,0XFF,0XDF,0X85,0XFF,
+0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,
+0X84,0XFF,0XFF,0X81,0X00,0X00,0X8B,0XFF,0XFF,0X90,0X00,0X00,0X84,0XFF,0XFF,0X02,
+0X31,0X86,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X89,0X00,0X00,0X82,0XFF,0XFF,0X82,
+0X00,0X00,0X87,0XFF,0XFF,0X03,0XFF,0XDF,0X00,0X00,0X00,0X00,0X00,0X20,0X83,0XFF,
+0XFF,0X82,0X00,0X00,0X92,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X95,0XFF,0XFF,
+0X82,0X00,0X00,0X81,0XFF,0XFF,0X8C,0X00,0X00,0X85,0XFF,0XFF,0X04,0XF7,0XBE,0X00,
+0X00,0X00,0X00,0XFF,0XFF,0XFF,0XFF,0X8E,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,
+0X82,0XFF,0XFF,0X02,0XEF,0X7D,0X00,0X00,0X00,0X00,0X83,0XFF,0XFF,0X83,0X00,0X00,
+0X00,0X31,0XA6,0X86,0XFF,0XFF,0X88,0X00,0X00,0X81,0XFF,0XFF,0X88,0X00,0X00,0XA3,
+0XFF,0XFF,0X00,0XFF,0XDF,0X82,0XFF,0XFF,0X89,0X00,0X00,0X84,0XFF,0XFF,0X00,0XFF,
+0XDF,0X87,0XFF,0XFF,0X82,0X00,0X00,0X00,0XFF,0XDF,0X84,0XFF,0XFF,0X82,0X00,0X00,
+0X91,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X94,0XFF,0XFF,0X02,0X94,0XB2,0X00,
+0X00,0X00,0X00,0X82,0XFF,0XFF,0X8C,0X00,0X00,0X85,0XFF,0XFF,0X82,0X00,0X00,0X81,
+0XFF,0XFF,0X8E,0X00,0X00,0X83,0XFF,0XFF,0X02,0XFF,0XDF,0X00,0X00,0X00,0X00,0X82,
+0XFF,0XFF,0X02,0XEF,0X7D,0X00,0X00,0X00,0X00,0X84,0XFF,0XFF,0X82,0X00,0X00,0X87,
+0XFF,0XFF,0X88,0X00,0X00,0X81,0XFF,0XFF,0X88,0X00,0X00,0X8B,0XFF,0XFF,0X81,0X00,
+0X00,0X87,0XFF,0XFF,0X00,0X52,0XAA,0X82,0XFF,0XFF,0X02,0X21,0X24,0X00,0X00,0X00,
+0X00,0X8A,0XFF,0XFF,0X81,0X00,0X00,0X85,0XFF,0XFF,0X81,0X00,0X00,0X8C,0XFF,0XFF,
+0X83,0X00,0X00,0X85,0XFF,0XFF,0X82,0X00,0X00,0X00,0X00,0X20,0X90,0XFF,0XFF,0X81,
+0X00,0X00,0X9C,0XFF,0XFF,0X94,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,
+0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,
+0X02,0XCE,0X79,0X00,0X00,0X00,0X00,0X88,0XFF,0XFF,0X82,0X00,0X00,0X89,0XFF,0XFF,
+0X02,0X00,0X20,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X02,0XEF,0X7D,0X00,0X00,0X00,
+0X00,0X83,0XFF,0XFF,0X83,0X00,0X00,0X00,0XDE,0XDB,0X86,0XFF,0XFF,0X81,0X00,0X00,
+0X84,0XFF,0XFF,0X81,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,0X81,
+0X00,0X00,0X8A,0XFF,0XFF,0X82,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,0X02,0X08,
+0X61,0XFF,0XFF,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,0X00,0XD6,
+0X9A,0X88,0XFF,0XFF,0X82,0X00,0X00,0X85,0XFF,0XFF,0X81,0X00,0X00,0X83,0XFF,0XFF,
+0X00,0X00,0X00,0X86,0XFF,0XFF,0X83,0X00,0X00,0X87,0XFF,0XFF,0X83,0X00,0X00,0X8F,
+0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X93,0XFF,0XFF,0X82,0X00,0X00,0X83,0XFF,
+0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X81,0X00,0X00,
+0X84,0XFF,0XFF,0X82,0X00,0X00,0X88,0XFF,0XFF,0X82,0X00,0X00,0X89,0XFF,0XFF,0X81,
+0X00,0X00,0X83,0XFF,0XFF,0X02,0XEF,0X7D,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X86,
+0X00,0X00,0X85,0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X81,0XFF,
+0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X89,0XFF,0XFF,0X05,0XFF,0XDF,
+0X00,0X00,0X00,0X00,0XFF,0XDF,0XFF,0XFF,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,
+0X81,0X00,0X00,0X82,0XFF,0XFF,0X02,0X00,0X20,0X00,0X00,0X00,0X00,0X87,0XFF,0XFF,
+0X03,0X6B,0X4D,0X00,0X00,0X00,0X00,0XBD,0XD7,0X85,0XFF,0XFF,0X81,0X00,0X00,0X83,
+0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,0XFF,0X83,0X00,0X00,0X89,0XFF,0XFF,0X83,0X00,
+0X00,0X8E,0XFF,0XFF,0X81,0X00,0X00,0X9C,0XFF,0XFF,0X93,0XFF,0XFF,0X81,0X00,0X00,
+0X00,0X08,0X41,0X83,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,
+0XFF,0XFF,0X81,0X00,0X00,0X83,0XFF,0XFF,0X82,0X00,0X00,0X89,0XFF,0XFF,0X82,0X00,
+0X00,0X88,0XFF,0XFF,0X82,0X00,0X00,0X83,0XFF,0XFF,0X03,0XEF,0X7D,0X00,0X00,0X00,
+0X00,0XFF,0XFF,0X83,0X00,0X00,0X81,0XFF,0XFF,0X00,0X00,0X20,0X82,0X00,0X00,0X84,
+0XFF,0XFF,0X88,0X00,0X00,0X81,0XFF,0XFF,0X88,0X00,0X00,0X89,0XFF,0XFF,0X82,0X00,
+0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X82,0XFF,0XFF,
+0X82,0X00,0X00,0X84,0XFF,0XFF,0X00,0X5A,0XEB,0X82,0X00,0X00,0X00,0X00,0X20,0X86,
+0XFF,0XFF,0X81,0X00,0X00,0X05,0XE7,0X3C,0XFF,0XFF,0XFF,0XFF,0X31,0XA6,0X00,0X00,
+0X00,0X00,0X82,0XFF,0XFF,0X00,0XD6,0XBA,0X83,0X00,0X00,0X8B,0XFF,0XFF,0X00,0X00,
+0X20,0X83,0X00,0X00,0X82,0XFF,0XFF,0X95,0X00,0X00,0X92,0XFF,0XFF,0X93,0XFF,0XFF,
+0X81,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,0XFF,0X82,0X00,0X00,0X00,
+0XFF,0XFF,0X83,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X89,0XFF,0XFF,0X82,0X00,
+0X00,0X89,0XFF,0XFF,0X00,0X00,0X00,0X84,0XFF,0XFF,0X00,0XE7,0X3C,0X85,0X00,0X00,
+0X00,0XF7,0XBE,0X83,0XFF,0XFF,0X82,0X00,0X00,0X83,0XFF,0XFF,0X88,0X00,0X00,0X81,
+0XFF,0XFF,0X88,0X00,0X00,0X88,0XFF,0XFF,0X82,0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,
+0X00,0X82,0XFF,0XFF,0X02,0XF7,0XBE,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X02,0XFF,
+0XDF,0X00,0X00,0X00,0X00,0X82,0XFF,0XFF,0X00,0X21,0X24,0X84,0X00,0X00,0X87,0XFF,
+0XFF,0X86,0X00,0X00,0X00,0X10,0XA2,0X82,0XFF,0XFF,0X82,0X00,0X00,0X00,0X00,0X20,
+0X8D,0XFF,0XFF,0X00,0X7B,0XCF,0X82,0X00,0X00,0X82,0XFF,0XFF,0X95,0X00,0X00,0X92,
+0XFF,0XFF,0X94,0XFF,0XFF,0X00,0XC6,0X38,0X84,0XFF,0XFF,0X81,0X00,0X00,0X82,0XFF,
+0XFF,0X82,0X00,0X00,0X00,0XFF,0XFF,0X83,0X00,0X00,0X85,0XFF,0XFF,0X00,0XFF,0XDF,
+0X89,0XFF,0XFF,0X82,0X00,0X00,0X8F,0XFF,0XFF,0X04,0XE7,0X3C,0X00,0X00,0X00,0X00,
+0XF7,0XBE,0X00,0X00,0X86,0XFF,0XFF,0X01,0XFF,0XDF,0X00,0X00,0X84,0XFF,0XFF,0X81,
+0X00,0X00,0X84,0XFF,0XFF,0X81,0X00,0X00,0X81,0XFF,0XFF,0X81,0X00,0X00,0X84,0XFF,
+0XFF,0X81,0X00,0X00,0X89,0XFF,0XFF,0X00,0X00,0X00,0X85,0XFF,0XFF,0X81,0X00,0X00,
+0X83,0XFF,0XFF,0X00,0X00,0X00,0X84,0XFF,0XFF,0X01,0X00,0X00,0XFF,0XDF,0X83,0XFF,
+0XFF,0X81,0X00,0X00,0X00,0X8C,0X51,0X8A,0XFF,0XFF,0X84,0X00,0X00,0X00,0XDE,0XDB,
+0X84,0XFF,0XFF,0X01,0X00,0X00,0XF7,0X9E,0X90,0XFF,0XFF,0X00,0X00,0X00,0XAC,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
+0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,
+0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,
+0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,0XFF,0XFF,0XFF,0XFF,0XEF,0XFF,
+0XFF,
+};
+
+#endif
@@ -3,6 +3,7 @@
 #include "Inc/CST816.h"
 #include "stdlib.h"
 #include "Inc/pic.h"
+#include "Inc/pic_rle.h"
 #include "pico/time.h"
 #include <stdio.h>
 
@@ -29,15 +30,20 @@ uint32_t g_state_timer = 0;
 uint8_t g_img_index = 0;
 uint8_t color_full_index = 0;
 uint8_t g_countdown = 3;
-extern const uint8_t gImage_logo[];
+extern const uint8_t gImage_logo_rle[];
 
 uint8_t IsTouchInButton(uint16_t x, uint16_t y);
 
 void LCD_DEMO(void)
 {
+    LCD_Image logo;
+
     LCD_Init();
     CST816_Init();
     LCD_Fill(0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK);
+#if USE_FRAMEBUFFER
+    LCD_Present();
+#endif
     sleep_ms(100);
     LCD_BLK_Set(); // 򿪱
 
@@ -51,7 +57,8 @@ void LCD_DEMO(void)
         switch (g_state)
         {
         case STATE_LOGO:
-            LCD_ShowPicture(0, 29, 239, 219, gImage_logo);
+            if (LCD_Image_Open(&logo, gImage_logo_rle) == 0) // ѹͼƬ,ȡͷ
+                LCD_ShowImage(0, 29, &logo);
 
             if (get_tick() - g_state_timer > LOGO_DURATION)
             {
@@ -181,6 +188,9 @@ void LCD_DEMO(void)
             }
             break;
         }
+#if USE_FRAMEBUFFER
+        LCD_Present(); // ѱֻƵˢµĻ
+#endif
     }
 }
 
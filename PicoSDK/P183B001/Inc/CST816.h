@@ -1,113 +0,0 @@
-#ifndef __CST816_H
-#define __CST816_H
-
-#include "stdint.h"
-#include "pico/stdlib.h"
-#include "Inc/iic_hal.h"
-
-/* CST816 dev pin defination */
-// PB8 PB9 ť
-
-#define TOUCH_RST_PIN 13 // Reset pin
-#define TOUCH_INT_PIN 9	 // Interrupt pin
-
-#define I2C0_SDA_PIN 11U
-#define I2C0_SCL_PIN 10U
-/* Function macros */
-#define TOUCH_RST_0 gpio_put(TOUCH_RST_PIN, 0)
-#define TOUCH_RST_1 gpio_put(TOUCH_RST_PIN, 1)
-
-/* 豸ַ */
-#define Device_Addr 0x15
-
-/* Ĵ */
-#define GestureID 0x01		// ʶ
-#define FingerNum 0x02		// ¼ָ
-#define XposH 0x03			// X λصļĴַ
-#define XposL 0x04			// X λֵļĴַ
-#define YposH 0x05			// Y λصļĴַ
-#define YposL 0x06			// Y λֵļĴַ
-#define ChipID 0xA7			// ʴоƬΨһʶĴĵַ
-#define SleepMode 0xE5		// ƴ˳˯ģʽļĴַ
-#define MotionMask 0xEC		// ĳЩ˶زλ
-#define IrqPluseWidth 0xED	// жϵصļĴַ
-#define NorScanPer 0xEE		// ɨصļĴַ
-#define MotionSlAngle 0xEF	// 漰˶Ƕ
-#define LpAutoWakeTime 0xF4 // Զʱ
-#define LpScanTH 0xF5		// ĳɨֵ
-#define LpScanWin 0xF6		// ĳɨ贰
-#define LpScanFreq 0xF7		// ĳɨƵ
-#define LpScanIdac 0xF8		// ɨ
-#define AutoSleepTime 0xF9	// Զ˯ģʽʱ
-#define IrqCtl 0xFA			// жϿ
-#define AutoReset 0xFB		// Զλ
-#define LongPressTime 0xFC	// ĳʱ
-#define IOCtl 0xFD			// 
-#define DisAutoSleep 0xFE	// ֹԶ˯ģʽ
-
-/* ṹ */
-typedef struct
-{
-	unsigned int X_Pos;
-	unsigned int Y_Pos;
-} CST816_Info; // 
-
-/* IDʶѡ*/
-typedef enum
-{
-	NOGESTURE = 0x00,	// ޲
-	DOWNGLIDE = 0x01,	// »
-	UPGLIDE = 0x02,		// ϻ
-	LEFTGLIDE = 0x03,	// 
-	RIGHTGLIDE = 0x04,	// һ
-	CLICK = 0x05,		// 
-	DOUBLECLICK = 0x0B, // ˫
-	LONGPRESS = 0x0C,	// 
-} GestureID_TypeDef;
-
-/* ѡ */
-typedef enum
-{
-	M_DISABLE = 0x00,	// Ҫκ
-	EnConLR = 0x01,		// һ
-	EnConUD = 0x02,		// »
-	EnDClick = 0x03,	// ˫
-	M_ALLENABLE = 0x07, // 
-} MotionMask_TypeDef;
-
-/* жϵ巢䷽ʽѡ */
-typedef enum
-{
-	OnceWLP = 0x00,	 // 巢
-	EnMotion = 0x10, // ˶仯
-	EnChange = 0x20, // ĳЩض仯
-	EnTouch = 0x40,	 // ¼
-	EnTest = 0x80,	 // жǷ
-} IrqCtl_TypeDef;
-
-extern CST816_Info CST816_Instance;
-
-/* ʼغ */
-void CST816_GPIO_Init(void);
-void CST816_RESET(void);
-void CST816_Init(void);
-
-/*  */
-void CST816_Get_XY_AXIS(void);
-uint8_t CST816_Get_ChipID(void);
-uint8_t CST816_Get_FingerNum(void);
-/* д */
-void CST816_IIC_WriteREG(uint8_t addr, uint8_t dat);
-uint8_t CST816_IIC_ReadREG(unsigned char addr);
-
-/* йزú */
-void CST816_Config_MotionMask(uint8_t mode);
-void CST816_Config_AutoSleepTime(uint8_t time);
-void CST816_Config_MotionSlAngle(uint8_t x_right_y_up_angle);
-void CST816_Config_NorScanPer(uint8_t Period);
-void CST816_Config_IrqPluseWidth(uint8_t Width);
-void CST816_Config_LpScanTH(uint8_t TH);
-void CST816_Wakeup(void);
-void CST816_Sleep(void);
-
-#endif
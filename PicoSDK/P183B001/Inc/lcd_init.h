@@ -5,6 +5,10 @@
 
 #define USE_HORIZONTAL 0 // úʾ 01Ϊ 23Ϊ
 
+#ifndef USE_FRAMEBUFFER
+#define USE_FRAMEBUFFER 0 // 0ֱд 1ȻRAM֡,LCD_Present()ˢ
+#endif
+
 #define LCD_SPI_PORT spi0
 #define LCD_MISO_PIN -1
 #define LCD_SCK_PIN 2
@@ -22,23 +26,11 @@
 #define LCD_W 284
 #define LCD_H 240
 #endif
+#define LCD_PIXEL_BYTES 2 // ÿط͵ֽ,RGB565
 
-//-----------------LCD˿ڶ----------------
-
-#define LCD_RES_Clr() gpio_put(LCD_RES_PIN, 0) // RES
-#define LCD_RES_Set() gpio_put(LCD_RES_PIN, 1)
-
-#define LCD_DC_Clr() gpio_put(LCD_DC_PIN, 0) // DC
-#define LCD_DC_Set() gpio_put(LCD_DC_PIN, 1)
-
-#define LCD_BLK_Clr() gpio_put(LCD_BLK_PIN, 0) // BLK
-#define LCD_BLK_Set() gpio_put(LCD_BLK_PIN, 1)
+#define LCD_TOUCH LCD_TOUCH_CST816 // оƬ
+#define LCD_TOUCH_FLIP_Y 1 // Yʾ෴
+#define LCD_TOUCH_OFFSET_Y -5 // תYʾƫ
 
-// void LCD_GPIO_Init(void);//ʼGPIO
-// void LCD_Writ_Bus(uint8_t dat);//ģSPIʱ
-// void LCD_WR_DATA8(uint8_t dat);//дһֽ
-void LCD_WR_DATA(uint16_t dat); // дֽ
-// void LCD_WR_REG(uint8_t dat);//дһָ
-void LCD_Address_Set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2); // 꺯
-void LCD_Init(void);                                                      // LCDʼ
+#include "Inc/lcd_panel.h" // ˿ڶӿ,Ļ,lcd_core
 #endif
@@ -2,16 +2,29 @@
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
 #include "Inc/lcd_demo.h"
+#include "Inc/lcd_init.h"
+#include "Inc/lcd_bench.h"
 #include "hardware/clocks.h"
 // SPI Defines
 // We are going to use SPI 0, and allocate it to the following GPIO pins
 // Pins can be changed, see the GPIO function select table in the datasheet for information on GPIO assignments
 
+#ifndef LCD_BENCH
+#define LCD_BENCH 0 // 1: run LCD_Bench_Run() instead of the demo, set by cmake -DLCD_BENCH=ON
+#endif
+
 int main()
 {
     // stdio_init_all();
     set_sys_clock_khz(133000, true);
+#if LCD_BENCH
+    stdio_init_all();
+    sleep_ms(2000); // Give the USB serial port time to enumerate before printing
+    LCD_Init();
+    LCD_Bench_Run(NULL);
+#else
     LCD_DEMO();
+#endif
     while (true)
     {
         sleep_ms(1000);
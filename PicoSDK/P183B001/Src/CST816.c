@@ -1,246 +0,0 @@
-#include "Inc/CST816.h"
-#include "Inc/lcd_init.h"
-
-#define TOUCH_OFFSET_Y 5
-#define REVERSE 1
-
-iic_bus_t CST816_dev =
-	{
-		.sda_pin = I2C0_SDA_PIN,
-		.scl_pin = I2C0_SCL_PIN,
-};
-
-CST816_Info CST816_Instance;
-
-/*
-*********************************************************************************************************
-*	  : CST816_GPIO_Init
-*	˵: CST816 GPIOڳʼ
-*	    Σnone
-*	  ֵ: none
-*********************************************************************************************************
-*/
-void CST816_GPIO_Init(void)
-{
-	gpio_init(TOUCH_RST_PIN);
-	gpio_set_function(TOUCH_RST_PIN, GPIO_FUNC_SIO);
-	gpio_set_dir(TOUCH_RST_PIN, GPIO_OUT);
-	gpio_put(TOUCH_RST_PIN, 1);
-
-	/* Initialize I2C pins */
-	IICInit(&CST816_dev);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Init
-*	˵: CST816ʼ
-*	    Σnone
-*	  ֵ: none
-*********************************************************************************************************
-*/
-void CST816_Init(void)
-{
-	CST816_GPIO_Init();
-	CST816_Config_AutoSleepTime(5);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_IIC_ReadREG
-*	˵: ȡĴ
-*	    ΣregĴַ
-*	  ֵ: ؼĴ洢
-*********************************************************************************************************
-*/
-uint8_t CST816_IIC_ReadREG(uint8_t addr)
-{
-	return IIC_Read_One_Byte(&CST816_dev, Device_Addr, addr);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_IIC_WriteREG
-*	˵: ļĴд
-*	    ΣaddrĴַ
-*						dat:	д
-*	  ֵ: ؼĴ洢
-*********************************************************************************************************
-*/
-void CST816_IIC_WriteREG(uint8_t addr, uint8_t dat)
-{
-	IIC_Write_One_Byte(&CST816_dev, Device_Addr, addr, dat);
-}
-
-/*
-*********************************************************************************************************
-*	  : TOUCH_RESET
-*	˵: λ
-*	    Σ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_RESET(void)
-{
-	TOUCH_RST_0;
-	sleep_ms(10);
-	TOUCH_RST_1;
-	sleep_ms(100);
-}
-
-/*
-*********************************************************************************************************
-*	  : TOUCH_READ_X
-*	˵: ȡڴʱֵ
-*	    Σ
-*	  ֵ:  ݴ洢CST816_InstanceṹУ
-*********************************************************************************************************
-*/
-void CST816_Get_XY_AXIS(void)
-{
-	uint8_t DAT[4];
-	IIC_Read_Multi_Byte(&CST816_dev, Device_Addr, XposH, 4, DAT);
-	CST816_Instance.X_Pos = ((DAT[0] & 0x0F) << 8) | DAT[1];				  //(temp[0]&0X0F)<<4|
-	CST816_Instance.Y_Pos = ((DAT[2] & 0x0F) << 8) | DAT[3] + TOUCH_OFFSET_Y; //(temp[2]&0X0F)<<4|
-#if REVERSE
-	// CST816_Instance.X_Pos = LCD_W -1 - CST816_Instance.X_Pos;
-	CST816_Instance.Y_Pos = LCD_H -1 - CST816_Instance.Y_Pos;
-#endif
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Get_FingerNum
-*	˵: ȡָ,0xFFΪ˯
-*	    Σ
-*	  ֵ: оƬID
-*********************************************************************************************************
-*/
-uint8_t CST816_Get_FingerNum(void)
-{
-	return CST816_IIC_ReadREG(FingerNum);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Get_ChipID
-*	˵: ȡоƬID
-*	    Σ
-*	  ֵ: оƬID
-*********************************************************************************************************
-*/
-uint8_t CST816_Get_ChipID(void)
-{
-	return CST816_IIC_ReadREG(ChipID);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Config_MotionMask
-*	˵: ʹһ»˫
-*	    Σmodeģʽ(5)
-*	  ֵ: 
-*	ע    ⣺ʹӦʱ
-*********************************************************************************************************
-*/
-void CST816_Config_MotionMask(uint8_t mode)
-{
-	CST816_IIC_WriteREG(MotionMask, mode);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Config_AutoSleepTime
-*	˵: 涨time޴Զ͹ģʽ
-*	    Σtimeʱ(s)
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Config_AutoSleepTime(uint8_t time)
-{
-	CST816_IIC_WriteREG(AutoSleepTime, time);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Sleep
-*	˵: ˯ߣ޴ѹ
-*	    Σ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Sleep(void)
-{
-	CST816_IIC_WriteREG(SleepMode, 0x03);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Wakeup
-*	˵: 
-*	    Σ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Wakeup(void)
-{
-	CST816_RESET();
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Config_MotionSlAngle
-*	˵: Ƽ⻬ǶȿơAngle=tan(c)*10 cΪxΪ׼ĽǶȡ
-*	    Σx_right_y_up_angleǶֵ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Config_MotionSlAngle(uint8_t x_right_y_up_angle)
-{
-	CST816_IIC_WriteREG(MotionSlAngle, x_right_y_up_angle);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Config_NorScanPer
-*	˵: ټú
-*						ֵӰ쵽LpAutoWakeTimeAutoSleepTime
-*						λ10msѡֵ130ĬֵΪ1
-*	    ΣPeriodֵ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Config_NorScanPer(uint8_t Period)
-{
-	if (Period >= 30)
-		Period = 30;
-	CST816_IIC_WriteREG(NorScanPer, Period);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Config_IrqPluseWidth
-*	˵: жϵú
-*	    ΣPeriodֵ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Config_IrqPluseWidth(uint8_t Width)
-{
-	if (Width >= 200)
-		Width = 200;
-	CST816_IIC_WriteREG(IrqPluseWidth, Width);
-}
-
-/*
-*********************************************************************************************************
-*	  : CST816_Config_NorScanPer
-*	˵: ͹ɨ軽úԽСԽĬֵ48
-*	    ΣTHֵ
-*	  ֵ: 
-*********************************************************************************************************
-*/
-void CST816_Config_LpScanTH(uint8_t TH)
-{
-	CST816_IIC_WriteREG(LpScanTH, TH);
-}
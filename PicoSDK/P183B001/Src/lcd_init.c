@@ -1,208 +0,0 @@
-#include "Inc/lcd_init.h"
-#include "hardware/spi.h"
-
-static void LCD_GPIO_Init(void)
-{
-	gpio_set_function(LCD_CS_PIN, GPIO_FUNC_SPI);
-	gpio_set_function(LCD_SCK_PIN, GPIO_FUNC_SPI);
-	gpio_set_function(LCD_MOSI_PIN, GPIO_FUNC_SPI);
-
-	spi_init(LCD_SPI_PORT, 4 * 1000 * 1000);
-	spi_set_format(LCD_SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
-	spi_set_slave(LCD_SPI_PORT, false);
-
-	gpio_set_function(LCD_RES_PIN, GPIO_FUNC_SIO);
-	gpio_set_function(LCD_DC_PIN, GPIO_FUNC_SIO);
-	gpio_set_function(LCD_BLK_PIN, GPIO_FUNC_SIO);
-
-	gpio_set_dir(LCD_RES_PIN, GPIO_OUT);
-	gpio_set_dir(LCD_DC_PIN, GPIO_OUT);
-	gpio_set_dir(LCD_BLK_PIN, GPIO_OUT);
-
-	gpio_put(LCD_RES_PIN, 1);
-	gpio_put(LCD_DC_PIN, 1);
-	gpio_put(LCD_BLK_PIN, 0);
-}
-/******************************************************************************
-	  ˵LCDд뺯
-	  ݣdat  ҪдĴ
-	  ֵ  
-******************************************************************************/
-static inline void LCD_Writ_Bus(uint8_t dat)
-{
-	spi_write_blocking(LCD_SPI_PORT, &dat, 1);
-}
-
-/******************************************************************************
-	  ˵LCDд
-	  ݣdat д
-	  ֵ  
-******************************************************************************/
-static inline void LCD_WR_DATA8(uint8_t dat)
-{
-	LCD_Writ_Bus(dat);
-}
-
-/******************************************************************************
-	  ˵LCDд
-	  ݣdat д
-	  ֵ  
-******************************************************************************/
-inline void LCD_WR_DATA(uint16_t dat)
-{
-	LCD_Writ_Bus(dat >> 8);
-	LCD_Writ_Bus(dat);
-}
-
-/******************************************************************************
-	  ˵LCDд
-	  ݣdat д
-	  ֵ  
-******************************************************************************/
-static inline void LCD_WR_REG(uint8_t dat)
-{
-	LCD_DC_Clr(); // д
-	LCD_Writ_Bus(dat);
-	LCD_DC_Set();
-}
-
-/******************************************************************************
-	  ˵ʼͽַ
-	  ݣx1,x2 еʼͽַ
-				y1,y2 еʼͽַ
-	  ֵ  
-******************************************************************************/
-void LCD_Address_Set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
-{
-	if (USE_HORIZONTAL == 0)
-	{
-		LCD_WR_REG(0x2a); // еַ
-		LCD_WR_DATA(x1);
-		LCD_WR_DATA(x2);
-		LCD_WR_REG(0x2b); // еַ
-		LCD_WR_DATA(y1);
-		LCD_WR_DATA(y2);
-		LCD_WR_REG(0x2c); // д
-	}
-	else if (USE_HORIZONTAL == 1)
-	{
-		LCD_WR_REG(0x2a); // еַ
-		LCD_WR_DATA(x1);
-		LCD_WR_DATA(x2);
-		LCD_WR_REG(0x2b); // еַ
-		LCD_WR_DATA(y1);
-		LCD_WR_DATA(y2);
-		LCD_WR_REG(0x2c); // д
-	}
-	else if (USE_HORIZONTAL == 2)
-	{
-		LCD_WR_REG(0x2a); // еַ
-		LCD_WR_DATA(x1);
-		LCD_WR_DATA(x2);
-		LCD_WR_REG(0x2b); // еַ
-		LCD_WR_DATA(y1);
-		LCD_WR_DATA(y2);
-		LCD_WR_REG(0x2c); // д
-	}
-	else
-	{
-		LCD_WR_REG(0x2a); // еַ
-		LCD_WR_DATA(x1);
-		LCD_WR_DATA(x2);
-		LCD_WR_REG(0x2b); // еַ
-		LCD_WR_DATA(y1);
-		LCD_WR_DATA(y2);
-		LCD_WR_REG(0x2c); // д
-	}
-}
-
-void LCD_Init(void)
-{
-	LCD_GPIO_Init(); // ʼGPIO
-
-	LCD_RES_Clr(); // λ
-	sleep_ms(100);
-	LCD_RES_Set();
-	sleep_ms(100);
-
-	//************* Start Initial Sequence **********//
-	LCD_WR_REG(0x11); // Sleep out
-	sleep_ms(120);	  // Delay 120ms
-	//************* Start Initial Sequence **********//
-	LCD_WR_REG(0x36);
-	if (USE_HORIZONTAL == 0)
-		LCD_WR_DATA8(0x00);
-	else if (USE_HORIZONTAL == 1)
-		LCD_WR_DATA8(0xC0);
-	else if (USE_HORIZONTAL == 2)
-		LCD_WR_DATA8(0x70);
-	else
-		LCD_WR_DATA8(0xA0);
-
-	LCD_WR_REG(0x3A);
-	LCD_WR_DATA8(0x05);
-
-	LCD_WR_REG(0xB2);
-	LCD_WR_DATA8(0x0C);
-	LCD_WR_DATA8(0x0C);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x33);
-	LCD_WR_DATA8(0x33);
-
-	LCD_WR_REG(0xB7);
-	LCD_WR_DATA8(0x35);
-
-	LCD_WR_REG(0xBB);
-	LCD_WR_DATA8(0x32); // Vcom=1.35V
-
-	LCD_WR_REG(0xC2);
-	LCD_WR_DATA8(0x01);
-
-	LCD_WR_REG(0xC3);
-	LCD_WR_DATA8(0x15); // GVDD=4.8V  ɫ
-
-	LCD_WR_REG(0xC4);
-	LCD_WR_DATA8(0x20); // VDV, 0x20:0v
-
-	LCD_WR_REG(0xC6);
-	LCD_WR_DATA8(0x0F); // 0x0F:60Hz
-
-	LCD_WR_REG(0xD0);
-	LCD_WR_DATA8(0xA4);
-	LCD_WR_DATA8(0xA1);
-
-	LCD_WR_REG(0xE0);
-	LCD_WR_DATA8(0xD0);
-	LCD_WR_DATA8(0x08);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x09);
-	LCD_WR_DATA8(0x09);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x31);
-	LCD_WR_DATA8(0x33);
-	LCD_WR_DATA8(0x48);
-	LCD_WR_DATA8(0x17);
-	LCD_WR_DATA8(0x14);
-	LCD_WR_DATA8(0x15);
-	LCD_WR_DATA8(0x31);
-	LCD_WR_DATA8(0x34);
-
-	LCD_WR_REG(0xE1);
-	LCD_WR_DATA8(0xD0);
-	LCD_WR_DATA8(0x08);
-	LCD_WR_DATA8(0x0E);
-	LCD_WR_DATA8(0x09);
-	LCD_WR_DATA8(0x09);
-	LCD_WR_DATA8(0x15);
-	LCD_WR_DATA8(0x31);
-	LCD_WR_DATA8(0x33);
-	LCD_WR_DATA8(0x48);
-	LCD_WR_DATA8(0x17);
-	LCD_WR_DATA8(0x14);
-	LCD_WR_DATA8(0x15);
-	LCD_WR_DATA8(0x31);
-	LCD_WR_DATA8(0x34);
-	LCD_WR_REG(0x21);
-
-	LCD_WR_REG(0x29);
-}
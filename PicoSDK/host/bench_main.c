@@ -0,0 +1,34 @@
+/*
+ * Host runner for LCD_Bench_Run(): the panel library against the mock SDK,
+ * with SPI byte and command counts taken from the simulated panel.
+ * Times measure the host CPU, not the RP2040; the counts are exact.
+ */
+#include <stdio.h>
+#include "mock_hal.h"
+#include "Inc/lcd.h"
+#include "Inc/lcd_bench.h"
+#include "Inc/pic.h"
+#include "Inc/pic_rle.h"
+
+static void host_counter(LCD_Bench_Count *count)
+{
+    mock_panel_stats_t s = mock_panel_stats();
+    count->bytes = s.bytes;
+    count->commands = s.commands;
+}
+
+int main(void)
+{
+    mock_hal_reset();
+    mock_hal_set_dc_pin(LCD_DC_PIN);
+    mock_panel_init(MOCK_GRAM_W, MOCK_GRAM_H);
+    LCD_Init();
+    LCD_Bench_Run(host_counter);
+    if (mock_hal_violations() || mock_panel_stats().clipped)
+    {
+        printf("mock: %u ordering violations, %u pixels outside GRAM\n",
+               (unsigned)mock_hal_violations(), (unsigned)mock_panel_stats().clipped);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Host check for LCD_ShowBMP(): the same picture is stored top-down and
+ * bottom-up (the BMP default, sent through the MADCTL row flip in portrait)
+ * and both must land on the expected screen pixels, also when clipped at the
+ * screen edges. Exits 1 on any difference.
+ *
+ * The row offsets of the two portrait directions are the GRAM rows above and
+ * below the visible area, so the mock GRAM is sized from lcd_panel; a flipped
+ * window that keeps the unflipped offset then shows up as shifted rows.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "mock_hal.h"
+#include "Inc/lcd.h"
+#include "Inc/lcd_bmp.h"
+#include "Inc/lcd_dma.h"
+
+#define PIC_W 37 /* odd, so each 24-bit row carries padding */
+#define PIC_H 50
+#define PIC_STRIDE ((PIC_W * 3 + 3) & ~3)
+
+static uint8_t file[54 + PIC_STRIDE * PIC_H];
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+/* BGR888 colour of picture pixel (col, row), row 0 at the top */
+static void pic_color(int col, int row, uint8_t *r, uint8_t *g, uint8_t *b)
+{
+    *r = col * 7;
+    *g = row * 5;
+    *b = (col + row) * 3;
+}
+
+static void make_bmp(int bottom_up)
+{
+    memset(file, 0, sizeof(file));
+    file[0] = 'B';
+    file[1] = 'M';
+    put32(file + 2, sizeof(file));
+    put32(file + 10, 54);
+    put32(file + 14, 40);
+    put32(file + 18, PIC_W);
+    put32(file + 22, bottom_up ? PIC_H : (uint32_t)-PIC_H);
+    file[26] = 1;
+    file[28] = 24;
+    for (int row = 0; row < PIC_H; row++)
+    {
+        uint8_t *p = file + 54 + (bottom_up ? PIC_H - 1 - row : row) * PIC_STRIDE;
+
+        for (int col = 0; col < PIC_W; col++, p += 3)
+            pic_color(col, row, &p[2], &p[1], &p[0]);
+    }
+}
+
+static int show(const char *name, int16_t x, int16_t y, int bottom_up)
+{
+    LCD_BMP_Mem mem = {file, sizeof(file), 0};
+    LCD_BMP bmp;
+    uint16_t xo = lcd_panel.x_off[USE_HORIZONTAL], yo = lcd_panel.y_off[USE_HORIZONTAL];
+    int n = 0;
+
+    LCD_Fill(0, 0, LCD_W - 1, LCD_H - 1, BLACK);
+    make_bmp(bottom_up);
+    if (LCD_BMP_Open(&bmp, LCD_BMP_MemRead, &mem) || LCD_ShowBMP(x, y, &bmp, LCD_BMP_MemRead, &mem))
+    {
+        printf("%-24s read error\n", name);
+        return 1;
+    }
+#if USE_FRAMEBUFFER
+    LCD_Present();
+#endif
+    LCD_DMA_Wait();
+    for (int sy = 0; sy < LCD_H; sy++)
+        for (int sx = 0; sx < LCD_W; sx++)
+        {
+            uint16_t want = BLACK;
+            uint8_t r, g, b;
+
+            if (sx >= x && sx < x + PIC_W && sy >= y && sy < y + PIC_H)
+            {
+                pic_color(sx - x, sy - y, &r, &g, &b);
+                want = RGB(r, g, b);
+            }
+            n += mock_panel_pixel565(sx + xo, sy + yo) != want;
+        }
+    printf("%-24s %6d pixels differ\n", name, n);
+    return n != 0 || mock_panel_madctl() != lcd_panel.madctl[USE_HORIZONTAL];
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    mock_hal_reset();
+    mock_hal_set_dc_pin(LCD_DC_PIN);
+    mock_panel_init(LCD_W + lcd_panel.x_off[USE_HORIZONTAL],
+                    LCD_H + lcd_panel.y_off[USE_HORIZONTAL] + lcd_panel.y_off[USE_HORIZONTAL ^ 1]);
+    LCD_Init();
+
+    for (int bottom_up = 0; bottom_up < 2; bottom_up++)
+    {
+        const char *order = bottom_up ? "bottom-up" : "top-down";
+        char name[32];
+
+        snprintf(name, sizeof(name), "%s inside", order);
+        failed |= show(name, 13, LCD_H / 2, bottom_up);
+        snprintf(name, sizeof(name), "%s top-left", order);
+        failed |= show(name, -5, -7, bottom_up);
+        snprintf(name, sizeof(name), "%s bottom-right", order);
+        failed |= show(name, LCD_W - 20, LCD_H - 30, bottom_up);
+    }
+    if (mock_hal_violations() || mock_panel_stats().clipped)
+    {
+        printf("mock: %u ordering violations, %u pixels outside GRAM\n",
+               (unsigned)mock_hal_violations(), (unsigned)mock_panel_stats().clipped);
+        failed = 1;
+    }
+    return failed;
+}
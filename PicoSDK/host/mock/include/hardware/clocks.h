@@ -0,0 +1,6 @@
+#ifndef _MOCK_HARDWARE_CLOCKS_H
+#define _MOCK_HARDWARE_CLOCKS_H
+
+#include "pico/stdlib.h"
+
+#endif
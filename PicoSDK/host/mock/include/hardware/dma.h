@@ -0,0 +1,90 @@
+#ifndef _MOCK_HARDWARE_DMA_H
+#define _MOCK_HARDWARE_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NUM_DMA_CHANNELS 12
+
+enum dma_channel_transfer_size
+{
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+#define DREQ_FORCE 0x3f
+
+typedef struct
+{
+    enum dma_channel_transfer_size size;
+    bool read_increment;
+    bool write_increment;
+    unsigned int dreq;
+    unsigned int ring_size_bits;
+    bool ring_write;
+    unsigned int chain_to;
+    bool bswap;
+    bool enable;
+} dma_channel_config;
+
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(unsigned int channel);
+dma_channel_config dma_channel_get_default_config(unsigned int channel);
+dma_channel_config dma_get_channel_config(unsigned int channel);
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->read_increment = incr;
+}
+
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->write_increment = incr;
+}
+
+static inline void channel_config_set_dreq(dma_channel_config *c, unsigned int dreq)
+{
+    c->dreq = dreq;
+}
+
+static inline void channel_config_set_ring(dma_channel_config *c, bool write, unsigned int size_bits)
+{
+    c->ring_write = write;
+    c->ring_size_bits = size_bits;
+}
+
+static inline void channel_config_set_chain_to(dma_channel_config *c, unsigned int chain_to)
+{
+    c->chain_to = chain_to;
+}
+
+static inline void channel_config_set_bswap(dma_channel_config *c, bool bswap)
+{
+    c->bswap = bswap;
+}
+
+static inline void channel_config_set_enable(dma_channel_config *c, bool enable)
+{
+    c->enable = enable;
+}
+
+void dma_channel_set_config(unsigned int channel, const dma_channel_config *config, bool trigger);
+void dma_channel_set_read_addr(unsigned int channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_write_addr(unsigned int channel, volatile void *write_addr, bool trigger);
+void dma_channel_set_trans_count(unsigned int channel, uint32_t trans_count, bool trigger);
+void dma_channel_configure(unsigned int channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, unsigned int transfer_count, bool trigger);
+void dma_channel_transfer_from_buffer_now(unsigned int channel, const volatile void *read_addr, uint32_t transfer_count);
+void dma_channel_transfer_to_buffer_now(unsigned int channel, volatile void *write_addr, uint32_t transfer_count);
+void dma_channel_start(unsigned int channel);
+void dma_channel_abort(unsigned int channel);
+bool dma_channel_is_busy(unsigned int channel);
+void dma_channel_wait_for_finish_blocking(unsigned int channel);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _MOCK_HARDWARE_FLASH_H
+#define _MOCK_HARDWARE_FLASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Flash backed by a host array. XIP_BASE maps onto it, so code that reads
+ * flash through XIP_BASE + offset sees what flash_range_program() wrote.
+ * Erased bytes read 0xFF and programming can only clear bits, as on target.
+ */
+
+#define PICO_FLASH_SIZE_BYTES (2 * 1024 * 1024)
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+
+extern uint8_t mock_flash[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)mock_flash)
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
+
+#endif
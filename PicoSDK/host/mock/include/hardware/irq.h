@@ -0,0 +1,12 @@
+#ifndef _MOCK_HARDWARE_IRQ_H
+#define _MOCK_HARDWARE_IRQ_H
+
+#include <stdbool.h>
+
+#define IO_IRQ_BANK0 13
+
+/* Only IO_IRQ_BANK0 is modelled: while it is disabled, GPIO edges stay
+ * pending and the callback runs when it is enabled again. */
+void irq_set_enabled(unsigned int num, bool enabled);
+
+#endif
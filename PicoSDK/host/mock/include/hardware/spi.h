@@ -0,0 +1,75 @@
+#ifndef _MOCK_HARDWARE_SPI_H
+#define _MOCK_HARDWARE_SPI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Register block layout matches the PL022 so &spi_get_hw(spi)->dr can be a DMA target. */
+typedef struct
+{
+    volatile uint32_t cr0;
+    volatile uint32_t cr1;
+    volatile uint32_t dr;
+    volatile uint32_t sr;
+    volatile uint32_t cpsr;
+    volatile uint32_t imsc;
+    volatile uint32_t ris;
+    volatile uint32_t mis;
+    volatile uint32_t icr;
+    volatile uint32_t dmacr;
+} spi_hw_t;
+
+typedef struct spi_inst spi_inst_t;
+
+extern spi_hw_t mock_spi_hw[2];
+
+#define spi0 ((spi_inst_t *)&mock_spi_hw[0])
+#define spi1 ((spi_inst_t *)&mock_spi_hw[1])
+
+#define SPI_SSPICR_RORIC_BITS 0x00000001u
+
+typedef enum
+{
+    SPI_CPHA_0 = 0,
+    SPI_CPHA_1 = 1
+} spi_cpha_t;
+
+typedef enum
+{
+    SPI_CPOL_0 = 0,
+    SPI_CPOL_1 = 1
+} spi_cpol_t;
+
+typedef enum
+{
+    SPI_LSB_FIRST = 0,
+    SPI_MSB_FIRST = 1
+} spi_order_t;
+
+static inline spi_hw_t *spi_get_hw(spi_inst_t *spi)
+{
+    return (spi_hw_t *)spi;
+}
+
+static inline unsigned int spi_get_index(const spi_inst_t *spi)
+{
+    return (const spi_hw_t *)spi == &mock_spi_hw[1] ? 1u : 0u;
+}
+
+static inline unsigned int spi_get_dreq(spi_inst_t *spi, bool is_tx)
+{
+    return 16u + 2u * spi_get_index(spi) + (is_tx ? 0u : 1u);
+}
+
+unsigned int spi_init(spi_inst_t *spi, unsigned int baudrate);
+unsigned int spi_set_baudrate(spi_inst_t *spi, unsigned int baudrate);
+void spi_set_format(spi_inst_t *spi, unsigned int data_bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order);
+void spi_set_slave(spi_inst_t *spi, bool slave);
+bool spi_is_busy(const spi_inst_t *spi);
+bool spi_is_readable(const spi_inst_t *spi);
+bool spi_is_writable(const spi_inst_t *spi);
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len);
+
+#endif
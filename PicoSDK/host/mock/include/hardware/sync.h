@@ -0,0 +1,22 @@
+#ifndef _MOCK_HARDWARE_SYNC_H
+#define _MOCK_HARDWARE_SYNC_H
+
+#include <stdint.h>
+
+/* Single threaded host: a compiler barrier is enough. */
+static inline void __dmb(void)
+{
+    __asm__ volatile("" ::: "memory");
+}
+
+static inline uint32_t save_and_disable_interrupts(void)
+{
+    return 0;
+}
+
+static inline void restore_interrupts(uint32_t status)
+{
+    (void)status;
+}
+
+#endif
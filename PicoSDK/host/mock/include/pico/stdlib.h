@@ -0,0 +1,26 @@
+#ifndef _MOCK_PICO_STDLIB_H
+#define _MOCK_PICO_STDLIB_H
+
+/* Host stand-in for the Pico SDK stdlib: just enough for the LCD drivers. */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pico/time.h"
+#include "hardware/gpio.h"
+
+typedef unsigned int uint;
+
+enum pico_error_codes
+{
+    PICO_OK = 0,
+    PICO_ERROR_GENERIC = -1,
+    PICO_ERROR_TIMEOUT = -2,
+};
+
+static inline void tight_loop_contents(void) {}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required);
+bool stdio_init_all(void);
+
+#endif
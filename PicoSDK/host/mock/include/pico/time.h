@@ -0,0 +1,13 @@
+#ifndef _MOCK_PICO_TIME_H
+#define _MOCK_PICO_TIME_H
+
+#include <stdint.h>
+
+/* time_us_64() follows the host monotonic clock; sleeps and busy waits return at once. */
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+void busy_wait_us_32(uint32_t delay_us);
+
+#endif
@@ -0,0 +1,795 @@
+#include "mock_hal.h"
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/flash.h"
+#include "hardware/irq.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+spi_hw_t mock_spi_hw[2];
+
+static bool gpio_level[NUM_BANK0_GPIOS];
+static bool gpio_out[NUM_BANK0_GPIOS];
+static int dc_pin = -1;
+
+static unsigned int spi_bits[2] = {8, 8};
+static uint32_t violations;
+
+static uint8_t *log_data;
+static uint8_t *log_dc;
+static size_t log_len;
+static size_t log_cap;
+
+typedef struct
+{
+    bool claimed;
+    bool in_flight;
+    dma_channel_config cfg;
+    volatile void *write_addr;
+    const volatile void *read_addr;
+    uint32_t trans_count;
+} mock_dma_channel_t;
+
+static mock_dma_channel_t dma_ch[NUM_DMA_CHANNELS];
+
+static gpio_irq_callback_t gpio_irq_callback;
+static uint32_t gpio_irq_mask[NUM_BANK0_GPIOS];
+static uint32_t gpio_irq_pending[NUM_BANK0_GPIOS]; /* latched while IO_IRQ_BANK0 is disabled */
+static bool bank0_irq_disabled;
+
+/*
+ * One I2C slave with a 256-byte register file. It answers the bit-banged
+ * iic_hal on its SDA/SCL pins, as well as i2c0/i2c1 transfers.
+ */
+typedef enum
+{
+    I2C_IDLE,
+    I2C_RX,     /* master sends a byte, sampled on SCL rising edges */
+    I2C_RX_ACK, /* slave holds SDA low for the ninth clock */
+    I2C_TX,     /* slave shifts a register out, updated on SCL falling edges */
+    I2C_TX_ACK  /* master acks (more bytes) or nacks (done) */
+} mock_i2c_state_t;
+
+static struct
+{
+    int sda, scl;
+    uint8_t addr;
+    uint8_t *regs;
+    mock_i2c_state_t state;
+    bool first_byte; /* next received byte is the address byte */
+    bool reading;
+    bool have_reg;   /* register pointer already written in this transfer */
+    bool master_ack;
+    bool sda_low;    /* slave pulls SDA down */
+    uint8_t shift;
+    int bit;
+    uint8_t reg;
+    uint32_t transactions;
+    uint32_t bytes;
+} i2c_dev = {.sda = -1, .scl = -1};
+
+i2c_inst_t i2c0_inst = {0};
+i2c_inst_t i2c1_inst = {1};
+
+/* ---------------------------------------------------------------- log */
+
+static void log_byte(uint8_t b)
+{
+    if (log_len == log_cap)
+    {
+        log_cap = log_cap ? log_cap * 2 : 4096;
+        log_data = realloc(log_data, log_cap);
+        log_dc = realloc(log_dc, log_cap);
+        if (!log_data || !log_dc)
+            abort();
+    }
+    log_data[log_len] = b;
+    log_dc[log_len] = (dc_pin < 0) ? 1 : gpio_level[dc_pin];
+    mock_panel_feed(b, log_dc[log_len]);
+    log_len++;
+}
+
+static bool dma_in_flight(void)
+{
+    for (int i = 0; i < NUM_DMA_CHANNELS; i++)
+        if (dma_ch[i].in_flight)
+            return true;
+    return false;
+}
+
+static int spi_index_of(const volatile void *addr)
+{
+    for (int i = 0; i < 2; i++)
+        if (addr == (const volatile void *)&mock_spi_hw[i].dr)
+            return i;
+    return -1;
+}
+
+/* One SPI frame leaves MSB first, so a 16-bit frame is two bytes on the wire. */
+static void spi_push_frame(int idx, uint32_t frame)
+{
+    unsigned int bits = spi_bits[idx];
+    frame &= (1u << bits) - 1u;
+    if (bits > 8)
+        log_byte((uint8_t)(frame >> 8));
+    log_byte((uint8_t)frame);
+}
+
+void mock_hal_reset(void)
+{
+    memset(gpio_level, 0, sizeof(gpio_level));
+    memset(gpio_out, 0, sizeof(gpio_out));
+    memset(dma_ch, 0, sizeof(dma_ch));
+    memset(mock_spi_hw, 0, sizeof(mock_spi_hw));
+    spi_bits[0] = spi_bits[1] = 8;
+    violations = 0;
+    log_len = 0;
+    gpio_irq_callback = NULL;
+    memset(gpio_irq_mask, 0, sizeof(gpio_irq_mask));
+    memset(gpio_irq_pending, 0, sizeof(gpio_irq_pending));
+    bank0_irq_disabled = false;
+    i2c_dev.state = I2C_IDLE;
+    i2c_dev.sda_low = false;
+    i2c_dev.transactions = 0;
+    i2c_dev.bytes = 0;
+}
+
+void mock_hal_set_dc_pin(int pin)
+{
+    dc_pin = pin;
+}
+
+uint32_t mock_hal_violations(void)
+{
+    return violations;
+}
+
+size_t mock_spi_log_len(void)
+{
+    return log_len;
+}
+
+const uint8_t *mock_spi_log_data(void)
+{
+    return log_data;
+}
+
+const uint8_t *mock_spi_log_dc(void)
+{
+    return log_dc;
+}
+
+void mock_spi_log_clear(void)
+{
+    log_len = 0;
+}
+
+bool mock_gpio_level(unsigned int gpio)
+{
+    return gpio < NUM_BANK0_GPIOS ? gpio_level[gpio] : false;
+}
+
+/* ---------------------------------------------------------------- time */
+
+uint64_t time_us_64(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+void sleep_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+void sleep_us(uint64_t us)
+{
+    (void)us;
+}
+
+void busy_wait_us_32(uint32_t us)
+{
+    (void)us;
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)time_us_64();
+}
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required)
+{
+    (void)freq_khz;
+    (void)required;
+    return true;
+}
+
+bool stdio_init_all(void)
+{
+    return true;
+}
+
+/* ---------------------------------------------------------------- gpio */
+
+void gpio_init(unsigned int gpio)
+{
+    if (gpio < NUM_BANK0_GPIOS)
+    {
+        gpio_out[gpio] = false;
+        gpio_level[gpio] = false;
+    }
+}
+
+void gpio_set_function(unsigned int gpio, enum gpio_function fn)
+{
+    (void)gpio;
+    (void)fn;
+}
+
+static bool i2c_sda_line(void);
+static void i2c_lines_changed(bool sda_was, bool scl_was);
+
+void gpio_set_dir(unsigned int gpio, bool out)
+{
+    bool sda_was, scl_was;
+
+    if (gpio >= NUM_BANK0_GPIOS)
+        return;
+    sda_was = i2c_sda_line();
+    scl_was = i2c_dev.scl >= 0 && gpio_level[i2c_dev.scl];
+    gpio_out[gpio] = out;
+    if ((int)gpio == i2c_dev.sda)
+        i2c_lines_changed(sda_was, scl_was);
+}
+
+void gpio_put(unsigned int gpio, bool value)
+{
+    bool sda_was, scl_was;
+
+    if (gpio >= NUM_BANK0_GPIOS)
+        return;
+    if ((int)gpio == dc_pin && gpio_level[gpio] != value && dma_in_flight())
+        violations++;
+    sda_was = i2c_sda_line();
+    scl_was = i2c_dev.scl >= 0 && gpio_level[i2c_dev.scl];
+    gpio_level[gpio] = value;
+    if ((int)gpio == i2c_dev.sda || (int)gpio == i2c_dev.scl)
+        i2c_lines_changed(sda_was, scl_was);
+}
+
+bool gpio_get(unsigned int gpio)
+{
+    if (gpio >= NUM_BANK0_GPIOS)
+        return false;
+    if ((int)gpio == i2c_dev.sda)
+        return i2c_sda_line();
+    return gpio_level[gpio];
+}
+
+void gpio_pull_up(unsigned int gpio)
+{
+    if (gpio < NUM_BANK0_GPIOS && !gpio_out[gpio])
+        gpio_level[gpio] = true;
+}
+
+void gpio_set_irq_enabled(unsigned int gpio, uint32_t event_mask, bool enabled)
+{
+    if (gpio >= NUM_BANK0_GPIOS)
+        return;
+    gpio_irq_pending[gpio] &= ~event_mask; /* like the SDK, acknowledge latched edges */
+    if (enabled)
+        gpio_irq_mask[gpio] |= event_mask;
+    else
+        gpio_irq_mask[gpio] &= ~event_mask;
+}
+
+void gpio_set_irq_enabled_with_callback(unsigned int gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback)
+{
+    gpio_irq_callback = callback;
+    gpio_set_irq_enabled(gpio, event_mask, enabled);
+}
+
+bool mock_gpio_irq(unsigned int gpio, uint32_t events)
+{
+    if (gpio >= NUM_BANK0_GPIOS || !gpio_irq_callback || !(gpio_irq_mask[gpio] & events))
+        return false;
+    if (bank0_irq_disabled)
+    {
+        gpio_irq_pending[gpio] |= gpio_irq_mask[gpio] & events;
+        return false;
+    }
+    gpio_irq_callback(gpio, gpio_irq_mask[gpio] & events);
+    return true;
+}
+
+void irq_set_enabled(unsigned int num, bool enabled)
+{
+    if (num != IO_IRQ_BANK0)
+        return;
+    bank0_irq_disabled = !enabled;
+    for (unsigned int gpio = 0; enabled && gpio < NUM_BANK0_GPIOS; gpio++)
+    {
+        uint32_t events = gpio_irq_pending[gpio] & gpio_irq_mask[gpio];
+
+        gpio_irq_pending[gpio] = 0;
+        if (events && gpio_irq_callback)
+            gpio_irq_callback(gpio, events);
+    }
+}
+
+/* ---------------------------------------------------------------- i2c */
+
+void mock_i2c_attach(unsigned int sda, unsigned int scl, uint8_t addr, uint8_t regs[256])
+{
+    i2c_dev.sda = (int)sda;
+    i2c_dev.scl = (int)scl;
+    i2c_dev.addr = addr;
+    i2c_dev.regs = regs;
+    i2c_dev.state = I2C_IDLE;
+    i2c_dev.sda_low = false;
+}
+
+uint32_t mock_i2c_transactions(void)
+{
+    return i2c_dev.transactions;
+}
+
+uint32_t mock_i2c_bytes(void)
+{
+    return i2c_dev.bytes;
+}
+
+/* Open drain: released (input) pins read high through the pull-up */
+static bool i2c_sda_line(void)
+{
+    int p = i2c_dev.sda;
+
+    if (p < 0)
+        return false;
+    if (i2c_dev.sda_low)
+        return false;
+    return gpio_out[p] ? gpio_level[p] : true;
+}
+
+static void i2c_rx_byte(uint8_t b)
+{
+    i2c_dev.bytes++;
+    if (i2c_dev.first_byte)
+    {
+        i2c_dev.first_byte = false;
+        if ((b >> 1) != i2c_dev.addr || !i2c_dev.regs)
+        {
+            i2c_dev.state = I2C_IDLE; /* not us: no ack */
+            return;
+        }
+        i2c_dev.reading = b & 1;
+        if (!i2c_dev.reading)
+            i2c_dev.have_reg = false;
+    }
+    else if (!i2c_dev.have_reg)
+    {
+        i2c_dev.reg = b;
+        i2c_dev.have_reg = true;
+    }
+    else
+        i2c_dev.regs[i2c_dev.reg++] = b;
+
+    i2c_dev.state = I2C_RX_ACK;
+    i2c_dev.sda_low = true;
+}
+
+static void i2c_tx_load(void)
+{
+    i2c_dev.shift = i2c_dev.regs[i2c_dev.reg++];
+    i2c_dev.bytes++;
+    i2c_dev.bit = 7;
+    i2c_dev.sda_low = !(i2c_dev.shift & 0x80);
+    i2c_dev.state = I2C_TX;
+}
+
+static void i2c_lines_changed(bool sda_was, bool scl_was)
+{
+    bool sda = i2c_sda_line();
+    bool scl = gpio_level[i2c_dev.scl];
+
+    if (scl_was && scl && sda != sda_was)
+    {
+        if (!sda) /* START or repeated START */
+        {
+            i2c_dev.transactions += (i2c_dev.state == I2C_IDLE);
+            i2c_dev.state = I2C_RX;
+            i2c_dev.first_byte = true;
+            i2c_dev.shift = 0;
+            i2c_dev.bit = 0;
+        }
+        else /* STOP */
+            i2c_dev.state = I2C_IDLE;
+        i2c_dev.sda_low = false;
+        return;
+    }
+
+    if (!scl_was && scl) /* rising edge: the receiver samples */
+    {
+        if (i2c_dev.state == I2C_RX)
+        {
+            i2c_dev.shift = (uint8_t)(i2c_dev.shift << 1 | sda);
+            i2c_dev.bit++;
+        }
+        else if (i2c_dev.state == I2C_TX_ACK)
+            i2c_dev.master_ack = !sda;
+    }
+    else if (scl_was && !scl) /* falling edge: the transmitter updates SDA */
+    {
+        switch (i2c_dev.state)
+        {
+        case I2C_RX:
+            if (i2c_dev.bit == 8)
+                i2c_rx_byte(i2c_dev.shift);
+            break;
+        case I2C_RX_ACK:
+            i2c_dev.sda_low = false;
+            if (i2c_dev.reading)
+                i2c_tx_load();
+            else
+            {
+                i2c_dev.state = I2C_RX;
+                i2c_dev.shift = 0;
+                i2c_dev.bit = 0;
+            }
+            break;
+        case I2C_TX:
+            if (i2c_dev.bit-- > 0)
+                i2c_dev.sda_low = !(i2c_dev.shift & (1u << i2c_dev.bit));
+            else
+            {
+                i2c_dev.sda_low = false;
+                i2c_dev.master_ack = false;
+                i2c_dev.state = I2C_TX_ACK;
+            }
+            break;
+        case I2C_TX_ACK:
+            if (i2c_dev.master_ack)
+                i2c_tx_load();
+            else
+                i2c_dev.state = I2C_IDLE;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+unsigned int i2c_init(i2c_inst_t *i2c, unsigned int baudrate)
+{
+    (void)i2c;
+    return baudrate;
+}
+
+int i2c_write_timeout_us(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop, unsigned int timeout_us)
+{
+    (void)i2c;
+    (void)nostop;
+    (void)timeout_us;
+    if (addr != i2c_dev.addr || !i2c_dev.regs)
+        return PICO_ERROR_GENERIC;
+    i2c_dev.transactions += (i2c_dev.state == I2C_IDLE);
+    i2c_dev.state = nostop ? I2C_RX : I2C_IDLE;
+    i2c_dev.bytes += 1 + (uint32_t)len;
+    if (len == 0)
+        return 0;
+    i2c_dev.reg = src[0];
+    for (size_t i = 1; i < len; i++)
+        i2c_dev.regs[i2c_dev.reg++] = src[i];
+    return (int)len;
+}
+
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, unsigned int timeout_us)
+{
+    (void)i2c;
+    (void)timeout_us;
+    if (addr != i2c_dev.addr || !i2c_dev.regs)
+        return PICO_ERROR_GENERIC;
+    i2c_dev.transactions += (i2c_dev.state == I2C_IDLE);
+    i2c_dev.state = nostop ? I2C_RX : I2C_IDLE;
+    i2c_dev.bytes += 1 + (uint32_t)len;
+    for (size_t i = 0; i < len; i++)
+        dst[i] = i2c_dev.regs[i2c_dev.reg++];
+    return (int)len;
+}
+
+/* ---------------------------------------------------------------- spi */
+
+unsigned int spi_init(spi_inst_t *spi, unsigned int baudrate)
+{
+    spi_bits[spi_get_index(spi)] = 8;
+    return baudrate;
+}
+
+unsigned int spi_set_baudrate(spi_inst_t *spi, unsigned int baudrate)
+{
+    (void)spi;
+    return baudrate;
+}
+
+void spi_set_format(spi_inst_t *spi, unsigned int data_bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order)
+{
+    (void)cpol;
+    (void)cpha;
+    (void)order;
+    if (dma_in_flight())
+        violations++;
+    spi_bits[spi_get_index(spi)] = data_bits;
+}
+
+void spi_set_slave(spi_inst_t *spi, bool slave)
+{
+    (void)spi;
+    (void)slave;
+}
+
+bool spi_is_busy(const spi_inst_t *spi)
+{
+    (void)spi;
+    return false;
+}
+
+bool spi_is_readable(const spi_inst_t *spi)
+{
+    (void)spi;
+    return false;
+}
+
+bool spi_is_writable(const spi_inst_t *spi)
+{
+    (void)spi;
+    return true;
+}
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+    int idx = (int)spi_get_index(spi);
+    mock_panel_count_call();
+    if (dma_in_flight())
+        violations++;
+    for (size_t i = 0; i < len; i++)
+        spi_push_frame(idx, src[i]);
+    return (int)len;
+}
+
+int spi_write16_blocking(spi_inst_t *spi, const uint16_t *src, size_t len)
+{
+    int idx = (int)spi_get_index(spi);
+    mock_panel_count_call();
+    if (dma_in_flight())
+        violations++;
+    for (size_t i = 0; i < len; i++)
+        spi_push_frame(idx, src[i]);
+    return (int)len;
+}
+
+/* ---------------------------------------------------------------- dma */
+
+int dma_claim_unused_channel(bool required)
+{
+    for (int i = 0; i < NUM_DMA_CHANNELS; i++)
+    {
+        if (!dma_ch[i].claimed)
+        {
+            dma_ch[i].claimed = true;
+            return i;
+        }
+    }
+    if (required)
+        abort();
+    return -1;
+}
+
+void dma_channel_unclaim(unsigned int channel)
+{
+    dma_ch[channel].claimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(unsigned int channel)
+{
+    dma_channel_config c = {
+        .size = DMA_SIZE_32,
+        .read_increment = true,
+        .write_increment = false,
+        .dreq = DREQ_FORCE,
+        .ring_size_bits = 0,
+        .ring_write = false,
+        .chain_to = channel,
+        .bswap = false,
+        .enable = true,
+    };
+    return c;
+}
+
+dma_channel_config dma_get_channel_config(unsigned int channel)
+{
+    return dma_ch[channel].cfg;
+}
+
+static uint32_t load_elem(const volatile uint8_t *p, unsigned int size)
+{
+    if (size == 1)
+        return *p;
+    if (size == 2)
+        return *(const volatile uint16_t *)p;
+    return *(const volatile uint32_t *)p;
+}
+
+static void store_elem(volatile uint8_t *p, unsigned int size, uint32_t v)
+{
+    if (size == 1)
+        *p = (uint8_t)v;
+    else if (size == 2)
+        *(volatile uint16_t *)p = (uint16_t)v;
+    else
+        *(volatile uint32_t *)p = v;
+}
+
+static uintptr_t next_addr(uintptr_t addr, unsigned int size, bool ring, unsigned int ring_bits)
+{
+    if (ring && ring_bits)
+    {
+        uintptr_t mask = ((uintptr_t)1 << ring_bits) - 1;
+        return (addr & ~mask) | ((addr + size) & mask);
+    }
+    return addr + size;
+}
+
+static void dma_run(unsigned int channel)
+{
+    mock_dma_channel_t *ch = &dma_ch[channel];
+    unsigned int size = 1u << ch->cfg.size;
+    uintptr_t rd = (uintptr_t)ch->read_addr;
+    uintptr_t wr = (uintptr_t)ch->write_addr;
+    int spi_idx = spi_index_of(ch->write_addr);
+
+    if (!ch->cfg.enable)
+        return;
+    if (spi_idx >= 0)
+        mock_panel_count_call();
+
+    for (uint32_t n = 0; n < ch->trans_count; n++)
+    {
+        uint32_t v = load_elem((const volatile uint8_t *)rd, size);
+        if (ch->cfg.bswap)
+        {
+            if (size == 2)
+                v = (uint16_t)((v >> 8) | (v << 8));
+            else if (size == 4)
+                v = __builtin_bswap32(v);
+        }
+        if (spi_idx >= 0)
+            spi_push_frame(spi_idx, v);
+        else
+            store_elem((volatile uint8_t *)wr, size, v);
+
+        if (ch->cfg.read_increment)
+            rd = next_addr(rd, size, !ch->cfg.ring_write, ch->cfg.ring_size_bits);
+        if (ch->cfg.write_increment)
+            wr = next_addr(wr, size, ch->cfg.ring_write, ch->cfg.ring_size_bits);
+    }
+
+    ch->read_addr = (const volatile void *)rd;
+    ch->write_addr = (volatile void *)wr;
+    ch->in_flight = true;
+
+    if (ch->cfg.chain_to != channel)
+        dma_run(ch->cfg.chain_to);
+}
+
+static void dma_trigger(unsigned int channel)
+{
+    if (dma_ch[channel].in_flight)
+        violations++;
+    dma_run(channel);
+}
+
+void dma_channel_set_config(unsigned int channel, const dma_channel_config *config, bool trigger)
+{
+    dma_ch[channel].cfg = *config;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_set_read_addr(unsigned int channel, const volatile void *read_addr, bool trigger)
+{
+    dma_ch[channel].read_addr = read_addr;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_set_write_addr(unsigned int channel, volatile void *write_addr, bool trigger)
+{
+    dma_ch[channel].write_addr = write_addr;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_set_trans_count(unsigned int channel, uint32_t trans_count, bool trigger)
+{
+    dma_ch[channel].trans_count = trans_count;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_configure(unsigned int channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, unsigned int transfer_count, bool trigger)
+{
+    dma_ch[channel].cfg = *config;
+    dma_ch[channel].write_addr = write_addr;
+    dma_ch[channel].read_addr = read_addr;
+    dma_ch[channel].trans_count = transfer_count;
+    if (trigger)
+        dma_trigger(channel);
+}
+
+void dma_channel_transfer_from_buffer_now(unsigned int channel, const volatile void *read_addr, uint32_t transfer_count)
+{
+    dma_ch[channel].read_addr = read_addr;
+    dma_ch[channel].trans_count = transfer_count;
+    dma_trigger(channel);
+}
+
+void dma_channel_transfer_to_buffer_now(unsigned int channel, volatile void *write_addr, uint32_t transfer_count)
+{
+    dma_ch[channel].write_addr = write_addr;
+    dma_ch[channel].trans_count = transfer_count;
+    dma_trigger(channel);
+}
+
+void dma_channel_start(unsigned int channel)
+{
+    dma_trigger(channel);
+}
+
+void dma_channel_abort(unsigned int channel)
+{
+    dma_ch[channel].in_flight = false;
+}
+
+bool dma_channel_is_busy(unsigned int channel)
+{
+    dma_ch[channel].in_flight = false;
+    return false;
+}
+
+void dma_channel_wait_for_finish_blocking(unsigned int channel)
+{
+    dma_ch[channel].in_flight = false;
+}
+
+/* -------------------------------------------------------------- flash */
+
+uint8_t mock_flash[PICO_FLASH_SIZE_BYTES];
+
+void flash_range_erase(uint32_t flash_offs, size_t count)
+{
+    /* Target requires sector alignment; DMA may not read XIP meanwhile */
+    if (flash_offs % FLASH_SECTOR_SIZE || count % FLASH_SECTOR_SIZE || dma_in_flight() ||
+        flash_offs + count > PICO_FLASH_SIZE_BYTES)
+    {
+        violations++;
+        return;
+    }
+    memset(mock_flash + flash_offs, 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count)
+{
+    if (flash_offs % FLASH_PAGE_SIZE || count % FLASH_PAGE_SIZE || dma_in_flight() ||
+        flash_offs + count > PICO_FLASH_SIZE_BYTES)
+    {
+        violations++;
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+        mock_flash[flash_offs + i] &= data[i];
+}
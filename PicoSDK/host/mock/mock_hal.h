@@ -0,0 +1,73 @@
+#ifndef _MOCK_HAL_H
+#define _MOCK_HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Host backend for the LCD drivers. Every byte that reaches an SPI data
+ * register, whether from spi_write_blocking() or from a DMA channel, is
+ * appended to a log together with the level of the LCD DC pin at that time.
+ *
+ * DMA transfers execute immediately but stay "in flight" until the driver
+ * observes completion (dma_channel_is_busy / wait_for_finish). Touching the
+ * SPI port or the DC pin while a transfer is in flight is counted as a
+ * violation, which is the same ordering bug that corrupts output on target.
+ */
+
+void mock_hal_reset(void);
+void mock_hal_set_dc_pin(int pin);
+uint32_t mock_hal_violations(void);
+
+size_t mock_spi_log_len(void);
+const uint8_t *mock_spi_log_data(void);
+const uint8_t *mock_spi_log_dc(void); /* 0 = command byte, 1 = data byte */
+void mock_spi_log_clear(void);
+
+bool mock_gpio_level(unsigned int gpio);
+/* Run the GPIO callback if the pin's IRQ is enabled. While IO_IRQ_BANK0 is
+ * disabled the edge is latched instead (returns false) and the callback runs
+ * on irq_set_enabled(IO_IRQ_BANK0, true). */
+bool mock_gpio_irq(unsigned int gpio, uint32_t events);
+
+/*
+ * Panel model fed from the SPI log: CASET/RASET/RAMWR/RAMWRC write pixels
+ * into a GRAM of width x height, MADCTL (MV/MX/MY) maps window addresses
+ * onto it and COLMOD selects RGB565 or RGB666. Pixels are kept as RGB888.
+ * mock_panel_pixel() takes window addresses as the driver sends them
+ * (including any panel offset), under the current MADCTL.
+ *
+ * The counters accumulate until mock_panel_stats_clear(), so clearing
+ * before one API call and reading after it gives that call's cost.
+ */
+typedef struct
+{
+    uint32_t bytes;     /* bytes on the wire */
+    uint32_t commands;  /* bytes sent with DC low */
+    uint32_t windows;   /* RAMWR commands, i.e. window sets */
+    uint32_t pixels;    /* pixels written */
+    uint32_t clipped;   /* of which outside GRAM */
+    uint32_t spi_calls; /* spi_write*_blocking calls and DMA transfers to SPI */
+} mock_panel_stats_t;
+
+void mock_panel_init(uint16_t width, uint16_t height); /* defaults to 240x320 on first use */
+void mock_panel_feed(uint8_t b, bool dc);
+void mock_panel_count_call(void);
+uint8_t mock_panel_madctl(void);
+uint32_t mock_panel_pixel(uint16_t x, uint16_t y);
+uint16_t mock_panel_pixel565(uint16_t x, uint16_t y);
+const uint32_t *mock_panel_gram(void);
+mock_panel_stats_t mock_panel_stats(void);
+void mock_panel_stats_clear(void);
+
+/*
+ * Touch controller model: an I2C slave at addr on the given pins, backed by
+ * regs. It follows the bit-banged bus edge by edge and also serves i2c0/i2c1.
+ * A transaction is one START..STOP, repeated STARTs included.
+ */
+void mock_i2c_attach(unsigned int sda, unsigned int scl, uint8_t addr, uint8_t regs[256]);
+uint32_t mock_i2c_transactions(void);
+uint32_t mock_i2c_bytes(void);
+
+#endif
@@ -0,0 +1,209 @@
+#include "mock_hal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * MIPI DCS subset shared by the ST7789, ILI9341 and ILI9488 controllers:
+ * CASET/RASET set the window, RAMWR/RAMWRC stream pixels into it, MADCTL
+ * maps window addresses onto GRAM, COLMOD picks 2 (RGB565) or 3 (RGB666)
+ * bytes per pixel. Everything else is only counted.
+ */
+#define DCS_CASET 0x2A
+#define DCS_RASET 0x2B
+#define DCS_RAMWR 0x2C
+#define DCS_MADCTL 0x36
+#define DCS_COLMOD 0x3A
+#define DCS_RAMWRC 0x3C
+
+#define MADCTL_MY 0x80
+#define MADCTL_MX 0x40
+#define MADCTL_MV 0x20
+
+static uint32_t *gram;
+static uint16_t gram_w, gram_h;
+
+static uint8_t cmd;
+static uint8_t args[4];
+static unsigned int nargs;
+
+static uint16_t xs, xe, ys, ye;
+static uint16_t cx, cy;
+static uint8_t madctl;
+static unsigned int pixel_bytes = 3; /* controller reset default is 18 bpp */
+static uint8_t pix[3];
+static unsigned int npix;
+
+static mock_panel_stats_t stats;
+
+void mock_panel_init(uint16_t width, uint16_t height)
+{
+    free(gram);
+    gram = calloc((size_t)width * height, sizeof(*gram));
+    if (!gram)
+        abort();
+    gram_w = width;
+    gram_h = height;
+
+    cmd = 0;
+    nargs = 0;
+    xs = ys = 0;
+    xe = width - 1;
+    ye = height - 1;
+    cx = cy = 0;
+    madctl = 0;
+    pixel_bytes = 3;
+    npix = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint8_t mock_panel_madctl(void)
+{
+    return madctl;
+}
+
+/* Window address -> GRAM index, or -1 when it falls outside GRAM. */
+static long gram_index(unsigned int x, unsigned int y)
+{
+    unsigned int lw = (madctl & MADCTL_MV) ? gram_h : gram_w;
+    unsigned int lh = (madctl & MADCTL_MV) ? gram_w : gram_h;
+
+    if (x >= lw || y >= lh)
+        return -1;
+    if (madctl & MADCTL_MX)
+        x = lw - 1 - x;
+    if (madctl & MADCTL_MY)
+        y = lh - 1 - y;
+    if (madctl & MADCTL_MV)
+    {
+        unsigned int t = x;
+        x = y;
+        y = t;
+    }
+    return (long)y * gram_w + x;
+}
+
+static void put_pixel(uint32_t rgb)
+{
+    long i = gram_index(cx, cy);
+
+    if (i < 0)
+        stats.clipped++;
+    else
+        gram[i] = rgb;
+    stats.pixels++;
+
+    /* Column first, then row; wraps back to the window origin like the controller */
+    if (cx >= xe)
+    {
+        cx = xs;
+        cy = (cy >= ye) ? ys : cy + 1;
+    }
+    else
+        cx++;
+}
+
+static void data_byte(uint8_t b)
+{
+    switch (cmd)
+    {
+    case DCS_CASET:
+    case DCS_RASET:
+        if (nargs < 4)
+            args[nargs++] = b;
+        if (nargs == 4)
+        {
+            uint16_t s = (uint16_t)(args[0] << 8 | args[1]);
+            uint16_t e = (uint16_t)(args[2] << 8 | args[3]);
+            if (cmd == DCS_CASET)
+                xs = s, xe = e;
+            else
+                ys = s, ye = e;
+        }
+        break;
+
+    case DCS_MADCTL:
+        if (nargs++ == 0)
+            madctl = b;
+        break;
+
+    case DCS_COLMOD:
+        if (nargs++ == 0)
+            pixel_bytes = ((b & 0x07) == 0x05) ? 2 : 3;
+        break;
+
+    case DCS_RAMWR:
+    case DCS_RAMWRC:
+        pix[npix++] = b;
+        if (npix < pixel_bytes)
+            break;
+        npix = 0;
+        if (pixel_bytes == 2)
+        {
+            uint16_t c = (uint16_t)(pix[0] << 8 | pix[1]);
+            uint32_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, bl = c & 0x1F;
+            put_pixel((r << 3 | r >> 2) << 16 | (g << 2 | g >> 4) << 8 | (bl << 3 | bl >> 2));
+        }
+        else /* RGB666, colour in the top six bits of each byte */
+            put_pixel((uint32_t)(pix[0] & 0xFC) << 16 | (uint32_t)(pix[1] & 0xFC) << 8 | (pix[2] & 0xFC));
+        break;
+
+    default:
+        break;
+    }
+}
+
+void mock_panel_feed(uint8_t b, bool dc)
+{
+    if (!gram)
+        mock_panel_init(240, 320);
+
+    stats.bytes++;
+    if (dc)
+    {
+        data_byte(b);
+        return;
+    }
+
+    stats.commands++;
+    cmd = b;
+    nargs = 0;
+    npix = 0;
+    if (b == DCS_RAMWR)
+    {
+        stats.windows++;
+        cx = xs;
+        cy = ys;
+    }
+}
+
+void mock_panel_count_call(void)
+{
+    stats.spi_calls++;
+}
+
+uint32_t mock_panel_pixel(uint16_t x, uint16_t y)
+{
+    long i = gram ? gram_index(x, y) : -1;
+    return i < 0 ? 0 : gram[i];
+}
+
+uint16_t mock_panel_pixel565(uint16_t x, uint16_t y)
+{
+    uint32_t c = mock_panel_pixel(x, y);
+    return (uint16_t)((c >> 8 & 0xF800) | (c >> 5 & 0x07E0) | (c >> 3 & 0x001F));
+}
+
+const uint32_t *mock_panel_gram(void)
+{
+    return gram;
+}
+
+mock_panel_stats_t mock_panel_stats(void)
+{
+    return stats;
+}
+
+void mock_panel_stats_clear(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
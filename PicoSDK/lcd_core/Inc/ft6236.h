@@ -55,6 +55,8 @@
 #define FT6236_REG_FOCALTECH_ID    0xA8 // FocalTech's vendor ID
 #define FT6236_REG_RELEASE_CODE_ID 0xAF // Release code version
 
+#define FT6236_MAX_TOUCH 2       // Touch points reported by the controller
+
 /* Touch coordinate structure */
 typedef struct 
 {
@@ -62,8 +64,22 @@ typedef struct
     uint16_t Y_Pos;
     uint8_t Touch_Count;
     uint8_t Touch_Event;
+    uint8_t Touch_ID;       // Tracking ID, stays with a finger while it is down
+    uint8_t Weight;         // Touch pressure
+    uint8_t Area;           // Touch area (4 bits)
 } FT6236_Info;
 
+/* Timestamped touch event, queued from the INT pin interrupt */
+typedef struct
+{
+    uint32_t Time_Us;       // time_us_32() when the report was read
+    uint16_t X_Pos;
+    uint16_t Y_Pos;
+    uint8_t Touch_Event;    // FT6236_TouchEvent_TypeDef
+} FT6236_Event;
+
+#define FT6236_EVENT_QUEUE_SIZE 16  // Number of queued events, must be a power of two
+
 /* Gesture IDs */
 typedef enum {
     FT6236_GESTURE_NO_GESTURE     = 0x00,
@@ -106,10 +122,15 @@ void FT6236_Init(void);
 
 /* Touch operations */
 void FT6236_Get_Touch_Data(void);
+uint8_t FT6236_Get_Touch_Points(FT6236_Info points[FT6236_MAX_TOUCH]);
 uint8_t FT6236_Get_Touch_Count(void);
 uint8_t FT6236_Get_ChipID(void);
 uint16_t FT6236_Get_LibVersion(void);
 
+/* Interrupt-driven event queue */
+void FT6236_IRQ_Init(void);
+bool FT6236_Get_Event(FT6236_Event *event);
+
 /* I2C read/write functions */
 void FT6236_IIC_WriteREG(uint8_t addr, uint8_t dat);
 uint8_t FT6236_IIC_ReadREG(uint8_t addr);
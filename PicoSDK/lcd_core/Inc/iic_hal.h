@@ -2,13 +2,17 @@
 #define __IIC_HAL_H
 
 #include <stdint.h>
+#include "hardware/i2c.h"
 
 typedef struct {
     uint8_t sda_pin;
     uint8_t scl_pin;
+    uint32_t baudrate; // 0: bit-bang on SIO, otherwise run the I2C peripheral at this rate (Hz)
+    i2c_inst_t *i2c;   // Set by IICInit, NULL when the bus is bit-banged
 } iic_bus_t;
 
 void IICInit(iic_bus_t *bus);
+// Raw bus primitives, bit-banged buses only
 void IICStart(iic_bus_t *bus);
 void IICStop(iic_bus_t *bus);
 uint8_t IICWaitAck(iic_bus_t *bus);
@@ -16,6 +20,7 @@ void IICAck(iic_bus_t *bus);
 void IICNAck(iic_bus_t *bus);
 void IICSendByte(iic_bus_t *bus, uint8_t txd);
 uint8_t IICRecvByte(iic_bus_t *bus);
+// Register access, dispatched to the bus backend
 uint8_t IIC_Read_One_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr);
 void IIC_Write_One_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr, uint8_t dat);
 void IIC_Read_Multi_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr, uint8_t len, uint8_t *buf);
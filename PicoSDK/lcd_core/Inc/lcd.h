@@ -0,0 +1,149 @@
+#ifndef __LCD_H
+#define __LCD_H
+
+#include "Inc/lcd_init.h"
+
+void LCD_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color);  // ָɫ
+void LCD_DrawPoint(uint16_t x, uint16_t y, uint16_t color);                                 // ָλûһ
+void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);      // ָλûһ
+void LCD_DrawRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color); // ָλûһ
+void Draw_Circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);                      // ָλûһԲ
+void LCD_FillCircle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
+void gui_draw_hline(uint16_t x0, uint16_t y0, uint16_t len, uint16_t color);                // ˮƽ,ĻĲֲõ
+void gui_fill_circle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);                 // ˮƽһԲ
+
+/* ͼιդ:ͼηֽΪˮƽλֱ,νspan.ֱӻƺlcd_band.c,һ */
+typedef void (*LCD_Span_Func)(int x1, int y1, int x2, int y2, uint16_t color); // һ,x1<=x2,y1<=y2,ɳĻ
+
+void LCD_Line_Spans(int x1, int y1, int x2, int y2, uint16_t color, LCD_Span_Func span);  // ֱ
+void LCD_Circle_Spans(int x0, int y0, int r, uint16_t color, LCD_Span_Func span);         // Բ
+void LCD_FillCircle_Spans(int x0, int y0, int r, uint16_t color, LCD_Span_Func span);     // ʵԲ
+
+/* һַģϢ,ģֻӾ,ÿ(width*bpp+7)/8ֽ,λ */
+typedef struct
+{
+	uint32_t offset; // ģtableеƫ(ֽ)
+	uint8_t width;	 // Ӿο
+	uint8_t height;	 // Ӿθ߶
+	uint8_t x_off;	 // ӾַϽǵƫ
+	uint8_t y_off;
+	uint8_t advance; // ַ,ʾxǰ
+} LCD_Glyph;
+
+/*
+ * :ģд,ÿstrideֽ,ذλ.
+ * ɫÿ1λ;Ҷ()ÿ24λ,̶λ,
+ * ʾʱɫͱɫ4/16ɫ,tools/gen_aa_font.py.
+ * (glyphsΪNULL)widthΪģĿ,heightΪи,
+ * tools/gen_prop_font.py
+ */
+typedef struct
+{
+	uint8_t width;		  // ֿ()
+	uint8_t height;		  // ָ()
+	uint8_t stride;		  // ÿֽ
+	uint8_t bpp;		  // ÿλ 1:ɫ 2/4:Ҷ
+	uint8_t msb_first;	  // 1:ֽڸλ 0:ֽڵλ(ɫ)
+	uint16_t glyph_size;  // ģļ(ֽ)
+	const uint8_t *table; // һģ׵ַ
+	int8_t gb;			  // lcd_gb_indexеֺ,ASCIIΪ-1(ģ' 'ʼ)
+	const LCD_Glyph *glyphs; // ÿַģϢ,ȿΪNULL
+} LCD_Font;
+
+#define LCD_GLYPH_MAX_W 32 // ģ
+
+extern const LCD_Font LCD_Font_AA12;	// 6x12 ASCII
+extern const LCD_Font LCD_Font_AA16;	// 8x16 ASCII
+extern const LCD_Font LCD_Font_GB_AA12; // 12x12 ݺ
+extern const LCD_Font LCD_Font_GB_AA16; // 16x16 ݺ
+extern const LCD_Font LCD_Font_P16;		// 16߱ASCII
+extern const LCD_Font LCD_Font_P24;		// 24߱ASCII
+extern const LCD_Font LCD_Font_P32;		// 32߱ASCII
+extern const LCD_Font LCD_Font_PAA16;	// 16߱ASCII
+
+void LCD_ShowGlyph(uint16_t x, uint16_t y, const LCD_Font *font, const uint8_t *glyph, uint16_t fc, uint16_t bc, uint8_t mode);          // ʾһģ
+uint8_t LCD_ShowGlyphBox(uint16_t x, uint16_t y, const LCD_Font *font, const LCD_Glyph *g, const uint8_t *src, uint16_t fc, uint16_t bc, uint8_t mode); // ʾһַ
+void LCD_ShowStringFont(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, const LCD_Font *font, uint8_t mode);  // ָʾַ
+void LCD_ShowChineseFont(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, const LCD_Font *font, uint8_t mode); // ָʾִ
+uint16_t LCD_MeasureString(const uint8_t *p, const LCD_Font *font);                                                              // ַʾ
+void LCD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);      // ʾִ
+void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ12x12
+void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ16x16
+void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ24x24
+void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾ32x32
+
+void LCD_ShowChar(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);        // ʾһַ
+void LCD_ShowString(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ʾַ
+void LCD_ShowUTF8(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);   // ʾUTF-8ӢĻַ
+uint32_t mypow(uint8_t m, uint8_t n);                                                                                 // 
+void LCD_ShowIntNum(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey);      // ʾ
+void LCD_ShowFloatNum1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey);      // ʾλС
+
+/* ͼƬ,LCD_Image_OpenImage2LcdRLEͼƬ鿪ͷ8ֽͷõ */
+typedef struct
+{
+	uint16_t width;		 // ()
+	uint16_t height;	 // ߶()
+	uint8_t bpp;		 // 16:RGB565 18:RGB666(ÿ3ֽ)
+	uint8_t big_endian;	 // 1:ظֽǰ
+	uint8_t rle;		 // 1:RLEѹ(tools/gen_rle_image.py)
+	const uint8_t *data; // һصĵַ(ͷ)
+} LCD_Image;
+
+uint8_t LCD_Image_Open(LCD_Image *img, const uint8_t pic[]);                                         // Image2LcdͼƬͷ
+void LCD_ShowImage(int16_t x, int16_t y, const LCD_Image *img);                                      // ʾͼƬ,ĻĲֲü
+void LCD_ShowPicture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[]); // ʾͷͼƬ
+
+#if USE_FRAMEBUFFER
+extern uint16_t LCD_FrameBuffer[LCD_W * LCD_H]; // RGB565֡,ֱ޸ĺLCD_Invalidate()
+
+void LCD_Invalidate(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2); // ֡Ҫˢµ
+void LCD_Present(void);                                                   // ֡б޸ĵˢµĻ
+#endif
+
+void DrawColorBars(void);
+void DrawGrayscale(void);
+void DrawClearButton(void);
+
+void DrawThickLine(int x0, int y0, int x1, int y1, int thickness, uint16_t color);
+void LCD_DrawThickLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color, uint8_t size);
+// ɫ
+#define WHITE 0xFFFF
+#define BLACK 0x0000
+#define BLUE 0x001F
+#define BRED 0XF81F
+#define GRED 0XFFE0
+#define GBLUE 0X07FF
+#define RED 0xF800
+#define MAGENTA 0xF81F
+#define GREEN 0x07E0
+#define CYAN 0x7FFF
+#define YELLOW 0xFFE0
+#define BROWN 0XBC40      // ɫ
+#define BRRED 0XFC07      // غɫ
+#define GRAY 0X8430       // ɫ
+#define DARKBLUE 0X01CF   // ɫ
+#define LIGHTBLUE 0X7D7C  // ǳɫ
+#define GRAYBLUE 0X5458   // ɫ
+#define LIGHTGREEN 0X841F // ǳɫ
+#define LGRAY 0XC618      // ǳɫ(PANNEL),屳ɫ
+#define LGRAYBLUE 0XA651  // ǳɫ(мɫ)
+#define LBBLUE 0X2B12     // ǳɫ(ѡĿķɫ)
+
+/* 궨 */
+#define LOGO_DURATION 3000
+#define TEXT_DURATION 2000
+#define IMAGE_INTERVAL 2000
+#define COLOR_FULL_INTERVAL 1000
+#define EFFECT_DURATION 3000
+#define BTN_WIDTH 60
+#define BTN_HEIGHT 30
+#define SCREEN_WIDTH LCD_W
+#define SCREEN_HEIGHT LCD_H
+
+#define RGB(r, g, b) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+
+#define COLOR_BAR_NUM (SCREEN_WIDTH / 40 > 8 ? 8 : SCREEN_WIDTH / 40) // ɫ,ÿԼ40,8ɫ
+#define BAR_WIDTH (SCREEN_WIDTH / COLOR_BAR_NUM)                      // Զ
+
+#endif
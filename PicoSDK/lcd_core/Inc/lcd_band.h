@@ -0,0 +1,29 @@
+#ifndef __LCD_BAND_H
+#define __LCD_BAND_H
+
+#include "Inc/lcd_init.h"
+
+#if LCD_PIXEL_BYTES != 3
+#error "lcd_bandֻ֧RGB666Ļ"
+#endif
+
+/*
+ * ִȾ: 320x480 RGB666֡Ҫ460KB,RP2040Ų֡.
+ * ȰͼԪ¼ʾб,ˢʱLCD_BAND_LINESһդ,
+ * 彻ʹ,ȾһͬʱDMAһ.
+ */
+
+#define LCD_BAND_LINES 16     // ÿ,干ռ 2*LCD_W*LCD_BAND_LINES*3 ֽ
+#define LCD_BAND_MAX_ITEMS 64 // ʾбɵͼԪ
+
+void LCD_Band_Clear(uint16_t bc);                                                                    // ʾбñɫ
+uint8_t LCD_Band_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color);   // 
+uint8_t LCD_Band_Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);           // ֱ
+uint8_t LCD_Band_Rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);      // Ӿο
+uint8_t LCD_Band_Circle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color, uint8_t fill);         // Բ(fillΪ1ʱʵ)
+uint8_t LCD_Band_String(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode); // ASCIIַ
+uint8_t LCD_Band_Picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[]); // RGB666ͼƬ
+void LCD_Band_Flush(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend);                     // Ⱦˢָ
+void LCD_Band_FlushAll(void);                                                                        // Ⱦˢ
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef __LCD_BENCH_H
+#define __LCD_BENCH_H
+
+#include "pico/stdlib.h"
+
+/* ׼Լ,ܹ۲SPIߵĻṩ(hostµģ),ʱΪNULL */
+typedef struct
+{
+	uint32_t bytes;	   // SPIۼƷֽ
+	uint32_t commands; // DCΪ͵ֽ
+} LCD_Bench_Count;
+
+typedef void (*LCD_Bench_Counter)(LCD_Bench_Count *count);
+
+void LCD_Bench_Run(LCD_Bench_Counter counter); // ͼʱ,printf,ǰLCD_Init()
+
+#endif
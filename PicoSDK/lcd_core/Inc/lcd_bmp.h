@@ -0,0 +1,37 @@
+#ifndef __LCD_BMP_H
+#define __LCD_BMP_H
+
+#include "pico/stdlib.h"
+
+/*
+ * BMPͼƬʽʾ: ļͷֻһ,ж롢תDMA,
+ * תһʱһڷ.Դɶṩ,flash/RAMе
+ * (LCD_BMP_MemRead),ҲSDļϵͳеļ.
+ * ֧24λ(BGR888)16λ(RGB565,BI_BITFIELDS)δѹͼƬ,
+ * Ĭϵĵ(һǰ)ʱתз,ô.
+ */
+
+typedef uint32_t (*LCD_BMP_Read)(void *ctx, uint8_t *buf, uint32_t len); // ȡlenֽڵbuf,ʵʶֽ
+
+typedef struct
+{
+	uint16_t width;	   // ()
+	uint16_t height;   // ߶()
+	uint8_t bpp;	   // 24:BGR888 16:RGB565
+	uint8_t bottom_up; // 1:һǰ(BMPĬ) 0:һǰ(߶Ϊ)
+	uint32_t stride;   // ÿֽ(4ֽڶ)
+} LCD_BMP;
+
+/* ڴеBMPļ,LCD_BMP_MemReadʹ */
+typedef struct
+{
+	const uint8_t *data;
+	uint32_t size;
+	uint32_t pos; // һζȡλ,ǰ0
+} LCD_BMP_Mem;
+
+uint8_t LCD_BMP_Open(LCD_BMP *bmp, LCD_BMP_Read read, void *ctx);                                // ȡļͷ,֮λݿͷ
+uint8_t LCD_ShowBMP(int16_t x, int16_t y, const LCD_BMP *bmp, LCD_BMP_Read read, void *ctx); // ȡȫزʾ,ĻĲֱõ
+uint32_t LCD_BMP_MemRead(void *ctx, uint8_t *buf, uint32_t len);                               // LCD_BMP_Memȡ
+
+#endif
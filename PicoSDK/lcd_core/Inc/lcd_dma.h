@@ -0,0 +1,57 @@
+#ifndef __LCD_DMA_H
+#define __LCD_DMA_H
+
+#include "pico/stdlib.h"
+#include "Inc/lcd_init.h"
+
+/* Ļյ,LCD_PIXEL_BYTES;л尴ʹ,DMA */
+#if LCD_PIXEL_BYTES == 3
+typedef struct
+{
+	uint8_t r, g, b; // RGB666,ÿ6λЧ
+} LCD_Pixel;
+#else
+typedef uint16_t LCD_Pixel; // RGB565
+#endif
+
+void LCD_DMA_Init(void);                                   // 벢LCD SPIDMAͨ
+void LCD_DMA_Write(const uint8_t *buf, uint32_t len);      // һ,ǰbuf뱣Ч
+#if LCD_PIXEL_BYTES == 2
+void LCD_DMA_Write16(const uint16_t *buf, uint32_t count); // countRGB565
+#endif
+void LCD_DMA_Fill(uint16_t color, uint32_t count);         // ظcountͬ,ռû
+void LCD_DMA_Wait(void);                                   // ȴһδ(SPIλĴ)
+bool LCD_DMA_Busy(void);                                   // ѯǷڽ
+
+/******************************************************************************
+	  ˵RGB565ɫתΪĻ
+	  ݣcolor ɫ
+	  ֵ  Ļ,RGB666ʱLCD_WR_DATA͵ֽͬ
+******************************************************************************/
+static inline LCD_Pixel LCD_Pixel_Color(uint16_t color)
+{
+#if LCD_PIXEL_BYTES == 3
+	LCD_Pixel p = {(color >> 8) & 0xF8, (color >> 3) & 0xFC, (uint8_t)(color << 3)};
+	return p;
+#else
+	return color;
+#endif
+}
+
+/******************************************************************************
+	  ˵һĻ
+	  ݣbuf ׵ַ
+				count ظ
+	  ֵ  
+	  ˵    LCD_DMA_Wait()֮ǰ޸buf
+******************************************************************************/
+static inline void LCD_DMA_WritePixels(const LCD_Pixel *buf, uint32_t count)
+{
+#if LCD_PIXEL_BYTES == 3
+	LCD_DMA_Write((const uint8_t *)buf, count * 3);
+#else
+	LCD_DMA_Write16(buf, count);
+#endif
+}
+
+#endif
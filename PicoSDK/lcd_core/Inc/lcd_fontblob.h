@@ -0,0 +1,63 @@
+#ifndef __LCD_FONTBLOB_H
+#define __LCD_FONTBLOB_H
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+
+/*
+ * flashֿ: ֿļ(tools/gen_font_blob.py)flashר,
+ * ͨXIPֱַӶȡ,flashжֲ,ռRAM.
+ * ֿ picotool load -o ַ ļ.bin ,Ҳʱ
+ * LCD_FontBlob_Erase/LCD_FontBlob_Writeд,ֿⲻҪ±.
+ *
+ * ļʽ(С): ļͷ,count(code),ģ.
+ * codeС0x80ΪASCII,ΪGB2312(ֽǰ).
+ * ģֻӾ,ÿ(width*bpp+7)/8ֽ,λ.
+ */
+
+#ifndef LCD_FONT_BLOB_OFFSET
+#define LCD_FONT_BLOB_OFFSET (1024 * 1024) // ֿflashеƫ,,ڳ֮
+#endif
+#define LCD_FONT_BLOB_SIZE (PICO_FLASH_SIZE_BYTES - LCD_FONT_BLOB_OFFSET)
+#define LCD_FONT_BLOB_ADDR ((const uint8_t *)(XIP_BASE + LCD_FONT_BLOB_OFFSET)) // ֿXIPַ
+
+#define LCD_FONT_BLOB_VERSION 1
+
+typedef struct
+{
+	char magic[4];	   // "LCDF"
+	uint8_t version;   // LCD_FONT_BLOB_VERSION
+	uint8_t bpp;	   // ÿ1/2/4λ
+	uint8_t height;	   // и
+	uint8_t max_width; // ģĿ
+	uint32_t count;	   // 
+	uint32_t size;	   // ļֽ
+} LCD_FontBlob_Header;
+
+typedef struct
+{
+	uint16_t code; // ASCIIGB2312
+	uint8_t width; // Ӿο
+	uint8_t height;
+	uint8_t x_off; // ӾַϽǵƫ
+	uint8_t y_off;
+	uint8_t advance; // ʾxǰ
+	uint8_t reserved;
+	uint32_t offset; // ģģƫ
+} LCD_FontBlob_Entry;
+
+typedef struct
+{
+	const LCD_FontBlob_Header *head;
+	const LCD_FontBlob_Entry *index;
+	const uint8_t *bitmap; // ģ
+} LCD_FontBlob;
+
+uint8_t LCD_FontBlob_Open(LCD_FontBlob *blob, const uint8_t *addr);                     // 鲢addrֿ
+const LCD_FontBlob_Entry *LCD_FontBlob_Find(const LCD_FontBlob *blob, uint16_t code);   // ַ,ûʱNULL
+uint16_t LCD_FontBlob_Measure(const LCD_FontBlob *blob, const uint8_t *s);              // ַʾ
+void LCD_ShowStringBlob(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, const LCD_FontBlob *blob, uint8_t mode); // flashֿʾӢĻַ
+uint8_t LCD_FontBlob_Erase(uint32_t size);                                              // ֿͷsizeֽ
+uint8_t LCD_FontBlob_Write(uint32_t pos, const uint8_t *data, uint32_t len);            // ֿдһ
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef __LCD_PANEL_H
+#define __LCD_PANEL_H
+
+#include "pico/stdlib.h"
+
+/*
+ * Ļ: lcd_coreеĻͨ,ÿĻֻṩ.
+ * Inc/lcd_init.h  šֱ(LCD_W/LCD_H)ظʽ(LCD_PIXEL_BYTES)ʾʹоƬ,
+ *                 ЩСʹ֧,ʱȷ,ĩβļ
+ * Src/lcd_panel.c lcd_panel: ʼСÿ0x36Դƫ
+ */
+
+#define LCD_TOUCH_NONE 0
+#define LCD_TOUCH_FT6236 1
+#define LCD_TOUCH_CST816 2
+
+#ifndef LCD_TOUCH
+#define LCD_TOUCH LCD_TOUCH_NONE
+#endif
+#ifndef LCD_TOUCH_FLIP_X
+#define LCD_TOUCH_FLIP_X 0 // 1:Xҷת
+#endif
+#ifndef LCD_TOUCH_FLIP_Y
+#define LCD_TOUCH_FLIP_Y 0 // 1:Y·ת
+#endif
+#ifndef LCD_TOUCH_OFFSET_X
+#define LCD_TOUCH_OFFSET_X 0 // תӵϵƫ
+#endif
+#ifndef LCD_TOUCH_OFFSET_Y
+#define LCD_TOUCH_OFFSET_Y 0
+#endif
+
+/*
+ * ʼ: ÿΪ ,,...
+ * LCD_INIT_DELAYʱ,֮ٸһֽڵʱ(ms);
+ * 0x36ʱдmadctl[USE_HORIZONTAL]
+ */
+#define LCD_INIT_DELAY 0x80
+
+typedef struct
+{
+	const uint8_t *init; // ʼ
+	uint16_t init_len;	 // ʼֽ
+	uint8_t madctl[4];	 // ÿ(USE_HORIZONTAL 0~3)0x36
+	uint16_t x_off[4];	 // ÿԴƫ
+	uint16_t y_off[4];	 // ÿԴƫ
+} LCD_Panel;
+
+extern const LCD_Panel lcd_panel; // ǰĻ,Ļ̵Src/lcd_panel.c
+
+//-----------------LCD˿ڶ----------------
+
+#define LCD_RES_Clr()  gpio_put(LCD_RES_PIN,0)  // RES
+#define LCD_RES_Set()  gpio_put(LCD_RES_PIN,1)
+
+#define LCD_DC_Clr()   gpio_put(LCD_DC_PIN,0)  // DC
+#define LCD_DC_Set()   gpio_put(LCD_DC_PIN,1)
+
+#define LCD_BLK_Clr()  gpio_put(LCD_BLK_PIN,0)  // BLK
+#define LCD_BLK_Set()  gpio_put(LCD_BLK_PIN,1)
+
+void LCD_WR_DATA(uint16_t dat);//дһ
+void LCD_Address_Set(uint16_t x1,uint16_t y1,uint16_t x2,uint16_t y2);//꺯
+uint8_t LCD_Set_Scan(uint8_t bottom_up);//дԴз
+void LCD_Init(void);//LCDʼ
+
+#endif
@@ -0,0 +1,223 @@
+/*  PicoSDK/tools/gen_aa_font.py  lcdfont.h (2bpp),޸ֿ,ֹ༭ */
+#ifndef __LCDFONT_AA_H
+#define __LCDFONT_AA_H
+
+#include "lcd.h"
+
+const unsigned char ascii_aa_0612[][24]={ // 6x12,ascii_2412Сһ
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" "*/
+{0x00,0x00,0x00,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x06,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x0A,0x00,0x05,0x00,0x00,0x00},/*"!"*/
+{0x00,0x00,0x0A,0xA0,0x19,0x80,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"""*/
+{0x00,0x00,0x00,0x00,0x08,0x80,0x08,0x80,0xBF,0xE0,0x20,0x80,0x20,0x80,0x6A,0x90,0x6A,0x90,0x20,0x80,0x10,0x40,0x00,0x00},/*"#"*/
+{0x00,0x00,0x01,0x00,0x0A,0x40,0x26,0xC0,0x32,0x80,0x1A,0x00,0x07,0x40,0x02,0x80,0x36,0xC0,0x22,0x80,0x0A,0x00,0x01,0x00},/*"$"*/
+{0x00,0x00,0x00,0x00,0xA0,0x80,0x8A,0x00,0x8A,0x00,0x99,0x00,0x6A,0x80,0x0A,0x20,0x22,0x20,0x22,0x50,0x11,0x80,0x00,0x00},/*"%"*/
+{0x00,0x00,0x00,0x00,0x29,0x00,0x3A,0x00,0x3A,0x00,0x29,0x90,0x68,0x80,0xCC,0x80,0xCA,0x40,0x93,0x60,0x28,0x90,0x00,0x00},/*"&"*/
+{0x00,0x00,0x34,0x00,0x08,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'"*/
+{0x00,0x00,0x00,0x50,0x01,0x40,0x02,0x00,0x05,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x02,0x00,0x02,0x00,0x00,0x80,0x00,0x10},/*"("*/
+{0x00,0x00,0x50,0x00,0x14,0x00,0x08,0x00,0x05,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x08,0x00,0x08,0x00,0x20,0x00,0x40,0x00},/*")"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x52,0x20,0x66,0xA0,0x6A,0xA0,0x52,0x20,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"*"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x6A,0xA0,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"+"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x00,0x08,0x00,0x20,0x00},/*","*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"-"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x24,0x00,0x00,0x00},/*"."*/
+{0x00,0x00,0x00,0x60,0x00,0x80,0x00,0x80,0x02,0x00,0x02,0x00,0x09,0x00,0x08,0x00,0x14,0x00,0x20,0x00,0x60,0x00,0x40,0x00},/*"/"*/
+{0x00,0x00,0x00,0x00,0x0A,0x00,0x25,0x80,0x60,0x90,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0x60,0x90,0x25,0x80,0x0A,0x00,0x00,0x00},/*"0"*/
+{0x00,0x00,0x00,0x00,0x01,0x00,0x2A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x2A,0x80,0x00,0x00},/*"1"*/
+{0x00,0x00,0x00,0x00,0x1A,0x00,0x51,0x80,0xA0,0xC0,0x00,0x80,0x02,0x40,0x09,0x00,0x14,0x40,0x60,0x80,0x6A,0x80,0x00,0x00},/*"2"*/
+{0x00,0x00,0x00,0x00,0x19,0x00,0xA2,0x40,0x52,0x80,0x02,0x40,0x0A,0x40,0x00,0x80,0x50,0xC0,0xA1,0x80,0x1A,0x00,0x00,0x00},/*"3"*/
+{0x00,0x00,0x00,0x00,0x01,0x40,0x02,0x80,0x0A,0x80,0x16,0x80,0x22,0x80,0xAA,0xA0,0x02,0x80,0x02,0x80,0x06,0x90,0x00,0x00},/*"4"*/
+{0x00,0x00,0x00,0x00,0x2A,0x80,0x20,0x00,0x20,0x00,0x2A,0x00,0x21,0x80,0x00,0xC0,0xA0,0xC0,0x52,0x80,0x1A,0x00,0x00,0x00},/*"5"*/
+{0x00,0x00,0x00,0x00,0x06,0x40,0x24,0xC0,0x20,0x00,0xA6,0x40,0xA4,0x90,0xA0,0xA0,0x60,0xA0,0x24,0x80,0x0A,0x00,0x00,0x00},/*"6"*/
+{0x00,0x00,0x00,0x00,0x1A,0x90,0x20,0x90,0x10,0x80,0x01,0x40,0x02,0x00,0x02,0x00,0x0A,0x00,0x0A,0x00,0x05,0x00,0x00,0x00},/*"7"*/
+{0x00,0x00,0x00,0x00,0x1A,0x40,0x60,0x90,0xA0,0xA0,0x34,0x80,0x1B,0x40,0x60,0x90,0xA0,0xA0,0x60,0x90,0x0A,0x40,0x00,0x00},/*"8"*/
+{0x00,0x00,0x00,0x00,0x0A,0x00,0x30,0x80,0xA0,0x90,0xA0,0xA0,0x61,0xA0,0x19,0xA0,0x00,0xC0,0x31,0x80,0x19,0x00,0x00,0x00},/*"9"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0B,0x00,0x06,0x00,0x00,0x00},/*":"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x06,0x00,0x08,0x00},/*";"*/
+{0x00,0x00,0x00,0x00,0x00,0x50,0x01,0x40,0x05,0x00,0x14,0x00,0x20,0x00,0x08,0x00,0x02,0x00,0x00,0x80,0x00,0x10,0x00,0x00},/*"<"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x90,0x00,0x00,0x6A,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"="*/
+{0x00,0x00,0x00,0x00,0x20,0x00,0x08,0x00,0x02,0x00,0x00,0x80,0x00,0x50,0x01,0x40,0x05,0x00,0x14,0x00,0x10,0x00,0x00,0x00},/*">"*/
+{0x00,0x00,0x00,0x00,0x06,0x80,0x24,0x60,0x20,0x30,0x20,0xA0,0x02,0x40,0x02,0x00,0x00,0x00,0x0B,0x00,0x06,0x00,0x00,0x00},/*"?"*/
+{0x00,0x00,0x00,0x00,0x1A,0x80,0x32,0x90,0x6A,0xA0,0xAA,0x60,0xAE,0x20,0xAE,0x50,0x26,0x50,0x24,0x80,0x0A,0x00,0x00,0x00},/*"@"*/
+{0x00,0x00,0x00,0x00,0x05,0x00,0x0A,0x00,0x0A,0x00,0x16,0x00,0x21,0x80,0x2A,0x80,0x20,0x80,0x80,0x90,0xA0,0xA0,0x00,0x00},/*"A"*/
+{0x00,0x00,0x00,0x00,0x6A,0x00,0x31,0xC0,0x30,0xC0,0x31,0x80,0x3A,0x80,0x30,0x90,0x30,0xA0,0x30,0x90,0x6A,0x40,0x00,0x00},/*"B"*/
+{0x00,0x00,0x00,0x00,0x06,0x80,0x24,0x90,0x20,0x20,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x60,0x20,0x24,0x80,0x0A,0x00,0x00,0x00},/*"C"*/
+{0x00,0x00,0x00,0x00,0xA9,0x00,0x31,0x80,0x30,0x90,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0x90,0x31,0x80,0xA9,0x00,0x00,0x00},/*"D"*/
+{0x00,0x00,0x00,0x00,0xAA,0x80,0xA0,0x90,0xA0,0x10,0xA2,0x00,0xAA,0x00,0xA2,0x00,0xA0,0x10,0xA0,0x50,0xAA,0x80,0x00,0x00},/*"E"*/
+{0x00,0x00,0x00,0x00,0xAA,0x80,0xA0,0x90,0xA0,0x10,0xA2,0x00,0xAA,0x00,0xA2,0x00,0xA0,0x00,0xA0,0x00,0xA4,0x00,0x00,0x00},/*"F"*/
+{0x00,0x00,0x00,0x00,0x0A,0x00,0x24,0x80,0x20,0x80,0xA0,0x00,0xA0,0x00,0xA2,0xE0,0x60,0xC0,0x24,0xC0,0x0A,0x00,0x00,0x00},/*"G"*/
+{0x00,0x00,0x00,0x00,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0xAA,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0x00,0x00},/*"H"*/
+{0x00,0x00,0x00,0x00,0x2A,0x80,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x2A,0x80,0x00,0x00},/*"I"*/
+{0x00,0x00,0x00,0x00,0x1A,0x90,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x53,0x00,0x69,0x00},/*"J"*/
+{0x00,0x00,0x00,0x00,0xA2,0x80,0xA2,0x40,0xA5,0x00,0xA8,0x00,0xB9,0x00,0xA2,0x00,0xA2,0x40,0xA0,0x80,0xA1,0x90,0x00,0x00},/*"K"*/
+{0x00,0x00,0x00,0x00,0xA4,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x10,0xA0,0x50,0xAA,0x80,0x00,0x00},/*"L"*/
+{0x00,0x00,0x00,0x00,0x90,0x90,0xA2,0xC0,0xB2,0xC0,0xB2,0xC0,0xA6,0xC0,0xA9,0xC0,0x8C,0xC0,0x88,0xC0,0x91,0x90,0x00,0x00},/*"M"*/
+{0x00,0x00,0x00,0x00,0x61,0xA0,0x34,0x80,0x28,0x80,0x29,0x80,0x26,0x80,0x22,0x80,0x22,0xC0,0x20,0xC0,0xA4,0x40,0x00,0x00},/*"N"*/
+{0x00,0x00,0x00,0x00,0x0A,0x00,0x25,0x80,0x60,0x90,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0x60,0x90,0x25,0x80,0x0A,0x00,0x00,0x00},/*"O"*/
+{0x00,0x00,0x00,0x00,0xAA,0x00,0xA0,0x90,0xA0,0xA0,0xA0,0xA0,0xAA,0x80,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA4,0x00,0x00,0x00},/*"P"*/
+{0x00,0x00,0x00,0x00,0x0A,0x00,0x25,0x80,0x60,0x90,0xA0,0xA0,0xA0,0xA0,0xA0,0xA0,0x6A,0x90,0x26,0x80,0x0A,0x90,0x00,0x80},/*"Q"*/
+{0x00,0x00,0x00,0x00,0xAA,0x40,0xA0,0x90,0xA0,0xA0,0xA0,0x90,0xAA,0x00,0xA2,0x00,0xA1,0x80,0xA0,0x90,0xA0,0x60,0x00,0x00},/*"R"*/
+{0x00,0x00,0x00,0x00,0x1A,0x40,0x60,0x80,0xA0,0x40,0x78,0x00,0x1B,0x80,0x01,0xD0,0x80,0xA0,0x60,0x90,0x0A,0x40,0x00,0x00},/*"S"*/
+{0x00,0x00,0x00,0x00,0x6A,0x90,0x8A,0x20,0x4A,0x10,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x1A,0x40,0x00,0x00},/*"T"*/
+{0x00,0x00,0x00,0x00,0x64,0x90,0x30,0x80,0x30,0x80,0x30,0x80,0x30,0x80,0x30,0x80,0x30,0x80,0x24,0x80,0x0A,0x00,0x00,0x00},/*"U"*/
+{0x00,0x00,0x00,0x00,0xA0,0x90,0x60,0x80,0x20,0x80,0x21,0x40,0x26,0x00,0x1A,0x00,0x0A,0x00,0x08,0x00,0x04,0x00,0x00,0x00},/*"V"*/
+{0x00,0x00,0x00,0x00,0x9A,0x60,0x86,0x20,0xA2,0x20,0x2A,0x80,0x2B,0x80,0x3A,0x80,0x2A,0x80,0x22,0x40,0x11,0x00,0x00,0x00},/*"W"*/
+{0x00,0x00,0x00,0x00,0x65,0x90,0x20,0x80,0x19,0x40,0x0A,0x00,0x09,0x00,0x0A,0x00,0x16,0x40,0x20,0x80,0x61,0x90,0x00,0x00},/*"X"*/
+{0x00,0x00,0x00,0x00,0xA0,0xA0,0x60,0x50,0x20,0x80,0x29,0x40,0x0E,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x1A,0x40,0x00,0x00},/*"Y"*/
+{0x00,0x00,0x00,0x00,0x2A,0x90,0x60,0x80,0x41,0x80,0x02,0x00,0x05,0x00,0x08,0x00,0x24,0x10,0x20,0x50,0x6A,0x80,0x00,0x00},/*"Z"*/
+{0x00,0x00,0x0A,0x80,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x06,0x80},/*"["*/
+{0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x08,0x00,0x08,0x00,0x05,0x00,0x02,0x00,0x02,0x00,0x00,0x80,0x00,0x80,0x00,0x50},/*"\\"*/
+{0x00,0x00,0x2A,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x29,0x00},/*"]"*/
+{0x05,0x00,0x15,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xA0},/*"_"*/
+{0x00,0x00,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x80,0x20,0xC0,0x2A,0xC0,0xA0,0xC0,0xA1,0xD0,0x29,0x60,0x00,0x00},/*"a"*/
+{0x00,0x00,0x00,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x3A,0x80,0x34,0xA0,0x30,0xA0,0x30,0xA0,0x34,0x80,0x16,0x40,0x00,0x00},/*"b"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x40,0x62,0x80,0xA0,0x00,0xA0,0x40,0x30,0x80,0x0A,0x00,0x00,0x00},/*"c"*/
+{0x00,0x00,0x00,0x00,0x02,0x80,0x00,0xC0,0x00,0xC0,0x2A,0xC0,0x60,0xC0,0xA0,0xC0,0xA0,0xC0,0x21,0xD0,0x19,0x40,0x00,0x00},/*"d"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x80,0x20,0x90,0x3A,0xA0,0x30,0x00,0x28,0x50,0x06,0x40,0x00,0x00},/*"e"*/
+{0x00,0x00,0x00,0x00,0x02,0x80,0x09,0xA0,0x0C,0x00,0x6E,0x40,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x2A,0x40,0x00,0x00},/*"f"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0xA0,0x32,0x80,0x26,0x80,0x2A,0x00,0x3B,0x80,0xA0,0xC0,0x6A,0x80},/*"g"*/
+{0x00,0x00,0x00,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x3A,0x80,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x65,0x90,0x00,0x00},/*"h"*/
+{0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x00,0x01,0x00,0x2A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x2A,0x80,0x00,0x00},/*"i"*/
+{0x00,0x00,0x00,0x00,0x02,0x40,0x02,0x40,0x00,0x40,0x0A,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x3A,0x00},/*"j"*/
+{0x00,0x00,0x00,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x32,0x80,0x32,0x00,0x3A,0x00,0x32,0x40,0x30,0x80,0x65,0x90,0x00,0x00},/*"k"*/
+{0x00,0x00,0x00,0x00,0x2A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x2A,0x80,0x00,0x00},/*"l"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xA0,0xAA,0xA0,0xAA,0xA0,0xAA,0xA0,0xAA,0xA0,0xAA,0xA0,0x00,0x00},/*"m"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0x80,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x65,0x90,0x00,0x00},/*"n"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x40,0x60,0x90,0xA0,0xA0,0xA0,0xA0,0x30,0xC0,0x0A,0x00,0x00,0x00},/*"o"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7A,0x80,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x34,0xC0,0x36,0x40,0x78,0x00},/*"p"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x80,0x60,0xC0,0xA0,0xC0,0xA0,0xC0,0x21,0xC0,0x19,0xC0,0x02,0xD0},/*"q"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x90,0x28,0x50,0x28,0x00,0x28,0x00,0x28,0x00,0xAA,0x00,0x00,0x00},/*"r"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xC0,0x30,0x80,0x1E,0x00,0x12,0xC0,0x21,0xC0,0x2A,0x40,0x00,0x00},/*"s"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0C,0x00,0x6E,0x40,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x80,0x06,0x40,0x00,0x00},/*"t"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0x71,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x35,0xD0,0x19,0x40,0x00,0x00},/*"u"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x90,0x20,0x80,0x19,0x40,0x0E,0x00,0x0A,0x00,0x04,0x00,0x00,0x00},/*"v"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0x60,0x66,0x50,0x2A,0x80,0x2A,0x80,0x2A,0x80,0x10,0x00,0x00,0x00},/*"w"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x90,0x09,0x40,0x0A,0x00,0x0A,0x00,0x20,0x80,0x65,0x90,0x00,0x00},/*"x"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x90,0x20,0x80,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x08,0x00,0x28,0x00},/*"y"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x80,0x22,0x00,0x09,0x00,0x18,0x40,0x20,0x80,0x2A,0x40,0x00,0x00},/*"z"*/
+{0x00,0x00,0x01,0x80,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x05,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x80},/*"{"*/
+{0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00},/*"|"*/
+{0x00,0x00,0x24,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x05,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x20,0x00},/*"}"*/
+{0x24,0x00,0x86,0x20,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"~"*/
+};
+
+const unsigned char ascii_aa_0816[][32]={ // 8x16,ascii_3216Сһ
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" "*/
+{0x00,0x00,0x00,0x00,0x02,0x40,0x03,0x80,0x03,0x80,0x03,0x80,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x00,0x00,0x01,0x40,0x03,0xC0,0x01,0x40,0x00,0x00,0x00,0x00},/*"!"*/
+{0x00,0x00,0x06,0x24,0x0B,0x78,0x1D,0xA0,0x24,0x80,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"""*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x6A,0xA9,0x6A,0xA9,0x08,0x20,0x08,0x20,0x08,0x20,0xBF,0xFE,0x20,0x20,0x20,0x20,0x10,0x10,0x00,0x00,0x00,0x00},/*"#"*/
+{0x00,0x00,0x00,0x00,0x00,0x80,0x06,0xA4,0x18,0x8C,0x28,0xAC,0x1D,0x80,0x07,0x80,0x01,0xE0,0x00,0xA8,0x24,0x8C,0x34,0x8C,0x24,0xA4,0x06,0x90,0x00,0x80,0x00,0x00},/*"$"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x18,0xCA,0x20,0xCA,0x20,0xCA,0x80,0x99,0xA4,0x26,0x98,0x02,0xCA,0x05,0xCA,0x08,0xCA,0x18,0x98,0x10,0x24,0x00,0x00,0x00,0x00},/*"%"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x40,0x32,0x80,0x32,0x80,0x32,0x00,0x29,0x68,0x68,0x20,0x89,0x20,0xC6,0x20,0xC2,0xC1,0xA1,0x95,0x19,0x24,0x00,0x00,0x00,0x00},/*"&"*/
+{0x00,0x00,0x24,0x00,0x3C,0x00,0x0C,0x00,0x24,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"'"*/
+{0x00,0x00,0x00,0x01,0x00,0x08,0x00,0x20,0x00,0x60,0x00,0xC0,0x01,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x01,0x80,0x00,0xC0,0x00,0xA0,0x00,0x20,0x00,0x08,0x00,0x01},/*"("*/
+{0x00,0x00,0x40,0x00,0x20,0x00,0x08,0x00,0x09,0x00,0x03,0x00,0x02,0x40,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x40,0x03,0x00,0x0A,0x00,0x08,0x00,0x20,0x00,0x40,0x00},/*")"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x38,0x9E,0x1A,0xA8,0x02,0x90,0x2D,0xAD,0x24,0x89,0x02,0xC0,0x01,0x40,0x00,0x00,0x00,0x00,0x00,0x00},/*"*"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x80,0x00,0x80,0x00,0x80,0x2A,0xA9,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"+"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x2C,0x00,0x08,0x00,0x60,0x00},/*","*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"-"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x3C,0x00,0x14,0x00,0x00,0x00,0x00,0x00},/*"."*/
+{0x00,0x00,0x00,0x01,0x00,0x09,0x00,0x08,0x00,0x24,0x00,0x20,0x00,0x90,0x00,0x80,0x02,0x40,0x02,0x00,0x09,0x00,0x08,0x00,0x24,0x00,0x20,0x00,0x90,0x00,0x00,0x00},/*"/"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xA0,0x18,0x18,0x28,0x08,0x30,0x0A,0x30,0x0A,0x30,0x0A,0x30,0x0A,0x24,0x09,0x28,0x0C,0x09,0x24,0x02,0x90,0x00,0x00,0x00,0x00},/*"0"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x1A,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x1A,0xA4,0x00,0x00,0x00,0x00},/*"1"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xA4,0x20,0x18,0x20,0x0C,0x20,0x0C,0x00,0x24,0x00,0x50,0x01,0x40,0x05,0x04,0x14,0x08,0x2A,0xA8,0x2A,0xA4,0x00,0x00,0x00,0x00},/*"2"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xA0,0x30,0x24,0x30,0x28,0x00,0x24,0x02,0x90,0x00,0x64,0x00,0x08,0x20,0x0C,0x30,0x08,0x24,0x24,0x06,0x80,0x00,0x00,0x00,0x00},/*"3"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0xB0,0x02,0xB0,0x06,0xB0,0x08,0xB0,0x14,0xB0,0x20,0xB0,0x6A,0xB9,0x00,0xB0,0x00,0xB0,0x02,0xB9,0x00,0x00,0x00,0x00},/*"4"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFC,0x08,0x00,0x14,0x00,0x22,0x90,0x28,0x24,0x10,0x08,0x00,0x0C,0x20,0x0C,0x20,0x18,0x20,0x24,0x0A,0x80,0x00,0x00,0x00,0x00},/*"5"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xA4,0x08,0x0C,0x28,0x00,0x20,0x00,0x36,0xA4,0x38,0x09,0x30,0x0A,0x30,0x0A,0x28,0x09,0x09,0x18,0x02,0x90,0x00,0x00,0x00,0x00},/*"6"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFC,0x34,0x14,0x20,0x20,0x00,0x50,0x00,0x80,0x00,0x80,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00},/*"7"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xA0,0x24,0x18,0x30,0x0C,0x28,0x18,0x0A,0xA0,0x19,0xA0,0x60,0x28,0xA0,0x0C,0xA0,0x0C,0x24,0x24,0x06,0x80,0x00,0x00,0x00,0x00},/*"8"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x90,0x30,0x24,0xA0,0x08,0xA0,0x0C,0xA0,0x1C,0x24,0x6C,0x0A,0x4C,0x00,0x28,0x20,0x24,0x30,0x90,0x0A,0x40,0x00,0x00,0x00,0x00},/*"9"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x40,0x03,0xC0,0x01,0x40,0x00,0x00,0x00,0x00,0x01,0x40,0x03,0xC0,0x01,0x40,0x00,0x00,0x00,0x00},/*":"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00},/*";"*/
+{0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x14,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x24,0x00,0x09,0x00,0x02,0x40,0x00,0x90,0x00,0x20,0x00,0x08,0x00,0x00,0x00,0x00},/*"<"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA9,0x00,0x00,0x00,0x00,0x6A,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"="*/
+{0x00,0x00,0x00,0x00,0x10,0x00,0x14,0x00,0x09,0x00,0x02,0x40,0x00,0x90,0x00,0x24,0x00,0x18,0x00,0x60,0x01,0x80,0x06,0x00,0x08,0x00,0x20,0x00,0x00,0x00,0x00,0x00},/*">"*/
+{0x00,0x00,0x00,0x00,0x02,0x90,0x18,0x18,0x20,0x0A,0x38,0x0A,0x24,0x09,0x00,0x64,0x01,0x40,0x02,0x00,0x01,0x00,0x01,0x40,0x03,0xC0,0x01,0x40,0x00,0x00,0x00,0x00},/*"?"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xA4,0x18,0x08,0x31,0xB5,0xA2,0x32,0xA6,0x32,0xAA,0x22,0xAA,0xA8,0x66,0x68,0x20,0x05,0x18,0x18,0x02,0x90,0x00,0x00,0x00,0x00},/*"@"*/
+{0x00,0x00,0x00,0x00,0x00,0x40,0x03,0x80,0x02,0x80,0x09,0xC0,0x08,0xC0,0x08,0xA0,0x08,0xA0,0x2A,0xB0,0x20,0x30,0x20,0x24,0x60,0x28,0xA4,0x29,0x00,0x00,0x00,0x00},/*"A"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA4,0x28,0x1C,0x28,0x0C,0x28,0x18,0x2A,0xA0,0x28,0x18,0x28,0x09,0x28,0x0A,0x28,0x0A,0x28,0x18,0x6A,0xA0,0x00,0x00,0x00,0x00},/*"B"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xA8,0x18,0x08,0x30,0x02,0x60,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x60,0x01,0x30,0x05,0x18,0x18,0x02,0x90,0x00,0x00,0x00,0x00},/*"C"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA0,0x28,0x18,0x28,0x0C,0x28,0x0A,0x28,0x0A,0x28,0x0A,0x28,0x0A,0x28,0x09,0x28,0x08,0x28,0x64,0x6A,0x80,0x00,0x00,0x00,0x00},/*"D"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xAC,0x28,0x09,0x28,0x01,0x28,0x20,0x2A,0xB0,0x28,0x20,0x28,0x10,0x28,0x00,0x28,0x02,0x28,0x08,0x6A,0xA8,0x00,0x00,0x00,0x00},/*"E"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xAE,0x28,0x02,0x28,0x01,0x28,0x08,0x2A,0xA8,0x28,0x18,0x28,0x04,0x28,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x00,0x00,0x00,0x00},/*"F"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xA8,0x18,0x08,0x30,0x08,0x60,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x2E,0x60,0x0C,0x24,0x0C,0x18,0x18,0x02,0x90,0x00,0x00,0x00,0x00},/*"G"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x69,0x30,0x28,0x30,0x28,0x30,0x28,0x30,0x28,0x3A,0xA8,0x30,0x28,0x30,0x28,0x30,0x28,0x30,0x28,0xA8,0x69,0x00,0x00,0x00,0x00},/*"H"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xA4,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x1A,0xA4,0x00,0x00,0x00,0x00},/*"I"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xA9,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0xB0,0x90,0x7A,0x40},/*"J"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x29,0x28,0x20,0x28,0x90,0x29,0x80,0x2A,0x80,0x2D,0xC0,0x28,0xA0,0x28,0x70,0x28,0x28,0x28,0x0C,0x69,0x2A,0x00,0x00,0x00,0x00},/*"K"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x02,0x28,0x08,0x6A,0xA8,0x00,0x00,0x00,0x00},/*"L"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x2E,0x38,0x2C,0x28,0x2C,0x2C,0x2C,0x2D,0x9C,0x2A,0x8C,0x2A,0x8C,0x23,0x8C,0x23,0x4C,0x22,0x0C,0xA5,0x2A,0x00,0x00,0x00,0x00},/*"M"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x29,0x2C,0x08,0x2D,0x08,0x2A,0x08,0x23,0x48,0x22,0x88,0x20,0xD8,0x20,0xA8,0x20,0x38,0x20,0x28,0xA4,0x14,0x00,0x00,0x00,0x00},/*"N"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xA0,0x24,0x18,0x30,0x0C,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0x60,0x09,0x20,0x08,0x18,0x24,0x02,0x80,0x00,0x00,0x00,0x00},/*"O"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA4,0x28,0x09,0x28,0x0A,0x28,0x0A,0x28,0x18,0x2A,0xA0,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x00,0x00,0x00,0x00},/*"P"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xA0,0x24,0x18,0x30,0x08,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0x66,0x4A,0x38,0x8C,0x18,0xA4,0x02,0xA1,0x00,0x2D,0x00,0x00},/*"Q"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xA4,0x28,0x1C,0x28,0x0C,0x28,0x18,0x2A,0xA0,0x29,0xC0,0x28,0xA0,0x28,0xA0,0x28,0x30,0x28,0x28,0x69,0x19,0x00,0x00,0x00,0x00},/*"R"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xA8,0x24,0x08,0x30,0x04,0x24,0x00,0x1A,0x80,0x01,0xB4,0x00,0x1D,0x10,0x0A,0x20,0x0A,0x28,0x18,0x12,0xA0,0x00,0x00,0x00,0x00},/*"S"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xA8,0x52,0x86,0x42,0x81,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x06,0x90,0x00,0x00,0x00,0x00},/*"T"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x29,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x28,0x20,0x06,0x80,0x00,0x00,0x00,0x00},/*"U"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x1A,0x28,0x08,0x0C,0x08,0x0C,0x08,0x0A,0x20,0x0A,0x20,0x03,0x20,0x02,0x90,0x02,0xC0,0x01,0x80,0x00,0x40,0x00,0x00,0x00,0x00},/*"V"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x8A,0xA2,0x88,0x31,0x88,0x32,0xC8,0x32,0xC8,0x26,0x88,0x2A,0xA4,0x2C,0xB0,0x1C,0x70,0x08,0x20,0x04,0x10,0x00,0x00,0x00,0x00},/*"W"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x68,0x1C,0x20,0x0D,0x50,0x0A,0x80,0x03,0x80,0x02,0x80,0x02,0xD0,0x08,0xA0,0x08,0x30,0x20,0x28,0x68,0x29,0x00,0x00,0x00,0x00},/*"X"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x79,0x29,0x28,0x14,0x0C,0x20,0x0A,0x20,0x06,0x80,0x03,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x06,0x90,0x00,0x00,0x00,0x00},/*"Y"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xA8,0x20,0x24,0x10,0xA0,0x00,0xD0,0x02,0x80,0x03,0x40,0x0A,0x00,0x0D,0x00,0x28,0x08,0x34,0x18,0x6A,0xA4,0x00,0x00,0x00,0x00},/*"Z"*/
+{0x00,0x00,0x02,0xA8,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0xA8,0x00,0x00},/*"["*/
+{0x00,0x00,0x00,0x00,0x10,0x00,0x28,0x00,0x08,0x00,0x09,0x00,0x06,0x00,0x02,0x00,0x02,0x80,0x00,0x80,0x00,0x90,0x00,0x60,0x00,0x20,0x00,0x28,0x00,0x08,0x00,0x04},/*"\\"*/
+{0x00,0x00,0x2A,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x2A,0x80,0x00,0x00},/*"]"*/
+{0x00,0x00,0x01,0x90,0x06,0x60,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"^"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA},/*"_"*/
+{0x00,0x00,0x19,0x00,0x02,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"`"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x80,0x24,0x60,0x20,0x30,0x0A,0xB0,0x34,0x30,0xA0,0x30,0x60,0xB2,0x1A,0x18,0x00,0x00,0x00,0x00},/*"a"*/
+{0x00,0x00,0x00,0x00,0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0xA0,0x2A,0x18,0x28,0x0A,0x28,0x0A,0x28,0x0A,0x28,0x09,0x2D,0x18,0x12,0x90,0x00,0x00,0x00,0x00},/*"b"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x90,0x19,0x24,0x24,0x28,0x30,0x00,0x30,0x00,0x24,0x08,0x18,0x14,0x02,0x90,0x00,0x00,0x00,0x00},/*"c"*/
+{0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x06,0xA8,0x18,0x28,0x24,0x28,0x30,0x28,0x30,0x28,0x20,0x28,0x18,0x69,0x06,0x50,0x00,0x00,0x00,0x00},/*"d"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x90,0x18,0x24,0x20,0x08,0x3A,0xAC,0x30,0x00,0x24,0x04,0x19,0x18,0x02,0x90,0x00,0x00,0x00,0x00},/*"e"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xAA,0x02,0x03,0x03,0x00,0x2B,0xA4,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1A,0xA0,0x00,0x00,0x00,0x00},/*"f"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x99,0x08,0x29,0x28,0x28,0x18,0x28,0x0E,0xA0,0x28,0x00,0x0F,0xF8,0x20,0x0A,0x30,0x0A,0x1A,0xA8},/*"g"*/
+{0x00,0x00,0x00,0x00,0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x29,0xA0,0x2A,0x18,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x69,0x2A,0x00,0x00,0x00,0x00},/*"h"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC0,0x01,0x80,0x00,0x00,0x1A,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x1A,0xA4,0x00,0x00,0x00,0x00},/*"i"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x00,0x18,0x00,0x00,0x01,0xA8,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x14,0x24,0x1A,0x90},/*"j"*/
+{0x00,0x00,0x00,0x00,0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0x68,0x28,0x60,0x28,0x80,0x2A,0x80,0x28,0xD0,0x28,0x60,0x28,0x28,0x69,0x29,0x00,0x00,0x00,0x00},/*"k"*/
+{0x00,0x00,0x00,0x00,0x00,0x40,0x1A,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x1A,0xA4,0x00,0x00,0x00,0x00},/*"l"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x24,0x36,0x8C,0x32,0x8C,0x32,0x8C,0x32,0x8C,0x32,0x8C,0x32,0x8C,0x66,0x99,0x00,0x00,0x00,0x00},/*"m"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xA0,0x2A,0x18,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x69,0x2A,0x00,0x00,0x00,0x00},/*"n"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x90,0x09,0x28,0x24,0x09,0x30,0x0A,0x30,0x0A,0x24,0x09,0x18,0x18,0x02,0x90,0x00,0x00,0x00,0x00},/*"o"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xA0,0x29,0x18,0x28,0x09,0x28,0x0A,0x28,0x0A,0x28,0x09,0x2D,0x18,0x29,0x90,0x28,0x00,0x69,0x00},/*"p"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x84,0x18,0x2C,0x24,0x0C,0x30,0x0C,0x30,0x0C,0x20,0x0C,0x18,0x2C,0x06,0x8C,0x00,0x0C,0x00,0x2E},/*"q"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x28,0x0A,0x9A,0x0B,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x6A,0x90,0x00,0x00,0x00,0x00},/*"r"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x94,0x18,0x1C,0x28,0x04,0x0A,0x80,0x01,0xB4,0x20,0x0C,0x34,0x18,0x26,0xA0,0x00,0x00,0x00,0x00},/*"s"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x00,0x2B,0xA4,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x04,0x02,0x48,0x00,0xA0,0x00,0x00,0x00,0x00},/*"t"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x28,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x18,0x2E,0x06,0x84,0x00,0x00,0x00,0x00},/*"u"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x28,0x28,0x24,0x1C,0x20,0x0D,0x50,0x0A,0x80,0x07,0x80,0x03,0x40,0x01,0x00,0x00,0x00,0x00,0x00},/*"v"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x9A,0x71,0xC9,0x32,0xC8,0x2A,0xC8,0x2A,0xA8,0x0E,0xB0,0x09,0x60,0x04,0x10,0x00,0x00,0x00,0x00},/*"w"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x68,0x0E,0x20,0x07,0x50,0x02,0x80,0x02,0xD0,0x09,0x60,0x18,0x24,0x68,0x69,0x00,0x00,0x00,0x00},/*"x"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x29,0x28,0x24,0x0C,0x20,0x09,0x20,0x06,0x50,0x03,0x80,0x02,0x80,0x02,0x40,0x02,0x00,0x39,0x00},/*"y"*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xA4,0x20,0x70,0x10,0x90,0x02,0x80,0x07,0x00,0x0D,0x08,0x28,0x18,0x2A,0xA4,0x00,0x00,0x00,0x00},/*"z"*/
+{0x00,0x00,0x00,0x08,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x50,0x01,0x80,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x08},/*"{"*/
+{0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80},/*"|"*/
+{0x00,0x00,0x20,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x05,0x00,0x02,0x40,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x20,0x00},/*"}"*/
+{0x18,0x00,0x62,0x01,0x40,0x89,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"~"*/
+};
+
+const unsigned char tfont_aa12[][36]={ // 12x12,tfont24Сһ
+{0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x20,0x00,0x2A,0xAA,0xA8,0x28,0x20,0x28,0x28,0x20,0x28,0x28,0x20,0x28,0x2A,0xAA,0xA4,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x28,0x00,0x00,0x14,0x00},/*""*/
+{0x00,0x00,0x00,0x02,0xAA,0xA0,0x02,0xAA,0xA0,0x02,0xAA,0xA0,0x01,0x18,0x40,0x6A,0xAA,0xA8,0x03,0xAA,0x90,0x03,0x00,0x80,0x02,0xAA,0x80,0x06,0x48,0xA0,0x28,0x68,0x18,0x00,0x24,0x00},/*""*/
+{0x00,0x00,0x00,0x2A,0xAA,0xA8,0x20,0x02,0x08,0x20,0xA8,0x08,0x20,0x00,0x88,0x22,0xAA,0x08,0x20,0x88,0x08,0x20,0x88,0x48,0x21,0x49,0x68,0x25,0x02,0x88,0x2A,0xAA,0xA8,0x10,0x00,0x04},/*"԰"*/
+{0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x20,0x00,0x0A,0xAA,0xA0,0x08,0x20,0x20,0x0A,0xAA,0xA0,0x08,0x20,0x20,0x08,0x20,0x20,0x0A,0xAA,0x90,0x00,0x20,0x08,0x00,0x24,0x08,0x00,0x0A,0xA4},/*""*/
+{0x00,0x00,0x00,0x0A,0xAA,0xA0,0x00,0x00,0x90,0x00,0x16,0x00,0x00,0x28,0x00,0x6A,0xAA,0xAD,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0x28,0x00,0x00,0xA8,0x00,0x00,0x20,0x00},/*""*/
+};
+
+const unsigned char tfont_aa16[][64]={ // 16x16,tfont32Сһ
+{0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x40,0x0A,0x00,0x20,0xA0,0x03,0x2A,0xAA,0xB8,0x01,0x10,0x20,0x00,0x24,0x80,0x20,0x00,0x1C,0x8E,0xAA,0xB4,0x08,0x8C,0x20,0x30,0x02,0x0E,0xAA,0xB0,0x02,0x0C,0x20,0x30,0x06,0x0E,0xAA,0xB0,0x2D,0x0C,0x20,0x30,0x0C,0x0C,0x20,0x30,0x0C,0x0C,0x20,0x30,0x0C,0x0C,0x21,0xA0,0x00,0x04,0x00,0x40},/*""*/
+{0x00,0x00,0x00,0x00,0x04,0x05,0x02,0x80,0x06,0x02,0x82,0x40,0x02,0x40,0xC2,0x00,0x01,0x2A,0xAA,0xB4,0x20,0x20,0x28,0x00,0x28,0x80,0x28,0x00,0x0C,0x8A,0xAA,0xA0,0x00,0x80,0x28,0x00,0x02,0x40,0x28,0x00,0x03,0x2A,0xAA,0xA8,0x2E,0x00,0x28,0x00,0x0A,0x00,0x28,0x00,0x0A,0x00,0x28,0x00,0x0A,0x00,0x28,0x00,0x00,0x00,0x10,0x00},/*""*/
+{0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x09,0x00,0x28,0x14,0x07,0x2A,0xAA,0xA4,0x02,0x22,0x4C,0x00,0x10,0x86,0x18,0x10,0x28,0x89,0x2A,0xB0,0x0C,0x9D,0x28,0x60,0x02,0x2C,0xA6,0x90,0x02,0x5C,0xA1,0xC0,0x06,0x4D,0x15,0x80,0x2E,0x0C,0x0A,0x00,0x0C,0x0C,0x0B,0x40,0x0C,0x0C,0x25,0xE0,0x0C,0x0C,0x90,0x69,0x00,0x0A,0x00,0x00},/*"Һ"*/
+{0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x40,0x00,0xA0,0x03,0x00,0x00,0xAA,0xAB,0x00,0x00,0xA0,0x03,0x00,0x00,0xA0,0x03,0x00,0x00,0xAA,0xAB,0x00,0x00,0x50,0x01,0x00,0x0A,0xA9,0x2A,0xA4,0x0C,0x0C,0x30,0x20,0x0C,0x0C,0x30,0x20,0x0E,0xAC,0x3A,0xA0,0x0C,0x0C,0x30,0x20,0x0C,0x0C,0x30,0x20,0x0E,0xAC,0x3A,0xA0,0x04,0x00,0x10,0x00},/*""*/
+};
+
+const LCD_Font LCD_Font_AA12 = {6, 12, 2, 2, 1, sizeof(ascii_aa_0612[0]), ascii_aa_0612[0], -1, NULL};
+const LCD_Font LCD_Font_AA16 = {8, 16, 2, 2, 1, sizeof(ascii_aa_0816[0]), ascii_aa_0816[0], -1, NULL};
+const LCD_Font LCD_Font_GB_AA12 = {12, 12, 3, 2, 1, sizeof(tfont_aa12[0]), tfont_aa12[0], 2, NULL};
+const LCD_Font LCD_Font_GB_AA16 = {16, 16, 4, 2, 1, sizeof(tfont_aa16[0]), tfont_aa16[0], 3, NULL};
+
+#endif
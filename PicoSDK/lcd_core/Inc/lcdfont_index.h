@@ -0,0 +1,45 @@
+/*  PicoSDK/tools/gen_gb_index.py  lcdfont.h ,޸ֿ,ֹ༭ */
+#ifndef __LCDFONT_INDEX_H
+#define __LCDFONT_INDEX_H
+
+#define LCD_GB_NONE 0xFFFF // ֺŵֿû
+
+typedef struct
+{
+	uint16_t Code;	  // GB2312,ֽǰ
+	uint16_t Slot[4]; // tfont12/16/24/32е±
+} LCD_GB_Index;
+
+/* Code,LCD_GB_Findֲ */
+static const LCD_GB_Index lcd_gb_index[] = {
+	{0xB5E7, {3, 3, 3, LCD_GB_NONE}}, // 
+	{0xBEA7, {LCD_GB_NONE, LCD_GB_NONE, LCD_GB_NONE, 3}}, // 
+	{0xBEB0, {1, 1, 1, LCD_GB_NONE}}, // 
+	{0xC6D6, {LCD_GB_NONE, LCD_GB_NONE, LCD_GB_NONE, 0}}, // 
+	{0xD1F3, {LCD_GB_NONE, LCD_GB_NONE, LCD_GB_NONE, 1}}, // 
+	{0xD2BA, {LCD_GB_NONE, LCD_GB_NONE, LCD_GB_NONE, 2}}, // Һ
+	{0xD4B0, {2, 2, 2, LCD_GB_NONE}}, // ԰
+	{0xD6D0, {0, 0, 0, LCD_GB_NONE}}, // 
+	{0xD7D3, {4, 4, 4, LCD_GB_NONE}}, // 
+};
+
+typedef struct
+{
+	uint16_t Unicode; // ֵUnicodeλ
+	uint16_t Code;	  // GB2312,ֽǰ
+} LCD_GB_Unicode;
+
+/* Unicode,LCD_GB_FromUnicodeֲ */
+static const LCD_GB_Unicode lcd_gb_unicode[] = {
+	{0x4E2D, 0xD6D0}, // 
+	{0x56ED, 0xD4B0}, // ԰
+	{0x5B50, 0xD7D3}, // 
+	{0x666F, 0xBEB0}, // 
+	{0x6676, 0xBEA7}, // 
+	{0x6D0B, 0xD1F3}, // 
+	{0x6D66, 0xC6D6}, // 
+	{0x6DB2, 0xD2BA}, // Һ
+	{0x7535, 0xB5E7}, // 
+};
+
+#endif
@@ -0,0 +1,792 @@
+/*  PicoSDK/tools/gen_prop_font.py  lcdfont.h ,޸ֿ,ֹ༭ */
+#ifndef __LCDFONT_PROP_H
+#define __LCDFONT_PROP_H
+
+#include "lcd.h"
+
+const unsigned char ascii_p16[]={ // 16ظ߱,ascii_1608
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xC0,0xC0,/*"!"*/
+0x24,0x6C,0x48,0x90,/*"""*/
+0x24,0x24,0x24,0xFE,0x48,0x48,0x48,0xFE,0x48,0x48,0x48,/*"#"*/
+0x20,0x70,0xA8,0xA8,0xA0,0x60,0x30,0x28,0x28,0xA8,0xA8,0x70,0x20,0x20,/*"$"*/
+0x44,0xA4,0xA8,0xA8,0xA8,0x54,0x1A,0x2A,0x2A,0x2A,0x44,/*"%"*/
+0x30,0x48,0x48,0x48,0x50,0x6E,0xA4,0x94,0x88,0x89,0x76,/*"&"*/
+0x60,0x60,0x20,0xC0,/*"'"*/
+0x10,0x20,0x40,0x40,0x80,0x80,0x80,0x80,0x80,0x80,0x40,0x40,0x20,0x10,/*"("*/
+0x80,0x40,0x20,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0x20,0x40,0x80,/*")"*/
+0x10,0x10,0xD6,0x38,0x38,0xD6,0x10,0x10,/*"*"*/
+0x10,0x10,0x10,0x10,0xFE,0x10,0x10,0x10,0x10,/*"+"*/
+0x60,0x60,0x20,0xC0,/*","*/
+0xFE,/*"-"*/
+0xC0,0xC0,/*"."*/
+0x02,0x04,0x04,0x08,0x08,0x10,0x10,0x20,0x20,0x40,0x40,0x80,0x80,/*"/"*/
+0x30,0x48,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x48,0x30,/*"0"*/
+0x20,0xE0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xF8,/*"1"*/
+0x78,0x84,0x84,0x84,0x08,0x08,0x10,0x20,0x40,0x84,0xFC,/*"2"*/
+0x78,0x84,0x84,0x08,0x30,0x08,0x04,0x04,0x84,0x88,0x70,/*"3"*/
+0x08,0x18,0x28,0x48,0x48,0x88,0x88,0xFC,0x08,0x08,0x3C,/*"4"*/
+0xFC,0x80,0x80,0x80,0xB0,0xC8,0x04,0x04,0x84,0x88,0x70,/*"5"*/
+0x38,0x48,0x80,0x80,0xB0,0xC8,0x84,0x84,0x84,0x48,0x30,/*"6"*/
+0xFC,0x88,0x88,0x10,0x10,0x20,0x20,0x20,0x20,0x20,0x20,/*"7"*/
+0x78,0x84,0x84,0x84,0x48,0x30,0x48,0x84,0x84,0x84,0x78,/*"8"*/
+0x30,0x48,0x84,0x84,0x84,0x4C,0x34,0x04,0x04,0x48,0x70,/*"9"*/
+0xC0,0xC0,0x00,0x00,0x00,0x00,0xC0,0xC0,/*":"*/
+0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x80,/*";"*/
+0x04,0x08,0x10,0x20,0x40,0x80,0x40,0x20,0x10,0x08,0x04,/*"<"*/
+0xFE,0x00,0x00,0x00,0xFE,/*"="*/
+0x80,0x40,0x20,0x10,0x08,0x04,0x08,0x10,0x20,0x40,0x80,/*">"*/
+0x78,0x84,0x84,0xC4,0x04,0x08,0x10,0x10,0x00,0x30,0x30,/*"?"*/
+0x38,0x44,0x5A,0xAA,0xAA,0xAA,0xAA,0xB4,0x42,0x44,0x38,/*"@"*/
+0x10,0x10,0x18,0x28,0x28,0x24,0x3C,0x44,0x42,0x42,0xE7,/*"A"*/
+0xF8,0x44,0x44,0x44,0x78,0x44,0x42,0x42,0x42,0x44,0xF8,/*"B"*/
+0x3E,0x42,0x42,0x80,0x80,0x80,0x80,0x80,0x42,0x44,0x38,/*"C"*/
+0xF8,0x44,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x44,0xF8,/*"D"*/
+0xFC,0x42,0x48,0x48,0x78,0x48,0x48,0x40,0x42,0x42,0xFC,/*"E"*/
+0xFC,0x42,0x48,0x48,0x78,0x48,0x48,0x40,0x40,0x40,0xE0,/*"F"*/
+0x3C,0x44,0x44,0x80,0x80,0x80,0x8E,0x84,0x44,0x44,0x38,/*"G"*/
+0xE7,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0xE7,/*"H"*/
+0xF8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xF8,/*"I"*/
+0x3E,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x88,0xF0,/*"J"*/
+0xEE,0x44,0x48,0x50,0x70,0x50,0x48,0x48,0x44,0x44,0xEE,/*"K"*/
+0xE0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x42,0xFE,/*"L"*/
+0xEE,0x6C,0x6C,0x6C,0x6C,0x54,0x54,0x54,0x54,0x54,0xD6,/*"M"*/
+0xC7,0x62,0x62,0x52,0x52,0x4A,0x4A,0x4A,0x46,0x46,0xE2,/*"N"*/
+0x38,0x44,0x82,0x82,0x82,0x82,0x82,0x82,0x82,0x44,0x38,/*"O"*/
+0xFC,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,0x40,0x40,0xE0,/*"P"*/
+0x38,0x44,0x82,0x82,0x82,0x82,0x82,0xB2,0xCA,0x4C,0x38,0x06,/*"Q"*/
+0xFC,0x42,0x42,0x42,0x7C,0x48,0x48,0x44,0x44,0x42,0xE3,/*"R"*/
+0x7C,0x84,0x84,0x80,0x40,0x30,0x08,0x04,0x84,0x84,0xF8,/*"S"*/
+0xFE,0x92,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,/*"T"*/
+0xE7,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,/*"U"*/
+0xE7,0x42,0x42,0x44,0x24,0x24,0x28,0x28,0x18,0x10,0x10,/*"V"*/
+0xD6,0x92,0x92,0x92,0x92,0xAA,0xAA,0x6C,0x44,0x44,0x44,/*"W"*/
+0xE7,0x42,0x24,0x24,0x18,0x18,0x18,0x24,0x24,0x42,0xE7,/*"X"*/
+0xEE,0x44,0x44,0x28,0x28,0x10,0x10,0x10,0x10,0x10,0x38,/*"Y"*/
+0x7E,0x84,0x04,0x08,0x08,0x10,0x20,0x20,0x42,0x42,0xFC,/*"Z"*/
+0xF0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xF0,/*"["*/
+0x80,0x80,0x40,0x40,0x20,0x20,0x20,0x10,0x10,0x08,0x08,0x08,0x04,0x04,/*"\\"*/
+0xF0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,/*"]"*/
+0x70,0x88,/*"^"*/
+0xFF,/*"_"*/
+0xC0,0x20,/*"`"*/
+0x78,0x84,0x3C,0x44,0x84,0x84,0x7E,/*"a"*/
+0xC0,0x40,0x40,0x40,0x58,0x64,0x42,0x42,0x42,0x64,0x58,/*"b"*/
+0x38,0x44,0x80,0x80,0x80,0x44,0x38,/*"c"*/
+0x0C,0x04,0x04,0x04,0x3C,0x44,0x84,0x84,0x84,0x4C,0x36,/*"d"*/
+0x78,0x84,0xFC,0x80,0x80,0x84,0x78,/*"e"*/
+0x1E,0x22,0x20,0x20,0xFC,0x20,0x20,0x20,0x20,0x20,0xF8,/*"f"*/
+0x7C,0x88,0x88,0x70,0x80,0x78,0x84,0x84,0x78,/*"g"*/
+0xC0,0x40,0x40,0x40,0x5C,0x62,0x42,0x42,0x42,0x42,0xE7,/*"h"*/
+0x60,0x60,0x00,0x00,0xE0,0x20,0x20,0x20,0x20,0x20,0xF8,/*"i"*/
+0x18,0x18,0x00,0x00,0x38,0x08,0x08,0x08,0x08,0x08,0x08,0x88,0xF0,/*"j"*/
+0xC0,0x40,0x40,0x40,0x4E,0x48,0x50,0x68,0x48,0x44,0xEE,/*"k"*/
+0xE0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xF8,/*"l"*/
+0xFE,0x49,0x49,0x49,0x49,0x49,0xED,/*"m"*/
+0xDC,0x62,0x42,0x42,0x42,0x42,0xE7,/*"n"*/
+0x78,0x84,0x84,0x84,0x84,0x84,0x78,/*"o"*/
+0xD8,0x64,0x42,0x42,0x42,0x44,0x78,0x40,0xE0,/*"p"*/
+0x3C,0x44,0x84,0x84,0x84,0x44,0x3C,0x04,0x0E,/*"q"*/
+0xEE,0x32,0x20,0x20,0x20,0x20,0xF8,/*"r"*/
+0x7C,0x84,0x80,0x78,0x04,0x84,0xF8,/*"s"*/
+0x20,0x20,0xF8,0x20,0x20,0x20,0x20,0x20,0x18,/*"t"*/
+0xC6,0x42,0x42,0x42,0x42,0x46,0x3B,/*"u"*/
+0xE7,0x42,0x24,0x24,0x28,0x10,0x10,/*"v"*/
+0xD7,0x92,0x92,0xAA,0xAA,0x44,0x44,/*"w"*/
+0xDC,0x48,0x30,0x30,0x30,0x48,0xEC,/*"x"*/
+0xE7,0x42,0x24,0x24,0x28,0x18,0x10,0x10,0xE0,/*"y"*/
+0xFC,0x88,0x10,0x20,0x20,0x44,0xFC,/*"z"*/
+0x30,0x40,0x40,0x40,0x40,0x40,0x80,0x40,0x40,0x40,0x40,0x40,0x40,0x30,/*"{"*/
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,/*"|"*/
+0xC0,0x20,0x20,0x20,0x20,0x20,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0xC0,/*"}"*/
+0x60,0x98,0x86,/*"~"*/
+};
+
+const LCD_Glyph ascii_p16_glyphs[95]={ // offset,width,height,x_off,y_off,advance
+	{0, 0, 0, 0, 0, 4}, /*" "*/
+	{0, 2, 11, 0, 3, 3}, /*"!"*/
+	{11, 6, 4, 0, 1, 7}, /*"""*/
+	{15, 7, 11, 0, 3, 8}, /*"#"*/
+	{26, 5, 14, 0, 2, 6}, /*"$"*/
+	{40, 7, 11, 0, 3, 8}, /*"%"*/
+	{51, 8, 11, 0, 3, 9}, /*"&"*/
+	{62, 3, 4, 0, 1, 4}, /*"'"*/
+	{66, 4, 14, 0, 1, 5}, /*"("*/
+	{80, 4, 14, 0, 1, 5}, /*")"*/
+	{94, 7, 8, 0, 4, 8}, /*"*"*/
+	{102, 7, 9, 0, 4, 8}, /*"+"*/
+	{111, 3, 4, 0, 12, 4}, /*","*/
+	{115, 7, 1, 0, 8, 8}, /*"-"*/
+	{116, 2, 2, 0, 12, 3}, /*"."*/
+	{118, 7, 13, 0, 2, 8}, /*"/"*/
+	{131, 6, 11, 0, 3, 7}, /*"0"*/
+	{142, 5, 11, 0, 3, 6}, /*"1"*/
+	{153, 6, 11, 0, 3, 7}, /*"2"*/
+	{164, 6, 11, 0, 3, 7}, /*"3"*/
+	{175, 6, 11, 0, 3, 7}, /*"4"*/
+	{186, 6, 11, 0, 3, 7}, /*"5"*/
+	{197, 6, 11, 0, 3, 7}, /*"6"*/
+	{208, 6, 11, 0, 3, 7}, /*"7"*/
+	{219, 6, 11, 0, 3, 7}, /*"8"*/
+	{230, 6, 11, 0, 3, 7}, /*"9"*/
+	{241, 2, 8, 0, 6, 3}, /*":"*/
+	{249, 2, 9, 0, 7, 3}, /*";"*/
+	{258, 6, 11, 0, 3, 7}, /*"<"*/
+	{269, 7, 5, 0, 6, 8}, /*"="*/
+	{274, 6, 11, 0, 3, 7}, /*">"*/
+	{285, 6, 11, 0, 3, 7}, /*"?"*/
+	{296, 7, 11, 0, 3, 8}, /*"@"*/
+	{307, 8, 11, 0, 3, 9}, /*"A"*/
+	{318, 7, 11, 0, 3, 8}, /*"B"*/
+	{329, 7, 11, 0, 3, 8}, /*"C"*/
+	{340, 7, 11, 0, 3, 8}, /*"D"*/
+	{351, 7, 11, 0, 3, 8}, /*"E"*/
+	{362, 7, 11, 0, 3, 8}, /*"F"*/
+	{373, 7, 11, 0, 3, 8}, /*"G"*/
+	{384, 8, 11, 0, 3, 9}, /*"H"*/
+	{395, 5, 11, 0, 3, 6}, /*"I"*/
+	{406, 7, 13, 0, 3, 8}, /*"J"*/
+	{419, 7, 11, 0, 3, 8}, /*"K"*/
+	{430, 7, 11, 0, 3, 8}, /*"L"*/
+	{441, 7, 11, 0, 3, 8}, /*"M"*/
+	{452, 8, 11, 0, 3, 9}, /*"N"*/
+	{463, 7, 11, 0, 3, 8}, /*"O"*/
+	{474, 7, 11, 0, 3, 8}, /*"P"*/
+	{485, 7, 12, 0, 3, 8}, /*"Q"*/
+	{497, 8, 11, 0, 3, 9}, /*"R"*/
+	{508, 6, 11, 0, 3, 7}, /*"S"*/
+	{519, 7, 11, 0, 3, 8}, /*"T"*/
+	{530, 8, 11, 0, 3, 9}, /*"U"*/
+	{541, 8, 11, 0, 3, 9}, /*"V"*/
+	{552, 7, 11, 0, 3, 8}, /*"W"*/
+	{563, 8, 11, 0, 3, 9}, /*"X"*/
+	{574, 7, 11, 0, 3, 8}, /*"Y"*/
+	{585, 7, 11, 0, 3, 8}, /*"Z"*/
+	{596, 4, 14, 0, 1, 5}, /*"["*/
+	{610, 6, 14, 0, 2, 7}, /*"\\"*/
+	{624, 4, 14, 0, 1, 5}, /*"]"*/
+	{638, 5, 2, 0, 1, 6}, /*"^"*/
+	{640, 8, 1, 0, 15, 9}, /*"_"*/
+	{641, 3, 2, 0, 1, 4}, /*"`"*/
+	{643, 7, 7, 0, 7, 8}, /*"a"*/
+	{650, 7, 11, 0, 3, 8}, /*"b"*/
+	{661, 6, 7, 0, 7, 7}, /*"c"*/
+	{668, 7, 11, 0, 3, 8}, /*"d"*/
+	{679, 6, 7, 0, 7, 7}, /*"e"*/
+	{686, 7, 11, 0, 3, 8}, /*"f"*/
+	{697, 6, 9, 0, 7, 7}, /*"g"*/
+	{706, 8, 11, 0, 3, 9}, /*"h"*/
+	{717, 5, 11, 0, 3, 6}, /*"i"*/
+	{728, 5, 13, 0, 3, 6}, /*"j"*/
+	{741, 7, 11, 0, 3, 8}, /*"k"*/
+	{752, 5, 11, 0, 3, 6}, /*"l"*/
+	{763, 8, 7, 0, 7, 9}, /*"m"*/
+	{770, 8, 7, 0, 7, 9}, /*"n"*/
+	{777, 6, 7, 0, 7, 7}, /*"o"*/
+	{784, 7, 9, 0, 7, 8}, /*"p"*/
+	{793, 7, 9, 0, 7, 8}, /*"q"*/
+	{802, 7, 7, 0, 7, 8}, /*"r"*/
+	{809, 6, 7, 0, 7, 7}, /*"s"*/
+	{816, 5, 9, 0, 5, 6}, /*"t"*/
+	{825, 8, 7, 0, 7, 9}, /*"u"*/
+	{832, 8, 7, 0, 7, 9}, /*"v"*/
+	{839, 8, 7, 0, 7, 9}, /*"w"*/
+	{846, 6, 7, 0, 7, 7}, /*"x"*/
+	{853, 8, 9, 0, 7, 9}, /*"y"*/
+	{862, 6, 7, 0, 7, 7}, /*"z"*/
+	{869, 4, 14, 0, 1, 5}, /*"{"*/
+	{883, 1, 16, 0, 0, 2}, /*"|"*/
+	{899, 4, 14, 0, 1, 5}, /*"}"*/
+	{913, 7, 3, 0, 0, 8}, /*"~"*/
+};
+
+const unsigned char ascii_p24[]={ // 24ظ߱,ascii_2412
+0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x40,0x80,0x80,0x80,0x00,0x00,0x00,0xC0,0xC0,0xC0,/*"!"*/
+0x19,0x80,0x19,0x80,0x33,0x00,0x66,0x00,0x44,0x00,0x88,0x00,/*"""*/
+0x10,0x80,0x10,0x80,0x10,0x80,0x10,0x80,0xFF,0xC0,0xFF,0xC0,0x20,0x80,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0xFF,0xC0,0xFF,0xC0,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,/*"#"*/
+0x08,0x08,0x3E,0x6B,0xCB,0xCF,0xC8,0x68,0x38,0x1C,0x0E,0x0E,0x0B,0xCB,0xEB,0xCB,0x4A,0x3C,0x08,0x08,/*"$"*/
+0x70,0x80,0x50,0x80,0x89,0x00,0x89,0x00,0x89,0x00,0x8A,0x00,0x8A,0x00,0x5C,0x00,0x75,0xC0,0x05,0x40,0x0A,0x20,0x0A,0x20,0x12,0x20,0x12,0x20,0x12,0x20,0x21,0x40,0x21,0xC0,/*"%"*/
+0x1C,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x36,0x00,0x34,0x00,0x19,0xE0,0x38,0x80,0x58,0x80,0xCC,0x80,0xCC,0x80,0xC6,0x80,0xC7,0x00,0xC3,0x10,0x63,0x90,0x3C,0xE0,/*"&"*/
+0xC0,0xE0,0x20,0x20,0x40,0x80,/*"'"*/
+0x04,0x08,0x10,0x20,0x20,0x40,0x40,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x40,0x40,0x20,0x20,0x10,0x08,0x04,/*"("*/
+0x80,0x40,0x20,0x10,0x10,0x08,0x08,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x08,0x08,0x10,0x10,0x20,0x40,0x80,/*")"*/
+0x04,0x00,0x06,0x00,0x04,0x00,0xC4,0x60,0xE5,0xE0,0x17,0x00,0x1F,0x00,0xF5,0xE0,0xC4,0x60,0x04,0x00,0x04,0x00,0x04,0x00,/*"*"*/
+0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0xFF,0xE0,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,/*"+"*/
+0xC0,0xE0,0x20,0x20,0x40,0x80,/*","*/
+0xFF,0xC0,/*"-"*/
+0xE0,0xE0,0xE0,/*"."*/
+0x00,0x40,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x0C,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x00,/*"/"*/
+0x1E,0x00,0x33,0x00,0x61,0x80,0x61,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x61,0x80,0x61,0x80,0x33,0x00,0x1E,0x00,/*"0"*/
+0x08,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,/*"1"*/
+0x3E,0x00,0x43,0x00,0x81,0x80,0xC1,0x80,0xC1,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x08,0x00,0x10,0x00,0x20,0x80,0x40,0x80,0xC0,0x80,0xFF,0x80,/*"2"*/
+0x3C,0x00,0xC6,0x00,0xC3,0x00,0xC3,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x1C,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0xC1,0x80,0xC1,0x80,0xC3,0x00,0x3E,0x00,/*"3"*/
+0x03,0x00,0x03,0x00,0x07,0x00,0x0B,0x00,0x0B,0x00,0x13,0x00,0x23,0x00,0x23,0x00,0x43,0x00,0x83,0x00,0xFF,0xE0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,/*"4"*/
+0x7F,0x80,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x5E,0x00,0x63,0x00,0x41,0x80,0x01,0x80,0x01,0x80,0xC1,0x80,0xC1,0x80,0x83,0x00,0x43,0x00,0x3E,0x00,/*"5"*/
+0x0F,0x00,0x31,0x80,0x61,0x80,0x60,0x00,0x40,0x00,0xC0,0x00,0xCF,0x00,0xD1,0x80,0xE0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x40,0xC0,0x60,0x80,0x31,0x80,0x1E,0x00,/*"6"*/
+0x7F,0x80,0xC1,0x80,0x81,0x00,0x82,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,/*"7"*/
+0x3F,0x00,0x61,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x60,0x80,0x71,0x80,0x1E,0x00,0x27,0x00,0x61,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x61,0x80,0x1F,0x00,/*"8"*/
+0x1E,0x00,0x61,0x00,0x61,0x80,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC1,0xC0,0x62,0xC0,0x3C,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x61,0x00,0x63,0x00,0x3C,0x00,/*"9"*/
+0xE0,0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0xE0,0xE0,/*":"*/
+0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x40,0x80,0x80,/*";"*/
+0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,/*"<"*/
+0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,/*"="*/
+0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,/*">"*/
+0x1F,0x00,0x61,0x80,0x80,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0x03,0x80,0x06,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x1C,0x00,0x1C,0x00,/*"?"*/
+0x0E,0x00,0x31,0x80,0x60,0x80,0x67,0x40,0x4D,0x40,0xCD,0x40,0xCB,0x40,0xDA,0x40,0xDA,0x40,0xDA,0x40,0xDA,0x40,0xDA,0x80,0x4F,0x00,0x60,0x40,0x60,0x80,0x31,0x80,0x1E,0x00,/*"@"*/
+0x06,0x00,0x06,0x00,0x0A,0x00,0x0B,0x00,0x09,0x00,0x09,0x00,0x11,0x00,0x11,0x80,0x10,0x80,0x1F,0x80,0x20,0xC0,0x20,0xC0,0x20,0x40,0x40,0x40,0x40,0x60,0xF0,0xF0,/*"A"*/
+0xFE,0x00,0x63,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x63,0x00,0x7E,0x00,0x61,0x80,0x60,0x80,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x61,0x80,0xFF,0x00,/*"B"*/
+0x0F,0x80,0x31,0x80,0x60,0xC0,0x60,0x40,0x40,0x40,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x40,0x60,0x40,0x60,0x80,0x31,0x80,0x1E,0x00,/*"C"*/
+0xFE,0x00,0x31,0x80,0x30,0xC0,0x30,0xC0,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0xC0,0x30,0xC0,0x31,0x80,0xFE,0x00,/*"D"*/
+0xFF,0xC0,0x60,0xC0,0x60,0x20,0x60,0x20,0x60,0x00,0x61,0x00,0x61,0x00,0x7F,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x20,0x60,0x20,0x60,0x40,0xFF,0xC0,/*"E"*/
+0xFF,0xC0,0x60,0xC0,0x60,0x20,0x60,0x20,0x60,0x00,0x61,0x00,0x61,0x00,0x7F,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xF8,0x00,/*"F"*/
+0x1E,0x00,0x31,0x00,0x60,0x80,0x60,0x80,0x40,0x80,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC7,0xE0,0xC1,0x80,0xC1,0x80,0x61,0x80,0x61,0x80,0x31,0x80,0x1E,0x00,/*"G"*/
+0xF0,0xF0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x7F,0xE0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xF0,0xF0,/*"H"*/
+0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,/*"I"*/
+0x3F,0xC0,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0xC6,0x00,0xCC,0x00,0x78,0x00,/*"J"*/
+0xF3,0xC0,0x61,0x80,0x63,0x00,0x62,0x00,0x64,0x00,0x68,0x00,0x6C,0x00,0x74,0x00,0x76,0x00,0x62,0x00,0x63,0x00,0x61,0x00,0x61,0x80,0x60,0x80,0x60,0xC0,0xF1,0xE0,/*"K"*/
+0xF8,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x20,0x60,0x20,0x60,0x40,0xFF,0xC0,/*"L"*/
+0xE0,0xE0,0x61,0xC0,0x61,0xC0,0x71,0xC0,0x71,0xC0,0x72,0xC0,0x72,0xC0,0x52,0xC0,0x5A,0xC0,0x5A,0xC0,0x5C,0xC0,0x4C,0xC0,0x4C,0xC0,0x4C,0xC0,0x48,0xC0,0xE1,0xE0,/*"M"*/
+0x71,0xF0,0x30,0x40,0x38,0x40,0x38,0x40,0x2C,0x40,0x2C,0x40,0x26,0x40,0x26,0x40,0x22,0x40,0x23,0x40,0x21,0x40,0x21,0xC0,0x21,0xC0,0x20,0xC0,0x20,0xC0,0xF8,0x40,/*"N"*/
+0x1E,0x00,0x33,0x00,0x61,0x80,0x60,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x60,0x80,0x61,0x80,0x33,0x00,0x1E,0x00,/*"O"*/
+0xFF,0x00,0x60,0xC0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x61,0xC0,0x7F,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xF8,0x00,/*"P"*/
+0x1E,0x00,0x33,0x00,0x61,0x80,0x60,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xDC,0xC0,0x64,0x80,0x67,0x80,0x33,0x00,0x1E,0x00,0x03,0xC0,0x01,0x80,/*"Q"*/
+0xFF,0x80,0x60,0xC0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xC0,0x7F,0x00,0x62,0x00,0x63,0x00,0x61,0x00,0x61,0x80,0x60,0xC0,0x60,0xC0,0x60,0x60,0xF0,0x70,/*"R"*/
+0x3E,0x80,0x61,0x80,0xC0,0x80,0xC0,0x80,0xC0,0x00,0xE0,0x00,0x78,0x00,0x3E,0x00,0x0F,0x80,0x03,0x80,0x01,0xC0,0x80,0xC0,0x80,0xC0,0xC0,0xC0,0x61,0x80,0x1F,0x00,/*"S"*/
+0x7F,0xE0,0x46,0x20,0x86,0x10,0x86,0x10,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x80,/*"T"*/
+0xF1,0xC0,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x60,0x80,0x31,0x00,0x1E,0x00,/*"U"*/
+0xF0,0xE0,0x60,0x40,0x20,0x80,0x20,0x80,0x30,0x80,0x30,0x80,0x11,0x00,0x11,0x00,0x19,0x00,0x19,0x00,0x0A,0x00,0x0A,0x00,0x0E,0x00,0x0C,0x00,0x04,0x00,0x04,0x00,/*"V"*/
+0xEF,0x70,0x46,0x20,0x42,0x20,0x62,0x20,0x62,0x20,0x26,0x40,0x26,0x40,0x27,0x40,0x27,0x40,0x39,0x40,0x39,0x80,0x19,0x80,0x19,0x80,0x11,0x80,0x11,0x00,0x11,0x00,/*"W"*/
+0xF3,0xC0,0x61,0x00,0x21,0x00,0x31,0x00,0x12,0x00,0x1A,0x00,0x0C,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x16,0x00,0x12,0x00,0x23,0x00,0x21,0x00,0x41,0x80,0xE3,0xC0,/*"X"*/
+0xF0,0xF0,0x60,0x20,0x20,0x40,0x30,0x40,0x10,0x80,0x18,0x80,0x1D,0x00,0x0D,0x00,0x0E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x80,/*"Y"*/
+0x7F,0xC0,0x60,0x80,0xC1,0x80,0x81,0x00,0x03,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x30,0x00,0x20,0x40,0x60,0x40,0x40,0x80,0xFF,0x80,/*"Z"*/
+0xF8,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xF8,/*"["*/
+0x80,0x00,0x80,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x04,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x80,/*"\\"*/
+0xF8,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0xF8,/*"]"*/
+0x30,0x48,0x84,/*"^"*/
+0xFF,0xF0,/*"_"*/
+0xC0,0x30,/*"`"*/
+0x1F,0x00,0x61,0x80,0x61,0x80,0x01,0x80,0x0F,0x80,0x71,0x80,0xE1,0x80,0xC1,0x80,0xC1,0x80,0xE3,0xA0,0x7C,0xE0,/*"a"*/
+0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x67,0x00,0x79,0x80,0x70,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0x80,0x71,0x80,0x4F,0x00,/*"b"*/
+0x1E,0x00,0x63,0x00,0x63,0x00,0xC3,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x80,0x60,0x80,0x61,0x00,0x1E,0x00,/*"c"*/
+0x00,0x80,0x07,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3D,0x80,0x63,0x80,0x61,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0x41,0x80,0x63,0xC0,0x3D,0x00,/*"d"*/
+0x1E,0x00,0x63,0x00,0x41,0x00,0xC1,0x80,0xC1,0x80,0xFF,0x80,0xC0,0x00,0xC0,0x00,0x60,0x80,0x61,0x00,0x1E,0x00,/*"e"*/
+0x07,0x80,0x0C,0xC0,0x18,0xC0,0x18,0x00,0x18,0x00,0xFF,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7F,0x00,/*"f"*/
+0x1F,0xC0,0x36,0xC0,0x63,0x00,0x63,0x00,0x63,0x00,0x33,0x00,0x3E,0x00,0x60,0x00,0x7E,0x00,0x67,0x80,0xC1,0x80,0xC1,0x80,0xE3,0x80,0x3E,0x00,/*"g"*/
+0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x6F,0x00,0x71,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0xF3,0xC0,/*"h"*/
+0x18,0x18,0x00,0x00,0x08,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,/*"i"*/
+0x0E,0x0E,0x00,0x00,0x02,0x3E,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0xCC,0xF8,/*"j"*/
+0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x63,0x80,0x62,0x00,0x62,0x00,0x64,0x00,0x6C,0x00,0x74,0x00,0x62,0x00,0x63,0x00,0x61,0x00,0x61,0x80,0xF3,0xC0,/*"k"*/
+0x08,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,/*"l"*/
+0xEC,0xE0,0x77,0x60,0x66,0x60,0x66,0x60,0x66,0x60,0x66,0x60,0x66,0x60,0x66,0x60,0x66,0x60,0x66,0x60,0xFF,0xF0,/*"m"*/
+0xEF,0x00,0x71,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0xF3,0xC0,/*"n"*/
+0x1E,0x00,0x33,0x00,0x61,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x61,0x80,0x61,0x80,0x1E,0x00,/*"o"*/
+0xEF,0x00,0x71,0x80,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x61,0x80,0x71,0x80,0x6F,0x00,0x60,0x00,0x60,0x00,0xF8,0x00,/*"p"*/
+0x3C,0x80,0x63,0x80,0x61,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0x41,0x80,0x63,0x80,0x3D,0x80,0x01,0x80,0x01,0x80,0x07,0xC0,/*"q"*/
+0xF9,0xC0,0x1A,0x60,0x1C,0x60,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0xFF,0x00,/*"r"*/
+0x3F,0xE3,0xC1,0xC1,0x70,0x3C,0x0F,0x83,0x83,0xC7,0xFE,/*"s"*/
+0x08,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0xFF,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x80,0x18,0x80,0x0F,0x00,/*"t"*/
+0x20,0x80,0xE3,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x73,0xC0,0x3D,0x00,/*"u"*/
+0xF1,0xC0,0x60,0x80,0x21,0x00,0x21,0x00,0x31,0x00,0x12,0x00,0x1A,0x00,0x1A,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,/*"v"*/
+0xEF,0x70,0x46,0x20,0x62,0x20,0x26,0x40,0x26,0x40,0x37,0x40,0x39,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x10,0x00,/*"w"*/
+0x7B,0xC0,0x31,0x00,0x11,0x00,0x1A,0x00,0x0C,0x00,0x0C,0x00,0x0E,0x00,0x12,0x00,0x21,0x00,0x21,0x80,0xF3,0xC0,/*"x"*/
+0xF3,0xC0,0x21,0x00,0x21,0x00,0x21,0x00,0x12,0x00,0x12,0x00,0x1A,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x08,0x00,0x48,0x00,0x70,0x00,/*"y"*/
+0xFE,0x86,0x8C,0x88,0x18,0x10,0x30,0x61,0x41,0xC3,0xFE,/*"z"*/
+0x18,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x40,0x80,0x40,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x18,/*"{"*/
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,/*"|"*/
+0xC0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x08,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xC0,/*"}"*/
+0x70,0x00,0x88,0x40,0x86,0x40,0x03,0x80,/*"~"*/
+};
+
+const LCD_Glyph ascii_p24_glyphs[95]={ // offset,width,height,x_off,y_off,advance
+	{0, 0, 0, 0, 0, 6}, /*" "*/
+	{0, 2, 17, 0, 4, 3}, /*"!"*/
+	{17, 9, 6, 0, 2, 10}, /*"""*/
+	{29, 10, 17, 0, 4, 11}, /*"#"*/
+	{63, 8, 20, 0, 3, 9}, /*"$"*/
+	{83, 11, 17, 0, 4, 12}, /*"%"*/
+	{117, 12, 17, 0, 4, 13}, /*"&"*/
+	{151, 3, 6, 0, 2, 4}, /*"'"*/
+	{157, 6, 21, 0, 2, 7}, /*"("*/
+	{178, 6, 21, 0, 2, 7}, /*")"*/
+	{199, 11, 12, 0, 6, 12}, /*"*"*/
+	{223, 11, 11, 0, 7, 12}, /*"+"*/
+	{245, 3, 6, 0, 18, 4}, /*","*/
+	{251, 10, 1, 0, 12, 11}, /*"-"*/
+	{253, 3, 3, 0, 18, 4}, /*"."*/
+	{256, 10, 21, 0, 2, 11}, /*"/"*/
+	{298, 10, 16, 0, 5, 11}, /*"0"*/
+	{330, 8, 16, 0, 5, 9}, /*"1"*/
+	{346, 9, 16, 0, 5, 10}, /*"2"*/
+	{378, 9, 16, 0, 5, 10}, /*"3"*/
+	{410, 11, 16, 0, 5, 12}, /*"4"*/
+	{442, 9, 16, 0, 5, 10}, /*"5"*/
+	{474, 10, 16, 0, 5, 11}, /*"6"*/
+	{506, 9, 16, 0, 5, 10}, /*"7"*/
+	{538, 10, 16, 0, 5, 11}, /*"8"*/
+	{570, 10, 16, 0, 5, 11}, /*"9"*/
+	{602, 3, 11, 0, 10, 4}, /*":"*/
+	{613, 2, 14, 0, 10, 3}, /*";"*/
+	{627, 9, 17, 0, 4, 10}, /*"<"*/
+	{661, 10, 5, 0, 10, 11}, /*"="*/
+	{671, 9, 17, 0, 4, 10}, /*">"*/
+	{705, 10, 16, 0, 5, 11}, /*"?"*/
+	{737, 10, 17, 0, 4, 11}, /*"@"*/
+	{771, 12, 16, 0, 5, 13}, /*"A"*/
+	{803, 10, 16, 0, 5, 11}, /*"B"*/
+	{835, 10, 16, 0, 5, 11}, /*"C"*/
+	{867, 11, 16, 0, 5, 12}, /*"D"*/
+	{899, 11, 16, 0, 5, 12}, /*"E"*/
+	{931, 11, 16, 0, 5, 12}, /*"F"*/
+	{963, 11, 16, 0, 5, 12}, /*"G"*/
+	{995, 12, 16, 0, 5, 13}, /*"H"*/
+	{1027, 8, 16, 0, 5, 9}, /*"I"*/
+	{1043, 10, 19, 0, 5, 11}, /*"J"*/
+	{1081, 11, 16, 0, 5, 12}, /*"K"*/
+	{1113, 11, 16, 0, 5, 12}, /*"L"*/
+	{1145, 11, 16, 0, 5, 12}, /*"M"*/
+	{1177, 12, 16, 0, 5, 13}, /*"N"*/
+	{1209, 10, 16, 0, 5, 11}, /*"O"*/
+	{1241, 11, 16, 0, 5, 12}, /*"P"*/
+	{1273, 10, 18, 0, 5, 11}, /*"Q"*/
+	{1309, 12, 16, 0, 5, 13}, /*"R"*/
+	{1341, 10, 16, 0, 5, 11}, /*"S"*/
+	{1373, 12, 16, 0, 5, 13}, /*"T"*/
+	{1405, 10, 16, 0, 5, 11}, /*"U"*/
+	{1437, 11, 16, 0, 5, 12}, /*"V"*/
+	{1469, 12, 16, 0, 5, 13}, /*"W"*/
+	{1501, 10, 16, 0, 5, 11}, /*"X"*/
+	{1533, 12, 16, 0, 5, 13}, /*"Y"*/
+	{1565, 10, 16, 0, 5, 11}, /*"Z"*/
+	{1597, 5, 21, 0, 2, 6}, /*"["*/
+	{1618, 9, 20, 0, 4, 10}, /*"\\"*/
+	{1658, 5, 21, 0, 2, 6}, /*"]"*/
+	{1679, 6, 3, 0, 1, 7}, /*"^"*/
+	{1682, 12, 1, 0, 23, 13}, /*"_"*/
+	{1684, 4, 2, 0, 2, 5}, /*"`"*/
+	{1686, 11, 11, 0, 10, 12}, /*"a"*/
+	{1708, 10, 17, 0, 4, 11}, /*"b"*/
+	{1742, 9, 11, 0, 10, 10}, /*"c"*/
+	{1764, 10, 17, 0, 4, 11}, /*"d"*/
+	{1798, 9, 11, 0, 10, 10}, /*"e"*/
+	{1820, 10, 16, 0, 5, 11}, /*"f"*/
+	{1852, 10, 14, 0, 10, 11}, /*"g"*/
+	{1880, 10, 17, 0, 4, 11}, /*"h"*/
+	{1914, 8, 16, 0, 5, 9}, /*"i"*/
+	{1930, 7, 19, 0, 5, 8}, /*"j"*/
+	{1949, 10, 17, 0, 4, 11}, /*"k"*/
+	{1983, 8, 17, 0, 4, 9}, /*"l"*/
+	{2000, 12, 11, 0, 10, 13}, /*"m"*/
+	{2022, 10, 11, 0, 10, 11}, /*"n"*/
+	{2044, 10, 11, 0, 10, 11}, /*"o"*/
+	{2066, 10, 14, 0, 10, 11}, /*"p"*/
+	{2094, 10, 14, 0, 10, 11}, /*"q"*/
+	{2122, 11, 11, 0, 10, 12}, /*"r"*/
+	{2144, 8, 11, 0, 10, 9}, /*"s"*/
+	{2155, 9, 15, 0, 6, 10}, /*"t"*/
+	{2185, 10, 12, 0, 9, 11}, /*"u"*/
+	{2209, 10, 11, 0, 10, 11}, /*"v"*/
+	{2231, 12, 11, 0, 10, 13}, /*"w"*/
+	{2253, 10, 11, 0, 10, 11}, /*"x"*/
+	{2275, 10, 14, 0, 10, 11}, /*"y"*/
+	{2303, 8, 11, 0, 10, 9}, /*"z"*/
+	{2314, 5, 21, 0, 2, 6}, /*"{"*/
+	{2335, 1, 24, 0, 0, 2}, /*"|"*/
+	{2359, 5, 21, 0, 2, 6}, /*"}"*/
+	{2380, 10, 4, 0, 1, 11}, /*"~"*/
+};
+
+const unsigned char ascii_p32[]={ // 32ظ߱,ascii_3216
+0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x60,0xF0,0xF0,0x60,/*"!"*/
+0x1C,0xE0,0x1C,0xE0,0x3D,0xE0,0x39,0xC0,0x73,0x80,0x63,0x00,0x42,0x00,0x84,0x00,/*"""*/
+0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0x08,0x10,0xFF,0xFC,0xFF,0xFC,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0xFF,0xFC,0xFF,0xFC,0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x40,/*"#"*/
+0x02,0x00,0x02,0x00,0x0F,0x80,0x1A,0x60,0x22,0x30,0x62,0x30,0x62,0x70,0x62,0x70,0x72,0x00,0x3A,0x00,0x1E,0x00,0x0F,0x00,0x07,0x80,0x03,0xC0,0x02,0xE0,0x02,0x70,0x02,0x30,0xE2,0x30,0xE2,0x30,0xC2,0x30,0xC2,0x20,0x62,0xC0,0x1F,0x80,0x02,0x00,0x02,0x00,0x02,0x00,/*"$"*/
+0x38,0x08,0x6C,0x18,0xC6,0x10,0xC6,0x30,0xC6,0x20,0xC6,0x20,0xC6,0x40,0xC6,0x40,0xC6,0x80,0x6C,0xB8,0x39,0xEC,0x01,0x44,0x01,0xC6,0x02,0xC6,0x02,0xC6,0x04,0xC6,0x04,0xC6,0x0C,0xC6,0x08,0x44,0x18,0x6C,0x10,0x38,/*"%"*/
+0x0F,0x00,0x19,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x80,0x31,0x00,0x33,0x00,0x1E,0x00,0x18,0x7C,0x38,0x10,0x6C,0x10,0x4C,0x10,0xC6,0x20,0xC6,0x20,0xC3,0x20,0xC3,0xC0,0xC1,0xC2,0x60,0xC2,0x71,0x64,0x1E,0x38,/*"&"*/
+0x70,0x78,0x78,0x18,0x18,0x10,0x60,0xC0,/*"'"*/
+0x01,0x02,0x04,0x08,0x18,0x10,0x30,0x60,0x60,0x60,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x60,0x60,0x60,0x30,0x30,0x18,0x08,0x04,0x02,0x01,/*"("*/
+0x80,0x40,0x20,0x10,0x18,0x08,0x0C,0x06,0x06,0x06,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x06,0x06,0x06,0x0C,0x0C,0x18,0x10,0x20,0x40,0x80,/*")"*/
+0x02,0x00,0x07,0x00,0x07,0x00,0x02,0x00,0xE2,0x38,0xF2,0x78,0x7A,0xF0,0x0F,0x80,0x02,0x00,0x0F,0x80,0x7A,0xF0,0xF2,0x78,0xE2,0x38,0x02,0x00,0x07,0x00,0x07,0x00,0x06,0x00,/*"*"*/
+0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xFF,0xF8,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,/*"+"*/
+0x70,0x78,0x78,0x18,0x18,0x10,0x60,0xC0,/*","*/
+0xFF,0xFC,/*"-"*/
+0x60,0xF0,0xF0,0x60,/*"."*/
+0x00,0x04,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x00,/*"/"*/
+0x0F,0x80,0x18,0xC0,0x30,0x60,0x60,0x30,0x60,0x30,0x60,0x10,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0x60,0x10,0x60,0x30,0x60,0x30,0x30,0x60,0x18,0xC0,0x0F,0x80,/*"0"*/
+0x04,0x00,0x0C,0x00,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x1E,0x00,0xFF,0xC0,/*"1"*/
+0x1F,0x80,0x20,0xE0,0x40,0x60,0x80,0x30,0x80,0x30,0xC0,0x30,0xC0,0x30,0x00,0x30,0x00,0x60,0x00,0x40,0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x10,0x20,0x10,0x40,0x10,0x80,0x30,0xFF,0xE0,0xFF,0xE0,/*"2"*/
+0x1F,0x00,0x61,0xC0,0xC0,0xC0,0xC0,0x60,0xC0,0x60,0xC0,0x60,0x00,0x60,0x00,0xC0,0x01,0x80,0x0F,0x00,0x01,0xC0,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x20,0xC0,0x60,0x60,0xC0,0x1F,0x00,/*"3"*/
+0x00,0x60,0x00,0xE0,0x00,0xE0,0x01,0xE0,0x02,0xE0,0x02,0xE0,0x04,0xE0,0x0C,0xE0,0x08,0xE0,0x10,0xE0,0x10,0xE0,0x20,0xE0,0x40,0xE0,0x40,0xE0,0xFF,0xFC,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x07,0xFC,/*"4"*/
+0x3F,0xF0,0x3F,0xF0,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x4F,0x80,0x50,0xC0,0x60,0x60,0x40,0x20,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0xC0,0x30,0xC0,0x30,0x80,0x60,0x80,0x60,0x40,0xC0,0x3F,0x00,/*"5"*/
+0x07,0xC0,0x0C,0x20,0x10,0x30,0x20,0x30,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC7,0xC0,0xD8,0x60,0xF0,0x30,0xE0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0x60,0x18,0x60,0x10,0x30,0x30,0x18,0x60,0x0F,0x80,/*"6"*/
+0x7F,0xF0,0x7F,0xF0,0xE0,0x20,0xC0,0x40,0x80,0x40,0x80,0x80,0x00,0x80,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,/*"7"*/
+0x0F,0xC0,0x18,0x60,0x30,0x30,0x60,0x18,0x60,0x18,0x60,0x18,0x70,0x18,0x38,0x30,0x1C,0x20,0x0F,0xC0,0x1B,0xC0,0x30,0xE0,0x60,0x70,0xC0,0x38,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0x60,0x30,0x30,0x60,0x0F,0x80,/*"8"*/
+0x0F,0x80,0x30,0x40,0x60,0x20,0x60,0x30,0xC0,0x10,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x38,0x60,0x78,0x30,0xD8,0x1F,0x18,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x60,0x60,0x60,0xC0,0x61,0x80,0x1F,0x00,/*"9"*/
+0x60,0xF0,0xF0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xF0,0xF0,0x60,/*":"*/
+0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x40,0x40,0x80,0x80,/*";"*/
+0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,/*"<"*/
+0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFC,/*"="*/
+0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,/*">"*/
+0x0F,0x80,0x30,0x60,0x40,0x30,0x40,0x18,0xC0,0x18,0xE0,0x18,0xE0,0x18,0xE0,0x18,0x00,0x30,0x00,0xE0,0x01,0x80,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0F,0x00,0x0F,0x00,0x06,0x00,/*"?"*/
+0x07,0xC0,0x0C,0x30,0x10,0x18,0x30,0x08,0x61,0xE8,0x63,0x64,0xC2,0x64,0xC6,0x64,0xC6,0x64,0xCC,0x64,0xCC,0x44,0xCC,0x44,0xCC,0xC8,0xCC,0xC8,0xCD,0x50,0x66,0x70,0x60,0x04,0x20,0x08,0x30,0x18,0x18,0x30,0x07,0xC0,/*"@"*/
+0x00,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x02,0x80,0x06,0xC0,0x04,0xC0,0x04,0xC0,0x04,0xC0,0x0C,0x60,0x08,0x60,0x08,0x60,0x08,0x60,0x1F,0xF0,0x10,0x30,0x10,0x30,0x10,0x30,0x30,0x30,0x20,0x18,0x20,0x18,0x60,0x18,0xF8,0x3E,/*"A"*/
+0xFF,0xC0,0x30,0x70,0x30,0x38,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x30,0x30,0x60,0x3F,0xC0,0x30,0x30,0x30,0x18,0x30,0x08,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x30,0x30,0xFF,0xE0,/*"B"*/
+0x07,0xC8,0x0C,0x38,0x10,0x18,0x30,0x08,0x60,0x04,0x60,0x04,0x40,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x04,0x60,0x04,0x60,0x08,0x30,0x18,0x18,0x30,0x07,0xC0,/*"C"*/
+0xFF,0x80,0x30,0xE0,0x30,0x30,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x30,0x18,0x30,0x10,0x30,0x30,0x30,0xE0,0xFF,0x80,/*"D"*/
+0xFF,0xF8,0x30,0x18,0x30,0x08,0x30,0x0C,0x30,0x04,0x30,0x00,0x30,0x20,0x30,0x20,0x30,0x60,0x3F,0xE0,0x30,0x60,0x30,0x20,0x30,0x20,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x04,0x30,0x04,0x30,0x08,0x30,0x18,0xFF,0xF8,/*"E"*/
+0xFF,0xFC,0x30,0x1C,0x30,0x04,0x30,0x06,0x30,0x02,0x30,0x00,0x30,0x10,0x30,0x10,0x30,0x30,0x3F,0xF0,0x30,0x30,0x30,0x10,0x30,0x10,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00,/*"F"*/
+0x07,0x90,0x1C,0x70,0x10,0x10,0x30,0x10,0x60,0x08,0x60,0x08,0x40,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x7E,0xC0,0x18,0xC0,0x18,0x60,0x18,0x60,0x18,0x30,0x18,0x30,0x18,0x18,0x20,0x07,0xC0,/*"G"*/
+0xFC,0x7E,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x3F,0xF8,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0xFC,0x7E,/*"H"*/
+0xFF,0xC0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xFF,0xC0,/*"I"*/
+0x0F,0xFC,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0xE0,0xC0,0xE1,0x80,0xE3,0x00,0x7E,0x00,/*"J"*/
+0xFC,0x7C,0x30,0x30,0x30,0x20,0x30,0x40,0x30,0xC0,0x30,0x80,0x31,0x00,0x33,0x00,0x33,0x00,0x37,0x00,0x3B,0x80,0x39,0x80,0x31,0xC0,0x30,0xC0,0x30,0xE0,0x30,0x60,0x30,0x70,0x30,0x30,0x30,0x18,0x30,0x18,0xFC,0x7E,/*"K"*/
+0xFC,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x04,0x30,0x04,0x30,0x08,0x30,0x18,0xFF,0xF8,/*"L"*/
+0xF8,0x1F,0x38,0x1C,0x38,0x1C,0x38,0x1C,0x38,0x3C,0x2C,0x2C,0x2C,0x2C,0x2C,0x2C,0x2C,0x6C,0x2E,0x4C,0x26,0x4C,0x26,0x4C,0x26,0x4C,0x26,0x8C,0x23,0x8C,0x23,0x8C,0x23,0x8C,0x23,0x0C,0x23,0x0C,0x21,0x0C,0xF9,0x3F,/*"M"*/
+0xF8,0x3E,0x38,0x08,0x3C,0x08,0x2C,0x08,0x2C,0x08,0x2E,0x08,0x26,0x08,0x27,0x08,0x23,0x08,0x23,0x88,0x21,0x88,0x21,0xC8,0x20,0xC8,0x20,0xE8,0x20,0x68,0x20,0x78,0x20,0x38,0x20,0x38,0x20,0x38,0x20,0x18,0xF8,0x18,/*"N"*/
+0x07,0x80,0x18,0x60,0x30,0x30,0x20,0x10,0x60,0x18,0x60,0x18,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0x60,0x08,0x60,0x18,0x20,0x10,0x30,0x30,0x18,0x60,0x07,0x80,/*"O"*/
+0xFF,0xE0,0x30,0x30,0x30,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x30,0x30,0x3F,0xE0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00,/*"P"*/
+0x07,0x80,0x18,0x60,0x30,0x30,0x60,0x10,0x60,0x18,0x60,0x08,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0x4F,0x0C,0x69,0x98,0x70,0x98,0x30,0xD0,0x18,0xE0,0x07,0xC0,0x00,0x64,0x00,0x7C,0x00,0x38,/*"Q"*/
+0xFF,0xC0,0x30,0x70,0x30,0x38,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x30,0x30,0x60,0x3F,0xC0,0x33,0x80,0x31,0x80,0x31,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xE0,0x30,0x60,0x30,0x60,0x30,0x70,0x30,0x30,0xFC,0x3C,/*"R"*/
+0x1F,0x90,0x30,0x70,0x60,0x30,0xC0,0x10,0xC0,0x10,0xC0,0x00,0xC0,0x00,0x60,0x00,0x78,0x00,0x1F,0x00,0x07,0xC0,0x01,0xE0,0x00,0x70,0x00,0x38,0x00,0x18,0x80,0x18,0x80,0x18,0x40,0x18,0x60,0x30,0x70,0x60,0x4F,0xC0,/*"S"*/
+0x7F,0xF8,0x63,0x08,0x43,0x0C,0x83,0x04,0x83,0x04,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,/*"T"*/
+0xFC,0x3E,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x10,0x10,0x1C,0x20,0x07,0xC0,/*"U"*/
+0xF8,0x3E,0x30,0x08,0x30,0x08,0x30,0x08,0x18,0x10,0x18,0x10,0x18,0x10,0x18,0x10,0x0C,0x20,0x0C,0x20,0x0C,0x20,0x0E,0x60,0x06,0x40,0x06,0x40,0x06,0x40,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x01,0x00,0x01,0x00,/*"V"*/
+0xFB,0xCF,0x61,0x86,0x61,0x84,0x61,0x84,0x31,0x84,0x30,0x84,0x31,0xC4,0x31,0xC8,0x31,0xC8,0x31,0xC8,0x32,0xC8,0x1A,0x48,0x1A,0x68,0x1A,0x70,0x1C,0x70,0x1C,0x70,0x1C,0x70,0x0C,0x30,0x08,0x20,0x08,0x20,0x08,0x20,/*"W"*/
+0xFC,0xF8,0x30,0x20,0x38,0x20,0x18,0x40,0x18,0x40,0x1C,0x80,0x0C,0x80,0x0F,0x00,0x07,0x00,0x07,0x00,0x03,0x00,0x03,0x80,0x05,0x80,0x05,0xC0,0x08,0xC0,0x08,0xC0,0x10,0x60,0x10,0x60,0x20,0x30,0x20,0x30,0xF8,0x7C,/*"X"*/
+0xFC,0x7C,0x70,0x10,0x30,0x10,0x30,0x20,0x18,0x20,0x18,0x60,0x1C,0x40,0x0C,0x40,0x0C,0x80,0x06,0x80,0x06,0x80,0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,/*"Y"*/
+0x3F,0xF8,0x30,0x30,0x20,0x30,0x40,0x60,0x40,0xE0,0x00,0xC0,0x01,0xC0,0x01,0x80,0x03,0x80,0x03,0x00,0x07,0x00,0x06,0x00,0x0E,0x00,0x0C,0x00,0x1C,0x00,0x18,0x00,0x38,0x08,0x30,0x08,0x70,0x10,0x60,0x30,0xFF,0xF0,/*"Z"*/
+0xFF,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xFF,/*"["*/
+0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x20,/*"\\"*/
+0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,/*"]"*/
+0x1E,0x00,0x36,0x00,0x41,0x00,0x80,0x80,/*"^"*/
+0xFF,0xFF,/*"_"*/
+0xF0,0x18,0x04,/*"`"*/
+0x1F,0x80,0x30,0xC0,0x60,0x60,0x60,0x60,0x00,0x60,0x03,0xE0,0x1C,0x60,0x70,0x60,0x60,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x64,0x61,0xE4,0x3E,0x38,/*"a"*/
+0x10,0x00,0xF0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x31,0xE0,0x36,0x30,0x38,0x18,0x38,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x08,0x38,0x18,0x3C,0x30,0x27,0xC0,/*"b"*/
+0x0F,0x80,0x38,0xC0,0x60,0x60,0x60,0x60,0xC0,0x60,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x10,0x60,0x10,0x60,0x20,0x30,0x40,0x0F,0x80,/*"c"*/
+0x00,0x20,0x01,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x1F,0x60,0x30,0xE0,0x60,0x60,0x60,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0x40,0x60,0x60,0xE0,0x31,0x78,0x1E,0x40,/*"d"*/
+0x0F,0x80,0x30,0xC0,0x60,0x60,0x40,0x20,0xC0,0x30,0xC0,0x30,0xFF,0xF0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x10,0x60,0x20,0x38,0x60,0x0F,0x80,/*"e"*/
+0x01,0xF0,0x07,0x0C,0x04,0x0C,0x0C,0x0C,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xFF,0xE0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x7F,0xC0,/*"f"*/
+0x0F,0xB8,0x30,0xD8,0x20,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x20,0x60,0x30,0xC0,0x3F,0x80,0x60,0x00,0x60,0x00,0x3F,0xC0,0x3F,0xF0,0x40,0x38,0xC0,0x18,0xC0,0x18,0xC0,0x18,0x70,0x70,0x1F,0xC0,/*"g"*/
+0x10,0x00,0xF0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x33,0xE0,0x36,0x30,0x38,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0xFC,0x7E,/*"h"*/
+0x0E,0x00,0x0E,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xFF,0xC0,/*"i"*/
+0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x0F,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0xC1,0x80,0xC3,0x00,0x7E,0x00,/*"j"*/
+0x10,0x00,0xF0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0xF8,0x30,0x60,0x30,0xC0,0x31,0x80,0x31,0x00,0x33,0x00,0x37,0x00,0x39,0x80,0x31,0xC0,0x30,0xC0,0x30,0x60,0x30,0x70,0x30,0x30,0xFC,0x7C,/*"k"*/
+0x04,0x00,0xFC,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xFF,0xC0,/*"l"*/
+0x20,0x00,0xEE,0x70,0x73,0x98,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0x63,0x18,0xF7,0xBC,/*"m"*/
+0x10,0x00,0xF1,0xE0,0x36,0x30,0x38,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0xFC,0x7E,/*"n"*/
+0x0F,0x80,0x38,0xE0,0x20,0x30,0x60,0x30,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0xC0,0x18,0x60,0x30,0x60,0x30,0x30,0x60,0x0F,0x80,/*"o"*/
+0x10,0x00,0xF3,0xE0,0x34,0x30,0x38,0x18,0x30,0x08,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x18,0x38,0x18,0x3C,0x30,0x33,0xC0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00,/*"p"*/
+0x0F,0x10,0x30,0xF0,0x60,0x70,0x60,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0x40,0x30,0x60,0x70,0x30,0xF0,0x1F,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,/*"q"*/
+0x0C,0x00,0xFC,0x78,0x0C,0xCC,0x0D,0x0C,0x0E,0x00,0x0E,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xFF,0xC0,/*"r"*/
+0x1F,0x90,0x30,0x70,0x60,0x30,0x60,0x10,0x60,0x00,0x38,0x00,0x1F,0x00,0x07,0xC0,0x00,0xE0,0x80,0x30,0x80,0x30,0xC0,0x30,0xE0,0x60,0xDF,0xC0,/*"s"*/
+0x04,0x00,0x04,0x00,0x04,0x00,0x0C,0x00,0x1C,0x00,0xFF,0xE0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x10,0x0C,0x10,0x06,0x20,0x03,0xC0,/*"t"*/
+0x10,0x08,0xF0,0x78,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x18,0x30,0x38,0x18,0x5E,0x0F,0x90,/*"u"*/
+0xFC,0x78,0x30,0x30,0x30,0x20,0x38,0x20,0x18,0x40,0x18,0x40,0x1C,0x80,0x0C,0x80,0x0C,0x80,0x0F,0x00,0x07,0x00,0x07,0x00,0x06,0x00,0x02,0x00,/*"v"*/
+0xFB,0xEF,0x71,0xC6,0x30,0xC4,0x31,0xC4,0x31,0xC4,0x19,0xC8,0x19,0xC8,0x1A,0x68,0x1A,0x68,0x0E,0x70,0x0E,0x70,0x0E,0x70,0x04,0x20,0x04,0x20,/*"w"*/
+0x7E,0xF8,0x1C,0x20,0x1C,0x40,0x0E,0x40,0x06,0x80,0x07,0x00,0x03,0x80,0x03,0x80,0x05,0xC0,0x0C,0xC0,0x08,0x60,0x10,0x60,0x30,0x30,0xF8,0xFC,/*"x"*/
+0xFC,0x7C,0x30,0x30,0x30,0x20,0x18,0x20,0x18,0x20,0x18,0x40,0x0C,0x40,0x0C,0x40,0x06,0x80,0x06,0x80,0x06,0x80,0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x64,0x00,0x78,0x00,/*"y"*/
+0xFF,0xE0,0xC0,0xC0,0x81,0xC0,0x81,0x80,0x03,0x00,0x07,0x00,0x06,0x00,0x0C,0x00,0x1C,0x00,0x38,0x10,0x30,0x10,0x70,0x30,0xE0,0x60,0xFF,0xE0,/*"z"*/
+0x06,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0xC0,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x06,/*"{"*/
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,/*"|"*/
+0xC0,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x06,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0xC0,/*"}"*/
+0x38,0x00,0x46,0x00,0xC2,0x04,0x81,0x0C,0x00,0x88,0x00,0x70,/*"~"*/
+};
+
+const LCD_Glyph ascii_p32_glyphs[95]={ // offset,width,height,x_off,y_off,advance
+	{0, 0, 0, 0, 0, 8}, /*" "*/
+	{0, 4, 22, 0, 5, 6}, /*"!"*/
+	{22, 11, 8, 0, 3, 13}, /*"""*/
+	{38, 14, 21, 0, 6, 16}, /*"#"*/
+	{80, 12, 26, 0, 4, 14}, /*"$"*/
+	{132, 15, 21, 0, 6, 17}, /*"%"*/
+	{174, 15, 21, 0, 6, 17}, /*"&"*/
+	{216, 5, 8, 0, 3, 7}, /*"'"*/
+	{224, 8, 28, 0, 3, 10}, /*"("*/
+	{252, 8, 28, 0, 3, 10}, /*")"*/
+	{280, 13, 17, 0, 8, 15}, /*"*"*/
+	{314, 13, 15, 0, 9, 15}, /*"+"*/
+	{344, 5, 8, 0, 24, 7}, /*","*/
+	{352, 14, 1, 0, 16, 16}, /*"-"*/
+	{354, 4, 4, 0, 23, 6}, /*"."*/
+	{358, 14, 27, 0, 3, 16}, /*"/"*/
+	{412, 13, 21, 0, 6, 15}, /*"0"*/
+	{454, 10, 21, 0, 6, 12}, /*"1"*/
+	{496, 12, 21, 0, 6, 14}, /*"2"*/
+	{538, 12, 21, 0, 6, 14}, /*"3"*/
+	{580, 14, 22, 0, 6, 16}, /*"4"*/
+	{624, 12, 21, 0, 6, 14}, /*"5"*/
+	{666, 13, 21, 0, 6, 15}, /*"6"*/
+	{708, 12, 21, 0, 6, 14}, /*"7"*/
+	{750, 13, 21, 0, 6, 15}, /*"8"*/
+	{792, 13, 21, 0, 6, 15}, /*"9"*/
+	{834, 4, 14, 0, 13, 6}, /*":"*/
+	{848, 2, 18, 0, 13, 4}, /*";"*/
+	{866, 12, 23, 0, 5, 14}, /*"<"*/
+	{912, 14, 7, 0, 13, 16}, /*"="*/
+	{926, 12, 23, 0, 5, 14}, /*">"*/
+	{972, 13, 22, 0, 5, 15}, /*"?"*/
+	{1016, 14, 21, 0, 6, 16}, /*"@"*/
+	{1058, 15, 22, 0, 5, 17}, /*"A"*/
+	{1102, 14, 21, 0, 6, 16}, /*"B"*/
+	{1144, 14, 21, 0, 6, 16}, /*"C"*/
+	{1186, 14, 21, 0, 6, 16}, /*"D"*/
+	{1228, 14, 21, 0, 6, 16}, /*"E"*/
+	{1270, 15, 21, 0, 6, 17}, /*"F"*/
+	{1312, 15, 21, 0, 6, 17}, /*"G"*/
+	{1354, 15, 21, 0, 6, 17}, /*"H"*/
+	{1396, 10, 21, 0, 6, 12}, /*"I"*/
+	{1438, 14, 26, 0, 6, 16}, /*"J"*/
+	{1490, 15, 21, 0, 6, 17}, /*"K"*/
+	{1532, 14, 21, 0, 6, 16}, /*"L"*/
+	{1574, 16, 21, 0, 6, 18}, /*"M"*/
+	{1616, 15, 21, 0, 6, 17}, /*"N"*/
+	{1658, 14, 21, 0, 6, 16}, /*"O"*/
+	{1700, 14, 21, 0, 6, 16}, /*"P"*/
+	{1742, 14, 24, 0, 6, 16}, /*"Q"*/
+	{1790, 14, 21, 0, 6, 16}, /*"R"*/
+	{1832, 13, 21, 0, 6, 15}, /*"S"*/
+	{1874, 14, 21, 0, 6, 16}, /*"T"*/
+	{1916, 15, 21, 0, 6, 17}, /*"U"*/
+	{1958, 15, 21, 0, 6, 17}, /*"V"*/
+	{2000, 16, 21, 0, 6, 18}, /*"W"*/
+	{2042, 14, 21, 0, 6, 16}, /*"X"*/
+	{2084, 14, 21, 0, 6, 16}, /*"Y"*/
+	{2126, 13, 21, 0, 6, 15}, /*"Z"*/
+	{2168, 8, 27, 0, 3, 10}, /*"["*/
+	{2195, 11, 26, 0, 5, 13}, /*"\\"*/
+	{2247, 8, 27, 0, 3, 10}, /*"]"*/
+	{2274, 9, 4, 0, 3, 11}, /*"^"*/
+	{2282, 16, 1, 0, 31, 18}, /*"_"*/
+	{2284, 6, 3, 0, 3, 8}, /*"`"*/
+	{2287, 14, 14, 0, 13, 16}, /*"a"*/
+	{2315, 14, 22, 0, 5, 16}, /*"b"*/
+	{2359, 12, 14, 0, 13, 14}, /*"c"*/
+	{2387, 13, 22, 0, 5, 15}, /*"d"*/
+	{2431, 12, 14, 0, 13, 14}, /*"e"*/
+	{2459, 14, 21, 0, 6, 16}, /*"f"*/
+	{2501, 13, 19, 0, 13, 15}, /*"g"*/
+	{2539, 15, 22, 0, 5, 17}, /*"h"*/
+	{2583, 10, 21, 0, 6, 12}, /*"i"*/
+	{2625, 11, 26, 0, 6, 13}, /*"j"*/
+	{2677, 14, 22, 0, 5, 16}, /*"k"*/
+	{2721, 10, 22, 0, 5, 12}, /*"l"*/
+	{2765, 14, 15, 0, 12, 16}, /*"m"*/
+	{2795, 15, 15, 0, 12, 17}, /*"n"*/
+	{2825, 13, 14, 0, 13, 15}, /*"o"*/
+	{2853, 14, 20, 0, 12, 16}, /*"p"*/
+	{2893, 14, 19, 0, 13, 16}, /*"q"*/
+	{2931, 14, 15, 0, 12, 16}, /*"r"*/
+	{2961, 12, 14, 0, 13, 14}, /*"s"*/
+	{2989, 12, 19, 0, 8, 14}, /*"t"*/
+	{3027, 15, 15, 0, 12, 17}, /*"u"*/
+	{3057, 13, 14, 0, 13, 15}, /*"v"*/
+	{3085, 16, 14, 0, 13, 18}, /*"w"*/
+	{3113, 14, 14, 0, 13, 16}, /*"x"*/
+	{3141, 14, 19, 0, 13, 16}, /*"y"*/
+	{3179, 12, 14, 0, 13, 14}, /*"z"*/
+	{3207, 7, 28, 0, 3, 9}, /*"{"*/
+	{3235, 1, 32, 0, 0, 3}, /*"|"*/
+	{3267, 7, 28, 0, 3, 9}, /*"}"*/
+	{3295, 14, 6, 0, 1, 16}, /*"~"*/
+};
+
+const unsigned char ascii_paa16[]={ // 16ظ߱,ascii_3216
+0x90,0xE0,0xE0,0xE0,0x80,0x80,0x80,0x40,0x00,0x50,0xF0,0x50,/*"!"*/
+0x18,0x90,0x2D,0xE0,0x76,0x80,0x92,0x00,0x44,0x00,/*"""*/
+0x08,0x08,0x08,0x08,0x6A,0xA9,0x6A,0xA9,0x08,0x20,0x08,0x20,0x08,0x20,0xBF,0xFE,0x20,0x20,0x20,0x20,0x10,0x10,/*"#"*/
+0x02,0x00,0x1A,0x90,0x62,0x30,0xA2,0xB0,0x76,0x00,0x1E,0x00,0x07,0x80,0x02,0xA0,0x92,0x30,0xD2,0x30,0x92,0x90,0x1A,0x40,0x02,0x00,/*"$"*/
+0x68,0x18,0xCA,0x20,0xCA,0x20,0xCA,0x80,0x99,0xA4,0x26,0x98,0x02,0xCA,0x05,0xCA,0x08,0xCA,0x18,0x98,0x10,0x24,/*"%"*/
+0x1A,0x40,0x32,0x80,0x32,0x80,0x32,0x00,0x29,0x68,0x68,0x20,0x89,0x20,0xC6,0x20,0xC2,0xC1,0xA1,0x95,0x19,0x24,/*"&"*/
+0x24,0x3C,0x0C,0x24,0x50,/*"'"*/
+0x00,0x40,0x02,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x60,0x00,0x30,0x00,0x28,0x00,0x08,0x00,0x02,0x00,0x00,0x40,/*"("*/
+0x40,0x00,0x20,0x00,0x08,0x00,0x09,0x00,0x03,0x00,0x02,0x40,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x40,0x03,0x00,0x0A,0x00,0x08,0x00,0x20,0x00,0x40,0x00,/*")"*/
+0x06,0x00,0x06,0x00,0xE2,0x78,0x6A,0xA0,0x0A,0x40,0xB6,0xB4,0x92,0x24,0x0B,0x00,0x05,0x00,/*"*"*/
+0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xAA,0xA4,0x02,0x00,0x02,0x00,0x02,0x00,/*"+"*/
+0x38,0x2C,0x08,0x60,/*","*/
+0x6A,0xA9,/*"-"*/
+0x50,0xF0,0x50,/*"."*/
+0x00,0x01,0x00,0x09,0x00,0x08,0x00,0x24,0x00,0x20,0x00,0x90,0x00,0x80,0x02,0x40,0x02,0x00,0x09,0x00,0x08,0x00,0x24,0x00,0x20,0x00,0x90,0x00,/*"/"*/
+0x1A,0x80,0x60,0x60,0xA0,0x20,0xC0,0x28,0xC0,0x28,0xC0,0x28,0xC0,0x28,0x90,0x24,0xA0,0x30,0x24,0x90,0x0A,0x40,/*"0"*/
+0x06,0x00,0x6A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x6A,0x90,/*"1"*/
+0x2A,0x90,0x80,0x60,0x80,0x30,0x80,0x30,0x00,0x90,0x01,0x40,0x05,0x00,0x14,0x10,0x50,0x20,0xAA,0xA0,0xAA,0x90,/*"2"*/
+0x6A,0x80,0xC0,0x90,0xC0,0xA0,0x00,0x90,0x0A,0x40,0x01,0x90,0x00,0x20,0x80,0x30,0xC0,0x20,0x90,0x90,0x1A,0x00,/*"3"*/
+0x00,0x70,0x00,0xB0,0x02,0xB0,0x06,0xB0,0x08,0xB0,0x14,0xB0,0x20,0xB0,0x6A,0xB9,0x00,0xB0,0x00,0xB0,0x02,0xB9,/*"4"*/
+0x3F,0xF0,0x20,0x00,0x50,0x00,0x8A,0x40,0xA0,0x90,0x40,0x20,0x00,0x30,0x80,0x30,0x80,0x60,0x80,0x90,0x2A,0x00,/*"5"*/
+0x0A,0x90,0x20,0x30,0xA0,0x00,0x80,0x00,0xDA,0x90,0xE0,0x24,0xC0,0x28,0xC0,0x28,0xA0,0x24,0x24,0x60,0x0A,0x40,/*"6"*/
+0xBF,0xF0,0xD0,0x50,0x80,0x80,0x01,0x40,0x02,0x00,0x02,0x00,0x08,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,/*"7"*/
+0x0A,0xA0,0x24,0x18,0x30,0x0C,0x28,0x18,0x0A,0xA0,0x19,0xA0,0x60,0x28,0xA0,0x0C,0xA0,0x0C,0x24,0x24,0x06,0x80,/*"8"*/
+0x1A,0x90,0x30,0x24,0xA0,0x08,0xA0,0x0C,0xA0,0x1C,0x24,0x6C,0x0A,0x4C,0x00,0x28,0x20,0x24,0x30,0x90,0x0A,0x40,/*"9"*/
+0x50,0xF0,0x50,0x00,0x00,0x50,0xF0,0x50,/*":"*/
+0x80,0x80,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x40,/*";"*/
+0x00,0x10,0x00,0x50,0x01,0x80,0x06,0x00,0x18,0x00,0x60,0x00,0x90,0x00,0x24,0x00,0x09,0x00,0x02,0x40,0x00,0x80,0x00,0x20,/*"<"*/
+0x6A,0xA9,0x00,0x00,0x00,0x00,0x6A,0xA9,/*"="*/
+0x40,0x00,0x50,0x00,0x24,0x00,0x09,0x00,0x02,0x40,0x00,0x90,0x00,0x60,0x01,0x80,0x06,0x00,0x18,0x00,0x20,0x00,0x80,0x00,/*">"*/
+0x0A,0x40,0x60,0x60,0x80,0x28,0xE0,0x28,0x90,0x24,0x01,0x90,0x05,0x00,0x08,0x00,0x04,0x00,0x05,0x00,0x0F,0x00,0x05,0x00,/*"?"*/
+0x06,0xA4,0x18,0x08,0x31,0xB5,0xA2,0x32,0xA6,0x32,0xAA,0x22,0xAA,0xA8,0x66,0x68,0x20,0x05,0x18,0x18,0x02,0x90,/*"@"*/
+0x00,0x40,0x03,0x80,0x02,0x80,0x09,0xC0,0x08,0xC0,0x08,0xA0,0x08,0xA0,0x2A,0xB0,0x20,0x30,0x20,0x24,0x60,0x28,0xA4,0x29,/*"A"*/
+0x6A,0xA4,0x28,0x1C,0x28,0x0C,0x28,0x18,0x2A,0xA0,0x28,0x18,0x28,0x09,0x28,0x0A,0x28,0x0A,0x28,0x18,0x6A,0xA0,/*"B"*/
+0x06,0xA8,0x18,0x08,0x30,0x02,0x60,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0x60,0x01,0x30,0x05,0x18,0x18,0x02,0x90,/*"C"*/
+0x6A,0xA0,0x28,0x18,0x28,0x0C,0x28,0x0A,0x28,0x0A,0x28,0x0A,0x28,0x0A,0x28,0x09,0x28,0x08,0x28,0x64,0x6A,0x80,/*"D"*/
+0x6A,0xAC,0x28,0x09,0x28,0x01,0x28,0x20,0x2A,0xB0,0x28,0x20,0x28,0x10,0x28,0x00,0x28,0x02,0x28,0x08,0x6A,0xA8,/*"E"*/
+0x6A,0xAE,0x28,0x02,0x28,0x01,0x28,0x08,0x2A,0xA8,0x28,0x18,0x28,0x04,0x28,0x00,0x28,0x00,0x28,0x00,0x69,0x00,/*"F"*/
+0x0A,0xA8,0x18,0x08,0x30,0x08,0x60,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x2E,0x60,0x0C,0x24,0x0C,0x18,0x18,0x02,0x90,/*"G"*/
+0xB8,0x69,0x30,0x28,0x30,0x28,0x30,0x28,0x30,0x28,0x3A,0xA8,0x30,0x28,0x30,0x28,0x30,0x28,0x30,0x28,0xA8,0x69,/*"H"*/
+0x6A,0x90,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x6A,0x90,/*"I"*/
+0x06,0xA9,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0xB0,0x90,0x7A,0x40,/*"J"*/
+0x69,0x29,0x28,0x20,0x28,0x90,0x29,0x80,0x2A,0x80,0x2D,0xC0,0x28,0xA0,0x28,0x70,0x28,0x28,0x28,0x0C,0x69,0x2A,/*"K"*/
+0x69,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x02,0x28,0x08,0x6A,0xA8,/*"L"*/
+0xB8,0x2E,0x38,0x2C,0x28,0x2C,0x2C,0x2C,0x2D,0x9C,0x2A,0x8C,0x2A,0x8C,0x23,0x8C,0x23,0x4C,0x22,0x0C,0xA5,0x2A,/*"M"*/
+0xB8,0x29,0x2C,0x08,0x2D,0x08,0x2A,0x08,0x23,0x48,0x22,0x88,0x20,0xD8,0x20,0xA8,0x20,0x38,0x20,0x28,0xA4,0x14,/*"N"*/
+0x0A,0xA0,0x24,0x18,0x30,0x0C,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0x60,0x09,0x20,0x08,0x18,0x24,0x02,0x80,/*"O"*/
+0x6A,0xA4,0x28,0x09,0x28,0x0A,0x28,0x0A,0x28,0x18,0x2A,0xA0,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x69,0x00,/*"P"*/
+0x0A,0xA0,0x24,0x18,0x30,0x08,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0xA0,0x0A,0x66,0x4A,0x38,0x8C,0x18,0xA4,0x02,0xA1,0x00,0x2D,/*"Q"*/
+0x6A,0xA4,0x28,0x1C,0x28,0x0C,0x28,0x18,0x2A,0xA0,0x29,0xC0,0x28,0xA0,0x28,0xA0,0x28,0x30,0x28,0x28,0x69,0x19,/*"R"*/
+0x2A,0xA0,0x90,0x20,0xC0,0x10,0x90,0x00,0x6A,0x00,0x06,0xD0,0x00,0x74,0x40,0x28,0x80,0x28,0xA0,0x60,0x4A,0x80,/*"S"*/
+0x3A,0xA8,0x52,0x86,0x42,0x81,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x06,0x90,/*"T"*/
+0xB8,0x29,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x30,0x08,0x28,0x20,0x06,0x80,/*"U"*/
+0x68,0x1A,0x28,0x08,0x0C,0x08,0x0C,0x08,0x0A,0x20,0x0A,0x20,0x03,0x20,0x02,0x90,0x02,0xC0,0x01,0x80,0x00,0x40,/*"V"*/
+0xA6,0x8A,0xA2,0x88,0x31,0x88,0x32,0xC8,0x32,0xC8,0x26,0x88,0x2A,0xA4,0x2C,0xB0,0x1C,0x70,0x08,0x20,0x04,0x10,/*"W"*/
+0x69,0x68,0x1C,0x20,0x0D,0x50,0x0A,0x80,0x03,0x80,0x02,0x80,0x02,0xD0,0x08,0xA0,0x08,0x30,0x20,0x28,0x68,0x29,/*"X"*/
+0x79,0x29,0x28,0x14,0x0C,0x20,0x0A,0x20,0x06,0x80,0x03,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x02,0x80,0x06,0x90,/*"Y"*/
+0x2A,0xA8,0x20,0x24,0x10,0xA0,0x00,0xD0,0x02,0x80,0x03,0x40,0x0A,0x00,0x0D,0x00,0x28,0x08,0x34,0x18,0x6A,0xA4,/*"Z"*/
+0xAA,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xAA,/*"["*/
+0x40,0x00,0xA0,0x00,0x20,0x00,0x24,0x00,0x18,0x00,0x08,0x00,0x0A,0x00,0x02,0x00,0x02,0x40,0x01,0x80,0x00,0x80,0x00,0xA0,0x00,0x20,0x00,0x10,/*"\\"*/
+0xAA,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0xAA,/*"]"*/
+0x19,0x00,0x66,0x00,0x40,0x40,/*"^"*/
+0xAA,0xAA,/*"_"*/
+0x64,0x09,/*"`"*/
+0x0A,0x80,0x24,0x60,0x20,0x30,0x0A,0xB0,0x34,0x30,0xA0,0x30,0x60,0xB2,0x1A,0x18,/*"a"*/
+0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0xA0,0x2A,0x18,0x28,0x0A,0x28,0x0A,0x28,0x0A,0x28,0x09,0x2D,0x18,0x12,0x90,/*"b"*/
+0x0A,0x40,0x64,0x90,0x90,0xA0,0xC0,0x00,0xC0,0x00,0x90,0x20,0x60,0x50,0x0A,0x40,/*"c"*/
+0x00,0x10,0x01,0xA0,0x00,0xA0,0x00,0xA0,0x1A,0xA0,0x60,0xA0,0x90,0xA0,0xC0,0xA0,0xC0,0xA0,0x80,0xA0,0x61,0xA4,0x19,0x40,/*"d"*/
+0x0A,0x40,0x60,0x90,0x80,0x20,0xEA,0xB0,0xC0,0x00,0x90,0x10,0x64,0x60,0x0A,0x40,/*"e"*/
+0x06,0xA8,0x08,0x0C,0x0C,0x00,0xAE,0x90,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x6A,0x80,/*"f"*/
+0x0A,0x64,0x20,0xA4,0xA0,0xA0,0x60,0xA0,0x3A,0x80,0xA0,0x00,0x3F,0xE0,0x80,0x28,0xC0,0x28,0x6A,0xA0,/*"g"*/
+0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x29,0xA0,0x2A,0x18,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x69,0x2A,/*"h"*/
+0x0B,0x00,0x06,0x00,0x00,0x00,0x6A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x6A,0x90,/*"i"*/
+0x00,0xB0,0x00,0x60,0x00,0x00,0x06,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x50,0x90,0x6A,0x40,/*"j"*/
+0x04,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0x68,0x28,0x60,0x28,0x80,0x2A,0x80,0x28,0xD0,0x28,0x60,0x28,0x28,0x69,0x29,/*"k"*/
+0x01,0x00,0x6A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x6A,0x90,/*"l"*/
+0x66,0x24,0x36,0x8C,0x32,0x8C,0x32,0x8C,0x32,0x8C,0x32,0x8C,0x32,0x8C,0x66,0x99,/*"m"*/
+0x68,0xA0,0x2A,0x18,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x69,0x2A,/*"n"*/
+0x0A,0x40,0x24,0xA0,0x90,0x24,0xC0,0x28,0xC0,0x28,0x90,0x24,0x60,0x60,0x0A,0x40,/*"o"*/
+0x69,0xA0,0x29,0x18,0x28,0x09,0x28,0x0A,0x28,0x0A,0x28,0x09,0x2D,0x18,0x29,0x90,0x28,0x00,0x69,0x00,/*"p"*/
+0x0A,0x10,0x60,0xB0,0x90,0x30,0xC0,0x30,0xC0,0x30,0x80,0x30,0x60,0xB0,0x1A,0x30,0x00,0x30,0x00,0xB8,/*"q"*/
+0x6A,0x28,0x0A,0x9A,0x0B,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x6A,0x90,/*"r"*/
+0x1A,0x50,0x60,0x70,0xA0,0x10,0x2A,0x00,0x06,0xD0,0x80,0x30,0xD0,0x60,0x9A,0x80,/*"s"*/
+0x08,0x00,0x08,0x00,0xAE,0x90,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x10,0x09,0x20,0x02,0x80,/*"t"*/
+0x68,0x28,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x28,0x0C,0x18,0x2E,0x06,0x84,/*"u"*/
+0x69,0x28,0x28,0x24,0x1C,0x20,0x0D,0x50,0x0A,0x80,0x07,0x80,0x03,0x40,0x01,0x00,/*"v"*/
+0xA6,0x9A,0x71,0xC9,0x32,0xC8,0x2A,0xC8,0x2A,0xA8,0x0E,0xB0,0x09,0x60,0x04,0x10,/*"w"*/
+0x2A,0x68,0x0E,0x20,0x07,0x50,0x02,0x80,0x02,0xD0,0x09,0x60,0x18,0x24,0x68,0x69,/*"x"*/
+0x69,0x29,0x28,0x24,0x0C,0x20,0x09,0x20,0x06,0x50,0x03,0x80,0x02,0x80,0x02,0x40,0x02,0x00,0x39,0x00,/*"y"*/
+0xAA,0x90,0x81,0xC0,0x42,0x40,0x0A,0x00,0x1C,0x00,0x34,0x20,0xA0,0x60,0xAA,0x90,/*"z"*/
+0x02,0x08,0x08,0x08,0x08,0x08,0x14,0x60,0x08,0x08,0x08,0x08,0x08,0x08,0x02,/*"{"*/
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,/*"|"*/
+0x80,0x20,0x20,0x20,0x20,0x20,0x14,0x09,0x20,0x20,0x20,0x20,0x20,0x20,0x80,/*"}"*/
+0x18,0x00,0x62,0x01,0x40,0x89,0x00,0x24,/*"~"*/
+};
+
+const LCD_Glyph ascii_paa16_glyphs[95]={ // offset,width,height,x_off,y_off,advance
+	{0, 0, 0, 0, 0, 4}, /*" "*/
+	{0, 2, 12, 0, 2, 3}, /*"!"*/
+	{12, 6, 5, 0, 1, 7}, /*"""*/
+	{22, 8, 11, 0, 3, 9}, /*"#"*/
+	{44, 6, 13, 0, 2, 7}, /*"$"*/
+	{70, 8, 11, 0, 3, 9}, /*"%"*/
+	{92, 8, 11, 0, 3, 9}, /*"&"*/
+	{114, 3, 5, 0, 1, 4}, /*"'"*/
+	{119, 5, 15, 0, 1, 6}, /*"("*/
+	{149, 5, 15, 0, 1, 6}, /*")"*/
+	{179, 7, 9, 0, 4, 8}, /*"*"*/
+	{197, 7, 8, 0, 4, 8}, /*"+"*/
+	{213, 3, 4, 0, 12, 4}, /*","*/
+	{217, 8, 1, 0, 8, 9}, /*"-"*/
+	{219, 2, 3, 0, 11, 3}, /*"."*/
+	{222, 8, 14, 0, 1, 9}, /*"/"*/
+	{250, 7, 11, 0, 3, 8}, /*"0"*/
+	{272, 6, 11, 0, 3, 7}, /*"1"*/
+	{294, 6, 11, 0, 3, 7}, /*"2"*/
+	{316, 6, 11, 0, 3, 7}, /*"3"*/
+	{338, 8, 11, 0, 3, 9}, /*"4"*/
+	{360, 6, 11, 0, 3, 7}, /*"5"*/
+	{382, 7, 11, 0, 3, 8}, /*"6"*/
+	{404, 6, 11, 0, 3, 7}, /*"7"*/
+	{426, 7, 11, 0, 3, 8}, /*"8"*/
+	{448, 7, 11, 0, 3, 8}, /*"9"*/
+	{470, 2, 8, 0, 6, 3}, /*":"*/
+	{478, 1, 10, 0, 6, 2}, /*";"*/
+	{488, 6, 12, 0, 2, 7}, /*"<"*/
+	{512, 8, 4, 0, 6, 9}, /*"="*/
+	{520, 6, 12, 0, 2, 7}, /*">"*/
+	{544, 7, 12, 0, 2, 8}, /*"?"*/
+	{568, 8, 11, 0, 3, 9}, /*"@"*/
+	{590, 8, 12, 0, 2, 9}, /*"A"*/
+	{614, 8, 11, 0, 3, 9}, /*"B"*/
+	{636, 8, 11, 0, 3, 9}, /*"C"*/
+	{658, 8, 11, 0, 3, 9}, /*"D"*/
+	{680, 8, 11, 0, 3, 9}, /*"E"*/
+	{702, 8, 11, 0, 3, 9}, /*"F"*/
+	{724, 8, 11, 0, 3, 9}, /*"G"*/
+	{746, 8, 11, 0, 3, 9}, /*"H"*/
+	{768, 6, 11, 0, 3, 7}, /*"I"*/
+	{790, 8, 13, 0, 3, 9}, /*"J"*/
+	{816, 8, 11, 0, 3, 9}, /*"K"*/
+	{838, 8, 11, 0, 3, 9}, /*"L"*/
+	{860, 8, 11, 0, 3, 9}, /*"M"*/
+	{882, 8, 11, 0, 3, 9}, /*"N"*/
+	{904, 8, 11, 0, 3, 9}, /*"O"*/
+	{926, 8, 11, 0, 3, 9}, /*"P"*/
+	{948, 8, 12, 0, 3, 9}, /*"Q"*/
+	{972, 8, 11, 0, 3, 9}, /*"R"*/
+	{994, 7, 11, 0, 3, 8}, /*"S"*/
+	{1016, 8, 11, 0, 3, 9}, /*"T"*/
+	{1038, 8, 11, 0, 3, 9}, /*"U"*/
+	{1060, 8, 11, 0, 3, 9}, /*"V"*/
+	{1082, 8, 11, 0, 3, 9}, /*"W"*/
+	{1104, 8, 11, 0, 3, 9}, /*"X"*/
+	{1126, 8, 11, 0, 3, 9}, /*"Y"*/
+	{1148, 7, 11, 0, 3, 8}, /*"Z"*/
+	{1170, 4, 14, 0, 1, 5}, /*"["*/
+	{1184, 6, 14, 0, 2, 7}, /*"\\"*/
+	{1212, 4, 14, 0, 1, 5}, /*"]"*/
+	{1226, 5, 3, 0, 1, 6}, /*"^"*/
+	{1232, 8, 1, 0, 15, 9}, /*"_"*/
+	{1234, 4, 2, 0, 1, 5}, /*"`"*/
+	{1236, 8, 8, 0, 6, 9}, /*"a"*/
+	{1252, 8, 12, 0, 2, 9}, /*"b"*/
+	{1276, 6, 8, 0, 6, 7}, /*"c"*/
+	{1292, 7, 12, 0, 2, 8}, /*"d"*/
+	{1316, 6, 8, 0, 6, 7}, /*"e"*/
+	{1332, 7, 11, 0, 3, 8}, /*"f"*/
+	{1354, 7, 10, 0, 6, 8}, /*"g"*/
+	{1374, 8, 12, 0, 2, 9}, /*"h"*/
+	{1398, 6, 11, 0, 3, 7}, /*"i"*/
+	{1420, 6, 13, 0, 3, 7}, /*"j"*/
+	{1446, 8, 12, 0, 2, 9}, /*"k"*/
+	{1470, 6, 12, 0, 2, 7}, /*"l"*/
+	{1494, 8, 8, 0, 6, 9}, /*"m"*/
+	{1510, 8, 8, 0, 6, 9}, /*"n"*/
+	{1526, 7, 8, 0, 6, 8}, /*"o"*/
+	{1542, 8, 10, 0, 6, 9}, /*"p"*/
+	{1562, 7, 10, 0, 6, 8}, /*"q"*/
+	{1582, 8, 8, 0, 6, 9}, /*"r"*/
+	{1598, 6, 8, 0, 6, 7}, /*"s"*/
+	{1614, 6, 10, 0, 4, 7}, /*"t"*/
+	{1634, 8, 8, 0, 6, 9}, /*"u"*/
+	{1650, 7, 8, 0, 6, 8}, /*"v"*/
+	{1666, 8, 8, 0, 6, 9}, /*"w"*/
+	{1682, 8, 8, 0, 6, 9}, /*"x"*/
+	{1698, 8, 10, 0, 6, 9}, /*"y"*/
+	{1718, 6, 8, 0, 6, 7}, /*"z"*/
+	{1734, 4, 15, 0, 1, 5}, /*"{"*/
+	{1749, 1, 16, 0, 0, 2}, /*"|"*/
+	{1765, 4, 15, 0, 1, 5}, /*"}"*/
+	{1780, 8, 4, 0, 0, 9}, /*"~"*/
+};
+
+const LCD_Font LCD_Font_P16 = {8, 16, 0, 1, 1, 0, ascii_p16, -1, ascii_p16_glyphs};
+const LCD_Font LCD_Font_P24 = {12, 24, 0, 1, 1, 0, ascii_p24, -1, ascii_p24_glyphs};
+const LCD_Font LCD_Font_P32 = {16, 32, 0, 1, 1, 0, ascii_p32, -1, ascii_p32_glyphs};
+const LCD_Font LCD_Font_PAA16 = {8, 16, 0, 2, 1, 0, ascii_paa16, -1, ascii_paa16_glyphs};
+
+#endif
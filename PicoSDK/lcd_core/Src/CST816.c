@@ -1,14 +1,14 @@
-#include "Inc/CST816.h" 
- 
-#define TOUCH_OFFSET_Y 5
-#define REVERSE 0
- 
-CST816_Info	CST816_Instance;
+#include "Inc/lcd_init.h"
+
+#if LCD_TOUCH == LCD_TOUCH_CST816 // 귭תƫĻInc/lcd_init.h
+
+#include "Inc/CST816.h"
 
 iic_bus_t CST816_dev =
 {
     .sda_pin = I2C0_SDA_PIN,
     .scl_pin = I2C0_SCL_PIN,
+    .baudrate = 400000, // ӲI2C;ŲI2CSDA/SCLʱ,IICInitԶģI2C
 };
 
 CST816_Info CST816_Instance;
@@ -102,11 +102,15 @@ void CST816_Get_XY_AXIS(void)
 	uint8_t DAT[4];
 	IIC_Read_Multi_Byte(&CST816_dev,Device_Addr,XposH,4,DAT);
 	CST816_Instance.X_Pos=((DAT[0]&0x0F)<<8)|DAT[1];//(temp[0]&0X0F)<<4|
-	CST816_Instance.Y_Pos=((DAT[2]&0x0F)<<8)|DAT[3] + TOUCH_OFFSET_Y;//(temp[2]&0X0F)<<4|
-	#if REVERSE
-		CST816_Instance.X_Pos = 239 - CST816_Instance.X_Pos;
-		CST816_Instance.Y_Pos = 279 - CST816_Instance.Y_Pos;
+	CST816_Instance.Y_Pos=((DAT[2]&0x0F)<<8)|DAT[3];//(temp[2]&0X0F)<<4|
+	#if LCD_TOUCH_FLIP_X
+		CST816_Instance.X_Pos = LCD_W - 1 - CST816_Instance.X_Pos;
+	#endif
+	#if LCD_TOUCH_FLIP_Y
+		CST816_Instance.Y_Pos = LCD_H - 1 - CST816_Instance.Y_Pos;
 	#endif
+	CST816_Instance.X_Pos += LCD_TOUCH_OFFSET_X;
+	CST816_Instance.Y_Pos += LCD_TOUCH_OFFSET_Y;
 }
  
 /*
@@ -250,3 +254,4 @@ void CST816_Config_LpScanTH(uint8_t TH)
 	CST816_IIC_WriteREG(LpScanTH,TH);
 }
 
+#endif
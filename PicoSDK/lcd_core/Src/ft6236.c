@@ -0,0 +1,458 @@
+
+#include "Inc/lcd_init.h"
+
+#if LCD_TOUCH == LCD_TOUCH_FT6236 // Flip/offset come from the panel's Inc/lcd_init.h
+
+#include "Inc/ft6236.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+FT6236_Info FT6236_Instance;
+
+/* Event queue: single producer (INT pin IRQ), single consumer (FT6236_Get_Event) */
+static FT6236_Event FT6236_Event_Queue[FT6236_EVENT_QUEUE_SIZE];
+static volatile uint8_t FT6236_Event_Head;  // Written by the IRQ only
+static volatile uint8_t FT6236_Event_Tail;  // Written by the reader only
+static volatile bool FT6236_IRQ_Enabled;
+static FT6236_Event FT6236_Event_Last;      // Last queued event, used to report the lift
+
+iic_bus_t FT6236_dev = {
+    .sda_pin = I2C0_SDA_PIN,
+    .scl_pin = I2C0_SCL_PIN,
+    .baudrate = 400000, // Fast-mode; IICInit bit-bangs instead when the pins are not an SDA/SCL pair of the I2C block
+};
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Bus_Lock / FT6236_Bus_Unlock
+*   Description: Keep the INT pin IRQ from reading the bus while a polled access is in progress.
+*                Masks the GPIO bank at the NVIC rather than the pin: gpio_set_irq_enabled() clears
+*                latched edges, which would lose a report (possibly the lift). Masked at the NVIC,
+*                the edge stays pending and the handler runs on unlock.
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+static inline void FT6236_Bus_Lock(void)
+{
+    if (FT6236_IRQ_Enabled)
+        irq_set_enabled(IO_IRQ_BANK0, false);
+}
+
+static inline void FT6236_Bus_Unlock(void)
+{
+    if (FT6236_IRQ_Enabled)
+        irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_GPIO_Init
+*   Description: Initialize GPIO pins for FT6236
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_GPIO_Init(void)
+{
+    gpio_init(TOUCH_RST_PIN);
+    gpio_set_function(TOUCH_RST_PIN, GPIO_FUNC_SIO);
+    gpio_set_dir(TOUCH_RST_PIN, GPIO_OUT);
+    gpio_put(TOUCH_RST_PIN, 1);
+
+    /* Initialize I2C pins */
+    IICInit(&FT6236_dev);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Init
+*   Description: Initialize FT6236 touch controller
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Init(void)
+{
+    FT6236_GPIO_Init();
+    FT6236_RESET();
+
+    // Set default threshold
+    FT6236_Set_Threshold(128);
+
+    // Set interrupt mode to trigger
+    FT6236_Set_InterruptMode(FT6236_INT_MODE_TRIGGER);
+
+    // Set active mode report rate to 10ms
+    FT6236_Set_ActiveRate(10);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_IIC_ReadREG
+*   Description: Read single register from FT6236
+*   Parameters: addr - register address
+*   Return: register value
+*********************************************************************************************************
+*/
+uint8_t FT6236_IIC_ReadREG(uint8_t addr)
+{
+    uint8_t value;
+
+    FT6236_Bus_Lock();
+    value = IIC_Read_One_Byte(&FT6236_dev, FT6236_ADDR, addr);
+    FT6236_Bus_Unlock();
+    return value;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_IIC_WriteREG
+*   Description: Write to FT6236 register
+*   Parameters: addr - register address
+*               dat - data to write
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_IIC_WriteREG(uint8_t addr, uint8_t dat)
+{
+    FT6236_Bus_Lock();
+    IIC_Write_One_Byte(&FT6236_dev, FT6236_ADDR, addr, dat);
+    FT6236_Bus_Unlock();
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_RESET
+*   Description: Reset FT6236
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_RESET(void)
+{
+    TOUCH_RST_0;
+    sleep_ms(10);
+    TOUCH_RST_1;
+    sleep_ms(100);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Read_Touch
+*   Description: Read TD_STATUS and both touch point registers (0x02..0x0E) in one burst,
+*                without locking the bus
+*   Parameters: points - array of FT6236_MAX_TOUCH entries, valid points are stored first
+*   Return: number of touch points (0-2)
+*********************************************************************************************************
+*/
+static uint8_t FT6236_Read_Touch(FT6236_Info *points)
+{
+    uint8_t data[FT6236_REG_TOUCH2_MISC - FT6236_REG_TD_STATUS + 1];
+    const uint8_t *reg = &data[FT6236_REG_TOUCH1_XH - FT6236_REG_TD_STATUS];
+    uint8_t count, n = 0, i;
+
+    IIC_Read_Multi_Byte(&FT6236_dev, FT6236_ADDR, FT6236_REG_TD_STATUS, sizeof(data), data);
+
+    count = data[0] & 0x0F;
+    if (count > FT6236_MAX_TOUCH)
+        count = 0; // 0x0F until the first report, or a read that nobody answered
+
+    for (i = 0; i < FT6236_MAX_TOUCH && n < count; i++, reg += FT6236_REG_TOUCH2_XH - FT6236_REG_TOUCH1_XH)
+    {
+        if ((reg[2] >> 4) == 0x0F)
+            continue; // Slot not in use, the remaining finger can sit in touch 2
+
+        points[n].Touch_Event = (reg[0] >> 6) & 0x03;
+        points[n].Touch_ID = reg[2] >> 4;
+        points[n].X_Pos = ((reg[0] & 0x0F) << 8) | reg[1];
+        points[n].Y_Pos = ((reg[2] & 0x0F) << 8) | reg[3];
+        points[n].Weight = reg[4];
+        points[n].Area = reg[5] >> 4;
+
+#if LCD_TOUCH_FLIP_X
+        points[n].X_Pos = LCD_W - 1 - points[n].X_Pos;
+#endif
+
+#if LCD_TOUCH_FLIP_Y
+        points[n].Y_Pos = LCD_H - 1 - points[n].Y_Pos;
+#endif
+
+        points[n].X_Pos += LCD_TOUCH_OFFSET_X;
+        points[n].Y_Pos += LCD_TOUCH_OFFSET_Y;
+        n++;
+    }
+
+    for (i = 0; i < n; i++)
+        points[i].Touch_Count = n;
+    return n;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Get_Touch_Data
+*   Description: Read touch data from FT6236 in a single I2C transaction
+*   Parameters: none
+*   Return: none (data stored in FT6236_Instance structure, position kept when nothing is touched)
+*********************************************************************************************************
+*/
+void FT6236_Get_Touch_Data(void)
+{
+    FT6236_Info points[FT6236_MAX_TOUCH];
+    uint8_t count;
+
+    FT6236_Bus_Lock();
+    count = FT6236_Read_Touch(points);
+    FT6236_Bus_Unlock();
+
+    if (count > 0)
+        FT6236_Instance = points[0];
+    FT6236_Instance.Touch_Count = count;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Get_Touch_Points
+*   Description: Read all touch points in a single I2C transaction, e.g. for two finger gestures
+*   Parameters: points - array of FT6236_MAX_TOUCH entries, only the first (return value) are written
+*   Return: number of touch points (0-2)
+*********************************************************************************************************
+*/
+uint8_t FT6236_Get_Touch_Points(FT6236_Info points[FT6236_MAX_TOUCH])
+{
+    uint8_t count;
+
+    FT6236_Bus_Lock();
+    count = FT6236_Read_Touch(points);
+    FT6236_Bus_Unlock();
+    return count;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Get_Touch_Count
+*   Description: Get number of touch points
+*   Parameters: none
+*   Return: number of touch points (0-2)
+*********************************************************************************************************
+*/
+uint8_t FT6236_Get_Touch_Count(void)
+{
+    uint8_t status = FT6236_IIC_ReadREG(FT6236_REG_TD_STATUS);
+    return status & 0x0F;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Get_ChipID
+*   Description: Get chip ID
+*   Parameters: none
+*   Return: chip ID
+*********************************************************************************************************
+*/
+uint8_t FT6236_Get_ChipID(void)
+{
+    return FT6236_IIC_ReadREG(FT6236_REG_CHIP_ID);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Get_LibVersion
+*   Description: Get library version
+*   Parameters: none
+*   Return: library version
+*********************************************************************************************************
+*/
+uint16_t FT6236_Get_LibVersion(void)
+{
+    uint8_t ver_h = FT6236_IIC_ReadREG(FT6236_REG_LIB_VERSION_H);
+    uint8_t ver_l = FT6236_IIC_ReadREG(FT6236_REG_LIB_VERSION_L);
+    return (ver_h << 8) | ver_l;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Set_Threshold
+*   Description: Set touch threshold
+*   Parameters: threshold - threshold value (0-255)
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Set_Threshold(uint8_t threshold)
+{
+    FT6236_IIC_WriteREG(FT6236_REG_THRESHOLD, threshold);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Set_PowerMode
+*   Description: Set power mode
+*   Parameters: mode - power mode (active, monitor, hibernate)
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Set_PowerMode(FT6236_PowerMode_TypeDef mode)
+{
+    FT6236_IIC_WriteREG(FT6236_REG_POWER_MODE, mode);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Set_InterruptMode
+*   Description: Set interrupt mode
+*   Parameters: mode - interrupt mode (polling, trigger, continuous)
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Set_InterruptMode(FT6236_IntMode_TypeDef mode)
+{
+    FT6236_IIC_WriteREG(FT6236_REG_G_MODE, mode);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Set_ActiveRate
+*   Description: Set active mode report rate
+*   Parameters: rate - report rate in ms (1-14)
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Set_ActiveRate(uint8_t rate)
+{
+    if (rate > 14)
+        rate = 14;
+    FT6236_IIC_WriteREG(FT6236_REG_PERIODACTIVE, rate);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Set_MonitorRate
+*   Description: Set monitor mode report rate
+*   Parameters: rate - report rate in ms (10-100)
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Set_MonitorRate(uint8_t rate)
+{
+    if (rate < 10)
+        rate = 10;
+    if (rate > 100)
+        rate = 100;
+    FT6236_IIC_WriteREG(FT6236_REG_PERIODMONITOR, rate);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Sleep
+*   Description: Put FT6236 into sleep mode
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Sleep(void)
+{
+    FT6236_Set_PowerMode(FT6236_POWER_MODE_HIBERNATE);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Wakeup
+*   Description: Wake up FT6236 from sleep
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_Wakeup(void)
+{
+    FT6236_RESET();
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_IRQ_Handler
+*   Description: INT pin falling edge: read the report and queue it as an event.
+*                A report with no touch point after a touch is queued as a lift.
+*   Parameters: gpio - pin that raised the interrupt
+*               events - GPIO event mask
+*   Return: none
+*********************************************************************************************************
+*/
+static void FT6236_IRQ_Handler(uint gpio, uint32_t events)
+{
+    FT6236_Info info[FT6236_MAX_TOUCH];
+    FT6236_Event *ev;
+    uint8_t head = FT6236_Event_Head;
+
+    (void)events;
+    if (gpio != TOUCH_INT_PIN)
+        return;
+
+    if (FT6236_Read_Touch(info) == 0)
+    {
+        if (FT6236_Event_Last.Touch_Event == FT6236_TOUCH_EVENT_UP)
+            return; // Nothing touched before either
+        info[0].X_Pos = FT6236_Event_Last.X_Pos;
+        info[0].Y_Pos = FT6236_Event_Last.Y_Pos;
+        info[0].Touch_Event = FT6236_TOUCH_EVENT_UP;
+    }
+
+    if ((uint8_t)(head - FT6236_Event_Tail) >= FT6236_EVENT_QUEUE_SIZE)
+        return; // Queue full, the reader is behind: drop this report, Last keeps the queued state
+
+    FT6236_Event_Last.Time_Us = time_us_32();
+    FT6236_Event_Last.X_Pos = info[0].X_Pos;
+    FT6236_Event_Last.Y_Pos = info[0].Y_Pos;
+    FT6236_Event_Last.Touch_Event = info[0].Touch_Event;
+
+    ev = &FT6236_Event_Queue[head & (FT6236_EVENT_QUEUE_SIZE - 1)];
+    *ev = FT6236_Event_Last;
+    __dmb(); // Event contents must be visible before the new head
+    FT6236_Event_Head = head + 1;
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_IRQ_Init
+*   Description: Start interrupt-driven sampling. Each INT pulse (one per report in trigger mode)
+*                reads the controller in the IRQ and queues a timestamped event.
+*                Call from the core that runs the other FT6236 functions.
+*   Parameters: none
+*   Return: none
+*********************************************************************************************************
+*/
+void FT6236_IRQ_Init(void)
+{
+    gpio_init(TOUCH_INT_PIN);
+    gpio_set_dir(TOUCH_INT_PIN, GPIO_IN);
+    gpio_pull_up(TOUCH_INT_PIN);
+
+    FT6236_Event_Head = 0;
+    FT6236_Event_Tail = 0;
+    FT6236_Event_Last.Touch_Event = FT6236_TOUCH_EVENT_UP;
+    FT6236_IRQ_Enabled = true;
+    gpio_set_irq_enabled_with_callback(TOUCH_INT_PIN, GPIO_IRQ_EDGE_FALL, true, &FT6236_IRQ_Handler);
+}
+
+/*
+*********************************************************************************************************
+*   Function: FT6236_Get_Event
+*   Description: Take the oldest queued touch event, never blocks
+*   Parameters: event - receives the event
+*   Return: true if an event was returned, false if the queue is empty
+*********************************************************************************************************
+*/
+bool FT6236_Get_Event(FT6236_Event *event)
+{
+    uint8_t tail = FT6236_Event_Tail;
+
+    if (tail == FT6236_Event_Head)
+        return false;
+    __dmb(); // Read the contents only after seeing the new head
+    *event = FT6236_Event_Queue[tail & (FT6236_EVENT_QUEUE_SIZE - 1)];
+    __dmb();
+    FT6236_Event_Tail = tail + 1;
+    return true;
+}
+
+#endif
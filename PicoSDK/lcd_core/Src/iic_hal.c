@@ -1,10 +1,54 @@
 #include "Inc/iic_hal.h"
+#include "Inc/lcd_init.h"
 #include "pico/stdlib.h"
+#include <string.h>
 
-#define IIC_DELAY 2
+#if LCD_TOUCH == LCD_TOUCH_CST816
+#define IIC_DELAY 5 // CST816 needs the slower bit-banged clock
+#else
+#define IIC_DELAY 2 // Busy-wait, the touch driver also runs these from its GPIO IRQ
+#endif
+
+#define IIC_HW_TIMEOUT_US 2000 // Per transfer, a missing device must not hang the caller
+
+/*
+ * The I2C block can only drive a pin pair GPIO 2n (SDA) / 2n+1 (SCL);
+ * pairs 0-1, 4-5, ... belong to i2c0, 2-3, 6-7, ... to i2c1.
+ */
+static i2c_inst_t *IIC_HW_Instance(const iic_bus_t *bus)
+{
+    if (bus->baudrate == 0)
+        return NULL;
+    if ((bus->sda_pin & 1) || bus->scl_pin != bus->sda_pin + 1 || bus->scl_pin >= NUM_BANK0_GPIOS)
+        return NULL;
+    return (bus->sda_pin & 2) ? i2c1 : i2c0;
+}
+
+static uint8_t IIC_HW_Read(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr, uint8_t len, uint8_t *buf)
+{
+    // Repeated start between register address and data, like the bit-banged path
+    if (i2c_write_timeout_us(bus->i2c, dev_addr, &reg_addr, 1, true, IIC_HW_TIMEOUT_US) != 1 ||
+        i2c_read_timeout_us(bus->i2c, dev_addr, buf, len, false, IIC_HW_TIMEOUT_US) != len)
+    {
+        memset(buf, 0xFF, len); // What a bit-banged read returns with nobody driving SDA
+        return 1;
+    }
+    return 0;
+}
 
 void IICInit(iic_bus_t *bus)
 {
+    bus->i2c = IIC_HW_Instance(bus);
+    if (bus->i2c)
+    {
+        i2c_init(bus->i2c, bus->baudrate);
+        gpio_set_function(bus->sda_pin, GPIO_FUNC_I2C);
+        gpio_set_function(bus->scl_pin, GPIO_FUNC_I2C);
+        gpio_pull_up(bus->sda_pin);
+        gpio_pull_up(bus->scl_pin);
+        return;
+    }
+
     gpio_init(bus->sda_pin);
     gpio_set_function(bus->sda_pin, GPIO_FUNC_SIO);
     gpio_set_dir(bus->sda_pin, GPIO_OUT);
@@ -21,9 +65,9 @@ void IICStart(iic_bus_t *bus)
 {
     gpio_put(bus->sda_pin, 1);
     gpio_put(bus->scl_pin, 1);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->sda_pin, 0);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 0);
 }
 
@@ -31,11 +75,11 @@ void IICStop(iic_bus_t *bus)
 {
     gpio_put(bus->scl_pin, 0);
     gpio_put(bus->sda_pin, 0);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 1);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->sda_pin, 1);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
 }
 
 uint8_t IICWaitAck(iic_bus_t *bus)
@@ -43,7 +87,7 @@ uint8_t IICWaitAck(iic_bus_t *bus)
     uint16_t ucErrTime = 0XFFF;
     gpio_put(bus->scl_pin, 0);
     gpio_set_dir(bus->sda_pin, GPIO_IN);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 1);
 
     while (gpio_get(bus->sda_pin))
@@ -56,7 +100,7 @@ uint8_t IICWaitAck(iic_bus_t *bus)
             return 1;
         }
     }
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 0);
     gpio_put(bus->sda_pin, 1);
     gpio_set_dir(bus->sda_pin, GPIO_OUT);
@@ -68,9 +112,9 @@ void IICAck(iic_bus_t *bus)
     gpio_put(bus->scl_pin, 0);
     gpio_set_dir(bus->sda_pin, GPIO_OUT);
     gpio_put(bus->sda_pin, 0);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 1);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 0);
 }
 
@@ -79,11 +123,11 @@ void IICNAck(iic_bus_t *bus)
     gpio_put(bus->scl_pin, 0);
     gpio_set_dir(bus->sda_pin, GPIO_OUT);
     gpio_put(bus->sda_pin, 0);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->sda_pin, 1);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 1);
-    sleep_us(IIC_DELAY);
+    busy_wait_us_32(IIC_DELAY);
     gpio_put(bus->scl_pin, 0);
 }
 
@@ -94,13 +138,13 @@ void IICSendByte(iic_bus_t *bus, uint8_t txd)
     for (t = 0; t < 8; t++)
     {
         gpio_put(bus->scl_pin, 0);
-        sleep_us(IIC_DELAY);
+        busy_wait_us_32(IIC_DELAY);
         if (txd & 0x80)
             gpio_put(bus->sda_pin, 1);
         else
             gpio_put(bus->sda_pin, 0);
         gpio_put(bus->scl_pin, 1);
-        sleep_us(IIC_DELAY);
+        busy_wait_us_32(IIC_DELAY);
         txd <<= 1;
     }
 }
@@ -114,13 +158,13 @@ uint8_t IICRecvByte(iic_bus_t *bus)
     {
         receive <<= 1;
         gpio_put(bus->scl_pin, 0);
-        sleep_us(IIC_DELAY);
+        busy_wait_us_32(IIC_DELAY);
         gpio_put(bus->scl_pin, 1);
 
         if (gpio_get(bus->sda_pin))
             receive|=0x01;
 
-        sleep_us(IIC_DELAY);
+        busy_wait_us_32(IIC_DELAY);
     }
 
     return receive;
@@ -130,6 +174,12 @@ uint8_t IIC_Read_One_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr)
 {
     uint8_t res;
 
+    if (bus->i2c)
+    {
+        IIC_HW_Read(bus, dev_addr, reg_addr, 1, &res);
+        return res;
+    }
+
     IICStart(bus);
     IICSendByte(bus, dev_addr << 1);
     IICWaitAck(bus);
@@ -148,6 +198,13 @@ uint8_t IIC_Read_One_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr)
 
 void IIC_Write_One_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr, uint8_t dat)
 {
+    if (bus->i2c)
+    {
+        uint8_t data[2] = {reg_addr, dat};
+        i2c_write_timeout_us(bus->i2c, dev_addr, data, 2, false, IIC_HW_TIMEOUT_US);
+        return;
+    }
+
     IICStart(bus);
     IICSendByte(bus, dev_addr << 1);
     IICWaitAck(bus);
@@ -160,6 +217,13 @@ void IIC_Write_One_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr, uint
 
 void IIC_Read_Multi_Byte(iic_bus_t *bus, uint8_t dev_addr, uint8_t reg_addr, uint8_t len, uint8_t *buf)
 {
+    if (bus->i2c)
+    {
+        if (len)
+            IIC_HW_Read(bus, dev_addr, reg_addr, len, buf);
+        return;
+    }
+
     IICStart(bus);
     IICSendByte(bus, dev_addr << 1);
     IICWaitAck(bus);
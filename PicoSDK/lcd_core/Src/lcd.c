@@ -0,0 +1,1711 @@
+#include "Inc/lcd.h"
+#include "Inc/lcd_init.h"
+#include "Inc/lcdfont.h"
+#include "Inc/lcdfont_index.h"
+#include "Inc/lcdfont_aa.h"
+#include "Inc/lcdfont_prop.h"
+#include <stdlib.h>
+#include "hardware/spi.h"
+#include "Inc/lcd_dma.h"
+
+#define MAX_ALLOWED_DISTANCE 50 // 
+#define LCD_NUM_BUF 16			// ʾʱÿתַ
+
+#if USE_FRAMEBUFFER && !PICO_RP2350 && LCD_W * LCD_H > 240 * 320
+#error "USE_FRAMEBUFFER needs 300KB for a 320x480 RGB565 frame, RP2040 only has 264KB RAM; use lcd_band.h instead"
+#endif
+
+#if USE_FRAMEBUFFER
+uint16_t LCD_FrameBuffer[LCD_W * LCD_H]; // RGB565֡,ͼֻдRAM,LCD_Present()
+
+#define LCD_DIRTY_MAX 8 // ͬʱ¼
+#define LCD_DIRTY_GAP 8 // ֱӺϲ,ٴô
+
+typedef struct
+{
+	uint16_t x1, y1, x2, y2;
+} LCD_Rect;
+
+static LCD_Rect lcd_dirty[LCD_DIRTY_MAX] = {{0, 0, LCD_W - 1, LCD_H - 1}}; // ϵҪˢ
+static uint8_t lcd_dirty_num = 1;
+
+/******************************************************************************
+	  ˵֡Ҫˢµ
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+	  ֵ  
+	  ˵    صڵĺϲΪһӾ;ʱ
+				ϲٵϲ
+******************************************************************************/
+void LCD_Invalidate(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	LCD_Rect r;
+	uint8_t i, best;
+	uint32_t grow, best_grow;
+
+	if (x2 >= LCD_W)
+		x2 = LCD_W - 1; // üĻΧ
+	if (y2 >= LCD_H)
+		y2 = LCD_H - 1;
+	if (x1 > x2 || y1 > y2)
+		return;
+
+	for (i = 0; i < lcd_dirty_num; i++) // ѱȫ,㻭ʱ
+	{
+		if (x1 >= lcd_dirty[i].x1 && x2 <= lcd_dirty[i].x2 && y1 >= lcd_dirty[i].y1 && y2 <= lcd_dirty[i].y2)
+			return;
+	}
+
+	r.x1 = x1;
+	r.y1 = y1;
+	r.x2 = x2;
+	r.y2 = y2;
+	i = 0;
+	while (i < lcd_dirty_num)
+	{
+		LCD_Rect *d = &lcd_dirty[i];
+		if (r.x1 <= d->x2 + LCD_DIRTY_GAP && d->x1 <= r.x2 + LCD_DIRTY_GAP &&
+			r.y1 <= d->y2 + LCD_DIRTY_GAP && d->y1 <= r.y2 + LCD_DIRTY_GAP)
+		{
+			// ϲཻ,ȡͷٲ
+			r.x1 = (d->x1 < r.x1) ? d->x1 : r.x1;
+			r.y1 = (d->y1 < r.y1) ? d->y1 : r.y1;
+			r.x2 = (d->x2 > r.x2) ? d->x2 : r.x2;
+			r.y2 = (d->y2 > r.y2) ? d->y2 : r.y2;
+			*d = lcd_dirty[--lcd_dirty_num];
+			i = 0;
+			continue;
+		}
+		i++;
+	}
+
+	if (lcd_dirty_num == LCD_DIRTY_MAX)
+	{
+		best = 0;
+		best_grow = 0xFFFFFFFF;
+		for (i = 0; i < lcd_dirty_num; i++)
+		{
+			LCD_Rect *d = &lcd_dirty[i];
+			uint32_t w = ((d->x2 > r.x2) ? d->x2 : r.x2) - ((d->x1 < r.x1) ? d->x1 : r.x1) + 1;
+			uint32_t h = ((d->y2 > r.y2) ? d->y2 : r.y2) - ((d->y1 < r.y1) ? d->y1 : r.y1) + 1;
+			grow = w * h - (uint32_t)(d->x2 - d->x1 + 1) * (d->y2 - d->y1 + 1);
+			if (grow < best_grow)
+			{
+				best_grow = grow;
+				best = i;
+			}
+		}
+		LCD_Rect *d = &lcd_dirty[best];
+		d->x1 = (d->x1 < r.x1) ? d->x1 : r.x1;
+		d->y1 = (d->y1 < r.y1) ? d->y1 : r.y1;
+		d->x2 = (d->x2 > r.x2) ? d->x2 : r.x2;
+		d->y2 = (d->y2 > r.y2) ? d->y2 : r.y2;
+		return;
+	}
+	lcd_dirty[lcd_dirty_num++] = r;
+}
+#endif
+
+/******************************************************************************
+	  ˵ָɫ
+	  ݣxsta,ysta   ʼ
+				xend,yend   ֹ
+								color       Ҫɫ
+	  ֵ  
+******************************************************************************/
+void LCD_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
+{
+#if USE_FRAMEBUFFER
+	uint16_t x, y;
+
+	if (xend >= LCD_W)
+		xend = LCD_W - 1; // üĻΧ
+	if (yend >= LCD_H)
+		yend = LCD_H - 1;
+	LCD_Invalidate(xsta, ysta, xend, yend);
+	for (y = ysta; y <= yend; y++)
+	{
+		uint16_t *line = &LCD_FrameBuffer[y * LCD_W];
+		for (x = xsta; x <= xend; x++)
+			line[x] = color;
+	}
+#else
+	uint32_t pixelCount = (uint32_t)(xend - xsta + 1) * (yend - ysta + 1);
+
+	LCD_Address_Set(xsta, ysta, xend, yend); // ʾΧ
+	if (pixelCount == 1) // ֱд,ʡȥDMA֡ʽл
+	{
+		LCD_WR_DATA(color);
+		return;
+	}
+	LCD_DC_Set();
+
+	// DMAظͬһɫ,,ʱڷ
+	LCD_DMA_Fill(color, pixelCount);
+#endif
+}
+
+/******************************************************************************
+	  ˵ָλû
+	  ݣx,y 
+				color ɫ
+	  ֵ  
+******************************************************************************/
+void LCD_DrawPoint(uint16_t x, uint16_t y, uint16_t color)
+{
+#if USE_FRAMEBUFFER
+	if (x < LCD_W && y < LCD_H)
+	{
+		LCD_FrameBuffer[y * LCD_W + x] = color;
+		LCD_Invalidate(x, y, x, y);
+	}
+#else
+	LCD_Address_Set(x, y, x, y); // ùλ
+	LCD_WR_DATA(color);
+#endif
+}
+
+/******************************************************************************
+	  ˵һ,ȲüĻΧ
+	  ݣx1,y1   ʼ(Ϊ)
+				x2,y2   ֹ(ɳĻ)
+				color   ɫ
+	  ֵ  
+	  ˵    ߡԲͼΰˮƽλֱεñ,ÿֻһδ
+******************************************************************************/
+static void LCD_Fill_Clip(int x1, int y1, int x2, int y2, uint16_t color)
+{
+	if (x1 < 0)
+		x1 = 0;
+	if (y1 < 0)
+		y1 = 0;
+	if (x2 >= LCD_W)
+		x2 = LCD_W - 1;
+	if (y2 >= LCD_H)
+		y2 = LCD_H - 1;
+	if (x1 > x2 || y1 > y2)
+		return;
+	LCD_Fill(x1, y1, x2, y2, color);
+}
+
+/******************************************************************************
+	  ˵ƽ(ȡ)
+	  ݣn 
+	  ֵ  ƽ
+******************************************************************************/
+static uint32_t LCD_Sqrt(uint32_t n)
+{
+	uint32_t root = 0, bit = 1UL << 30;
+
+	while (bit > n)
+		bit >>= 2;
+	while (bit)
+	{
+		if (n >= root + bit)
+		{
+			n -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+			root >>= 1;
+		bit >>= 2;
+	}
+	return root;
+}
+
+/******************************************************************************
+	  ˵ֱ߷ֽΪˮƽλֱ
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+				color   ߵɫ
+				span    һεĺ
+	  ֵ  
+	  ˵    LCD_DrawLinelcd_band.c,߻ȫͬ
+******************************************************************************/
+void LCD_Line_Spans(int x1, int y1, int x2, int y2, uint16_t color, LCD_Span_Func span)
+{
+	int t;
+	int xerr = 0, yerr = 0, delta_x, delta_y, distance;
+	int incx, incy, uRow, uCol;
+	int sRow, sCol, pRow, pCol;
+
+	delta_x = x2 - x1; // 
+	delta_y = y2 - y1;
+	uRow = x1; // 
+	uCol = y1;
+	if (delta_x > 0)
+		incx = 1; // õ
+	else if (delta_x == 0)
+		incx = 0; // ֱ
+	else
+	{
+		incx = -1;
+		delta_x = -delta_x;
+	}
+	if (delta_y > 0)
+		incy = 1;
+	else if (delta_y == 0)
+		incy = 0; // ˮƽ
+	else
+	{
+		incy = -1;
+		delta_y = -delta_y;
+	}
+	if (delta_x > delta_y)
+		distance = delta_x; // ѡȡ
+	else
+		distance = delta_y;
+	sRow = uRow; // ǰֱ߶ε
+	sCol = uCol;
+	for (t = 0; t < distance + 1; t++)
+	{
+		pRow = uRow; // ĵ
+		pCol = uCol;
+		xerr += delta_x;
+		yerr += delta_y;
+		if (xerr > distance)
+		{
+			xerr -= distance;
+			uRow += incx;
+		}
+		if (yerr > distance)
+		{
+			yerr -= distance;
+			uCol += incy;
+		}
+		// һ뿪ǰˮƽ(xΪ)ֱ(yΪ)ʱ,һ
+		if (t == distance || ((delta_x > delta_y) ? (uCol != pCol) : (uRow != pRow)))
+		{
+			span((sRow < pRow) ? sRow : pRow, (sCol < pCol) ? sCol : pCol,
+				 (sRow > pRow) ? sRow : pRow, (sCol > pCol) ? sCol : pCol, color);
+			sRow = uRow;
+			sCol = uCol;
+		}
+	}
+}
+
+/******************************************************************************
+	  ˵
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+				color   ߵɫ
+	  ֵ  
+******************************************************************************/
+void LCD_DrawLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+#if USE_FRAMEBUFFER
+	LCD_Invalidate((x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, (x1 > x2) ? x1 : x2, (y1 > y2) ? y1 : y2); // һα
+#endif
+	LCD_Line_Spans(x1, y1, x2, y2, color, LCD_Fill_Clip);
+}
+
+// ݴרв
+// ˮƽ
+// x0,y0:
+// len:߳
+// color:ɫ
+void gui_draw_hline(uint16_t x0, uint16_t y0, uint16_t len, uint16_t color)
+{
+	if (len == 0)
+		return;
+	LCD_Fill_Clip((int16_t)x0, y0, (int16_t)x0 + len - 1, y0, color);
+}
+
+void gui_fill_circle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color)
+{
+	uint32_t i;
+	uint32_t imax = (r * 724) >> 10; // r * 707/1000  r * 724/1024
+	uint32_t sqmax = r * r + (r >> 1);
+	uint32_t x = r;
+	uint32_t i_squared = 1; // 1^2 = 1
+
+	gui_draw_hline(x0 - r, y0, 2 * r, color);
+
+	for (i = 1; i < imax + 1; i++)
+	{
+		if ((i_squared + x * x) > sqmax)
+		{
+			if (x > imax)
+			{
+				gui_draw_hline(x0 - i + 1, y0 + x, 2 * (i - 1), color);
+				gui_draw_hline(x0 - i + 1, y0 - x, 2 * (i - 1), color);
+			}
+			x--;
+		}
+		// ڲ
+		gui_draw_hline(x0 - x, y0 + i, 2 * x, color);
+		gui_draw_hline(x0 - x, y0 - i, 2 * x, color);
+
+		i_squared += (i << 1) + 1; // һiƽ
+	}
+}
+
+/******************************************************************************
+	  ˵͹ı
+	  ݣpx,py   ĸ(˳)
+				color   ɫ
+	  ֵ  
+	  ˵    ֵ߽,ÿһˮƽ
+******************************************************************************/
+static void LCD_FillQuad(const int px[4], const int py[4], uint16_t color)
+{
+	int i, y, ymin = py[0], ymax = py[0];
+
+	for (i = 1; i < 4; i++)
+	{
+		if (py[i] < ymin)
+			ymin = py[i];
+		if (py[i] > ymax)
+			ymax = py[i];
+	}
+	for (y = ymin; y <= ymax; y++)
+	{
+		int xl = 0x7FFF, xr = -0x7FFF;
+		for (i = 0; i < 4; i++)
+		{
+			int xa = px[i], ya = py[i];
+			int xb = px[(i + 1) & 3], yb = py[(i + 1) & 3];
+			int x;
+			if ((y < ya && y < yb) || (y > ya && y > yb))
+				continue; // ñཻ߲
+			if (ya == yb)
+			{
+				if (xa < xl)
+					xl = xa;
+				if (xb < xl)
+					xl = xb;
+				if (xa > xr)
+					xr = xa;
+				if (xb > xr)
+					xr = xb;
+				continue;
+			}
+			x = xa + (y - ya) * (xb - xa) / (yb - ya);
+			if (x < xl)
+				xl = x;
+			if (x > xr)
+				xr = x;
+		}
+		if (xl <= xr)
+			LCD_Fill_Clip(xl, y, xr, y, color);
+	}
+}
+
+/******************************************************************************
+	  ˵
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+				color   ߵɫ
+				size ߵĿ()
+	  ֵ  
+	  ˵    Ϊط߷ƫsizeı,˸һ뾶ΪsizeԲ,
+				ȫˮƽ
+******************************************************************************/
+void LCD_DrawThickLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color, uint8_t size)
+{
+	if (size == 1)
+	{
+		LCD_DrawLine(x1, y1, x2, y2, color);
+		return;
+	}
+
+	// ٱ߽
+	if (x1 < size || x2 < size || y1 < size || y2 < size)
+		return;
+
+	int16_t dx = x2 - x1;
+	int16_t dy = y2 - y1;
+
+	// پ飨ƣ
+	uint16_t abs_dx = dx > 0 ? dx : -dx;
+	uint16_t abs_dy = dy > 0 ? dy : -dy;
+	if ((abs_dx > MAX_ALLOWED_DISTANCE) || (abs_dy > MAX_ALLOWED_DISTANCE))
+	{
+		return;
+	}
+
+	uint32_t len = LCD_Sqrt((uint32_t)(dx * dx + dy * dy));
+	if (len > 0)
+	{
+		// ߷ƫ,
+		int ox = (-dy * size * 2 + ((dy > 0) ? -(int)len : (int)len)) / (int)(2 * len);
+		int oy = (dx * size * 2 + ((dx > 0) ? (int)len : -(int)len)) / (int)(2 * len);
+		int px[4] = {x1 + ox, x2 + ox, x2 - ox, x1 - ox};
+		int py[4] = {y1 + oy, y2 + oy, y2 - oy, y1 - oy};
+		LCD_FillQuad(px, py, color);
+	}
+	gui_fill_circle(x1, y1, size, color); // Բζ˵
+	gui_fill_circle(x2, y2, size, color);
+}
+
+void DrawThickLine(int x0, int y0, int x1, int y1, int thickness, uint16_t color)
+{
+	// ߽
+	if (x0 < 0)
+		x0 = 0;
+	if (y0 < 0)
+		y0 = 0;
+	if (x1 < 0)
+		x1 = 0;
+	if (y1 < 0)
+		y1 = 0;
+	if (x0 >= SCREEN_WIDTH)
+		x0 = SCREEN_WIDTH - 1;
+	if (y0 >= SCREEN_HEIGHT)
+		y0 = SCREEN_HEIGHT - 1;
+	if (x1 >= SCREEN_WIDTH)
+		x1 = SCREEN_WIDTH - 1;
+	if (y1 >= SCREEN_HEIGHT)
+		y1 = SCREEN_HEIGHT - 1;
+
+	// 򻯰߻
+	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+	int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+	int err = dx + dy, e2;
+
+	for (;;)
+	{
+		// ֵ:һ,ĻĲֲõ
+		LCD_Fill_Clip(x0 - thickness, y0 - thickness, x0 + thickness, y0 + thickness, color);
+
+		if (x0 == x1 && y0 == y1)
+			break;
+		e2 = 2 * err;
+		if (e2 >= dy)
+		{
+			err += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx)
+		{
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+/******************************************************************************
+	  ˵
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+				color   εɫ
+	  ֵ  
+******************************************************************************/
+void LCD_DrawRectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+	LCD_Fill_Clip((x1 < x2) ? x1 : x2, y1, (x1 > x2) ? x1 : x2, y1, color); // ߸һ
+	LCD_Fill_Clip((x1 < x2) ? x1 : x2, y2, (x1 > x2) ? x1 : x2, y2, color);
+	LCD_Fill_Clip(x1, (y1 < y2) ? y1 : y2, x1, (y1 > y2) ? y1 : y2, color);
+	LCD_Fill_Clip(x2, (y1 < y2) ? y1 : y2, x2, (y1 > y2) ? y1 : y2, color);
+}
+
+/******************************************************************************
+	  ˵Բϰ˸Գλõһ
+	  ݣx0,y0   Բ
+				a1,a2   һaֵֹ,bͬ
+				b       öεԲĵľ
+				color   Բɫ
+				span    һεĺ
+	  ֵ  
+******************************************************************************/
+static void Draw_Circle_Runs(int x0, int y0, int a1, int a2, int b, uint16_t color, LCD_Span_Func span)
+{
+	span(x0 + a1, y0 - b, x0 + a2, y0 - b, color); // Ϊˮƽ
+	span(x0 - a2, y0 - b, x0 - a1, y0 - b, color);
+	span(x0 + a1, y0 + b, x0 + a2, y0 + b, color);
+	span(x0 - a2, y0 + b, x0 - a1, y0 + b, color);
+	span(x0 - b, y0 + a1, x0 - b, y0 + a2, color); // Ϊֱ
+	span(x0 - b, y0 - a2, x0 - b, y0 - a1, color);
+	span(x0 + b, y0 + a1, x0 + b, y0 + a2, color);
+	span(x0 + b, y0 - a2, x0 + b, y0 - a1, color);
+}
+
+/******************************************************************************
+	  ˵ԲֽܷΪˮƽκʹֱ
+	  ݣx0,y0   Բ
+				r       뾶
+				color   Բɫ
+				span    һεĺ
+	  ֵ  
+	  ˵    bϲΪһ;Draw_Circlelcd_band.c
+******************************************************************************/
+void LCD_Circle_Spans(int x0, int y0, int r, uint16_t color, LCD_Span_Func span)
+{
+	int a, b, na, nb, as;
+	a = 0;
+	b = r;
+	as = 0;
+	while (a <= b)
+	{
+		na = a + 1;
+		nb = b;
+		if ((na * na + nb * nb) > (r * r)) // жҪĵǷԶ
+		{
+			nb--;
+		}
+		if (nb != b || na > nb) // bҪ仯,ǰ
+		{
+			Draw_Circle_Runs(x0, y0, as, a, b, color, span);
+			as = na;
+		}
+		a = na;
+		b = nb;
+	}
+}
+
+/******************************************************************************
+	  ˵Բ
+	  ݣx0,y0   Բ
+				r       뾶
+				color   Բɫ
+	  ֵ  
+******************************************************************************/
+void Draw_Circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+	LCD_Circle_Spans(x0, y0, r, color, LCD_Fill_Clip);
+}
+
+/******************************************************************************
+	  ˵ںвģ
+	  ݣs ֵGB2312(2ֽ)
+				font ֺ 0:12 1:16 2:24 3:32
+	  ֵ  ģtfont12/16/24/32е±,ûиʱLCD_GB_NONE
+	  ˵    lcd_gb_indextools/gen_gb_index.pyź,ֲ,
+				ֿٴÿҲֻȽlog2(n)
+******************************************************************************/
+static uint16_t LCD_GB_Find(const uint8_t *s, uint8_t font)
+{
+	uint16_t code = (uint16_t)(s[0] << 8 | s[1]);
+	int16_t lo = 0, hi = sizeof(lcd_gb_index) / sizeof(lcd_gb_index[0]) - 1;
+
+	while (lo <= hi)
+	{
+		int16_t mid = (lo + hi) / 2;
+		if (lcd_gb_index[mid].Code == code)
+			return lcd_gb_index[mid].Slot[font];
+		if (lcd_gb_index[mid].Code < code)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+	return LCD_GB_NONE;
+}
+
+/******************************************************************************
+	  ˵ֺתΪ
+	  ݣsizey ֺ 12 16 24 32
+	  ֵ  0~3,ֵֺ֧ŷ-1
+******************************************************************************/
+static int8_t LCD_Font_Slot(uint8_t sizey)
+{
+	switch (sizey)
+	{
+	case 12:
+		return 0;
+	case 16:
+		return 1;
+	case 24:
+		return 2;
+	case 32:
+		return 3;
+	default:
+		return -1;
+	}
+}
+
+// ASCII,ģ' 'ʼ
+static const LCD_Font lcd_font_ascii[4] = {
+	{6, 12, 1, 1, 0, sizeof(ascii_1206[0]), ascii_1206[0], -1, NULL},
+	{8, 16, 1, 1, 0, sizeof(ascii_1608[0]), ascii_1608[0], -1, NULL},
+	{12, 24, 2, 1, 0, sizeof(ascii_2412[0]), ascii_2412[0], -1, NULL},
+	{16, 32, 2, 1, 0, sizeof(ascii_3216[0]), ascii_3216[0], -1, NULL},
+};
+
+// ú,ÿģǰ2ֽ,±LCD_GB_Find
+static const LCD_Font lcd_font_gb[4] = {
+	{12, 12, 2, 1, 0, sizeof(typFNT_GB12), tfont12[0].Msk, 0, NULL},
+	{16, 16, 2, 1, 0, sizeof(typFNT_GB16), tfont16[0].Msk, 1, NULL},
+	{24, 24, 3, 1, 0, sizeof(typFNT_GB24), tfont24[0].Msk, 2, NULL},
+	{32, 32, 4, 1, 0, sizeof(typFNT_GB32), tfont32[0].Msk, 3, NULL},
+};
+
+#if USE_FRAMEBUFFER
+typedef uint16_t LCD_Draw_Pixel; // ģͼƬֱչRGB565֡
+#define LCD_Draw_Color(color) (color)
+#else
+typedef LCD_Pixel LCD_Draw_Pixel; // ģͼƬչл,Ļظʽ,DMAз
+#define LCD_Draw_Color(color) LCD_Pixel_Color(color)
+
+static LCD_Pixel lcd_text_line[2][LCD_W]; // ģַͼƬõл,һзʱչһ
+#endif
+
+/******************************************************************************
+	  ˵ͼƬеһתΪLCD_Draw_Pixel
+	  ݣp ,ֽǰ
+				size ÿֽ 2:RGB565 3:RGB666
+	  ֵ  ת
+******************************************************************************/
+static inline LCD_Draw_Pixel LCD_Draw_Bytes(const uint8_t *p, uint8_t size)
+{
+#if !USE_FRAMEBUFFER && LCD_PIXEL_BYTES == 3
+	if (size == 3)
+	{
+		LCD_Pixel c = {p[0], p[1], p[2]};
+		return c;
+	}
+	return LCD_Pixel_Color((p[0] << 8) | p[1]);
+#else
+	return (size == 3) ? RGB(p[0], p[1], p[2]) : (p[0] << 8) | p[1];
+#endif
+}
+
+/******************************************************************************
+	  ˵ҶȻɫ
+	  ݣfc ֵɫ
+				bc ɫ
+				a Ҷȵȼ,0Ϊbc,nΪfc
+				n Ҷȵȼ
+	  ֵ  ϺRGB565ɫ
+******************************************************************************/
+static uint16_t LCD_Blend(uint16_t fc, uint16_t bc, uint8_t a, uint8_t n)
+{
+	uint16_t r = (((fc >> 11) & 0x1F) * a + ((bc >> 11) & 0x1F) * (n - a) + n / 2) / n;
+	uint16_t g = (((fc >> 5) & 0x3F) * a + ((bc >> 5) & 0x3F) * (n - a) + n / 2) / n;
+	uint16_t b = ((fc & 0x1F) * a + (bc & 0x1F) * (n - a) + n / 2) / n;
+	return (r << 11) | (g << 5) | b;
+}
+
+/******************************************************************************
+	  ˵ɫ
+	  ݣlut ,16,LCD_Draw_Pixel
+				font 
+				fc ֵɫ
+				bc ֵıɫ
+	  ֵ  
+	  ˵    ÿʾֻһ,ɫ2,Ҷ416,
+				չģʱҶȵȼֱӲ,
+******************************************************************************/
+static void LCD_Font_LUT(LCD_Draw_Pixel *lut, const LCD_Font *font, uint16_t fc, uint16_t bc)
+{
+	uint8_t i, n = (1 << font->bpp) - 1;
+
+	for (i = 0; i <= n; i++)
+		lut[i] = LCD_Draw_Color(LCD_Blend(fc, bc, i, n));
+}
+
+/******************************************************************************
+	  ˵ȡģһĳһĻҶȵȼ
+	  ݣfont 
+				src ģ
+				col к
+	  ֵ  0~(1<<bpp)-1,ɫΪ01
+******************************************************************************/
+static inline uint8_t LCD_Glyph_Level(const LCD_Font *font, const uint8_t *src, uint16_t col)
+{
+	if (!font->msb_first)
+		return (src[col >> 3] >> (col & 7)) & 1;
+	col *= font->bpp;
+	return (src[col >> 3] >> (8 - font->bpp - (col & 7))) & ((1 << font->bpp) - 1);
+}
+
+/******************************************************************************
+	  ˵һģչΪ
+	  ݣdst 
+				font 
+				src ģ
+				w п()
+				lut LCD_Font_LUTɵɫ
+	  ֵ  
+******************************************************************************/
+static inline void LCD_Glyph_Row(LCD_Draw_Pixel *dst, const LCD_Font *font, const uint8_t *src, uint16_t w, const LCD_Draw_Pixel *lut)
+{
+	uint16_t i;
+	uint8_t bits = 0, left = 0;
+	uint8_t bpp = font->bpp;
+
+	if (!font->msb_first) // ɫģ,ֽڵλ
+	{
+		for (i = 0; i < w; i++, bits >>= 1)
+		{
+			if ((i & 7) == 0)
+				bits = *src++;
+			dst[i] = lut[bits & 0x01];
+		}
+		return;
+	}
+	for (i = 0; i < w; i++, bits <<= bpp, left -= bpp)
+	{
+		if (left == 0)
+		{
+			bits = *src++;
+			left = 8;
+		}
+		dst[i] = lut[bits >> (8 - bpp)];
+	}
+}
+
+/******************************************************************************
+	  ˵ģʽʾһģ
+	  ݣx,yʾ
+				font 
+				glyph ģ׵ַ
+				fc ֵɫ
+	  ֵ  
+	  ˵    ÿвɶˮƽ,ÿһδд,
+				õַ,Ҷȡĵ;֡ģʽֱӸд֡,
+				Ҷ֡ԭɫ,ֻһ
+******************************************************************************/
+static void LCD_Glyph_Overlay(uint16_t x, uint16_t y, const LCD_Font *font, const uint8_t *glyph, uint16_t fc)
+{
+	uint16_t row, col;
+	uint8_t n = (1 << font->bpp) - 1;
+
+#if USE_FRAMEBUFFER
+	uint16_t w = font->width, h = font->height;
+
+	if (x >= LCD_W || y >= LCD_H)
+		return;
+	if (x + w > LCD_W)
+		w = LCD_W - x; // üĻΧ
+	if (y + h > LCD_H)
+		h = LCD_H - y;
+	LCD_Invalidate(x, y, x + w - 1, y + h - 1);
+	for (row = 0; row < h; row++, glyph += font->stride)
+	{
+		uint16_t *line = &LCD_FrameBuffer[(y + row) * LCD_W + x];
+		for (col = 0; col < w; col++)
+		{
+			uint8_t a = LCD_Glyph_Level(font, glyph, col);
+			if (a == n)
+				line[col] = fc;
+			else if (a)
+				line[col] = LCD_Blend(fc, line[col], a, n);
+		}
+	}
+#else
+	for (row = 0; row < font->height; row++, glyph += font->stride)
+	{
+		for (col = 0; col < font->width; col++)
+		{
+			uint16_t start = col;
+
+			if (LCD_Glyph_Level(font, glyph, col) * 2 <= n)
+				continue;
+			while (col + 1 < font->width && LCD_Glyph_Level(font, glyph, col + 1) * 2 > n)
+				col++;
+			LCD_Fill_Clip(x + start, y + row, x + col, y + row, fc); // һֻһδ
+		}
+	}
+#endif
+}
+
+/******************************************************************************
+	  ˵ʾһģ
+	  ݣx,yʾ
+				font 
+				glyph ģ׵ַ
+				fc ֵɫ
+				bc ֵıɫ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+	  ˵    ǵģʽÿչлDMAз,л彻ʹ,
+				չһʱһڷ;֡ģʽֱչ֡.
+				ģʽֻģеǰ,LCD_Glyph_Overlay
+******************************************************************************/
+void LCD_ShowGlyph(uint16_t x, uint16_t y, const LCD_Font *font, const uint8_t *glyph, uint16_t fc, uint16_t bc, uint8_t mode)
+{
+	uint16_t row;
+	LCD_Draw_Pixel lut[16];
+
+	if (font->width > LCD_GLYPH_MAX_W)
+		return;
+
+	if (mode) // ģʽ
+	{
+		LCD_Glyph_Overlay(x, y, font, glyph, fc);
+		return;
+	}
+	LCD_Font_LUT(lut, font, fc, bc);
+
+#if USE_FRAMEBUFFER
+	uint16_t w = font->width, h = font->height;
+
+	if (x >= LCD_W || y >= LCD_H)
+		return;
+	if (x + w > LCD_W)
+		w = LCD_W - x; // üĻΧ
+	if (y + h > LCD_H)
+		h = LCD_H - y;
+	LCD_Invalidate(x, y, x + w - 1, y + h - 1);
+	for (row = 0; row < h; row++, glyph += font->stride)
+		LCD_Glyph_Row(&LCD_FrameBuffer[(y + row) * LCD_W + x], font, glyph, w, lut);
+#else
+	LCD_Address_Set(x, y, x + font->width - 1, y + font->height - 1); // ôʱѵȴDMA,лֱʹ
+	LCD_DC_Set();
+	for (row = 0; row < font->height; row++, glyph += font->stride)
+	{
+		LCD_Glyph_Row(lcd_text_line[row & 1], font, glyph, font->width, lut);
+		LCD_DMA_WritePixels(lcd_text_line[row & 1], font->width); // ȴһDMAٿʼ
+	}
+#endif
+}
+
+/******************************************************************************
+	  ˵ָʾ
+	  ݣx,yʾ
+				*s Ҫʾĺ
+				fc ֵɫ
+				bc ֵıɫ
+				font 
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+******************************************************************************/
+static void LCD_ShowChineseChar(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, const LCD_Font *font, uint8_t mode)
+{
+	uint16_t k = LCD_GB_Find(s, font->gb); // ģ,ֿûʱʾ
+
+	if (k == LCD_GB_NONE)
+		return;
+	LCD_ShowGlyph(x, y, font, font->table + k * font->glyph_size, fc, bc, mode);
+}
+
+/******************************************************************************
+	  ˵ָʾִ
+	  ݣx,yʾ
+				*s Ҫʾĺִ
+				fc ֵɫ
+				bc ֵıɫ
+				font (gbС0)
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+	  ˵    ֿûеĺֲʾ,ռһֿ
+******************************************************************************/
+void LCD_ShowChineseFont(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, const LCD_Font *font, uint8_t mode)
+{
+	if (font->gb < 0)
+		return;
+	while (*s != 0)
+	{
+		LCD_ShowChineseChar(x, y, s, fc, bc, font, mode);
+		s += 2;
+		x += font->width;
+	}
+}
+
+/******************************************************************************
+	  ˵ʾִ
+	  ݣx,yʾ
+				*s Ҫʾĺִ
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ ѡ 16 24 32
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+******************************************************************************/
+void LCD_ShowChinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	int8_t font = LCD_Font_Slot(sizey);
+
+	if (font >= 0)
+		LCD_ShowChineseFont(x, y, s, fc, bc, &lcd_font_gb[font], mode);
+}
+
+/******************************************************************************
+	  ˵ʾ12x12
+	  ݣx,yʾ
+				*s Ҫʾĺ
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ(,ֺɺ)
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+******************************************************************************/
+void LCD_ShowChinese12x12(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	(void)sizey; // ֺɺ,ֻΪݾɽӿ
+	LCD_ShowChineseChar(x, y, s, fc, bc, &lcd_font_gb[0], mode);
+}
+
+/******************************************************************************
+	  ˵ʾ16x16
+	  ݣͬLCD_ShowChinese12x12
+	  ֵ  
+******************************************************************************/
+void LCD_ShowChinese16x16(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	(void)sizey; // ֺɺ,ֻΪݾɽӿ
+	LCD_ShowChineseChar(x, y, s, fc, bc, &lcd_font_gb[1], mode);
+}
+
+/******************************************************************************
+	  ˵ʾ24x24
+	  ݣͬLCD_ShowChinese12x12
+	  ֵ  
+******************************************************************************/
+void LCD_ShowChinese24x24(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	(void)sizey; // ֺɺ,ֻΪݾɽӿ
+	LCD_ShowChineseChar(x, y, s, fc, bc, &lcd_font_gb[2], mode);
+}
+
+/******************************************************************************
+	  ˵ʾ32x32
+	  ݣͬLCD_ShowChinese12x12
+	  ֵ  
+******************************************************************************/
+void LCD_ShowChinese32x32(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	(void)sizey; // ֺɺ,ֻΪݾɽӿ
+	LCD_ShowChineseChar(x, y, s, fc, bc, &lcd_font_gb[3], mode);
+}
+
+/******************************************************************************
+	  ˵ʾַ
+	  ݣx,yʾ
+				num Ҫʾַ
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+******************************************************************************/
+void LCD_ShowChar(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	int8_t font = LCD_Font_Slot(sizey);
+	const LCD_Font *f;
+
+	if (font < 0)
+		return;
+	f = &lcd_font_ascii[font];
+	LCD_ShowGlyph(x, y, f, f->table + (num - ' ') * f->glyph_size, fc, bc, mode); // ģ' 'ʼ
+}
+
+/******************************************************************************
+	  ˵Unicodeλ麺ֵGB2312
+	  ݣu Unicodeλ
+	  ֵ  GB2312,ֽǰ;ֿûиʱ0
+	  ˵    lcd_gb_unicodeֻֿеĺ,tools/gen_gb_index.py
+******************************************************************************/
+static uint16_t LCD_GB_FromUnicode(uint32_t u)
+{
+	int16_t lo = 0, hi = sizeof(lcd_gb_unicode) / sizeof(lcd_gb_unicode[0]) - 1;
+
+	while (lo <= hi)
+	{
+		int16_t mid = (lo + hi) / 2;
+		if (lcd_gb_unicode[mid].Unicode == u)
+			return lcd_gb_unicode[mid].Code;
+		if (lcd_gb_unicode[mid].Unicode < u)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ȡUTF-8ַеһַ
+	  ݣ*s ַǰλ,ʱָһַ
+	  ֵ  ַUnicodeλ
+	  ˵    Ƿıճ,صλֿв鲻
+******************************************************************************/
+static uint32_t LCD_UTF8_Next(const uint8_t **s)
+{
+	const uint8_t *p = *s;
+	uint32_t u = *p++;
+	uint8_t n = 0;
+
+	if (u >= 0xF0) // ֽڸֽ
+		n = 3;
+	else if (u >= 0xE0)
+		n = 2;
+	else if (u >= 0xC0)
+		n = 1;
+	if (n > 0)
+		u &= 0x7F >> (n + 1); // ȥֽеĳλ
+	while (n > 0 && (*p & 0xC0) == 0x80)
+	{
+		u = u << 6 | (*p++ & 0x3F);
+		n--;
+	}
+	*s = p;
+	return u;
+}
+
+/******************************************************************************
+	  ˵ʾUTF-8ӢĻַ
+	  ݣx,yʾ
+				*s Ҫʾַ(UTF-8)
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ ѡ 12 16 24 32
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+	  ˵    ASCIIַsizey/2,ASCIIַLCD_ShowStringFontʾ;
+				ַsizey,תGB2312麺ֿ,ֿûеĲʾ,
+				ռһֿ.MicroPythonUTF-8ַĵʹ
+******************************************************************************/
+void LCD_ShowUTF8(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	int8_t font = LCD_Font_Slot(sizey);
+	uint8_t run[33];
+
+	if (font < 0)
+		return;
+	while (*s != 0)
+	{
+		uint8_t n = 0;
+		uint16_t code;
+		uint8_t gb[2];
+
+		while (*s != 0 && *s < 0x80 && n < sizeof(run) - 1) // һASCIIַ,ַոʾ
+		{
+			run[n++] = (*s < ' ' || *s > '~') ? ' ' : *s;
+			s++;
+		}
+		if (n > 0)
+		{
+			run[n] = 0;
+			LCD_ShowStringFont(x, y, run, fc, bc, &lcd_font_ascii[font], mode);
+			x += n * lcd_font_ascii[font].width;
+			continue;
+		}
+		code = LCD_GB_FromUnicode(LCD_UTF8_Next(&s));
+		gb[0] = code >> 8;
+		gb[1] = code & 0xFF;
+		if (code != 0)
+			LCD_ShowChineseChar(x, y, gb, fc, bc, &lcd_font_gb[font], mode);
+		x += lcd_font_gb[font].width;
+	}
+}
+
+/******************************************************************************
+	  ˵ȡASCIIһַģ
+	  ݣfont 
+				c ַ
+				g ַģϢ
+	  ֵ  ģ׵ַ
+	  ˵    ȿģϢָֿ;ûеַո
+******************************************************************************/
+static const uint8_t *LCD_Font_Char(const LCD_Font *font, uint8_t c, LCD_Glyph *g)
+{
+	if (font->glyphs)
+	{
+		if (c < ' ' || c > '~')
+			c = ' ';
+		*g = font->glyphs[c - ' '];
+		return font->table + g->offset;
+	}
+	g->offset = (c - ' ') * font->glyph_size; // ģ' 'ʼ
+	g->width = font->width;
+	g->height = font->height;
+	g->x_off = 0;
+	g->y_off = 0;
+	g->advance = font->width;
+	return font->table + g->offset;
+}
+
+/******************************************************************************
+	  ˵ַʾ
+	  ݣ*p ַ
+				font ASCII
+	  ֵ  ַǰ֮(),ʾκ
+******************************************************************************/
+uint16_t LCD_MeasureString(const uint8_t *p, const LCD_Font *font)
+{
+	uint16_t w = 0;
+	LCD_Glyph g;
+
+	if (font->gb >= 0)
+		return 0;
+	while (*p != '\0')
+	{
+		LCD_Font_Char(font, *p++, &g);
+		w += g.advance;
+	}
+	return w;
+}
+
+/******************************************************************************
+	  ˵ʾһַ
+	  ݣx,yʾ
+				font ,õheightbpp
+				g ַģϢ(offset)
+				src ģ׵ַ
+				fc ֵɫ
+				bc ֵıɫ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  ַǰ
+	  ˵    ǵģʽñɫַ,ֻģӾ.
+				ģRAMflash(lcd_fontblob.c)
+******************************************************************************/
+uint8_t LCD_ShowGlyphBox(uint16_t x, uint16_t y, const LCD_Font *font, const LCD_Glyph *g, const uint8_t *src, uint16_t fc, uint16_t bc, uint8_t mode)
+{
+	LCD_Font f;
+
+	if (!mode)
+		LCD_Fill_Clip(x, y, x + g->advance - 1, y + font->height - 1, bc);
+	if (g->width == 0 || g->height == 0)
+		return g->advance;
+	f = *font; // ģӾλһȿģ
+	f.width = g->width;
+	f.height = g->height;
+	f.stride = (g->width * font->bpp + 7) / 8;
+	f.glyphs = NULL;
+	LCD_ShowGlyph(x + g->x_off, y + g->y_off, &f, src, fc, bc, mode);
+	return g->advance;
+}
+
+/******************************************************************************
+	  ˵ʾһASCIIַ
+	  ݣx,yʾ
+				font 
+				c ַ
+				fc ֵɫ
+				bc ֵıɫ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  ַǰ
+******************************************************************************/
+static uint8_t LCD_ShowFontChar(uint16_t x, uint16_t y, const LCD_Font *font, uint8_t c, uint16_t fc, uint16_t bc, uint8_t mode)
+{
+	LCD_Glyph g;
+	const uint8_t *src = LCD_Font_Char(font, c, &g);
+
+	if (font->glyphs)
+		return LCD_ShowGlyphBox(x, y, font, &g, src, fc, bc, mode);
+	LCD_ShowGlyph(x, y, font, src, fc, bc, mode);
+	return g.advance;
+}
+
+#if !USE_FRAMEBUFFER
+/******************************************************************************
+	  ˵ǵģʽʾһASCIIַ
+	  ݣx,yʾ
+				f 
+				*p Ҫʾַ
+				n ַ
+				w Щַǰ֮,óLCD_W
+				fc ֵɫ
+				bc ֵıɫ
+	  ֵ  
+	  ˵    ַֻһδ,аÿַĶӦչл,
+				ģӾĲɫ;DMA,
+				һзʱչһ
+******************************************************************************/
+static void LCD_ShowText(uint16_t x, uint16_t y, const LCD_Font *f, const uint8_t *p, uint16_t n, uint16_t w, uint16_t fc, uint16_t bc)
+{
+	uint16_t row, i, k;
+	LCD_Pixel lut[16];
+	LCD_Glyph g;
+
+	LCD_Font_LUT(lut, f, fc, bc);
+	LCD_Address_Set(x, y, x + w - 1, y + f->height - 1);
+	LCD_DC_Set();
+	for (row = 0; row < f->height; row++)
+	{
+		LCD_Pixel *dst = lcd_text_line[row & 1];
+
+		for (i = 0; i < n; i++, dst += g.advance)
+		{
+			const uint8_t *src = LCD_Font_Char(f, p[i], &g);
+
+			if (!f->glyphs) // ȿģ
+			{
+				LCD_Glyph_Row(dst, f, src + row * f->stride, f->width, lut);
+				continue;
+			}
+			for (k = 0; k < g.advance; k++)
+				dst[k] = lut[0];
+			if (row >= g.y_off && row < g.y_off + g.height)
+				LCD_Glyph_Row(dst + g.x_off, f, src + (row - g.y_off) * ((g.width * f->bpp + 7) / 8), g.width, lut);
+		}
+		LCD_DMA_WritePixels(lcd_text_line[row & 1], w); // ȴһDMAٿʼ
+	}
+}
+#endif
+
+/******************************************************************************
+	  ˵ָʾַ
+	  ݣx,yʾ
+				*p Ҫʾַ
+				fc ֵɫ
+				bc ֵıɫ
+				font ASCII(gbΪ-1),ȿ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+	  ˵    ǵģʽĻڵַΪһһη,
+				Ļұߵַʾ
+******************************************************************************/
+void LCD_ShowStringFont(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, const LCD_Font *font, uint8_t mode)
+{
+	if (font->gb >= 0)
+		return;
+#if !USE_FRAMEBUFFER
+	if (!mode && x < LCD_W && font->width <= LCD_GLYPH_MAX_W)
+	{
+		uint16_t n = 0, w = 0;
+		LCD_Glyph g;
+
+		while (p[n] != '\0') // Ļڵַ
+		{
+			LCD_Font_Char(font, p[n], &g);
+			if (x + w + g.advance > LCD_W)
+				break;
+			w += g.advance;
+			n++;
+		}
+		if (w > 0)
+		{
+			LCD_ShowText(x, y, font, p, n, w, fc, bc);
+			x += w;
+			p += n;
+		}
+	}
+#endif
+	while (*p != '\0')
+		x += LCD_ShowFontChar(x, y, font, *p++, fc, bc, mode);
+}
+
+/******************************************************************************
+	  ˵ʾַ
+	  ݣx,yʾ
+				*p Ҫʾַ
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+******************************************************************************/
+void LCD_ShowString(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	int8_t font = LCD_Font_Slot(sizey);
+
+	if (font >= 0)
+		LCD_ShowStringFont(x, y, p, fc, bc, &lcd_font_ascii[font], mode);
+}
+
+/******************************************************************************
+	  ˵ʾ
+	  ݣmnָ
+	  ֵ  
+******************************************************************************/
+uint32_t mypow(uint8_t m, uint8_t n)
+{
+	uint32_t result = 1;
+	while (n--)
+		result *= m;
+	return result;
+}
+
+/******************************************************************************
+	  ˵ʾ
+	  ݣx,yʾ
+				num Ҫʾ
+				len Ҫʾλ
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ
+	  ֵ  
+******************************************************************************/
+void LCD_ShowIntNum(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+	uint8_t t, temp, n = 0;
+	uint8_t enshow = 0;
+	uint8_t sizex = sizey / 2;
+	uint8_t str[LCD_NUM_BUF + 1]; // תַ,νLCD_ShowStringһη
+
+	for (t = 0; t < len; t++)
+	{
+		temp = (num / mypow(10, len - t - 1)) % 10;
+		if (enshow == 0 && t < (len - 1) && temp == 0)
+			str[n++] = ' ';
+		else
+		{
+			enshow = 1;
+			str[n++] = temp + 48;
+		}
+		if (n == LCD_NUM_BUF || t == len - 1) // ѵһλ
+		{
+			str[n] = '\0';
+			LCD_ShowString(x, y, str, fc, bc, sizey, 0);
+			x += n * sizex;
+			n = 0;
+		}
+	}
+}
+
+/******************************************************************************
+	  ˵ʾλС
+	  ݣx,yʾ
+				num ҪʾС
+				len Ҫʾλ
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ
+	  ֵ  
+******************************************************************************/
+void LCD_ShowFloatNum1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+	uint8_t t, n = 0, sizex;
+	uint16_t num1;
+	uint8_t str[LCD_NUM_BUF + 1]; // תַ,νLCD_ShowStringһη
+	sizex = sizey / 2;
+	num1 = num * 100;
+	for (t = 0; t < len; t++)
+	{
+		if (t == (len - 2))
+			str[n++] = '.';
+		str[n++] = (num1 / mypow(10, len - t - 1)) % 10 + 48;
+		if (n >= LCD_NUM_BUF - 1 || t == len - 1) // 彫ѵһλ
+		{
+			str[n] = '\0';
+			LCD_ShowString(x, y, str, fc, bc, sizey, 0);
+			x += n * sizex;
+			n = 0;
+		}
+	}
+}
+
+/******************************************************************************
+	  ˵Image2LcdͼƬͷ
+	  ݣimg ͼƬ
+				pic ͼƬ,Image2Lcdɵ8ֽͷʼ,
+					Ϊtools/gen_rle_image.pyɵRLEѹͼƬ
+	  ֵ  0 ɹ  1 ֵ֧ĸʽ
+	  ˵    ͷΪɨ跽ʽÿλ(2ֽ)RGBʽ;
+				RLEͼƬͷΪ"RLE"ÿλ(ֽǰ);
+				ֻ֧ˮƽɨ衢ҡԶ׵16λ(RGB565)18λ(RGB666,
+				ÿ3ֽ)ɫͼƬ,Ļʽͬʱʾʱת
+******************************************************************************/
+uint8_t LCD_Image_Open(LCD_Image *img, const uint8_t pic[])
+{
+	uint8_t scan = pic[0];
+
+	if (pic[0] == 'R' && pic[1] == 'L' && pic[2] == 'E')
+	{
+		img->rle = 1;
+		img->big_endian = 1;
+		img->bpp = pic[3];
+		img->width = (pic[4] << 8) | pic[5];
+		img->height = (pic[6] << 8) | pic[7];
+		img->data = pic + 8;
+		return ((img->bpp != 16 && img->bpp != 18) || img->width == 0 || img->height == 0) ? 1 : 0;
+	}
+	img->rle = 0;
+	if ((scan & 0xC3) != 0 || (pic[1] != 16 && pic[1] != 18))
+		return 1;
+	img->big_endian = (scan & 0x10) != 0; // (ߺ)ĸֽǰ
+	img->bpp = pic[1];
+	img->width = img->big_endian ? (pic[2] << 8) | pic[3] : pic[2] | (pic[3] << 8);
+	img->height = img->big_endian ? (pic[4] << 8) | pic[5] : pic[4] | (pic[5] << 8);
+	img->data = pic + 8;
+	return (img->width == 0 || img->height == 0) ? 1 : 0;
+}
+
+/******************************************************************************
+	  ˵RLEͼƬһ
+	  ݣsrc ѹ
+				width ͼƬ
+				size ÿֽ 2:RGB565 3:RGB666
+				x1,x2 Ҫ(ͼƬ),x1x2ʱֻ
+				dst ,x1д浽dst[0]
+	  ֵ  һѹݵĵַ
+	  ˵    ֽλΪ1ʱһظ(7λ+1),
+				Ϊ0ʱ(7λ+1)ԭ,һβ
+******************************************************************************/
+static const uint8_t *LCD_RLE_Row(const uint8_t *src, uint16_t width, uint8_t size, uint16_t x1, uint16_t x2, LCD_Draw_Pixel *dst)
+{
+	uint16_t col = 0, i;
+
+	while (col < width)
+	{
+		uint8_t c = *src++;
+		uint16_t n = (c & 0x7F) + 1;
+
+		if (c & 0x80) // ظֻɼĲ
+		{
+			uint16_t a = (col > x1) ? col : x1;
+			uint16_t b = (col + n - 1 < x2) ? col + n - 1 : x2;
+
+			if (a <= b)
+			{
+				LCD_Draw_Pixel color = LCD_Draw_Bytes(src, size);
+
+				for (i = a; i <= b; i++)
+					dst[i - x1] = color;
+			}
+			src += size;
+		}
+		else
+		{
+			for (i = col; i < col + n; i++, src += size)
+			{
+				if (i >= x1 && i <= x2)
+					dst[i - x1] = LCD_Draw_Bytes(src, size);
+			}
+		}
+		col += n;
+	}
+	return src;
+}
+
+/******************************************************************************
+	  ˵ʾͼƬ
+	  ݣx,y(Ϊ)
+				img LCD_Image_OpenõͼƬ
+	  ֵ  
+	  ˵    ĻĲֲü.ĻʽͬͼƬпɼʱ,
+				DMA鷢;ұüʱзÿеĿɼ;
+				ֽǰĻʽͬͼƬת.
+				RLEͼƬн뵽л,һʱһDMA.
+				ʱݿڷ,ͼƬһLCDǰ뱣Ч
+******************************************************************************/
+void LCD_ShowImage(int16_t x, int16_t y, const LCD_Image *img)
+{
+	int x1 = (x < 0) ? 0 : x, y1 = (y < 0) ? 0 : y;
+	int x2 = x + img->width - 1, y2 = y + img->height - 1;
+	uint8_t size = (img->bpp == 18) ? 3 : 2; // ÿֽ
+	uint8_t swap = (size == 2 && !img->big_endian); // ֽǰRGB565ͼƬ
+	uint32_t stride = (uint32_t)img->width * size;
+	const uint8_t *src;
+	uint16_t w, h, row, i;
+
+	if (x2 >= LCD_W)
+		x2 = LCD_W - 1;
+	if (y2 >= LCD_H)
+		y2 = LCD_H - 1;
+	if (x1 > x2 || y1 > y2)
+		return;
+	w = x2 - x1 + 1;
+	h = y2 - y1 + 1;
+	if (img->rle)
+	{
+		src = img->data;
+		for (i = 0; i < y1 - y; i++) // ĻϷֻ벻ʾ
+			src = LCD_RLE_Row(src, img->width, size, 1, 0, NULL);
+#if USE_FRAMEBUFFER
+		LCD_Invalidate(x1, y1, x2, y2);
+		for (row = 0; row < h; row++)
+			src = LCD_RLE_Row(src, img->width, size, x1 - x, x2 - x, &LCD_FrameBuffer[(y1 + row) * LCD_W + x1]);
+#else
+		LCD_Address_Set(x1, y1, x2, y2);
+		LCD_DC_Set();
+		for (row = 0; row < h; row++)
+		{
+			src = LCD_RLE_Row(src, img->width, size, x1 - x, x2 - x, lcd_text_line[row & 1]);
+			LCD_DMA_WritePixels(lcd_text_line[row & 1], w); // ȴһDMAٿʼ
+		}
+#endif
+		return;
+	}
+	src = img->data + (uint32_t)(y1 - y) * stride + (x1 - x) * size;
+
+#if USE_FRAMEBUFFER
+	LCD_Invalidate(x1, y1, x2, y2);
+	for (row = 0; row < h; row++, src += stride)
+	{
+		uint16_t *dst = &LCD_FrameBuffer[(y1 + row) * LCD_W + x1];
+		for (i = 0; i < w; i++)
+			dst[i] = swap ? src[i * 2] | (src[i * 2 + 1] << 8) : LCD_Draw_Bytes(src + i * size, size);
+	}
+#else
+	LCD_Address_Set(x1, y1, x2, y2);
+	LCD_DC_Set();
+	if (swap || size != LCD_PIXEL_BYTES)
+	{
+		for (row = 0; row < h; row++, src += stride)
+		{
+			LCD_Pixel *dst = lcd_text_line[row & 1];
+			for (i = 0; i < w; i++)
+				dst[i] = swap ? LCD_Pixel_Color(src[i * 2] | (src[i * 2 + 1] << 8)) : LCD_Draw_Bytes(src + i * size, size);
+			LCD_DMA_WritePixels(dst, w); // ȴһDMAٿʼ
+		}
+	}
+	else if (w == img->width)
+		LCD_DMA_Write(src, stride * h); // ͼƬλFlash,ֱDMA鷢,ȴ
+	else
+	{
+		for (row = 0; row < h; row++, src += stride)
+			LCD_DMA_Write(src, w * size);
+	}
+#endif
+}
+
+/******************************************************************************
+	  ˵ʾͷͼƬ
+	  ݣx,y
+				length ͼƬ()
+				width  ͼƬ߶()
+				pic[]  дŵ,ʽĻͬ:RGB565ֽǰ,RGB666ÿ3ֽ
+	  ֵ  
+	  ˵    Image2LcdɵĴͷͼƬLCD_Image_OpenLCD_ShowImage;
+				ʱݿڷ,picһLCDǰ뱣Ч
+******************************************************************************/
+void LCD_ShowPicture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[])
+{
+	LCD_Image img = {length, width, (LCD_PIXEL_BYTES == 3) ? 18 : 16, 1, 0, pic};
+
+	if (length == 0 || width == 0)
+		return;
+	LCD_ShowImage(x, y, &img);
+}
+
+#if USE_FRAMEBUFFER
+#if LCD_PIXEL_BYTES == 3
+static LCD_Pixel lcd_present_line[2][LCD_W]; // RGB666л,һзʱתһ
+#endif
+
+/******************************************************************************
+	  ˵֡б޸ĵˢµĻ
+	  ݣ
+	  ֵ  
+	  ˵    ÿһδ,û޸ʱκ.RGB565DMA
+				16λ֡;RGB666תDMA,л彻ʹ,
+				ת뷢ص.ʱһڷ,
+				Ҫһ֡ʱȵLCD_DMA_Wait()
+******************************************************************************/
+void LCD_Present(void)
+{
+	uint8_t i;
+	uint16_t y;
+
+	for (i = 0; i < lcd_dirty_num; i++)
+	{
+		LCD_Rect *r = &lcd_dirty[i];
+		uint16_t w = r->x2 - r->x1 + 1;
+
+		LCD_Address_Set(r->x1, r->y1, r->x2, r->y2);
+		LCD_DC_Set();
+#if LCD_PIXEL_BYTES == 3
+		uint8_t buf = 0;
+		LCD_Pixel *dst = lcd_present_line[buf];
+		uint32_t n = 0;
+		uint16_t x;
+
+		for (y = r->y1; y <= r->y2; y++)
+		{
+			const uint16_t *src = &LCD_FrameBuffer[y * LCD_W + r->x1];
+			for (x = 0; x < w; x++)
+				dst[n++] = LCD_Pixel_Color(src[x]);
+			// խѶװͬһл,װʱ
+			if (n + w > LCD_W || y == r->y2)
+			{
+				LCD_DMA_WritePixels(dst, n); // ȴһDMAٿʼ
+				buf ^= 1;
+				dst = lcd_present_line[buf];
+				n = 0;
+			}
+		}
+#else
+		if (w == LCD_W) // п֡,һη
+			LCD_DMA_Write16(&LCD_FrameBuffer[r->y1 * LCD_W], (uint32_t)LCD_W * (r->y2 - r->y1 + 1));
+		else
+			for (y = r->y1; y <= r->y2; y++)
+				LCD_DMA_Write16(&LCD_FrameBuffer[y * LCD_W + r->x1], w);
+#endif
+	}
+	lcd_dirty_num = 0;
+}
+#endif
+
+/* ɫ */
+void DrawColorBars(void)
+{
+	uint16_t colors[] = {RED, GREEN, BLUE, YELLOW, CYAN, MAGENTA, BLACK, WHITE};
+	for (int i = 0; i < COLOR_BAR_NUM; i++)
+	{
+		// һ쵽Ļұ,ϳ
+		uint16_t xend = (i == COLOR_BAR_NUM - 1) ? SCREEN_WIDTH - 1 : ((i + 1) * BAR_WIDTH) - 1;
+		LCD_Fill(i * BAR_WIDTH, 0, xend, SCREEN_HEIGHT - 1, colors[i]);
+	}
+}
+
+/* ƻҶȽ */
+void DrawGrayscale(void)
+{
+#define GRAY_LEVELS 24
+	const uint16_t level_width = SCREEN_WIDTH / GRAY_LEVELS;
+	const uint16_t remainder = SCREEN_WIDTH % GRAY_LEVELS;
+
+	for (uint8_t n = 0; n < GRAY_LEVELS; n++)
+	{
+		// 㵱ǰҶȼΧ
+		uint16_t start_x = n * level_width;
+		uint16_t end_x = start_x + level_width - 1;
+
+		// أһ
+		if (n == GRAY_LEVELS - 1)
+		{
+			end_x += remainder;
+		}
+
+		// 24Ҷֵ (0~23  0~255)
+		uint8_t gray = (n * 255) / (GRAY_LEVELS - 1);
+
+		// RGB565ɫȷʵRGB꣩
+		uint16_t color = RGB(gray, gray, gray);
+
+		// Ҷȴ
+		LCD_Fill(start_x, 0, end_x, SCREEN_HEIGHT - 1, color);
+	}
+}
+
+/* ť */
+void DrawClearButton(void)
+{
+	LCD_Fill(SCREEN_WIDTH - BTN_WIDTH, SCREEN_HEIGHT - BTN_HEIGHT,
+							SCREEN_WIDTH, SCREEN_HEIGHT, GRAY);
+	LCD_ShowString(SCREEN_WIDTH - BTN_WIDTH + 5, SCREEN_HEIGHT - BTN_HEIGHT + 8,
+				   "Clear", BLACK, GRAY, 16, 0);
+}
+
+/******************************************************************************
+	  ˵ʵԲֽΪˮƽ
+	  ݣx0,y0   Բ
+				r       뾶
+				color   ɫ
+				span    һεĺ
+	  ֵ  
+	  ˵    LCD_FillCirclelcd_band.c
+******************************************************************************/
+void LCD_FillCircle_Spans(int x0, int y0, int r, uint16_t color, LCD_Span_Func span)
+{
+	int x = r;
+	int y = 0;
+	int err = 0;
+
+	if (r == 0)
+		return;
+
+	while (x >= y)
+	{
+		// ˮƽ
+		span(x0 - x, y0 + y, x0 + x, y0 + y, color);
+		span(x0 - y, y0 + x, x0 + y, y0 + x, color);
+		span(x0 - x, y0 - y, x0 + x, y0 - y, color);
+		span(x0 - y, y0 - x, x0 + y, y0 - x, color);
+
+		if (err <= 0)
+		{
+			y += 1;
+			err += 2 * y + 1;
+		}
+		if (err > 0)
+		{
+			x -= 1;
+			err -= 2 * x + 1;
+		}
+	}
+}
+
+/**
+ * @brief  ָλһԲ
+ * @param  x0,y0: Բ
+ * @param  r: Բİ뾶
+ * @param  color: ɫ
+ * @retval 
+ */
+void LCD_FillCircle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+	LCD_FillCircle_Spans(x0, y0, r, color, LCD_Fill_Clip); // ĻĲֲõ
+}
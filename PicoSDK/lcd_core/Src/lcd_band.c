@@ -0,0 +1,452 @@
+#include "Inc/lcd_band.h"
+#include "Inc/lcd.h"
+#include "Inc/lcd_dma.h"
+#include <string.h>
+
+extern const unsigned char ascii_1206[][12]; // ֿlcdfont.hж,lcd.c
+extern const unsigned char ascii_1608[][16];
+extern const unsigned char ascii_2412[][48];
+extern const unsigned char ascii_3216[][64];
+
+enum
+{
+	LCD_BAND_FILL,
+	LCD_BAND_LINE,
+	LCD_BAND_RECT,
+	LCD_BAND_CIRCLE,
+	LCD_BAND_STRING,
+	LCD_BAND_PICTURE,
+};
+
+typedef struct
+{
+	uint8_t type;
+	uint8_t arg;			  // Բ:Ƿʵ ַ:ֺ ಻
+	uint8_t mode;			  // ַ:0ǵ 1
+	int16_t x1, y1, x2, y2;	  // ͼԪ:/ֱΪ˵,ԲΪԲĺͰ뾶,ַ/ͼƬΪͳߴ
+	int16_t bx1, by1, bx2, by2; // Ӿ,ڿཻĴ
+	uint16_t color;			  // ֱ/Բ:RGB565ɫ,lcd.cйõĹդ
+	uint8_t fc[3], bc[3];	  // չΪRGB666ǰɫͱɫ
+	const uint8_t *data;	  // ַͼƬ
+} LCD_Band_Item;
+
+static LCD_Band_Item lcd_band_list[LCD_BAND_MAX_ITEMS];
+static uint8_t lcd_band_num;
+static uint8_t lcd_band_bc[3]; // ɫ(RGB666)
+
+static uint8_t lcd_band_buf[2][LCD_W * LCD_BAND_LINES * 3]; // ˫,һʱȾһ
+
+// ǰȾĴ
+static uint8_t *lcd_band_dst;
+static int16_t lcd_band_x1, lcd_band_x2, lcd_band_y1, lcd_band_y2;
+static uint16_t lcd_band_w;
+
+/******************************************************************************
+	  ˵RGB565ɫչΪRGB666ֽ
+	  ݣcolor ɫ
+				out   R/G/Bֽ
+	  ֵ  
+******************************************************************************/
+static void LCD_Band_Color(uint16_t color, uint8_t out[3])
+{
+	out[0] = (color >> 8) & 0xF8; // ɫ
+	out[1] = (color >> 3) & 0xFC; // ɫ
+	out[2] = color << 3;		  // ɫ
+}
+
+/******************************************************************************
+	  ˵ڵǰڻһ,ĵֱӶ
+	  ݣx,y Ļ
+				c   RGB666ɫ
+	  ֵ  
+******************************************************************************/
+static inline void LCD_Band_Put(int16_t x, int16_t y, const uint8_t c[3])
+{
+	uint8_t *p;
+
+	if (x < lcd_band_x1 || x > lcd_band_x2 || y < lcd_band_y1 || y > lcd_band_y2)
+		return;
+	p = lcd_band_dst + ((uint32_t)(y - lcd_band_y1) * lcd_band_w + (x - lcd_band_x1)) * 3;
+	p[0] = c[0];
+	p[1] = c[1];
+	p[2] = c[2];
+}
+
+/******************************************************************************
+	  ˵ڵǰڻһˮƽ,Զü
+	  ݣx1,x2 ֹ
+				y     
+				c     RGB666ɫ
+	  ֵ  
+******************************************************************************/
+static void LCD_Band_HLine(int16_t x1, int16_t x2, int16_t y, const uint8_t c[3])
+{
+	uint8_t *p;
+
+	if (y < lcd_band_y1 || y > lcd_band_y2)
+		return;
+	if (x1 < lcd_band_x1)
+		x1 = lcd_band_x1;
+	if (x2 > lcd_band_x2)
+		x2 = lcd_band_x2;
+	if (x1 > x2)
+		return;
+	p = lcd_band_dst + ((uint32_t)(y - lcd_band_y1) * lcd_band_w + (x1 - lcd_band_x1)) * 3;
+	for (; x1 <= x2; x1++, p += 3)
+	{
+		p[0] = c[0];
+		p[1] = c[1];
+		p[2] = c[2];
+	}
+}
+
+/******************************************************************************
+	  ˵ѹդһβüǰ󻭳
+	  ݣx1,y1,x2,y2 εֹ(ˮƽλֱ)
+				color       RGB565ɫ
+	  ֵ  
+	  ˵    ֱߺԲLCD_DrawLine/Draw_Circle/LCD_FillCircleͬһ׹դ,
+				ִˢºֱӻƵȫһ
+******************************************************************************/
+static void LCD_Band_Span(int x1, int y1, int x2, int y2, uint16_t color)
+{
+	uint8_t c[3];
+
+	if (y2 < lcd_band_y1 || y1 > lcd_band_y2 || x2 < lcd_band_x1 || x1 > lcd_band_x2)
+		return; // 뵱ǰཻ
+	if (y1 < lcd_band_y1)
+		y1 = lcd_band_y1;
+	if (y2 > lcd_band_y2)
+		y2 = lcd_band_y2;
+	LCD_Band_Color(color, c);
+	for (; y1 <= y2; y1++)
+		LCD_Band_HLine(x1, x2, y1, c);
+}
+
+// ַ:ֻȡģڵǰڵ
+static void LCD_Band_DrawString(const LCD_Band_Item *it)
+{
+	uint8_t sizey = it->arg, sizex = sizey / 2;
+	uint8_t bpr = (sizex + 7) / 8; // ÿģֽ
+	const uint8_t *p = it->data;
+	int16_t cx = it->x1, y, col;
+	int16_t ry1 = (it->by1 > lcd_band_y1) ? it->by1 : lcd_band_y1;
+	int16_t ry2 = (it->by2 < lcd_band_y2) ? it->by2 : lcd_band_y2;
+
+	for (; *p != '\0'; p++, cx += sizex)
+	{
+		const uint8_t *glyph;
+		uint8_t num = *p - ' ';
+
+		if (cx > lcd_band_x2)
+			break;
+		if (cx + sizex <= lcd_band_x1)
+			continue;
+		if (sizey == 12)
+			glyph = ascii_1206[num];
+		else if (sizey == 16)
+			glyph = ascii_1608[num];
+		else if (sizey == 24)
+			glyph = ascii_2412[num];
+		else
+			glyph = ascii_3216[num];
+
+		for (y = ry1; y <= ry2; y++) // ֻڵǰڵģ
+		{
+			const uint8_t *row = glyph + (y - it->y1) * bpr;
+			for (col = 0; col < sizex; col++)
+			{
+				if (row[col >> 3] & (0x01 << (col & 7)))
+					LCD_Band_Put(cx + col, y, it->fc);
+				else if (!it->mode)
+					LCD_Band_Put(cx + col, y, it->bc);
+			}
+		}
+	}
+}
+
+// ͼƬ:вüǰ󿽱
+static void LCD_Band_DrawPicture(const LCD_Band_Item *it)
+{
+	int16_t x1 = (it->bx1 > lcd_band_x1) ? it->bx1 : lcd_band_x1;
+	int16_t x2 = (it->bx2 < lcd_band_x2) ? it->bx2 : lcd_band_x2;
+	int16_t y1 = (it->by1 > lcd_band_y1) ? it->by1 : lcd_band_y1;
+	int16_t y2 = (it->by2 < lcd_band_y2) ? it->by2 : lcd_band_y2;
+	int16_t y;
+
+	for (y = y1; y <= y2; y++) // ÿвüο
+	{
+		memcpy(lcd_band_dst + ((uint32_t)(y - lcd_band_y1) * lcd_band_w + (x1 - lcd_band_x1)) * 3,
+			   it->data + ((uint32_t)(y - it->y1) * it->x2 + (x1 - it->x1)) * 3,
+			   (x2 - x1 + 1) * 3);
+	}
+}
+
+/******************************************************************************
+	  ˵ʾбĩβ׷һͼԪ
+	  ݣtype ͼԪ
+				bx1,by1,bx2,by2 Ӿ
+	  ֵ  ͼԪ,бʱNULL
+******************************************************************************/
+static LCD_Band_Item *LCD_Band_Add(uint8_t type, int32_t bx1, int32_t by1, int32_t bx2, int32_t by2)
+{
+	LCD_Band_Item *it;
+
+	if (lcd_band_num >= LCD_BAND_MAX_ITEMS)
+		return NULL;
+	it = &lcd_band_list[lcd_band_num++];
+	memset(it, 0, sizeof(*it));
+	it->type = type;
+	it->bx1 = (bx1 < 0) ? 0 : bx1;
+	it->by1 = (by1 < 0) ? 0 : by1;
+	it->bx2 = (bx2 >= LCD_W) ? LCD_W - 1 : bx2;
+	it->by2 = (by2 >= LCD_H) ? LCD_H - 1 : by2;
+	return it;
+}
+
+/******************************************************************************
+	  ˵ʾбñɫ
+	  ݣbc ɫ
+	  ֵ  
+******************************************************************************/
+void LCD_Band_Clear(uint16_t bc)
+{
+	lcd_band_num = 0;
+	LCD_Band_Color(bc, lcd_band_bc);
+}
+
+/******************************************************************************
+	  ˵
+	  ݣxsta,ysta   ʼ
+				xend,yend   ֹ
+				color       Ҫɫ
+	  ֵ  0 ɹ  1 ʾб
+******************************************************************************/
+uint8_t LCD_Band_Fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
+{
+	LCD_Band_Item *it = LCD_Band_Add(LCD_BAND_FILL, xsta, ysta, xend, yend);
+
+	if (it == NULL)
+		return 1;
+	LCD_Band_Color(color, it->fc);
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ֱ
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+				color   ߵɫ
+	  ֵ  0 ɹ  1 ʾб
+******************************************************************************/
+uint8_t LCD_Band_Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+	LCD_Band_Item *it = LCD_Band_Add(LCD_BAND_LINE, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+									 (x1 > x2) ? x1 : x2, (y1 > y2) ? y1 : y2);
+
+	if (it == NULL)
+		return 1;
+	it->x1 = x1;
+	it->y1 = y1;
+	it->x2 = x2;
+	it->y2 = y2;
+	it->color = color;
+	return 0;
+}
+
+/******************************************************************************
+	  ˵Ӿο
+	  ݣx1,y1   ʼ
+				x2,y2   ֹ
+				color   εɫ
+	  ֵ  0 ɹ  1 ʾб
+******************************************************************************/
+uint8_t LCD_Band_Rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
+{
+	LCD_Band_Item *it = LCD_Band_Add(LCD_BAND_RECT, x1, y1, x2, y2);
+
+	if (it == NULL)
+		return 1;
+	it->x1 = x1;
+	it->y1 = y1;
+	it->x2 = x2;
+	it->y2 = y2;
+	LCD_Band_Color(color, it->fc);
+	return 0;
+}
+
+/******************************************************************************
+	  ˵Բ
+	  ݣx0,y0   Բ
+				r       뾶
+				color   Բɫ
+				fill    0 1ʵ
+	  ֵ  0 ɹ  1 ʾб
+******************************************************************************/
+uint8_t LCD_Band_Circle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color, uint8_t fill)
+{
+	LCD_Band_Item *it = LCD_Band_Add(LCD_BAND_CIRCLE, (int32_t)x0 - r, (int32_t)y0 - r, (int32_t)x0 + r, (int32_t)y0 + r);
+
+	if (it == NULL)
+		return 1;
+	it->x1 = x0;
+	it->y1 = y0;
+	it->x2 = r;
+	it->arg = fill;
+	it->color = color;
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ASCIIַ
+	  ݣx,yʾ
+				*p Ҫʾַ,ˢǰ뱣Ч
+				fc ֵɫ
+				bc ֵıɫ
+				sizey ֺ ѡ 12 16 24 32
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  0 ɹ  1 ʾбֺŲ֧
+******************************************************************************/
+uint8_t LCD_Band_String(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+	LCD_Band_Item *it;
+
+	if (sizey != 12 && sizey != 16 && sizey != 24 && sizey != 32)
+		return 1;
+	it = LCD_Band_Add(LCD_BAND_STRING, x, y, (int32_t)x + strlen((const char *)p) * (sizey / 2) - 1, (int32_t)y + sizey - 1);
+	if (it == NULL)
+		return 1;
+	it->x1 = x;
+	it->y1 = y;
+	it->arg = sizey;
+	it->mode = mode;
+	it->data = p;
+	LCD_Band_Color(fc, it->fc);
+	LCD_Band_Color(bc, it->bc);
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ͼƬ
+	  ݣx,y
+				length ͼƬ()
+				width  ͼƬ߶()
+				pic[]  RGB666ͼƬ,ÿ3ֽ,ˢǰ뱣Ч
+	  ֵ  0 ɹ  1 ʾб
+******************************************************************************/
+uint8_t LCD_Band_Picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t pic[])
+{
+	LCD_Band_Item *it = LCD_Band_Add(LCD_BAND_PICTURE, x, y, (int32_t)x + length - 1, (int32_t)y + width - 1);
+
+	if (it == NULL)
+		return 1;
+	it->x1 = x;
+	it->y1 = y;
+	it->x2 = length;
+	it->data = pic;
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ʾбȾǰ
+	  ݣ
+	  ֵ  
+	  ˵    ˳,ӵͼԪӵ
+******************************************************************************/
+static void LCD_Band_Render(void)
+{
+	uint8_t i;
+	int16_t y;
+
+	for (y = lcd_band_y1; y <= lcd_band_y2; y++) // ̱ɫ
+		LCD_Band_HLine(lcd_band_x1, lcd_band_x2, y, lcd_band_bc);
+
+	for (i = 0; i < lcd_band_num; i++)
+	{
+		const LCD_Band_Item *it = &lcd_band_list[i];
+
+		if (it->bx2 < lcd_band_x1 || it->bx1 > lcd_band_x2 || it->by2 < lcd_band_y1 || it->by1 > lcd_band_y2)
+			continue; // 뵱ǰཻ
+		switch (it->type)
+		{
+		case LCD_BAND_FILL:
+			for (y = (it->by1 > lcd_band_y1) ? it->by1 : lcd_band_y1; y <= it->by2 && y <= lcd_band_y2; y++)
+				LCD_Band_HLine(it->bx1, it->bx2, y, it->fc);
+			break;
+		case LCD_BAND_LINE:
+			LCD_Line_Spans(it->x1, it->y1, it->x2, it->y2, it->color, LCD_Band_Span);
+			break;
+		case LCD_BAND_RECT:
+			LCD_Band_HLine(it->x1, it->x2, it->y1, it->fc);
+			LCD_Band_HLine(it->x1, it->x2, it->y2, it->fc);
+			for (y = (it->by1 > lcd_band_y1) ? it->by1 : lcd_band_y1; y <= it->by2 && y <= lcd_band_y2; y++)
+			{
+				LCD_Band_Put(it->x1, y, it->fc);
+				LCD_Band_Put(it->x2, y, it->fc);
+			}
+			break;
+		case LCD_BAND_CIRCLE:
+			if (it->arg)
+				LCD_FillCircle_Spans(it->x1, it->y1, it->x2, it->color, LCD_Band_Span);
+			else
+				LCD_Circle_Spans(it->x1, it->y1, it->x2, it->color, LCD_Band_Span);
+			break;
+		case LCD_BAND_STRING:
+			LCD_Band_DrawString(it);
+			break;
+		case LCD_BAND_PICTURE:
+			LCD_Band_DrawPicture(it);
+			break;
+		}
+	}
+}
+
+/******************************************************************************
+	  ˵Ⱦʾбˢָ
+	  ݣxsta,ysta   ʼ
+				xend,yend   ֹ
+	  ֵ  
+	  ˵    ֻһδ,ϵȾ,ÿȾDMA,
+				ͬʱȾһ;ԽխÿԽ.ʱһڷ
+******************************************************************************/
+void LCD_Band_Flush(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend)
+{
+	uint16_t lines;
+	uint8_t k = 0;
+
+	if (xend >= LCD_W)
+		xend = LCD_W - 1; // üĻΧ
+	if (yend >= LCD_H)
+		yend = LCD_H - 1;
+	if (xsta > xend || ysta > yend)
+		return;
+
+	lcd_band_x1 = xsta;
+	lcd_band_x2 = xend;
+	lcd_band_w = xend - xsta + 1;
+	lines = sizeof(lcd_band_buf[0]) / (lcd_band_w * 3);
+
+	LCD_Address_Set(xsta, ysta, xend, yend);
+	LCD_DC_Set();
+	for (lcd_band_y1 = ysta; lcd_band_y1 <= yend; lcd_band_y1 += lines)
+	{
+		lcd_band_y2 = lcd_band_y1 + lines - 1;
+		if (lcd_band_y2 > yend)
+			lcd_band_y2 = yend;
+		lcd_band_dst = lcd_band_buf[k];
+		LCD_Band_Render();
+		// ȴһDMAʼͱ,Ⱦһʱں̨
+		LCD_DMA_Write(lcd_band_dst, (uint32_t)lcd_band_w * (lcd_band_y2 - lcd_band_y1 + 1) * 3);
+		k ^= 1;
+	}
+}
+
+/******************************************************************************
+	  ˵Ⱦʾбˢ
+	  ݣ
+	  ֵ  
+******************************************************************************/
+void LCD_Band_FlushAll(void)
+{
+	LCD_Band_Flush(0, 0, LCD_W - 1, LCD_H - 1);
+}
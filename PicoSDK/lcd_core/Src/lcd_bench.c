@@ -0,0 +1,165 @@
+#include "Inc/lcd_bench.h"
+#include "Inc/lcd.h"
+#include "Inc/lcd_dma.h"
+#if LCD_PIXEL_BYTES == 3
+#include "Inc/lcd_band.h"
+#endif
+#include <stdio.h>
+
+
+extern const uint8_t gImage_logo[];
+extern const uint8_t gImage_logo_rle[]; // ͬһͼƬRLEѹ汾
+
+typedef struct
+{
+	const char *name;
+	void (*draw)(uint16_t i); // iΪ,ֻɫλ
+	uint32_t pixels;		  // ÿεøǵ(ԲΪֵ),0ΪgImage_logo
+	uint16_t calls;
+} LCD_Bench_Case;
+
+static uint16_t Bench_Color(uint16_t i)
+{
+	return (i & 1) ? BLUE : RED; // ɫͬ,ⱻޱ仯
+}
+
+static void Bench_FillFull(uint16_t i) { LCD_Fill(0, 0, LCD_W - 1, LCD_H - 1, Bench_Color(i)); }
+static void Bench_Fill32(uint16_t i) { LCD_Fill(i % 64, 40, i % 64 + 31, 71, Bench_Color(i)); }
+static void Bench_Fill8(uint16_t i) { LCD_Fill(i % 64, 40, i % 64 + 7, 47, Bench_Color(i)); }
+static void Bench_LineH(uint16_t i) { LCD_DrawLine(0, 100, LCD_W - 1, 100, Bench_Color(i)); }
+static void Bench_LineV(uint16_t i) { LCD_DrawLine(100, 0, 100, LCD_H - 1, Bench_Color(i)); }
+static void Bench_Line45(uint16_t i) { LCD_DrawLine(0, 0, 199, 199, Bench_Color(i)); }
+static void Bench_LineShallow(uint16_t i) { LCD_DrawLine(0, 50, 199, 99, Bench_Color(i)); }
+static void Bench_LineSteep(uint16_t i) { LCD_DrawLine(50, 0, 99, 199, Bench_Color(i)); }
+static void Bench_Circle(uint16_t i) { Draw_Circle(LCD_W / 2, LCD_H / 2, 50, Bench_Color(i)); }
+static void Bench_FillCircle(uint16_t i) { LCD_FillCircle(LCD_W / 2, LCD_H / 2, 50, Bench_Color(i)); }
+static void Bench_Str12(uint16_t i) { LCD_ShowString(0, 10, (const uint8_t *)"0123456789", WHITE, Bench_Color(i), 12, 0); }
+static void Bench_Str16(uint16_t i) { LCD_ShowString(0, 10, (const uint8_t *)"0123456789", WHITE, Bench_Color(i), 16, 0); }
+static void Bench_Str24(uint16_t i) { LCD_ShowString(0, 10, (const uint8_t *)"0123456789", WHITE, Bench_Color(i), 24, 0); }
+static void Bench_Str32(uint16_t i) { LCD_ShowString(0, 10, (const uint8_t *)"0123456789", WHITE, Bench_Color(i), 32, 0); }
+static void Bench_Str16Overlay(uint16_t i) { LCD_ShowString(0, 10, (const uint8_t *)"0123456789", Bench_Color(i), BLACK, 16, 1); }
+static void Bench_StrAA16(uint16_t i) { LCD_ShowStringFont(0, 10, (const uint8_t *)"0123456789", WHITE, Bench_Color(i), &LCD_Font_AA16, 0); }
+static void Bench_StrP16(uint16_t i) { LCD_ShowStringFont(0, 10, (const uint8_t *)"0123456789", WHITE, Bench_Color(i), &LCD_Font_P16, 0); }
+static void Bench_Chinese16(uint16_t i) { LCD_ShowChinese(0, 10, (uint8_t *)"о԰", WHITE, Bench_Color(i), 16, 0); }
+static void Bench_Chinese24(uint16_t i) { LCD_ShowChinese(0, 10, (uint8_t *)"о԰", WHITE, Bench_Color(i), 24, 0); }
+static void Bench_Chinese32(uint16_t i) { LCD_ShowChinese(0, 10, (uint8_t *)"Һ", WHITE, Bench_Color(i), 32, 0); }
+static void Bench_Picture(uint16_t i)
+{
+	LCD_Image img;
+
+	if (LCD_Image_Open(&img, gImage_logo) == 0)
+		LCD_ShowImage(0, i & 1, &img);
+}
+static void Bench_PictureRLE(uint16_t i)
+{
+	LCD_Image img;
+
+	if (LCD_Image_Open(&img, gImage_logo_rle) == 0)
+		LCD_ShowImage(0, i & 1, &img);
+}
+#if LCD_PIXEL_BYTES == 3
+static void Bench_BandFull(uint16_t i)
+{
+	LCD_Band_Clear(Bench_Color(i)); // ÿؽʾб,¼ͼԪĿ
+	LCD_Band_Fill(20, 20, LCD_W - 21, 80, GRAY);
+	LCD_Band_String(30, 40, (const uint8_t *)"0123456789", WHITE, GRAY, 16, 0);
+	LCD_Band_Line(0, 100, LCD_W - 1, LCD_H - 1, WHITE);
+	LCD_Band_Rectangle(20, 120, LCD_W - 21, LCD_H - 21, YELLOW);
+	LCD_Band_Circle(LCD_W / 2, LCD_H / 2, 100, GREEN, 1);
+	LCD_Band_Circle(LCD_W / 2, LCD_H / 2, 120, CYAN, 0);
+	LCD_Band_FlushAll();
+}
+#endif
+#if USE_FRAMEBUFFER
+static void Bench_Present(uint16_t i)
+{
+	(void)i;
+	LCD_Invalidate(0, 0, LCD_W - 1, LCD_H - 1);
+	LCD_Present();
+}
+#endif
+
+static const LCD_Bench_Case bench_cases[] = {
+	{"Fill full", Bench_FillFull, LCD_W * LCD_H, 4},
+	{"Fill 32x32", Bench_Fill32, 32 * 32, 200},
+	{"Fill 8x8", Bench_Fill8, 8 * 8, 500},
+	{"Line horizontal", Bench_LineH, LCD_W, 100},
+	{"Line vertical", Bench_LineV, LCD_H, 100},
+	{"Line 45deg", Bench_Line45, 200, 100},
+	{"Line shallow", Bench_LineShallow, 200, 100},
+	{"Line steep", Bench_LineSteep, 200, 100},
+	{"Draw_Circle r50", Bench_Circle, 8 * 50 * 707 / 1000, 100}, // ˷֮һԲԼr/2
+	{"LCD_FillCircle r50", Bench_FillCircle, 50 * 50 * 355 / 113, 50},
+	{"String 12", Bench_Str12, 10 * 6 * 12, 50},
+	{"String 16", Bench_Str16, 10 * 8 * 16, 50},
+	{"String 24", Bench_Str24, 10 * 12 * 24, 50},
+	{"String 32", Bench_Str32, 10 * 16 * 32, 50},
+	{"String 16 overlay", Bench_Str16Overlay, 10 * 8 * 16, 50},
+	{"String AA16", Bench_StrAA16, 10 * 8 * 16, 50},
+	{"String P16", Bench_StrP16, 69 * 16, 50}, // ܿ69
+	{"Chinese 16", Bench_Chinese16, 5 * 16 * 16, 50},
+	{"Chinese 24", Bench_Chinese24, 5 * 24 * 24, 50},
+	{"Chinese 32", Bench_Chinese32, 4 * 32 * 32, 50},
+	{"Picture", Bench_Picture, 0, 4}, // Ϊ0ʱȡgImage_logoĳߴ,ĻͼƬͬ
+	{"Picture RLE", Bench_PictureRLE, 0, 4},
+#if LCD_PIXEL_BYTES == 3
+	{"Band flush full", Bench_BandFull, LCD_W * LCD_H, 4}, // ִȾ,ֻRGB666Ļlcd_band.c
+#endif
+#if USE_FRAMEBUFFER
+	{"Present full", Bench_Present, LCD_W * LCD_H, 4},
+#endif
+};
+
+/******************************************************************************
+	  ˵ȫ׼ӡ
+	  ݣcounter ȡSPIֽڼĺ,ûʱNULL
+	  ֵ  
+	  ˵    ÿcalls,time_us_64ʱ,һεúȴDMA;
+				ÿεúʱ(us)(kpx/s)ÿSPIֽÿεõֽ.
+				֡ģʽ»ͼֻдRAM,SPI"Present full"һ
+******************************************************************************/
+void LCD_Bench_Run(LCD_Bench_Counter counter)
+{
+	LCD_Bench_Count c0, c1;
+	LCD_Image logo;
+	uint32_t logo_px = 1; // ͼƬ޷ʱ0
+	uint16_t n, i;
+
+	if (LCD_Image_Open(&logo, gImage_logo) == 0)
+		logo_px = (uint32_t)logo.width * logo.height;
+
+	printf("LCD bench %dx%d, %s\n", LCD_W, LCD_H, USE_FRAMEBUFFER ? "framebuffer" : "direct");
+	printf("%-20s %6s %10s %10s %9s %10s\n", "case", "calls", "us/call", "kpx/s", "bytes/px", "cmds/call");
+
+	for (n = 0; n < sizeof(bench_cases) / sizeof(bench_cases[0]); n++)
+	{
+		const LCD_Bench_Case *bc = &bench_cases[n];
+		uint64_t t0, us;
+		uint64_t px = (uint64_t)(bc->pixels ? bc->pixels : logo_px) * bc->calls;
+
+		LCD_DMA_Wait();
+		if (counter)
+			counter(&c0);
+		t0 = time_us_64();
+		for (i = 0; i < bc->calls; i++)
+			bc->draw(i);
+		LCD_DMA_Wait();
+		us = time_us_64() - t0;
+		if (us == 0)
+			us = 1;
+
+		printf("%-20s %6u %10lu %10lu", bc->name, bc->calls,
+			   (unsigned long)(us / bc->calls), (unsigned long)(px * 1000 / us));
+		if (counter)
+		{
+			uint64_t bytes;
+
+			counter(&c1);
+			bytes = c1.bytes - c0.bytes;
+			printf(" %6lu.%02lu %10lu\n", (unsigned long)(bytes / px), (unsigned long)(bytes * 100 / px % 100),
+				   (unsigned long)((c1.commands - c0.commands) / bc->calls));
+		}
+		else
+			printf(" %9s %10s\n", "-", "-");
+	}
+}
@@ -0,0 +1,199 @@
+#include "Inc/lcd_bmp.h"
+#include "Inc/lcd.h"
+#include "Inc/lcd_dma.h"
+#include <string.h>
+
+static uint8_t lcd_bmp_raw[LCD_W * 3]; // ļһԭʼ
+#if USE_FRAMEBUFFER
+typedef uint16_t LCD_BMP_Pixel; // ֱתRGB565֡
+#else
+typedef LCD_Pixel LCD_BMP_Pixel; // תΪĻظʽDMAз
+
+static LCD_Pixel lcd_bmp_line[2][LCD_W]; // ת,һзʱתһ
+#endif
+
+/* С32λ */
+static uint32_t LCD_BMP_U32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* ȡlenֽ,ݲʱ1 */
+static uint8_t LCD_BMP_Skip(LCD_BMP_Read read, void *ctx, uint32_t len)
+{
+	while (len > 0)
+	{
+		uint32_t n = (len < sizeof(lcd_bmp_raw)) ? len : sizeof(lcd_bmp_raw);
+
+		if (read(ctx, lcd_bmp_raw, n) != n)
+			return 1;
+		len -= n;
+	}
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ȡBMPļͷ
+	  ݣbmp ͼƬϢ
+				read,ctx ,λļͷ
+	  ֵ  0 ɹ  1 ֵ֧ĸʽݲ
+	  ˵    0ʱݿͷ,ŵLCD_ShowBMP;
+				16λͼƬΪBI_BITFIELDSѹʽΪRGB565
+******************************************************************************/
+uint8_t LCD_BMP_Open(LCD_BMP *bmp, LCD_BMP_Read read, void *ctx)
+{
+	uint8_t *h = lcd_bmp_raw; // ļͷ14ֽ,Ϣͷ40ֽ,֮16λͼƬɫ
+	uint32_t offset, comp, used = 54;
+	int32_t width, height;
+
+	if (read(ctx, h, 54) != 54 || h[0] != 'B' || h[1] != 'M')
+		return 1;
+	offset = LCD_BMP_U32(h + 10);
+	width = (int32_t)LCD_BMP_U32(h + 18);
+	height = (int32_t)LCD_BMP_U32(h + 22);
+	comp = LCD_BMP_U32(h + 30);
+	if (LCD_BMP_U32(h + 14) < 40 || h[26] != 1 || h[29] != 0 ||
+		width <= 0 || width > 0xFFFF || height == 0 || height > 0xFFFF || height < -0xFFFF)
+		return 1;
+	if (h[28] == 16 && comp == 3) // 40ֽϢͷ,V4/V5Ϣͷλͬ
+	{
+		if (offset < 66 || read(ctx, h + 54, 12) != 12)
+			return 1;
+		if (LCD_BMP_U32(h + 54) != 0xF800 || LCD_BMP_U32(h + 58) != 0x07E0 || LCD_BMP_U32(h + 62) != 0x001F)
+			return 1;
+		used = 66;
+	}
+	else if (h[28] != 24 || comp != 0)
+		return 1;
+	if (offset < used)
+		return 1;
+	bmp->width = width;
+	bmp->height = (height > 0) ? height : -height;
+	bmp->bpp = h[28];
+	bmp->bottom_up = (height > 0);
+	bmp->stride = ((uint32_t)bmp->width * (bmp->bpp / 8) + 3) & ~3u;
+	return LCD_BMP_Skip(read, ctx, offset - used);
+}
+
+/******************************************************************************
+	  ˵ȡһزתΪLCD_BMP_Pixel
+	  ݣbmp ͼƬϢ
+				read,ctx 
+				x1,x2 Ҫ(ͼƬ)
+				dst ,x1д浽dst[0]
+	  ֵ  0 ɹ  1 ݲ
+	  ˵    һзֶζlcd_bmp_raw,ÿΪ,βֽһ
+******************************************************************************/
+static uint8_t LCD_BMP_Row(const LCD_BMP *bmp, LCD_BMP_Read read, void *ctx, uint16_t x1, uint16_t x2, LCD_BMP_Pixel *dst)
+{
+	uint8_t size = bmp->bpp / 8;
+	uint32_t chunk = sizeof(lcd_bmp_raw) / size * size;
+	uint32_t left = bmp->stride;
+	uint16_t col = 0; // εһصк
+
+	while (left > 0)
+	{
+		uint32_t n = (left < chunk) ? left : chunk;
+		uint16_t a = (col > x1) ? col : x1;
+		uint16_t b = col + n / size - 1;
+		const uint8_t *p;
+
+		if (read(ctx, lcd_bmp_raw, n) != n)
+			return 1;
+		if (b > x2)
+			b = x2;
+		for (p = lcd_bmp_raw + (a - col) * size; a <= b; a++, p += size)
+		{
+#if !USE_FRAMEBUFFER && LCD_PIXEL_BYTES == 3
+			if (size == 3) // BGR888
+			{
+				LCD_Pixel c = {p[2], p[1], p[0]};
+				dst[a - x1] = c;
+			}
+			else // СRGB565
+				dst[a - x1] = LCD_Pixel_Color(p[0] | (p[1] << 8));
+#else
+			dst[a - x1] = (size == 3) ? RGB(p[2], p[1], p[0]) : p[0] | (p[1] << 8); // BGR888СRGB565
+#endif
+		}
+		col += n / size;
+		left -= n;
+	}
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ʾBMPͼƬ
+	  ݣx,y(Ϊ)
+				bmp LCD_BMP_OpenõͼƬϢ
+				read,ctx ,λݿͷ
+	  ֵ  0 ɹ  1 ݲ
+	  ˵    ĻĲֱõ,һɼ֮ݲٶȡ.
+				ŵͼƬʱLCD_Set_Scanתз,ֻһδ,
+				ʱô.ʱһпڷ
+******************************************************************************/
+uint8_t LCD_ShowBMP(int16_t x, int16_t y, const LCD_BMP *bmp, LCD_BMP_Read read, void *ctx)
+{
+	int x1 = (x < 0) ? 0 : x, y1 = (y < 0) ? 0 : y;
+	int x2 = x + bmp->width - 1, y2 = y + bmp->height - 1;
+	uint16_t h, row;
+	uint8_t err = 0;
+#if !USE_FRAMEBUFFER
+	uint16_t w;
+	uint8_t flip;
+#endif
+
+	if (x2 >= LCD_W)
+		x2 = LCD_W - 1;
+	if (y2 >= LCD_H)
+		y2 = LCD_H - 1;
+	if (x1 > x2 || y1 > y2)
+		return 0;
+	h = y2 - y1 + 1;
+	// ȶĲɼ:ʱĻ·,˳ʱϷ
+	if (LCD_BMP_Skip(read, ctx, (uint32_t)(bmp->bottom_up ? y + bmp->height - 1 - y2 : y1 - y) * bmp->stride))
+		return 1;
+
+#if USE_FRAMEBUFFER
+	LCD_Invalidate(x1, y1, x2, y2);
+	for (row = 0; row < h && err == 0; row++)
+		err = LCD_BMP_Row(bmp, read, ctx, x1 - x, x2 - x, &LCD_FrameBuffer[(bmp->bottom_up ? y2 - row : y1 + row) * LCD_W + x1]);
+#else
+	w = x2 - x1 + 1;
+	flip = bmp->bottom_up && LCD_Set_Scan(1) == 0;
+	if (flip)
+		LCD_Address_Set(x1, LCD_H - 1 - y2, x2, LCD_H - 1 - y1); // зתĻy2д
+	else if (!bmp->bottom_up)
+		LCD_Address_Set(x1, y1, x2, y2);
+	LCD_DC_Set();
+	for (row = 0; row < h; row++)
+	{
+		if (bmp->bottom_up && !flip)
+			LCD_Address_Set(x1, y2 - row, x2, y2 - row); // ʱô
+		err = LCD_BMP_Row(bmp, read, ctx, x1 - x, x2 - x, lcd_bmp_line[row & 1]);
+		if (err)
+			break;
+		LCD_DMA_WritePixels(lcd_bmp_line[row & 1], w); // ȴһDMAٿʼ
+	}
+	if (flip)
+		LCD_Set_Scan(0);
+#endif
+	return err;
+}
+
+/******************************************************************************
+	  ˵ڴеBMPļȡ
+	  ݣctx LCD_BMP_Mem,dataflashе
+				buf,len ݺͳ
+	  ֵ  ʵʶֽ
+******************************************************************************/
+uint32_t LCD_BMP_MemRead(void *ctx, uint8_t *buf, uint32_t len)
+{
+	LCD_BMP_Mem *m = (LCD_BMP_Mem *)ctx;
+
+	if (len > m->size - m->pos)
+		len = m->size - m->pos;
+	memcpy(buf, m->data + m->pos, len);
+	m->pos += len;
+	return len;
+}
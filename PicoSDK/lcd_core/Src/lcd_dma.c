@@ -0,0 +1,211 @@
+#include "Inc/lcd_dma.h"
+#include "Inc/lcd_init.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+
+static int lcd_dma_chan = -1;	 // LCDʹõDMAͨ
+static bool lcd_dma_pending = 0; // ǷδȷɵĴ
+static bool lcd_dma_16bit = 0;	 // SPIǰǷ16λ֡ģʽ
+
+static dma_channel_config lcd_dma_cfg_buf;	// 8λ,ַ:ڴеݿ
+#if LCD_PIXEL_BYTES == 3
+static dma_channel_config lcd_dma_cfg_fill; // 8λ,̶ַ:ظͬһֽ
+
+#define LCD_DMA_PATTERN_PIXELS LCD_W // ɫͼ(һ)
+
+static LCD_Pixel lcd_dma_pattern[LCD_DMA_PATTERN_PIXELS]; // RGB666ɫͼ
+static uint32_t lcd_dma_pattern_color = 0xFFFFFFFF;		  // ͼ鵱ǰɫ,ظ
+static uint8_t lcd_dma_byte;							  // ֽظʱDMAȡֵ
+#else
+static dma_channel_config lcd_dma_cfg_buf16; // 16λ,ַ:RGB565
+static dma_channel_config lcd_dma_cfg_fill; // 16λ,̶ַ:ظͬһ
+static uint16_t lcd_dma_color;				// ɫʱDMAȡɫֵ
+#endif
+
+/******************************************************************************
+	  ˵ʼLCDDMAͨ
+	  ݣ
+	  ֵ  
+	  ˵    DMASPI TX DREQΪ,ÿδڴһֽдSPIݼĴ
+******************************************************************************/
+void LCD_DMA_Init(void)
+{
+	if (lcd_dma_chan < 0)
+		lcd_dma_chan = dma_claim_unused_channel(true);
+
+	lcd_dma_cfg_buf = dma_channel_get_default_config(lcd_dma_chan);
+	channel_config_set_transfer_data_size(&lcd_dma_cfg_buf, DMA_SIZE_8);
+	channel_config_set_dreq(&lcd_dma_cfg_buf, spi_get_dreq(LCD_SPI_PORT, true));
+	channel_config_set_read_increment(&lcd_dma_cfg_buf, true);
+	channel_config_set_write_increment(&lcd_dma_cfg_buf, false);
+
+#if LCD_PIXEL_BYTES == 3
+	lcd_dma_cfg_fill = lcd_dma_cfg_buf;
+#else
+	lcd_dma_cfg_buf16 = lcd_dma_cfg_buf;
+	channel_config_set_transfer_data_size(&lcd_dma_cfg_buf16, DMA_SIZE_16);
+
+	lcd_dma_cfg_fill = lcd_dma_cfg_buf16;
+#endif
+	channel_config_set_read_increment(&lcd_dma_cfg_fill, false);
+
+	dma_channel_configure(lcd_dma_chan, &lcd_dma_cfg_buf, &spi_get_hw(LCD_SPI_PORT)->dr, NULL, 0, false);
+	lcd_dma_pending = 0;
+	lcd_dma_16bit = 0;
+}
+
+/******************************************************************************
+	  ˵һ
+	  ݣbuf ׵ַ
+				len ݳ(ֽ)
+	  ֵ  
+	  ˵    һδδɻȵȴ;ʱݿڷ,
+				LCD_DMA_Wait()֮ǰ޸buf.ʱֻһ
+				DMA,SPI FIFOʣ뱾֮ûм϶
+******************************************************************************/
+void LCD_DMA_Write(const uint8_t *buf, uint32_t len)
+{
+	if (len == 0)
+		return;
+	if (lcd_dma_pending && !lcd_dma_16bit)
+		dma_channel_wait_for_finish_blocking(lcd_dma_chan);
+	else
+		LCD_DMA_Wait();
+	lcd_dma_pending = 1;
+	dma_channel_set_config(lcd_dma_chan, &lcd_dma_cfg_buf, false);
+	dma_channel_transfer_from_buffer_now(lcd_dma_chan, buf, len);
+}
+
+#if LCD_PIXEL_BYTES == 3
+/******************************************************************************
+	  ˵ظͬһ
+	  ݣcolor ɫ(RGB565,ʱչΪRGB666)
+				count ظ
+	  ֵ  
+	  ˵    18λ(0x3A=0x66)ÿ3ֽ,޷16λù̶ַ
+				16λDMAظһ.R/G/Bֽͬ(ɫ)ʱù̶ַ
+				8λDMAظͬһֽ;ظύһдСͼ,
+				ͼֻɫ仯ʱ
+******************************************************************************/
+void LCD_DMA_Fill(uint16_t color, uint32_t count)
+{
+	LCD_Pixel c = LCD_Pixel_Color(color);
+	uint32_t i;
+
+	if (count == 0)
+		return;
+	LCD_DMA_Wait();
+
+	if (c.r == c.g && c.g == c.b)
+	{
+		lcd_dma_byte = c.r;
+		lcd_dma_pending = 1;
+		dma_channel_set_config(lcd_dma_chan, &lcd_dma_cfg_fill, false);
+		dma_channel_transfer_from_buffer_now(lcd_dma_chan, &lcd_dma_byte, count * 3);
+		return;
+	}
+
+	if (lcd_dma_pattern_color != color)
+	{
+		for (i = 0; i < LCD_DMA_PATTERN_PIXELS; i++)
+			lcd_dma_pattern[i] = c;
+		lcd_dma_pattern_color = color;
+	}
+
+	while (count > 0)
+	{
+		uint32_t pixels = (count > LCD_DMA_PATTERN_PIXELS) ? LCD_DMA_PATTERN_PIXELS : count;
+		LCD_DMA_WritePixels(lcd_dma_pattern, pixels);
+		count -= pixels;
+	}
+}
+#else
+/******************************************************************************
+	  ˵һRGB565
+	  ݣbuf ׵ַ
+				count ظ
+	  ֵ  
+	  ˵    SPIʱлΪ16λ֡,ÿذֽǰ,LCD_WR_DATAһ;
+				LCD_DMA_Wait()֮ǰ޸buf.ʱл֡ʽ,
+				ֻһDMA
+******************************************************************************/
+void LCD_DMA_Write16(const uint16_t *buf, uint32_t count)
+{
+	if (count == 0)
+		return;
+	if (lcd_dma_pending && lcd_dma_16bit)
+		dma_channel_wait_for_finish_blocking(lcd_dma_chan);
+	else
+	{
+		LCD_DMA_Wait();
+		spi_set_format(LCD_SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+		lcd_dma_16bit = 1;
+	}
+	lcd_dma_pending = 1;
+	dma_channel_set_config(lcd_dma_chan, &lcd_dma_cfg_buf16, false);
+	dma_channel_transfer_from_buffer_now(lcd_dma_chan, buf, count);
+}
+
+/******************************************************************************
+	  ˵ظͬһ
+	  ݣcolor ɫ(RGB565)
+				count ظ
+	  ֵ  
+	  ˵    SPIʱлΪ16λ֡,DMA̶ַָɫֵ,
+				Ҫ仺,RAMռ޹
+******************************************************************************/
+void LCD_DMA_Fill(uint16_t color, uint32_t count)
+{
+	if (count == 0)
+		return;
+	LCD_DMA_Wait();
+	lcd_dma_color = color;
+	spi_set_format(LCD_SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST); // 16λֽ֡ȷ,LCD_WR_DATA˳һ
+	lcd_dma_16bit = 1;
+	lcd_dma_pending = 1;
+	dma_channel_set_config(lcd_dma_chan, &lcd_dma_cfg_fill, false);
+	dma_channel_transfer_from_buffer_now(lcd_dma_chan, &lcd_dma_color, count);
+}
+
+#endif
+
+/******************************************************************************
+	  ˵ȴһδ
+	  ݣ
+	  ֵ  
+	  ˵    DMAԿSPI FIFO,ȴ߿клDC
+******************************************************************************/
+void LCD_DMA_Wait(void)
+{
+	if (!lcd_dma_pending)
+		return;
+
+	dma_channel_wait_for_finish_blocking(lcd_dma_chan);
+	while (spi_is_busy(LCD_SPI_PORT))
+		tight_loop_contents();
+
+	// ֻ,սFIFO־
+	while (spi_is_readable(LCD_SPI_PORT))
+		(void)spi_get_hw(LCD_SPI_PORT)->dr;
+	spi_get_hw(LCD_SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+
+	lcd_dma_pending = 0;
+
+	if (lcd_dma_16bit) // ָͲʹõ8λ֡
+	{
+		spi_set_format(LCD_SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+		lcd_dma_16bit = 0;
+	}
+}
+
+/******************************************************************************
+	  ˵ѯǷڽ
+	  ݣ
+	  ֵ  1 ڷ  0 
+******************************************************************************/
+bool LCD_DMA_Busy(void)
+{
+	if (!lcd_dma_pending)
+		return 0;
+	return dma_channel_is_busy(lcd_dma_chan) || spi_is_busy(LCD_SPI_PORT);
+}
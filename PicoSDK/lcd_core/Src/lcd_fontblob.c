@@ -0,0 +1,201 @@
+#include "Inc/lcd_fontblob.h"
+#include "Inc/lcd.h"
+#include "Inc/lcd_dma.h"
+#include "hardware/sync.h"
+#include <string.h>
+
+/******************************************************************************
+	  ˵鲢ֿ
+	  ݣblob ֿ
+				addr ֿļ׵ַ,һΪLCD_FONT_BLOB_ADDR
+	  ֵ  0 ɹ  1 Чֿļ
+	  ˵    ֻļͷ,κ,֮Ķȡֱӷaddr
+******************************************************************************/
+uint8_t LCD_FontBlob_Open(LCD_FontBlob *blob, const uint8_t *addr)
+{
+	const LCD_FontBlob_Header *h = (const LCD_FontBlob_Header *)addr;
+
+	if (memcmp(h->magic, "LCDF", 4) != 0 || h->version != LCD_FONT_BLOB_VERSION)
+		return 1;
+	if (h->bpp != 1 && h->bpp != 2 && h->bpp != 4)
+		return 1;
+	if (h->size < sizeof(LCD_FontBlob_Header) || h->count == 0 ||
+		h->count > (h->size - sizeof(LCD_FontBlob_Header)) / sizeof(LCD_FontBlob_Entry))
+		return 1;
+	blob->head = h;
+	blob->index = (const LCD_FontBlob_Entry *)(addr + sizeof(LCD_FontBlob_Header));
+	blob->bitmap = (const uint8_t *)(blob->index + h->count);
+	return 0;
+}
+
+/******************************************************************************
+	  ˵һַ
+	  ݣblob ֿ
+				code ASCIIGB2312
+	  ֵ  ַ,ֿûʱNULL
+	  ˵    code,flashֱӶֲ
+******************************************************************************/
+const LCD_FontBlob_Entry *LCD_FontBlob_Find(const LCD_FontBlob *blob, uint16_t code)
+{
+	uint32_t lo = 0, hi = blob->head->count;
+
+	while (lo < hi)
+	{
+		uint32_t mid = (lo + hi) / 2;
+		uint16_t c = blob->index[mid].code;
+
+		if (c == code)
+			return &blob->index[mid];
+		if (c < code)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return NULL;
+}
+
+/******************************************************************************
+	  ˵ȡַеһַ
+	  ݣ*s ַָ,ʱָһַ
+	  ֵ  ASCIIGB2312
+******************************************************************************/
+static uint16_t LCD_FontBlob_Next(const uint8_t **s)
+{
+	const uint8_t *p = *s;
+
+	if (p[0] >= 0x80 && p[1] != '\0') // ռֽ
+	{
+		*s = p + 2;
+		return (p[0] << 8) | p[1];
+	}
+	*s = p + 1;
+	return p[0];
+}
+
+/******************************************************************************
+	  ˵ȡһַģ
+	  ݣblob ֿ
+				code ASCIIGB2312
+				g ַģϢ
+	  ֵ  ģ׵ַ,ֿûиַʱNULL
+	  ˵    ֿûеַ,ռһ,ASCIIռ
+******************************************************************************/
+static const uint8_t *LCD_FontBlob_Glyph(const LCD_FontBlob *blob, uint16_t code, LCD_Glyph *g)
+{
+	const LCD_FontBlob_Entry *e = LCD_FontBlob_Find(blob, code);
+
+	if (e == NULL)
+	{
+		g->offset = 0;
+		g->width = 0;
+		g->height = 0;
+		g->x_off = 0;
+		g->y_off = 0;
+		g->advance = (code >= 0x80) ? blob->head->height : blob->head->height / 2;
+		return NULL;
+	}
+	g->offset = e->offset;
+	g->width = e->width;
+	g->height = e->height;
+	g->x_off = e->x_off;
+	g->y_off = e->y_off;
+	g->advance = e->advance;
+	return blob->bitmap + e->offset;
+}
+
+/******************************************************************************
+	  ˵ַʾ
+	  ݣblob ֿ
+				*s ַ,ӢĻ
+	  ֵ  ַǰ֮(),ʾκ
+******************************************************************************/
+uint16_t LCD_FontBlob_Measure(const LCD_FontBlob *blob, const uint8_t *s)
+{
+	uint16_t w = 0;
+	LCD_Glyph g;
+
+	while (*s != '\0')
+	{
+		LCD_FontBlob_Glyph(blob, LCD_FontBlob_Next(&s), &g);
+		w += g.advance;
+	}
+	return w;
+}
+
+/******************************************************************************
+	  ˵flashֿʾַ
+	  ݣx,yʾ
+				*s Ҫʾַ,ӢĻ
+				fc ֵɫ
+				bc ֵıɫ
+				blob ֿ
+				mode:  0ǵģʽ  1ģʽ
+	  ֵ  
+	  ˵    ģֱӴXIPַȡ;max_widthLCD_GLYPH_MAX_Wֻֿռλʾ
+******************************************************************************/
+void LCD_ShowStringBlob(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, const LCD_FontBlob *blob, uint8_t mode)
+{
+	const LCD_Font font = {blob->head->max_width, blob->head->height, 0, blob->head->bpp, 1, 0, blob->bitmap, -1, NULL};
+	LCD_Glyph g;
+
+	while (*s != '\0' && x < LCD_W)
+	{
+		const uint8_t *src = LCD_FontBlob_Glyph(blob, LCD_FontBlob_Next(&s), &g);
+
+		x += LCD_ShowGlyphBox(x, y, &font, &g, src, fc, bc, mode);
+	}
+}
+
+/******************************************************************************
+	  ˵ֿ
+	  ݣsize Ҫֽ,ȡ
+	  ֵ  0 ɹ  1 ֿ
+	  ˵    дڼXIP,ȵLCDDMA(flashͼƬ)ɲж;
+				һҲ,ǰmulticore_lockoutͣ
+******************************************************************************/
+uint8_t LCD_FontBlob_Erase(uint32_t size)
+{
+	uint32_t ints;
+
+	if (size == 0 || size > LCD_FONT_BLOB_SIZE)
+		return 1;
+	size = (size + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE * FLASH_SECTOR_SIZE;
+	LCD_DMA_Wait();
+	ints = save_and_disable_interrupts();
+	flash_range_erase(LCD_FONT_BLOB_OFFSET, size);
+	restore_interrupts(ints);
+	return 0;
+}
+
+/******************************************************************************
+	  ˵ֿдһ
+	  ݣpos ֿеλ,ΪFLASH_PAGE_SIZE
+				data ,RAM
+				len ֽ,һҳβ0xFF
+	  ֵ  0 ɹ  1 λδ򳬳ֿ
+	  ˵    дǰLCD_FontBlob_Erase;ֿɷֶν,
+				ÿΰҳд,ȫдLCD_FontBlob_Open
+******************************************************************************/
+uint8_t LCD_FontBlob_Write(uint32_t pos, const uint8_t *data, uint32_t len)
+{
+	static uint8_t page[FLASH_PAGE_SIZE];
+	uint32_t full = len / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE;
+	uint32_t ints;
+
+	if (pos % FLASH_PAGE_SIZE != 0 || len == 0 || pos >= LCD_FONT_BLOB_SIZE ||
+		(len + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE > LCD_FONT_BLOB_SIZE - pos)
+		return 1;
+	if (len > full)
+	{
+		memset(page, 0xFF, sizeof(page));
+		memcpy(page, data + full, len - full);
+	}
+	LCD_DMA_Wait();
+	ints = save_and_disable_interrupts();
+	if (full)
+		flash_range_program(LCD_FONT_BLOB_OFFSET + pos, data, full);
+	if (len > full)
+		flash_range_program(LCD_FONT_BLOB_OFFSET + pos + full, page, FLASH_PAGE_SIZE);
+	restore_interrupts(ints);
+	return 0;
+}
@@ -1,5 +1,6 @@
 #include "Inc/lcd_init.h"
 #include "hardware/spi.h"
+#include "Inc/lcd_dma.h"
 
 static void LCD_GPIO_Init(void)
 {
@@ -11,6 +12,7 @@ static void LCD_GPIO_Init(void)
 	spi_init(LCD_SPI_PORT, 4 * 1000 * 1000);
 	spi_set_format(LCD_SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
 	spi_set_slave(LCD_SPI_PORT, false);
+	LCD_DMA_Init();
 
 	gpio_set_function(LCD_RES_PIN, GPIO_FUNC_SIO);
 	gpio_set_function(LCD_DC_PIN, GPIO_FUNC_SIO);
@@ -34,6 +36,7 @@ static void LCD_GPIO_Init(void)
 ******************************************************************************/
 static inline void LCD_Writ_Bus(uint8_t dat)
 {
+	LCD_DMA_Wait(); // ȴDMA,FIFOеݽ
 	spi_write_blocking(LCD_SPI_PORT, &dat, 1);
 }
 
@@ -48,14 +51,21 @@ static inline void LCD_WR_DATA8(uint8_t dat)
 }
 
 /******************************************************************************
-	  ˵LCDд
-	  ݣdat д
+	  ˵LCDдһ
+	  ݣdat RGB565ɫ
 	  ֵ  
+	  ˵    RGB666չΪR/G/Bֽڷ
 ******************************************************************************/
 inline void LCD_WR_DATA(uint16_t dat)
 {
+#if LCD_PIXEL_BYTES == 3
+	LCD_Writ_Bus((dat >> 8) & 0xF8); // ɫ
+	LCD_Writ_Bus((dat >> 3) & 0xFC); // ɫ
+	LCD_Writ_Bus(dat << 3);			 // ɫ
+#else
 	LCD_Writ_Bus(dat >> 8);
 	LCD_Writ_Bus(dat);
+#endif
 }
 
 /******************************************************************************
@@ -65,30 +75,75 @@ inline void LCD_WR_DATA(uint16_t dat)
 ******************************************************************************/
 static inline void LCD_WR_REG(uint8_t dat)
 {
+	LCD_DMA_Wait(); // DC߿кл
 	LCD_DC_Clr(); // д
 	LCD_Writ_Bus(dat);
 	LCD_DC_Set();
 }
 
+/******************************************************************************
+	  ˵дһ16λַ
+	  ݣa,b ʼͽַ
+	  ֵ  
+	  ˵    4ֽһдSPI FIFO,ֽǰ
+******************************************************************************/
+static inline void LCD_WR_Range(uint16_t a, uint16_t b)
+{
+	uint8_t buf[4] = {a >> 8, a, b >> 8, b};
+
+	spi_write_blocking(LCD_SPI_PORT, buf, 4);
+}
+
+static uint8_t lcd_scan_flip; // LCD_Set_ScanתзʱΪ1
+
 /******************************************************************************
 	  ˵ʼͽַ
 	  ݣx1,x2 еʼͽַ
 				y1,y2 еʼͽַ
 	  ֵ  
+	  ˵    lcd_panelеǰԴƫ;LCD_Set_ScanתзMYλ
+				һͬ,ƫȡUSE_HORIZONTAL^1
 ******************************************************************************/
 void LCD_Address_Set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
+	uint16_t xo = lcd_panel.x_off[USE_HORIZONTAL], yo = lcd_panel.y_off[USE_HORIZONTAL ^ lcd_scan_flip];
+
 	LCD_WR_REG(0x2a); // еַ
-	LCD_WR_DATA(x1);
-	LCD_WR_DATA(x2);
+	LCD_WR_Range(x1 + xo, x2 + xo);
 	LCD_WR_REG(0x2b); // еַ
-	LCD_WR_DATA(y1);
-	LCD_WR_DATA(y2);
+	LCD_WR_Range(y1 + yo, y2 + yo);
 	LCD_WR_REG(0x2c); // д
 }
 
+/******************************************************************************
+	  ˵дԴʱз
+	  ݣbottom_up 0:ϵ(LCD_Init) 1:µ
+	  ֵ  0 ɹ  1 ʱ֧
+	  ˵    ʱת0x36ĴMYλ,֮󴰿ڵеַyӦĻLCD_H-1-y,
+				ɰļ˳(һǰ)BMPͼƬ;ָΪ0
+******************************************************************************/
+uint8_t LCD_Set_Scan(uint8_t bottom_up)
+{
+	uint8_t madctl = lcd_panel.madctl[USE_HORIZONTAL];
+
+	if (USE_HORIZONTAL >= 2)
+		return 1; // ʱеַӦԴ,ת
+	LCD_WR_REG(0x36);
+	LCD_WR_DATA8(bottom_up ? madctl ^ 0x80 : madctl); // LCD_Init0x36һ
+	lcd_scan_flip = bottom_up ? 1 : 0;				  // ֮Ĵڰתƫ
+	return 0;
+}
+
+/******************************************************************************
+	  ˵LCDʼ
+	  ݣ
+	  ֵ  
+	  ˵    λlcd_panel.initͳʼ
+******************************************************************************/
 void LCD_Init(void)
 {
+	const uint8_t *p = lcd_panel.init, *end = p + lcd_panel.init_len;
+
 	LCD_GPIO_Init(); // ʼGPIO
 
 	LCD_RES_Clr(); // λ
@@ -96,112 +151,17 @@ void LCD_Init(void)
 	LCD_RES_Set();
 	sleep_ms(100);
 
-	//************* Start Initial Sequence **********//
-	LCD_WR_REG(0x11); // Sleep out
-	sleep_ms(120);	  // Delay 120ms
-	//************* Start Initial Sequence **********//
-	LCD_WR_REG(0xCF);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0xD9);
-	LCD_WR_DATA8(0X30);
-
-	LCD_WR_REG(0xED);
-	LCD_WR_DATA8(0x64);
-	LCD_WR_DATA8(0x03);
-	LCD_WR_DATA8(0X12);
-	LCD_WR_DATA8(0X81);
-
-	LCD_WR_REG(0xE8);
-	LCD_WR_DATA8(0x85);
-	LCD_WR_DATA8(0x10);
-	LCD_WR_DATA8(0x78);
-
-	LCD_WR_REG(0xCB);
-	LCD_WR_DATA8(0x39);
-	LCD_WR_DATA8(0x2C);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x34);
-	LCD_WR_DATA8(0x02);
-
-	LCD_WR_REG(0xF7);
-	LCD_WR_DATA8(0x20);
-
-	LCD_WR_REG(0xEA);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x00);
-
-	LCD_WR_REG(0xC0);	// Power control
-	LCD_WR_DATA8(0x21); // VRH[5:0]
-
-	LCD_WR_REG(0xC1);	// Power control
-	LCD_WR_DATA8(0x12); // SAP[2:0];BT[3:0]
-
-	LCD_WR_REG(0xC5); // VCM control
-	LCD_WR_DATA8(0x32);
-	LCD_WR_DATA8(0x3C);
-
-	LCD_WR_REG(0xC7); // VCM control2
-	LCD_WR_DATA8(0XC1);
-
-	LCD_WR_REG(0x36); // Memory Access Control
-	if (USE_HORIZONTAL == 0)
-		LCD_WR_DATA8(0x08);
-	else if (USE_HORIZONTAL == 1)
-		LCD_WR_DATA8(0xC8);
-	else if (USE_HORIZONTAL == 2)
-		LCD_WR_DATA8(0x78);
-	else
-		LCD_WR_DATA8(0xA8);
-
-	LCD_WR_REG(0x3A);
-	LCD_WR_DATA8(0x55);
-
-	LCD_WR_REG(0xB1);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x18);
-
-	LCD_WR_REG(0xB6); // Display Function Control
-	LCD_WR_DATA8(0x0A);
-	LCD_WR_DATA8(0xA2);
-
-	LCD_WR_REG(0xF2); // 3Gamma Function Disable
-	LCD_WR_DATA8(0x00);
-
-	LCD_WR_REG(0x26); // Gamma curve selected
-	LCD_WR_DATA8(0x01);
-
-	LCD_WR_REG(0xE0); // Set Gamma
-	LCD_WR_DATA8(0x0F);
-	LCD_WR_DATA8(0x20);
-	LCD_WR_DATA8(0x1E);
-	LCD_WR_DATA8(0x09);
-	LCD_WR_DATA8(0x12);
-	LCD_WR_DATA8(0x0B);
-	LCD_WR_DATA8(0x50);
-	LCD_WR_DATA8(0XBA);
-	LCD_WR_DATA8(0x44);
-	LCD_WR_DATA8(0x09);
-	LCD_WR_DATA8(0x14);
-	LCD_WR_DATA8(0x05);
-	LCD_WR_DATA8(0x23);
-	LCD_WR_DATA8(0x21);
-	LCD_WR_DATA8(0x00);
-
-	LCD_WR_REG(0XE1); // Set Gamma
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x19);
-	LCD_WR_DATA8(0x19);
-	LCD_WR_DATA8(0x00);
-	LCD_WR_DATA8(0x12);
-	LCD_WR_DATA8(0x07);
-	LCD_WR_DATA8(0x2D);
-	LCD_WR_DATA8(0x28);
-	LCD_WR_DATA8(0x3F);
-	LCD_WR_DATA8(0x02);
-	LCD_WR_DATA8(0x0A);
-	LCD_WR_DATA8(0x08);
-	LCD_WR_DATA8(0x25);
-	LCD_WR_DATA8(0x2D);
-	LCD_WR_DATA8(0x0F);
-	LCD_WR_REG(0x29); // Display on
+	while (p < end)
+	{
+		uint8_t cmd = *p++, n = *p++;
+		uint8_t len = n & ~LCD_INIT_DELAY;
+
+		LCD_WR_REG(cmd);
+		if (cmd == 0x36 && len == 0) // ʾд
+			LCD_WR_DATA8(lcd_panel.madctl[USE_HORIZONTAL]);
+		while (len--)
+			LCD_WR_DATA8(*p++);
+		if (n & LCD_INIT_DELAY)
+			sleep_ms(*p++);
+	}
 }
@@ -0,0 +1,39 @@
+# Driver core shared by every panel project. A panel only provides
+# Inc/lcd_init.h (pins, size, pixel format, touch controller) and
+# Src/lcd_panel.c (init sequence, MADCTL and GRAM offsets per rotation).
+#
+#   include(${CMAKE_CURRENT_LIST_DIR}/../lcd_core/lcd_core.cmake)
+#   lcd_core_add(<target>)
+#
+# The panel directory must come first on the include path so that
+# "Inc/lcd_init.h" resolves to the panel's own header.
+
+set(LCD_CORE_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+set(LCD_CORE_SOURCES
+        ${LCD_CORE_DIR}/Src/lcd.c
+        ${LCD_CORE_DIR}/Src/lcd_init.c
+        ${LCD_CORE_DIR}/Src/lcd_dma.c
+        ${LCD_CORE_DIR}/Src/lcd_fontblob.c
+        ${LCD_CORE_DIR}/Src/lcd_bmp.c
+        )
+
+# Both touch drivers are listed; LCD_TOUCH in Inc/lcd_init.h compiles one of them.
+set(LCD_CORE_TOUCH_SOURCES
+        ${LCD_CORE_DIR}/Src/iic_hal.c
+        ${LCD_CORE_DIR}/Src/ft6236.c
+        ${LCD_CORE_DIR}/Src/CST816.c
+        )
+
+function(lcd_core_add target)
+    target_sources(${target} PRIVATE
+            ${CMAKE_CURRENT_SOURCE_DIR}/Src/lcd_panel.c
+            ${LCD_CORE_SOURCES}
+            ${LCD_CORE_TOUCH_SOURCES}
+            ${LCD_CORE_DIR}/Src/lcd_bench.c
+            )
+    target_include_directories(${target} PRIVATE
+            ${CMAKE_CURRENT_SOURCE_DIR}
+            ${LCD_CORE_DIR}
+            )
+endfunction()
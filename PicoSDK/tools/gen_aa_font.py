@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Build Inc/lcdfont_aa.h, anti-aliased fonts derived from Inc/lcdfont.h.
+
+    python3 PicoSDK/tools/gen_aa_font.py [--bpp 2|4] PicoSDK/lcd_core/Inc/lcdfont.h
+
+Each anti-aliased font is the 1-bpp table of twice its size, box-filtered
+2x2 and quantised to 2 or 4 bits per pixel: ascii_3216 gives an 8x16 font,
+ascii_2412 a 6x12 one, tfont32/tfont24 give 16x16/12x12 Chinese fonts that
+keep the entry order of their source, so lcd_gb_index still finds them.
+
+Output rows are packed most significant pixel first, stride = ceil(w*bpp/8).
+Every font gets an LCD_Font descriptor; lcd.c includes the header and lcd.h
+declares the descriptors. Run it again after changing lcdfont.h.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# (source table, output table, descriptor, gb slot of the source or -1 for ASCII)
+FONTS = (
+    ("ascii_2412", "ascii_aa_0612", "LCD_Font_AA12", -1),
+    ("ascii_3216", "ascii_aa_0816", "LCD_Font_AA16", -1),
+    ("tfont24", "tfont_aa12", "LCD_Font_GB_AA12", 2),
+    ("tfont32", "tfont_aa16", "LCD_Font_GB_AA16", 3),
+)
+SCALE = 2
+
+ASCII_RE = re.compile(rb"ascii_(\d\d)(\d\d)\s*\[\s*\]\s*\[\s*(\d+)\s*\]\s*=\s*\{(.*?)\n\s*\}\s*;", re.S)
+GB_RE = re.compile(rb"tfont(\d+)\s*\[\s*\]\s*=\s*\{(.*?)\n\s*\}\s*;", re.S)
+HEX_RE = re.compile(rb"0[xX]([0-9A-Fa-f]{2})")
+# ASCII rows look like {0x..,...},/*"c",n*/ ; Chinese entries start with "xx",
+ASCII_ROW_RE = re.compile(rb"^\s*\{([^}]*)\}", re.M)
+GB_ROW_RE = re.compile(rb'^[ \t]*"(..)"\s*,(.*?)(?=^[ \t]*"|\Z)', re.M | re.S)
+
+
+def parse(font_h):
+    """Return {name: (width, height, [(label, bytes), ...])} for every table."""
+    with open(font_h, "rb") as f:
+        text = f.read()
+    tables = {}
+    for m in ASCII_RE.finditer(text):
+        h, w = int(m.group(1)), int(m.group(2))
+        rows = [bytes(int(b, 16) for b in HEX_RE.findall(r.group(1)))
+                for r in ASCII_ROW_RE.finditer(m.group(4))]
+        labels = [chr(0x20 + i) for i in range(len(rows))]
+        tables["ascii_%02d%02d" % (h, w)] = (w, h, list(zip(labels, rows)))
+    for m in GB_RE.finditer(text):
+        size = int(m.group(1))
+        glyphs = [(e.group(1).decode("gbk"), bytes(int(b, 16) for b in HEX_RE.findall(e.group(2))))
+                  for e in GB_ROW_RE.finditer(m.group(2))]
+        tables["tfont%d" % size] = (size, size, glyphs)
+    return tables
+
+
+def levels(glyph, w, h, bpp, scale=SCALE):
+    """1-bpp LSB-first glyph of w x h -> rows of (w/scale) x (h/scale) grey levels."""
+    src_stride = (w + 7) // 8
+    top = (1 << bpp) - 1
+    out = []
+    for y in range(h // scale):
+        row = []
+        for x in range(w // scale):
+            cover = 0
+            for dy in range(scale):
+                line = glyph[(y * scale + dy) * src_stride:]
+                for dx in range(scale):
+                    sx = x * scale + dx
+                    cover += (line[sx >> 3] >> (sx & 7)) & 1
+            row.append((cover * top + scale * scale // 2) // (scale * scale))
+        out.append(row)
+    return out
+
+
+def pack(rows, bpp):
+    """Pack rows of grey levels most significant pixel first -> (stride, bytes)."""
+    stride = (len(rows[0]) * bpp + 7) // 8 if rows else 0
+    out = bytearray()
+    for row in rows:
+        acc = nbits = 0
+        for level in row:
+            acc = (acc << bpp) | level
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc = nbits = 0
+        if nbits:
+            out.append(acc << (8 - nbits))
+    return stride, bytes(out)
+
+
+def downsample(glyph, w, h, bpp):
+    """1-bpp LSB-first glyph of w x h -> packed (w/SCALE) x (h/SCALE) grey levels."""
+    stride, data = pack(levels(glyph, w, h, bpp), bpp)
+    return w // SCALE, h // SCALE, stride, data
+
+
+def emit(tables, bpp, out_h):
+    lines = [
+        "/* 由 PicoSDK/tools/gen_aa_font.py 根据 lcdfont.h 生成(%dbpp),修改字库后重新运行,请勿手工编辑 */" % bpp,
+        "#ifndef __LCDFONT_AA_H",
+        "#define __LCDFONT_AA_H",
+        "",
+        '#include "lcd.h"',
+        "",
+    ]
+    descs = []
+    for src, dst, desc, gb in FONTS:
+        if src not in tables:
+            sys.exit("%s: no %s table" % (out_h, src))
+        w, h, glyphs = tables[src]
+        conv = [(label, downsample(data, w, h, bpp)) for label, data in glyphs]
+        ow, oh, stride, _ = conv[0][1]
+        size = stride * oh
+        lines.append("const unsigned char %s[][%d]={ // %dx%d,由%s缩小一半" % (dst, size, ow, oh, src))
+        for label, (_, _, _, data) in conv:
+            lines.append("{%s},/*\"%s\"*/" % (",".join("0x%02X" % b for b in data), label.replace("\\", "\\\\")))
+        lines += ["};", ""]
+        descs.append("const LCD_Font %s = {%d, %d, %d, %d, 1, sizeof(%s[0]), %s[0], %d, NULL};" % (desc, ow, oh, stride, bpp, dst, dst, gb))
+    lines += descs + ["", "#endif", ""]
+    with open(out_h, "w", encoding="gbk", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--bpp", type=int, choices=(2, 4), default=2)
+    ap.add_argument("font_h", nargs="+")
+    args = ap.parse_args()
+    for font_h in args.font_h:
+        out_h = os.path.join(os.path.dirname(font_h), "lcdfont_aa.h")
+        emit(parse(font_h), args.bpp, out_h)
+        print("%s: %dbpp" % (out_h, args.bpp))
+
+
+if __name__ == "__main__":
+    main()
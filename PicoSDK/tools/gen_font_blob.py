@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""Build a flash font file (LCDF) for Src/lcd_fontblob.c from Inc/lcdfont.h.
+
+    python3 PicoSDK/tools/gen_font_blob.py --size 16 -o font16.bin PicoSDK/lcd_core/Inc/lcdfont.h
+    picotool load -o 0x10100000 font16.bin
+
+The file holds the ASCII table of the given size (trimmed to bounding boxes
+like gen_prop_font.py, so it is variable width) and every Chinese glyph of
+tfont<size> (trimmed too, but advancing a full cell). With --bpp 2 or 4 the
+glyphs come from the tables of twice the size, downsampled as in
+gen_aa_font.py. Load it at XIP_BASE + LCD_FONT_BLOB_OFFSET (1 MB by default)
+or write it at run time with LCD_FontBlob_Erase/LCD_FontBlob_Write.
+
+Layout, little endian, see Inc/lcd_fontblob.h:
+    header  "LCDF", version, bpp, height, max_width, u32 count, u32 size
+    index   count x {u16 code, u8 width, height, x_off, y_off, advance, 0, u32 offset}
+            sorted by code: ASCII < 0x80, GB2312 codes high byte first
+    bitmaps offsets relative to the end of the index
+"""
+
+import argparse
+import struct
+import sys
+
+from gen_aa_font import levels, pack, parse
+from gen_prop_font import trim
+
+VERSION = 1
+ASCII = {12: "ascii_1206", 16: "ascii_1608", 24: "ascii_2412", 32: "ascii_3216"}
+HEADER = struct.Struct("<4sBBBBII")
+ENTRY = struct.Struct("<HBBBBBBI")
+
+
+def glyphs(tables, size, bpp):
+    """Yield (code, x_off, y_off, rows, advance) for every glyph of one size."""
+    scale = 1 if bpp == 1 else 2
+    src = size * scale
+    if ASCII.get(src) not in tables or "tfont%d" % src not in tables:
+        sys.exit("size %d at %dbpp needs the %d-pixel ASCII and tfont%d tables" % (size, bpp, src, src))
+    w, h, table = tables[ASCII[src]]
+    for label, data in table:
+        _, y0, rows, advance = trim(levels(data, w, h, bpp, scale), w // scale, h // scale)
+        yield ord(label), 0, y0, rows, advance
+    w, h, table = tables["tfont%d" % src]
+    for label, data in table:
+        x0, y0, rows, _ = trim(levels(data, w, h, bpp, scale), w // scale, h // scale)
+        yield int.from_bytes(label.encode("gbk"), "big"), x0, y0, rows, size
+
+
+def build(tables, size, bpp):
+    entries, bitmap, max_w = {}, bytearray(), 1
+    for code, x0, y0, rows, advance in glyphs(tables, size, bpp):
+        if code in entries:  # first entry wins, as lcd_gb_index does
+            continue
+        w, h = (len(rows[0]), len(rows)) if rows else (0, 0)
+        entries[code] = ENTRY.pack(code, w, h, x0, y0, advance, 0, len(bitmap))
+        bitmap += pack(rows, bpp)[1]
+        max_w = max(max_w, w)
+    index = b"".join(entries[c] for c in sorted(entries))
+    total = HEADER.size + len(index) + len(bitmap)
+    return HEADER.pack(b"LCDF", VERSION, bpp, size, max_w, len(entries), total) + index + bitmap, len(entries)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--size", type=int, choices=sorted(ASCII), default=16)
+    ap.add_argument("--bpp", type=int, choices=(1, 2, 4), default=1)
+    ap.add_argument("-o", "--output", required=True)
+    ap.add_argument("font_h")
+    args = ap.parse_args()
+    blob, count = build(parse(args.font_h), args.size, args.bpp)
+    with open(args.output, "wb") as f:
+        f.write(blob)
+    print("%s: %d glyphs, %d bytes" % (args.output, count, len(blob)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Build Inc/lcdfont_index.h from the GB2312 glyph tables in Inc/lcdfont.h.
+
+    python3 PicoSDK/tools/gen_gb_index.py PicoSDK/lcd_core/Inc/lcdfont.h
+
+lcdfont.h holds one table per size (tfont12, tfont16, tfont24, tfont32), each
+entry starting with the 2-byte GB code as a string literal. The index lists
+every code once, sorted, with the entry number in each of the four tables, so
+LCD_ShowChineseNNxNN can binary search it instead of scanning the tables. A
+second table maps each glyph's Unicode code point to its GB code, sorted by
+code point, for LCD_ShowUTF8.
+Run it again after adding glyphs; the tables themselves stay as generated by
+the font tool.
+"""
+
+import os
+import re
+import sys
+
+SIZES = (12, 16, 24, 32)
+NONE = 0xFFFF
+
+TABLE_RE = re.compile(rb"tfont(\d+)\s*\[\s*\]\s*=\s*\{(.*?)\n\s*\}\s*;", re.S)
+# Entries start a line; the commented-out "/*"x",...*/" samples do not
+ENTRY_RE = re.compile(rb'^[ \t]*"(..)"\s*,', re.M)
+
+
+def parse(font_h):
+    with open(font_h, "rb") as f:
+        text = f.read()
+    tables = {}
+    for m in TABLE_RE.finditer(text):
+        size = int(m.group(1))
+        if size in SIZES:
+            tables[size] = [e.group(1) for e in ENTRY_RE.finditer(m.group(2))]
+    missing = [s for s in SIZES if s not in tables]
+    if missing:
+        sys.exit("%s: no tfont%s table" % (font_h, "/".join(map(str, missing))))
+    return tables
+
+
+def build(tables):
+    index = {}
+    for n, size in enumerate(SIZES):
+        for k, code in enumerate(tables[size]):
+            slots = index.setdefault(code, [NONE] * len(SIZES))
+            if slots[n] == NONE:  # first entry wins, as the old linear scan drew it
+                slots[n] = k
+    return sorted(index.items())
+
+
+def emit(index, out_h):
+    lines = [
+        "/* 由 PicoSDK/tools/gen_gb_index.py 根据 lcdfont.h 生成,修改字库后重新运行,请勿手工编辑 */",
+        "#ifndef __LCDFONT_INDEX_H",
+        "#define __LCDFONT_INDEX_H",
+        "",
+        "#define LCD_GB_NONE 0xFFFF // 该字号的字库中没有这个汉字",
+        "",
+        "typedef struct",
+        "{",
+        "\tuint16_t Code;\t  // GB2312内码,高字节在前",
+        "\tuint16_t Slot[4]; // 在tfont12/16/24/32中的下标",
+        "} LCD_GB_Index;",
+        "",
+        "/* 按Code升序排列,供LCD_GB_Find二分查找 */",
+        "static const LCD_GB_Index lcd_gb_index[] = {",
+    ]
+    for code, slots in index:
+        cells = ", ".join("LCD_GB_NONE" if s == NONE else str(s) for s in slots)
+        lines.append("\t{0x%02X%02X, {%s}}, // %s" % (code[0], code[1], cells, code.decode("gbk")))
+    lines += [
+        "};",
+        "",
+        "typedef struct",
+        "{",
+        "\tuint16_t Unicode; // 汉字的Unicode码位",
+        "\tuint16_t Code;\t  // GB2312内码,高字节在前",
+        "} LCD_GB_Unicode;",
+        "",
+        "/* 按Unicode升序排列,供LCD_GB_FromUnicode二分查找 */",
+        "static const LCD_GB_Unicode lcd_gb_unicode[] = {",
+    ]
+    chars = sorted((ord(code.decode("gbk")), code) for code, _ in index)
+    for u, code in chars:
+        lines.append("\t{0x%04X, 0x%02X%02X}, // %s" % (u, code[0], code[1], chr(u)))
+    lines += ["};", "", "#endif", ""]
+    with open(out_h, "w", encoding="gbk", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit(__doc__)
+    for font_h in argv[1:]:
+        out_h = os.path.join(os.path.dirname(font_h), "lcdfont_index.h")
+        index = build(parse(font_h))
+        emit(index, out_h)
+        print("%s: %d glyphs" % (out_h, len(index)))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
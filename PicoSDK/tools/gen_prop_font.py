@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Build Inc/lcdfont_prop.h, variable-width fonts derived from Inc/lcdfont.h.
+
+    python3 PicoSDK/tools/gen_prop_font.py PicoSDK/lcd_core/Inc/lcdfont.h
+
+Each glyph of a fixed-width ASCII table is trimmed to its bounding box and
+stored once in a flat table, most significant pixel first, with an LCD_Glyph
+entry giving its offset, box size, y offset inside the cell and the advance
+(box width plus a small gap; ' ' advances half a cell). LCD_Font_PAA16 is the
+same for the 2-bpp 8x16 font gen_aa_font.py makes from ascii_3216.
+
+lcd.c includes the header and lcd.h declares the descriptors. Run it again
+after changing lcdfont.h.
+"""
+
+import os
+import sys
+
+from gen_aa_font import levels, pack, parse
+
+# (source table, output table, descriptor, bpp, downscale)
+FONTS = (
+    ("ascii_1608", "ascii_p16", "LCD_Font_P16", 1, 1),
+    ("ascii_2412", "ascii_p24", "LCD_Font_P24", 1, 1),
+    ("ascii_3216", "ascii_p32", "LCD_Font_P32", 1, 1),
+    ("ascii_3216", "ascii_paa16", "LCD_Font_PAA16", 2, 2),
+)
+
+
+def trim(rows, cell_w, cell_h):
+    """Rows of grey levels -> (x0, y0, rows inside the bounding box, advance)."""
+    gap = max(1, cell_h // 16)
+    ys = [y for y, row in enumerate(rows) if any(row)]
+    xs = [x for x in range(cell_w) if any(row[x] for row in rows)]
+    if not ys:
+        return 0, 0, [], cell_w // 2
+    x0, x1, y0, y1 = xs[0], xs[-1] + 1, ys[0], ys[-1] + 1
+    return x0, y0, [row[x0:x1] for row in rows[y0:y1]], x1 - x0 + gap
+
+
+def emit(tables, out_h):
+    lines = [
+        "/* 由 PicoSDK/tools/gen_prop_font.py 根据 lcdfont.h 生成,修改字库后重新运行,请勿手工编辑 */",
+        "#ifndef __LCDFONT_PROP_H",
+        "#define __LCDFONT_PROP_H",
+        "",
+        '#include "lcd.h"',
+        "",
+    ]
+    descs = []
+    for src, dst, desc, bpp, scale in FONTS:
+        if src not in tables:
+            sys.exit("%s: no %s table" % (out_h, src))
+        w, h, glyphs = tables[src]
+        cw, ch = w // scale, h // scale
+        data, entries, maxw = bytearray(), [], 1
+        lines.append("const unsigned char %s[]={ // %d像素高变宽字体,由%s生成" % (dst, ch, src))
+        for label, glyph in glyphs:
+            _, y0, rows, advance = trim(levels(glyph, w, h, bpp, scale), cw, ch)
+            bw, bh = (len(rows[0]), len(rows)) if rows else (0, 0)
+            _, packed = pack(rows, bpp)
+            entries.append("\t{%d, %d, %d, 0, %d, %d}, /*\"%s\"*/" % (len(data), bw, bh, y0, advance, label.replace("\\", "\\\\")))
+            if packed:
+                lines.append("%s,/*\"%s\"*/" % (",".join("0x%02X" % b for b in packed), label.replace("\\", "\\\\")))
+            data += packed
+            maxw = max(maxw, bw)
+        lines += ["};", ""]
+        lines.append("const LCD_Glyph %s_glyphs[%d]={ // offset,width,height,x_off,y_off,advance" % (dst, len(entries)))
+        lines += entries + ["};", ""]
+        descs.append("const LCD_Font %s = {%d, %d, 0, %d, 1, 0, %s, -1, %s_glyphs};" % (desc, maxw, ch, bpp, dst, dst))
+    lines += descs + ["", "#endif", ""]
+    with open(out_h, "w", encoding="gbk", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit(__doc__)
+    for font_h in argv[1:]:
+        out_h = os.path.join(os.path.dirname(font_h), "lcdfont_prop.h")
+        emit(parse(font_h), out_h)
+        print("%s: %d fonts" % (out_h, len(FONTS)))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Build Inc/pic_rle.h, run-length encoded copies of the images in Inc/pic.h.
+
+    python3 PicoSDK/tools/gen_rle_image.py PicoSDK/*/Inc/pic.h
+
+Every gImage_xxx array in pic.h (Image2Lcd output, horizontal scan, 16-bit
+RGB565 or 18-bit RGB666 at 3 bytes per pixel) becomes gImage_xxx_rle, which
+LCD_Image_Open/LCD_ShowImage accept like the original.
+
+Format: an 8-byte header "RLE", bpp, width and height (high byte first),
+then the rows. A row is a sequence of packets that never crosses the row
+end: a control byte c with the top bit set repeats the next pixel
+(c & 0x7F) + 1 times, otherwise (c & 0x7F) + 1 literal pixels follow.
+Pixels are stored as in pic.h, high byte first.
+"""
+
+import os
+import re
+import sys
+
+ARRAY_RE = re.compile(r"^const unsigned char (gImage_\w+)\s*\[\d*\]\s*=\s*\{(.*?)\};", re.S | re.M)
+HEX_RE = re.compile(r"0[xX]([0-9A-Fa-f]{2})")
+MAX_PACKET = 128
+
+
+def parse(pic_h):
+    """Return [(name, bpp, width, height, pixel bytes)] for every active array."""
+    with open(pic_h, encoding="gbk") as f:
+        text = f.read()
+    images = []
+    for m in ARRAY_RE.finditer(text):
+        data = bytes(int(b, 16) for b in HEX_RE.findall(m.group(2)))
+        scan, bpp = data[0], data[1]
+        if scan & 0xC3 or bpp not in (16, 18):
+            sys.exit("%s: %s is not a horizontal 16/18-bit Image2Lcd image" % (pic_h, m.group(1)))
+        if scan & 0x10:
+            w, h = (data[2] << 8) | data[3], (data[4] << 8) | data[5]
+        else:
+            w, h = data[2] | (data[3] << 8), data[4] | (data[5] << 8)
+        size = 3 if bpp == 18 else 2
+        pixels = data[8:8 + w * h * size]
+        if len(pixels) != w * h * size:
+            sys.exit("%s: %s is shorter than %dx%d" % (pic_h, m.group(1), w, h))
+        if size == 2 and not scan & 0x10:  # store high byte first, as the panel wants it
+            pixels = bytes(b for i in range(0, len(pixels), 2) for b in (pixels[i + 1], pixels[i]))
+        images.append((m.group(1), bpp, w, h, pixels, len(data)))
+    return images
+
+
+def encode_row(px):
+    """px: list of pixel byte strings for one row -> packed packets."""
+    out = bytearray()
+    literal = []
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            for p in literal:
+                out.extend(p)
+            literal.clear()
+
+    i = 0
+    while i < len(px):
+        run = 1
+        while i + run < len(px) and run < MAX_PACKET and px[i + run] == px[i]:
+            run += 1
+        # a run of two only pays off when no literal is open
+        if run >= 3 or (run == 2 and not literal):
+            flush()
+            out.append(0x80 | (run - 1))
+            out.extend(px[i])
+            i += run
+            continue
+        literal.append(px[i])
+        i += 1
+        if len(literal) == MAX_PACKET:
+            flush()
+    flush()
+    return out
+
+
+def encode(bpp, w, h, pixels):
+    size = 3 if bpp == 18 else 2
+    out = bytearray(b"RLE" + bytes([bpp, w >> 8, w & 0xFF, h >> 8, h & 0xFF]))
+    stride = w * size
+    for y in range(h):
+        row = pixels[y * stride:(y + 1) * stride]
+        out += encode_row([row[x:x + size] for x in range(0, stride, size)])
+    return bytes(out)
+
+
+def emit(images, out_h):
+    lines = [
+        "/* 由 PicoSDK/tools/gen_rle_image.py 根据 pic.h 生成,修改图片后重新运行,请勿手工编辑 */",
+        "#ifndef __PIC_RLE_H",
+        "#define __PIC_RLE_H",
+        "",
+    ]
+    for name, bpp, w, h, pixels, raw in images:
+        blob = encode(bpp, w, h, pixels)
+        lines.append("const unsigned char %s_rle[%d] = { // %dx%d %s,原%d字节" %
+                     (name, len(blob), w, h, "RGB666" if bpp == 18 else "RGB565", raw))
+        for i in range(0, len(blob), 16):
+            lines.append(",".join("0X%02X" % b for b in blob[i:i + 16]) + ",")
+        lines += ["};", ""]
+        print("%s: %s %d -> %d bytes" % (out_h, name, raw, len(blob)))
+    lines += ["#endif", ""]
+    with open(out_h, "w", encoding="gbk", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit(__doc__)
+    for pic_h in argv[1:]:
+        emit(parse(pic_h), os.path.join(os.path.dirname(pic_h), "pic_rle.h"))
+
+
+if __name__ == "__main__":
+    main(sys.argv)